@@ -0,0 +1,89 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import empty = require( './../../../empty' );
+import argsort = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const x = empty( [ 2, 2 ] );
+
+	argsort( x ); // $ExpectType int32ndarray
+	argsort( x, {} ); // $ExpectType int32ndarray
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an ndarray...
+{
+	argsort( '10' ); // $ExpectError
+	argsort( 10 ); // $ExpectError
+	argsort( false ); // $ExpectError
+	argsort( true ); // $ExpectError
+	argsort( null ); // $ExpectError
+	argsort( [] ); // $ExpectError
+	argsort( {} ); // $ExpectError
+	argsort( ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	const x = empty( [ 2, 2 ] );
+
+	argsort( x, '5' ); // $ExpectError
+	argsort( x, true ); // $ExpectError
+	argsort( x, false ); // $ExpectError
+	argsort( x, null ); // $ExpectError
+	argsort( x, [ '5' ] ); // $ExpectError
+	argsort( x, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `dim` option which is not a number...
+{
+	const x = empty( [ 2, 2 ] );
+
+	argsort( x, { 'dim': '5' } ); // $ExpectError
+	argsort( x, { 'dim': true } ); // $ExpectError
+	argsort( x, { 'dim': false } ); // $ExpectError
+	argsort( x, { 'dim': null } ); // $ExpectError
+	argsort( x, { 'dim': [ '5' ] } ); // $ExpectError
+	argsort( x, { 'dim': {} } ); // $ExpectError
+	argsort( x, { 'dim': ( x: number ): number => x } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `sortOrder` option which is not a supported sort order...
+{
+	const x = empty( [ 2, 2 ] );
+
+	argsort( x, { 'sortOrder': '5' } ); // $ExpectError
+	argsort( x, { 'sortOrder': 5 } ); // $ExpectError
+	argsort( x, { 'sortOrder': true } ); // $ExpectError
+	argsort( x, { 'sortOrder': false } ); // $ExpectError
+	argsort( x, { 'sortOrder': null } ); // $ExpectError
+	argsort( x, { 'sortOrder': [ '5' ] } ); // $ExpectError
+	argsort( x, { 'sortOrder': {} } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = empty( [ 2, 2 ] );
+
+	argsort(); // $ExpectError
+	argsort( x, {}, {} ); // $ExpectError
+}
@@ -0,0 +1,37 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var discreteUniform = require( '@stdlib/random/discrete-uniform' );
+var ndarray2array = require( './../../to-array' );
+var argsort = require( './../lib' );
+
+var x = discreteUniform( [ 3, 3, 4 ], -10, 10, {
+	'dtype': 'float64'
+});
+console.log( ndarray2array( x ) );
+
+var y = argsort( x );
+console.log( ndarray2array( y ) );
+
+y = argsort( x, {
+	'dim': 0,
+	'sortOrder': 'descending'
+});
+console.log( ndarray2array( y ) );
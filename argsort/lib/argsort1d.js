@@ -0,0 +1,309 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isLittleEndian = require( '@stdlib/assert/is-little-endian' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var ascending = require( './ascending.js' );
+
+
+// VARIABLES //
+
+// Index of the high and low words of a double-precision floating-point number when viewed as a pair of unsigned 32-bit integers:
+var HIGH = ( isLittleEndian ) ? 1 : 0;
+var LOW = ( isLittleEndian ) ? 0 : 1;
+
+// Number of elements below which insertion sort outperforms radix sort:
+var INSERTION_SORT_THRESHOLD = 32;
+
+// Sign bit mask:
+var SIGN_MASK = 0x80000000;
+
+// Number of radix buckets (i.e., 8-bit digits):
+var RADIX = 256;
+
+
+// FUNCTIONS //
+
+/**
+* Converts the elements of a double-precision floating-point workspace to unsigned 64-bit integer sort keys whose unsigned ordering matches the numeric ordering of the corresponding floating-point values.
+*
+* ## Notes
+*
+* -   For non-negative values, we set the sign bit. For negative values, we flip every bit, thus reversing the ordering of negative values and placing them before non-negative values.
+* -   `NaN` values are mapped to the largest possible key.
+* -   When sorting in descending order, we invert every key.
+*
+* @private
+* @param {NonNegativeInteger} N - number of elements
+* @param {Float64Array} values - input values
+* @param {Uint32Array} words - values viewed as unsigned 32-bit integers
+* @param {Uint32Array} hi - output array for the high words
+* @param {Uint32Array} lo - output array for the low words
+* @param {boolean} descending - boolean indicating whether to invert the keys
+*/
+function toKeys( N, values, words, hi, lo, descending ) {
+	var mask;
+	var h;
+	var l;
+	var i;
+
+	mask = ( descending ) ? 0xffffffff : 0;
+	for ( i = 0; i < N; i++ ) {
+		if ( isnan( values[ i ] ) ) {
+			h = 0xffffffff;
+			l = 0xffffffff;
+		} else {
+			h = words[ (2*i)+HIGH ];
+			l = words[ (2*i)+LOW ];
+			if ( h & SIGN_MASK ) {
+				h = ~h;
+				l = ~l;
+			} else {
+				h |= SIGN_MASK;
+			}
+		}
+		hi[ i ] = ( h ^ mask ) >>> 0;
+		lo[ i ] = ( l ^ mask ) >>> 0;
+	}
+}
+
+/**
+* Stably sorts a list of indices according to corresponding unsigned 64-bit integer keys using insertion sort.
+*
+* @private
+* @param {NonNegativeInteger} N - number of elements
+* @param {Uint32Array} hi - high words
+* @param {Uint32Array} lo - low words
+* @param {Int32Array} idx - indices to sort
+* @returns {Int32Array} sorted indices
+*/
+function insertionSort( N, hi, lo, idx ) {
+	var h;
+	var l;
+	var v;
+	var i;
+	var j;
+	var k;
+
+	for ( i = 1; i < N; i++ ) {
+		v = idx[ i ];
+		h = hi[ v ];
+		l = lo[ v ];
+		j = i - 1;
+		while ( j >= 0 ) {
+			k = idx[ j ];
+			if ( hi[ k ] < h || ( hi[ k ] === h && lo[ k ] <= l ) ) {
+				break;
+			}
+			idx[ j+1 ] = k;
+			j -= 1;
+		}
+		idx[ j+1 ] = v;
+	}
+	return idx;
+}
+
+/**
+* Stably sorts a list of indices according to corresponding unsigned 64-bit integer keys using a least significant digit radix sort.
+*
+* ## Notes
+*
+* -   The function performs one counting pass per 8-bit digit, starting from the least significant digit. A pass is skipped whenever every key has the same digit (e.g., the low words of integer values), as the pass would not change the ordering.
+*
+* @private
+* @param {NonNegativeInteger} N - number of elements
+* @param {Uint32Array} hi - high words
+* @param {Uint32Array} lo - low words
+* @param {Int32Array} idx - indices to sort
+* @param {Int32Array} tmp - temporary index buffer
+* @param {Int32Array} counts - digit counts
+* @returns {Int32Array} sorted indices
+*/
+function radixSort( N, hi, lo, idx, tmp, counts ) {
+	var words;
+	var shift;
+	var skip;
+	var sum;
+	var src;
+	var dst;
+	var t;
+	var c;
+	var p;
+	var i;
+	var j;
+
+	src = idx;
+	dst = tmp;
+	for ( p = 0; p < 8; p++ ) {
+		words = ( p < 4 ) ? lo : hi;
+		shift = ( p % 4 ) * 8;
+
+		// Count the number of occurrences of each digit...
+		for ( i = 0; i < RADIX; i++ ) {
+			counts[ i ] = 0;
+		}
+		for ( i = 0; i < N; i++ ) {
+			counts[ ( words[ i ] >>> shift ) & 0xff ] += 1;
+		}
+		// Skip the pass if all keys share the same digit...
+		skip = false;
+		for ( i = 0; i < RADIX; i++ ) {
+			if ( counts[ i ] === N ) {
+				skip = true;
+				break;
+			}
+		}
+		if ( skip ) {
+			continue;
+		}
+		// Convert the counts to starting positions...
+		sum = 0;
+		for ( i = 0; i < RADIX; i++ ) {
+			c = counts[ i ];
+			counts[ i ] = sum;
+			sum += c;
+		}
+		// Scatter the indices according to the current digit...
+		for ( i = 0; i < N; i++ ) {
+			j = src[ i ];
+			c = ( words[ j ] >>> shift ) & 0xff;
+			dst[ counts[ c ] ] = j;
+			counts[ c ] += 1;
+		}
+		t = src;
+		src = dst;
+		dst = t;
+	}
+	return src;
+}
+
+
+// MAIN //
+
+/**
+* Computes the indices which sort a one-dimensional input ndarray and assigns the indices to a one-dimensional output ndarray.
+*
+* ## Notes
+*
+* -   For typed workspaces, the function maps each element to an order-preserving unsigned 64-bit integer key and performs a stable radix sort of element indices, thus avoiding comparison function invocations.
+* -   For generic workspaces, the function performs a comparison sort which breaks ties according to element index, thus ensuring stability.
+*
+* @private
+* @param {ArrayLikeObject<Object>} arrays - array-like object containing a one-dimensional input ndarray and a one-dimensional output ndarray
+* @param {Object} opts - function options
+* @param {Object} opts.workspace - workspace arrays
+* @param {Array<Function>} opts.accessors - input array element accessors
+* @param {boolean} opts.accessorProtocol - boolean indicating whether the input ndarray must be accessed via accessors
+* @param {boolean} opts.generic - boolean indicating whether the input ndarray has a "generic" data type
+* @param {boolean} opts.descending - boolean indicating whether to sort in descending order
+* @returns {Object} output ndarray
+*/
+function argsort1d( arrays, opts ) {
+	var values;
+	var xbuf;
+	var ybuf;
+	var idx;
+	var get;
+	var ws;
+	var sx;
+	var sy;
+	var ix;
+	var iy;
+	var N;
+	var x;
+	var y;
+	var i;
+
+	x = arrays[ 0 ];
+	y = arrays[ 1 ];
+
+	N = x.shape[ 0 ];
+	xbuf = x.data;
+	ybuf = y.data;
+	sx = x.strides[ 0 ];
+	sy = y.strides[ 0 ];
+	ws = opts.workspace;
+	values = ws.values;
+	idx = ws.indices;
+
+	// Copy the input elements to the workspace...
+	ix = x.offset;
+	if ( opts.accessorProtocol ) {
+		get = opts.accessors[ 0 ];
+		for ( i = 0; i < N; i++ ) {
+			values[ i ] = get( xbuf, ix );
+			idx[ i ] = i;
+			ix += sx;
+		}
+	} else {
+		for ( i = 0; i < N; i++ ) {
+			values[ i ] = xbuf[ ix ];
+			idx[ i ] = i;
+			ix += sx;
+		}
+	}
+	if ( opts.generic ) {
+		idx.sort( ( opts.descending ) ? descending : increasing );
+	} else {
+		toKeys( N, values, ws.words, ws.hi, ws.lo, opts.descending );
+		if ( N < INSERTION_SORT_THRESHOLD ) {
+			idx = insertionSort( N, ws.hi, ws.lo, idx );
+		} else {
+			idx = radixSort( N, ws.hi, ws.lo, idx, ws.tmp, ws.counts );
+		}
+	}
+	iy = y.offset;
+	for ( i = 0; i < N; i++ ) {
+		ybuf[ iy ] = idx[ i ];
+		iy += sy;
+	}
+	return y;
+
+	/**
+	* Comparison function for stably sorting indices in ascending order.
+	*
+	* @private
+	* @param {NonNegativeInteger} a - first index
+	* @param {NonNegativeInteger} b - second index
+	* @returns {number} comparison result
+	*/
+	function increasing( a, b ) {
+		return ascending( values[ a ], values[ b ] ) || ( a - b );
+	}
+
+	/**
+	* Comparison function for stably sorting indices in descending order.
+	*
+	* @private
+	* @param {NonNegativeInteger} a - first index
+	* @param {NonNegativeInteger} b - second index
+	* @returns {number} comparison result
+	*/
+	function descending( a, b ) {
+		return ascending( values[ b ], values[ a ] ) || ( a - b );
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = argsort1d;
@@ -0,0 +1,62 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+
+
+// MAIN //
+
+/**
+* Compares two values for sorting in ascending order, where `NaN` values are considered greater than all other values.
+*
+* @private
+* @param {*} a - first value
+* @param {*} b - second value
+* @returns {number} comparison result
+*
+* @example
+* var v = ascending( 1.0, 2.0 );
+* // returns -1
+*
+* v = ascending( NaN, 2.0 );
+* // returns 1
+*/
+function ascending( a, b ) {
+	if ( isnan( a ) ) {
+		return ( isnan( b ) ) ? 0 : 1;
+	}
+	if ( isnan( b ) ) {
+		return -1;
+	}
+	if ( a < b ) {
+		return -1;
+	}
+	if ( a > b ) {
+		return 1;
+	}
+	return 0;
+}
+
+
+// EXPORTS //
+
+module.exports = ascending;
@@ -0,0 +1,44 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Return a new ndarray containing the indices which sort an input ndarray along a specified dimension.
+*
+* @module @stdlib/ndarray/argsort
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var argsort = require( '@stdlib/ndarray/argsort' );
+*
+* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+*
+* var y = argsort( x );
+* // returns <ndarray>[ [ 1, 2, 0 ], [ 2, 1, 0 ] ]
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
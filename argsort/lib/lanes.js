@@ -0,0 +1,87 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+'use strict';
+
+// MODULES //
+
+var isAccessorArray = require( '@stdlib/array/base/assert/is-accessor-array' );
+var unaryStrided1d = require( './../../base/unary-strided1d' );
+var getShape = require( './../../base/shape' );
+var getDType = require( './../../base/dtype' );
+var getData = require( './../../base/data-buffer' );
+var resolveGetter = require( '@stdlib/array/base/resolve-getter' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Uint32Array = require( '@stdlib/array/uint32' );
+var Int32Array = require( '@stdlib/array/int32' );
+var zeros = require( '@stdlib/array/base/zeros' );
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+var argsort1d = require( './argsort1d.js' );
+
+
+// MAIN //
+
+/**
+* Computes the indices which sort each lane of an input ndarray along a specified dimension and assigns results to an output ndarray.
+*
+* @private
+* @param {ndarray} x - input ndarray
+* @param {ndarray} y - output ndarray
+* @param {NonNegativeInteger} dim - dimension along which to sort
+* @param {boolean} descending - boolean indicating whether to sort in descending order
+* @returns {void}
+*/
+function lanes( x, y, dim, descending ) {
+	var generic;
+	var xbuf;
+	var ws;
+	var N;
+
+	generic = ( String( getDType( x ) ) === 'generic' );
+	xbuf = getData( x );
+
+	// Allocate workspace arrays which can be reused for each lane:
+	N = getShape( x, false )[ dim ];
+	if ( generic ) {
+		ws = {
+			'values': zeros( N ),
+			'indices': zeroTo( N )
+		};
+	} else {
+		ws = {
+			'values': new Float64Array( N ),
+			'indices': new Int32Array( N ),
+			'tmp': new Int32Array( N ),
+			'hi': new Uint32Array( N ),
+			'lo': new Uint32Array( N ),
+			'counts': new Int32Array( 256 )
+		};
+		ws.words = new Uint32Array( ws.values.buffer, ws.values.byteOffset, 2*N );
+	}
+	unaryStrided1d( argsort1d, [ x, y ], [ dim ], {
+		'workspace': ws,
+		'generic': generic,
+		'accessorProtocol': isAccessorArray( xbuf ),
+		'accessors': [ resolveGetter( xbuf ) ],
+		'descending': descending
+	});
+}
+
+
+// EXPORTS //
+
+module.exports = lanes;
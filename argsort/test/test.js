@@ -0,0 +1,399 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int8Array = require( '@stdlib/array/int8' );
+var empty = require( './../../empty' );
+var ndarray2array = require( './../../to-array' );
+var array = require( './../../array' );
+var getDType = require( './../../base/dtype' );
+var getShape = require( './../../base/shape' );
+var getOrder = require( './../../base/order' );
+var argsort = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof argsort, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a first argument which is not an ndarray', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			argsort( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an ndarray having an unsupported data type', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		empty( [ 2, 2 ], {
+			'dtype': 'complex128'
+		}),
+		empty( [ 2, 2 ], {
+			'dtype': 'complex64'
+		}),
+		empty( [ 2, 2 ], {
+			'dtype': 'bool'
+		})
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + getDType( values[ i ] ) );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			argsort( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			argsort( x, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a `dim` option which is not an integer', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		-3.14,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			argsort( x, {
+				'dim': value
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a `dim` option which is out-of-bounds', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		-4,
+		-3,
+		2,
+		3,
+		4
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			argsort( x, {
+				'dim': value
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a zero-dimensional ndarray', function test( t ) {
+	var x = empty( [] );
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		argsort( x );
+	}
+});
+
+tape( 'the function throws an error if provided a `sortOrder` option which is not a supported sort order', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		'asc',
+		'DESCENDING',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			argsort( x, {
+				'sortOrder': value
+			});
+		};
+	}
+});
+
+tape( 'the function returns a new ndarray containing the indices which sort an input ndarray along a specified dimension (ndims=1)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( [ 4.0, -1.0, 3.0, 0.0, 6.0, 2.0 ] );
+
+	actual = argsort( x );
+	expected = [ 1, 3, 5, 2, 0, 4 ];
+
+	t.strictEqual( isndarrayLike( actual ), true, 'returns expected value' );
+	t.deepEqual( getShape( actual ), [ 6 ], 'returns expected value' );
+	t.strictEqual( String( getDType( actual ) ), 'int32', 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = argsort( x, {
+		'sortOrder': 'descending'
+	});
+	expected = [ 4, 0, 2, 5, 3, 1 ];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a new ndarray containing the indices which sort an input ndarray along a specified dimension (ndims=2)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( [ [ 3.0, 1.0, 2.0 ], [ 4.0, 6.0, 5.0 ] ] );
+
+	actual = argsort( x );
+	expected = [ [ 1, 2, 0 ], [ 0, 2, 1 ] ];
+	t.deepEqual( getShape( actual ), [ 2, 3 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = argsort( x, {
+		'dim': 0,
+		'sortOrder': 'descending'
+	});
+	expected = [ [ 1, 1, 1 ], [ 0, 0, 0 ] ];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a new ndarray containing the indices which sort an input ndarray along a specified dimension (ndims=3, column-major)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( new Float64Array( [ 5.0, 2.0, 7.0, 0.0, 1.0, 3.0, 8.0, 4.0, 9.0, 6.0, 11.0, 10.0 ] ), {
+		'shape': [ 2, 3, 2 ],
+		'order': 'column-major'
+	});
+
+	actual = argsort( x, {
+		'dim': 1
+	});
+	expected = [
+		[ [ 2, 0 ], [ 0, 1 ], [ 1, 2 ] ],
+		[ [ 1, 0 ], [ 0, 1 ], [ 2, 2 ] ]
+	];
+	t.strictEqual( getOrder( actual ), 'column-major', 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function performs a stable sort', function test( t ) {
+	var actual;
+	var x;
+
+	x = array( [ 2.0, 1.0, 2.0, NaN, 1.0, 2.0, NaN ] );
+
+	actual = argsort( x );
+	t.deepEqual( ndarray2array( actual ), [ 1, 4, 0, 2, 5, 3, 6 ], 'returns expected value' );
+
+	actual = argsort( x, {
+		'sortOrder': 'descending'
+	});
+	t.deepEqual( ndarray2array( actual ), [ 3, 6, 0, 2, 5, 1, 4 ], 'returns expected value' );
+
+	x = array( [ 2.0, 1.0, 2.0, NaN, 1.0, 2.0, NaN ], {
+		'dtype': 'generic'
+	});
+
+	actual = argsort( x );
+	t.deepEqual( ndarray2array( actual ), [ 1, 4, 0, 2, 5, 3, 6 ], 'returns expected value' );
+
+	actual = argsort( x, {
+		'sortOrder': 'descending'
+	});
+	t.deepEqual( ndarray2array( actual ), [ 3, 6, 0, 2, 5, 1, 4 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns indices which sort large lanes', function test( t ) {
+	var actual;
+	var data;
+	var bool;
+	var N;
+	var i;
+
+	N = 1000;
+	data = new Float64Array( N );
+	for ( i = 0; i < N; i++ ) {
+		data[ i ] = ( ( i*7919 ) % 211 ) - 105.5;
+	}
+	actual = ndarray2array( argsort( array( data ) ) );
+
+	bool = true;
+	for ( i = 1; i < N; i++ ) {
+		if ( data[ actual[ i-1 ] ] > data[ actual[ i ] ] || ( data[ actual[ i-1 ] ] === data[ actual[ i ] ] && actual[ i-1 ] > actual[ i ] ) ) {
+			bool = false;
+			break;
+		}
+	}
+	t.strictEqual( bool, true, 'returns expected value' );
+
+	actual = ndarray2array( argsort( array( data ), {
+		'sortOrder': 'descending'
+	}));
+
+	bool = true;
+	for ( i = 1; i < N; i++ ) {
+		if ( data[ actual[ i-1 ] ] < data[ actual[ i ] ] || ( data[ actual[ i-1 ] ] === data[ actual[ i ] ] && actual[ i-1 ] > actual[ i ] ) ) {
+			bool = false;
+			break;
+		}
+	}
+	t.strictEqual( bool, true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports integer data types', function test( t ) {
+	var actual;
+	var x;
+
+	x = array( new Int8Array( [ 3, -1, 2, 6, -5, 4 ] ), {
+		'shape': [ 2, 3 ]
+	});
+
+	actual = argsort( x );
+	t.deepEqual( ndarray2array( actual ), [ [ 1, 2, 0 ], [ 1, 2, 0 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports empty ndarrays', function test( t ) {
+	var actual;
+	var x;
+
+	x = empty( [ 2, 0 ] );
+
+	actual = argsort( x );
+	t.deepEqual( getShape( actual ), [ 2, 0 ], 'returns expected value' );
+	t.strictEqual( String( getDType( actual ) ), 'int32', 'returns expected value' );
+
+	t.end();
+});
@@ -0,0 +1,150 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var discreteUniform = require( '@stdlib/random/base/discrete-uniform' ).factory;
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var floor = require( '@stdlib/math/base/special/floor' );
+var sqrt = require( '@stdlib/math/base/special/sqrt' );
+var filledarray = require( '@stdlib/array/filled' );
+var filledarrayBy = require( '@stdlib/array/filled-by' );
+var shape2strides = require( './../../../base/shape2strides' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var assign = require( './../lib/2d_transpose.js' );
+
+
+// VARIABLES //
+
+var types = [ 'float64' ];
+var xorder = 'row-major';
+var yorder = 'column-major';
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {PositiveInteger} len - ndarray length
+* @param {NonNegativeIntegerArray} shape - ndarray shape
+* @param {string} xtype - input ndarray data type
+* @param {string} ytype - output ndarray data type
+* @returns {Function} benchmark function
+*/
+function createBenchmark( len, shape, xtype, ytype ) {
+	var x;
+	var y;
+
+	x = filledarrayBy( len, xtype, discreteUniform( -100, 100 ) );
+	y = filledarray( 0.0, len, ytype );
+	x = {
+		'dtype': xtype,
+		'data': x,
+		'shape': shape,
+		'strides': shape2strides( shape, xorder ),
+		'offset': 0,
+		'order': xorder
+	};
+	y = {
+		'dtype': ytype,
+		'data': y,
+		'shape': shape,
+		'strides': shape2strides( shape, yorder ),
+		'offset': 0,
+		'order': yorder
+	};
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			assign( x, y );
+			if ( isnan( y.data[ i%len ] ) ) {
+				b.fail( 'should not return NaN' );
+			}
+		}
+		b.toc();
+		if ( isnan( y.data[ i%len ] ) ) {
+			b.fail( 'should not return NaN' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var sh;
+	var t1;
+	var t2;
+	var f;
+	var i;
+	var j;
+
+	min = 1; // 10^min
+	max = 6; // 10^max
+
+	for ( j = 0; j < types.length; j++ ) {
+		t1 = types[ j ];
+		t2 = types[ j ];
+		for ( i = min; i <= max; i++ ) {
+			len = pow( 10, i );
+
+			sh = [ len/2, 2 ];
+			f = createBenchmark( len, sh, t1, t2 );
+			bench( format( '%s::transpose:ndims=%d,len=%d,shape=[%s],xorder=%s,yorder=%s,xtype=%s,ytype=%s', pkg, sh.length, len, sh.join( ',' ), xorder, yorder, t1, t2 ), f );
+
+			sh = [ 2, len/2 ];
+			f = createBenchmark( len, sh, t1, t2 );
+			bench( format( '%s::transpose:ndims=%d,len=%d,shape=[%s],xorder=%s,yorder=%s,xtype=%s,ytype=%s', pkg, sh.length, len, sh.join( ',' ), xorder, yorder, t1, t2 ), f );
+
+			len = floor( sqrt( len ) );
+			sh = [ len, len ];
+			len *= len;
+			f = createBenchmark( len, sh, t1, t2 );
+			bench( format( '%s::transpose:ndims=%d,len=%d,shape=[%s],xorder=%s,yorder=%s,xtype=%s,ytype=%s', pkg, sh.length, len, sh.join( ',' ), xorder, yorder, t1, t2 ), f );
+		}
+	}
+}
+
+main();
@@ -36,10 +36,13 @@
 #include "assign/b_c.h"
 #include "assign/b_d.h"
 #include "assign/b_f.h"
+#include "assign/b_h.h"
 #include "assign/b_i.h"
 #include "assign/b_k.h"
+#include "assign/b_l.h"
 #include "assign/b_t.h"
 #include "assign/b_u.h"
+#include "assign/b_v.h"
 #include "assign/b_z.h"
 
 #include "assign/c_c.h"
@@ -48,16 +51,24 @@
 #include "assign/d_c.h"
 #include "assign/d_d.h"
 #include "assign/d_f.h"
+#include "assign/d_h.h"
 #include "assign/d_z.h"
 
 #include "assign/f_c.h"
 #include "assign/f_d.h"
 #include "assign/f_f.h"
+#include "assign/f_h.h"
 #include "assign/f_z.h"
 
+#include "assign/h_d.h"
+#include "assign/h_f.h"
+#include "assign/h_h.h"
+
 #include "assign/i_d.h"
 #include "assign/i_i.h"
+#include "assign/i_l.h"
 #include "assign/i_u.h"
+#include "assign/i_v.h"
 #include "assign/i_z.h"
 
 #include "assign/k_c.h"
@@ -65,33 +76,48 @@
 #include "assign/k_f.h"
 #include "assign/k_i.h"
 #include "assign/k_k.h"
+#include "assign/k_l.h"
 #include "assign/k_t.h"
 #include "assign/k_u.h"
+#include "assign/k_v.h"
 #include "assign/k_z.h"
 
+#include "assign/l_d.h"
+#include "assign/l_l.h"
+
 #include "assign/s_b.h"
 #include "assign/s_c.h"
 #include "assign/s_d.h"
 #include "assign/s_f.h"
+#include "assign/s_h.h"
 #include "assign/s_i.h"
 #include "assign/s_k.h"
+#include "assign/s_l.h"
 #include "assign/s_s.h"
 #include "assign/s_t.h"
 #include "assign/s_u.h"
+#include "assign/s_v.h"
 #include "assign/s_z.h"
 
 #include "assign/t_c.h"
 #include "assign/t_d.h"
 #include "assign/t_f.h"
 #include "assign/t_i.h"
+#include "assign/t_l.h"
 #include "assign/t_t.h"
 #include "assign/t_u.h"
+#include "assign/t_v.h"
 #include "assign/t_z.h"
 
 #include "assign/u_d.h"
+#include "assign/u_l.h"
 #include "assign/u_u.h"
+#include "assign/u_v.h"
 #include "assign/u_z.h"
 
+#include "assign/v_d.h"
+#include "assign/v_v.h"
+
 #include "assign/x_x.h"
 
 #include "assign/z_c.h"
@@ -21,9 +21,7 @@
 
 #include "stdlib/ndarray/ctor.h"
 #include "stdlib/ndarray/orders.h"
-#include "stdlib/ndarray/index_modes.h"
-#include "stdlib/ndarray/orders.h"
-#include "stdlib/ndarray/base/vind2bind.h"
+#include "stdlib/ndarray/base/vind_increment.h"
 #include <stdint.h>
 
 /**
@@ -33,7 +31,7 @@
 *
 * -   Variable naming conventions:
 *
-*     -   `sx#`, `px#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
+*     -   `sx#`, `px#`, `nx#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
 *     -   `S@`, `i@`, and `d@x#` where `@` corresponds to the loop number, with `0` being the innermost loop.
 *
 * @example
@@ -45,8 +43,6 @@
 #define STDLIB_NDARRAY_ASSIGN_ND_LOOP_PREAMBLE                                 \
 	const struct ndarray *x1 = arrays[ 0 ];                                    \
 	const struct ndarray *x2 = arrays[ 1 ];                                    \
-	enum STDLIB_NDARRAY_INDEX_MODE mx1 = stdlib_ndarray_index_mode( x1 );      \
-	enum STDLIB_NDARRAY_INDEX_MODE mx2 = stdlib_ndarray_index_mode( x2 );      \
 	enum STDLIB_NDARRAY_ORDER ordx1 = stdlib_ndarray_order( x1 );              \
 	enum STDLIB_NDARRAY_ORDER ordx2 = stdlib_ndarray_order( x2 );              \
 	const int64_t *shape = stdlib_ndarray_shape( x1 );                         \
@@ -60,12 +56,43 @@
 	int64_t len = stdlib_ndarray_length( x1 );                                 \
 	uint8_t *px1;                                                              \
 	uint8_t *px2;                                                              \
+	int64_t d0x1;                                                              \
+	int64_t d0x2;                                                              \
+	int64_t nx1;                                                               \
+	int64_t nx2;                                                               \
+	int64_t n0r;                                                               \
+	int64_t n0c;                                                               \
+	int64_t S0;                                                                \
+	int64_t i0;                                                                \
 	int64_t i;                                                                 \
-	/* Iterate over each ndarray element based on the linear **view** index, regardless as to how the data is stored in memory... */ \
-	for ( i = 0; i < len; i++ ) {                                              \
-		px1 = pbx1 + stdlib_ndarray_vind2bind( ndims, shape, sx1, ox1, ordx1, i, mx1 ); \
-		px2 = pbx2 + stdlib_ndarray_vind2bind( ndims, shape, sx2, ox2, ordx2, i, mx2 ); \
-		do
+	/* Resolve the number of elements along the innermost non-singleton dimension for both row-major and column-major iteration orders... */ \
+	n0r = 1;                                                                   \
+	for ( i = ndims-1; i >= 0 && n0r == 1; i-- ) {                             \
+		n0r = shape[ i ];                                                      \
+	}                                                                          \
+	n0c = 1;                                                                   \
+	for ( i = 0; i < ndims && n0c == 1; i++ ) {                                \
+		n0c = shape[ i ];                                                      \
+	}                                                                          \
+	/* For each ndarray, resolve a pointer to the first indexed element, the number of consecutive view elements along the innermost non-singleton dimension, and the pointer increment along that dimension... */ \
+	px1 = pbx1 + ox1;                                                          \
+	nx1 = ( ordx1 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x1 = stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, 1 );       \
+	px2 = pbx2 + ox2;                                                          \
+	nx2 = ( ordx2 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x2 = stdlib_ndarray_vind_increment( ndims, shape, sx2, ordx2, 1 );       \
+	/* Iterate over each ndarray element based on the linear **view** index, incrementally updating element pointers rather than resolving each view index to a data buffer index... */ \
+	for ( i = 0; i < len; i += S0 ) {                                          \
+		if ( i > 0 ) {                                                         \
+			px1 += stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, i ) - d0x1; \
+			px2 += stdlib_ndarray_vind_increment( ndims, shape, sx2, ordx2, i ) - d0x2; \
+		}                                                                      \
+		/* Resolve the number of consecutive view elements which can be visited using constant pointer increments... */ \
+		S0 = nx1 - ( i % nx1 );                                                \
+		if ( nx2 - ( i % nx2 ) < S0 ) {                                        \
+			S0 = nx2 - ( i % nx2 );                                            \
+		}                                                                      \
+		for ( i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2 ) do
 
 /**
 * Macro containing the preamble for nested loops which operate on elements of an n-dimensional input ndarray and updates two output ndarrays.
@@ -74,7 +101,7 @@
 *
 * -   Variable naming conventions:
 *
-*     -   `sx#`, `px#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
+*     -   `sx#`, `px#`, `nx#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
 *     -   `S@`, `i@`, and `d@x#` where `@` corresponds to the loop number, with `0` being the innermost loop.
 *
 * @example
@@ -87,9 +114,6 @@
 	const struct ndarray *x1 = arrays[ 0 ];                                    \
 	const struct ndarray *x2 = arrays[ 1 ];                                    \
 	const struct ndarray *x3 = arrays[ 2 ];                                    \
-	enum STDLIB_NDARRAY_INDEX_MODE mx1 = stdlib_ndarray_index_mode( x1 );      \
-	enum STDLIB_NDARRAY_INDEX_MODE mx2 = stdlib_ndarray_index_mode( x2 );      \
-	enum STDLIB_NDARRAY_INDEX_MODE mx3 = stdlib_ndarray_index_mode( x3 );      \
 	enum STDLIB_NDARRAY_ORDER ordx1 = stdlib_ndarray_order( x1 );              \
 	enum STDLIB_NDARRAY_ORDER ordx2 = stdlib_ndarray_order( x2 );              \
 	enum STDLIB_NDARRAY_ORDER ordx3 = stdlib_ndarray_order( x3 );              \
@@ -108,13 +132,52 @@
 	uint8_t *px1;                                                              \
 	uint8_t *px2;                                                              \
 	uint8_t *px3;                                                              \
+	int64_t d0x1;                                                              \
+	int64_t d0x2;                                                              \
+	int64_t d0x3;                                                              \
+	int64_t nx1;                                                               \
+	int64_t nx2;                                                               \
+	int64_t nx3;                                                               \
+	int64_t n0r;                                                               \
+	int64_t n0c;                                                               \
+	int64_t S0;                                                                \
+	int64_t i0;                                                                \
 	int64_t i;                                                                 \
-	/* Iterate over each ndarray element based on the linear **view** index, regardless as to how the data is stored in memory... */ \
-	for ( i = 0; i < len; i++ ) {                                              \
-		px1 = pbx1 + stdlib_ndarray_vind2bind( ndims, shape, sx1, ox1, ordx1, i, mx1 ); \
-		px2 = pbx2 + stdlib_ndarray_vind2bind( ndims, shape, sx2, ox2, ordx2, i, mx2 ); \
-		px3 = pbx3 + stdlib_ndarray_vind2bind( ndims, shape, sx3, ox3, ordx3, i, mx3 ); \
-		do
+	/* Resolve the number of elements along the innermost non-singleton dimension for both row-major and column-major iteration orders... */ \
+	n0r = 1;                                                                   \
+	for ( i = ndims-1; i >= 0 && n0r == 1; i-- ) {                             \
+		n0r = shape[ i ];                                                      \
+	}                                                                          \
+	n0c = 1;                                                                   \
+	for ( i = 0; i < ndims && n0c == 1; i++ ) {                                \
+		n0c = shape[ i ];                                                      \
+	}                                                                          \
+	/* For each ndarray, resolve a pointer to the first indexed element, the number of consecutive view elements along the innermost non-singleton dimension, and the pointer increment along that dimension... */ \
+	px1 = pbx1 + ox1;                                                          \
+	nx1 = ( ordx1 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x1 = stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, 1 );       \
+	px2 = pbx2 + ox2;                                                          \
+	nx2 = ( ordx2 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x2 = stdlib_ndarray_vind_increment( ndims, shape, sx2, ordx2, 1 );       \
+	px3 = pbx3 + ox3;                                                          \
+	nx3 = ( ordx3 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x3 = stdlib_ndarray_vind_increment( ndims, shape, sx3, ordx3, 1 );       \
+	/* Iterate over each ndarray element based on the linear **view** index, incrementally updating element pointers rather than resolving each view index to a data buffer index... */ \
+	for ( i = 0; i < len; i += S0 ) {                                          \
+		if ( i > 0 ) {                                                         \
+			px1 += stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, i ) - d0x1; \
+			px2 += stdlib_ndarray_vind_increment( ndims, shape, sx2, ordx2, i ) - d0x2; \
+			px3 += stdlib_ndarray_vind_increment( ndims, shape, sx3, ordx3, i ) - d0x3; \
+		}                                                                      \
+		/* Resolve the number of consecutive view elements which can be visited using constant pointer increments... */ \
+		S0 = nx1 - ( i % nx1 );                                                \
+		if ( nx2 - ( i % nx2 ) < S0 ) {                                        \
+			S0 = nx2 - ( i % nx2 );                                            \
+		}                                                                      \
+		if ( nx3 - ( i % nx3 ) < S0 ) {                                        \
+			S0 = nx3 - ( i % nx3 );                                            \
+		}                                                                      \
+		for ( i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2, px3 += d0x3 ) do
 
 /**
 * Macro containing the epilogue for nested loops which operate on elements of an n-dimensional ndarray.
@@ -0,0 +1,268 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var abs = require( '@stdlib/math/base/special/abs' );
+
+
+// VARIABLES //
+
+// Tile size (in elements) along each dimension (note: for double-precision floating-point numbers, a 64x64 tile spans 32kB per array, such that the tiles of both arrays fit within L2 cache):
+var TILE_SIZE = 64|0; // asm type annotation
+
+// Micro-tile size (in elements) along each dimension (note: elements within a micro-tile are loaded into local variables before being stored, thus transposing within registers):
+var MICRO_SIZE = 4|0; // asm type annotation
+
+
+// FUNCTIONS //
+
+/**
+* Copies a micro-tile (or a partial micro-tile along the edges of a tile) element-by-element.
+*
+* @private
+* @param {Collection} xbuf - input ndarray data buffer
+* @param {Collection} ybuf - output ndarray data buffer
+* @param {NonNegativeInteger} m - number of elements along the dimension which is contiguous in the input ndarray
+* @param {NonNegativeInteger} n - number of elements along the dimension which is contiguous in the output ndarray
+* @param {NonNegativeInteger} ix - index of the first indexed element in the input ndarray
+* @param {integer} sxa - input ndarray stride along the dimension which is contiguous in the input ndarray
+* @param {integer} sxb - input ndarray stride along the dimension which is contiguous in the output ndarray
+* @param {NonNegativeInteger} iy - index of the first indexed element in the output ndarray
+* @param {integer} sya - output ndarray stride along the dimension which is contiguous in the input ndarray
+* @param {integer} syb - output ndarray stride along the dimension which is contiguous in the output ndarray
+* @returns {void}
+*/
+function copyEdge( xbuf, ybuf, m, n, ix, sxa, sxb, iy, sya, syb ) {
+	var jx;
+	var jy;
+	var p;
+	var q;
+	for ( q = 0; q < n; q++ ) {
+		jx = ix + ( q*sxb );
+		jy = iy + ( q*syb );
+		for ( p = 0; p < m; p++ ) {
+			ybuf[ jy ] = xbuf[ jx ];
+			jx += sxa;
+			jy += sya;
+		}
+	}
+}
+
+
+// MAIN //
+
+/**
+* Assigns elements in a two-dimensional input ndarray to elements in an equivalently shaped output ndarray having the opposite memory layout (i.e., performs a transpose-copy).
+*
+* ## Notes
+*
+* -   The function assumes that the innermost (i.e., fastest varying) dimension of the input ndarray is the outermost dimension of the output ndarray, and vice versa (e.g., when copying a row-major ndarray to a column-major ndarray or when materializing a transposed view).
+*
+* -   The function uses two-level tiling. The ndarrays are partitioned into tiles which fit within L1 cache, and each tile is partitioned into 4x4 micro-tiles. For each micro-tile, the function loads elements along the contiguous dimension of the input ndarray and stores elements along the contiguous dimension of the output ndarray, such that both buffers are accessed in runs of consecutive elements.
+*
+* @private
+* @param {Object} x - object containing input ndarray meta data
+* @param {*} x.dtype - data type
+* @param {Collection} x.data - data buffer
+* @param {NonNegativeIntegerArray} x.shape - dimensions
+* @param {IntegerArray} x.strides - stride lengths
+* @param {NonNegativeInteger} x.offset - index offset
+* @param {string} x.order - specifies whether `x` is row-major (C-style) or column-major (Fortran-style)
+* @param {Object} y - object containing output ndarray meta data
+* @param {*} y.dtype - data type
+* @param {Collection} y.data - data buffer
+* @param {NonNegativeIntegerArray} y.shape - dimensions
+* @param {IntegerArray} y.strides - stride lengths
+* @param {NonNegativeInteger} y.offset - index offset
+* @param {string} y.order - specifies whether `y` is row-major (C-style) or column-major (Fortran-style)
+* @returns {void}
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+*
+* // Create data buffers:
+* var xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+* var ybuf = new Float64Array( 6 );
+*
+* // Define the shape of the input and output arrays:
+* var shape = [ 2, 3 ];
+*
+* // Define the array strides:
+* var sx = [ 3, 1 ];
+* var sy = [ 1, 2 ];
+*
+* // Define the index offsets:
+* var ox = 0;
+* var oy = 0;
+*
+* // Create the input and output ndarray-like objects:
+* var x = {
+*     'dtype': 'float64',
+*     'data': xbuf,
+*     'shape': shape,
+*     'strides': sx,
+*     'offset': ox,
+*     'order': 'row-major'
+* };
+* var y = {
+*     'dtype': 'float64',
+*     'data': ybuf,
+*     'shape': shape,
+*     'strides': sy,
+*     'offset': oy,
+*     'order': 'column-major'
+* };
+*
+* // Copy elements:
+* transposeassign2d( x, y );
+*
+* console.log( y.data );
+* // => <Float64Array>[ 1.0, 4.0, 2.0, 5.0, 3.0, 6.0 ]
+*/
+function transposeassign2d( x, y ) {
+	var xbuf;
+	var ybuf;
+	var sxa;
+	var sxb;
+	var sya;
+	var syb;
+	var x00;
+	var x01;
+	var x02;
+	var x03;
+	var x10;
+	var x11;
+	var x12;
+	var x13;
+	var x20;
+	var x21;
+	var x22;
+	var x23;
+	var x30;
+	var x31;
+	var x32;
+	var x33;
+	var ma;
+	var nb;
+	var ta;
+	var tb;
+	var ea;
+	var eb;
+	var ix;
+	var iy;
+	var jx;
+	var jy;
+	var a;
+	var b;
+	var p;
+	var q;
+	var i;
+
+	// Note on variable naming convention: `a` denotes the dimension which is contiguous (i.e., has the smallest stride) in the input ndarray and `b` denotes the dimension which is contiguous in the output ndarray...
+	i = ( abs( x.strides[ 0 ] ) <= abs( x.strides[ 1 ] ) ) ? 0 : 1;
+	ma = x.shape[ i ];
+	nb = x.shape[ 1-i ];
+	sxa = x.strides[ i ];
+	sxb = x.strides[ 1-i ];
+	sya = y.strides[ i ];
+	syb = y.strides[ 1-i ];
+
+	// Cache references to the input and output ndarray buffers...
+	xbuf = x.data;
+	ybuf = y.data;
+
+	// Iterate over tiles...
+	for ( b = 0; b < nb; b += TILE_SIZE ) {
+		tb = ( nb-b < TILE_SIZE ) ? nb-b : TILE_SIZE;
+		for ( a = 0; a < ma; a += TILE_SIZE ) {
+			ta = ( ma-a < TILE_SIZE ) ? ma-a : TILE_SIZE;
+
+			// Compute the extents of the tile which can be covered by full micro-tiles:
+			ea = ta - ( ta%MICRO_SIZE );
+			eb = tb - ( tb%MICRO_SIZE );
+
+			// Iterate over micro-tiles...
+			for ( q = 0; q < eb; q += MICRO_SIZE ) {
+				ix = x.offset + ( a*sxa ) + ( (b+q)*sxb );
+				iy = y.offset + ( a*sya ) + ( (b+q)*syb );
+				for ( p = 0; p < ea; p += MICRO_SIZE ) {
+					// Load a 4x4 micro-tile, reading consecutive elements along the contiguous dimension of the input ndarray...
+					jx = ix;
+					x00 = xbuf[ jx ];
+					x10 = xbuf[ jx+sxa ];
+					x20 = xbuf[ jx+(2*sxa) ];
+					x30 = xbuf[ jx+(3*sxa) ];
+					jx += sxb;
+					x01 = xbuf[ jx ];
+					x11 = xbuf[ jx+sxa ];
+					x21 = xbuf[ jx+(2*sxa) ];
+					x31 = xbuf[ jx+(3*sxa) ];
+					jx += sxb;
+					x02 = xbuf[ jx ];
+					x12 = xbuf[ jx+sxa ];
+					x22 = xbuf[ jx+(2*sxa) ];
+					x32 = xbuf[ jx+(3*sxa) ];
+					jx += sxb;
+					x03 = xbuf[ jx ];
+					x13 = xbuf[ jx+sxa ];
+					x23 = xbuf[ jx+(2*sxa) ];
+					x33 = xbuf[ jx+(3*sxa) ];
+
+					// Store the micro-tile, writing consecutive elements along the contiguous dimension of the output ndarray...
+					jy = iy;
+					ybuf[ jy ] = x00;
+					ybuf[ jy+syb ] = x01;
+					ybuf[ jy+(2*syb) ] = x02;
+					ybuf[ jy+(3*syb) ] = x03;
+					jy += sya;
+					ybuf[ jy ] = x10;
+					ybuf[ jy+syb ] = x11;
+					ybuf[ jy+(2*syb) ] = x12;
+					ybuf[ jy+(3*syb) ] = x13;
+					jy += sya;
+					ybuf[ jy ] = x20;
+					ybuf[ jy+syb ] = x21;
+					ybuf[ jy+(2*syb) ] = x22;
+					ybuf[ jy+(3*syb) ] = x23;
+					jy += sya;
+					ybuf[ jy ] = x30;
+					ybuf[ jy+syb ] = x31;
+					ybuf[ jy+(2*syb) ] = x32;
+					ybuf[ jy+(3*syb) ] = x33;
+
+					ix += MICRO_SIZE * sxa;
+					iy += MICRO_SIZE * sya;
+				}
+				// Copy any remaining elements along the contiguous dimension of the input ndarray:
+				copyEdge( xbuf, ybuf, ta-ea, MICRO_SIZE, ix, sxa, sxb, iy, sya, syb ); // eslint-disable-line max-len
+			}
+			// Copy any remaining elements along the contiguous dimension of the output ndarray:
+			ix = x.offset + ( a*sxa ) + ( (b+eb)*sxb );
+			iy = y.offset + ( a*sya ) + ( (b+eb)*syb );
+			copyEdge( xbuf, ybuf, ta, tb-eb, ix, sxa, sxb, iy, sya, syb );
+		}
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = transposeassign2d;
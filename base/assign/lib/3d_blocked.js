@@ -24,6 +24,7 @@
 
 var loopOrder = require( './../../../base/unary-loop-interchange-order' );
 var blockSize = require( './../../../base/unary-tiling-block-size' );
+var bytesPerElement = require( './../../../base/bytes-per-element' );
 
 
 // MAIN //
@@ -125,7 +126,7 @@ function blockedassign3d( x, y ) {
 	// Note on variable naming convention: s#, dx#, dy#, i#, j# where # corresponds to the loop number, with `0` being the innermost loop...
 
 	// Resolve the loop interchange order:
-	o = loopOrder( x.shape, x.strides, y.strides );
+	o = loopOrder( x.shape, x.strides, y.strides, [ bytesPerElement( x.dtype ), bytesPerElement( y.dtype ) ] );
 	sh = o.sh;
 	sx = o.sx;
 	sy = o.sy;
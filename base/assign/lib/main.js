@@ -25,6 +25,7 @@ var isRealDataType = require( './../../../base/assert/is-real-data-type' );
 var isComplexArray = require( '@stdlib/array/base/assert/is-complex-typed-array' );
 var isBooleanArray = require( '@stdlib/array/base/assert/is-booleanarray' );
 var iterationOrder = require( './../../../base/iteration-order' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
 var strides2order = require( './../../../base/strides2order' );
 var castReturn = require( '@stdlib/complex/base/cast-return' );
 var complexCtors = require( '@stdlib/complex/ctors' );
@@ -44,6 +45,7 @@ var blockedaccessorassign8d = require( './8d_blocked_accessors.js' );
 var blockedaccessorassign9d = require( './9d_blocked_accessors.js' );
 var blockedaccessorassign10d = require( './10d_blocked_accessors.js' );
 var blockedassign2d = require( './2d_blocked.js' );
+var transposeassign2d = require( './2d_transpose.js' );
 var blockedassign3d = require( './3d_blocked.js' );
 var blockedassign4d = require( './4d_blocked.js' );
 var blockedassign5d = require( './5d_blocked.js' );
@@ -257,6 +259,7 @@ function assign( arrays ) {
 	var ndims;
 	var xmmv;
 	var ymmv;
+	var ordy;
 	var shx;
 	var shy;
 	var iox;
@@ -267,7 +270,7 @@ function assign( arrays ) {
 	var sy;
 	var ox;
 	var oy;
-	var ns;
+	var o;
 	var x;
 	var y;
 	var d;
@@ -306,7 +309,6 @@ function assign( arrays ) {
 	}
 	// Verify that the input and output arrays have the same dimensions...
 	len = 1; // number of elements
-	ns = 0;  // number of singleton dimensions
 	for ( i = 0; i < ndims; i++ ) {
 		d = shx[ i ];
 		if ( d !== shy[ i ] ) {
@@ -314,16 +316,22 @@ function assign( arrays ) {
 		}
 		// Note that, if one of the dimensions is `0`, the length will be `0`...
 		len *= d;
-
-		// Check whether the current dimension is a singleton dimension...
-		if ( d === 1 ) {
-			ns += 1;
-		}
 	}
 	// Check whether we were provided empty ndarrays...
 	if ( len === 0 ) {
 		return;
 	}
+	// Merge adjacent dimensions which are jointly contiguous and remove singleton dimensions (e.g., ndims=3, shape=[100,3,1000], where only the last two dimensions are contiguous, becomes ndims=2, shape=[100,3000]) so that we can use lower-dimensional kernels...
+	if ( ndims > 1 ) {
+		o = coalesce( shx, [ x.strides, y.strides ] );
+		shx = o[ 0 ];
+		shy = shx;
+		ndims = shx.length;
+		x.shape = shx;
+		y.shape = shy;
+		x.strides = o[ 1 ];
+		y.strides = o[ 2 ];
+	}
 	// Determine whether the ndarrays are one-dimensional and thus readily translate to one-dimensional strided arrays...
 	if ( ndims === 1 ) {
 		if ( x.accessorProtocol || y.accessorProtocol ) {
@@ -334,23 +342,6 @@ function assign( arrays ) {
 	sx = x.strides;
 	sy = y.strides;
 
-	// Determine whether the ndarray has only **one** non-singleton dimension (e.g., ndims=4, shape=[10,1,1,1]) so that we can treat the ndarrays as being equivalent to one-dimensional strided arrays...
-	if ( ns === ndims-1 ) {
-		// Get the index of the non-singleton dimension...
-		for ( i = 0; i < ndims; i++ ) {
-			if ( shx[ i ] !== 1 ) {
-				break;
-			}
-		}
-		x.shape = [ shx[i] ];
-		y.shape = x.shape;
-		x.strides = [ sx[i] ];
-		y.strides = [ sy[i] ];
-		if ( x.accessorProtocol || y.accessorProtocol ) {
-			return ACCESSOR_ASSIGN[ 1 ]( x, y );
-		}
-		return ASSIGN[ 1 ]( x, y );
-	}
 	iox = iterationOrder( sx ); // +/-1
 	ioy = iterationOrder( sy ); // +/-1
 
@@ -397,6 +388,13 @@ function assign( arrays ) {
 		}
 		// Fall-through to blocked iteration...
 	}
+	// Determine whether we are copying between two-dimensional ndarrays having opposite memory layouts (e.g., when materializing a transposed view), in which case we can use a specialized transpose kernel...
+	if ( ndims === 2 && !x.accessorProtocol && !y.accessorProtocol ) {
+		ordy = strides2order( sy );
+		if ( ( ord === 1 && ordy === 2 ) || ( ord === 2 && ordy === 1 ) ) {
+			return transposeassign2d( x, y );
+		}
+	}
 	// At this point, we're either dealing with non-contiguous n-dimensional arrays, high dimensional n-dimensional arrays, and/or arrays having differing memory layouts, so our only hope is that we can still perform blocked iteration...
 
 	// Determine whether we can perform blocked iteration...
@@ -82,20 +82,30 @@ var MANIFEST = path.resolve( __dirname, '..', 'manifest.json' );
 var README = path.resolve( __dirname, '..', 'README.md' );
 
 // Data types to exclude when generating loops:
-var EXCLUDE_DTYPES = [ 'binary', 'generic', 'uint8c' ];
+var EXCLUDE_DTYPES = [ 'binary', 'generic', 'uint8c', 'complex32' ];
 
 // Resolve a list of dtypes for which we want to create loops:
 var DTYPES = filter( dtypes(), EXCLUDE_DTYPES );
 
+// Add 64-bit integer dtypes, which are only supported in C and are not included in the list of JavaScript dtypes:
+DTYPES.push( 'int64', 'uint64' );
+
 // Define "special" loops, which cannot be readily generated according to standardized rules:
 var SPECIAL_LOOPS = [
 	// Support callbacks which operate on signed integers, but whose return values are always positive and can be cast to unsigned integers of the same or greater bit width:
 	'i_u',
+	'i_v',
 	'k_t',
 	'k_u',
+	'k_v',
 	's_b',
 	's_t',
-	's_u'
+	's_u',
+	's_v',
+
+	// Support converting 64-bit integers to double-precision floating-point numbers:
+	'l_d',
+	'v_d'
 ];
 
 // Hash containing C macro names:
@@ -252,6 +262,33 @@ function signatures( dtypes ) {
 	return out.sort();
 }
 
+/**
+* Returns the name of the function for converting between a half-precision floating-point data type and a real-valued data type.
+*
+* ## Notes
+*
+* -   Integer input values are implicitly converted to single-precision floating-point numbers, which is exact for the integer data types which can be safely cast to a half-precision floating-point number.
+*
+* @private
+* @param {string} ch1 - one-letter character abbreviation for the input array data type
+* @param {string} ch2 - one-letter character abbreviation for the output array data type
+* @returns {string} function name
+*
+* @example
+* var out = halfCastFcn( 'h', 'd' );
+* // returns 'stdlib_float16_to_float64'
+*
+* @example
+* var out = halfCastFcn( 'b', 'h' );
+* // returns 'stdlib_float16_from_float32'
+*/
+function halfCastFcn( ch1, ch2 ) {
+	if ( ch1 === 'h' ) {
+		return 'stdlib_float16_to_'+( ( ch2 === 'd' ) ? 'float64' : 'float32' );
+	}
+	return 'stdlib_float16_from_'+( ( ch1 === 'd' ) ? 'float64' : 'float32' );
+}
+
 /**
 * Defines byte arrays in a provided template string.
 *
@@ -401,6 +438,9 @@ function createSourceFile( signature ) {
 
 	// Ensure the appropriate header files are included in source files:
 	inc = [];
+	if ( /h/.test( signature ) ) {
+		inc.push( '#include "stdlib/ndarray/base/half_precision.h"' );
+	}
 	if ( /c/.test( signature ) ) {
 		inc.push( '#include "stdlib/complex/float32/ctor.h"' );
 	}
@@ -472,6 +512,8 @@ function createSourceFile( signature ) {
 		}
 	} else if ( ch1 === ch2 ) { // e.g., d_d, f_f, b_b
 		tmp = 'v';
+	} else if ( /h/.test( signature ) ) { // e.g., h_d, f_h
+		tmp = format( '%s( v )', halfCastFcn( ch1, ch2 ) ); // e.g., stdlib_float16_to_float64( v )
 	} else { // e.g., b_d, f_d
 		tmp = format( '(%s)v', ct2 ); // e.g., (double)v
 	}
@@ -497,6 +539,15 @@ function createSourceFile( signature ) {
 		} else { // e.g., z_d
 			throw new Error( 'unexpected error. Should not reach this branch according to type promotion rules.' );
 		}
+	} else if ( /h/.test( signature ) ) {
+		// E.g., h_h, h_f, h_d, f_h, d_h, b_h, etc.
+		if ( ch1 === ch2 ) { // e.g., h_h
+			macro = MACROS.nocast;
+			args = [ ct1, ct2 ];
+		} else { // e.g., h_d, f_h
+			macro = MACROS.fcast;
+			args = [ ct1, ct2, halfCastFcn( ch1, ch2 ) ];
+		}
 	} else {
 		macro = MACROS.cast;
 		args = [ ct1, ct2 ];
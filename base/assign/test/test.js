@@ -21,9 +21,81 @@
 // MODULES //
 
 var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+var ndarray = require( './../../../base/ctor' );
 var assign = require( './../lib' );
 
 
+// FUNCTIONS //
+
+/**
+* Returns a data buffer containing increasing values.
+*
+* @private
+* @param {NonNegativeInteger} N - number of elements
+* @returns {Float64Array} data buffer
+*/
+function linspace( N ) {
+	var out;
+	var i;
+
+	out = new Float64Array( N );
+	for ( i = 0; i < N; i++ ) {
+		out[ i ] = i;
+	}
+	return out;
+}
+
+/**
+* Tests whether each element of the output ndarray in a list of three-dimensional ndarrays equals the result of applying a callback to the corresponding input ndarray elements.
+*
+* @private
+* @param {ArrayLikeObject<ndarray>} arrays - input ndarrays followed by an output ndarray
+* @param {Function} fcn - callback
+* @returns {boolean} boolean indicating whether the output ndarray contains the expected values
+*/
+function isExpected( arrays, fcn ) {
+	var args;
+	var out;
+	var sh;
+	var N;
+	var i;
+	var j;
+	var k;
+	var m;
+
+	N = arrays.length - 1;
+	out = arrays[ N ];
+	sh = out.shape;
+	args = [];
+	for ( i = 0; i < sh[ 0 ]; i++ ) {
+		for ( j = 0; j < sh[ 1 ]; j++ ) {
+			for ( k = 0; k < sh[ 2 ]; k++ ) {
+				for ( m = 0; m < N; m++ ) {
+					args[ m ] = arrays[ m ].get( i, j, k );
+				}
+				if ( out.get( i, j, k ) !== fcn.apply( null, args ) ) {
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/**
+* Returns a provided value.
+*
+* @private
+* @param {number} x - input value
+* @returns {number} input value
+*/
+function identity( x ) {
+	return x;
+}
+
+
 // TESTS //
 
 tape( 'main export is a function', function test( t ) {
@@ -32,4 +104,94 @@ tape( 'main export is a function', function test( t ) {
 	t.end();
 });
 
-// FIXME: add tests
+tape( 'the function assigns elements from a row-major ndarray to a column-major ndarray', function test( t ) {
+	var shapes;
+	var x;
+	var y;
+	var M;
+	var N;
+	var i;
+	var j;
+	var k;
+
+	// Include shapes which are not multiples of the tile and micro-tile sizes:
+	shapes = [ [ 1, 5 ], [ 3, 5 ], [ 4, 4 ], [ 7, 9 ], [ 65, 130 ], [ 100, 37 ] ];
+	for ( k = 0; k < shapes.length; k++ ) {
+		M = shapes[ k ][ 0 ];
+		N = shapes[ k ][ 1 ];
+		x = ndarray( 'float64', linspace( M*N ), [ M, N ], [ N, 1 ], 0, 'row-major' );
+		y = ndarray( 'float64', new Float64Array( M*N ), [ M, N ], [ 1, M ], 0, 'column-major' );
+
+		assign( [ x, y ] );
+		for ( i = 0; i < M; i++ ) {
+			for ( j = 0; j < N; j++ ) {
+				if ( y.get( i, j ) !== x.get( i, j ) ) {
+					t.fail( 'unexpected result for shape '+shapes[ k ].join( 'x' ) );
+				}
+			}
+		}
+	}
+	t.pass( 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements from a transposed and reversed view to a row-major ndarray', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	// Create a view of a 3x4 row-major ndarray which is transposed and reversed along its first dimension (i.e., a rotated view):
+	x = ndarray( 'float64', linspace( 12 ), [ 4, 3 ], [ -1, 4 ], 3, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 12 ), [ 4, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	assign( [ x, y ] );
+
+	expected = new Float64Array( [ 3.0, 7.0, 11.0, 2.0, 6.0, 10.0, 1.0, 5.0, 9.0, 0.0, 4.0, 8.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements from a partially contiguous view to an ndarray (row-major)', function test( t ) {
+	var arrays;
+	var x;
+	var y;
+
+	// Define a view containing every other row of a row-major 200x3x1000 ndarray:
+	x = ndarray( 'float64', new Float64Array( zeroTo( 600000 ) ), [ 100, 3, 1000 ], [ 6000, 1000, 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 300000 ), [ 100, 3, 1000 ], [ 3000, 1000, 1 ], 0, 'row-major' );
+	arrays = [ x, y ];
+
+	assign( arrays );
+	t.strictEqual( isExpected( arrays, identity ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements from a partially contiguous view to an ndarray (column-major)', function test( t ) {
+	var arrays;
+	var x;
+	var y;
+
+	// Define a view containing every other matrix of a column-major 4x3x10 ndarray:
+	x = ndarray( 'float64', new Float64Array( zeroTo( 120 ) ), [ 4, 3, 5 ], [ 1, 4, 24 ], 0, 'column-major' );
+	y = ndarray( 'float64', new Float64Array( 60 ), [ 4, 3, 5 ], [ 1, 4, 12 ], 0, 'column-major' );
+	arrays = [ x, y ];
+
+	assign( arrays );
+	t.strictEqual( isExpected( arrays, identity ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements from an ndarray having negative strides to an ndarray having negative strides', function test( t ) {
+	var arrays;
+	var x;
+	var y;
+
+	// Define a view which is reversed along every dimension:
+	x = ndarray( 'float64', new Float64Array( zeroTo( 24 ) ), [ 2, 3, 4 ], [ -12, -4, -1 ], 23, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ -12, -4, -1 ], 23, 'row-major' );
+	arrays = [ x, y ];
+
+	assign( arrays );
+	t.strictEqual( isExpected( arrays, identity ), true, 'returns expected value' );
+	t.end();
+});
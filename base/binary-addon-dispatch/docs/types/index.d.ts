@@ -0,0 +1,102 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2025 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { Collection } from '@stdlib/types/array';
+import { ndarray, typedndarray } from '@stdlib/types/ndarray';
+
+/**
+* Add-on function.
+*
+* @param xbuf - first input ndarray data buffer
+* @param metaX - first input ndarray meta data
+* @param ybuf - second input ndarray data buffer
+* @param metaY - second input ndarray meta data
+* @param zbuf - output ndarray data buffer
+* @param metaZ - output ndarray meta data
+*
+* @example
+* function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+*     // Call into native add-on...
+* }
+*/
+type AddonFcn<T, U, V, W> = ( xbuf: Collection<T>, metaX: DataView, ybuf: Collection<U>, metaY: DataView, zbuf: Collection<V>, metaZ: DataView ) => W;
+
+/**
+* Fallback function.
+*
+* @param x - first input ndarray
+* @param y - second input ndarray
+* @param z - output ndarray
+*
+* @example
+* function fallback( x, y, z ) {
+*     // Fallback JavaScript implementation...
+* }
+*/
+type FallbackFcn<T extends ndarray, U extends ndarray, V extends ndarray, W> = ( x: T, y: U, z: V ) => W;
+
+/**
+* Dispatches to a native add-on.
+*
+* @param x - first input ndarray
+* @param y - second input ndarray
+* @param z - output ndarray
+* @returns output ndarray
+*/
+type Dispatcher<T extends ndarray, U extends ndarray, V extends ndarray> = ( x: T, y: U, z: V ) => V;
+
+/**
+* Returns a function which dispatches to a native add-on applying a binary function to two input ndarrays.
+*
+* @param addon - add-on function
+* @param fallback - fallback function
+* @returns dispatch function
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var zeros = require( '@stdlib/ndarray/zeros' );
+*
+* function addon( x, metaX, y, metaY, z, metaZ ) {
+*     // Call into native add-on...
+* }
+*
+* function fallback( x, y, z ) {
+*     // Fallback JavaScript implementation...
+* }
+*
+* // Create a dispatch function:
+* var f = dispatch( addon, fallback );
+*
+* // ...
+*
+* // Invoke the dispatch function with ndarray arguments:
+* var x = array( [ [ 1, 2], [ 3, 4 ] ] );
+* var y = array( [ [ 5, 6], [ 7, 8 ] ] );
+* var z = zeros( [ 2, 2 ] );
+* f( x, y, z );
+*/
+declare function dispatch<T = unknown, U extends typedndarray<T> = typedndarray<T>, V = unknown, W extends typedndarray<V> = typedndarray<V>, X = unknown, Y extends typedndarray<X> = typedndarray<X>, Q = unknown>( addon: AddonFcn<T, V, X, Q>, fallback: FallbackFcn<U, W, Y, Q> ): Dispatcher<U, W, Y>;
+
+
+// EXPORTS //
+
+export = dispatch;
@@ -0,0 +1,191 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2025 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isFunction = require( '@stdlib/assert/is-function' );
+var isTypedArrayLike = require( '@stdlib/assert/is-typed-array-like' );
+var resolveEnum = require( './../../../base/dtype-resolve-enum' );
+var reinterpretComplex64 = require( '@stdlib/strided/base/reinterpret-complex64' );
+var reinterpretComplex128 = require( '@stdlib/strided/base/reinterpret-complex128' );
+var reinterpretBoolean = require( '@stdlib/strided/base/reinterpret-boolean' );
+var getData = require( './../../../base/data-buffer' );
+var getDType = require( './../../../base/dtype' );
+var serialize = require( './../../../base/serialize-meta-data' );
+var format = require( '@stdlib/string/format' );
+
+
+// VARIABLES //
+
+var COMPLEX64 = resolveEnum( 'complex64' );
+var COMPLEX128 = resolveEnum( 'complex128' );
+var BOOLEAN = resolveEnum( 'bool' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns a view of an ndarray data buffer suitable for passing to a native add-on.
+*
+* @private
+* @param {Collection} data - data buffer
+* @param {integer} dtype - data type enumeration constant
+* @returns {Collection} data buffer view
+*/
+function view( data, dtype ) {
+	if ( dtype === COMPLEX64 ) {
+		return reinterpretComplex64( data, 0 );
+	}
+	if ( dtype === COMPLEX128 ) {
+		return reinterpretComplex128( data, 0 );
+	}
+	if ( dtype === BOOLEAN ) {
+		return reinterpretBoolean( data, 0 );
+	}
+	return data;
+}
+
+
+// MAIN //
+
+/**
+* Returns a function which dispatches to a native add-on applying a binary function to two input ndarrays.
+*
+* ## Notes
+*
+* -   The returned function has the following signature:
+*
+*     ```text
+*     f( x, y, z )
+*     ```
+*
+*     where
+*
+*     -   **x**: first input ndarray.
+*     -   **y**: second input ndarray.
+*     -   **z**: output ndarray.
+*
+* -   The add-on function should have the following signature:
+*
+*     ```text
+*     f( xbuf, metaX, ybuf, metaY, zbuf, metaZ )
+*     ```
+*
+*     where
+*
+*     -   **xbuf**: first input ndarray data buffer.
+*     -   **metaX**: serialized first input ndarray meta data.
+*     -   **ybuf**: second input ndarray data buffer.
+*     -   **metaY**: serialized second input ndarray meta data.
+*     -   **zbuf**: output ndarray data buffer.
+*     -   **metaZ**: serialized output ndarray meta data.
+*
+* -   The fallback function should have the following signature:
+*
+*     ```text
+*     f( x, y, z )
+*     ```
+*
+*     where
+*
+*     -   **x**: first input ndarray.
+*     -   **y**: second input ndarray.
+*     -   **z**: output ndarray.
+*
+* @param {Function} addon - add-on interface
+* @param {Function} fallback - fallback function
+* @throws {TypeError} first argument must be a function
+* @throws {TypeError} second argument must be a function
+* @returns {Function} dispatch function
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var zeros = require( '@stdlib/ndarray/zeros' );
+*
+* function addon( x, metaX, y, metaY, z, metaZ ) {
+*     // Call into native add-on...
+* }
+*
+* function fallback( x, y, z ) {
+*     // Fallback JavaScript implementation...
+* }
+*
+* // Create a dispatch function:
+* var f = dispatch( addon, fallback );
+*
+* // ...
+*
+* // Invoke the dispatch function with ndarray arguments:
+* var x = array( [ [ 1, 2], [ 3, 4 ] ] );
+* var y = array( [ [ 5, 6], [ 7, 8 ] ] );
+* var z = zeros( [ 2, 2 ] );
+* f( x, y, z );
+*/
+function dispatch( addon, fallback ) {
+	if ( !isFunction( addon ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be a function. Value: `%s`.', addon ) );
+	}
+	if ( !isFunction( fallback ) ) {
+		throw new TypeError( format( 'invalid argument. Second argument must be a function. Value: `%s`.', fallback ) );
+	}
+	return dispatcher;
+
+	/**
+	* Dispatches to a native add-on.
+	*
+	* @private
+	* @param {ndarray} x - first input array
+	* @param {ndarray} y - second input array
+	* @param {ndarray} z - output array
+	* @throws {TypeError} unable to resolve an ndarray function supporting the provided argument data types
+	* @returns {ndarray} output array
+	*/
+	function dispatcher( x, y, z ) {
+		var dtypeX;
+		var dtypeY;
+		var dtypeZ;
+		var dataX;
+		var dataY;
+		var dataZ;
+
+		dataX = getData( x );
+		dataY = getData( y );
+		dataZ = getData( z );
+
+		// WARNING: we assume that, if we're provided something which has a data buffer resembling a typed array, we're provided an ndarray with a typed array buffer; however, this can lead to potential unintended errors as the native add-on may not work with non-typed array objects (e.g., generic arrays)...
+		if ( !isTypedArrayLike( dataX ) || !isTypedArrayLike( dataY ) || !isTypedArrayLike( dataZ ) ) { // eslint-disable-line max-len
+			fallback( x, y, z );
+			return z;
+		}
+		dtypeX = resolveEnum( getDType( x ) );
+		dtypeY = resolveEnum( getDType( y ) );
+		dtypeZ = resolveEnum( getDType( z ) );
+		if ( dtypeX === null || dtypeY === null || dtypeZ === null ) {
+			throw new TypeError( 'invalid arguments. Unable to resolve an ndarray function supporting the provided argument data types.' );
+		}
+		addon( view( dataX, dtypeX ), serialize( x ), view( dataY, dtypeY ), serialize( y ), view( dataZ, dtypeZ ), serialize( z ) ); // eslint-disable-line max-len
+		return z;
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = dispatch;
@@ -61,9 +61,9 @@ interface LoopOrderObject {
 *
 * -   When iterating over the elements of a multi-dimensional array, accessing elements which are closer in memory can improve performance. To this end, loop interchange is a technique used in loop nest optimization to improve locality of reference and take advantage of CPU cache.
 *
-*     The purpose of this function is to order ndarray dimensions according to the magnitude of array strides. By using the ordered dimensions and associated strides, one can construct nested loops (one for each dimension) such that the innermost loop iterates over the dimension in which array elements are closest in memory and the outermost loop iterates over the dimension in which array elements are farthest apart in memory. As a consequence, element iteration is optimized to minimize cache misses and ensure locality of reference.
+*     The purpose of this function is to order ndarray dimensions according to the estimated cost of accessing array elements. By using the ordered dimensions and associated strides, one can construct nested loops (one for each dimension) such that the innermost loop iterates over the dimension in which array elements are closest in memory and the outermost loop iterates over the dimension in which array elements are farthest apart in memory. As a consequence, element iteration is optimized to minimize cache misses and ensure locality of reference.
 *
-* -   Cache performance may be degraded if the layout order (i.e., row-major or column-major) differs for the input and output ndarrays. This function is intended to optimize cache performance for the most common layout order. Accordingly, if the output ndarray has a different layout order (e.g., if the input ndarrays are row-major and the output ndarray is column-major), cache misses are likely for the output ndarray. In general, to ensure best performance, input and output ndarrays should have the same layout order.
+* -   Cache performance may be degraded if the layout order (i.e., row-major or column-major) differs for the input and output ndarrays. This function resolves the loop order using a cost model which weighs the strides of all ndarrays, with output writes weighted more heavily than input reads. Accordingly, if the output ndarray has a different layout order (e.g., if the input ndarrays are row-major and the output ndarray is column-major), the function favors contiguous writes unless the reads from the input ndarrays outweigh them. In general, to ensure best performance, input and output ndarrays should have the same layout order.
 *
 * -   The function assumes that the input and output ndarrays have the same shape. Hence, loop interchange order should only be determined **after** broadcasting.
 *
@@ -71,6 +71,7 @@ interface LoopOrderObject {
 * @param stridesX - first input array stride lengths
 * @param stridesY - second input array stride lengths
 * @param stridesZ - output array stride lengths
+* @param nbytes - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns loop interchange data
 *
 * @example
@@ -95,7 +96,7 @@ interface LoopOrderObject {
 * var ssz = o.sz;
 * // returns [ 6, -2, 1 ]
 */
-declare function binaryLoopOrder( shape: ArrayLike<number>, stridesX: ArrayLike<number>, stridesY: ArrayLike<number>, stridesZ: ArrayLike<number> ): LoopOrderObject;
+declare function binaryLoopOrder( shape: ArrayLike<number>, stridesX: ArrayLike<number>, stridesY: ArrayLike<number>, stridesZ: ArrayLike<number>, nbytes?: ArrayLike<number | null> ): LoopOrderObject;
 
 
 // EXPORTS //
@@ -41,6 +41,7 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * @param {IntegerArray} sx - first input array stride lengths
 * @param {IntegerArray} sy - second input array stride lengths
 * @param {IntegerArray} sz - output array stride lengths
+* @param {ArrayLikeObject<(PositiveInteger|null)>} [nbytes] - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns {Object} loop interchange data
 *
 * @example
@@ -65,8 +66,8 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * var ssz = o.sz;
 * // returns [ 6, -2, 1 ]
 */
-function binaryLoopOrder( sh, sx, sy, sz ) {
-	var tmp = loopOrder( sh, [ sx, sy, sz ] );
+function binaryLoopOrder( sh, sx, sy, sz, nbytes ) {
+	var tmp = loopOrder( sh, [ sx, sy, sz ], ( arguments.length > 4 ) ? nbytes : [] );
 	return {
 		'sh': tmp[ 0 ],
 		'sx': tmp[ 1 ],
@@ -152,15 +152,15 @@ tape( 'the function returns loop interchange data (mostly disorganized)', functi
 
 	t.notEqual( o.sx, sx, 'returns new array' );
 	t.strictEqual( isArray( o.sx ), true, 'returns expected value' );
-	t.deepEqual( o.sx, [ 1, 4, -2 ], 'returns expected value' );
+	t.deepEqual( o.sx, [ 4, 1, -2 ], 'returns expected value' );
 
 	t.notEqual( o.sy, sy, 'returns new array' );
 	t.strictEqual( isArray( o.sy ), true, 'returns expected value' );
-	t.deepEqual( o.sy, [ 1, 2, -4 ], 'returns expected value' );
+	t.deepEqual( o.sy, [ 2, 1, -4 ], 'returns expected value' );
 
 	t.notEqual( o.sz, sz, 'returns new array' );
 	t.strictEqual( isArray( o.sz ), true, 'returns expected value' );
-	t.deepEqual( o.sz, [ 4, -2, -8 ], 'returns expected value' );
+	t.deepEqual( o.sz, [ -2, 4, -8 ], 'returns expected value' );
 
 	t.end();
 });
@@ -181,19 +181,19 @@ tape( 'the function returns loop interchange data (all disorganized)', function
 
 	t.notEqual( o.sh, sh, 'returns new array' );
 	t.strictEqual( isArray( o.sh ), true, 'returns expected value' );
-	t.deepEqual( o.sh, [ 2, 4, 2 ], 'returns expected value' );
+	t.deepEqual( o.sh, [ 2, 2, 4 ], 'returns expected value' );
 
 	t.notEqual( o.sx, sx, 'returns new array' );
 	t.strictEqual( isArray( o.sx ), true, 'returns expected value' );
-	t.deepEqual( o.sx, [ 1, -2, 4 ], 'returns expected value' );
+	t.deepEqual( o.sx, [ 1, 4, -2 ], 'returns expected value' );
 
 	t.notEqual( o.sy, sy, 'returns new array' );
 	t.strictEqual( isArray( o.sy ), true, 'returns expected value' );
-	t.deepEqual( o.sy, [ 2, 1, -4 ], 'returns expected value' );
+	t.deepEqual( o.sy, [ 2, -4, 1 ], 'returns expected value' );
 
 	t.notEqual( o.sz, sz, 'returns new array' );
 	t.strictEqual( isArray( o.sz ), true, 'returns expected value' );
-	t.deepEqual( o.sz, [ 4, -8, -2 ], 'returns expected value' );
+	t.deepEqual( o.sz, [ 4, -2, -8 ], 'returns expected value' );
 
 	t.end();
 });
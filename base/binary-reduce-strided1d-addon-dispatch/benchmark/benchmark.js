@@ -0,0 +1,139 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isFunction = require( '@stdlib/assert/is-function' );
+var uniform = require( '@stdlib/random/uniform' );
+var zeros = require( './../../../zeros' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var dispatch = require( './../lib' );
+
+
+// FUNCTIONS //
+
+function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+	if ( !metaX || !metaY || !metaZ ) {
+		return null;
+	}
+	xbuf[ 0 ] += xbuf.length;
+	zbuf[ 0 ] = xbuf[ 0 ] * ybuf[ 0 ];
+}
+
+function fallback( x, y, z ) {
+	z.set( 0, x.get( 0, 0 ) * y.get( 0, 0 ) );
+}
+
+
+// MAIN //
+
+bench( format( '%s::create', pkg ), function benchmark( b ) {
+	var f;
+	var i;
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		f = dispatch( addon, fallback );
+		if ( typeof f !== 'function' ) {
+			b.fail( 'should return a function' );
+		}
+	}
+	b.toc();
+	if ( !isFunction( f ) ) {
+		b.fail( 'should return a function' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::dispatch,addon', pkg ), function benchmark( b ) {
+	var f;
+	var x;
+	var y;
+	var z;
+	var v;
+	var i;
+
+	f = dispatch( addon, fallback );
+	x = uniform( [ 10, 10 ], -10.0, 10.0, {
+		'dtype': 'float64'
+	});
+	y = uniform( [ 10, 10 ], -10.0, 10.0, {
+		'dtype': 'float64'
+	});
+	z = zeros( [ 10 ], {
+		'dtype': 'float64'
+	});
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		x.set( 0, 0, i );
+		f( x, y, z, [ 1 ] );
+		v = z.get( i%10 );
+		if ( v !== v ) {
+			b.fail( 'should not return NaN' );
+		}
+	}
+	b.toc();
+	if ( v !== v ) {
+		b.fail( 'should not return NaN' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::dispatch,fallback', pkg ), function benchmark( b ) {
+	var f;
+	var x;
+	var y;
+	var z;
+	var v;
+	var i;
+
+	f = dispatch( addon, fallback );
+	x = uniform( [ 10, 10 ], -10.0, 10.0, {
+		'dtype': 'generic'
+	});
+	y = uniform( [ 10, 10 ], -10.0, 10.0, {
+		'dtype': 'generic'
+	});
+	z = zeros( [ 10 ], {
+		'dtype': 'generic'
+	});
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		x.set( 0, 0, i );
+		f( x, y, z, [ 1 ] );
+		v = z.get( i%10 );
+		if ( v !== v ) {
+			b.fail( 'should not return NaN' );
+		}
+	}
+	b.toc();
+	if ( v !== v ) {
+		b.fail( 'should not return NaN' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
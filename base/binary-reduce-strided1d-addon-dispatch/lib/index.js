@@ -0,0 +1,59 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+/**
+* Dispatch to a native add-on performing a binary reduction over one-dimensional strided lanes of two input ndarrays.
+*
+* @module @stdlib/ndarray/base/binary-reduce-strided1d-addon-dispatch
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var zeros = require( '@stdlib/ndarray/zeros' );
+* var dispatch = require( '@stdlib/ndarray/base/binary-reduce-strided1d-addon-dispatch' );
+*
+* function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+*     // Call into native add-on...
+* }
+*
+* function fallback( x, y, z, dims ) {
+*     // Fallback JavaScript implementation...
+* }
+*
+* // Create a dispatch function:
+* var f = dispatch( addon, fallback );
+*
+* // ...
+*
+* // Invoke the dispatch function with ndarray arguments:
+* var x = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+* var y = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+* var z = zeros( [ 2 ] );
+* f( x, y, z, [ 1 ] );
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
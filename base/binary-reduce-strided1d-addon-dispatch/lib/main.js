@@ -0,0 +1,276 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var isFunction = require( '@stdlib/assert/is-function' );
+var isTypedArrayLike = require( '@stdlib/assert/is-typed-array-like' );
+var resolveEnum = require( './../../../base/dtype-resolve-enum' );
+var reinterpretComplex64 = require( '@stdlib/strided/base/reinterpret-complex64' );
+var reinterpretComplex128 = require( '@stdlib/strided/base/reinterpret-complex128' );
+var reinterpretBoolean = require( '@stdlib/strided/base/reinterpret-boolean' );
+var getData = require( './../../../base/data-buffer' );
+var getDType = require( './../../../base/dtype' );
+var getShape = require( './../../../base/shape' );
+var getStrides = require( './../../../base/strides' );
+var getOffset = require( './../../../base/offset' );
+var getOrder = require( './../../../base/order' );
+var serialize = require( './../../../base/serialize-meta-data' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
+var format = require( '@stdlib/string/format' );
+
+
+// VARIABLES //
+
+var COMPLEX64 = resolveEnum( 'complex64' );
+var COMPLEX128 = resolveEnum( 'complex128' );
+var BOOLEAN = resolveEnum( 'bool' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns a view of an ndarray data buffer suitable for passing to a native add-on.
+*
+* @private
+* @param {Collection} data - data buffer
+* @param {integer} dtype - data type enumeration constant
+* @returns {Collection} data buffer view
+*/
+function view( data, dtype ) {
+	if ( dtype === COMPLEX64 ) {
+		return reinterpretComplex64( data, 0 );
+	}
+	if ( dtype === COMPLEX128 ) {
+		return reinterpretComplex128( data, 0 );
+	}
+	if ( dtype === BOOLEAN ) {
+		return reinterpretBoolean( data, 0 );
+	}
+	return data;
+}
+
+
+// MAIN //
+
+/**
+* Returns a function which dispatches to a native add-on performing a binary reduction over one-dimensional strided lanes of two input ndarrays.
+*
+* ## Notes
+*
+* -   The returned function has the following signature:
+*
+*     ```text
+*     f( x, y, z, dims )
+*     ```
+*
+*     where
+*
+*     -   **x**: first input ndarray.
+*     -   **y**: second input ndarray.
+*     -   **z**: output ndarray.
+*     -   **dims**: list of dimensions over which to perform a reduction. Dimension indices are expected to be nonnegative and sorted in increasing order.
+*
+* -   The add-on function should have the following signature:
+*
+*     ```text
+*     f( xbuf, metaX, ybuf, metaY, zbuf, metaZ )
+*     ```
+*
+*     where
+*
+*     -   **xbuf**: first input ndarray data buffer.
+*     -   **metaX**: serialized first input ndarray meta data.
+*     -   **ybuf**: second input ndarray data buffer.
+*     -   **metaY**: serialized second input ndarray meta data.
+*     -   **zbuf**: output ndarray data buffer.
+*     -   **metaZ**: serialized output ndarray meta data.
+*
+*     The serialized input ndarray meta data describes an ndarray having one more dimension than the output ndarray, where the leading dimensions correspond to the non-reduced dimensions and the last dimension is a single strided lane spanning all reduced dimensions.
+*
+* -   The fallback function should have the following signature:
+*
+*     ```text
+*     f( x, y, z, dims )
+*     ```
+*
+*     where
+*
+*     -   **x**: first input ndarray.
+*     -   **y**: second input ndarray.
+*     -   **z**: output ndarray.
+*     -   **dims**: list of dimensions over which to perform a reduction.
+*
+* -   The reduced dimensions can only be passed to the native add-on as a single lane when the reduced dimensions are jointly contiguous in memory for both input ndarrays (e.g., reducing over the last two dimensions of row-major ndarrays). Otherwise, the dispatch function invokes the fallback function.
+*
+* @param {Function} addon - add-on interface
+* @param {Function} fallback - fallback function
+* @throws {TypeError} first argument must be a function
+* @throws {TypeError} second argument must be a function
+* @returns {Function} dispatch function
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var zeros = require( '@stdlib/ndarray/zeros' );
+*
+* function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+*     // Call into native add-on...
+* }
+*
+* function fallback( x, y, z, dims ) {
+*     // Fallback JavaScript implementation...
+* }
+*
+* // Create a dispatch function:
+* var f = dispatch( addon, fallback );
+*
+* // ...
+*
+* // Invoke the dispatch function with ndarray arguments:
+* var x = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+* var y = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+* var z = zeros( [ 2 ] );
+* f( x, y, z, [ 1 ] );
+*/
+function dispatch( addon, fallback ) {
+	if ( !isFunction( addon ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be a function. Value: `%s`.', addon ) );
+	}
+	if ( !isFunction( fallback ) ) {
+		throw new TypeError( format( 'invalid argument. Second argument must be a function. Value: `%s`.', fallback ) );
+	}
+	return dispatcher;
+
+	/**
+	* Dispatches to a native add-on.
+	*
+	* @private
+	* @param {ndarray} x - first input array
+	* @param {ndarray} y - second input array
+	* @param {ndarray} z - output array
+	* @param {NonNegativeIntegerArray} dims - list of dimensions over which to perform a reduction
+	* @throws {TypeError} unable to resolve an ndarray function supporting the provided argument data types
+	* @returns {ndarray} output array
+	*/
+	function dispatcher( x, y, z, dims ) {
+		var dtypeX;
+		var dtypeY;
+		var dtypeZ;
+		var dataX;
+		var dataY;
+		var dataZ;
+		var order;
+		var shl;
+		var slx;
+		var sly;
+		var shc;
+		var scx;
+		var scy;
+		var shx;
+		var sx;
+		var sy;
+		var lx;
+		var ly;
+		var N;
+		var o;
+		var i;
+		var j;
+
+		dataX = getData( x );
+		dataY = getData( y );
+		dataZ = getData( z );
+
+		// WARNING: we assume that, if we're provided something which has a data buffer resembling a typed array, we're provided an ndarray with a typed array buffer; however, this can lead to potential unintended errors as the native add-on may not work with non-typed array objects (e.g., generic arrays)...
+		if ( !isTypedArrayLike( dataX ) || !isTypedArrayLike( dataY ) || !isTypedArrayLike( dataZ ) ) {
+			fallback( x, y, z, dims );
+			return z;
+		}
+		shx = getShape( x, false );
+		sx = getStrides( x, false );
+		sy = getStrides( y, false );
+
+		// Partition the input ndarray dimensions into loop and reduced ("core") dimensions:
+		shl = [];
+		slx = [];
+		sly = [];
+		shc = [];
+		scx = [];
+		scy = [];
+		for ( i = 0, j = 0; i < shx.length; i++ ) {
+			if ( j < dims.length && dims[ j ] === i ) {
+				shc.push( shx[ i ] );
+				scx.push( sx[ i ] );
+				scy.push( sy[ i ] );
+				j += 1;
+			} else {
+				shl.push( shx[ i ] );
+				slx.push( sx[ i ] );
+				sly.push( sy[ i ] );
+			}
+		}
+		// Attempt to represent the reduced dimensions as a single strided lane...
+		if ( shc.length === 0 ) {
+			N = 1;
+			lx = 0;
+			ly = 0;
+		} else {
+			o = coalesce( shc, [ scx, scy ] );
+			if ( o[ 0 ].length !== 1 ) {
+				fallback( x, y, z, dims );
+				return z;
+			}
+			N = o[ 0 ][ 0 ];
+			lx = o[ 1 ][ 0 ];
+			ly = o[ 2 ][ 0 ];
+		}
+		dtypeX = resolveEnum( getDType( x ) );
+		dtypeY = resolveEnum( getDType( y ) );
+		dtypeZ = resolveEnum( getDType( z ) );
+		if ( dtypeX === null || dtypeY === null || dtypeZ === null ) {
+			throw new TypeError( 'invalid arguments. Unable to resolve an ndarray function supporting the provided argument data types.' );
+		}
+		// Use the output ndarray order to determine the loop order for the add-on:
+		order = getOrder( z );
+
+		shl.push( N );
+		slx.push( lx );
+		sly.push( ly );
+		addon( view( dataX, dtypeX ), serialize({
+			'dtype': getDType( x ),
+			'shape': shl,
+			'strides': slx,
+			'offset': getOffset( x ),
+			'order': order
+		}), view( dataY, dtypeY ), serialize({
+			'dtype': getDType( y ),
+			'shape': shl,
+			'strides': sly,
+			'offset': getOffset( y ),
+			'order': order
+		}), view( dataZ, dtypeZ ), serialize( z ) );
+		return z;
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = dispatch;
@@ -0,0 +1,453 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var isDataView = require( '@stdlib/assert/is-dataview' );
+var isFloat64Array = require( '@stdlib/assert/is-float64array' );
+var isFloat32Array = require( '@stdlib/assert/is-float32array' );
+var IS_LITTLE_ENDIAN = require( '@stdlib/assert/is-little-endian' );
+var Float64Array = require( '@stdlib/array/float64' );
+var noop = require( '@stdlib/utils/noop' );
+var ndarray = require( './../../../base/ctor' );
+var empty = require( './../../../empty' );
+var dispatch = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Parses serialized ndarray meta data.
+*
+* @private
+* @param {DataView} v - serialized meta data
+* @returns {Object} meta data
+*/
+function parse( v ) {
+	var strides;
+	var shape;
+	var nbytes;
+	var N;
+	var o;
+	var i;
+
+	N = Number( v.getBigInt64( 3, IS_LITTLE_ENDIAN ) );
+	nbytes = 8; // note: all tests use 8-byte data types
+	shape = [];
+	strides = [];
+	o = 11;
+	for ( i = 0; i < N; i++ ) {
+		shape.push( Number( v.getBigInt64( o, IS_LITTLE_ENDIAN ) ) );
+		strides.push( Number( v.getBigInt64( o+(N*8), IS_LITTLE_ENDIAN ) ) / nbytes );
+		o += 8;
+	}
+	o += N * 8;
+	return {
+		'shape': shape,
+		'strides': strides,
+		'offset': Number( v.getBigInt64( o, IS_LITTLE_ENDIAN ) ) / nbytes
+	};
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof dispatch, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a first argument which is not a function', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			dispatch( value, noop );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a second argument which is not a function', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			dispatch( noop, value );
+		};
+	}
+});
+
+tape( 'the function returns a function', function test( t ) {
+	var f = dispatch( noop, noop );
+	t.strictEqual( typeof f, 'function', 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns a function which dispatches to an addon function when provided ndarrays whose underlying data buffers are typed arrays', function test( t ) {
+	var opts;
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	opts = {
+		'dtype': 'float64'
+	};
+	x = empty( [ 2, 3 ], opts );
+	y = empty( [ 2, 3 ], opts );
+	z = empty( [ 2 ], opts );
+
+	f( x, y, z, [ 1 ] );
+
+	t.end();
+
+	function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+		t.ok( true, 'called addon' );
+		t.strictEqual( isFloat64Array( xbuf ), true, 'returns expected value' );
+		t.strictEqual( isDataView( metaX ), true, 'returns expected value' );
+		t.strictEqual( isFloat64Array( ybuf ), true, 'returns expected value' );
+		t.strictEqual( isDataView( metaY ), true, 'returns expected value' );
+		t.strictEqual( isFloat64Array( zbuf ), true, 'returns expected value' );
+		t.strictEqual( isDataView( metaZ ), true, 'returns expected value' );
+	}
+
+	function fallback() {
+		t.ok( false, 'called fallback' );
+	}
+});
+
+tape( 'the function supports complex number typed array data buffers (complex64)', function test( t ) {
+	var opts;
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	opts = {
+		'dtype': 'complex64'
+	};
+	x = empty( [ 2, 3 ], opts );
+	y = empty( [ 2, 3 ], opts );
+	z = empty( [ 2 ], opts );
+
+	f( x, y, z, [ 1 ] );
+
+	t.end();
+
+	function addon( xbuf, metaX, ybuf, metaY, zbuf ) {
+		t.ok( true, 'called addon' );
+		t.strictEqual( isFloat32Array( xbuf ), true, 'returns expected value' );
+		t.strictEqual( isFloat32Array( ybuf ), true, 'returns expected value' );
+		t.strictEqual( isFloat32Array( zbuf ), true, 'returns expected value' );
+	}
+
+	function fallback() {
+		t.ok( false, 'called fallback' );
+	}
+});
+
+tape( 'the function supports complex number typed array data buffers (complex128)', function test( t ) {
+	var opts;
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	opts = {
+		'dtype': 'complex128'
+	};
+	x = empty( [ 2, 3 ], opts );
+	y = empty( [ 2, 3 ], opts );
+	z = empty( [ 2 ], opts );
+
+	f( x, y, z, [ 1 ] );
+
+	t.end();
+
+	function addon( xbuf, metaX, ybuf, metaY, zbuf ) {
+		t.ok( true, 'called addon' );
+		t.strictEqual( isFloat64Array( xbuf ), true, 'returns expected value' );
+		t.strictEqual( isFloat64Array( ybuf ), true, 'returns expected value' );
+		t.strictEqual( isFloat64Array( zbuf ), true, 'returns expected value' );
+	}
+
+	function fallback() {
+		t.ok( false, 'called fallback' );
+	}
+});
+
+tape( 'the function returns a function which provides the addon function input ndarray meta data describing a single strided lane per output element (row-major, multiple reduced dimensions)', function test( t ) {
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	x = new ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ 12, 4, 1 ], 0, 'row-major' );
+	y = new ndarray( 'float64', new Float64Array( 48 ), [ 2, 3, 4 ], [ -24, 8, 2 ], 24, 'row-major' );
+	z = new ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	f( x, y, z, [ 1, 2 ] );
+
+	t.end();
+
+	function addon( xbuf, metaX, ybuf, metaY ) {
+		t.deepEqual( parse( metaX ), {
+			'shape': [ 2, 12 ],
+			'strides': [ 12, 1 ],
+			'offset': 0
+		}, 'returns expected value' );
+		t.deepEqual( parse( metaY ), {
+			'shape': [ 2, 12 ],
+			'strides': [ -24, 2 ],
+			'offset': 24
+		}, 'returns expected value' );
+	}
+
+	function fallback() {
+		t.ok( false, 'called fallback' );
+	}
+});
+
+tape( 'the function returns a function which provides the addon function input ndarray meta data describing a single strided lane per output element (column-major, non-trailing reduced dimension)', function test( t ) {
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	x = new ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ 1, 2, 6 ], 0, 'column-major' );
+	y = new ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ 1, 2, 6 ], 0, 'column-major' );
+	z = new ndarray( 'float64', new Float64Array( 8 ), [ 2, 4 ], [ 1, 2 ], 0, 'column-major' );
+
+	f( x, y, z, [ 1 ] );
+
+	t.end();
+
+	function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+		t.deepEqual( parse( metaX ), {
+			'shape': [ 2, 4, 3 ],
+			'strides': [ 1, 6, 2 ],
+			'offset': 0
+		}, 'returns expected value' );
+		t.deepEqual( parse( metaY ), parse( metaX ), 'returns expected value' );
+		t.deepEqual( parse( metaZ ), {
+			'shape': [ 2, 4 ],
+			'strides': [ 1, 2 ],
+			'offset': 0
+		}, 'returns expected value' );
+	}
+
+	function fallback() {
+		t.ok( false, 'called fallback' );
+	}
+});
+
+tape( 'the function returns a function which provides the addon function a lane of length one when not provided any dimensions to reduce', function test( t ) {
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	x = new ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = new ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	z = new ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	f( x, y, z, [] );
+
+	t.end();
+
+	function addon( xbuf, metaX ) {
+		t.deepEqual( parse( metaX ), {
+			'shape': [ 2, 3, 1 ],
+			'strides': [ 3, 1, 0 ],
+			'offset': 0
+		}, 'returns expected value' );
+	}
+
+	function fallback() {
+		t.ok( false, 'called fallback' );
+	}
+});
+
+tape( 'the function returns a function which dispatches to a fallback function when the reduced dimensions cannot be represented as a single strided lane', function test( t ) {
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	x = new ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ 12, 4, 1 ], 0, 'row-major' );
+	y = new ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ 12, 4, 1 ], 0, 'row-major' );
+	z = new ndarray( 'float64', new Float64Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	f( x, y, z, [ 0, 2 ] );
+
+	t.end();
+
+	function addon() {
+		t.ok( false, 'called addon' );
+	}
+
+	function fallback( xv, yv, zv, dims ) {
+		t.ok( true, 'called fallback' );
+		t.strictEqual( xv, x, 'returns expected value' );
+		t.strictEqual( yv, y, 'returns expected value' );
+		t.strictEqual( zv, z, 'returns expected value' );
+		t.deepEqual( dims, [ 0, 2 ], 'returns expected value' );
+	}
+});
+
+tape( 'the function returns a function which dispatches to a fallback function when not provided typed array data buffers', function test( t ) {
+	var opts;
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	opts = {
+		'dtype': 'generic'
+	};
+	x = empty( [ 2, 3 ], opts );
+	y = empty( [ 2, 3 ], opts );
+	z = empty( [ 2 ], opts );
+
+	f( x, y, z, [ 1 ] );
+
+	t.end();
+
+	function addon() {
+		t.ok( false, 'called addon' );
+	}
+
+	function fallback( xv, yv, zv ) {
+		t.ok( true, 'called fallback' );
+		t.strictEqual( xv, x, 'returns expected value' );
+		t.strictEqual( yv, y, 'returns expected value' );
+		t.strictEqual( zv, z, 'returns expected value' );
+	}
+});
+
+tape( 'the function returns a function which dispatches to a fallback function when not provided typed array data buffers (output array)', function test( t ) {
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( addon, fallback );
+
+	x = empty( [ 2, 3 ], {
+		'dtype': 'float64'
+	});
+	y = empty( [ 2, 3 ], {
+		'dtype': 'float64'
+	});
+	z = empty( [ 2 ], {
+		'dtype': 'generic'
+	});
+
+	f( x, y, z, [ 1 ] );
+
+	t.end();
+
+	function addon() {
+		t.ok( false, 'called addon' );
+	}
+
+	function fallback( xv, yv, zv ) {
+		t.ok( true, 'called fallback' );
+		t.strictEqual( zv, z, 'returns expected value' );
+	}
+});
+
+tape( 'the function returns a function which returns the output ndarray', function test( t ) {
+	var opts;
+	var out;
+	var f;
+	var x;
+	var y;
+	var z;
+
+	f = dispatch( noop, noop );
+
+	opts = {
+		'dtype': 'float64'
+	};
+	x = empty( [ 2, 3 ], opts );
+	y = empty( [ 2, 3 ], opts );
+	z = empty( [ 2 ], opts );
+
+	out = f( x, y, z, [ 1 ] );
+	t.strictEqual( out, z, 'returns expected value' );
+
+	out = f( x, y, z, [ 0, 1 ] );
+	t.strictEqual( out, z, 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,110 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/binary_reduce_strided1d.h"
+#include "stdlib/ndarray/dtypes.h"
+#include "stdlib/ndarray/index_modes.h"
+#include "stdlib/ndarray/orders.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+static void print_ndarray_contents( const struct ndarray *x ) {
+	int64_t i;
+	int8_t s;
+	double v;
+
+	for ( i = 0; i < stdlib_ndarray_length( x ); i++ ) {
+		s = stdlib_ndarray_iget_float64( x, i, &v );
+		if ( s != 0 ) {
+			fprintf( stderr, "Unable to resolve data element.\n" );
+			exit( EXIT_FAILURE );
+		}
+		fprintf( stdout, "data[%"PRId64"] = %lf\n", i, v );
+	}
+}
+
+int main( void ) {
+	// Define the ndarray data type:
+	enum STDLIB_NDARRAY_DTYPE dtype = STDLIB_NDARRAY_FLOAT64;
+
+	// Create underlying data buffers:
+	double xbuf[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0 };
+	double ybuf[] = { 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0 };
+	double zbuf[] = { 0.0, 0.0, 0.0, 0.0 };
+
+	// Define the array shapes (the last input ndarray dimension is the reduced dimension):
+	int64_t shx[] = { 2, 2, 3 };
+	int64_t shz[] = { 2, 2 };
+
+	// Define the strides:
+	int64_t sx[] = { 48, 24, 8 };
+	int64_t sy[] = { 48, 24, 8 };
+	int64_t sz[] = { 16, 8 };
+
+	// Define the offsets:
+	int64_t ox = 0;
+	int64_t oy = 0;
+	int64_t oz = 0;
+
+	// Define the array order:
+	enum STDLIB_NDARRAY_ORDER order = STDLIB_NDARRAY_ROW_MAJOR;
+
+	// Specify the index mode:
+	enum STDLIB_NDARRAY_INDEX_MODE imode = STDLIB_NDARRAY_INDEX_ERROR;
+
+	// Specify the subscript index modes:
+	int8_t submodes[] = { imode };
+	int64_t nsubmodes = 1;
+
+	// Create the input ndarrays:
+	struct ndarray *x = stdlib_ndarray_allocate( dtype, (uint8_t *)xbuf, 3, shx, sx, ox, order, imode, nsubmodes, submodes );
+	struct ndarray *y = stdlib_ndarray_allocate( dtype, (uint8_t *)ybuf, 3, shx, sy, oy, order, imode, nsubmodes, submodes );
+	if ( x == NULL || y == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Create an output ndarray:
+	struct ndarray *z = stdlib_ndarray_allocate( dtype, (uint8_t *)zbuf, 2, shz, sz, oz, order, imode, nsubmodes, submodes );
+	if ( z == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Define an array containing the ndarrays:
+	struct ndarray *arrays[] = { x, y, z };
+
+	// Compute the dot product of each pair of lanes:
+	int8_t status = stdlib_ndarray_binary_reduce_strided1d_dd_d( arrays, (void *)stdlib_ndarray_binary_reduce_strided1d_ddot );
+	if ( status != 0 ) {
+		fprintf( stderr, "Error during computation.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Print the results:
+	print_ndarray_contents( z );
+	fprintf( stdout, "\n" );
+
+	// Free allocated memory:
+	stdlib_ndarray_free( x );
+	stdlib_ndarray_free( y );
+	stdlib_ndarray_free( z );
+}
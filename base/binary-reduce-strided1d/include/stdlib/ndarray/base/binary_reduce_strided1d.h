@@ -0,0 +1,35 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+/**
+* Header file containing function declarations for ndarray functions which perform a binary reduction over one-dimensional strided lanes.
+*/
+#ifndef STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_H
+#define STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_H
+
+#include "binary_reduce_strided1d/macros.h"
+#include "binary_reduce_strided1d/typedefs.h"
+#include "binary_reduce_strided1d/kernels.h"
+
+#include "binary_reduce_strided1d/cc_c.h"
+#include "binary_reduce_strided1d/dd_d.h"
+#include "binary_reduce_strided1d/ff_f.h"
+#include "binary_reduce_strided1d/zz_z.h"
+
+#endif // !STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_H
@@ -0,0 +1,68 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_KERNELS_H
+#define STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_KERNELS_H
+
+#include "stdlib/complex/float64/ctor.h"
+#include "stdlib/complex/float32/ctor.h"
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Computes the dot product of two double-precision floating-point strided lanes.
+*/
+double stdlib_ndarray_binary_reduce_strided1d_ddot( const int64_t N, const double *X, const int64_t strideX, const double *Y, const int64_t strideY );
+
+/**
+* Computes the dot product of two single-precision floating-point strided lanes.
+*/
+float stdlib_ndarray_binary_reduce_strided1d_sdot( const int64_t N, const float *X, const int64_t strideX, const float *Y, const int64_t strideY );
+
+/**
+* Computes the (unconjugated) dot product of two double-precision complex floating-point strided lanes.
+*/
+stdlib_complex128_t stdlib_ndarray_binary_reduce_strided1d_zdotu( const int64_t N, const stdlib_complex128_t *X, const int64_t strideX, const stdlib_complex128_t *Y, const int64_t strideY );
+
+/**
+* Computes the (unconjugated) dot product of two single-precision complex floating-point strided lanes.
+*/
+stdlib_complex64_t stdlib_ndarray_binary_reduce_strided1d_cdotu( const int64_t N, const stdlib_complex64_t *X, const int64_t strideX, const stdlib_complex64_t *Y, const int64_t strideY );
+
+/**
+* Computes the squared Euclidean distance between two double-precision floating-point strided lanes.
+*/
+double stdlib_ndarray_binary_reduce_strided1d_dsqdist( const int64_t N, const double *X, const int64_t strideX, const double *Y, const int64_t strideY );
+
+/**
+* Computes the squared Euclidean distance between two single-precision floating-point strided lanes.
+*/
+float stdlib_ndarray_binary_reduce_strided1d_ssqdist( const int64_t N, const float *X, const int64_t strideX, const float *Y, const int64_t strideY );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_KERNELS_H
@@ -0,0 +1,176 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_MACROS_H
+#define STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_MACROS_H
+
+#include "stdlib/ndarray/ctor.h"
+#include "stdlib/ndarray/orders.h"
+#include <stdint.h>
+
+/**
+* Macro containing the preamble for a loop which visits each one-dimensional strided lane of two input ndarrays and the corresponding element of an output ndarray.
+*
+* ## Notes
+*
+* -   Expects `arrays` to contain pointers to two input ndarrays having `K+1` dimensions and an output ndarray having `K` dimensions, where the first `K` dimensions of each input ndarray are the "loop" dimensions (which must match the dimensions of the output ndarray) and the last dimension of each input ndarray is the reduced dimension.
+* -   Within the loop body, `px1` and `px2` point to the first element of the current lane in the first and second input ndarrays, respectively, and `px3` points to the corresponding output ndarray element.
+* -   `N` is the number of elements in each lane, and `sl1` and `sl2` are the lane strides expressed in units of elements.
+* -   The innermost loop iterates over the output ndarray dimension having the smallest stride for the output array's memory layout (i.e., the last dimension for row-major and the first dimension for column-major), and the remaining loop dimensions are resolved once per iteration of the innermost loop. As each lane involves `N` operations, this amortizes the cost of index computation without requiring per-dimension specialized loops.
+* -   If either the number of lanes or the lane length is zero, the loop body is never evaluated.
+*
+* @example
+* STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_PREAMBLE {
+*     // Innermost loop body...
+* }
+* STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_EPILOGUE
+*/
+#define STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_PREAMBLE                   \
+	const struct ndarray *x1 = arrays[ 0 ];                                    \
+	const struct ndarray *x2 = arrays[ 1 ];                                    \
+	const struct ndarray *x3 = arrays[ 2 ];                                    \
+	const int64_t ndims = stdlib_ndarray_ndims( x3 );                          \
+	const int64_t *shape = stdlib_ndarray_shape( x3 );                         \
+	const int64_t *sx1 = stdlib_ndarray_strides( x1 );                         \
+	const int64_t *sx2 = stdlib_ndarray_strides( x2 );                         \
+	const int64_t *sx3 = stdlib_ndarray_strides( x3 );                         \
+	const int64_t N = stdlib_ndarray_dimension( x1, ndims );                   \
+	const int64_t sl1 = stdlib_ndarray_stride_elements( x1, ndims );           \
+	const int64_t sl2 = stdlib_ndarray_stride_elements( x2, ndims );           \
+	const int8_t isrm = ( stdlib_ndarray_order( x3 ) != STDLIB_NDARRAY_COLUMN_MAJOR ); \
+	uint8_t *pbx1 = stdlib_ndarray_data( x1 ) + stdlib_ndarray_offset( x1 );   \
+	uint8_t *pbx2 = stdlib_ndarray_data( x2 ) + stdlib_ndarray_offset( x2 );   \
+	uint8_t *pbx3 = stdlib_ndarray_data( x3 ) + stdlib_ndarray_offset( x3 );   \
+	int64_t len = 1;                                                           \
+	int64_t S0 = 1;                                                            \
+	int64_t d0x1 = 0;                                                          \
+	int64_t d0x2 = 0;                                                          \
+	int64_t d0x3 = 0;                                                          \
+	uint8_t *px1;                                                              \
+	uint8_t *px2;                                                              \
+	uint8_t *px3;                                                              \
+	int64_t tmp;                                                               \
+	int64_t s;                                                                 \
+	int64_t i0;                                                                \
+	int64_t j;                                                                 \
+	int64_t k;                                                                 \
+	for ( k = 0; k < ndims; k++ ) {                                            \
+		len *= shape[ k ];                                                     \
+	}                                                                          \
+	/* Resolve the innermost loop dimension... */                              \
+	if ( ndims > 0 ) {                                                         \
+		k = ( isrm ) ? ndims-1 : 0;                                            \
+		S0 = shape[ k ];                                                       \
+		d0x1 = sx1[ k ];                                                       \
+		d0x2 = sx2[ k ];                                                       \
+		d0x3 = sx3[ k ];                                                       \
+	}                                                                          \
+	/* Only iterate when we have lanes to reduce... */                         \
+	if ( len > 0 && N > 0 ) {                                                  \
+		/* Iterate over the non-innermost loop dimensions... */                \
+		for ( j = 0; j < len/S0; j++ ) {                                       \
+			/* Resolve the pointers to the first lane of the current innermost loop... */ \
+			px1 = pbx1;                                                        \
+			px2 = pbx2;                                                        \
+			px3 = pbx3;                                                        \
+			tmp = j;                                                           \
+			if ( isrm ) {                                                      \
+				for ( k = ndims-2; k >= 0; k-- ) {                             \
+					s = tmp % shape[ k ];                                      \
+					tmp /= shape[ k ];                                         \
+					px1 += s * sx1[ k ];                                       \
+					px2 += s * sx2[ k ];                                       \
+					px3 += s * sx3[ k ];                                       \
+				}                                                              \
+			} else {                                                           \
+				for ( k = 1; k < ndims; k++ ) {                                \
+					s = tmp % shape[ k ];                                      \
+					tmp /= shape[ k ];                                         \
+					px1 += s * sx1[ k ];                                       \
+					px2 += s * sx2[ k ];                                       \
+					px3 += s * sx3[ k ];                                       \
+				}                                                              \
+			}                                                                  \
+			/* Iterate over the innermost loop dimension... */                 \
+			for ( i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2, px3 += d0x3 ) { \
+				do
+
+/**
+* Macro containing the epilogue for a loop which visits each one-dimensional strided lane of two input ndarrays and the corresponding element of an output ndarray.
+*
+* @example
+* STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_PREAMBLE {
+*     // Innermost loop body...
+* }
+* STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_EPILOGUE
+*/
+#define STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_EPILOGUE                   \
+				while( 0 );                                                    \
+			}                                                                  \
+		}                                                                      \
+	}
+
+/**
+* Macro for a loop which performs a binary reduction over each one-dimensional strided lane of two input ndarrays by invoking a callback.
+*
+* ## Notes
+*
+* -   Invokes a callback `f` having the signature `tout f( int64_t N, const tin1 *X, int64_t strideX, const tin2 *Y, int64_t strideY )` for each lane, where `X` and `Y` point to the first element of each respective lane and strides are expressed in units of elements (and may be negative).
+* -   Explicitly casts each function `f` invocation result to `tout`.
+* -   Stores the result in an output ndarray via the pointer `px3`.
+*
+* @param tin1  first input type
+* @param tin2  second input type
+* @param tout  output type
+*
+* @example
+* // e.g., dd_d
+* STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_CLBK( double, double, double )
+*/
+#define STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_CLBK( tin1, tin2, tout )   \
+	STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_PREAMBLE {                     \
+		*(tout *)px3 = (tout)f( N, (const tin1 *)px1, sl1, (const tin2 *)px2, sl2 ); \
+	}                                                                          \
+	STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_EPILOGUE
+
+/**
+* Macro for a loop which performs a binary reduction over each one-dimensional strided lane of two input ndarrays by invoking a callback which returns a value of the output type.
+*
+* ## Notes
+*
+* -   Invokes a callback `f` having the signature `tout f( int64_t N, const tin1 *X, int64_t strideX, const tin2 *Y, int64_t strideY )` for each lane, where `X` and `Y` point to the first element of each respective lane and strides are expressed in units of elements (and may be negative).
+* -   Does **not** explicitly cast each function `f` invocation result (e.g., for use with structs, which cannot be cast).
+* -   Stores the result in an output ndarray via the pointer `px3`.
+*
+* @param tin1  first input type
+* @param tin2  second input type
+* @param tout  output type
+*
+* @example
+* #include "stdlib/complex/float64/ctor.h"
+*
+* // e.g., zz_z
+* STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_CLBK_RET_NOCAST( stdlib_complex128_t, stdlib_complex128_t, stdlib_complex128_t )
+*/
+#define STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_CLBK_RET_NOCAST( tin1, tin2, tout ) \
+	STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_PREAMBLE {                     \
+		*(tout *)px3 = f( N, (const tin1 *)px1, sl1, (const tin2 *)px2, sl2 ); \
+	}                                                                          \
+	STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_EPILOGUE
+
+#endif // !STDLIB_NDARRAY_BASE_BINARY_REDUCE_STRIDED1D_MACROS_H
@@ -24,6 +24,7 @@
 
 var loopOrder = require( './../../../base/binary-loop-interchange-order' );
 var blockSize = require( './../../../base/binary-tiling-block-size' );
+var bytesPerElement = require( './../../../base/bytes-per-element' );
 var takeIndexed = require( '@stdlib/array/base/take-indexed' );
 var copyIndexed = require( '@stdlib/array/base/copy-indexed' );
 var zeros = require( '@stdlib/array/base/zeros' );
@@ -217,7 +218,7 @@ function blockedbinary10d( fcn, arrays, views, stridesX, stridesY, strategyX, st
 	z = arrays[ 2 ];
 
 	// Resolve the loop interchange order:
-	o = loopOrder( z.shape, stridesX, stridesY, z.strides );
+	o = loopOrder( z.shape, stridesX, stridesY, z.strides, [ bytesPerElement( x.dtype ), bytesPerElement( y.dtype ), bytesPerElement( z.dtype ) ] );
 	sh = o.sh;
 	sv = [ o.sx, o.sy, o.sz ];
 	for ( k = 3; k < N; k++ ) {
@@ -0,0 +1,125 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/binary_reduce_strided1d/dd_d.h"
+#include "stdlib/ndarray/base/binary_reduce_strided1d/macros.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/**
+* Performs a binary reduction over each one-dimensional strided lane of two input ndarrays and assigns results to elements in an output ndarray.
+*
+* ## Notes
+*
+* -   The input ndarrays are expected to have one more dimension than the output ndarray. The leading dimensions of each input ndarray must match the dimensions of the output ndarray, and the last dimension of each input ndarray is the dimension over which to perform a reduction.
+* -   The callback is provided the number of elements in a lane, a pointer to the first element of each lane, and the lane strides (in units of elements).
+* -   If successful, the functions returns `0`; otherwise, the function returns an error code.
+*
+* @param arrays   array whose first two elements are pointers to input ndarrays and whose last element is a pointer to an output ndarray
+* @param fcn      callback
+* @return         status code
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/dd_d.h"
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+* #include "stdlib/ndarray/dtypes.h"
+* #include "stdlib/ndarray/index_modes.h"
+* #include "stdlib/ndarray/orders.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include <stdint.h>
+* #include <stdlib.h>
+* #include <stdio.h>
+*
+* // Define the ndarray data types:
+* enum STDLIB_NDARRAY_DTYPE xdtype = STDLIB_NDARRAY_FLOAT64;
+* enum STDLIB_NDARRAY_DTYPE ydtype = STDLIB_NDARRAY_FLOAT64;
+* enum STDLIB_NDARRAY_DTYPE zdtype = STDLIB_NDARRAY_FLOAT64;
+*
+* // Create underlying byte arrays:
+* uint8_t xbuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+* uint8_t ybuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+* uint8_t zbuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+*
+* // Define the shapes:
+* int64_t shx[] = { 2, 3 };
+* int64_t shz[] = { 2 };
+*
+* // Define the strides:
+* int64_t sx[] = { 24, 8 };
+* int64_t sy[] = { 24, 8 };
+* int64_t sz[] = { 8 };
+*
+* // Define the offsets:
+* int64_t ox = 0;
+* int64_t oy = 0;
+* int64_t oz = 0;
+*
+* // Define the array order:
+* enum STDLIB_NDARRAY_ORDER order = STDLIB_NDARRAY_ROW_MAJOR;
+*
+* // Specify the index mode:
+* enum STDLIB_NDARRAY_INDEX_MODE imode = STDLIB_NDARRAY_INDEX_ERROR;
+*
+* // Specify the subscript index modes:
+* int8_t submodes[] = { imode };
+* int64_t nsubmodes = 1;
+*
+* // Create a first input ndarray:
+* struct ndarray *x = stdlib_ndarray_allocate( xdtype, xbuf, 2, shx, sx, ox, order, imode, nsubmodes, submodes );
+* if ( x == NULL ) {
+*     fprintf( stderr, "Error allocating memory.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // Create a second input ndarray:
+* struct ndarray *y = stdlib_ndarray_allocate( ydtype, ybuf, 2, shx, sy, oy, order, imode, nsubmodes, submodes );
+* if ( y == NULL ) {
+*     fprintf( stderr, "Error allocating memory.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // Create an output ndarray:
+* struct ndarray *z = stdlib_ndarray_allocate( zdtype, zbuf, 1, shz, sz, oz, order, imode, nsubmodes, submodes );
+* if ( z == NULL ) {
+*     fprintf( stderr, "Error allocating memory.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // Create an array containing the ndarrays:
+* struct ndarray *arrays[] = { x, y, z };
+*
+* // Perform a reduction:
+* int8_t status = stdlib_ndarray_binary_reduce_strided1d_dd_d( arrays, (void *)stdlib_ndarray_binary_reduce_strided1d_ddot );
+* if ( status != 0 ) {
+*     fprintf( stderr, "Error during computation.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // ...
+*
+* // Free allocated memory:
+* stdlib_ndarray_free( x );
+* stdlib_ndarray_free( y );
+* stdlib_ndarray_free( z );
+*/
+int8_t stdlib_ndarray_binary_reduce_strided1d_dd_d( struct ndarray *arrays[], void *fcn ) {
+	typedef double func_type( const int64_t N, const double *X, const int64_t strideX, const double *Y, const int64_t strideY );
+	func_type *f = (func_type *)fcn;
+	STDLIB_NDARRAY_BINARY_REDUCE_STRIDED1D_LOOP_CLBK( double, double, double )
+	return 0;
+}
@@ -0,0 +1,398 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+#include "stdlib/complex/float64/ctor.h"
+#include "stdlib/complex/float32/ctor.h"
+#include <stdint.h>
+
+// Number of independent accumulators used when lanes are contiguous:
+#define M 8
+
+/**
+* Computes the dot product of two double-precision floating-point strided lanes.
+*
+* ## Notes
+*
+* -   `X` and `Y` point to the first element of each respective lane, and strides may be negative.
+* -   When both lanes are contiguous, the function accumulates partial sums in eight independent accumulators. Breaking the serial dependency on a single accumulator allows the compiler to vectorize the loop (i.e., emit SIMD multiply-adds) and hides floating-point latency without requiring non-portable intrinsics or value-unsafe compiler flags.
+*
+* @param N        number of indexed elements
+* @param X        pointer to the first element of the first lane
+* @param strideX  first lane stride (in units of elements)
+* @param Y        pointer to the first element of the second lane
+* @param strideY  second lane stride (in units of elements)
+* @return         dot product
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+*
+* const double x[] = { 1.0, 2.0, 3.0 };
+* const double y[] = { 4.0, 5.0, 6.0 };
+*
+* double v = stdlib_ndarray_binary_reduce_strided1d_ddot( 3, x, 1, y, 1 );
+* // returns 32.0
+*/
+double stdlib_ndarray_binary_reduce_strided1d_ddot( const int64_t N, const double *X, const int64_t strideX, const double *Y, const int64_t strideY ) {
+	double acc[ M ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	double sum;
+	int64_t ix;
+	int64_t iy;
+	int64_t i;
+	int64_t j;
+
+	if ( N <= 0 ) {
+		return 0.0;
+	}
+	if ( strideX == 1 && strideY == 1 ) {
+		for ( i = 0; i <= N-M; i += M ) {
+			for ( j = 0; j < M; j++ ) {
+				acc[ j ] += X[ i+j ] * Y[ i+j ];
+			}
+		}
+		for ( j = 0; i < N; i++, j++ ) {
+			acc[ j ] += X[ i ] * Y[ i ];
+		}
+		return ( ( acc[0]+acc[1] ) + ( acc[2]+acc[3] ) ) + ( ( acc[4]+acc[5] ) + ( acc[6]+acc[7] ) );
+	}
+	sum = 0.0;
+	ix = 0;
+	iy = 0;
+	for ( i = 0; i < N; i++ ) {
+		sum += X[ ix ] * Y[ iy ];
+		ix += strideX;
+		iy += strideY;
+	}
+	return sum;
+}
+
+/**
+* Computes the dot product of two single-precision floating-point strided lanes.
+*
+* ## Notes
+*
+* -   `X` and `Y` point to the first element of each respective lane, and strides may be negative.
+* -   When both lanes are contiguous, the function accumulates partial sums in eight independent accumulators in order to allow the compiler to vectorize the loop.
+*
+* @param N        number of indexed elements
+* @param X        pointer to the first element of the first lane
+* @param strideX  first lane stride (in units of elements)
+* @param Y        pointer to the first element of the second lane
+* @param strideY  second lane stride (in units of elements)
+* @return         dot product
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+*
+* const float x[] = { 1.0f, 2.0f, 3.0f };
+* const float y[] = { 4.0f, 5.0f, 6.0f };
+*
+* float v = stdlib_ndarray_binary_reduce_strided1d_sdot( 3, x, 1, y, 1 );
+* // returns 32.0f
+*/
+float stdlib_ndarray_binary_reduce_strided1d_sdot( const int64_t N, const float *X, const int64_t strideX, const float *Y, const int64_t strideY ) {
+	float acc[ M ] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+	float sum;
+	int64_t ix;
+	int64_t iy;
+	int64_t i;
+	int64_t j;
+
+	if ( N <= 0 ) {
+		return 0.0f;
+	}
+	if ( strideX == 1 && strideY == 1 ) {
+		for ( i = 0; i <= N-M; i += M ) {
+			for ( j = 0; j < M; j++ ) {
+				acc[ j ] += X[ i+j ] * Y[ i+j ];
+			}
+		}
+		for ( j = 0; i < N; i++, j++ ) {
+			acc[ j ] += X[ i ] * Y[ i ];
+		}
+		return ( ( acc[0]+acc[1] ) + ( acc[2]+acc[3] ) ) + ( ( acc[4]+acc[5] ) + ( acc[6]+acc[7] ) );
+	}
+	sum = 0.0f;
+	ix = 0;
+	iy = 0;
+	for ( i = 0; i < N; i++ ) {
+		sum += X[ ix ] * Y[ iy ];
+		ix += strideX;
+		iy += strideY;
+	}
+	return sum;
+}
+
+/**
+* Computes the (unconjugated) dot product of two double-precision complex floating-point strided lanes.
+*
+* ## Notes
+*
+* -   `X` and `Y` point to the first element of each respective lane, and strides may be negative.
+* -   Complex numbers are stored as interleaved real and imaginary components. When both lanes are contiguous, the function accumulates partial sums for two elements per iteration using independent accumulators in order to allow the compiler to vectorize the loop.
+*
+* @param N        number of indexed elements
+* @param X        pointer to the first element of the first lane
+* @param strideX  first lane stride (in units of elements)
+* @param Y        pointer to the first element of the second lane
+* @param strideY  second lane stride (in units of elements)
+* @return         dot product
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+* #include "stdlib/complex/float64/ctor.h"
+*
+* const stdlib_complex128_t x[] = { stdlib_complex128( 1.0, 2.0 ), stdlib_complex128( 3.0, 4.0 ) };
+* const stdlib_complex128_t y[] = { stdlib_complex128( 5.0, 6.0 ), stdlib_complex128( 7.0, 8.0 ) };
+*
+* stdlib_complex128_t v = stdlib_ndarray_binary_reduce_strided1d_zdotu( 2, x, 1, y, 1 );
+* // returns <stdlib_complex128_t>[ -18.0, 68.0 ]
+*/
+stdlib_complex128_t stdlib_ndarray_binary_reduce_strided1d_zdotu( const int64_t N, const stdlib_complex128_t *X, const int64_t strideX, const stdlib_complex128_t *Y, const int64_t strideY ) {
+	const double *x = (const double *)X;
+	const double *y = (const double *)Y;
+	double re[ 2 ] = { 0.0, 0.0 };
+	double im[ 2 ] = { 0.0, 0.0 };
+	int64_t ix;
+	int64_t iy;
+	int64_t sx;
+	int64_t sy;
+	int64_t i;
+	int64_t j;
+
+	if ( N <= 0 ) {
+		return stdlib_complex128( 0.0, 0.0 );
+	}
+	if ( strideX == 1 && strideY == 1 ) {
+		for ( i = 0; i <= N-2; i += 2 ) {
+			for ( j = 0; j < 2; j++ ) {
+				ix = 2 * ( i+j );
+				re[ j ] += ( x[ ix ]*y[ ix ] ) - ( x[ ix+1 ]*y[ ix+1 ] );
+				im[ j ] += ( x[ ix ]*y[ ix+1 ] ) + ( x[ ix+1 ]*y[ ix ] );
+			}
+		}
+		if ( i < N ) {
+			ix = 2 * i;
+			re[ 0 ] += ( x[ ix ]*y[ ix ] ) - ( x[ ix+1 ]*y[ ix+1 ] );
+			im[ 0 ] += ( x[ ix ]*y[ ix+1 ] ) + ( x[ ix+1 ]*y[ ix ] );
+		}
+		return stdlib_complex128( re[ 0 ]+re[ 1 ], im[ 0 ]+im[ 1 ] );
+	}
+	sx = 2 * strideX;
+	sy = 2 * strideY;
+	ix = 0;
+	iy = 0;
+	for ( i = 0; i < N; i++ ) {
+		re[ 0 ] += ( x[ ix ]*y[ iy ] ) - ( x[ ix+1 ]*y[ iy+1 ] );
+		im[ 0 ] += ( x[ ix ]*y[ iy+1 ] ) + ( x[ ix+1 ]*y[ iy ] );
+		ix += sx;
+		iy += sy;
+	}
+	return stdlib_complex128( re[ 0 ], im[ 0 ] );
+}
+
+/**
+* Computes the (unconjugated) dot product of two single-precision complex floating-point strided lanes.
+*
+* ## Notes
+*
+* -   `X` and `Y` point to the first element of each respective lane, and strides may be negative.
+* -   Complex numbers are stored as interleaved real and imaginary components. When both lanes are contiguous, the function accumulates partial sums for four elements per iteration using independent accumulators in order to allow the compiler to vectorize the loop.
+*
+* @param N        number of indexed elements
+* @param X        pointer to the first element of the first lane
+* @param strideX  first lane stride (in units of elements)
+* @param Y        pointer to the first element of the second lane
+* @param strideY  second lane stride (in units of elements)
+* @return         dot product
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+* #include "stdlib/complex/float32/ctor.h"
+*
+* const stdlib_complex64_t x[] = { stdlib_complex64( 1.0f, 2.0f ), stdlib_complex64( 3.0f, 4.0f ) };
+* const stdlib_complex64_t y[] = { stdlib_complex64( 5.0f, 6.0f ), stdlib_complex64( 7.0f, 8.0f ) };
+*
+* stdlib_complex64_t v = stdlib_ndarray_binary_reduce_strided1d_cdotu( 2, x, 1, y, 1 );
+* // returns <stdlib_complex64_t>[ -18.0f, 68.0f ]
+*/
+stdlib_complex64_t stdlib_ndarray_binary_reduce_strided1d_cdotu( const int64_t N, const stdlib_complex64_t *X, const int64_t strideX, const stdlib_complex64_t *Y, const int64_t strideY ) {
+	const float *x = (const float *)X;
+	const float *y = (const float *)Y;
+	float re[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	float im[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	int64_t ix;
+	int64_t iy;
+	int64_t sx;
+	int64_t sy;
+	int64_t i;
+	int64_t j;
+
+	if ( N <= 0 ) {
+		return stdlib_complex64( 0.0f, 0.0f );
+	}
+	if ( strideX == 1 && strideY == 1 ) {
+		for ( i = 0; i <= N-4; i += 4 ) {
+			for ( j = 0; j < 4; j++ ) {
+				ix = 2 * ( i+j );
+				re[ j ] += ( x[ ix ]*y[ ix ] ) - ( x[ ix+1 ]*y[ ix+1 ] );
+				im[ j ] += ( x[ ix ]*y[ ix+1 ] ) + ( x[ ix+1 ]*y[ ix ] );
+			}
+		}
+		for ( j = 0; i < N; i++, j++ ) {
+			ix = 2 * i;
+			re[ j ] += ( x[ ix ]*y[ ix ] ) - ( x[ ix+1 ]*y[ ix+1 ] );
+			im[ j ] += ( x[ ix ]*y[ ix+1 ] ) + ( x[ ix+1 ]*y[ ix ] );
+		}
+		return stdlib_complex64( ( re[0]+re[1] ) + ( re[2]+re[3] ), ( im[0]+im[1] ) + ( im[2]+im[3] ) );
+	}
+	sx = 2 * strideX;
+	sy = 2 * strideY;
+	ix = 0;
+	iy = 0;
+	for ( i = 0; i < N; i++ ) {
+		re[ 0 ] += ( x[ ix ]*y[ iy ] ) - ( x[ ix+1 ]*y[ iy+1 ] );
+		im[ 0 ] += ( x[ ix ]*y[ iy+1 ] ) + ( x[ ix+1 ]*y[ iy ] );
+		ix += sx;
+		iy += sy;
+	}
+	return stdlib_complex64( re[ 0 ], im[ 0 ] );
+}
+
+/**
+* Computes the squared Euclidean distance between two double-precision floating-point strided lanes.
+*
+* ## Notes
+*
+* -   `X` and `Y` point to the first element of each respective lane, and strides may be negative.
+* -   When both lanes are contiguous, the function accumulates partial sums in eight independent accumulators in order to allow the compiler to vectorize the loop.
+*
+* @param N        number of indexed elements
+* @param X        pointer to the first element of the first lane
+* @param strideX  first lane stride (in units of elements)
+* @param Y        pointer to the first element of the second lane
+* @param strideY  second lane stride (in units of elements)
+* @return         squared Euclidean distance
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+*
+* const double x[] = { 1.0, 2.0, 3.0 };
+* const double y[] = { 4.0, 6.0, 3.0 };
+*
+* double v = stdlib_ndarray_binary_reduce_strided1d_dsqdist( 3, x, 1, y, 1 );
+* // returns 25.0
+*/
+double stdlib_ndarray_binary_reduce_strided1d_dsqdist( const int64_t N, const double *X, const int64_t strideX, const double *Y, const int64_t strideY ) {
+	double acc[ M ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	double sum;
+	double d;
+	int64_t ix;
+	int64_t iy;
+	int64_t i;
+	int64_t j;
+
+	if ( N <= 0 ) {
+		return 0.0;
+	}
+	if ( strideX == 1 && strideY == 1 ) {
+		for ( i = 0; i <= N-M; i += M ) {
+			for ( j = 0; j < M; j++ ) {
+				d = X[ i+j ] - Y[ i+j ];
+				acc[ j ] += d * d;
+			}
+		}
+		for ( j = 0; i < N; i++, j++ ) {
+			d = X[ i ] - Y[ i ];
+			acc[ j ] += d * d;
+		}
+		return ( ( acc[0]+acc[1] ) + ( acc[2]+acc[3] ) ) + ( ( acc[4]+acc[5] ) + ( acc[6]+acc[7] ) );
+	}
+	sum = 0.0;
+	ix = 0;
+	iy = 0;
+	for ( i = 0; i < N; i++ ) {
+		d = X[ ix ] - Y[ iy ];
+		sum += d * d;
+		ix += strideX;
+		iy += strideY;
+	}
+	return sum;
+}
+
+/**
+* Computes the squared Euclidean distance between two single-precision floating-point strided lanes.
+*
+* ## Notes
+*
+* -   `X` and `Y` point to the first element of each respective lane, and strides may be negative.
+* -   When both lanes are contiguous, the function accumulates partial sums in eight independent accumulators in order to allow the compiler to vectorize the loop.
+*
+* @param N        number of indexed elements
+* @param X        pointer to the first element of the first lane
+* @param strideX  first lane stride (in units of elements)
+* @param Y        pointer to the first element of the second lane
+* @param strideY  second lane stride (in units of elements)
+* @return         squared Euclidean distance
+*
+* @example
+* #include "stdlib/ndarray/base/binary_reduce_strided1d/kernels.h"
+*
+* const float x[] = { 1.0f, 2.0f, 3.0f };
+* const float y[] = { 4.0f, 6.0f, 3.0f };
+*
+* float v = stdlib_ndarray_binary_reduce_strided1d_ssqdist( 3, x, 1, y, 1 );
+* // returns 25.0f
+*/
+float stdlib_ndarray_binary_reduce_strided1d_ssqdist( const int64_t N, const float *X, const int64_t strideX, const float *Y, const int64_t strideY ) {
+	float acc[ M ] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+	float sum;
+	float d;
+	int64_t ix;
+	int64_t iy;
+	int64_t i;
+	int64_t j;
+
+	if ( N <= 0 ) {
+		return 0.0f;
+	}
+	if ( strideX == 1 && strideY == 1 ) {
+		for ( i = 0; i <= N-M; i += M ) {
+			for ( j = 0; j < M; j++ ) {
+				d = X[ i+j ] - Y[ i+j ];
+				acc[ j ] += d * d;
+			}
+		}
+		for ( j = 0; i < N; i++, j++ ) {
+			d = X[ i ] - Y[ i ];
+			acc[ j ] += d * d;
+		}
+		return ( ( acc[0]+acc[1] ) + ( acc[2]+acc[3] ) ) + ( ( acc[4]+acc[5] ) + ( acc[6]+acc[7] ) );
+	}
+	sum = 0.0f;
+	ix = 0;
+	iy = 0;
+	for ( i = 0; i < N; i++ ) {
+		d = X[ ix ] - Y[ iy ];
+		sum += d * d;
+		ix += strideX;
+		iy += strideY;
+	}
+	return sum;
+}
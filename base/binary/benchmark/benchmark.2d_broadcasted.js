@@ -0,0 +1,157 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var discreteUniform = require( '@stdlib/random/array/discrete-uniform' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var sqrt = require( '@stdlib/math/base/special/sqrt' );
+var floor = require( '@stdlib/math/base/special/floor' );
+var sub = require( '@stdlib/number/float64/base/sub' );
+var filledarray = require( '@stdlib/array/filled' );
+var shape2strides = require( './../../../base/shape2strides' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var binary = require( './../lib' );
+
+
+// VARIABLES //
+
+var TYPES = [
+	'float64'
+];
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function which subtracts a broadcasted column vector from each row of a row-major matrix.
+*
+* @private
+* @param {PositiveInteger} len - ndarray length
+* @param {NonNegativeIntegerArray} shape - ndarray shape
+* @param {string} xtype - input ndarray data type
+* @param {string} ztype - output ndarray data type
+* @returns {Function} benchmark function
+*/
+function createBenchmark( len, shape, xtype, ztype ) {
+	var x;
+	var y;
+	var z;
+
+	x = {
+		'dtype': xtype,
+		'data': discreteUniform( len, -100, 100, {
+			'dtype': xtype
+		}),
+		'shape': shape,
+		'strides': shape2strides( shape, 'row-major' ),
+		'offset': 0,
+		'order': 'row-major'
+	};
+	y = {
+		'dtype': xtype,
+		'data': discreteUniform( shape[ 0 ], -100, 100, {
+			'dtype': xtype
+		}),
+		'shape': shape,
+		'strides': [ 1, 0 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	z = {
+		'dtype': ztype,
+		'data': filledarray( 0.0, len, ztype ),
+		'shape': shape,
+		'strides': shape2strides( shape, 'row-major' ),
+		'offset': 0,
+		'order': 'row-major'
+	};
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			binary( [ x, y, z ], sub );
+			if ( isnan( z.data[ i%len ] ) ) {
+				b.fail( 'should not return NaN' );
+			}
+		}
+		b.toc();
+		if ( isnan( z.data[ i%len ] ) ) {
+			b.fail( 'should not return NaN' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var sh;
+	var t1;
+	var t2;
+	var f;
+	var i;
+	var j;
+
+	min = 1; // 10^min
+	max = 6; // 10^max
+
+	for ( j = 0; j < TYPES.length; j++ ) {
+		t1 = TYPES[ j ];
+		t2 = TYPES[ j ];
+		for ( i = min; i <= max; i++ ) {
+			len = pow( 10, i );
+
+			sh = [ 2, len/2 ];
+			f = createBenchmark( len, sh, t1, t2 );
+			bench( format( '%s::broadcasted:ndims=%d,len=%d,shape=[%s],ystrides=[1,0],xtype=%s,ztype=%s', pkg, sh.length, len, sh.join( ',' ), t1, t2 ), f );
+
+			len = floor( sqrt( len ) );
+			sh = [ len, len ];
+			len *= len;
+			f = createBenchmark( len, sh, t1, t2 );
+			bench( format( '%s::broadcasted:ndims=%d,len=%d,shape=[%s],ystrides=[1,0],xtype=%s,ztype=%s', pkg, sh.length, len, sh.join( ',' ), t1, t2 ), f );
+		}
+	}
+}
+
+main();
@@ -113,6 +113,8 @@ function binary1d( x, y, z, fcn ) {
 	var dy0;
 	var dz0;
 	var S0;
+	var vx;
+	var vy;
 	var ix;
 	var iy;
 	var iz;
@@ -136,6 +138,34 @@ function binary1d( x, y, z, fcn ) {
 	ybuf = y.data;
 	zbuf = z.data;
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx0 === 0 && dy0 === 0 ) {
+		vx = xbuf[ ix ];
+		vy = ybuf[ iy ];
+		for ( i0 = 0; i0 < S0; i0++ ) {
+			zbuf[ iz ] = fcn( vx, vy );
+			iz += dz0;
+		}
+		return;
+	}
+	if ( dx0 === 0 ) {
+		vx = xbuf[ ix ];
+		for ( i0 = 0; i0 < S0; i0++ ) {
+			zbuf[ iz ] = fcn( vx, ybuf[ iy ] );
+			iy += dy0;
+			iz += dz0;
+		}
+		return;
+	}
+	if ( dy0 === 0 ) {
+		vy = ybuf[ iy ];
+		for ( i0 = 0; i0 < S0; i0++ ) {
+			zbuf[ iz ] = fcn( xbuf[ ix ], vy );
+			ix += dx0;
+			iz += dz0;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i0 = 0; i0 < S0; i0++ ) {
 		zbuf[ iz ] = fcn( xbuf[ ix ], ybuf[ iy ] );
@@ -124,6 +124,8 @@ function binary1d( x, y, z, fcn ) {
 	var dy0;
 	var dz0;
 	var S0;
+	var vx;
+	var vy;
 	var ix;
 	var iy;
 	var iz;
@@ -152,6 +154,34 @@ function binary1d( x, y, z, fcn ) {
 	yget = y.accessors[ 0 ];
 	zset = z.accessors[ 1 ];
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx0 === 0 && dy0 === 0 ) {
+		vx = xget( xbuf, ix );
+		vy = yget( ybuf, iy );
+		for ( i0 = 0; i0 < S0; i0++ ) {
+			zset( zbuf, iz, fcn( vx, vy ) );
+			iz += dz0;
+		}
+		return;
+	}
+	if ( dx0 === 0 ) {
+		vx = xget( xbuf, ix );
+		for ( i0 = 0; i0 < S0; i0++ ) {
+			zset( zbuf, iz, fcn( vx, yget( ybuf, iy ) ) );
+			iy += dy0;
+			iz += dz0;
+		}
+		return;
+	}
+	if ( dy0 === 0 ) {
+		vy = yget( ybuf, iy );
+		for ( i0 = 0; i0 < S0; i0++ ) {
+			zset( zbuf, iz, fcn( xget( xbuf, ix ), vy ) );
+			ix += dx0;
+			iz += dz0;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i0 = 0; i0 < S0; i0++ ) {
 		zset( zbuf, iz, fcn( xget( xbuf, ix ), yget( ybuf, iy ) ) );
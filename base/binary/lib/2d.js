@@ -119,6 +119,8 @@ function binary2d( x, y, z, isRowMajor, fcn ) {
 	var sh;
 	var S0;
 	var S1;
+	var vx;
+	var vy;
 	var sx;
 	var sy;
 	var sz;
@@ -166,6 +168,49 @@ function binary2d( x, y, z, isRowMajor, fcn ) {
 	ybuf = y.data;
 	zbuf = z.data;
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx0 === 0 && dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xbuf[ ix ];
+			vy = ybuf[ iy ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				zbuf[ iz ] = fcn( vx, vy );
+				iz += dz0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+		}
+		return;
+	}
+	if ( dx0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xbuf[ ix ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				zbuf[ iz ] = fcn( vx, ybuf[ iy ] );
+				iy += dy0;
+				iz += dz0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+		}
+		return;
+	}
+	if ( dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vy = ybuf[ iy ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				zbuf[ iz ] = fcn( xbuf[ ix ], vy );
+				ix += dx0;
+				iz += dz0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i1 = 0; i1 < S1; i1++ ) {
 		for ( i0 = 0; i0 < S0; i0++ ) {
@@ -130,6 +130,8 @@ function binary2d( x, y, z, isRowMajor, fcn ) {
 	var sh;
 	var S0;
 	var S1;
+	var vx;
+	var vy;
 	var sx;
 	var sy;
 	var sz;
@@ -182,6 +184,49 @@ function binary2d( x, y, z, isRowMajor, fcn ) {
 	yget = y.accessors[ 0 ];
 	zset = z.accessors[ 1 ];
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx0 === 0 && dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xget( xbuf, ix );
+			vy = yget( ybuf, iy );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				zset( zbuf, iz, fcn( vx, vy ) );
+				iz += dz0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+		}
+		return;
+	}
+	if ( dx0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xget( xbuf, ix );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				zset( zbuf, iz, fcn( vx, yget( ybuf, iy ) ) );
+				iy += dy0;
+				iz += dz0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+		}
+		return;
+	}
+	if ( dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vy = yget( ybuf, iy );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				zset( zbuf, iz, fcn( xget( xbuf, ix ), vy ) );
+				ix += dx0;
+				iz += dz0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i1 = 0; i1 < S1; i1++ ) {
 		for ( i0 = 0; i0 < S0; i0++ ) {
@@ -21,9 +21,10 @@
 // MODULES //
 
 var iterationOrder = require( './../../../base/iteration-order' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
 var minmaxViewBufferIndex = require( './../../../base/minmax-view-buffer-index' );
 var ndarray2object = require( './../../../base/ndarraylike2object' );
-var strides2order = require( './../../../base/strides2order' );
+var sharedStrides2order = require( './../../../base/shared-strides2order' );
 var anyIsEntryIn = require( '@stdlib/array/base/any-is-entry-in' );
 var format = require( '@stdlib/string/format' );
 var blockedaccessorbinary2d = require( './2d_blocked_accessors.js' );
@@ -218,7 +219,7 @@ function binary( arrays, fcn ) { // eslint-disable-line max-statements
 	var ox;
 	var oy;
 	var oz;
-	var ns;
+	var o;
 	var x;
 	var y;
 	var z;
@@ -247,7 +248,6 @@ function binary( arrays, fcn ) { // eslint-disable-line max-statements
 	}
 	// Verify that the input and output arrays have the same dimensions...
 	len = 1; // number of elements
-	ns = 0;  // number of singleton dimensions
 	for ( i = 0; i < ndims; i++ ) {
 		d = shx[ i ];
 		if ( d !== shy[ i ] || d !== shz[ i ] ) {
@@ -255,16 +255,25 @@ function binary( arrays, fcn ) { // eslint-disable-line max-statements
 		}
 		// Note that, if one of the dimensions is `0`, the length will be `0`...
 		len *= d;
-
-		// Check whether the current dimension is a singleton dimension...
-		if ( d === 1 ) {
-			ns += 1;
-		}
 	}
 	// Check whether we were provided empty ndarrays...
 	if ( len === 0 ) {
 		return;
 	}
+	// Merge adjacent dimensions which are jointly contiguous and remove singleton dimensions (e.g., ndims=3, shape=[100,3,1000], where only the last two dimensions are contiguous, becomes ndims=2, shape=[100,3000]) so that we can use lower-dimensional kernels...
+	if ( ndims > 1 ) {
+		o = coalesce( shx, [ x.strides, y.strides, z.strides ] );
+		shx = o[ 0 ];
+		shy = shx;
+		shz = shx;
+		ndims = shx.length;
+		x.shape = shx;
+		y.shape = shy;
+		z.shape = shz;
+		x.strides = o[ 1 ];
+		y.strides = o[ 2 ];
+		z.strides = o[ 3 ];
+	}
 	// Determine whether the ndarrays are one-dimensional and thus readily translate to one-dimensional strided arrays...
 	if ( ndims === 1 ) {
 		if ( hasAccessors( x, y, z ) ) {
@@ -276,32 +285,13 @@ function binary( arrays, fcn ) { // eslint-disable-line max-statements
 	sy = y.strides;
 	sz = z.strides;
 
-	// Determine whether the ndarrays have only **one** non-singleton dimension (e.g., ndims=4, shape=[10,1,1,1]) so that we can treat the ndarrays as being equivalent to one-dimensional strided arrays...
-	if ( ns === ndims-1 ) {
-		// Get the index of the non-singleton dimension...
-		for ( i = 0; i < ndims; i++ ) {
-			if ( shx[ i ] !== 1 ) {
-				break;
-			}
-		}
-		x.shape = [ shx[i] ];
-		y.shape = x.shape;
-		z.shape = x.shape;
-		x.strides = [ sx[i] ];
-		y.strides = [ sy[i] ];
-		z.strides = [ sz[i] ];
-		if ( hasAccessors( x, y, z ) ) {
-			return ACCESSOR_BINARY[ 1 ]( x, y, z, fcn );
-		}
-		return BINARY[ 1 ]( x, y, z, fcn );
-	}
 	iox = iterationOrder( sx ); // +/-1
 	ioy = iterationOrder( sy ); // +/-1
 	ioz = iterationOrder( sz ); // +/-1
 
 	// Determine whether we can avoid blocked iteration...
-	ord = strides2order( sx );
-	if ( iox !== 0 && ioy !== 0 && ioz !== 0 && ord === strides2order( sy ) && ord === strides2order( sz ) ) { // eslint-disable-line max-len
+	ord = sharedStrides2order( [ sx, sy, sz ] );
+	if ( iox !== 0 && ioy !== 0 && ioz !== 0 && ord !== 0 ) {
 		// Determine the minimum and maximum linear indices which are accessible by the array views:
 		xmmv = minmaxViewBufferIndex( shx, sx, x.offset );
 		ymmv = minmaxViewBufferIndex( shy, sy, y.offset );
@@ -104,3 +104,69 @@ tape( 'the function applies a binary callback to indexed elements of two 1-dimen
 	t.strictEqual( isSameComplex128Array( getData( y ), expected ), true, 'returns expected value' );
 	t.end();
 });
+
+tape( 'the function applies a binary callback to indexed elements of two 1-dimensional ndarrays (broadcasted)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( [ 10.0 ] ), [ 4 ], [ 0 ], 0, 'row-major' );
+	z = ndarray( 'float64', zeros( 4, 'float64' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], add );
+
+	expected = new Float64Array([
+		11.0,
+		12.0,
+		13.0,
+		14.0
+	]);
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+
+	z = ndarray( 'float64', zeros( 4, 'float64' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	binary( [ y, x, z ], add );
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0 ] ), [ 4 ], [ 0 ], 0, 'row-major' );
+	z = ndarray( 'float64', zeros( 4, 'float64' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], add );
+
+	expected = new Float64Array([
+		11.0,
+		11.0,
+		11.0,
+		11.0
+	]);
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function applies a binary callback to indexed elements of two 1-dimensional ndarrays (broadcasted, accessors)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+
+	x = ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'complex128', new Complex128Array( [ 10.0, 20.0 ] ), [ 4 ], [ 0 ], 0, 'row-major' );
+	z = ndarray( 'complex128', zeros( 4, 'complex128' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], zadd );
+
+	expected = new Complex128Array([
+		11.0,
+		22.0,
+		13.0,
+		24.0,
+		15.0,
+		26.0,
+		17.0,
+		28.0
+	]);
+	t.strictEqual( isSameComplex128Array( getData( z ), expected ), true, 'returns expected value' );
+	t.end();
+});
@@ -1054,3 +1054,93 @@ tape( 'the function applies a binary callback to indexed elements of two 2-dimen
 	t.strictEqual( isSameComplex128Array( getData( y ), expected ), true, 'returns expected value' );
 	t.end();
 });
+
+tape( 'the function applies a binary callback to indexed elements of two 2-dimensional ndarrays (row-major, broadcasted)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	// Broadcasted column vector:
+	y = ndarray( 'float64', new Float64Array( [ 10.0, 20.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	z = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], add );
+
+	expected = new Float64Array( [ 11.0, 12.0, 13.0, 24.0, 25.0, 26.0 ] );
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+
+	z = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	binary( [ y, x, z ], add );
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+
+	// Broadcasted row vector:
+	y = ndarray( 'float64', new Float64Array( [ 10.0, 20.0, 30.0 ] ), [ 2, 3 ], [ 0, 1 ], 0, 'row-major' );
+	z = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], add );
+
+	expected = new Float64Array( [ 11.0, 22.0, 33.0, 14.0, 25.0, 36.0 ] );
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+
+	// Two broadcasted column vectors:
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( [ 10.0, 20.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	z = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], add );
+
+	expected = new Float64Array( [ 11.0, 11.0, 11.0, 22.0, 22.0, 22.0 ] );
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function applies a binary callback to indexed elements of two 2-dimensional ndarrays (row-major, broadcasted, accessors)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+
+	x = ndarray( 'complex128', new Complex128Array( oneTo( 12, 'float64' ) ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = ndarray( 'complex128', new Complex128Array( [ 10.0, 10.0, 20.0, 20.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	z = ndarray( 'complex128', zeros( 6, 'complex128' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	binary( [ x, y, z ], zadd );
+
+	expected = new Complex128Array([
+		11.0,
+		12.0,
+		13.0,
+		14.0,
+		15.0,
+		16.0,
+		27.0,
+		28.0,
+		29.0,
+		30.0,
+		31.0,
+		32.0
+	]);
+	t.strictEqual( isSameComplex128Array( getData( z ), expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function applies a binary callback to indexed elements of two 2-dimensional ndarrays (column-major, broadcasted)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 4.0, 2.0, 5.0, 3.0, 6.0 ] ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+	y = ndarray( 'float64', new Float64Array( [ 10.0, 20.0, 30.0 ] ), [ 2, 3 ], [ 0, 1 ], 0, 'column-major' );
+	z = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+
+	binary( [ x, y, z ], add );
+
+	expected = new Float64Array( [ 11.0, 14.0, 22.0, 25.0, 33.0, 36.0 ] );
+	t.strictEqual( isSameFloat64Array( getData( z ), expected ), true, 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,141 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var BooleanArray = require( '@stdlib/array/bool' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var format = require( '@stdlib/string/format' );
+var ndarray = require( './../../../base/ctor' );
+var pkg = require( './../package.json' ).name;
+var bitmask = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {PositiveInteger} len - array length
+* @returns {Function} benchmark function
+*/
+function createBenchmark( len ) {
+	var mask;
+	var buf;
+	var x;
+	var i;
+
+	buf = new BooleanArray( len );
+	for ( i = 0; i < len; i += 3 ) {
+		buf.set( true, i );
+	}
+	x = ndarray( 'bool', buf, [ len ], [ 1 ], 0, 'row-major' );
+	mask = bitmask.from( x );
+
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var out;
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			mask.iset( i%len, true );
+			out = mask.count();
+			if ( isnan( out ) ) {
+				b.fail( 'should not return NaN' );
+			}
+		}
+		b.toc();
+		if ( isnan( out ) ) {
+			b.fail( 'should not return NaN' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+/**
+* Benchmarks packing a boolean ndarray into a bitmask.
+*
+* @private
+* @param {Benchmark} b - benchmark instance
+*/
+function benchmarkFrom( b ) {
+	var out;
+	var buf;
+	var x;
+	var i;
+
+	buf = new BooleanArray( 1000 );
+	x = ndarray( 'bool', buf, [ 10, 100 ], [ 100, 1 ], 0, 'row-major' );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		buf.set( true, i%1000 );
+		out = bitmask.from( x );
+		if ( out.length !== 1000 ) {
+			b.fail( 'should have length 1000' );
+		}
+	}
+	b.toc();
+	if ( out.length !== 1000 ) {
+		b.fail( 'should have length 1000' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var f;
+	var i;
+
+	min = 1; // 10^min
+	max = 6; // 10^max
+
+	for ( i = min; i <= max; i++ ) {
+		len = pow( 10, i );
+		f = createBenchmark( len );
+		bench( format( '%s:count:len=%d', pkg, len ), f );
+	}
+	bench( format( '%s:from', pkg ), benchmarkFrom );
+}
+
+main();
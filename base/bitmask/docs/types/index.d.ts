@@ -0,0 +1,244 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, typedndarray } from '@stdlib/types/ndarray';
+
+/**
+* Bit-packed boolean array.
+*/
+declare class Bitmask {
+	/**
+	* Bit-packed boolean array constructor.
+	*
+	* @param shape - array shape
+	* @returns bitmask instance
+	*
+	* @example
+	* var mask = new Bitmask( [ 2, 3 ] );
+	* // returns <bitmask>
+	*/
+	constructor( shape: ArrayLike<number> );
+
+	/**
+	* Underlying array of 32-bit words.
+	*/
+	readonly data: Uint32Array;
+
+	/**
+	* Number of array elements.
+	*/
+	readonly length: number;
+
+	/**
+	* Shape of the array.
+	*/
+	readonly shape: Array<number>;
+
+	/**
+	* Returns an array element located at a specified linear index.
+	*
+	* @param idx - linear index
+	* @returns array element
+	*/
+	iget( idx: number ): boolean;
+
+	/**
+	* Sets an array element located at a specified linear index.
+	*
+	* @param idx - linear index
+	* @param v - value to set
+	* @returns bitmask instance
+	*/
+	iset( idx: number, v: boolean ): Bitmask;
+
+	/**
+	* Returns the number of elements which are `true`.
+	*
+	* @returns number of set elements
+	*/
+	count(): number;
+
+	/**
+	* Tests whether at least one element is `true`.
+	*
+	* @returns boolean indicating whether at least one element is `true`
+	*/
+	any(): boolean;
+
+	/**
+	* Tests whether every element is `true`.
+	*
+	* @returns boolean indicating whether every element is `true`
+	*/
+	every(): boolean;
+
+	/**
+	* Tests whether at least `n` elements are `true`.
+	*
+	* @param n - minimum number of `true` elements
+	* @returns boolean indicating whether at least `n` elements are `true`
+	*/
+	some( n: number ): boolean;
+
+	/**
+	* Returns the linear index of the first element which is `true`.
+	*
+	* ## Notes
+	*
+	* -   If no element is `true`, the method returns `-1`.
+	*
+	* @returns linear index
+	*/
+	find(): number;
+
+	/**
+	* Computes the logical AND of two bitmasks and assigns the result to the `this` instance.
+	*
+	* @param y - second bitmask
+	* @returns bitmask instance
+	*/
+	and( y: Bitmask ): Bitmask;
+
+	/**
+	* Computes the logical OR of two bitmasks and assigns the result to the `this` instance.
+	*
+	* @param y - second bitmask
+	* @returns bitmask instance
+	*/
+	or( y: Bitmask ): Bitmask;
+
+	/**
+	* Computes the logical XOR of two bitmasks and assigns the result to the `this` instance.
+	*
+	* @param y - second bitmask
+	* @returns bitmask instance
+	*/
+	xor( y: Bitmask ): Bitmask;
+
+	/**
+	* Computes the logical NOT of a bitmask in-place.
+	*
+	* @returns bitmask instance
+	*/
+	not(): Bitmask;
+
+	/**
+	* Returns a one-dimensional ndarray containing the elements of a provided ndarray for which corresponding bitmask elements are `true`.
+	*
+	* @param x - input ndarray
+	* @returns output ndarray
+	*/
+	select<T extends ndarray = ndarray>( x: T ): T;
+
+	/**
+	* Converts a bitmask to a row-major boolean ndarray.
+	*
+	* @returns boolean ndarray
+	*/
+	toNdarray(): typedndarray<boolean>;
+}
+
+/**
+* Interface defining a bitmask constructor which is both "newable" and "callable".
+*/
+interface BitmaskConstructor {
+	/**
+	* Bit-packed boolean array constructor.
+	*
+	* @param shape - array shape
+	* @returns bitmask instance
+	*
+	* @example
+	* var mask = new bitmask( [ 2, 3 ] );
+	* // returns <bitmask>
+	*
+	* mask.iset( 4, true );
+	*
+	* var n = mask.count();
+	* // returns 1
+	*/
+	new( shape: ArrayLike<number> ): Bitmask;
+
+	/**
+	* Bit-packed boolean array constructor.
+	*
+	* @param shape - array shape
+	* @returns bitmask instance
+	*
+	* @example
+	* var mask = bitmask( [ 2, 3 ] );
+	* // returns <bitmask>
+	*
+	* mask.iset( 4, true );
+	*
+	* var n = mask.count();
+	* // returns 1
+	*/
+	( shape: ArrayLike<number> ): Bitmask;
+
+	/**
+	* Packs the elements of an ndarray into a bitmask.
+	*
+	* ## Notes
+	*
+	* -   Elements are packed in row-major (C-style) linear index order and are converted to booleans according to their truthiness.
+	*
+	* @param x - input ndarray
+	* @returns bitmask
+	*
+	* @example
+	* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+	* var BooleanArray = require( '@stdlib/array/bool' );
+	*
+	* var buf = new BooleanArray( [ true, false, false, true ] );
+	* var x = ndarray( 'bool', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	*
+	* var mask = bitmask.from( x );
+	* // returns <bitmask>
+	*
+	* var n = mask.count();
+	* // returns 2
+	*/
+	from( x: ndarray ): Bitmask;
+}
+
+/**
+* Bit-packed boolean array constructor.
+*
+* @param shape - array shape
+* @returns bitmask instance
+*
+* @example
+* var mask = bitmask( [ 2, 3 ] );
+* // returns <bitmask>
+*
+* mask.iset( 4, true );
+*
+* var n = mask.count();
+* // returns 1
+*/
+declare var bitmask: BitmaskConstructor;
+
+
+// EXPORTS //
+
+export = bitmask;
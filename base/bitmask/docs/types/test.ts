@@ -0,0 +1,90 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import zeros = require( './../../../../zeros' );
+import bitmask = require( './index' );
+
+
+// TESTS //
+
+// The function returns a bitmask...
+{
+	bitmask( [ 2, 3 ] ); // $ExpectType Bitmask
+	new bitmask( [ 2, 3 ] ); // $ExpectType Bitmask
+}
+
+// The compiler throws an error if the function is not provided an array-like object of numbers...
+{
+	bitmask( '5' ); // $ExpectError
+	bitmask( 5 ); // $ExpectError
+	bitmask( true ); // $ExpectError
+	bitmask( false ); // $ExpectError
+	bitmask( null ); // $ExpectError
+	bitmask( {} ); // $ExpectError
+	bitmask( [ '5' ] ); // $ExpectError
+	bitmask( ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	bitmask(); // $ExpectError
+	bitmask( [ 2, 3 ], {} ); // $ExpectError
+}
+
+// Attached to the main export is a `from` method which returns a bitmask...
+{
+	const x = zeros( [ 2, 2 ], { 'dtype': 'bool' } );
+
+	bitmask.from( x ); // $ExpectType Bitmask
+}
+
+// The compiler throws an error if the `from` method is not provided an ndarray...
+{
+	bitmask.from( '5' ); // $ExpectError
+	bitmask.from( 5 ); // $ExpectError
+	bitmask.from( true ); // $ExpectError
+	bitmask.from( null ); // $ExpectError
+	bitmask.from( {} ); // $ExpectError
+	bitmask.from( ( x: number ): number => x ); // $ExpectError
+}
+
+// A bitmask has methods for computing word-wise reductions...
+{
+	const mask = bitmask( [ 2, 3 ] );
+
+	mask.count(); // $ExpectType number
+	mask.any(); // $ExpectType boolean
+	mask.every(); // $ExpectType boolean
+	mask.some( 2 ); // $ExpectType boolean
+	mask.find(); // $ExpectType number
+}
+
+// A bitmask has methods for computing word-wise logical operations...
+{
+	const x = bitmask( [ 2, 3 ] );
+	const y = bitmask( [ 2, 3 ] );
+
+	x.and( y ); // $ExpectType Bitmask
+	x.or( y ); // $ExpectType Bitmask
+	x.xor( y ); // $ExpectType Bitmask
+	x.not(); // $ExpectType Bitmask
+
+	x.and( '5' ); // $ExpectError
+	x.or( 5 ); // $ExpectError
+	x.xor( {} ); // $ExpectError
+}
@@ -0,0 +1,42 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var bernoulli = require( '@stdlib/random/array/bernoulli' );
+var BooleanArray = require( '@stdlib/array/bool' );
+var ndarray = require( './../../../base/ctor' );
+var bitmask = require( './../lib' );
+
+// Create a boolean ndarray:
+var buf = new BooleanArray( bernoulli( 100, 0.2 ) );
+var x = ndarray( 'bool', buf, [ 10, 10 ], [ 10, 1 ], 0, 'row-major' );
+
+// Pack the ndarray into a bitmask:
+var mask = bitmask.from( x );
+console.log( mask.data );
+
+// Compute summary statistics:
+console.log( 'Count: %d', mask.count() );
+console.log( 'First: %d', mask.find() );
+console.log( 'Any: %s', mask.any() );
+console.log( 'Every: %s', mask.every() );
+
+// Invert the mask and convert back to a boolean ndarray:
+var y = mask.not().toNdarray();
+console.log( y.get( 0, 0 ) === !x.get( 0, 0 ) );
@@ -1,7 +1,7 @@
 /**
 * @license Apache-2.0
 *
-* Copyright (c) 2023 The Stdlib Authors.
+* Copyright (c) 2026 The Stdlib Authors.
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -16,14 +16,31 @@
 * limitations under the License.
 */
 
-#ifndef STDLIB_NDARRAY_BASE_ASSIGN_INTERNAL_SORT2INS_H
-#define STDLIB_NDARRAY_BASE_ASSIGN_INTERNAL_SORT2INS_H
+'use strict';
 
-#include <stdint.h>
+// MAIN //
 
 /**
-* Simultaneously sorts two arrays based on the sort order of the first array using insertion sort.
+* Tests whether at least one element is `true`.
+*
+* @private
+* @returns {boolean} boolean indicating whether at least one element is `true`
 */
-void stdlib_ndarray_base_assign_internal_sort2ins( const int64_t n, int64_t *x, int64_t *y );
+function any() {
+	/* eslint-disable no-invalid-this */
+	var buf;
+	var i;
+
+	buf = this._data;
+	for ( i = 0; i < buf.length; i++ ) {
+		if ( buf[ i ] !== 0 ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// EXPORTS //
 
-#endif // !STDLIB_NDARRAY_BASE_ASSIGN_INTERNAL_SORT2INS_H
+module.exports = any;
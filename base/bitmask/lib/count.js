@@ -0,0 +1,51 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var popcount = require( './popcount.js' );
+
+
+// MAIN //
+
+/**
+* Returns the number of elements which are `true`.
+*
+* @private
+* @returns {NonNegativeInteger} number of set elements
+*/
+function count() {
+	/* eslint-disable no-invalid-this */
+	var buf;
+	var n;
+	var i;
+
+	buf = this._data;
+	n = 0;
+	for ( i = 0; i < buf.length; i++ ) {
+		n += popcount( buf[ i ] );
+	}
+	return n;
+}
+
+
+// EXPORTS //
+
+module.exports = count;
@@ -0,0 +1,56 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tailMask = require( './tail_mask.js' );
+
+
+// MAIN //
+
+/**
+* Tests whether every element is `true`.
+*
+* @private
+* @returns {boolean} boolean indicating whether every element is `true`
+*/
+function every() {
+	/* eslint-disable no-invalid-this */
+	var buf;
+	var M;
+	var i;
+
+	buf = this._data;
+	M = buf.length;
+	if ( M === 0 ) {
+		return true;
+	}
+	for ( i = 0; i < M-1; i++ ) {
+		if ( buf[ i ] !== 0xffffffff ) {
+			return false;
+		}
+	}
+	return ( buf[ M-1 ] === tailMask( this._length ) );
+}
+
+
+// EXPORTS //
+
+module.exports = every;
@@ -0,0 +1,55 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MAIN //
+
+/**
+* Returns the linear index of the first element which is `true`.
+*
+* @private
+* @returns {integer} linear index
+*/
+function find() {
+	/* eslint-disable no-invalid-this */
+	var buf;
+	var w;
+	var i;
+	var j;
+
+	buf = this._data;
+	for ( i = 0; i < buf.length; i++ ) {
+		w = buf[ i ];
+
+		// Skip words which do not contain any set bits...
+		if ( w === 0 ) {
+			continue;
+		}
+		for ( j = 0; ( w & 1 ) === 0; j++ ) {
+			w >>>= 1;
+		}
+		return ( i*32 ) + j;
+	}
+	return -1;
+}
+
+
+// EXPORTS //
+
+module.exports = find;
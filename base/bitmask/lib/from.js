@@ -0,0 +1,110 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var min = require( '@stdlib/math/base/special/fast/min' );
+var getShape = require( './../../../base/shape' );
+var Bitmask = require( './main.js' );
+var rowMajor = require( './row_major.js' );
+
+
+// MAIN //
+
+/**
+* Packs the elements of an ndarray into a bitmask.
+*
+* ## Notes
+*
+* -   Elements are packed in row-major (C-style) linear index order and are converted to booleans according to their truthiness.
+*
+* @param {ndarrayLike} x - input ndarray
+* @returns {bitmask} bitmask
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+* var BooleanArray = require( '@stdlib/array/bool' );
+*
+* var buf = new BooleanArray( [ true, false, false, true ] );
+* var x = ndarray( 'bool', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var mask = from( x );
+* // returns <bitmask>
+*
+* var n = mask.count();
+* // returns 2
+*/
+function from( x ) {
+	var words;
+	var xbuf;
+	var get;
+	var out;
+	var obj;
+	var ix;
+	var N;
+	var M;
+	var w;
+	var i;
+	var j;
+	var k;
+
+	out = new Bitmask( getShape( x, false ) );
+	words = out.data;
+
+	obj = rowMajor( x );
+	xbuf = obj.data;
+	ix = obj.offset;
+	N = obj.length;
+
+	if ( obj.accessorProtocol ) {
+		get = obj.accessors[ 0 ];
+		for ( i = 0, k = 0; i < N; k++ ) {
+			M = min( N-i, 32 );
+			w = 0;
+			for ( j = 0; j < M; j++ ) {
+				if ( get( xbuf, ix ) ) {
+					w |= ( 1 << j );
+				}
+				ix += 1;
+			}
+			words[ k ] = w;
+			i += M;
+		}
+		return out;
+	}
+	for ( i = 0, k = 0; i < N; k++ ) {
+		M = min( N-i, 32 );
+		w = 0;
+		for ( j = 0; j < M; j++ ) {
+			if ( xbuf[ ix ] ) {
+				w |= ( 1 << j );
+			}
+			ix += 1;
+		}
+		words[ k ] = w;
+		i += M;
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = from;
@@ -0,0 +1,66 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Bit-packed boolean array constructor.
+*
+* @module @stdlib/ndarray/base/bitmask
+*
+* @example
+* var bitmask = require( '@stdlib/ndarray/base/bitmask' );
+*
+* var mask = bitmask( [ 2, 3 ] );
+* // returns <bitmask>
+*
+* mask.iset( 4, true );
+*
+* var n = mask.count();
+* // returns 1
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+* var BooleanArray = require( '@stdlib/array/bool' );
+* var bitmask = require( '@stdlib/ndarray/base/bitmask' );
+*
+* var buf = new BooleanArray( [ true, false, false, true ] );
+* var x = ndarray( 'bool', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var mask = bitmask.from( x );
+* // returns <bitmask>
+*
+* var idx = mask.find();
+* // returns 0
+*/
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var main = require( './main.js' );
+var from = require( './from.js' );
+
+
+// MAIN //
+
+setReadOnly( main, 'from', from );
+
+
+// EXPORTS //
+
+module.exports = main;
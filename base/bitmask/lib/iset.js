@@ -0,0 +1,50 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var floor = require( '@stdlib/math/base/special/floor' );
+
+
+// MAIN //
+
+/**
+* Sets an array element located at a specified linear index.
+*
+* @private
+* @param {NonNegativeInteger} idx - linear index
+* @param {boolean} v - value to set
+* @returns {bitmask} bitmask instance
+*/
+function iset( idx, v ) {
+	/* eslint-disable no-invalid-this */
+	var k = floor( idx/32 );
+	if ( v ) {
+		this._data[ k ] |= ( 1 << ( idx%32 ) );
+	} else {
+		this._data[ k ] &= ~( 1 << ( idx%32 ) );
+	}
+	return this;
+}
+
+
+// EXPORTS //
+
+module.exports = iset;
@@ -0,0 +1,467 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/* eslint-disable no-restricted-syntax, no-invalid-this */
+
+'use strict';
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var setReadOnlyAccessor = require( '@stdlib/utils/define-nonenumerable-read-only-accessor' );
+var slice = require( '@stdlib/array/base/slice' );
+var ceil = require( '@stdlib/math/base/special/ceil' );
+var Uint32Array = require( '@stdlib/array/uint32' );
+var igetValue = require( './iget.js' );
+var isetValue = require( './iset.js' );
+var count = require( './count.js' );
+var any = require( './any.js' );
+var every = require( './every.js' );
+var some = require( './some.js' );
+var find = require( './find.js' );
+var and = require( './and.js' );
+var or = require( './or.js' );
+var xor = require( './xor.js' );
+var not = require( './not.js' );
+var select = require( './select.js' );
+var toNdarray = require( './to_ndarray.js' );
+
+
+// VARIABLES //
+
+// Number of bits per word:
+var BITS_PER_WORD = 32;
+
+
+// MAIN //
+
+/**
+* Bit-packed boolean array constructor.
+*
+* ## Notes
+*
+* -   Elements are stored in row-major (C-style) linear index order. Element `i` is stored in bit `i%32` (least significant bit first) of the 32-bit word `floor(i/32)`.
+* -   Bits in the last word which do not correspond to an element are always zero.
+*
+* @constructor
+* @param {NonNegativeIntegerArray} shape - array shape
+* @returns {bitmask} bitmask instance
+*
+* @example
+* var mask = bitmask( [ 2, 3 ] );
+* // returns <bitmask>
+*
+* var len = mask.length;
+* // returns 6
+*
+* mask.iset( 4, true );
+*
+* var v = mask.iget( 4 );
+* // returns true
+*
+* var n = mask.count();
+* // returns 1
+*/
+function bitmask( shape ) {
+	var len;
+	var i;
+	if ( !(this instanceof bitmask) ) {
+		return new bitmask( shape );
+	}
+	// Compute the number of elements (note: a zero-dimensional array contains a single element)...
+	len = 1;
+	for ( i = 0; i < shape.length; i++ ) {
+		len *= shape[ i ];
+	}
+	this._shape = slice( shape, 0, shape.length );
+	this._length = len;
+	this._data = new Uint32Array( ceil( len/BITS_PER_WORD ) );
+	return this;
+}
+
+/**
+* Constructor name.
+*
+* @name name
+* @memberof bitmask
+* @type {string}
+* @default 'bitmask'
+*
+* @example
+* var str = bitmask.name;
+* // returns 'bitmask'
+*/
+setReadOnly( bitmask, 'name', 'bitmask' );
+
+/**
+* Underlying array of 32-bit words.
+*
+* @name data
+* @memberof bitmask.prototype
+* @type {Uint32Array}
+*
+* @example
+* var mask = bitmask( [ 40 ] );
+*
+* var buf = mask.data;
+* // returns <Uint32Array>[ 0, 0 ]
+*/
+setReadOnlyAccessor( bitmask.prototype, 'data', function get() {
+	return this._data;
+});
+
+/**
+* Number of array elements.
+*
+* @name length
+* @memberof bitmask.prototype
+* @type {NonNegativeInteger}
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* var len = mask.length;
+* // returns 6
+*/
+setReadOnlyAccessor( bitmask.prototype, 'length', function get() {
+	return this._length;
+});
+
+/**
+* Shape of the array.
+*
+* @name shape
+* @memberof bitmask.prototype
+* @type {NonNegativeIntegerArray}
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* var sh = mask.shape;
+* // returns [ 3, 2 ]
+*/
+setReadOnlyAccessor( bitmask.prototype, 'shape', function get() {
+	return slice( this._shape, 0, this._shape.length );
+});
+
+/**
+* Returns an array element located at a specified linear index.
+*
+* @name iget
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {NonNegativeInteger} idx - linear index
+* @returns {boolean} array element
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* var v = mask.iget( 3 );
+* // returns false
+*/
+setReadOnly( bitmask.prototype, 'iget', igetValue );
+
+/**
+* Sets an array element located at a specified linear index.
+*
+* @name iset
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {NonNegativeInteger} idx - linear index
+* @param {boolean} v - value to set
+* @returns {bitmask} bitmask instance
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* mask.iset( 3, true );
+*
+* var v = mask.iget( 3 );
+* // returns true
+*/
+setReadOnly( bitmask.prototype, 'iset', isetValue );
+
+/**
+* Returns the number of elements which are `true`.
+*
+* @name count
+* @memberof bitmask.prototype
+* @type {Function}
+* @returns {NonNegativeInteger} number of set elements
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* mask.iset( 1, true );
+* mask.iset( 5, true );
+*
+* var n = mask.count();
+* // returns 2
+*/
+setReadOnly( bitmask.prototype, 'count', count );
+
+/**
+* Tests whether at least one element is `true`.
+*
+* @name any
+* @memberof bitmask.prototype
+* @type {Function}
+* @returns {boolean} boolean indicating whether at least one element is `true`
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* var bool = mask.any();
+* // returns false
+*
+* mask.iset( 5, true );
+*
+* bool = mask.any();
+* // returns true
+*/
+setReadOnly( bitmask.prototype, 'any', any );
+
+/**
+* Tests whether every element is `true`.
+*
+* @name every
+* @memberof bitmask.prototype
+* @type {Function}
+* @returns {boolean} boolean indicating whether every element is `true`
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* var bool = mask.every();
+* // returns false
+*
+* mask.not();
+*
+* bool = mask.every();
+* // returns true
+*/
+setReadOnly( bitmask.prototype, 'every', every );
+
+/**
+* Tests whether at least `n` elements are `true`.
+*
+* @name some
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {NonNegativeInteger} n - minimum number of `true` elements
+* @returns {boolean} boolean indicating whether at least `n` elements are `true`
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* mask.iset( 1, true );
+* mask.iset( 5, true );
+*
+* var bool = mask.some( 2 );
+* // returns true
+*
+* bool = mask.some( 3 );
+* // returns false
+*/
+setReadOnly( bitmask.prototype, 'some', some );
+
+/**
+* Returns the linear index of the first element which is `true`.
+*
+* ## Notes
+*
+* -   If no element is `true`, the method returns `-1`.
+*
+* @name find
+* @memberof bitmask.prototype
+* @type {Function}
+* @returns {integer} linear index
+*
+* @example
+* var mask = bitmask( [ 3, 2 ] );
+*
+* var idx = mask.find();
+* // returns -1
+*
+* mask.iset( 4, true );
+*
+* idx = mask.find();
+* // returns 4
+*/
+setReadOnly( bitmask.prototype, 'find', find );
+
+/**
+* Computes the logical AND of two bitmasks and assigns the result to the `this` instance.
+*
+* ## Notes
+*
+* -   The method assumes that both bitmasks have the same number of elements.
+*
+* @name and
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {bitmask} y - second bitmask
+* @returns {bitmask} bitmask instance
+*
+* @example
+* var x = bitmask( [ 4 ] );
+* x.iset( 0, true );
+* x.iset( 1, true );
+*
+* var y = bitmask( [ 4 ] );
+* y.iset( 1, true );
+*
+* x.and( y );
+*
+* var n = x.count();
+* // returns 1
+*/
+setReadOnly( bitmask.prototype, 'and', and );
+
+/**
+* Computes the logical OR of two bitmasks and assigns the result to the `this` instance.
+*
+* ## Notes
+*
+* -   The method assumes that both bitmasks have the same number of elements.
+*
+* @name or
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {bitmask} y - second bitmask
+* @returns {bitmask} bitmask instance
+*
+* @example
+* var x = bitmask( [ 4 ] );
+* x.iset( 0, true );
+*
+* var y = bitmask( [ 4 ] );
+* y.iset( 1, true );
+*
+* x.or( y );
+*
+* var n = x.count();
+* // returns 2
+*/
+setReadOnly( bitmask.prototype, 'or', or );
+
+/**
+* Computes the logical XOR of two bitmasks and assigns the result to the `this` instance.
+*
+* ## Notes
+*
+* -   The method assumes that both bitmasks have the same number of elements.
+*
+* @name xor
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {bitmask} y - second bitmask
+* @returns {bitmask} bitmask instance
+*
+* @example
+* var x = bitmask( [ 4 ] );
+* x.iset( 0, true );
+* x.iset( 1, true );
+*
+* var y = bitmask( [ 4 ] );
+* y.iset( 1, true );
+*
+* x.xor( y );
+*
+* var n = x.count();
+* // returns 1
+*/
+setReadOnly( bitmask.prototype, 'xor', xor );
+
+/**
+* Computes the logical NOT of a bitmask in-place.
+*
+* @name not
+* @memberof bitmask.prototype
+* @type {Function}
+* @returns {bitmask} bitmask instance
+*
+* @example
+* var x = bitmask( [ 4 ] );
+* x.iset( 0, true );
+*
+* x.not();
+*
+* var n = x.count();
+* // returns 3
+*/
+setReadOnly( bitmask.prototype, 'not', not );
+
+/**
+* Returns a one-dimensional ndarray containing the elements of a provided ndarray for which corresponding bitmask elements are `true`.
+*
+* ## Notes
+*
+* -   The method assumes that the provided ndarray has the same shape as the bitmask.
+* -   Elements are selected in row-major (C-style) linear index order.
+*
+* @name select
+* @memberof bitmask.prototype
+* @type {Function}
+* @param {ndarrayLike} x - input ndarray
+* @returns {ndarray} output ndarray
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var x = ndarray( 'generic', [ 1, 2, 3, 4 ], [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var mask = bitmask( [ 2, 2 ] );
+* mask.iset( 1, true );
+* mask.iset( 2, true );
+*
+* var out = mask.select( x );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( out );
+* // returns [ 2, 3 ]
+*/
+setReadOnly( bitmask.prototype, 'select', select );
+
+/**
+* Converts a bitmask to a row-major boolean ndarray.
+*
+* @name toNdarray
+* @memberof bitmask.prototype
+* @type {Function}
+* @returns {ndarray} boolean ndarray
+*
+* @example
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var mask = bitmask( [ 2, 2 ] );
+* mask.iset( 1, true );
+*
+* var out = mask.toNdarray();
+* // returns <ndarray>
+*
+* var arr = ndarray2array( out );
+* // returns [ [ false, true ], [ false, false ] ]
+*/
+setReadOnly( bitmask.prototype, 'toNdarray', toNdarray );
+
+
+// EXPORTS //
+
+module.exports = bitmask;
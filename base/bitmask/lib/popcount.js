@@ -0,0 +1,46 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MAIN //
+
+/**
+* Returns the number of set bits in a 32-bit word.
+*
+* @private
+* @param {uinteger32} w - word
+* @returns {NonNegativeInteger} number of set bits
+*
+* @example
+* var n = popcount( 11 );
+* // returns 3
+*/
+function popcount( w ) {
+	w -= ( w >>> 1 ) & 0x55555555;
+	w = ( w & 0x33333333 ) + ( ( w >>> 2 ) & 0x33333333 );
+	w = ( w + ( w >>> 4 ) ) & 0x0f0f0f0f;
+
+	// Sum the byte counts into the most significant byte (note: the product is less than 2^53 and, thus, is exact):
+	return ( w * 0x01010101 ) >>> 24;
+}
+
+
+// EXPORTS //
+
+module.exports = popcount;
@@ -0,0 +1,71 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isRowMajorContiguous = require( './../../../base/assert/is-row-major-contiguous' );
+var iterationOrder = require( './../../../base/iteration-order' );
+var reinterpretBoolean = require( './../../../base/reinterpret-boolean' );
+var ndarraylike2object = require( './../../../base/ndarraylike2object' );
+var resolveStr = require( './../../../base/dtype-resolve-str' );
+var getDType = require( './../../../base/dtype' );
+var getShape = require( './../../../base/shape' );
+var getStrides = require( './../../../base/strides' );
+var getOffset = require( './../../../base/offset' );
+var empty = require( './../../../base/empty' );
+var assign = require( './../../../base/assign' );
+
+
+// MAIN //
+
+/**
+* Returns an object containing a row-major contiguous representation of a provided ndarray.
+*
+* ## Notes
+*
+* -   Boolean ndarrays are reinterpreted as unsigned 8-bit integer ndarrays.
+* -   If an input ndarray is not row-major contiguous, the function copies the input ndarray to a temporary row-major ndarray.
+*
+* @private
+* @param {ndarrayLike} x - input ndarray
+* @returns {Object} object containing ndarray data and meta data
+*/
+function rowMajor( x ) {
+	var st;
+	var sh;
+	var y;
+
+	if ( resolveStr( getDType( x ) ) === 'bool' ) {
+		x = reinterpretBoolean( x );
+	}
+	sh = getShape( x, false );
+	st = getStrides( x, false );
+	if ( iterationOrder( st ) === 1 && isRowMajorContiguous( sh, st, getOffset( x ) ) ) { // eslint-disable-line max-len
+		return ndarraylike2object( x );
+	}
+	y = empty( getDType( x ), sh, 'row-major' );
+	assign( [ x, y ] );
+	return ndarraylike2object( y );
+}
+
+
+// EXPORTS //
+
+module.exports = rowMajor;
@@ -0,0 +1,101 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var reinterpret = require( '@stdlib/strided/base/reinterpret-boolean' );
+var resolveStr = require( './../../../base/dtype-resolve-str' );
+var getDType = require( './../../../base/dtype' );
+var buffer = require( './../../../base/buffer' );
+var ndarray = require( './../../../base/ctor' );
+var rowMajor = require( './row_major.js' );
+var popcount = require( './popcount.js' );
+
+
+// MAIN //
+
+/**
+* Returns a one-dimensional ndarray containing the elements of a provided ndarray for which corresponding bitmask elements are `true`.
+*
+* @private
+* @param {ndarrayLike} x - input ndarray
+* @returns {ndarray} output ndarray
+*/
+function select( x ) {
+	/* eslint-disable no-invalid-this */
+	var words;
+	var xbuf;
+	var obuf;
+	var wbuf;
+	var get;
+	var set;
+	var obj;
+	var ox;
+	var dt;
+	var n;
+	var w;
+	var b;
+	var i;
+	var j;
+	var k;
+
+	dt = resolveStr( getDType( x ) );
+	words = this._data;
+
+	// Determine the number of selected elements:
+	n = 0;
+	for ( k = 0; k < words.length; k++ ) {
+		n += popcount( words[ k ] );
+	}
+	obuf = buffer( dt, n );
+
+	// Boolean ndarrays are reinterpreted as unsigned 8-bit integer ndarrays, so write to a reinterpreted view of the output buffer:
+	wbuf = ( dt === 'bool' ) ? reinterpret( obuf, 0 ) : obuf;
+
+	obj = rowMajor( x );
+	xbuf = obj.data;
+	ox = obj.offset;
+	get = obj.accessors[ 0 ];
+	set = obj.accessors[ 1 ];
+
+	j = 0;
+	for ( k = 0; k < words.length; k++ ) {
+		w = words[ k ];
+
+		// Skip words which do not contain any set bits...
+		if ( w === 0 ) {
+			continue;
+		}
+		i = ox + ( k*32 );
+		for ( b = 0; w !== 0; b++ ) {
+			if ( w & 1 ) {
+				set( wbuf, j, get( xbuf, i+b ) );
+				j += 1;
+			}
+			w >>>= 1;
+		}
+	}
+	return ndarray( dt, obuf, [ n ], [ 1 ], 0, 'row-major' );
+}
+
+
+// EXPORTS //
+
+module.exports = select;
@@ -0,0 +1,58 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var popcount = require( './popcount.js' );
+
+
+// MAIN //
+
+/**
+* Tests whether at least `n` elements are `true`.
+*
+* @private
+* @param {NonNegativeInteger} n - minimum number of `true` elements
+* @returns {boolean} boolean indicating whether at least `n` elements are `true`
+*/
+function some( n ) {
+	/* eslint-disable no-invalid-this */
+	var buf;
+	var c;
+	var i;
+
+	if ( n <= 0 ) {
+		return true;
+	}
+	buf = this._data;
+	c = 0;
+	for ( i = 0; i < buf.length; i++ ) {
+		c += popcount( buf[ i ] );
+		if ( c >= n ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// EXPORTS //
+
+module.exports = some;
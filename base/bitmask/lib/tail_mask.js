@@ -0,0 +1,48 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MAIN //
+
+/**
+* Returns a mask for the bits in the last word of a bitmask which correspond to array elements.
+*
+* @private
+* @param {NonNegativeInteger} len - number of array elements
+* @returns {uinteger32} word mask
+*
+* @example
+* var m = tailMask( 40 );
+* // returns 255
+*
+* m = tailMask( 64 );
+* // returns 4294967295
+*/
+function tailMask( len ) {
+	var r = len % 32;
+	if ( r === 0 ) {
+		return 0xffffffff;
+	}
+	return ( ( 1 << r ) - 1 ) >>> 0;
+}
+
+
+// EXPORTS //
+
+module.exports = tailMask;
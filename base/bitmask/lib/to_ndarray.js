@@ -0,0 +1,69 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var reinterpret = require( '@stdlib/strided/base/reinterpret-boolean' );
+var min = require( '@stdlib/math/base/special/fast/min' );
+var getData = require( './../../../base/data-buffer' );
+var empty = require( './../../../base/empty' );
+
+
+// MAIN //
+
+/**
+* Converts a bitmask to a row-major boolean ndarray.
+*
+* @private
+* @returns {ndarray} boolean ndarray
+*/
+function toNdarray() {
+	/* eslint-disable no-invalid-this */
+	var words;
+	var obuf;
+	var out;
+	var N;
+	var M;
+	var w;
+	var i;
+	var j;
+	var k;
+
+	out = empty( 'bool', this._shape, 'row-major' );
+	obuf = reinterpret( getData( out ), 0 );
+
+	words = this._data;
+	N = this._length;
+	for ( i = 0, k = 0; i < N; k++ ) {
+		M = min( N-i, 32 );
+		w = words[ k ];
+		for ( j = 0; j < M; j++ ) {
+			obuf[ i ] = w & 1;
+			w >>>= 1;
+			i += 1;
+		}
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = toNdarray;
@@ -0,0 +1,47 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MAIN //
+
+/**
+* Computes the logical XOR of two bitmasks and assigns the result to the `this` instance.
+*
+* @private
+* @param {bitmask} y - second bitmask
+* @returns {bitmask} bitmask instance
+*/
+function xor( y ) {
+	/* eslint-disable no-invalid-this */
+	var xbuf;
+	var ybuf;
+	var i;
+
+	xbuf = this._data;
+	ybuf = y.data;
+	for ( i = 0; i < xbuf.length; i++ ) {
+		xbuf[ i ] ^= ybuf[ i ];
+	}
+	return this;
+}
+
+
+// EXPORTS //
+
+module.exports = xor;
@@ -0,0 +1,265 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var BooleanArray = require( '@stdlib/array/bool' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Uint32Array = require( '@stdlib/array/uint32' );
+var ndarray = require( './../../../base/ctor' );
+var getData = require( './../../../base/data-buffer' );
+var getShape = require( './../../../base/shape' );
+var bitmask = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns a list of booleans in which every third element is `true`.
+*
+* @private
+* @param {NonNegativeInteger} N - number of elements
+* @returns {Array<boolean>} list of booleans
+*/
+function everyThird( N ) {
+	var out;
+	var i;
+
+	out = [];
+	for ( i = 0; i < N; i++ ) {
+		out.push( i%3 === 0 );
+	}
+	return out;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof bitmask, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'attached to the main export is a `from` method', function test( t ) {
+	t.strictEqual( typeof bitmask.from, 'function', 'has method' );
+	t.end();
+});
+
+tape( 'the constructor does not require the `new` keyword', function test( t ) {
+	var mask = bitmask( [ 2, 3 ] );
+	t.strictEqual( mask instanceof bitmask, true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the constructor returns a zero-filled bitmask', function test( t ) {
+	var mask = new bitmask( [ 5, 10 ] );
+
+	t.deepEqual( mask.shape, [ 5, 10 ], 'returns expected value' );
+	t.strictEqual( mask.length, 50, 'returns expected value' );
+	t.deepEqual( mask.data, new Uint32Array( 2 ), 'returns expected value' );
+	t.strictEqual( mask.count(), 0, 'returns expected value' );
+	t.strictEqual( mask.find(), -1, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the constructor supports zero-dimensional and empty shapes', function test( t ) {
+	var mask;
+
+	mask = bitmask( [] );
+	t.strictEqual( mask.length, 1, 'returns expected value' );
+	t.strictEqual( mask.data.length, 1, 'returns expected value' );
+
+	mask = bitmask( [ 3, 0 ] );
+	t.strictEqual( mask.length, 0, 'returns expected value' );
+	t.strictEqual( mask.data.length, 0, 'returns expected value' );
+	t.strictEqual( mask.every(), true, 'returns expected value' );
+	t.strictEqual( mask.any(), false, 'returns expected value' );
+	t.end();
+});
+
+tape( 'a bitmask supports getting and setting elements by linear index', function test( t ) {
+	var mask = bitmask( [ 40 ] );
+
+	mask.iset( 0, true );
+	mask.iset( 31, true );
+	mask.iset( 32, true );
+	mask.iset( 39, true );
+
+	t.deepEqual( mask.data, new Uint32Array( [ 0x80000001, 0x81 ] ), 'returns expected value' );
+	t.strictEqual( mask.iget( 0 ), true, 'returns expected value' );
+	t.strictEqual( mask.iget( 1 ), false, 'returns expected value' );
+	t.strictEqual( mask.iget( 31 ), true, 'returns expected value' );
+	t.strictEqual( mask.iget( 39 ), true, 'returns expected value' );
+
+	mask.iset( 31, false );
+	t.strictEqual( mask.iget( 31 ), false, 'returns expected value' );
+	t.strictEqual( mask.count(), 3, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `from` method packs a boolean ndarray', function test( t ) {
+	var mask;
+	var x;
+	var i;
+
+	x = ndarray( 'bool', new BooleanArray( everyThird( 70 ) ), [ 7, 10 ], [ 10, 1 ], 0, 'row-major' );
+	mask = bitmask.from( x );
+
+	t.deepEqual( mask.shape, [ 7, 10 ], 'returns expected value' );
+	t.strictEqual( mask.length, 70, 'returns expected value' );
+	t.strictEqual( mask.data.length, 3, 'returns expected value' );
+	for ( i = 0; i < 70; i++ ) {
+		t.strictEqual( mask.iget( i ), i%3 === 0, 'returns expected value' );
+	}
+	t.end();
+});
+
+tape( 'the `from` method packs elements in row-major order (non-contiguous)', function test( t ) {
+	var mask;
+	var x;
+
+	// Column-major view of the underlying buffer:
+	x = ndarray( 'bool', new BooleanArray( everyThird( 6 ) ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+
+	// x => [ [ true, false, false ], [ false, true, false ] ]
+	mask = bitmask.from( x );
+
+	t.deepEqual( [ mask.iget( 0 ), mask.iget( 1 ), mask.iget( 2 ), mask.iget( 3 ), mask.iget( 4 ), mask.iget( 5 ) ], [ true, false, false, false, true, false ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `from` method converts non-boolean elements according to their truthiness', function test( t ) {
+	var mask;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( [ 0.0, 1.0, -2.0, 0.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	mask = bitmask.from( x );
+
+	t.strictEqual( mask.count(), 2, 'returns expected value' );
+	t.strictEqual( mask.find(), 1, 'returns expected value' );
+	t.end();
+});
+
+tape( 'a bitmask supports word-wise reductions', function test( t ) {
+	var mask;
+	var x;
+
+	x = ndarray( 'bool', new BooleanArray( everyThird( 70 ) ), [ 70 ], [ 1 ], 0, 'row-major' );
+	mask = bitmask.from( x );
+
+	t.strictEqual( mask.count(), 24, 'returns expected value' );
+	t.strictEqual( mask.any(), true, 'returns expected value' );
+	t.strictEqual( mask.every(), false, 'returns expected value' );
+	t.strictEqual( mask.some( 24 ), true, 'returns expected value' );
+	t.strictEqual( mask.some( 25 ), false, 'returns expected value' );
+	t.strictEqual( mask.find(), 0, 'returns expected value' );
+
+	mask.iset( 0, false );
+	mask.iset( 3, false );
+	t.strictEqual( mask.find(), 6, 'returns expected value' );
+	t.end();
+});
+
+tape( 'a bitmask supports word-wise logical operations', function test( t ) {
+	var x;
+	var y;
+
+	x = bitmask( [ 70 ] );
+	y = bitmask( [ 70 ] );
+
+	x.iset( 1, true );
+	x.iset( 65, true );
+	y.iset( 65, true );
+	y.iset( 69, true );
+
+	t.strictEqual( x.and( y ), x, 'returns expected value' );
+	t.strictEqual( x.count(), 1, 'returns expected value' );
+	t.strictEqual( x.iget( 65 ), true, 'returns expected value' );
+
+	x.or( y );
+	t.strictEqual( x.count(), 2, 'returns expected value' );
+
+	x.xor( y );
+	t.strictEqual( x.count(), 0, 'returns expected value' );
+
+	x.not();
+	t.strictEqual( x.count(), 70, 'returns expected value' );
+	t.strictEqual( x.every(), true, 'returns expected value' );
+	t.strictEqual( x.data[ 2 ], 63, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `toNdarray` method converts a bitmask to a boolean ndarray', function test( t ) {
+	var expected;
+	var mask;
+	var out;
+	var x;
+
+	expected = everyThird( 70 );
+	x = ndarray( 'bool', new BooleanArray( expected ), [ 7, 10 ], [ 10, 1 ], 0, 'row-major' );
+	mask = bitmask.from( x );
+
+	out = mask.toNdarray();
+	t.strictEqual( String( out.dtype ), 'bool', 'returns expected value' );
+	t.deepEqual( getShape( out ), [ 7, 10 ], 'returns expected value' );
+	t.deepEqual( getData( out ), new BooleanArray( expected ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `select` method returns the elements of an ndarray for which corresponding bitmask elements are `true`', function test( t ) {
+	var mask;
+	var out;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	mask = bitmask( [ 2, 3 ] );
+	mask.iset( 0, true );
+	mask.iset( 4, true );
+	mask.iset( 5, true );
+
+	out = mask.select( x );
+	t.strictEqual( String( out.dtype ), 'float64', 'returns expected value' );
+	t.deepEqual( getShape( out ), [ 3 ], 'returns expected value' );
+	t.deepEqual( getData( out ), new Float64Array( [ 1.0, 5.0, 6.0 ] ), 'returns expected value' );
+
+	// Column-major view (i.e., [ [ 1, 3, 5 ], [ 2, 4, 6 ] ]):
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+	out = mask.select( x );
+	t.deepEqual( getData( out ), new Float64Array( [ 1.0, 4.0, 6.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `select` method supports boolean ndarrays', function test( t ) {
+	var mask;
+	var out;
+	var x;
+
+	x = ndarray( 'bool', new BooleanArray( [ true, false, true, false ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	mask = bitmask( [ 4 ] );
+	mask.iset( 0, true );
+	mask.iset( 1, true );
+
+	out = mask.select( x );
+	t.strictEqual( String( out.dtype ), 'bool', 'returns expected value' );
+	t.deepEqual( getData( out ), new BooleanArray( [ true, false ] ), 'returns expected value' );
+	t.end();
+});
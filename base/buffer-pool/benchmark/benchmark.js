@@ -0,0 +1,95 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isCollection = require( '@stdlib/assert/is-collection' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var bufferPool = require( './../lib' );
+
+
+// MAIN //
+
+bench( pkg, function benchmark( b ) {
+	var pool;
+	var i;
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		pool = bufferPool();
+		if ( typeof pool !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( typeof pool.malloc !== 'function' ) {
+		b.fail( 'should return an object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:malloc', pkg ), function benchmark( b ) {
+	var pool;
+	var out;
+	var i;
+
+	pool = bufferPool();
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = pool.malloc( 'float64', 10 );
+		if ( out.length !== 10 ) {
+			b.fail( 'should have length 10' );
+		}
+		pool.free( out );
+	}
+	b.toc();
+	if ( !isCollection( out ) ) {
+		b.fail( 'should return an array-like object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:calloc', pkg ), function benchmark( b ) {
+	var pool;
+	var out;
+	var i;
+
+	pool = bufferPool();
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = pool.calloc( 'float64', 10 );
+		if ( out.length !== 10 ) {
+			b.fail( 'should have length 10' );
+		}
+		pool.free( out );
+	}
+	b.toc();
+	if ( !isCollection( out ) ) {
+		b.fail( 'should return an array-like object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
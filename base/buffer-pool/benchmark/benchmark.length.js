@@ -0,0 +1,113 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var isCollection = require( '@stdlib/assert/is-collection' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var bufferPool = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {string} dtype - data type
+* @param {PositiveInteger} len - buffer length
+* @returns {Function} benchmark function
+*/
+function createBenchmark( dtype, len ) {
+	var pool = bufferPool();
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var out;
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			out = pool.calloc( dtype, len );
+			if ( out.length !== len ) {
+				b.fail( 'unexpected length' );
+			}
+			pool.free( out );
+		}
+		b.toc();
+		if ( !isCollection( out ) ) {
+			b.fail( 'should return an array-like object' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var f;
+	var i;
+
+	min = 1; // 10^min
+	max = 6; // 10^max
+
+	for ( i = min; i <= max; i++ ) {
+		len = pow( 10, i );
+
+		f = createBenchmark( 'binary', len );
+		bench( format( '%s:calloc:len=%d,dtype=binary', pkg, len ), f );
+
+		f = createBenchmark( 'complex128', len );
+		bench( format( '%s:calloc:len=%d,dtype=complex128', pkg, len ), f );
+
+		f = createBenchmark( 'float64', len );
+		bench( format( '%s:calloc:len=%d,dtype=float64', pkg, len ), f );
+
+		f = createBenchmark( 'float32', len );
+		bench( format( '%s:calloc:len=%d,dtype=float32', pkg, len ), f );
+
+		f = createBenchmark( 'int32', len );
+		bench( format( '%s:calloc:len=%d,dtype=int32', pkg, len ), f );
+
+		f = createBenchmark( 'uint8', len );
+		bench( format( '%s:calloc:len=%d,dtype=uint8', pkg, len ), f );
+	}
+}
+
+main();
@@ -0,0 +1,189 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+/// <reference types="node"/>
+
+import { Buffer } from 'buffer';
+import { TypedArray, ComplexTypedArray, BooleanTypedArray } from '@stdlib/types/array';
+import { DataType } from '@stdlib/types/ndarray';
+
+/**
+* Array or typed array.
+*/
+type ArrayOrBufferOrTypedArray = Array<any> | TypedArray | ComplexTypedArray | BooleanTypedArray | Buffer | null;
+
+/**
+* Pool options.
+*/
+interface Options {
+	/**
+	* Maximum total number of bytes retained by the pool.
+	*/
+	highWaterMark?: number;
+}
+
+/**
+* Pool allocation statistics.
+*/
+interface Stats {
+	/**
+	* Number of allocation requests.
+	*/
+	allocations: number;
+
+	/**
+	* Number of allocation requests served by reusing a released buffer.
+	*/
+	hits: number;
+
+	/**
+	* Number of allocation requests requiring a new buffer.
+	*/
+	misses: number;
+
+	/**
+	* Number of released buffers retained by the pool.
+	*/
+	releases: number;
+
+	/**
+	* Number of released buffers which were not retained by the pool.
+	*/
+	rejections: number;
+
+	/**
+	* Total number of bytes currently retained by the pool.
+	*/
+	nbytes: number;
+}
+
+/**
+* Buffer pool.
+*/
+interface Pool {
+	/**
+	* Returns an uninitialized contiguous linear ndarray data buffer.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.malloc( 'float64', 3 );
+	* // returns <Float64Array>
+	*/
+	malloc( dtype: DataType, size: number ): ArrayOrBufferOrTypedArray;
+
+	/**
+	* Returns a zero-filled contiguous linear ndarray data buffer.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.calloc( 'float64', 3 );
+	* // returns <Float64Array>[ 0.0, 0.0, 0.0 ]
+	*/
+	calloc( dtype: DataType, size: number ): ArrayOrBufferOrTypedArray;
+
+	/**
+	* Releases a data buffer back to the pool.
+	*
+	* @param buf - data buffer
+	* @returns boolean indicating whether the buffer was retained by the pool
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.malloc( 'float64', 3 );
+	*
+	* var bool = pool.free( buf );
+	* // returns true
+	*/
+	free( buf: ArrayOrBufferOrTypedArray | ArrayBuffer ): boolean;
+
+	/**
+	* Clears the pool, dropping all retained buffers.
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* pool.clear();
+	*/
+	clear(): void;
+
+	/**
+	* Returns pool allocation statistics.
+	*
+	* @returns allocation statistics
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var s = pool.stats();
+	* // returns { 'allocations': 0, 'hits': 0, 'misses': 0, 'releases': 0, 'rejections': 0, 'nbytes': 0 }
+	*/
+	stats(): Stats;
+
+	/**
+	* Maximum total number of bytes retained by the pool.
+	*/
+	readonly highWaterMark: number;
+
+	/**
+	* Total number of bytes currently retained by the pool.
+	*/
+	readonly nbytes: number;
+}
+
+/**
+* Returns a pool of reusable contiguous linear ndarray data buffers.
+*
+* ## Notes
+*
+* -   Buffers are allocated from power-of-two size classes. Each size class maintains a free list of released buffers which are shared by all non-generic data types.
+* -   Released buffers are only retained while the total number of retained bytes does not exceed the pool's high water mark.
+* -   "generic" data buffers are plain arrays and are never pooled.
+*
+* @param options - pool options
+* @param options.highWaterMark - maximum total number of bytes retained by the pool
+* @returns buffer pool
+*
+* @example
+* var pool = bufferPool();
+*
+* var buf = pool.calloc( 'float64', 3 );
+* // returns <Float64Array>[ 0.0, 0.0, 0.0 ]
+*
+* var bool = pool.free( buf );
+* // returns true
+*/
+declare function bufferPool( options?: Options ): Pool;
+
+
+// EXPORTS //
+
+export = bufferPool;
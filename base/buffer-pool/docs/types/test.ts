@@ -0,0 +1,78 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import bufferPool = require( './index' );
+
+
+// TESTS //
+
+// The function returns a buffer pool...
+{
+	bufferPool(); // $ExpectType Pool
+	bufferPool( {} ); // $ExpectType Pool
+	bufferPool( { 'highWaterMark': 1024 } ); // $ExpectType Pool
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	bufferPool( '5' ); // $ExpectError
+	bufferPool( 5 ); // $ExpectError
+	bufferPool( true ); // $ExpectError
+	bufferPool( false ); // $ExpectError
+	bufferPool( null ); // $ExpectError
+	bufferPool( [] ); // $ExpectError
+	bufferPool( ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `highWaterMark` option which is not a number...
+{
+	bufferPool( { 'highWaterMark': '5' } ); // $ExpectError
+	bufferPool( { 'highWaterMark': true } ); // $ExpectError
+	bufferPool( { 'highWaterMark': null } ); // $ExpectError
+	bufferPool( { 'highWaterMark': [] } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided too many arguments...
+{
+	bufferPool( {}, 5 ); // $ExpectError
+}
+
+// The pool has methods for allocating and releasing data buffers...
+{
+	const pool = bufferPool();
+
+	pool.malloc( 'float64', 3 ); // $ExpectType ArrayOrBufferOrTypedArray
+	pool.calloc( 'float64', 3 ); // $ExpectType ArrayOrBufferOrTypedArray
+	pool.free( new Float64Array( 4 ) ); // $ExpectType boolean
+	pool.clear(); // $ExpectType void
+	pool.stats(); // $ExpectType Stats
+	pool.highWaterMark; // $ExpectType number
+	pool.nbytes; // $ExpectType number
+}
+
+// The compiler throws an error if the pool's allocation methods are provided invalid arguments...
+{
+	const pool = bufferPool();
+
+	pool.malloc( 'float64', '3' ); // $ExpectError
+	pool.malloc( 'float64' ); // $ExpectError
+	pool.calloc( 'float64', '3' ); // $ExpectError
+	pool.calloc( 'float64' ); // $ExpectError
+	pool.free( 5 ); // $ExpectError
+	pool.free(); // $ExpectError
+}
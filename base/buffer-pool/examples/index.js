@@ -0,0 +1,40 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var bufferPool = require( './../lib' );
+
+// Create a pool which retains at most 1MB of released buffers:
+var pool = bufferPool({
+	'highWaterMark': 1048576
+});
+
+var DTYPES = [ 'float64', 'float32', 'int32', 'uint8', 'complex128' ];
+
+// Simulate a workload which repeatedly allocates and releases temporaries having the same size:
+var buf;
+var i;
+var j;
+for ( i = 0; i < 10; i++ ) {
+	for ( j = 0; j < DTYPES.length; j++ ) {
+		buf = pool.calloc( DTYPES[ j ], 128 );
+		pool.free( buf );
+	}
+}
+console.log( pool.stats() );
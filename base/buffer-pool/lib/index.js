@@ -0,0 +1,49 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Create a pool of reusable contiguous linear ndarray data buffers.
+*
+* @module @stdlib/ndarray/base/buffer-pool
+*
+* @example
+* var bufferPool = require( '@stdlib/ndarray/base/buffer-pool' );
+*
+* var pool = bufferPool({
+*     'highWaterMark': 1048576
+* });
+*
+* var buf = pool.calloc( 'float64', 3 );
+* // returns <Float64Array>[ 0.0, 0.0, 0.0 ]
+*
+* pool.free( buf );
+*
+* buf = pool.malloc( 'float32', 6 );
+* // returns <Float32Array>
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
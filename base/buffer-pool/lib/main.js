@@ -0,0 +1,395 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var setNonEnumerable = require( '@stdlib/utils/define-nonenumerable-property' );
+var setReadOnlyAccessor = require( '@stdlib/utils/define-nonenumerable-read-only-accessor' );
+var isArrayBuffer = require( '@stdlib/assert/is-arraybuffer' );
+var arraybuffer2buffer = require( '@stdlib/buffer/from-arraybuffer' );
+var ArrayBuffer = require( '@stdlib/array/buffer' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var zeros = require( '@stdlib/array/base/zeros' );
+var fill = require( '@stdlib/array/base/fill' );
+var MAX_ARRAYBUFFER_LENGTH = require( '@stdlib/constants/array/max-arraybuffer-length' );
+var resolveStr = require( './../../../base/dtype-resolve-str' );
+var bufferCtors = require( './../../../base/buffer-ctors' );
+var validate = require( './validate.js' );
+
+
+// VARIABLES //
+
+// Minimum size class (in bytes), which ensures that every pooled buffer is suitably aligned for all supported data types:
+var MIN_BYTES = 8;
+
+// Base-2 logarithm of the minimum size class:
+var MIN_CLASS = 3;
+
+// Name of the (non-enumerable) property used to tag the `ArrayBuffer` instances allocated by a pool:
+var TAG = '__stdlib_ndarray_buffer_pool__';
+
+// Counter for generating unique pool identifiers:
+var NPOOLS = 0;
+
+
+// FUNCTIONS //
+
+/**
+* Returns the size class index for a provided number of bytes.
+*
+* ## Notes
+*
+* -   Size classes are successive powers of two, starting from the minimum size class. The size class index is the base-2 logarithm of the number of bytes in the size class.
+*
+* @private
+* @param {NonNegativeInteger} nbytes - number of bytes
+* @returns {NonNegativeInteger} size class index
+*
+* @example
+* var k = sizeClass( 100 );
+* // returns 7
+*/
+function sizeClass( nbytes ) {
+	var n = MIN_BYTES;
+	var k = MIN_CLASS;
+	while ( n < nbytes ) {
+		n *= 2;
+		k += 1;
+	}
+	return k;
+}
+
+/**
+* Returns the number of bytes in a size class.
+*
+* @private
+* @param {NonNegativeInteger} k - size class index
+* @returns {PositiveInteger} number of bytes
+*
+* @example
+* var n = classBytes( 7 );
+* // returns 128
+*/
+function classBytes( k ) {
+	var n = MIN_BYTES;
+	var i;
+	for ( i = MIN_CLASS; i < k; i++ ) {
+		n *= 2;
+	}
+	return n;
+}
+
+
+// MAIN //
+
+/**
+* Returns a pool of reusable contiguous linear ndarray data buffers.
+*
+* ## Notes
+*
+* -   Buffers are allocated from power-of-two size classes. Each size class maintains a free list of released `ArrayBuffer` instances which are shared by all non-generic data types, such that, e.g., a released `float64` buffer can back a subsequent `int32` allocation having the same number of bytes.
+* -   Released buffers are only retained while the total number of retained bytes does not exceed the pool's high water mark. Allocation requests are never refused.
+* -   "generic" data buffers are plain arrays and are never pooled.
+* -   The pool tags the underlying `ArrayBuffer` of each buffer it returns with a pool identifier, and updates the tag when the buffer is released and reused. Tags are stored on the `ArrayBuffer` instances themselves, so the pool never holds references to outstanding buffers. Accordingly, releasing a buffer twice, or releasing a typed array or `ArrayBuffer` which was not returned by the pool, results in an error.
+*
+* @param {Options} [options] - pool options
+* @param {NonNegativeInteger} [options.highWaterMark] - maximum total number of bytes retained by the pool
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @returns {Object} buffer pool
+*
+* @example
+* var pool = bufferPool();
+*
+* var buf = pool.calloc( 'float64', 3 );
+* // returns <Float64Array>[ 0.0, 0.0, 0.0 ]
+*
+* var bool = pool.free( buf );
+* // returns true
+*
+* buf = pool.malloc( 'float64', 4 );
+* // returns <Float64Array>
+*
+* var s = pool.stats();
+* // returns { 'allocations': 2, 'hits': 1, 'misses': 1, 'releases': 1, 'rejections': 0, 'nbytes': 0 }
+*/
+function bufferPool( options ) {
+	var freelists;
+	var counters;
+	var nbytes;
+	var pool;
+	var opts;
+	var err;
+	var id;
+
+	opts = {
+		'highWaterMark': MAX_ARRAYBUFFER_LENGTH
+	};
+	if ( arguments.length ) {
+		err = validate( opts, options );
+		if ( err ) {
+			throw err;
+		}
+	}
+	freelists = [];
+	nbytes = 0;
+
+	// Resolve a unique pool identifier (note: an `ArrayBuffer` which has been returned by the pool and not yet released is tagged with `id`, while an `ArrayBuffer` which has been released and not yet reused is tagged with `-id`):
+	NPOOLS += 1;
+	id = NPOOLS;
+
+	counters = {
+		'allocations': 0,
+		'hits': 0,
+		'misses': 0,
+		'releases': 0,
+		'rejections': 0
+	};
+
+	pool = {};
+	setReadOnly( pool, 'malloc', malloc );
+	setReadOnly( pool, 'calloc', calloc );
+	setReadOnly( pool, 'free', free );
+	setReadOnly( pool, 'clear', clear );
+	setReadOnly( pool, 'stats', stats );
+	setReadOnly( pool, 'highWaterMark', opts.highWaterMark );
+	setReadOnlyAccessor( pool, 'nbytes', getNBytes );
+
+	return pool;
+
+	/**
+	* Returns an `ArrayBuffer` belonging to a specified size class, reusing a released buffer when available.
+	*
+	* @private
+	* @param {NonNegativeInteger} k - size class index
+	* @returns {Array} two-element array containing an `ArrayBuffer` and a boolean indicating whether the buffer was reused
+	*/
+	function arraybuffer( k ) {
+		var list = freelists[ k ];
+		var ab;
+		if ( list && list.length > 0 ) {
+			ab = list.pop();
+			nbytes -= ab.byteLength;
+			counters.hits += 1;
+			return [ ab, true ];
+		}
+		counters.misses += 1;
+		ab = new ArrayBuffer( classBytes( k ) );
+		setNonEnumerable( ab, TAG, 0 );
+		return [ ab, false ];
+	}
+
+	/**
+	* Allocates a contiguous linear ndarray data buffer.
+	*
+	* @private
+	* @param {*} dtype - data type
+	* @param {NonNegativeInteger} size - buffer size
+	* @param {boolean} zero - boolean indicating whether to zero-fill a reused buffer
+	* @returns {(Array|TypedArray|Buffer|null)} data buffer
+	*/
+	function allocate( dtype, size, zero ) {
+		var ctor;
+		var bpe;
+		var tmp;
+		var ab;
+		var dt;
+		var N;
+
+		dt = resolveStr( dtype );
+		if ( dt === 'generic' ) {
+			return zeros( size );
+		}
+		if ( dt === 'binary' ) {
+			bpe = 1;
+		} else {
+			ctor = bufferCtors( dtype );
+			if ( !ctor ) {
+				return null;
+			}
+			bpe = ctor.BYTES_PER_ELEMENT;
+		}
+		counters.allocations += 1;
+		N = size * bpe;
+		tmp = arraybuffer( sizeClass( N ) );
+		ab = tmp[ 0 ];
+		ab[ TAG ] = id;
+
+		// Newly allocated buffers are zero-filled, but reused buffers retain the contents written prior to release...
+		if ( zero && tmp[ 1 ] ) {
+			fill( new Uint8Array( ab, 0, N ), 0, 0, N );
+		}
+		if ( dt === 'binary' ) {
+			return arraybuffer2buffer( ab, 0, size );
+		}
+		return new ctor( ab, 0, size );
+	}
+
+	/**
+	* Returns an uninitialized contiguous linear ndarray data buffer.
+	*
+	* @param {*} dtype - data type
+	* @param {NonNegativeInteger} size - buffer size
+	* @returns {(Array|TypedArray|Buffer|null)} data buffer
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.malloc( 'float64', 3 );
+	* // returns <Float64Array>
+	*/
+	function malloc( dtype, size ) {
+		return allocate( dtype, size, false );
+	}
+
+	/**
+	* Returns a zero-filled contiguous linear ndarray data buffer.
+	*
+	* @param {*} dtype - data type
+	* @param {NonNegativeInteger} size - buffer size
+	* @returns {(Array|TypedArray|Buffer|null)} data buffer
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.calloc( 'float64', 3 );
+	* // returns <Float64Array>[ 0.0, 0.0, 0.0 ]
+	*/
+	function calloc( dtype, size ) {
+		return allocate( dtype, size, true );
+	}
+
+	/**
+	* Releases a data buffer back to the pool.
+	*
+	* ## Notes
+	*
+	* -   A buffer is only retained if its underlying `ArrayBuffer` has the size of the size class corresponding to the buffer's byte length (as is the case for buffers returned by the pool) and retaining the buffer would not exceed the pool's high water mark.
+	* -   Once released, a buffer (and any view of the buffer's underlying memory) must not be used.
+	* -   A typed array, `Buffer`, or `ArrayBuffer` may only be released if its underlying `ArrayBuffer` was returned by the pool and has not already been released.
+	*
+	* @param {(TypedArray|Buffer|ArrayBuffer|Array)} buf - data buffer
+	* @throws {Error} buffer has already been released
+	* @throws {Error} buffer was not returned by the pool
+	* @returns {boolean} boolean indicating whether the buffer was retained by the pool
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.malloc( 'float64', 3 );
+	* // returns <Float64Array>
+	*
+	* var bool = pool.free( buf );
+	* // returns true
+	*/
+	function free( buf ) {
+		var ab;
+		var k;
+		var n;
+		if ( isArrayBuffer( buf ) ) {
+			ab = buf;
+			n = ab.byteLength;
+		} else if ( buf && isArrayBuffer( buf.buffer ) ) {
+			ab = buf.buffer;
+			n = buf.byteLength;
+		} else {
+			counters.rejections += 1;
+			return false;
+		}
+		if ( ab[ TAG ] === -id ) {
+			throw new Error( 'invalid argument. Buffer has already been released.' );
+		}
+		if ( ab[ TAG ] !== id ) {
+			throw new Error( 'invalid argument. Buffer was not allocated by the pool.' );
+		}
+		ab[ TAG ] = -id;
+		k = sizeClass( n );
+		if ( ab.byteLength !== classBytes( k ) || nbytes+ab.byteLength > opts.highWaterMark ) { // eslint-disable-line max-len
+			counters.rejections += 1;
+			return false;
+		}
+		if ( freelists[ k ] === void 0 ) {
+			freelists[ k ] = [];
+		}
+		freelists[ k ].push( ab );
+		nbytes += ab.byteLength;
+		counters.releases += 1;
+		return true;
+	}
+
+	/**
+	* Clears the pool, dropping all retained buffers.
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.malloc( 'float64', 3 );
+	* pool.free( buf );
+	*
+	* pool.clear();
+	*
+	* var n = pool.nbytes;
+	* // returns 0
+	*/
+	function clear() {
+		freelists = [];
+		nbytes = 0;
+	}
+
+	/**
+	* Returns pool allocation statistics.
+	*
+	* @returns {Object} allocation statistics
+	*
+	* @example
+	* var pool = bufferPool();
+	*
+	* var buf = pool.malloc( 'float64', 3 );
+	*
+	* var s = pool.stats();
+	* // returns { 'allocations': 1, 'hits': 0, 'misses': 1, 'releases': 0, 'rejections': 0, 'nbytes': 0 }
+	*/
+	function stats() {
+		return {
+			'allocations': counters.allocations,
+			'hits': counters.hits,
+			'misses': counters.misses,
+			'releases': counters.releases,
+			'rejections': counters.rejections,
+			'nbytes': nbytes
+		};
+	}
+
+	/**
+	* Returns the total number of bytes currently retained by the pool.
+	*
+	* @private
+	* @returns {NonNegativeInteger} number of bytes
+	*/
+	function getNBytes() {
+		return nbytes;
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = bufferPool;
@@ -0,0 +1,272 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2025 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var isFloat64Array = require( '@stdlib/assert/is-float64array' );
+var isInt32Array = require( '@stdlib/assert/is-int32array' );
+var isArray = require( '@stdlib/assert/is-array' );
+var bufferPool = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof bufferPool, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			bufferPool( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `highWaterMark` option', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		-1,
+		3.14,
+		NaN,
+		true,
+		null,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			bufferPool({
+				'highWaterMark': value
+			});
+		};
+	}
+});
+
+tape( 'the function returns a buffer pool', function test( t ) {
+	var pool = bufferPool({
+		'highWaterMark': 1024
+	});
+	t.strictEqual( typeof pool.malloc, 'function', 'has method' );
+	t.strictEqual( typeof pool.calloc, 'function', 'has method' );
+	t.strictEqual( typeof pool.free, 'function', 'has method' );
+	t.strictEqual( typeof pool.clear, 'function', 'has method' );
+	t.strictEqual( typeof pool.stats, 'function', 'has method' );
+	t.strictEqual( pool.highWaterMark, 1024, 'returns expected value' );
+	t.strictEqual( pool.nbytes, 0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool returns data buffers having a specified data type and length', function test( t ) {
+	var pool;
+	var buf;
+
+	pool = bufferPool();
+
+	buf = pool.malloc( 'float64', 3 );
+	t.strictEqual( isFloat64Array( buf ), true, 'returns expected value' );
+	t.strictEqual( buf.length, 3, 'returns expected value' );
+
+	buf = pool.calloc( 'int32', 5 );
+	t.strictEqual( isInt32Array( buf ), true, 'returns expected value' );
+	t.strictEqual( buf.length, 5, 'returns expected value' );
+
+	buf = pool.calloc( 'generic', 2 );
+	t.strictEqual( isArray( buf ), true, 'returns expected value' );
+	t.deepEqual( buf, [ 0, 0 ], 'returns expected value' );
+
+	buf = pool.malloc( 'foo', 2 );
+	t.strictEqual( buf, null, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool reuses released buffers', function test( t ) {
+	var pool;
+	var buf1;
+	var buf2;
+	var s;
+
+	pool = bufferPool();
+
+	buf1 = pool.malloc( 'float64', 3 );
+	t.strictEqual( pool.free( buf1 ), true, 'returns expected value' );
+	t.strictEqual( pool.nbytes, 32, 'returns expected value' );
+
+	buf2 = pool.malloc( 'int32', 5 );
+	t.strictEqual( buf2.buffer, buf1.buffer, 'returns expected value' );
+	t.strictEqual( pool.nbytes, 0, 'returns expected value' );
+
+	s = pool.stats();
+	t.deepEqual( s, {
+		'allocations': 2,
+		'hits': 1,
+		'misses': 1,
+		'releases': 1,
+		'rejections': 0,
+		'nbytes': 0
+	}, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool zero-fills reused buffers when allocating via `calloc`', function test( t ) {
+	var pool;
+	var buf;
+
+	pool = bufferPool();
+
+	buf = pool.malloc( 'float64', 4 );
+	buf[ 0 ] = 1.0;
+	buf[ 3 ] = 2.0;
+	pool.free( buf );
+
+	buf = pool.calloc( 'float64', 4 );
+	t.deepEqual( buf, new Float64Array( 4 ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool does not retain released buffers which would exceed the high water mark', function test( t ) {
+	var pool;
+	var buf1;
+	var buf2;
+
+	pool = bufferPool({
+		'highWaterMark': 32
+	});
+	buf1 = pool.malloc( 'float64', 4 );
+	buf2 = pool.malloc( 'float64', 4 );
+
+	t.strictEqual( pool.free( buf1 ), true, 'returns expected value' );
+	t.strictEqual( pool.free( buf2 ), false, 'returns expected value' );
+	t.strictEqual( pool.nbytes, 32, 'returns expected value' );
+	t.strictEqual( pool.stats().rejections, 1, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool does not retain "generic" data buffers', function test( t ) {
+	var pool = bufferPool();
+	t.strictEqual( pool.free( pool.malloc( 'generic', 3 ) ), false, 'returns expected value' );
+	t.strictEqual( pool.free( [ 1, 2, 3 ] ), false, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool throws an error if a buffer is released more than once', function test( t ) {
+	var pool;
+	var buf1;
+	var buf2;
+
+	pool = bufferPool({
+		'highWaterMark': 32
+	});
+	buf1 = pool.malloc( 'float64', 4 );
+	buf2 = pool.malloc( 'float64', 4 );
+
+	// Retained buffer:
+	pool.free( buf1 );
+	t.throws( release( buf1 ), Error, 'throws an error' );
+	t.throws( release( buf1.buffer ), Error, 'throws an error' );
+
+	// Buffer which is not retained due to the high water mark:
+	pool.free( buf2 );
+	t.throws( release( buf2 ), Error, 'throws an error' );
+
+	// Buffer which was dropped by clearing the pool:
+	pool.clear();
+	t.throws( release( buf1 ), Error, 'throws an error' );
+
+	t.strictEqual( pool.stats().releases, 1, 'returns expected value' );
+	t.strictEqual( pool.nbytes, 0, 'returns expected value' );
+	t.end();
+
+	function release( buf ) {
+		return function release() {
+			pool.free( buf );
+		};
+	}
+});
+
+tape( 'the pool supports releasing a reused buffer', function test( t ) {
+	var pool;
+	var buf;
+
+	pool = bufferPool();
+
+	buf = pool.malloc( 'float64', 4 );
+	t.strictEqual( pool.free( buf ), true, 'returns expected value' );
+
+	buf = pool.malloc( 'float64', 4 );
+	t.strictEqual( pool.free( buf ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the pool throws an error if provided a buffer which was not allocated by the pool', function test( t ) {
+	var other;
+	var pool;
+	var buf;
+
+	pool = bufferPool();
+	other = bufferPool();
+
+	buf = other.malloc( 'float64', 4 );
+
+	t.throws( release( new Float64Array( 4 ) ), Error, 'throws an error' );
+	t.throws( release( new ArrayBuffer( 32 ) ), Error, 'throws an error' );
+	t.throws( release( buf ), Error, 'throws an error' );
+
+	t.strictEqual( other.free( buf ), true, 'returns expected value' );
+	t.strictEqual( pool.nbytes, 0, 'returns expected value' );
+	t.end();
+
+	function release( buf ) {
+		return function release() {
+			pool.free( buf );
+		};
+	}
+});
@@ -44,6 +44,8 @@ int64_t stdlib_ndarray_bytes_per_element( const enum STDLIB_NDARRAY_DTYPE dtype
 		return STDLIB_NDARRAY_FLOAT64_BYTES_PER_ELEMENT;
 	case STDLIB_NDARRAY_FLOAT32:
 		return STDLIB_NDARRAY_FLOAT32_BYTES_PER_ELEMENT;
+	case STDLIB_NDARRAY_FLOAT16:
+		return STDLIB_NDARRAY_FLOAT16_BYTES_PER_ELEMENT;
 
 	case STDLIB_NDARRAY_INT8:
 		return STDLIB_NDARRAY_INT8_BYTES_PER_ELEMENT;
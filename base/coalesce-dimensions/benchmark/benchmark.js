@@ -0,0 +1,118 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isArrayArray = require( '@stdlib/assert/is-array-array' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var coalesce = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s::row-major', pkg ), function benchmark( b ) {
+	var strides;
+	var shape;
+	var out;
+	var st;
+	var i;
+
+	shape = [ 10, 10, 10 ];
+	strides = [
+		[ 100, 10, 1 ],
+		[ 200, 10, 1 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		st = strides[ i%strides.length ];
+		out = coalesce( shape, [ st, strides[ 0 ] ] );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isArrayArray( out ) ) {
+		b.fail( 'should return an array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::column-major', pkg ), function benchmark( b ) {
+	var strides;
+	var shape;
+	var out;
+	var st;
+	var i;
+
+	shape = [ 10, 10, 10 ];
+	strides = [
+		[ 1, 10, 100 ],
+		[ 1, 10, 200 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		st = strides[ i%strides.length ];
+		out = coalesce( shape, [ st, strides[ 0 ] ] );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isArrayArray( out ) ) {
+		b.fail( 'should return an array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::singleton_dimensions', pkg ), function benchmark( b ) {
+	var strides;
+	var shape;
+	var out;
+	var st;
+	var i;
+
+	shape = [ 10, 1, 10, 1 ];
+	strides = [
+		[ 20, 10, 1, 1 ],
+		[ -10, 10, 1, 1 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		st = strides[ i%strides.length ];
+		out = coalesce( shape, [ st, strides[ 0 ] ] );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isArrayArray( out ) ) {
+		b.fail( 'should return an array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
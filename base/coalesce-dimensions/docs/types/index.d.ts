@@ -0,0 +1,75 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+
+/**
+* Coalesces adjacent ndarray dimensions which can be iterated over as a single dimension.
+*
+* ## Notes
+*
+* -   The returned array has the following elements:
+*
+*     ```text
+*     [ <shape>, ...<strides> ]
+*     ```
+*
+*     where
+*
+*     -   **shape**: coalesced dimensions.
+*     -   **...strides**: coalesced strides for each respective ndarray.
+*
+* -   Adjacent dimensions `i` and `i+1` are merged when, for **every** ndarray, either `strides[i] == shape[i+1]*strides[i+1]` (row-major) or `strides[i+1] == shape[i]*strides[i]` (column-major).
+*
+* -   Singleton dimensions do not affect iteration and are removed. If every dimension is a singleton dimension, the function returns a one-dimensional shape containing a single element.
+*
+* -   The function assumes that all ndarrays have the same shape. Hence, dimensions should only be coalesced **after** broadcasting.
+*
+* @param shape - array dimensions
+* @param strides - list of stride arrays containing the stride lengths for each ndarray
+* @returns coalesced dimensions and strides
+*
+* @example
+* var sh = [ 2, 3, 4 ];
+*
+* var sx = [ 12, 4, 1 ]; // row-major
+* var sy = [ 24, 8, 2 ]; // row-major
+*
+* var o = coalesce( sh, [ sx, sy ] );
+* // returns [...]
+*
+* var csh = o[ 0 ];
+* // returns [ 24 ]
+*
+* var csx = o[ 1 ];
+* // returns [ 1 ]
+*
+* var csy = o[ 2 ];
+* // returns [ 2 ]
+*/
+declare function coalesce( shape: ArrayLike<number>, strides: ArrayLike<ArrayLike<number>> ): Array<Array<number>>;
+
+
+// EXPORTS //
+
+export = coalesce;
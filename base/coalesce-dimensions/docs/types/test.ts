@@ -0,0 +1,92 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import coalesce = require( './index' );
+
+
+// TESTS //
+
+// The function returns an array of arrays...
+{
+	const sh = [ 2, 2 ];
+	const sx = [ 2, 1 ];
+	const sy = [ 2, 1 ];
+	const sz = [ 4, 2 ];
+	coalesce( sh, [ sx, sy, sz ] ); // $ExpectType number[][]
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object of numbers...
+{
+	const sx = [ 2, 1 ];
+	const sy = [ 2, 1 ];
+	const sz = [ 4, 2 ];
+
+	coalesce( true, [ sx, sy, sz ] ); // $ExpectError
+	coalesce( false, [ sx, sy, sz ] ); // $ExpectError
+	coalesce( '5', [ sx, sy, sz ] ); // $ExpectError
+	coalesce( 123, [ sx, sy, sz ] ); // $ExpectError
+	coalesce( {}, [ sx, sy, sz ] ); // $ExpectError
+	coalesce( ( x: number ): number => x, [ sx, sy, sz ] ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an array-like object containing arrays of numbers...
+{
+	const sh = [ 2, 2 ];
+	const sx = [ 2, 1 ];
+	const sy = [ 2, 1 ];
+	const sz = [ 4, 2 ];
+
+	coalesce( sh, true ); // $ExpectError
+	coalesce( sh, false ); // $ExpectError
+	coalesce( sh, '5' ); // $ExpectError
+	coalesce( sh, 123 ); // $ExpectError
+	coalesce( sh, {} ); // $ExpectError
+	coalesce( sh, ( x: number ): number => x ); // $ExpectError
+
+	coalesce( sh, [ true, sy, sz ] ); // $ExpectError
+	coalesce( sh, [ false, sy, sz ] ); // $ExpectError
+	coalesce( sh, [ '5', sy, sz ] ); // $ExpectError
+	coalesce( sh, [ 123, sy, sz ] ); // $ExpectError
+	coalesce( sh, [ {}, sy, sz ] ); // $ExpectError
+	coalesce( sh, [ ( x: number ): number => x, sy, sz ] ); // $ExpectError
+
+	coalesce( sh, [ sx, true, sz ] ); // $ExpectError
+	coalesce( sh, [ sx, false, sz ] ); // $ExpectError
+	coalesce( sh, [ sx, '5', sz ] ); // $ExpectError
+	coalesce( sh, [ sx, 123, sz ] ); // $ExpectError
+	coalesce( sh, [ sx, {}, sz ] ); // $ExpectError
+
+	coalesce( sh, [ sx, sy, true ] ); // $ExpectError
+	coalesce( sh, [ sx, sy, false ] ); // $ExpectError
+	coalesce( sh, [ sx, sy, '5' ] ); // $ExpectError
+	coalesce( sh, [ sx, sy, 123 ] ); // $ExpectError
+	coalesce( sh, [ sx, sy, {} ] ); // $ExpectError
+	coalesce( sh, [ sx, sy, ( x: number ): number => x ] ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const sh = [ 2, 2 ];
+	const sx = [ 2, 1 ];
+	const sy = [ 2, 1 ];
+	const sz = [ 4, 2 ];
+
+	coalesce(); // $ExpectError
+	coalesce( sh ); // $ExpectError
+	coalesce( sh, [ sx, sy, sz ], [] ); // $ExpectError
+}
@@ -0,0 +1,42 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var coalesce = require( './../lib' );
+
+// Define the shape of a view containing every other row of a row-major 200x3x1000 array:
+var shape = [ 100, 3, 1000 ];
+
+// Define the strides for the input view:
+var sx = [ 6000, 1000, 1 ];
+
+// Define the strides for a contiguous row-major output array:
+var sy = [ 3000, 1000, 1 ];
+
+// Coalesce the dimensions which are jointly contiguous:
+var o = coalesce( shape, [ sx, sy ] );
+console.log( 'shape: [ %s ]', o[ 0 ].join( ', ' ) );
+// => 'shape: [ 100, 3000 ]'
+
+console.log( 'strides(x): [ %s ]', o[ 1 ].join( ', ' ) );
+// => 'strides(x): [ 6000, 1 ]'
+
+console.log( 'strides(y): [ %s ]', o[ 2 ].join( ', ' ) );
+// => 'strides(y): [ 3000, 1 ]'
@@ -0,0 +1,55 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+/**
+* Coalesce adjacent ndarray dimensions which can be iterated over as a single dimension.
+*
+* @module @stdlib/ndarray/base/coalesce-dimensions
+*
+* @example
+* var coalesce = require( '@stdlib/ndarray/base/coalesce-dimensions' );
+*
+* var sh = [ 100, 3, 1000 ];
+*
+* var sx = [ 6000, 1000, 1 ]; // row-major (non-contiguous)
+* var sy = [ 3000, 1000, 1 ]; // row-major
+*
+* var o = coalesce( sh, [ sx, sy ] );
+* // returns [...]
+*
+* var csh = o[ 0 ];
+* // returns [ 100, 3000 ]
+*
+* var csx = o[ 1 ];
+* // returns [ 6000, 1 ]
+*
+* var csy = o[ 2 ];
+* // returns [ 3000, 1 ]
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -0,0 +1,182 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// FUNCTIONS //
+
+/**
+* Tests whether, for every ndarray, the stride of a retained dimension equals the stride of a candidate dimension multiplied by a provided number of elements.
+*
+* @private
+* @param {Array<Array>} out - output data (shape followed by stride arrays)
+* @param {NonNegativeInteger} k - retained dimension index
+* @param {ArrayLikeObject<ArrayLikeObject<integer>>} strides - list of stride arrays
+* @param {NonNegativeInteger} i - candidate dimension index
+* @param {PositiveInteger} N - number of elements
+* @returns {boolean} boolean indicating whether the retained dimension is an outer dimension with respect to the candidate dimension
+*/
+function isOuter( out, k, strides, i, N ) {
+	var j;
+	for ( j = 0; j < strides.length; j++ ) {
+		if ( out[ j+1 ][ k ] !== N*strides[ j ][ i ] ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* Tests whether, for every ndarray, the stride of a candidate dimension equals the stride of a retained dimension multiplied by a provided number of elements.
+*
+* @private
+* @param {Array<Array>} out - output data (shape followed by stride arrays)
+* @param {NonNegativeInteger} k - retained dimension index
+* @param {ArrayLikeObject<ArrayLikeObject<integer>>} strides - list of stride arrays
+* @param {NonNegativeInteger} i - candidate dimension index
+* @param {PositiveInteger} N - number of elements
+* @returns {boolean} boolean indicating whether the retained dimension is an inner dimension with respect to the candidate dimension
+*/
+function isInner( out, k, strides, i, N ) {
+	var j;
+	for ( j = 0; j < strides.length; j++ ) {
+		if ( strides[ j ][ i ] !== N*out[ j+1 ][ k ] ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// MAIN //
+
+/**
+* Coalesces adjacent ndarray dimensions which can be iterated over as a single dimension.
+*
+* ## Notes
+*
+* -   The returned array has the following elements:
+*
+*     ```text
+*     [ <shape>, ...<strides> ]
+*     ```
+*
+*     where
+*
+*     -   **shape**: coalesced dimensions.
+*     -   **...strides**: coalesced strides for each respective ndarray.
+*
+* -   Adjacent dimensions `i` and `i+1` are merged when, for **every** ndarray, either `strides[i] == shape[i+1]*strides[i+1]` (row-major) or `strides[i+1] == shape[i]*strides[i]` (column-major).
+*
+* -   Singleton dimensions do not affect iteration and are removed. If every dimension is a singleton dimension, the function returns a one-dimensional shape containing a single element.
+*
+* -   The function assumes that all ndarrays have the same shape. Hence, dimensions should only be coalesced **after** broadcasting.
+*
+* @param {NonNegativeIntegerArray} shape - array dimensions
+* @param {ArrayLikeObject<ArrayLikeObject<integer>>} strides - list of stride arrays containing the stride lengths for each ndarray
+* @returns {Array<Array>} coalesced dimensions and strides
+*
+* @example
+* var sh = [ 2, 3, 4 ];
+*
+* var sx = [ 12, 4, 1 ]; // row-major
+* var sy = [ 24, 8, 2 ]; // row-major
+*
+* var o = coalesce( sh, [ sx, sy ] );
+* // returns [...]
+*
+* var csh = o[ 0 ];
+* // returns [ 24 ]
+*
+* var csx = o[ 1 ];
+* // returns [ 1 ]
+*
+* var csy = o[ 2 ];
+* // returns [ 2 ]
+*
+* @example
+* var sh = [ 2, 3, 4 ];
+*
+* var sx = [ 24, 4, 1 ]; // row-major (non-contiguous)
+* var sy = [ 12, 4, 1 ]; // row-major
+*
+* var o = coalesce( sh, [ sx, sy ] );
+* // returns [ [ 2, 12 ], [ 24, 1 ], [ 12, 1 ] ]
+*/
+function coalesce( shape, strides ) {
+	var out;
+	var sh;
+	var N;
+	var M;
+	var d;
+	var k;
+	var i;
+	var j;
+
+	N = strides.length;
+
+	sh = [];
+	out = [ sh ];
+	for ( j = 0; j < N; j++ ) {
+		out.push( [] );
+	}
+	for ( i = 0; i < shape.length; i++ ) {
+		d = shape[ i ];
+
+		// Skip singleton dimensions...
+		if ( d === 1 ) {
+			continue;
+		}
+		k = sh.length - 1; // index of the most recently retained dimension
+		if ( k >= 0 ) {
+			M = sh[ k ];
+
+			// Check whether the current dimension is contiguous with respect to the retained dimension (e.g., row-major)...
+			if ( isOuter( out, k, strides, i, d ) ) {
+				sh[ k ] *= d;
+				for ( j = 0; j < N; j++ ) {
+					out[ j+1 ][ k ] = strides[ j ][ i ];
+				}
+				continue;
+			}
+			// Check whether the retained dimension is contiguous with respect to the current dimension (e.g., column-major)...
+			if ( isInner( out, k, strides, i, M ) ) {
+				sh[ k ] *= d;
+				continue;
+			}
+		}
+		sh.push( d );
+		for ( j = 0; j < N; j++ ) {
+			out[ j+1 ].push( strides[ j ][ i ] );
+		}
+	}
+	// Check whether every dimension was a singleton dimension...
+	if ( sh.length === 0 && shape.length > 0 ) {
+		i = shape.length - 1;
+		sh.push( 1 );
+		for ( j = 0; j < N; j++ ) {
+			out[ j+1 ].push( strides[ j ][ i ] );
+		}
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = coalesce;
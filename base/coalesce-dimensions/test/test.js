@@ -0,0 +1,189 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var isArray = require( '@stdlib/assert/is-array' );
+var coalesce = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof coalesce, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function coalesces contiguous dimensions (row-major)', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var o;
+
+	sh = [ 2, 3, 4 ];
+	sx = [ 12, 4, 1 ];
+	sy = [ -24, -8, -2 ];
+
+	o = coalesce( sh, [ sx, sy ] );
+
+	t.notEqual( o[ 0 ], sh, 'returns expected value' );
+	t.strictEqual( isArray( o[ 0 ] ), true, 'returns expected value' );
+	t.deepEqual( o[ 0 ], [ 24 ], 'returns expected value' );
+
+	t.notEqual( o[ 1 ], sx, 'returns expected value' );
+	t.strictEqual( isArray( o[ 1 ] ), true, 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1 ], 'returns expected value' );
+
+	t.notEqual( o[ 2 ], sy, 'returns expected value' );
+	t.strictEqual( isArray( o[ 2 ] ), true, 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ -2 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function coalesces contiguous dimensions (column-major)', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var o;
+
+	sh = [ 2, 3, 4 ];
+	sx = [ 1, 2, 6 ];
+	sy = [ 2, 4, 12 ];
+
+	o = coalesce( sh, [ sx, sy ] );
+
+	t.deepEqual( o[ 0 ], [ 24 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 2 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function coalesces partially contiguous dimensions', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var o;
+
+	sh = [ 100, 3, 1000 ];
+	sx = [ 6000, 1000, 1 ];
+	sy = [ 3000, 1000, 1 ];
+
+	o = coalesce( sh, [ sx, sy ] );
+	t.deepEqual( o[ 0 ], [ 100, 3000 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 6000, 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 3000, 1 ], 'returns expected value' );
+
+	sh = [ 4, 3, 2 ];
+	sx = [ 1, 4, 24 ];
+	sy = [ 1, 4, 12 ];
+
+	o = coalesce( sh, [ sx, sy ] );
+	t.deepEqual( o[ 0 ], [ 12, 2 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1, 24 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 1, 12 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function only coalesces dimensions which are contiguous for every ndarray', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var o;
+
+	sh = [ 2, 3, 4 ];
+	sx = [ 12, 4, 1 ]; // row-major
+	sy = [ 1, 2, 6 ]; // column-major
+
+	o = coalesce( sh, [ sx, sy ] );
+	t.deepEqual( o[ 0 ], [ 2, 3, 4 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 12, 4, 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 1, 2, 6 ], 'returns expected value' );
+
+	sh = [ 2, 3, 4 ];
+	sx = [ 12, 4, 1 ];
+	sy = [ 24, 4, 1 ];
+
+	o = coalesce( sh, [ sx, sy ] );
+	t.deepEqual( o[ 0 ], [ 2, 12 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 12, 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 24, 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function removes singleton dimensions', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var o;
+
+	sh = [ 1, 5, 1, 1 ];
+	sx = [ 10, 2, 99, 1 ];
+	sy = [ 5, -1, 1, 1 ];
+
+	o = coalesce( sh, [ sx, sy ] );
+	t.deepEqual( o[ 0 ], [ 5 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 2 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ -1 ], 'returns expected value' );
+
+	sh = [ 2, 1, 3 ];
+	sx = [ 3, 7, 1 ];
+
+	o = coalesce( sh, [ sx ] );
+	t.deepEqual( o[ 0 ], [ 6 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a one-dimensional shape if every dimension is a singleton dimension', function test( t ) {
+	var o = coalesce( [ 1, 1, 1 ], [ [ 3, 2, 1 ], [ 1, 1, -1 ] ] );
+	t.deepEqual( o[ 0 ], [ 1 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ -1 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional ndarrays', function test( t ) {
+	var o = coalesce( [], [ [], [] ] );
+	t.deepEqual( o, [ [], [], [] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function does not mutate the provided arrays', function test( t ) {
+	var sh;
+	var sx;
+	var o;
+
+	sh = [ 2, 1, 3 ];
+	sx = [ 3, 3, 1 ];
+
+	o = coalesce( sh, [ sx ] );
+	t.deepEqual( o[ 0 ], [ 6 ], 'returns expected value' );
+	t.deepEqual( sh, [ 2, 1, 3 ], 'returns expected value' );
+	t.deepEqual( sx, [ 3, 3, 1 ], 'returns expected value' );
+	t.end();
+});
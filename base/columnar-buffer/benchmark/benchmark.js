@@ -0,0 +1,119 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isCollection = require( '@stdlib/assert/is-collection' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var columnarBuffer = require( './../lib' );
+
+
+// VARIABLES //
+
+var FIELDS = [
+	{
+		'name': 'x',
+		'type': 'float64'
+	},
+	{
+		'name': 'y',
+		'type': 'float64'
+	},
+	{
+		'name': 'id',
+		'type': 'int32'
+	}
+];
+
+
+// MAIN //
+
+bench( pkg, function benchmark( b ) {
+	var out;
+	var i;
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = columnarBuffer( FIELDS, 10 );
+		if ( out.length !== 10 ) {
+			b.fail( 'should have length 10' );
+		}
+	}
+	b.toc();
+	if ( !isCollection( out ) ) {
+		b.fail( 'should return an array-like object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:get', pkg ), function benchmark( b ) {
+	var buf;
+	var v;
+	var i;
+
+	buf = columnarBuffer( FIELDS, 10 );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		v = buf.get( i%10 );
+		v.x = i;
+		if ( v.x !== i ) {
+			b.fail( 'unexpected result' );
+		}
+	}
+	b.toc();
+	if ( typeof v !== 'object' ) {
+		b.fail( 'should return an object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:set', pkg ), function benchmark( b ) {
+	var buf;
+	var v;
+	var i;
+
+	buf = columnarBuffer( FIELDS, 10 );
+	v = {
+		'x': 0.0,
+		'y': 0.0,
+		'id': 0
+	};
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		v.x = i;
+		buf.set( v, i%10 );
+		if ( buf.columnOf( 'x' )[ i%10 ] !== i ) {
+			b.fail( 'unexpected result' );
+		}
+	}
+	b.toc();
+	if ( !isCollection( buf ) ) {
+		b.fail( 'should return an array-like object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
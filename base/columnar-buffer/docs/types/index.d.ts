@@ -0,0 +1,135 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { Collection, AccessorArrayLike } from '@stdlib/types/array';
+import { DataType } from '@stdlib/types/ndarray';
+
+/**
+* Field object.
+*/
+interface Field {
+	/**
+	* Field name.
+	*/
+	name: string;
+
+	/**
+	* Field data type.
+	*/
+	type: DataType;
+}
+
+/**
+* Record view of a buffer element.
+*/
+interface Record {
+	/**
+	* Field values.
+	*/
+	[key: string]: any;
+
+	/**
+	* Serializes a record to JSON.
+	*
+	* @returns JSON object
+	*/
+	toJSON(): { [key: string]: any };
+}
+
+/**
+* Struct-of-arrays (columnar) data buffer.
+*/
+interface ColumnarBuffer extends AccessorArrayLike<Record> {
+	/**
+	* List of field names.
+	*/
+	readonly fields: Array<string>;
+
+	/**
+	* Returns a record view of a buffer element.
+	*
+	* @param idx - element index
+	* @returns record view
+	*/
+	get( idx: number ): Record;
+
+	/**
+	* Sets a buffer element.
+	*
+	* @param value - object whose properties correspond to field names
+	* @param idx - element index
+	*/
+	set( value: { [key: string]: any }, idx?: number ): void;
+
+	/**
+	* Returns the array containing the values of a specified field.
+	*
+	* @param field - field name
+	* @returns field array
+	*/
+	columnOf( field: string ): Collection;
+
+	/**
+	* Returns the data type of a specified field.
+	*
+	* @param field - field name
+	* @returns data type
+	*/
+	dtypeOf( field: string ): DataType;
+}
+
+/**
+* Returns a zero-filled struct-of-arrays (columnar) data buffer.
+*
+* ## Notes
+*
+* -   Each field is stored in a separate contiguous array having the field data type. Hence, for an ndarray backed by the returned buffer, the elements of a single field share the ndarray's shape, strides, and index offset, and can be viewed as a plain numeric ndarray.
+* -   The returned buffer supports the accessor protocol. Retrieving an element returns a record view whose properties read from and write to the underlying field arrays. Setting an element copies the same-named properties of a provided object (e.g., a `struct` instance) into the field arrays.
+* -   The function returns `null` if a field does not have a supported data type. Fields must have a numeric or boolean data type, and nested `struct` and array fields are not supported.
+*
+* @param fields - list of field objects
+* @param size - number of elements
+* @returns data buffer
+*
+* @example
+* var buf = columnarBuffer( [ { 'name': 'x', 'type': 'float64' }, { 'name': 'y', 'type': 'int32' } ], 3 );
+* // returns <ColumnarBuffer>
+*
+* var v = buf.get( 1 );
+* // returns <Record>
+*
+* v.x = 3.5;
+* v.y = 4;
+*
+* var x = buf.columnOf( 'x' );
+* // returns <Float64Array>[ 0.0, 3.5, 0.0 ]
+*
+* var y = buf.columnOf( 'y' );
+* // returns <Int32Array>[ 0, 4, 0 ]
+*/
+declare function columnarBuffer( fields: ArrayLike<Field>, size: number ): ColumnarBuffer | null;
+
+
+// EXPORTS //
+
+export = columnarBuffer;
@@ -0,0 +1,62 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+import columnarBuffer = require( './index' );
+
+
+// TESTS //
+
+// The function returns a data buffer or null...
+{
+	columnarBuffer( [ { 'name': 'x', 'type': 'float64' } ], 3 ); // $ExpectType ColumnarBuffer | null
+}
+
+// The compiler throws an error if the function is not provided a first argument which is an array-like object of field objects...
+{
+	columnarBuffer( '5', 3 ); // $ExpectError
+	columnarBuffer( 5, 3 ); // $ExpectError
+	columnarBuffer( true, 3 ); // $ExpectError
+	columnarBuffer( false, 3 ); // $ExpectError
+	columnarBuffer( null, 3 ); // $ExpectError
+	columnarBuffer( {}, 3 ); // $ExpectError
+	columnarBuffer( [ '5' ], 3 ); // $ExpectError
+	columnarBuffer( ( x: number ): number => x, 3 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is not provided a second argument which is a number...
+{
+	const fields = [ { 'name': 'x', 'type': 'float64' } ];
+
+	columnarBuffer( fields, '5' ); // $ExpectError
+	columnarBuffer( fields, true ); // $ExpectError
+	columnarBuffer( fields, false ); // $ExpectError
+	columnarBuffer( fields, null ); // $ExpectError
+	columnarBuffer( fields, {} ); // $ExpectError
+	columnarBuffer( fields, [] ); // $ExpectError
+	columnarBuffer( fields, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const fields = [ { 'name': 'x', 'type': 'float64' } ];
+
+	columnarBuffer(); // $ExpectError
+	columnarBuffer( fields ); // $ExpectError
+	columnarBuffer( fields, 3, {} ); // $ExpectError
+}
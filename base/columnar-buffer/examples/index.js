@@ -0,0 +1,55 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var discreteUniform = require( '@stdlib/random/base/discrete-uniform' );
+var uniform = require( '@stdlib/random/base/uniform' );
+var columnarBuffer = require( './../lib' );
+
+// Define the fields of a record:
+var fields = [
+	{
+		'name': 'price',
+		'type': 'float64'
+	},
+	{
+		'name': 'quantity',
+		'type': 'int32'
+	}
+];
+
+// Create a columnar data buffer:
+var buf = columnarBuffer( fields, 5 );
+
+// Assign records:
+var i;
+for ( i = 0; i < buf.length; i++ ) {
+	buf.set({
+		'price': uniform( 1.0, 100.0 ),
+		'quantity': discreteUniform( 1, 10 )
+	}, i );
+}
+
+// Each field is stored in a separate contiguous array:
+console.log( buf.columnOf( 'price' ) );
+console.log( buf.columnOf( 'quantity' ) );
+
+// Retrieve a record view:
+console.log( JSON.stringify( buf.get( 2 ) ) );
@@ -0,0 +1,53 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+/**
+* Create a zero-filled struct-of-arrays (columnar) data buffer.
+*
+* @module @stdlib/ndarray/base/columnar-buffer
+*
+* @example
+* var columnarBuffer = require( '@stdlib/ndarray/base/columnar-buffer' );
+*
+* var buf = columnarBuffer( [ { 'name': 'x', 'type': 'float64' }, { 'name': 'y', 'type': 'int32' } ], 3 );
+* // returns <ColumnarBuffer>
+*
+* var v = buf.get( 1 );
+* // returns <Record>
+*
+* v.x = 3.5;
+* v.y = 4;
+*
+* var x = buf.columnOf( 'x' );
+* // returns <Float64Array>[ 0.0, 3.5, 0.0 ]
+*
+* var y = buf.columnOf( 'y' );
+* // returns <Int32Array>[ 0, 4, 0 ]
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -0,0 +1,258 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var setNonEnumerableReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var setReadWriteAccessor = require( '@stdlib/utils/define-read-write-accessor' );
+var resolveGetter = require( '@stdlib/array/base/resolve-getter' );
+var resolveSetter = require( '@stdlib/array/base/resolve-setter' );
+var isDataTypeString = require( './../../../base/assert/is-data-type-string' );
+var buffer = require( './../../../base/buffer' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns an accessor for returning a field value.
+*
+* @private
+* @param {Collection} arr - column array
+* @param {Function} get - column element accessor
+* @returns {Function} accessor
+*/
+function getValue( arr, get ) {
+	return getter;
+
+	/**
+	* Returns a field value.
+	*
+	* @private
+	* @returns {*} result
+	*/
+	function getter() {
+		return get( arr, this._i ); // eslint-disable-line no-invalid-this
+	}
+}
+
+/**
+* Returns an accessor for setting a field value.
+*
+* @private
+* @param {Collection} arr - column array
+* @param {Function} set - column element accessor
+* @returns {Function} accessor
+*/
+function setValue( arr, set ) {
+	return setter;
+
+	/**
+	* Sets a field value.
+	*
+	* @private
+	* @param {*} value - value to set
+	*/
+	function setter( value ) {
+		set( arr, this._i, value ); // eslint-disable-line no-invalid-this
+	}
+}
+
+
+// MAIN //
+
+/**
+* Returns a zero-filled struct-of-arrays (columnar) data buffer.
+*
+* ## Notes
+*
+* -   Each field is stored in a separate contiguous array having the field data type. Hence, for an ndarray backed by the returned buffer, the elements of a single field share the ndarray's shape, strides, and index offset, and can be viewed as a plain numeric ndarray.
+* -   The returned buffer supports the accessor protocol. Retrieving an element returns a record view whose properties read from and write to the underlying field arrays. Setting an element copies the same-named properties of a provided object (e.g., a `struct` instance) into the field arrays.
+* -   The function returns `null` if a field does not have a supported data type. Fields must have a numeric or boolean data type, and nested `struct` and array fields are not supported.
+*
+* @param {ArrayLikeObject<Object>} fields - list of field objects, each having a `name` and a `type` property
+* @param {NonNegativeInteger} size - number of elements
+* @returns {(Object|null)} data buffer
+*
+* @example
+* var buf = columnarBuffer( [ { 'name': 'x', 'type': 'float64' }, { 'name': 'y', 'type': 'int32' } ], 3 );
+* // returns <ColumnarBuffer>
+*
+* var v = buf.get( 1 );
+* // returns <Record>
+*
+* v.x = 3.5;
+* v.y = 4;
+*
+* var x = buf.columnOf( 'x' );
+* // returns <Float64Array>[ 0.0, 3.5, 0.0 ]
+*
+* var y = buf.columnOf( 'y' );
+* // returns <Int32Array>[ 0, 4, 0 ]
+*/
+function columnarBuffer( fields, size ) {
+	var columns;
+	var getters;
+	var setters;
+	var dtypes;
+	var names;
+	var name;
+	var dt;
+	var M;
+	var i;
+
+	M = fields.length;
+	columns = {};
+	getters = [];
+	setters = [];
+	dtypes = {};
+	names = [];
+	for ( i = 0; i < M; i++ ) {
+		name = fields[ i ].name;
+		dt = fields[ i ].type;
+		if ( !isDataTypeString( dt ) || dt === 'generic' || dt === 'binary' || fields[ i ].length !== void 0 ) {
+			return null;
+		}
+		columns[ name ] = buffer( dt, size );
+		if ( columns[ name ] === null ) {
+			return null;
+		}
+		getters.push( resolveGetter( columns[ name ] ) );
+		setters.push( resolveSetter( columns[ name ] ) );
+		dtypes[ name ] = dt;
+		names.push( name );
+	}
+
+	/**
+	* Constructor for creating a record view of a buffer element.
+	*
+	* @private
+	* @constructor
+	* @param {NonNegativeInteger} i - element index
+	* @returns {Record} record instance
+	*/
+	function Record( i ) { // eslint-disable-line stdlib/no-unnecessary-nested-functions
+		setNonEnumerableReadOnly( this, '_i', i );
+		return this;
+	}
+
+	// Define read/write accessors for each field...
+	for ( i = 0; i < M; i++ ) {
+		setReadWriteAccessor( Record.prototype, names[ i ], getValue( columns[ names[ i ] ], getters[ i ] ), setValue( columns[ names[ i ] ], setters[ i ] ) ); // eslint-disable-line max-len
+	}
+	// Ensure that a record correctly serializes to JSON:
+	setNonEnumerableReadOnly( Record.prototype, 'toJSON', toJSON );
+
+	/**
+	* Constructor for a columnar data buffer.
+	*
+	* @private
+	* @constructor
+	* @returns {ColumnarBuffer} buffer instance
+	*/
+	function ColumnarBuffer() { // eslint-disable-line stdlib/no-unnecessary-nested-functions
+		setNonEnumerableReadOnly( this, 'length', size );
+		return this;
+	}
+
+	setNonEnumerableReadOnly( ColumnarBuffer.prototype, 'fields', names.slice() );
+	setNonEnumerableReadOnly( ColumnarBuffer.prototype, 'get', get );
+	setNonEnumerableReadOnly( ColumnarBuffer.prototype, 'set', set );
+	setNonEnumerableReadOnly( ColumnarBuffer.prototype, 'columnOf', columnOf );
+	setNonEnumerableReadOnly( ColumnarBuffer.prototype, 'dtypeOf', dtypeOf );
+
+	return new ColumnarBuffer();
+
+	/**
+	* Returns a record view of a buffer element.
+	*
+	* @private
+	* @param {NonNegativeInteger} idx - element index
+	* @returns {Record} record view
+	*/
+	function get( idx ) {
+		return new Record( idx );
+	}
+
+	/**
+	* Sets a buffer element.
+	*
+	* @private
+	* @param {Object} value - object whose properties correspond to field names
+	* @param {NonNegativeInteger} [idx=0] - element index
+	*/
+	function set( value, idx ) {
+		var k;
+		var j;
+		if ( idx === void 0 ) {
+			idx = 0;
+		}
+		for ( j = 0; j < M; j++ ) {
+			k = names[ j ];
+			setters[ j ]( columns[ k ], idx, value[ k ] );
+		}
+	}
+
+	/**
+	* Returns the array containing the values of a specified field.
+	*
+	* @private
+	* @param {string} field - field name
+	* @returns {Collection} field array
+	*/
+	function columnOf( field ) {
+		return columns[ field ];
+	}
+
+	/**
+	* Returns the data type of a specified field.
+	*
+	* @private
+	* @param {string} field - field name
+	* @returns {string} data type
+	*/
+	function dtypeOf( field ) {
+		return dtypes[ field ];
+	}
+
+	/**
+	* Serializes a record to JSON.
+	*
+	* @private
+	* @returns {Object} JSON object
+	*/
+	function toJSON() {
+		var out;
+		var k;
+		var j;
+
+		out = {};
+		for ( j = 0; j < M; j++ ) {
+			k = names[ j ];
+			out[ k ] = this[ k ]; // eslint-disable-line no-invalid-this
+		}
+		return out;
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = columnarBuffer;
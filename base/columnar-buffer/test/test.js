@@ -0,0 +1,142 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var columnarBuffer = require( './../lib' );
+
+
+// VARIABLES //
+
+var FIELDS = [
+	{
+		'name': 'x',
+		'type': 'float64'
+	},
+	{
+		'name': 'y',
+		'type': 'int32'
+	},
+	{
+		'name': 'z',
+		'type': 'uint8'
+	}
+];
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof columnarBuffer, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns a zero-filled data buffer having a separate array for each field', function test( t ) {
+	var buf = columnarBuffer( FIELDS, 4 );
+
+	t.strictEqual( buf.length, 4, 'returns expected value' );
+	t.deepEqual( buf.fields, [ 'x', 'y', 'z' ], 'returns expected value' );
+
+	t.strictEqual( buf.columnOf( 'x' ) instanceof Float64Array, true, 'returns expected value' );
+	t.strictEqual( buf.columnOf( 'y' ) instanceof Int32Array, true, 'returns expected value' );
+	t.strictEqual( buf.columnOf( 'z' ) instanceof Uint8Array, true, 'returns expected value' );
+
+	t.deepEqual( buf.columnOf( 'x' ), new Float64Array( 4 ), 'returns expected value' );
+	t.deepEqual( buf.columnOf( 'y' ), new Int32Array( 4 ), 'returns expected value' );
+	t.deepEqual( buf.columnOf( 'z' ), new Uint8Array( 4 ), 'returns expected value' );
+
+	t.strictEqual( buf.dtypeOf( 'x' ), 'float64', 'returns expected value' );
+	t.strictEqual( buf.dtypeOf( 'y' ), 'int32', 'returns expected value' );
+	t.strictEqual( buf.dtypeOf( 'z' ), 'uint8', 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a data buffer supporting the accessor protocol', function test( t ) {
+	var buf = columnarBuffer( FIELDS, 3 );
+
+	t.strictEqual( typeof buf.get, 'function', 'has method' );
+	t.strictEqual( typeof buf.set, 'function', 'has method' );
+
+	buf.set({
+		'x': 1.5,
+		'y': -2,
+		'z': 3
+	}, 1 );
+
+	t.deepEqual( buf.columnOf( 'x' ), new Float64Array( [ 0.0, 1.5, 0.0 ] ), 'returns expected value' );
+	t.deepEqual( buf.columnOf( 'y' ), new Int32Array( [ 0, -2, 0 ] ), 'returns expected value' );
+	t.deepEqual( buf.columnOf( 'z' ), new Uint8Array( [ 0, 3, 0 ] ), 'returns expected value' );
+
+	t.deepEqual( buf.get( 1 ).toJSON(), {
+		'x': 1.5,
+		'y': -2,
+		'z': 3
+	}, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a data buffer whose elements are record views', function test( t ) {
+	var buf;
+	var v;
+
+	buf = columnarBuffer( FIELDS, 3 );
+	v = buf.get( 2 );
+
+	v.x = 3.5;
+	v.y = 4;
+	v.z = 5;
+
+	t.strictEqual( v.x, 3.5, 'returns expected value' );
+	t.strictEqual( v.y, 4, 'returns expected value' );
+	t.strictEqual( v.z, 5, 'returns expected value' );
+
+	t.deepEqual( buf.columnOf( 'x' ), new Float64Array( [ 0.0, 0.0, 3.5 ] ), 'returns expected value' );
+	t.deepEqual( buf.columnOf( 'y' ), new Int32Array( [ 0, 0, 4 ] ), 'returns expected value' );
+	t.deepEqual( buf.columnOf( 'z' ), new Uint8Array( [ 0, 0, 5 ] ), 'returns expected value' );
+
+	t.strictEqual( JSON.stringify( v ), '{"x":3.5,"y":4,"z":5}', 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns `null` if a field does not have a supported data type', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		[ { 'name': 'x', 'type': 'foo' } ],
+		[ { 'name': 'x', 'type': 'generic' } ],
+		[ { 'name': 'x', 'type': 'binary' } ],
+		[ { 'name': 'x', 'type': 'float64', 'length': 2 } ],
+		[ { 'name': 'x', 'type': {} } ]
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.strictEqual( columnarBuffer( values[ i ], 3 ), null, 'returns expected value' );
+	}
+	t.end();
+});
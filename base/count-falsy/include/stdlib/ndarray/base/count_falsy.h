@@ -50,6 +50,9 @@
 #include "count-falsy/loops/k_i.h"
 #include "count-falsy/loops/k_l.h"
 
+#include "count-falsy/loops/l_i.h"
+#include "count-falsy/loops/l_l.h"
+
 #include "count-falsy/loops/s_i.h"
 #include "count-falsy/loops/s_l.h"
 
@@ -59,6 +62,9 @@
 #include "count-falsy/loops/u_i.h"
 #include "count-falsy/loops/u_l.h"
 
+#include "count-falsy/loops/v_i.h"
+#include "count-falsy/loops/v_l.h"
+
 #include "count-falsy/loops/x_i.h"
 #include "count-falsy/loops/x_l.h"
 
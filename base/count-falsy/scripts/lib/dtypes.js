@@ -28,8 +28,8 @@ var EXCLUDE_DTYPES = require( './exclude_dtypes.js' );
 
 // MAIN //
 
-// Resolve a list of dtypes for which we want to create loops:
-var DTYPES = filter( dtypes2strings( dtypes() ), EXCLUDE_DTYPES ).sort();
+// Resolve a list of dtypes for which we want to create loops (including 64-bit integer dtypes, which are only supported in C and are not included in the list of JavaScript dtypes):
+var DTYPES = filter( dtypes2strings( dtypes() ), EXCLUDE_DTYPES ).concat( [ 'int64', 'uint64' ] ).sort();
 
 
 // EXPORTS //
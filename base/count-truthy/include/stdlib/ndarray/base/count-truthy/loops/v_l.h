@@ -0,0 +1,150 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+* The following is auto-generated. Do not manually edit. See scripts/inline_loops.js.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_COUNT_TRUTHY_INLINE_V_L_H
+#define STDLIB_NDARRAY_BASE_COUNT_TRUTHY_INLINE_V_L_H
+
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Counts the number of truthy elements in an input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a zero-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_0d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a one-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_1d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a two-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_2d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a two-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_2d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a three-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_3d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a three-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_3d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a four-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_4d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a four-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_4d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a five-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_5d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a five-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_5d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a six-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_6d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a six-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_6d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a seven-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_7d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a seven-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_7d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in an eight-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_8d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in an eight-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_8d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a nine-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_9d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a nine-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_9d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a ten-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_10d( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in a ten-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_10d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Counts the number of truthy elements in an n-dimensional input ndarray and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_count_truthy_v_l_nd( struct ndarray *arrays[], void *data );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_COUNT_TRUTHY_INLINE_V_L_H
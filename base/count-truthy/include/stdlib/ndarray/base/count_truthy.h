@@ -50,6 +50,9 @@
 #include "count-truthy/loops/k_i.h"
 #include "count-truthy/loops/k_l.h"
 
+#include "count-truthy/loops/l_i.h"
+#include "count-truthy/loops/l_l.h"
+
 #include "count-truthy/loops/s_i.h"
 #include "count-truthy/loops/s_l.h"
 
@@ -59,6 +62,9 @@
 #include "count-truthy/loops/u_i.h"
 #include "count-truthy/loops/u_l.h"
 
+#include "count-truthy/loops/v_i.h"
+#include "count-truthy/loops/v_l.h"
+
 #include "count-truthy/loops/x_i.h"
 #include "count-truthy/loops/x_l.h"
 
@@ -32,13 +32,16 @@ import atleast2d = require( './../../../base/atleast2d' );
 import atleast3d = require( './../../../base/atleast3d' );
 import atleastnd = require( './../../../base/atleastnd' );
 import binary = require( './../../../base/binary' );
+import binaryAddonDispatch = require( './../../../base/binary-addon-dispatch' );
 import binaryInputCastingDataType = require( './../../../base/binary-input-casting-dtype' );
 import binaryLoopOrder = require( './../../../base/binary-loop-interchange-order' );
 import binaryOutputDataType = require( './../../../base/binary-output-dtype' );
+import binaryReduceStrided1dAddonDispatch = require( './../../../base/binary-reduce-strided1d-addon-dispatch' );
 import binaryReduceStrided1dDispatch = require( './../../../base/binary-reduce-strided1d-dispatch' );
 import binaryReduceStrided1dDispatchFactory = require( './../../../base/binary-reduce-strided1d-dispatch-factory' );
 import binaryBlockSize = require( './../../../base/binary-tiling-block-size' );
 import bind2vind = require( './../../../base/bind2vind' );
+import bitmask = require( './../../../base/bitmask' );
 import broadcastArray = require( './../../../base/broadcast-array' );
 import broadcastArrayExceptDimensions = require( './../../../base/broadcast-array-except-dimensions' );
 import broadcastArrays = require( './../../../base/broadcast-arrays' );
@@ -49,10 +52,13 @@ import buffer = require( './../../../base/buffer' );
 import bufferCtors = require( './../../../base/buffer-ctors' );
 import bufferDataType = require( './../../../base/buffer-dtype' );
 import bufferDataTypeEnum = require( './../../../base/buffer-dtype-enum' );
+import bufferPool = require( './../../../base/buffer-pool' );
 import bytesPerElement = require( './../../../base/bytes-per-element' );
 import char2dtype = require( './../../../base/char2dtype' );
 import clampIndex = require( './../../../base/clamp-index' );
 import clipIndex = require( './../../../base/clip-index' );
+import coalesceDimensions = require( './../../../base/coalesce-dimensions' );
+import columnarBuffer = require( './../../../base/columnar-buffer' );
 import complementShape = require( './../../../base/complement-shape' );
 import consensusOrder = require( './../../../base/consensus-order' );
 import copy = require( './../../../base/copy' );
@@ -151,6 +157,7 @@ import outputPolicyStr2Enum = require( './../../../base/output-policy-str2enum'
 import pop = require( './../../../base/pop' );
 import prependSingletonDimensions = require( './../../../base/prepend-singleton-dimensions' );
 import promoteDataTypes = require( './../../../base/promote-dtypes' );
+import put = require( './../../../base/put' );
 import quaternaryLoopOrder = require( './../../../base/quaternary-loop-interchange-order' );
 import quaternaryBlockSize = require( './../../../base/quaternary-tiling-block-size' );
 import quinaryLoopOrder = require( './../../../base/quinary-loop-interchange-order' );
@@ -160,18 +167,23 @@ import reinterpretComplex = require( './../../../base/reinterpret-complex' );
 import reinterpretComplex64 = require( './../../../base/reinterpret-complex64' );
 import reinterpretComplex128 = require( './../../../base/reinterpret-complex128' );
 import removeSingletonDimensions = require( './../../../base/remove-singleton-dimensions' );
+import reshapeStrides = require( './../../../base/reshape-strides' );
 import reverse = require( './../../../base/reverse' );
 import reverseDimension = require( './../../../base/reverse-dimension' );
+import reverseDimensionInPlace = require( './../../../base/reverse-dimension-in-place' );
 import reverseDimensions = require( './../../../base/reverse-dimensions' );
 import rot90 = require( './../../../base/rot90' );
 import rot180 = require( './../../../base/rot180' );
 import rotl90 = require( './../../../base/rotl90' );
 import rotr90 = require( './../../../base/rotr90' );
+import rotr90InPlace = require( './../../../base/rotr90-in-place' );
 import serializeMetaData = require( './../../../base/serialize-meta-data' );
 import setDescriptorOffsets = require( './../../../base/set-descriptor-offsets' );
 import shape = require( './../../../base/shape' );
 import shape2strides = require( './../../../base/shape2strides' );
+import sharedStrides2order = require( './../../../base/shared-strides2order' );
 import shift = require( './../../../base/shift' );
+import signatureTable = require( './../../../base/signature-table' );
 import singletonDimensions = require( './../../../base/singleton-dimensions' );
 import slice = require( './../../../base/slice' );
 import sliceAssign = require( './../../../base/slice-assign' );
@@ -187,7 +199,9 @@ import stride = require( './../../../base/stride' );
 import strides = require( './../../../base/strides' );
 import strides2offset = require( './../../../base/strides2offset' );
 import strides2order = require( './../../../base/strides2order' );
+import structField = require( './../../../base/struct-field' );
 import sub2ind = require( './../../../base/sub2ind' );
+import take = require( './../../../base/take' );
 import ternary = require( './../../../base/ternary' );
 import ternaryLoopOrder = require( './../../../base/ternary-loop-interchange-order' );
 import ternaryOutputDataType = require( './../../../base/ternary-output-dtype' );
@@ -209,6 +223,7 @@ import toTransposed = require( './../../../base/to-transposed' );
 import toUnflattened = require( './../../../base/to-unflattened' );
 import toUniqueNormalizedIndices = require( './../../../base/to-unique-normalized-indices' );
 import transpose = require( './../../../base/transpose' );
+import transposeInPlace = require( './../../../base/transpose-in-place' );
 import trues = require( './../../../base/trues' );
 import truesLike = require( './../../../base/trues-like' );
 import unary = require( './../../../base/unary' );
@@ -228,7 +243,10 @@ import unaryStrided1dDispatchFactory = require( './../../../base/unary-strided1d
 import unaryBlockSize = require( './../../../base/unary-tiling-block-size' );
 import unflatten = require( './../../../base/unflatten' );
 import unflattenShape = require( './../../../base/unflatten-shape' );
+import view = require( './../../../base/view' );
 import vind2bind = require( './../../../base/vind2bind' );
+import vindIncrement = require( './../../../base/vind-increment' );
+import weightedLoopOrder = require( './../../../base/weighted-loop-interchange-order' );
 import wrapIndex = require( './../../../base/wrap-index' );
 import zeros = require( './../../../base/zeros' );
 import zerosLike = require( './../../../base/zeros-like' );
@@ -571,6 +589,38 @@ interface Namespace {
 	*/
 	binary: typeof binary;
 
+	/**
+	* Returns a function which dispatches to a native add-on applying a binary function to two input ndarrays.
+	*
+	* @param addon - add-on function
+	* @param fallback - fallback function
+	* @returns dispatch function
+	*
+	* @example
+	* var array = require( './../../../array' );
+	* var zeros = require( './../../../zeros' );
+	*
+	* function addon( x, metaX, y, metaY, z, metaZ ) {
+	*     // Call into native add-on...
+	* }
+	*
+	* function fallback( x, y, z ) {
+	*     // Fallback JavaScript implementation...
+	* }
+	*
+	* // Create a ns.binaryAddonDispatch function:
+	* var f = ns.binaryAddonDispatch( addon, fallback );
+	*
+	* // ...
+	*
+	* // Invoke the ns.binaryAddonDispatch function with ndarray arguments:
+	* var x = array( [ [ 1, 2], [ 3, 4 ] ] );
+	* var y = array( [ [ 5, 6], [ 7, 8 ] ] );
+	* var z = zeros( [ 2, 2 ] );
+	* f( x, y, z );
+	*/
+	binaryAddonDispatch: typeof binaryAddonDispatch;
+
 	/**
 	* Resolves the casting data type for an input ndarray provided to a binary function.
 	*
@@ -650,6 +700,38 @@ interface Namespace {
 	*/
 	binaryOutputDataType: typeof binaryOutputDataType;
 
+	/**
+	* Returns a function which dispatches to a native add-on performing a binary reduction over one-dimensional strided lanes of two input ndarrays.
+	*
+	* @param addon - add-on function
+	* @param fallback - fallback function
+	* @returns dispatch function
+	*
+	* @example
+	* var array = require( './../../../array' );
+	* var zeros = require( './../../../zeros' );
+	*
+	* function addon( xbuf, metaX, ybuf, metaY, zbuf, metaZ ) {
+	*     // Call into native add-on...
+	* }
+	*
+	* function fallback( x, y, z, dims ) {
+	*     // Fallback JavaScript implementation...
+	* }
+	*
+	* // Create a dispatch function:
+	* var f = ns.binaryReduceStrided1dAddonDispatch( addon, fallback );
+	*
+	* // ...
+	*
+	* // Invoke the dispatch function with ndarray arguments:
+	* var x = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+	* var y = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+	* var z = zeros( [ 2 ] );
+	* f( x, y, z, [ 1 ] );
+	*/
+	binaryReduceStrided1dAddonDispatch: typeof binaryReduceStrided1dAddonDispatch;
+
 	/**
 	* Constructor for performing a reduction on two input ndarrays.
 	*
@@ -762,6 +844,23 @@ interface Namespace {
 	*/
 	bind2vind: typeof bind2vind;
 
+	/**
+	* Bit-packed boolean array constructor.
+	*
+	* @param shape - array shape
+	* @returns bitmask instance
+	*
+	* @example
+	* var mask = ns.bitmask( [ 2, 3 ] );
+	* // returns <bitmask>
+	*
+	* mask.iset( 4, true );
+	*
+	* var n = mask.count();
+	* // returns 1
+	*/
+	bitmask: typeof bitmask;
+
 	/**
 	* Broadcasts an ndarray to a specified shape.
 	*
@@ -1204,6 +1303,30 @@ interface Namespace {
 	*/
 	bufferDataTypeEnum: typeof bufferDataTypeEnum;
 
+	/**
+	* Returns a pool of reusable contiguous linear ndarray data buffers.
+	*
+	* ## Notes
+	*
+	* -   Buffers are allocated from power-of-two size classes. Each size class maintains a free list of released buffers which are shared by all non-generic data types.
+	* -   Released buffers are only retained while the total number of retained bytes does not exceed the pool's high water mark.
+	* -   "generic" data buffers are plain arrays and are never pooled.
+	*
+	* @param options - pool options
+	* @param options.highWaterMark - maximum total number of bytes retained by the pool
+	* @returns buffer pool
+	*
+	* @example
+	* var pool = ns.bufferPool();
+	*
+	* var buf = pool.calloc( 'float64', 3 );
+	* // returns <Float64Array>[ 0.0, 0.0, 0.0 ]
+	*
+	* var bool = pool.free( buf );
+	* // returns true
+	*/
+	bufferPool: typeof bufferPool;
+
 	/**
 	* Returns the number of bytes per element for a provided underlying ndarray data type.
 	*
@@ -1268,6 +1391,38 @@ interface Namespace {
 	*/
 	clipIndex: typeof clipIndex;
 
+	/**
+	* Coalesces adjacent ndarray dimensions which can be iterated over as a single dimension.
+	*
+	* @param shape - array dimensions
+	* @param strides - list of stride arrays containing the stride lengths for each ndarray
+	* @returns coalesced dimensions and strides
+	*
+	* @example
+	* var o = ns.coalesceDimensions( [ 100, 3, 1000 ], [ [ 6000, 1000, 1 ], [ 3000, 1000, 1 ] ] );
+	* // returns [ [ 100, 3000 ], [ 6000, 1 ], [ 3000, 1 ] ]
+	*/
+	coalesceDimensions: typeof coalesceDimensions;
+
+	/**
+	* Returns a zero-filled struct-of-arrays (columnar) data buffer.
+	*
+	* @param fields - list of field objects
+	* @param size - number of elements
+	* @returns data buffer
+	*
+	* @example
+	* var buf = ns.columnarBuffer( [ { 'name': 'x', 'type': 'float64' } ], 3 );
+	* // returns <ColumnarBuffer>
+	*
+	* var v = buf.get( 1 );
+	* v.x = 3.5;
+	*
+	* var x = buf.columnOf( 'x' );
+	* // returns <Float64Array>[ 0.0, 3.5, 0.0 ]
+	*/
+	columnarBuffer: typeof columnarBuffer;
+
 	/**
 	* Returns the shape defined by the dimensions which are not included in a list of dimensions.
 	*
@@ -3882,6 +4037,31 @@ interface Namespace {
 	*/
 	promoteDataTypes: typeof promoteDataTypes;
 
+	/**
+	* Assigns elements from a values ndarray to an output ndarray at the linear view indices contained in an index ndarray.
+	*
+	* @param arrays - array-like object containing an index ndarray, a values ndarray, and an output ndarray
+	* @param mode - specifies how to handle an index outside the interval `[0, N-1]`, where `N` is the number of output ndarray elements
+	* @throws index ndarray and values ndarray must have the same number of elements
+	* @throws output ndarray must have at least one element when provided a non-empty index ndarray
+	* @throws index exceeds output ndarray bounds
+	*
+	* @example
+	* var Float64Array = require( '@stdlib/array/float64' );
+	* var Int32Array = require( '@stdlib/array/int32' );
+	* var ndarray = require( '@stdlib/ndarray/ctor' );
+	*
+	* var idx = ndarray( 'int32', new Int32Array( [ 4, 0, -1 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	* var v = ndarray( 'float64', new Float64Array( [ 10.0, 20.0, 30.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	* var x = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	*
+	* ns.put( [ idx, v, x ], 'normalize' );
+	*
+	* console.log( x.data );
+	* // => <Float64Array>[ 20.0, 0.0, 0.0, 0.0, 10.0, 30.0 ]
+	*/
+	put: typeof put;
+
 	/**
 	* Reorders ndarray dimensions and associated strides for loop interchange.
 	*
@@ -4162,6 +4342,29 @@ interface Namespace {
 	*/
 	removeSingletonDimensions: typeof removeSingletonDimensions;
 
+	/**
+	* Returns the strides of an ndarray view having a specified shape and sharing the same underlying memory as an input ndarray, if such a view exists.
+	*
+	* ## Notes
+	*
+	* -   If a view does not exist, the function returns `null`, and an ndarray must be copied in order to be reshaped.
+	*
+	* @param shape - input array shape
+	* @param strides - input array strides
+	* @param newShape - output array shape
+	* @param order - index order
+	* @returns output array strides
+	*
+	* @example
+	* var st = ns.reshapeStrides( [ 2, 3, 4 ], [ 24, 4, 1 ], [ 2, 12 ], 'row-major' );
+	* // returns [ 24, 1 ]
+	*
+	* @example
+	* var st = ns.reshapeStrides( [ 2, 3, 4 ], [ 24, 4, 1 ], [ 6, 4 ], 'row-major' );
+	* // returns null
+	*/
+	reshapeStrides: typeof reshapeStrides;
+
 	/**
 	* Returns a view of an input ndarray in which the order of elements along each dimension is reversed.
 	*
@@ -4225,6 +4428,24 @@ interface Namespace {
 	*/
 	reverseDimension: typeof reverseDimension;
 
+	/**
+	* Reverses the order of elements along a specified dimension of an input ndarray in-place.
+	*
+	* @param x - input array
+	* @param dim - index of dimension to reverse
+	* @returns input ndarray
+	*
+	* @example
+	* var array = require( './../../../array' );
+	*
+	* var x = array( [ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ] );
+	* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ]
+	*
+	* var out = ns.reverseDimensionInPlace( x, 0 );
+	* // returns <ndarray>[ [ 5, 6 ], [ 3, 4 ], [ 1, 2 ] ]
+	*/
+	reverseDimensionInPlace: typeof reverseDimensionInPlace;
+
 	/**
 	* Returns a view of an input ndarray in which the order of elements along specified dimensions is reversed.
 	*
@@ -4331,6 +4552,24 @@ interface Namespace {
 	*/
 	rotr90: typeof rotr90;
 
+	/**
+	* Rotates a matrix (or a stack of matrices) 90 degrees clockwise in-place.
+	*
+	* @param x - input array
+	* @param k - number of times to rotate by 90 degrees
+	* @returns input ndarray
+	*
+	* @example
+	* var array = require( './../../../array' );
+	*
+	* var x = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+	* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ] ]
+	*
+	* var out = ns.rotr90InPlace( x, 1 );
+	* // returns <ndarray>[ [ 3, 1 ], [ 4, 2 ] ]
+	*/
+	rotr90InPlace: typeof rotr90InPlace;
+
 	/**
 	* Serializes ndarray meta data.
 	*
@@ -4477,6 +4716,21 @@ interface Namespace {
 	*/
 	shape2strides: typeof shape2strides;
 
+	/**
+	* Returns the memory layout shared by a list of ndarrays, ignoring broadcasted (i.e., zero-stride) dimensions.
+	*
+	* @param strides - list of stride arrays
+	* @returns memory layout (0: none; 1: row-major; 2: column-major; 3: both)
+	*
+	* @example
+	* var ord = ns.sharedStrides2order( [ [ 3, 1 ], [ 1, 0 ] ] );
+	* // returns 1
+	*
+	* ord = ns.sharedStrides2order( [ [ 3, 1 ], [ 1, 2 ] ] );
+	* // returns 0
+	*/
+	sharedStrides2order: typeof sharedStrides2order;
+
 	/**
 	* Returns an array containing a truncated view of an input ndarray and a view of the first element(s) along a specified dimension.
 	*
@@ -4516,6 +4770,28 @@ interface Namespace {
 	*/
 	shift: typeof shift;
 
+	/**
+	* Returns a lookup table which maps ndarray argument data type signatures to ndarray function indices.
+	*
+	* ## Notes
+	*
+	* -   If multiple ndarray functions have the same signature, the table maps the signature to the index of the first function.
+	* -   If packed keys could exceed the maximum safe double-precision floating-point integer, the function returns `null`.
+	*
+	* @param types - one-dimensional list of ndarray argument data type enumeration constants
+	* @param nfcns - number of ndarray functions
+	* @param narrays - number of ndarray arguments for each ndarray function
+	* @returns lookup table
+	*
+	* @example
+	* var table = ns.signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+	* // returns { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } }
+	*
+	* var idx = ns.signatureTable.indexOf( table, [ 2, 1 ] );
+	* // returns 1
+	*/
+	signatureTable: typeof signatureTable;
+
 	/**
 	* Returns the number of singleton dimensions.
 	*
@@ -5036,6 +5312,28 @@ interface Namespace {
 	*/
 	strides2order: typeof strides2order;
 
+	/**
+	* Returns a view of a single field of a struct ndarray backed by a struct-of-arrays (columnar) data buffer.
+	*
+	* @param x - input ndarray
+	* @param name - field name
+	* @returns field view
+	*
+	* @example
+	* var structFactory = require( '@stdlib/dstructs/struct' );
+	* var columnarBuffer = require( '@stdlib/ndarray/base/columnar-buffer' );
+	* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+	*
+	* var fields = [ { 'name': 'x', 'type': 'float64' } ];
+	* var Point = structFactory( fields );
+	*
+	* var x = ndarray( Point, columnarBuffer( fields, 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	*
+	* var out = ns.structField( x, 'x' );
+	* // returns <ndarray>[ [ 0.0, 0.0 ], [ 0.0, 0.0 ] ]
+	*/
+	structField: typeof structField;
+
 	/**
 	* Converts subscripts to a linear index.
 	*
@@ -5139,6 +5437,31 @@ interface Namespace {
 	*/
 	sub2ind: typeof sub2ind;
 
+	/**
+	* Gathers elements from an input ndarray according to the linear view indices contained in an index ndarray and assigns results to an output ndarray.
+	*
+	* @param arrays - array-like object containing an input ndarray, an index ndarray, and an output ndarray
+	* @param mode - specifies how to handle an index outside the interval `[0, N-1]`, where `N` is the number of input ndarray elements
+	* @throws index ndarray and output ndarray must have the same number of elements
+	* @throws input ndarray must have at least one element when provided a non-empty index ndarray
+	* @throws index exceeds input ndarray bounds
+	*
+	* @example
+	* var Float64Array = require( '@stdlib/array/float64' );
+	* var Int32Array = require( '@stdlib/array/int32' );
+	* var ndarray = require( '@stdlib/ndarray/ctor' );
+	*
+	* var x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	* var idx = ndarray( 'int32', new Int32Array( [ 4, 0, 2, -1 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	* var y = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	*
+	* ns.take( [ x, idx, y ], 'normalize' );
+	*
+	* console.log( y.data );
+	* // => <Float64Array>[ 5.0, 1.0, 3.0, 6.0 ]
+	*/
+	take: typeof take;
+
 	/**
 	* Applies a ternary callback to elements in input ndarrays and assigns results to elements in an output ndarray.
 	*
@@ -5659,6 +5982,23 @@ interface Namespace {
 	*/
 	transpose: typeof transpose;
 
+	/**
+	* Transposes a square matrix (or a stack of square matrices) in-place.
+	*
+	* @param x - input array
+	* @returns input ndarray
+	*
+	* @example
+	* var array = require( './../../../array' );
+	*
+	* var x = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+	* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ] ]
+	*
+	* var out = ns.transposeInPlace( x );
+	* // returns <ndarray>[ [ 1, 3 ], [ 2, 4 ] ]
+	*/
+	transposeInPlace: typeof transposeInPlace;
+
 	/**
 	* Creates an ndarray filled with `true` values and having a specified shape and data type.
 	*
@@ -6303,6 +6643,36 @@ interface Namespace {
 	*/
 	unflattenShape: typeof unflattenShape;
 
+	/**
+	* Returns an ndarray view of an input ndarray having specified meta data.
+	*
+	* ## Notes
+	*
+	* -   The function does **not** validate that the provided meta data is compatible with the input ndarray's underlying data buffer.
+	* -   The returned view adopts the provided `shape` and `strides` arrays without copying them. Accordingly, the caller must not mutate the provided arrays after calling this function.
+	*
+	* @param x - input array
+	* @param shape - view shape
+	* @param strides - view strides
+	* @param offset - index offset
+	* @param writable - boolean indicating whether the returned ndarray should be writable
+	* @returns ndarray view
+	*
+	* @example
+	* var ndarray = require( './../../../ctor' );
+	* var ndarray2array = require( './../../../to-array' );
+	*
+	* var buffer = [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ];
+	* var x = new ndarray( 'generic', buffer, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+	*
+	* var y = ns.view( x, [ 2 ], [ 1 ], 2, false );
+	* // returns <ndarray>
+	*
+	* var arr = ndarray2array( y );
+	* // returns [ 3.0, 4.0 ]
+	*/
+	view: typeof view;
+
 	/**
 	* Converts a linear index in an array view to a linear index in an underlying data buffer.
 	*
@@ -6327,6 +6697,50 @@ interface Namespace {
 	*/
 	vind2bind: typeof vind2bind;
 
+	/**
+	* Returns the change in the linear index in an underlying data buffer when advancing from a linear index in an array view to the next linear index in the view.
+	*
+	* @param shape - array shape
+	* @param strides - stride array
+	* @param order - specifies whether an array is row-major (C-style) or column-major (Fortran-style)
+	* @param idx - linear index in an array view
+	* @returns change in the linear index in an underlying data buffer
+	*
+	* @example
+	* var shape = [ 2, 3 ];
+	* var strides = [ -3, 1 ];
+	* var order = 'row-major';
+	*
+	* var inc = ns.vindIncrement( shape, strides, order, 3 );
+	* // returns -5
+	*/
+	vindIncrement: typeof vindIncrement;
+
+	/**
+	* Returns a loop interchange permutation which minimizes the estimated cost of accessing the elements of multiple ndarrays.
+	*
+	* ## Notes
+	*
+	* -   The cost of making a dimension the innermost loop is estimated as the weighted sum, across all ndarrays, of the number of bytes each ndarray advances per iteration, where each contribution is capped at the size of a cache line. Output ndarrays are weighted more heavily than input ndarrays.
+	* -   Dimensions having the same capped cost are ordered according to their uncapped weighted cost.
+	* -   The last `nout` stride arrays are assumed to correspond to output ndarrays.
+	* -   If an element size is not a positive number (e.g., `null` for "generic" ndarrays), the function assumes an element size of `8` bytes.
+	* -   The returned permutation lists dimension indices from the innermost loop to the outermost loop.
+	*
+	* @param strides - list of stride arrays (in units of elements) for each input and output ndarray
+	* @param nbytes - list of element sizes (in bytes) for each ndarray
+	* @param nout - number of output ndarrays
+	* @returns dimension indices sorted in loop order
+	*
+	* @example
+	* var sx = [ 4, 1 ]; // row-major
+	* var sy = [ 1, 4 ]; // column-major
+	*
+	* var idx = ns.weightedLoopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	* // returns [ 0, 1 ]
+	*/
+	weightedLoopOrder: typeof weightedLoopOrder;
+
 	/**
 	* Wraps an index on the interval `[0,max]`.
 	*
@@ -44,12 +44,16 @@
 
 #include "every/inline/k_x.h"
 
+#include "every/inline/l_x.h"
+
 #include "every/inline/s_x.h"
 
 #include "every/inline/t_x.h"
 
 #include "every/inline/u_x.h"
 
+#include "every/inline/v_x.h"
+
 #include "every/inline/x_x.h"
 
 #include "every/inline/z_x.h"
@@ -88,6 +92,8 @@
 #include "every/predicate/k_x_as_i_x.h"
 #include "every/predicate/k_x_as_z_x.h"
 
+#include "every/predicate/l_x.h"
+
 #include "every/predicate/s_x.h"
 #include "every/predicate/s_x_as_c_x.h"
 #include "every/predicate/s_x_as_d_x.h"
@@ -108,6 +114,8 @@
 #include "every/predicate/u_x_as_d_x.h"
 #include "every/predicate/u_x_as_z_x.h"
 
+#include "every/predicate/v_x.h"
+
 #include "every/predicate/x_x.h"
 
 #include "every/predicate/z_x.h"
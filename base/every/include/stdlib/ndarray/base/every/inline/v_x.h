@@ -0,0 +1,150 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/*
+* The following is auto-generated. Do not manually edit. See scripts/inline_loops.js.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_EVERY_INLINE_V_X_H
+#define STDLIB_NDARRAY_BASE_EVERY_INLINE_V_X_H
+
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Tests whether every element in an input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a zero-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_0d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a one-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_1d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a two-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_2d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a two-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_2d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a three-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_3d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a three-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_3d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a four-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_4d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a four-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_4d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a five-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_5d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a five-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_5d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a six-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_6d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a six-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_6d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a seven-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_7d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a seven-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_7d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in an eight-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_8d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in an eight-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_8d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a nine-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_9d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a nine-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_9d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a ten-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_10d( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in a ten-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_10d_blocked( struct ndarray *arrays[], void *data );
+
+/**
+* Tests whether every element in an n-dimensional input ndarray is truthy and assigns the result to a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_every_v_x_nd( struct ndarray *arrays[], void *data );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_EVERY_INLINE_V_X_H
@@ -64,6 +64,11 @@ int main( void ) {
 	};
 	obj->data = data;
 
+	// Provide a zero-initialized workspace for a type signature hash table, which dispatch builds on first use:
+	int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 ) ] = { 0 };
+	obj->table = table;
+	obj->ntable = STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 );
+
 	printf( "name = %s\n", obj->name );
 	printf( "nin = %i\n", obj->nin );
 	printf( "nout = %i\n", obj->nout );
@@ -22,6 +22,20 @@
 #include "stdlib/ndarray/ctor.h"
 #include <stdint.h>
 
+/**
+* Macro for computing the number of elements in an ndarray function object hash table workspace for a given number of ndarray functions.
+*
+* ## Notes
+*
+* -   The workspace comprises a leading element indicating whether the table has been built, followed by `2*N + 1` hash table slots, thus ensuring a load factor of at most one half.
+*
+* @param N  number of ndarray functions
+*
+* @example
+* static int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 8 ) ];
+*/
+#define STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( N ) ( ( 2*(N) ) + 2 )
+
 /*
 * If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
 */
@@ -108,6 +122,11 @@ typedef int8_t (*ndarrayFcn)( struct ndarray *arrays[], void *data );
 * };
 * obj->data = data;
 *
+* // Provide a zero-initialized workspace for a type signature hash table, which dispatch builds on first use:
+* int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 8 ) ] = { 0 };
+* obj->table = table;
+* obj->ntable = STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 8 );
+*
 * // Free allocated memory:
 * free( obj );
 */
@@ -135,6 +154,12 @@ struct ndarrayFunctionObject {
 
 	// Array of void pointers corresponding to the "data" (e.g., callbacks) which should be passed to a respective ndarray function (note: the number of pointers should match the number of ndarray functions):
 	void **data;
+
+	// Zero-initialized workspace for an open-addressing hash table mapping type signatures to function indices (note: the table is built on first dispatch; when `NULL`, dispatch falls back to a linear search over `types`):
+	int32_t *table;
+
+	// Number of elements in the hash table workspace (note: must equal `STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( nfunctions )` or `0`):
+	int32_t ntable;
 };
 
 /**
@@ -19,6 +19,7 @@
 #include "stdlib/ndarray/base/function_object.h"
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
 * Returns the first row index at which a given one-dimensional array of types can be found in a two-dimensional reference array of types (or `-1` if not found).
@@ -119,12 +120,98 @@ static int64_t stdlib_ndarray_function_dispatch_types_index_of( const int64_t N,
 	return -1;
 }
 
+/**
+* Computes a hash of a list of array types.
+*
+* ## Notes
+*
+* -   The function packs each type "number" into a 64-bit FNV-1a hash, thus allowing a type signature to be mapped to a hash table slot in a constant number of operations with respect to the number of type signatures.
+*
+* @param M      number of types
+* @param types  list of types
+* @return       hash
+*/
+static uint64_t stdlib_ndarray_function_types_hash( const int32_t M, const int32_t *types ) {
+	uint64_t h;
+	int32_t i;
+
+	h = 14695981039346656037ULL; // FNV offset basis
+	for ( i = 0; i < M; i++ ) {
+		h ^= (uint32_t)types[ i ];
+		h *= 1099511628211ULL; // FNV prime
+	}
+	return h;
+}
+
+/**
+* Tests whether two lists of array types are equal.
+*
+* @param M  number of types
+* @param X  first list of types
+* @param Y  second list of types
+* @return   boolean indicating whether two lists of types are equal
+*/
+static bool stdlib_ndarray_function_types_equal( const int32_t M, const int32_t *X, const int32_t *Y ) {
+	int32_t i;
+	for ( i = 0; i < M; i++ ) {
+		if ( X[ i ] != Y[ i ] ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* Builds a hash table mapping type signatures to function indices.
+*
+* ## Notes
+*
+* -   The first element of the hash table workspace indicates whether the table has been built. The remaining elements are hash table slots, where empty slots are indicated by `-1`.
+* -   As the workspace is distinct from the function object, the function supports statically initialized function objects declared as `const`.
+* -   If multiple functions have the same type signature, the table maps the signature to the index of the first function, thus matching the result of a linear search.
+*
+* @param obj  ndarray function object
+*/
+static void stdlib_ndarray_function_table_init( const struct ndarrayFunctionObject *obj ) {
+	int32_t *table;
+	int32_t M;
+	int32_t N;
+	int32_t i;
+	int32_t j;
+	int32_t k;
+
+	table = obj->table + 1;
+	N = obj->ntable - 1;
+	M = obj->narrays;
+	for ( i = 0; i < N; i++ ) {
+		table[ i ] = -1;
+	}
+	for ( i = 0; i < obj->nfunctions; i++ ) {
+		j = (int32_t)( stdlib_ndarray_function_types_hash( M, obj->types+(i*M) ) % (uint64_t)N );
+
+		// Resolve the first slot which is either empty or already contains a function having the same type signature...
+		while ( table[ j ] >= 0 ) {
+			k = table[ j ];
+			if ( stdlib_ndarray_function_types_equal( M, obj->types+(k*M), obj->types+(i*M) ) ) {
+				break;
+			}
+			j = ( j+1 ) % N;
+		}
+		if ( table[ j ] < 0 ) {
+			table[ j ] = i;
+		}
+	}
+	// Mark the table as built:
+	obj->table[ 0 ] = 1;
+}
+
 /**
 * Returns a pointer to a dynamically allocated ndarray function object.
 *
 * ## Notes
 *
 * -   The user is responsible for freeing the allocated memory.
+* -   The function allocates and builds a hash table mapping type signatures to function indices, thus allowing `stdlib_ndarray_function_dispatch_index_of` to resolve a function in constant time with respect to the number of ndarray functions.
 *
 * @param name        ndarray function name
 * @param nin         number of input ndarrays
@@ -197,7 +284,10 @@ static int64_t stdlib_ndarray_function_dispatch_types_index_of( const int64_t N,
 * stdlib_ndarray_function_free( obj );
 */
 struct ndarrayFunctionObject * stdlib_ndarray_function_allocate( const char *name, int32_t nin, int32_t nout, ndarrayFcn *functions, int32_t nfunctions, int32_t *types, void *data[] ) {
-	struct ndarrayFunctionObject *obj = malloc( sizeof( struct ndarrayFunctionObject ) );
+	int32_t ntable = STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( nfunctions );
+
+	// Allocate the function object and its type signature hash table as a single contiguous block of memory (note: this ensures that the hash table is released when freeing the function object):
+	struct ndarrayFunctionObject *obj = malloc( sizeof( struct ndarrayFunctionObject ) + ( (size_t)ntable * sizeof( int32_t ) ) );
 	if ( obj == NULL ) {
 		return NULL;
 	}
@@ -209,6 +299,9 @@ struct ndarrayFunctionObject * stdlib_ndarray_function_allocate( const char *nam
 	obj->nfunctions = nfunctions;
 	obj->types = types;
 	obj->data = data;
+	obj->table = (int32_t *)( obj+1 );
+	obj->ntable = ntable;
+	stdlib_ndarray_function_table_init( obj );
 	return obj;
 }
 
@@ -272,6 +365,7 @@ void stdlib_ndarray_function_free( struct ndarrayFunctionObject *obj ) {
 * ## Notes
 *
 * -   The function returns `-1` if unable to find a function.
+* -   If an ndarray function object has a hash table workspace (e.g., when created via `stdlib_ndarray_function_allocate` or when statically initialized with a workspace having `STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( nfunctions )` elements), the function performs a hash table lookup, building the table on first dispatch. Otherwise, the function performs a linear search over the list of type signatures.
 *
 * @param obj    ndarray function object
 * @param types  list of array types on which to dispatch
@@ -348,6 +442,28 @@ int64_t stdlib_ndarray_function_dispatch_index_of( const struct ndarrayFunctionO
 	// Retrieve the number of array arguments:
 	int32_t M = obj->narrays;
 
+	// Check whether we can resolve a function via a hash table lookup...
+	if ( obj->table != NULL && obj->ntable > 1 ) {
+		int32_t *table = obj->table + 1;
+		int32_t S = obj->ntable - 1;
+		int32_t j;
+		int32_t k;
+
+		// Build the hash table on first dispatch:
+		if ( obj->table[ 0 ] == 0 ) {
+			stdlib_ndarray_function_table_init( obj );
+		}
+		j = (int32_t)( stdlib_ndarray_function_types_hash( M, types ) % (uint64_t)S );
+
+		// Probe consecutive slots until finding either a matching type signature or an empty slot:
+		while ( ( k = table[ j ] ) >= 0 ) {
+			if ( stdlib_ndarray_function_types_equal( M, obj->types+(k*M), types ) ) {
+				return (int64_t)k;
+			}
+			j = ( j+1 ) % S;
+		}
+		return -1;
+	}
 	// Find the index of the function satisfying the provided types:
 	return stdlib_ndarray_function_dispatch_types_index_of( (int64_t)N, M, obj->types, M, 1, types, 1 );
 }
@@ -0,0 +1,33 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/half_precision.h"
+#include <stdio.h>
+
+int main( void ) {
+	const float x[] = { 1.0f, 3.14159265f, -65504.0f, 1.0e-5f, 70000.0f };
+
+	stdlib_bfloat16_t b;
+	stdlib_float16_t h;
+	int i;
+	for ( i = 0; i < 5; i++ ) {
+		h = stdlib_float16_from_float32( x[ i ] );
+		b = stdlib_bfloat16_from_float32( x[ i ] );
+		printf( "x: %g => float16: %g (0x%04x), bfloat16: %g (0x%04x)\n", x[ i ], stdlib_float16_to_float32( h ), h.bits, stdlib_bfloat16_to_float32( b ), b.bits );
+	}
+}
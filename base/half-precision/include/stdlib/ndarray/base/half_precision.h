@@ -0,0 +1,97 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_HALF_PRECISION_H
+#define STDLIB_NDARRAY_BASE_HALF_PRECISION_H
+
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* An opaque type definition for a half-precision (IEEE 754 binary16) floating-point number.
+*
+* ## Notes
+*
+* -   The underlying bit pattern is stored in a `uint16_t`. Wrapping the bit pattern in a `struct` ensures that half-precision values cannot be implicitly converted to and from integer types.
+*/
+typedef struct {
+	uint16_t bits;
+} stdlib_float16_t;
+
+/**
+* An opaque type definition for a brain floating-point (bfloat16) number.
+*
+* ## Notes
+*
+* -   A brain floating-point number has the same exponent range as a single-precision floating-point number, but only eight bits of precision.
+*/
+typedef struct {
+	uint16_t bits;
+} stdlib_bfloat16_t;
+
+/**
+* Converts a half-precision floating-point number to a single-precision floating-point number.
+*/
+float stdlib_float16_to_float32( const stdlib_float16_t x );
+
+/**
+* Converts a half-precision floating-point number to a double-precision floating-point number.
+*/
+double stdlib_float16_to_float64( const stdlib_float16_t x );
+
+/**
+* Converts a single-precision floating-point number to a half-precision floating-point number.
+*/
+stdlib_float16_t stdlib_float16_from_float32( const float x );
+
+/**
+* Converts a double-precision floating-point number to a half-precision floating-point number.
+*/
+stdlib_float16_t stdlib_float16_from_float64( const double x );
+
+/**
+* Converts a brain floating-point number to a single-precision floating-point number.
+*/
+float stdlib_bfloat16_to_float32( const stdlib_bfloat16_t x );
+
+/**
+* Converts a brain floating-point number to a double-precision floating-point number.
+*/
+double stdlib_bfloat16_to_float64( const stdlib_bfloat16_t x );
+
+/**
+* Converts a single-precision floating-point number to a brain floating-point number.
+*/
+stdlib_bfloat16_t stdlib_bfloat16_from_float32( const float x );
+
+/**
+* Converts a double-precision floating-point number to a brain floating-point number.
+*/
+stdlib_bfloat16_t stdlib_bfloat16_from_float64( const double x );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_HALF_PRECISION_H
@@ -1,7 +1,7 @@
 /**
 * @license Apache-2.0
 *
-* Copyright (c) 2023 The Stdlib Authors.
+* Copyright (c) 2026 The Stdlib Authors.
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -16,18 +16,25 @@
 * limitations under the License.
 */
 
-#include "stdlib/ndarray/base/assign/internal/range.h"
-#include <stdint.h>
+
+'use strict';
 
 /**
-* Writes `n` evenly spaced values from `0` to `n-1` to an output array.
+* Absolute file path for the directory containing header files for C APIs.
+*
+* @module @stdlib/ndarray/base/half-precision
 *
-* @param n    number of values to write
-* @param out  output array
+* @example
+* var headerDir = require( '@stdlib/ndarray/base/half-precision' );
+*
+* console.log( headerDir );
 */
-void stdlib_ndarray_base_assign_internal_range( const int64_t n, int64_t *out ) {
-	int64_t i;
-	for ( i = 0; i < n; i++ ) {
-		out[ i ] = i;
-	}
-}
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -1,7 +1,7 @@
 /**
 * @license Apache-2.0
 *
-* Copyright (c) 2021 The Stdlib Authors.
+* Copyright (c) 2026 The Stdlib Authors.
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -16,14 +16,25 @@
 * limitations under the License.
 */
 
-#ifndef STDLIB_NDARRAY_BASE_UNARY_INTERNAL_RANGE_H
-#define STDLIB_NDARRAY_BASE_UNARY_INTERNAL_RANGE_H
+'use strict';
 
-#include <stdint.h>
+// MODULES //
+
+var resolve = require( 'path' ).resolve;
+
+
+// MAIN //
 
 /**
-* Writes `n` evenly spaced values from `0` to `n-1` to an output array.
+* Absolute file path for the directory containing header files for C APIs.
+*
+* @name headerDir
+* @constant
+* @type {string}
 */
-void stdlib_ndarray_base_unary_internal_range( const int64_t n, int64_t *out );
+var headerDir = resolve( __dirname, '..', 'include' );
+
+
+// EXPORTS //
 
-#endif // !STDLIB_NDARRAY_BASE_UNARY_INTERNAL_RANGE_H
+module.exports = headerDir;
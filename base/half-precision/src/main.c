@@ -0,0 +1,350 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/half_precision.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+/**
+* Returns an unsigned 32-bit integer corresponding to the IEEE 754 binary representation of a single-precision floating-point number.
+*
+* @param x   input value
+* @return    word
+*/
+static uint32_t float32_to_word( const float x ) {
+	uint32_t w;
+	memcpy( &w, &x, sizeof( w ) );
+	return w;
+}
+
+/**
+* Returns a single-precision floating-point number from an unsigned 32-bit integer corresponding to an IEEE 754 binary representation.
+*
+* @param w   word
+* @return    single-precision floating-point number
+*/
+static float float32_from_word( const uint32_t w ) {
+	float x;
+	memcpy( &x, &w, sizeof( x ) );
+	return x;
+}
+
+/**
+* Converts a double-precision floating-point number to a single-precision floating-point number using "round-to-odd" rounding.
+*
+* ## Notes
+*
+* -   When a rounded result is subsequently rounded to a format having at least two fewer bits of precision, rounding to odd ensures that the final result is the same as if the original value had been rounded directly (i.e., avoids "double rounding" errors).
+*
+* @param x   input value
+* @return    single-precision floating-point number
+*/
+static float float64_to_float32_round_to_odd( const double x ) {
+	uint32_t w;
+	float y;
+
+	y = (float)x;
+	if ( (double)y == x || x != x ) {
+		return y;
+	}
+	w = float32_to_word( y );
+
+	// If the value was rounded away from zero, step back toward zero (note: this maps an overflowed infinity to the largest finite value):
+	if ( ( x > 0.0 ) ? ( (double)y > x ) : ( (double)y < x ) ) {
+		w -= 1;
+	}
+	return float32_from_word( w | 1 );
+}
+
+/**
+* Converts a half-precision floating-point number to a single-precision floating-point number.
+*
+* ## Notes
+*
+* -   The conversion is exact.
+* -   When compiled for a target supporting F16C instructions, the function uses hardware conversion.
+*
+* @param x   input value
+* @return    single-precision floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_float16_t x = { 0x3c00 };
+*
+* float y = stdlib_float16_to_float32( x );
+* // returns 1.0f
+*/
+float stdlib_float16_to_float32( const stdlib_float16_t x ) {
+#if defined(__F16C__)
+	return _cvtsh_ss( x.bits );
+#else
+	uint32_t sign;
+	uint32_t exp;
+	uint32_t m;
+
+	sign = (uint32_t)( x.bits & 0x8000 ) << 16;
+	exp = ( x.bits >> 10 ) & 0x1f;
+	m = x.bits & 0x3ff;
+
+	// Infinity and NaN:
+	if ( exp == 0x1f ) {
+		return float32_from_word( sign | 0x7f800000 | ( m << 13 ) );
+	}
+	// Normal numbers:
+	if ( exp != 0 ) {
+		return float32_from_word( sign | ( ( exp+112 ) << 23 ) | ( m << 13 ) ); // 112 = 127 - 15
+	}
+	// Signed zero:
+	if ( m == 0 ) {
+		return float32_from_word( sign );
+	}
+	// Subnormal numbers, which are normal numbers in single-precision:
+	exp = 113;
+	while ( ( m & 0x400 ) == 0 ) {
+		m <<= 1;
+		exp -= 1;
+	}
+	return float32_from_word( sign | ( exp << 23 ) | ( ( m & 0x3ff ) << 13 ) );
+#endif
+}
+
+/**
+* Converts a half-precision floating-point number to a double-precision floating-point number.
+*
+* ## Notes
+*
+* -   The conversion is exact.
+*
+* @param x   input value
+* @return    double-precision floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_float16_t x = { 0x3c00 };
+*
+* double y = stdlib_float16_to_float64( x );
+* // returns 1.0
+*/
+double stdlib_float16_to_float64( const stdlib_float16_t x ) {
+	return (double)stdlib_float16_to_float32( x );
+}
+
+/**
+* Converts a single-precision floating-point number to a half-precision floating-point number.
+*
+* ## Notes
+*
+* -   The function rounds to the nearest representable value, with ties rounding to even.
+* -   Values whose magnitude exceeds the largest finite half-precision floating-point number, after rounding, are converted to infinity.
+* -   NaN values are converted to quiet NaN values.
+* -   When compiled for a target supporting F16C instructions, the function uses hardware conversion.
+*
+* @param x   input value
+* @return    half-precision floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_float16_t y = stdlib_float16_from_float32( 1.0f );
+* // y.bits => 0x3c00
+*/
+stdlib_float16_t stdlib_float16_from_float32( const float x ) {
+	stdlib_float16_t out;
+#if defined(__F16C__)
+	out.bits = _cvtss_sh( x, _MM_FROUND_TO_NEAREST_INT );
+	return out;
+#else
+	uint32_t sign;
+	uint32_t half;
+	uint32_t rem;
+	uint32_t exp;
+	uint32_t m;
+	uint32_t w;
+	int32_t e;
+	int32_t s;
+
+	w = float32_to_word( x );
+	sign = ( w >> 16 ) & 0x8000;
+	exp = ( w >> 23 ) & 0xff;
+	m = w & 0x7fffff;
+
+	// Infinity and NaN (note: NaN values are quieted and retain the most significant payload bits):
+	if ( exp == 0xff ) {
+		out.bits = (uint16_t)( sign | 0x7c00 | ( ( m ) ? ( 0x200 | ( m >> 13 ) ) : 0 ) );
+		return out;
+	}
+	// Re-bias the exponent:
+	e = (int32_t)exp - 112;
+
+	// Overflow:
+	if ( e >= 0x1f ) {
+		out.bits = (uint16_t)( sign | 0x7c00 );
+		return out;
+	}
+	// Normal numbers:
+	if ( e > 0 ) {
+		half = ( (uint32_t)e << 10 ) | ( m >> 13 );
+		rem = m & 0x1fff;
+
+		// Round to nearest, ties to even (note: a carry out of the significand correctly increments the exponent and may produce infinity):
+		if ( rem > 0x1000 || ( rem == 0x1000 && ( half & 1 ) ) ) {
+			half += 1;
+		}
+		out.bits = (uint16_t)( sign | half );
+		return out;
+	}
+	// Subnormal numbers and underflow (note: values less than half the smallest subnormal round to zero):
+	s = 14 - e;
+	if ( s > 24 ) {
+		out.bits = (uint16_t)sign;
+		return out;
+	}
+	m |= 0x800000;
+	half = m >> s;
+	rem = m & ( ( 1U << s ) - 1U );
+	if ( rem > ( 1U << ( s-1 ) ) || ( rem == ( 1U << ( s-1 ) ) && ( half & 1 ) ) ) {
+		half += 1;
+	}
+	out.bits = (uint16_t)( sign | half );
+	return out;
+#endif
+}
+
+/**
+* Converts a double-precision floating-point number to a half-precision floating-point number.
+*
+* ## Notes
+*
+* -   The function rounds to the nearest representable value, with ties rounding to even. The function avoids double rounding errors by first converting to single-precision using "round-to-odd" rounding.
+*
+* @param x   input value
+* @return    half-precision floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_float16_t y = stdlib_float16_from_float64( 1.0 );
+* // y.bits => 0x3c00
+*/
+stdlib_float16_t stdlib_float16_from_float64( const double x ) {
+	return stdlib_float16_from_float32( float64_to_float32_round_to_odd( x ) );
+}
+
+/**
+* Converts a brain floating-point number to a single-precision floating-point number.
+*
+* ## Notes
+*
+* -   The conversion is exact.
+*
+* @param x   input value
+* @return    single-precision floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_bfloat16_t x = { 0x3f80 };
+*
+* float y = stdlib_bfloat16_to_float32( x );
+* // returns 1.0f
+*/
+float stdlib_bfloat16_to_float32( const stdlib_bfloat16_t x ) {
+	return float32_from_word( (uint32_t)x.bits << 16 );
+}
+
+/**
+* Converts a brain floating-point number to a double-precision floating-point number.
+*
+* ## Notes
+*
+* -   The conversion is exact.
+*
+* @param x   input value
+* @return    double-precision floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_bfloat16_t x = { 0x3f80 };
+*
+* double y = stdlib_bfloat16_to_float64( x );
+* // returns 1.0
+*/
+double stdlib_bfloat16_to_float64( const stdlib_bfloat16_t x ) {
+	return (double)stdlib_bfloat16_to_float32( x );
+}
+
+/**
+* Converts a single-precision floating-point number to a brain floating-point number.
+*
+* ## Notes
+*
+* -   The function rounds to the nearest representable value, with ties rounding to even.
+* -   NaN values are converted to quiet NaN values.
+*
+* @param x   input value
+* @return    brain floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_bfloat16_t y = stdlib_bfloat16_from_float32( 1.0f );
+* // y.bits => 0x3f80
+*/
+stdlib_bfloat16_t stdlib_bfloat16_from_float32( const float x ) {
+	stdlib_bfloat16_t out;
+	uint32_t w;
+
+	w = float32_to_word( x );
+
+	// NaN (note: NaN values are quieted and retain the most significant payload bits):
+	if ( ( w & 0x7fffffff ) > 0x7f800000 ) {
+		out.bits = (uint16_t)( ( w >> 16 ) | 0x40 );
+		return out;
+	}
+	// Round to nearest, ties to even (note: a carry out of the significand correctly increments the exponent and may produce infinity):
+	w += 0x7fff + ( ( w >> 16 ) & 1 );
+	out.bits = (uint16_t)( w >> 16 );
+	return out;
+}
+
+/**
+* Converts a double-precision floating-point number to a brain floating-point number.
+*
+* ## Notes
+*
+* -   The function rounds to the nearest representable value, with ties rounding to even. The function avoids double rounding errors by first converting to single-precision using "round-to-odd" rounding.
+*
+* @param x   input value
+* @return    brain floating-point number
+*
+* @example
+* #include "stdlib/ndarray/base/half_precision.h"
+*
+* stdlib_bfloat16_t y = stdlib_bfloat16_from_float64( 1.0 );
+* // y.bits => 0x3f80
+*/
+stdlib_bfloat16_t stdlib_bfloat16_from_float64( const double x ) {
+	return stdlib_bfloat16_from_float32( float64_to_float32_round_to_odd( x ) );
+}
@@ -22,6 +22,7 @@
 
 var loopOrder = require( './../../../../../../base/unary-loop-interchange-order' );
 var blockSize = require( './../../../../../../base/unary-tiling-block-size' );
+var bytesPerElement = require( './../../../../../../base/bytes-per-element' );
 var takeIndexed = require( '@stdlib/array/base/take-indexed' );
 var copyIndexed = require( '@stdlib/array/base/copy-indexed' );
 var zeros = require( '@stdlib/array/base/zeros' );
@@ -166,7 +167,7 @@ function kernel( fcn, arrays, views, shape, stridesX, stridesY, strategyX, strat
 	y = arrays[ 1 ];
 
 	// Resolve the loop interchange order:
-	o = loopOrder( shape, stridesX, stridesY );
+	o = loopOrder( shape, stridesX, stridesY, [ bytesPerElement( x.dtype ), bytesPerElement( y.dtype ) ] );
 	sh = o.sh;
 	sv = [ o.sx, o.sy ];
 	for ( k = 2; k < N; k++ ) {
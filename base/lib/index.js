@@ -23,7 +23,7 @@
 */
 
 /*
-* The following modules are intentionally not exported: function-object, napi, unary
+* The following modules are intentionally not exported: function-object, half-precision, napi, sort-lanes, unary
 */
 
 // MODULES //
@@ -148,6 +148,15 @@ setReadOnly( ns, 'atleastnd', require( './../../base/atleastnd' ) );
 */
 setReadOnly( ns, 'binary', require( './../../base/binary' ) );
 
+/**
+* @name binaryAddonDispatch
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/binary-addon-dispatch}
+*/
+setReadOnly( ns, 'binaryAddonDispatch', require( './../../base/binary-addon-dispatch' ) );
+
 /**
 * @name binaryInputCastingDataType
 * @memberof ns
@@ -184,6 +193,15 @@ setReadOnly( ns, 'binaryOutputDataType', require( './../../base/binary-output-dt
 */
 setReadOnly( ns, 'binaryReduceStrided1d', require( './../../base/binary-reduce-strided1d' ) );
 
+/**
+* @name binaryReduceStrided1dAddonDispatch
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/binary-reduce-strided1d-addon-dispatch}
+*/
+setReadOnly( ns, 'binaryReduceStrided1dAddonDispatch', require( './../../base/binary-reduce-strided1d-addon-dispatch' ) );
+
 /**
 * @name binaryReduceStrided1dDispatch
 * @memberof ns
@@ -220,6 +238,15 @@ setReadOnly( ns, 'binaryBlockSize', require( './../../base/binary-tiling-block-s
 */
 setReadOnly( ns, 'bind2vind', require( './../../base/bind2vind' ) );
 
+/**
+* @name bitmask
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/bitmask}
+*/
+setReadOnly( ns, 'bitmask', require( './../../base/bitmask' ) );
+
 /**
 * @name broadcastArray
 * @memberof ns
@@ -310,6 +337,15 @@ setReadOnly( ns, 'bufferDataType', require( './../../base/buffer-dtype' ) );
 */
 setReadOnly( ns, 'bufferDataTypeEnum', require( './../../base/buffer-dtype-enum' ) );
 
+/**
+* @name bufferPool
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/buffer-pool}
+*/
+setReadOnly( ns, 'bufferPool', require( './../../base/buffer-pool' ) );
+
 /**
 * @name bytesPerElement
 * @memberof ns
@@ -346,6 +382,24 @@ setReadOnly( ns, 'clampIndex', require( './../../base/clamp-index' ) );
 */
 setReadOnly( ns, 'clipIndex', require( './../../base/clip-index' ) );
 
+/**
+* @name coalesceDimensions
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/coalesce-dimensions}
+*/
+setReadOnly( ns, 'coalesceDimensions', require( './../../base/coalesce-dimensions' ) );
+
+/**
+* @name columnarBuffer
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/columnar-buffer}
+*/
+setReadOnly( ns, 'columnarBuffer', require( './../../base/columnar-buffer' ) );
+
 /**
 * @name complementShape
 * @memberof ns
@@ -1237,6 +1291,15 @@ setReadOnly( ns, 'prependSingletonDimensions', require( './../../base/prepend-si
 */
 setReadOnly( ns, 'promoteDataTypes', require( './../../base/promote-dtypes' ) );
 
+/**
+* @name put
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/put}
+*/
+setReadOnly( ns, 'put', require( './../../base/put' ) );
+
 /**
 * @name quaternaryLoopOrder
 * @memberof ns
@@ -1318,6 +1381,15 @@ setReadOnly( ns, 'reinterpretComplex128', require( './../../base/reinterpret-com
 */
 setReadOnly( ns, 'removeSingletonDimensions', require( './../../base/remove-singleton-dimensions' ) );
 
+/**
+* @name reshapeStrides
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/reshape-strides}
+*/
+setReadOnly( ns, 'reshapeStrides', require( './../../base/reshape-strides' ) );
+
 /**
 * @name reverse
 * @memberof ns
@@ -1336,6 +1408,15 @@ setReadOnly( ns, 'reverse', require( './../../base/reverse' ) );
 */
 setReadOnly( ns, 'reverseDimension', require( './../../base/reverse-dimension' ) );
 
+/**
+* @name reverseDimensionInPlace
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/reverse-dimension-in-place}
+*/
+setReadOnly( ns, 'reverseDimensionInPlace', require( './../../base/reverse-dimension-in-place' ) );
+
 /**
 * @name reverseDimensions
 * @memberof ns
@@ -1381,6 +1462,15 @@ setReadOnly( ns, 'rotl90', require( './../../base/rotl90' ) );
 */
 setReadOnly( ns, 'rotr90', require( './../../base/rotr90' ) );
 
+/**
+* @name rotr90InPlace
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/rotr90-in-place}
+*/
+setReadOnly( ns, 'rotr90InPlace', require( './../../base/rotr90-in-place' ) );
+
 /**
 * @name serializeMetaData
 * @memberof ns
@@ -1417,6 +1507,15 @@ setReadOnly( ns, 'shape', require( './../../base/shape' ) );
 */
 setReadOnly( ns, 'shape2strides', require( './../../base/shape2strides' ) );
 
+/**
+* @name sharedStrides2order
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/shared-strides2order}
+*/
+setReadOnly( ns, 'sharedStrides2order', require( './../../base/shared-strides2order' ) );
+
 /**
 * @name shift
 * @memberof ns
@@ -1426,6 +1525,15 @@ setReadOnly( ns, 'shape2strides', require( './../../base/shape2strides' ) );
 */
 setReadOnly( ns, 'shift', require( './../../base/shift' ) );
 
+/**
+* @name signatureTable
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/signature-table}
+*/
+setReadOnly( ns, 'signatureTable', require( './../../base/signature-table' ) );
+
 /**
 * @name singletonDimensions
 * @memberof ns
@@ -1561,6 +1669,15 @@ setReadOnly( ns, 'strides2offset', require( './../../base/strides2offset' ) );
 */
 setReadOnly( ns, 'strides2order', require( './../../base/strides2order' ) );
 
+/**
+* @name structField
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/struct-field}
+*/
+setReadOnly( ns, 'structField', require( './../../base/struct-field' ) );
+
 /**
 * @name sub2ind
 * @memberof ns
@@ -1570,6 +1687,15 @@ setReadOnly( ns, 'strides2order', require( './../../base/strides2order' ) );
 */
 setReadOnly( ns, 'sub2ind', require( './../../base/sub2ind' ) );
 
+/**
+* @name take
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/take}
+*/
+setReadOnly( ns, 'take', require( './../../base/take' ) );
+
 /**
 * @name ternary
 * @memberof ns
@@ -1759,6 +1885,15 @@ setReadOnly( ns, 'toUniqueNormalizedIndices', require( './../../base/to-unique-n
 */
 setReadOnly( ns, 'transpose', require( './../../base/transpose' ) );
 
+/**
+* @name transposeInPlace
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/transpose-in-place}
+*/
+setReadOnly( ns, 'transposeInPlace', require( './../../base/transpose-in-place' ) );
+
 /**
 * @name trues
 * @memberof ns
@@ -1975,6 +2110,15 @@ setReadOnly( ns, 'unflatten', require( './../../base/unflatten' ) );
 */
 setReadOnly( ns, 'unflattenShape', require( './../../base/unflatten-shape' ) );
 
+/**
+* @name view
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/view}
+*/
+setReadOnly( ns, 'view', require( './../../base/view' ) );
+
 /**
 * @name vind2bind
 * @memberof ns
@@ -1984,6 +2128,24 @@ setReadOnly( ns, 'unflattenShape', require( './../../base/unflatten-shape' ) );
 */
 setReadOnly( ns, 'vind2bind', require( './../../base/vind2bind' ) );
 
+/**
+* @name vindIncrement
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/vind-increment}
+*/
+setReadOnly( ns, 'vindIncrement', require( './../../base/vind-increment' ) );
+
+/**
+* @name weightedLoopOrder
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/base/weighted-loop-interchange-order}
+*/
+setReadOnly( ns, 'weightedLoopOrder', require( './../../base/weighted-loop-interchange-order' ) );
+
 /**
 * @name wrapIndex
 * @memberof ns
@@ -20,11 +20,14 @@
 
 // MODULES //
 
-var zeroTo = require( '@stdlib/array/base/zero-to' );
-var copy = require( '@stdlib/array/base/copy-indexed' );
 var take = require( '@stdlib/array/base/take-indexed' );
-var strides2order = require( './../../../base/strides2order' );
-var sort2ins = require( './sort2ins.js' );
+var weightedLoopOrder = require( './../../../base/weighted-loop-interchange-order' );
+
+
+// VARIABLES //
+
+// Default list of element sizes (i.e., defer to the default element size for each ndarray):
+var NBYTES = [];
 
 
 // MAIN //
@@ -45,8 +48,13 @@ var sort2ins = require( './sort2ins.js' );
 *     -   **shape**: dimensions sorted in loop order.
 *     -   **...strides**: strides for each respective ndarray sorted in loop order.
 *
+* -   The last stride array is assumed to correspond to an output ndarray.
+*
+* -   The loop order is resolved using a cost model which weighs the strides of all provided ndarrays, with writes weighted more heavily than reads. Accordingly, when ndarrays have different memory layouts, the loop order favors the layout shared by the majority of input ndarrays only when their reads outweigh the output ndarray writes.
+*
 * @param {NonNegativeIntegerArray} shape - array dimensions
 * @param {ArrayLikeObject<ArrayLikeObject<integer>>} strides - list of stride arrays containing the stride lengths for each input and output ndarray
+* @param {ArrayLikeObject<(PositiveInteger|null)>} [nbytes] - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns {Array<Array>} loop interchange data
 *
 * @example
@@ -71,68 +79,19 @@ var sort2ins = require( './sort2ins.js' );
 * var ssz = o[ 3 ];
 * // returns [ 6, -2, 1 ]
 */
-function loopOrder( shape, strides ) {
+function loopOrder( shape, strides, nbytes ) {
 	var idx;
-	var tmp;
-	var max;
-	var len;
 	var out;
-	var st;
-	var N;
-	var M;
 	var i;
-	var j;
-
-	N = strides.length;
-
-	// Initialize an array for grouping stride arrays according to memory layout:
-	tmp = [];
-	for ( i = 0; i < 4; i++ ) { // note: `4` corresponds to the number of possible return values from `strides2order`
-		tmp.push( [] );
-	}
-	M = tmp.length;
-
-	// Group stride arrays according to memory layout:
-	for ( i = 0; i < N; i++ ) {
-		tmp[ strides2order( strides[ i ] ) ].push( strides[ i ] );
-	}
-	// Determine which array should be used to generate the loop order:
-	max = tmp[ 0 ].length;
-	if ( max === N ) {
-		// If all arrays are "disorganized", then just use the first array, as, generally, each array is likely to be as un-ideal as every other:
-		st = strides[ 0 ];
-	} else if ( max === N-1 ) {
-		// If all but one array is "disorganized", find the "organized" array...
-		for ( i = 1; i < M; i++ ) {
-			if ( tmp[ i ].length ) {
-				st = tmp[ i ][ 0 ];
-				break;
-			}
-		}
-	} else {
-		// Find the layout which is most common...
-		j = 0;
-		for ( i = 1; i < M; i++ ) {
-			len = tmp[ i ].length;
-			if ( len >= max ) {
-				max = len;
-				j = i;
-			}
-		}
-		// Use the strides of the first array having the most common layout:
-		st = tmp[ j ][ 0 ];
-	}
-	// Initialize a loop interchange index array for generating a loop order permutation:
-	idx = zeroTo( shape.length );
 
-	// Sort strides in increasing order of magnitude:
-	sort2ins( copy( st ), idx );
+	// Resolve a loop order which minimizes the estimated cost of accessing the elements of all ndarrays:
+	idx = weightedLoopOrder( strides, ( arguments.length > 2 ) ? nbytes : NBYTES, 1 );
 
-	// Permute the shape based on the sorted strides:
+	// Permute the shape based on the resolved loop order:
 	out = [ take( shape, idx ) ];
 
-	// Permute each stride array based on the sorted strides:
-	for ( i = 0; i < N; i++ ) {
+	// Permute each stride array based on the resolved loop order:
+	for ( i = 0; i < strides.length; i++ ) {
 		out.push( take( strides[ i ], idx ) );
 	}
 	return out;
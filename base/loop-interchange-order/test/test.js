@@ -152,15 +152,15 @@ tape( 'the function returns loop interchange data (mostly disorganized)', functi
 
 	t.notEqual( o[ 1 ], sx, 'returns expected value' );
 	t.strictEqual( isArray( o[ 1 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 1 ], [ 1, 4, -2 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 4, 1, -2 ], 'returns expected value' );
 
 	t.notEqual( o[ 2 ], sy, 'returns expected value' );
 	t.strictEqual( isArray( o[ 2 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 2 ], [ 1, 2, -4 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 2, 1, -4 ], 'returns expected value' );
 
 	t.notEqual( o[ 3 ], sz, 'returns expected value' );
 	t.strictEqual( isArray( o[ 3 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 3 ], [ 4, -2, -8 ], 'returns expected value' );
+	t.deepEqual( o[ 3 ], [ -2, 4, -8 ], 'returns expected value' );
 
 	t.end();
 });
@@ -181,19 +181,94 @@ tape( 'the function returns loop interchange data (all disorganized)', function
 
 	t.notEqual( o[ 0 ], sh, 'returns expected value' );
 	t.strictEqual( isArray( o[ 0 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 0 ], [ 2, 4, 2 ], 'returns expected value' );
+	t.deepEqual( o[ 0 ], [ 2, 2, 4 ], 'returns expected value' );
 
 	t.notEqual( o[ 1 ], sx, 'returns expected value' );
 	t.strictEqual( isArray( o[ 1 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 1 ], [ 1, -2, 4 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1, 4, -2 ], 'returns expected value' );
 
 	t.notEqual( o[ 2 ], sy, 'returns expected value' );
 	t.strictEqual( isArray( o[ 2 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 2 ], [ 2, 1, -4 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 2, -4, 1 ], 'returns expected value' );
 
 	t.notEqual( o[ 3 ], sz, 'returns expected value' );
 	t.strictEqual( isArray( o[ 3 ] ), true, 'returns expected value' );
-	t.deepEqual( o[ 3 ], [ 4, -8, -2 ], 'returns expected value' );
+	t.deepEqual( o[ 3 ], [ 4, -2, -8 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns loop interchange data (favors contiguous writes when an input and an output ndarray have different layouts)', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var o;
+
+	sh = [ 100, 100 ];
+	sx = [ 100, 1 ]; // row-major
+	sy = [ 1, 100 ]; // column-major
+
+	o = loopOrder( sh, [ sx, sy ] );
+
+	t.deepEqual( o[ 0 ], [ 100, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 100, 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 1, 100 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns loop interchange data (favors contiguous reads when the reads outweigh the writes)', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var sz;
+	var sw;
+	var o;
+
+	sh = [ 100, 100 ];
+	sx = [ 100, 1 ]; // row-major
+	sy = [ 100, 1 ]; // row-major
+	sz = [ 100, 1 ]; // row-major
+	sw = [ 1, 100 ]; // column-major
+
+	o = loopOrder( sh, [ sx, sy, sz, sw ] );
+
+	t.deepEqual( o[ 0 ], [ 100, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 1, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 3 ], [ 1, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 4 ], [ 100, 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports weighting strides by the number of bytes per element', function test( t ) {
+	var sh;
+	var sx;
+	var sy;
+	var sz;
+	var o;
+
+	sh = [ 100, 100 ];
+	sx = [ 100, 1 ]; // row-major
+	sy = [ 100, 1 ]; // row-major
+	sz = [ 1, 100 ]; // column-major
+
+	// Without element sizes, the contiguous reads outweigh the write:
+	o = loopOrder( sh, [ sx, sy, sz ] );
+
+	t.deepEqual( o[ 0 ], [ 100, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 100, 1 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 100, 1 ], 'returns expected value' );
+	t.deepEqual( o[ 3 ], [ 1, 100 ], 'returns expected value' );
+
+	// When the output ndarray has a much larger element size, favor contiguous writes:
+	o = loopOrder( sh, [ sx, sy, sz ], [ 1, 1, 8 ] );
+
+	t.deepEqual( o[ 0 ], [ 100, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 1 ], [ 1, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 2 ], [ 1, 100 ], 'returns expected value' );
+	t.deepEqual( o[ 3 ], [ 100, 1 ], 'returns expected value' );
 
 	t.end();
 });
@@ -0,0 +1,64 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var serialize = require( './../../../../base/serialize-meta-data' );
+var addon = require( './../src/addon.node' );
+
+
+// MAIN //
+
+/**
+* Wrapper function exposing the C API to JavaScript.
+*
+* @private
+* @param {ndarray} x - first input array
+* @param {ndarray} y - second input array
+* @param {ndarray} z - destination array
+* @returns {ndarray} `z`
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var ndarray = require( '@stdlib/ndarray/ctor' );
+*
+* var xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+* var ybuf = new Float64Array( [ 5.0, 6.0, 7.0, 8.0 ] );
+* var zbuf = new Float64Array( 4 );
+*
+* var x = new ndarray( 'float64', xbuf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+* var y = new ndarray( 'float64', ybuf, [ 4 ], [ 1 ], 0, 'row-major' );
+* var z = new ndarray( 'float64', zbuf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* wrapper( x, y, z );
+* // zbuf => <Float64Array>[ 6.0, 8.0, 10.0, 12.0 ]
+*/
+function wrapper( x, y, z ) {
+	var mx = serialize( x );
+	var my = serialize( y );
+	var mz = serialize( z );
+	addon( x.data, mx, y.data, my, z.data, mz );
+	return z;
+}
+
+
+// EXPORTS //
+
+module.exports = wrapper;
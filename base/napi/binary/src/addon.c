@@ -0,0 +1,114 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/napi/binary.h"
+#include "stdlib/ndarray/base/function_object.h"
+#include "stdlib/ndarray/dtypes.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/**
+* Adds the elements of two double-precision floating-point input ndarrays (visited in linear view order) and assigns results to an output ndarray.
+*
+* ## Notes
+*
+* -   If the ndarrays do not have the same number of elements, the function returns an error code.
+*
+* @param arrays   array whose first two elements are pointers to input ndarrays and whose last element is a pointer to an output ndarray
+* @param data     function data (unused)
+* @return         status code
+*/
+static int8_t add( struct ndarray *arrays[], void *data ) {
+	const struct ndarray *x1 = arrays[ 0 ];
+	const struct ndarray *x2 = arrays[ 1 ];
+	const struct ndarray *x3 = arrays[ 2 ];
+	const int64_t len = stdlib_ndarray_length( x3 );
+	double v1;
+	double v2;
+	int64_t i;
+
+	(void)data;
+	if ( stdlib_ndarray_length( x1 ) != len || stdlib_ndarray_length( x2 ) != len ) {
+		return -1;
+	}
+	for ( i = 0; i < len; i++ ) {
+		if ( stdlib_ndarray_iget_float64( x1, i, &v1 ) != 0 || stdlib_ndarray_iget_float64( x2, i, &v2 ) != 0 ) {
+			return -1;
+		}
+		if ( stdlib_ndarray_iset_float64( x3, i, v1+v2 ) != 0 ) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+// Define an interface name:
+static const char name[] = "stdlib_ndarray_binary_test_function";
+
+// Define a list of ndarray functions:
+static ndarrayFcn functions[] = {
+	add
+};
+
+// Define the **ndarray** argument types for each ndarray function:
+static int32_t types[] = {
+	STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_FLOAT64
+};
+
+// Define a list of ndarray function "data" (in this case, the ndarray function does not require any additional data):
+static void *data[] = {
+	NULL
+};
+
+// Define a zero-initialized workspace for a type signature hash table (note: the table is built on first dispatch):
+static int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 ) ];
+
+// Create an ndarray function object:
+static const struct ndarrayFunctionObject obj = {
+	// ndarray function name:
+	name,
+
+	// Number of input ndarrays:
+	2,
+
+	// Number of output ndarrays:
+	1,
+
+	// Total number of ndarray arguments (nin + nout):
+	3,
+
+	// Array containing ndarray functions:
+	functions,
+
+	// Number of ndarray functions:
+	1,
+
+	// Array of type "numbers" (as enumerated elsewhere), where the total number of types equals `narrays * nfunctions` and where each set of `narrays` consecutive types (non-overlapping) corresponds to the set of ndarray argument types for a corresponding ndarray function:
+	types,
+
+	// Array of void pointers corresponding to the "data" (e.g., callbacks) which should be passed to a respective ndarray function (note: the number of pointers should match the number of ndarray functions):
+	data,
+
+	// Hash table workspace:
+	table,
+
+	// Number of elements in the hash table workspace:
+	STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 )
+};
+
+STDLIB_NDARRAY_NAPI_MODULE_BINARY( obj )
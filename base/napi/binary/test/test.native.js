@@ -0,0 +1,147 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var resolve = require( 'path' ).resolve;
+var tape = require( 'tape' );
+var tryRequire = require( '@stdlib/utils/try-require' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var ndarray = require( './../../../../base/ctor' );
+
+
+// VARIABLES //
+
+var addon = tryRequire( resolve( __dirname, './../lib/native.js' ) );
+var opts = {
+	'skip': ( addon instanceof Error )
+};
+
+
+// TESTS //
+
+tape( 'main export is a function', opts, function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof addon, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided insufficient arguments', opts, function test( t ) {
+	t.throws( foo, Error, 'throws an error' );
+	t.end();
+
+	function foo() {
+		addon();
+	}
+});
+
+tape( 'the function throws an error if provided unsupported array data types', opts, function test( t ) {
+	t.throws( foo, TypeError, 'throws an error' );
+	t.end();
+
+	function foo() {
+		var x;
+		var y;
+		var z;
+
+		x = new ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+		y = new ndarray( 'int32', new Int32Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+		z = new ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+		addon( x, y, z );
+	}
+});
+
+tape( 'the function throws an error if the ndarray function fails (e.g., the ndarrays have different numbers of elements)', opts, function test( t ) {
+	t.throws( foo, RangeError, 'throws an error' );
+	t.end();
+
+	function foo() {
+		var x;
+		var y;
+		var z;
+
+		x = new ndarray( 'float64', new Float64Array( 6 ), [ 6 ], [ 1 ], 0, 'row-major' );
+		y = new ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+		z = new ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+		addon( x, y, z );
+	}
+});
+
+tape( 'the function does not throw an error when provided valid arguments', opts, function test( t ) {
+	var x;
+	var y;
+	var z;
+
+	x = new ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = new ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+	z = new ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	try {
+		addon( x, y, z );
+		t.ok( true, 'does not throw' );
+	} catch ( err ) {
+		t.ok( false, err.message );
+	}
+	t.end();
+});
+
+tape( 'the function applies an ndarray function (row-major)', opts, function test( t ) {
+	var expected;
+	var zbuf;
+	var x;
+	var y;
+	var z;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = new ndarray( 'float64', new Float64Array( [ 5.0, 6.0, 7.0, 8.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	zbuf = new Float64Array( 4 );
+	z = new ndarray( 'float64', zbuf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	addon( x, y, z );
+
+	expected = new Float64Array( [ 6.0, 8.0, 10.0, 12.0 ] );
+	t.deepEqual( zbuf, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function applies an ndarray function (column-major, negative strides)', opts, function test( t ) {
+	var expected;
+	var zbuf;
+	var x;
+	var y;
+	var z;
+
+	// x = [ [ 6, 4, 2 ], [ 5, 3, 1 ] ] => linear (column-major) order: [ 6, 5, 4, 3, 2, 1 ]
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ -1, -2 ], 5, 'column-major' );
+	y = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 6 ], [ 1 ], 0, 'row-major' );
+
+	zbuf = new Float64Array( 6 );
+	z = new ndarray( 'float64', zbuf, [ 6 ], [ 1 ], 0, 'column-major' );
+
+	addon( x, y, z );
+
+	expected = new Float64Array( [ 7.0, 7.0, 7.0, 7.0, 7.0, 7.0 ] );
+	t.deepEqual( zbuf, expected, 'returns expected value' );
+	t.end();
+});
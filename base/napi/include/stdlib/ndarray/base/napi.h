@@ -20,7 +20,14 @@
 #define STDLIB_NDARRAY_BASE_NAPI_H
 
 // Note: keep in alphabetical order...
+#include "stdlib/ndarray/base/binary_reduce_strided1d.h"
+#include "stdlib/ndarray/base/napi/binary.h"
+#include "stdlib/ndarray/base/napi/binary_reduce_strided1d.h"
+#include "stdlib/ndarray/base/napi/ternary.h"
 #include "stdlib/ndarray/base/napi/unary.h"
+#include "stdlib/ndarray/base/put.h"
+#include "stdlib/ndarray/base/take.h"
+#include "stdlib/ndarray/base/ternary.h"
 #include "stdlib/ndarray/base/unary.h"
 
 #include "stdlib/ndarray/dtypes.h"
@@ -0,0 +1,67 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var serialize = require( './../../../../base/serialize-meta-data' );
+var addon = require( './../src/addon.node' );
+
+
+// MAIN //
+
+/**
+* Wrapper function exposing the C API to JavaScript.
+*
+* @private
+* @param {ndarray} x - first input array
+* @param {ndarray} y - second input array
+* @param {ndarray} z - third input array
+* @param {ndarray} w - destination array
+* @returns {ndarray} `w`
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var ndarray = require( '@stdlib/ndarray/ctor' );
+*
+* var xbuf = new Float64Array( 10 );
+* var ybuf = new Float64Array( xbuf.length );
+* var zbuf = new Float64Array( xbuf.length );
+* var wbuf = new Float64Array( xbuf.length );
+*
+* var x = new ndarray( 'float64', xbuf, [ xbuf.length ], [ 1 ], 0, 'row-major' );
+* var y = new ndarray( x.dtype, ybuf, x.shape, x.strides, x.offset, x.order );
+* var z = new ndarray( x.dtype, zbuf, x.shape, x.strides, x.offset, x.order );
+* var w = new ndarray( x.dtype, wbuf, x.shape, x.strides, x.offset, x.order );
+*
+* wrapper( x, y, z, w );
+*/
+function wrapper( x, y, z, w ) {
+	var mw = serialize( w );
+	var mx = serialize( x );
+	var my = serialize( y );
+	var mz = serialize( z );
+	addon( x.data, mx, y.data, my, z.data, mz, w.data, mw );
+	return w;
+}
+
+
+// EXPORTS //
+
+module.exports = wrapper;
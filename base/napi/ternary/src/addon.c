@@ -0,0 +1,91 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/napi/ternary.h"
+#include "stdlib/ndarray/base/function_object.h"
+#include "stdlib/ndarray/base/ternary.h"
+#include "stdlib/ndarray/dtypes.h"
+#include <stdint.h>
+
+/**
+* Performs a multiply-add operation for double-precision floating-point numbers.
+*
+* @param x   first input value
+* @param y   second input value
+* @param z   third input value
+* @return    result
+*/
+static double muladd( const double x, const double y, const double z ) {
+	return ( x*y ) + z;
+}
+
+// Define an interface name:
+static const char name[] = "stdlib_ndarray_ternary_test_function";
+
+// Define a list of ndarray functions:
+static ndarrayFcn functions[] = {
+	stdlib_ndarray_ddd_d
+};
+
+// Define the **ndarray** argument types for each ndarray function:
+static int32_t types[] = {
+	STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_FLOAT64
+};
+
+// Define a list of ndarray function "data" (in this case, callbacks):
+static void *data[] = {
+	(void *)muladd
+};
+
+// Define a zero-initialized workspace for a type signature hash table (note: the table is built on first dispatch):
+static int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 ) ];
+
+// Create an ndarray function object:
+static const struct ndarrayFunctionObject obj = {
+	// ndarray function name:
+	name,
+
+	// Number of input ndarrays:
+	3,
+
+	// Number of output ndarrays:
+	1,
+
+	// Total number of ndarray arguments (nin + nout):
+	4,
+
+	// Array containing ndarray functions:
+	functions,
+
+	// Number of ndarray functions:
+	1,
+
+	// Array of type "numbers" (as enumerated elsewhere), where the total number of types equals `narrays * nfunctions` and where each set of `narrays` consecutive types (non-overlapping) corresponds to the set of ndarray argument types for a corresponding ndarray function:
+	types,
+
+	// Array of void pointers corresponding to the "data" (e.g., callbacks) which should be passed to a respective ndarray function (note: the number of pointers should match the number of ndarray functions):
+	data,
+
+	// Hash table workspace:
+	table,
+
+	// Number of elements in the hash table workspace:
+	STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 )
+};
+
+STDLIB_NDARRAY_NAPI_MODULE_TERNARY( obj )
@@ -50,6 +50,9 @@ static void *data[] = {
 	(void *)identity
 };
 
+// Define a zero-initialized workspace for a type signature hash table (note: the table is built on first dispatch):
+static int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 ) ];
+
 // Create an ndarray function object:
 static const struct ndarrayFunctionObject obj = {
 	// ndarray function name:
@@ -74,7 +77,13 @@ static const struct ndarrayFunctionObject obj = {
 	types,
 
 	// Array of void pointers corresponding to the "data" (e.g., callbacks) which should be passed to a respective ndarray function (note: the number of pointers should match the number of ndarray functions):
-	data
+	data,
+
+	// Hash table workspace:
+	table,
+
+	// Number of elements in the hash table workspace:
+	STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 1 )
 };
 
 STDLIB_NDARRAY_NAPI_MODULE_UNARY( obj )
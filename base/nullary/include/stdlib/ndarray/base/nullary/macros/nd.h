@@ -21,9 +21,7 @@
 
 #include "stdlib/ndarray/ctor.h"
 #include "stdlib/ndarray/orders.h"
-#include "stdlib/ndarray/index_modes.h"
-#include "stdlib/ndarray/orders.h"
-#include "stdlib/ndarray/base/vind2bind.h"
+#include "stdlib/ndarray/base/vind_increment.h"
 #include <stdint.h>
 
 /**
@@ -33,7 +31,7 @@
 *
 * -   Variable naming conventions:
 *
-*     -   `sx#`, `px#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
+*     -   `sx#`, `px#`, `nx#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
 *     -   `S@`, `i@`, and `d@x#` where `@` corresponds to the loop number, with `0` being the innermost loop.
 *
 * @example
@@ -44,7 +42,6 @@
 */
 #define STDLIB_NDARRAY_NULLARY_ND_LOOP_PREAMBLE                                \
 	const struct ndarray *x1 = arrays[ 0 ];                                    \
-	enum STDLIB_NDARRAY_INDEX_MODE mx1 = stdlib_ndarray_index_mode( x1 );      \
 	enum STDLIB_NDARRAY_ORDER ordx1 = stdlib_ndarray_order( x1 );              \
 	const int64_t *shape = stdlib_ndarray_shape( x1 );                         \
 	const int64_t *sx1 = stdlib_ndarray_strides( x1 );                         \
@@ -53,11 +50,34 @@
 	int64_t ox1 = stdlib_ndarray_offset( x1 );                                 \
 	int64_t len = stdlib_ndarray_length( x1 );                                 \
 	uint8_t *px1;                                                              \
+	int64_t d0x1;                                                              \
+	int64_t nx1;                                                               \
+	int64_t n0r;                                                               \
+	int64_t n0c;                                                               \
+	int64_t S0;                                                                \
+	int64_t i0;                                                                \
 	int64_t i;                                                                 \
-	/* Iterate over each ndarray element based on the linear **view** index, regardless as to how the data is stored in memory... */ \
-	for ( i = 0; i < len; i++ ) {                                              \
-		px1 = pbx1 + stdlib_ndarray_vind2bind( ndims, shape, sx1, ox1, ordx1, i, mx1 ); \
-		do
+	/* Resolve the number of elements along the innermost non-singleton dimension for both row-major and column-major iteration orders... */ \
+	n0r = 1;                                                                   \
+	for ( i = ndims-1; i >= 0 && n0r == 1; i-- ) {                             \
+		n0r = shape[ i ];                                                      \
+	}                                                                          \
+	n0c = 1;                                                                   \
+	for ( i = 0; i < ndims && n0c == 1; i++ ) {                                \
+		n0c = shape[ i ];                                                      \
+	}                                                                          \
+	/* For each ndarray, resolve a pointer to the first indexed element, the number of consecutive view elements along the innermost non-singleton dimension, and the pointer increment along that dimension... */ \
+	px1 = pbx1 + ox1;                                                          \
+	nx1 = ( ordx1 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x1 = stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, 1 );       \
+	/* Iterate over each ndarray element based on the linear **view** index, incrementally updating element pointers rather than resolving each view index to a data buffer index... */ \
+	for ( i = 0; i < len; i += S0 ) {                                          \
+		if ( i > 0 ) {                                                         \
+			px1 += stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, i ) - d0x1; \
+		}                                                                      \
+		/* Resolve the number of consecutive view elements which can be visited using constant pointer increments... */ \
+		S0 = nx1 - ( i % nx1 );                                                \
+		for ( i0 = 0; i0 < S0; i0++, px1 += d0x1 ) do
 
 /**
 * Macro containing the preamble for nested loops which update two output ndarrays.
@@ -66,7 +86,7 @@
 *
 * -   Variable naming conventions:
 *
-*     -   `sx#`, `px#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
+*     -   `sx#`, `px#`, `nx#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
 *     -   `S@`, `i@`, and `d@x#` where `@` corresponds to the loop number, with `0` being the innermost loop.
 *
 * @example
@@ -78,8 +98,6 @@
 #define STDLIB_NDARRAY_NULLARY_ND_LOOP_TWO_OUT_PREAMBLE                        \
 	const struct ndarray *x1 = arrays[ 0 ];                                    \
 	const struct ndarray *x2 = arrays[ 1 ];                                    \
-	enum STDLIB_NDARRAY_INDEX_MODE mx1 = stdlib_ndarray_index_mode( x1 );      \
-	enum STDLIB_NDARRAY_INDEX_MODE mx2 = stdlib_ndarray_index_mode( x2 );      \
 	enum STDLIB_NDARRAY_ORDER ordx1 = stdlib_ndarray_order( x1 );              \
 	enum STDLIB_NDARRAY_ORDER ordx2 = stdlib_ndarray_order( x2 );              \
 	const int64_t *shape = stdlib_ndarray_shape( x1 );                         \
@@ -93,12 +111,43 @@
 	int64_t len = stdlib_ndarray_length( x1 );                                 \
 	uint8_t *px1;                                                              \
 	uint8_t *px2;                                                              \
+	int64_t d0x1;                                                              \
+	int64_t d0x2;                                                              \
+	int64_t nx1;                                                               \
+	int64_t nx2;                                                               \
+	int64_t n0r;                                                               \
+	int64_t n0c;                                                               \
+	int64_t S0;                                                                \
+	int64_t i0;                                                                \
 	int64_t i;                                                                 \
-	/* Iterate over each ndarray element based on the linear **view** index, regardless as to how the data is stored in memory... */ \
-	for ( i = 0; i < len; i++ ) {                                              \
-		px1 = pbx1 + stdlib_ndarray_vind2bind( ndims, shape, sx1, ox1, ordx1, i, mx1 ); \
-		px2 = pbx2 + stdlib_ndarray_vind2bind( ndims, shape, sx2, ox2, ordx2, i, mx2 ); \
-		do
+	/* Resolve the number of elements along the innermost non-singleton dimension for both row-major and column-major iteration orders... */ \
+	n0r = 1;                                                                   \
+	for ( i = ndims-1; i >= 0 && n0r == 1; i-- ) {                             \
+		n0r = shape[ i ];                                                      \
+	}                                                                          \
+	n0c = 1;                                                                   \
+	for ( i = 0; i < ndims && n0c == 1; i++ ) {                                \
+		n0c = shape[ i ];                                                      \
+	}                                                                          \
+	/* For each ndarray, resolve a pointer to the first indexed element, the number of consecutive view elements along the innermost non-singleton dimension, and the pointer increment along that dimension... */ \
+	px1 = pbx1 + ox1;                                                          \
+	nx1 = ( ordx1 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x1 = stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, 1 );       \
+	px2 = pbx2 + ox2;                                                          \
+	nx2 = ( ordx2 == STDLIB_NDARRAY_COLUMN_MAJOR ) ? n0c : n0r;                \
+	d0x2 = stdlib_ndarray_vind_increment( ndims, shape, sx2, ordx2, 1 );       \
+	/* Iterate over each ndarray element based on the linear **view** index, incrementally updating element pointers rather than resolving each view index to a data buffer index... */ \
+	for ( i = 0; i < len; i += S0 ) {                                          \
+		if ( i > 0 ) {                                                         \
+			px1 += stdlib_ndarray_vind_increment( ndims, shape, sx1, ordx1, i ) - d0x1; \
+			px2 += stdlib_ndarray_vind_increment( ndims, shape, sx2, ordx2, i ) - d0x2; \
+		}                                                                      \
+		/* Resolve the number of consecutive view elements which can be visited using constant pointer increments... */ \
+		S0 = nx1 - ( i % nx1 );                                                \
+		if ( nx2 - ( i % nx2 ) < S0 ) {                                        \
+			S0 = nx2 - ( i % nx2 );                                            \
+		}                                                                      \
+		for ( i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2 ) do
 
 /**
 * Macro containing the epilogue for nested loops which operate on elements of an n-dimensional ndarray.
@@ -0,0 +1,125 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var uniform = require( '@stdlib/random/base/uniform' ).factory;
+var discreteUniform = require( '@stdlib/random/base/discrete-uniform' ).factory;
+var filledarray = require( '@stdlib/array/filled' );
+var filledarrayBy = require( '@stdlib/array/filled-by' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var put = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {PositiveInteger} len - number of indices
+* @returns {Function} benchmark function
+*/
+function createBenchmark( len ) {
+	var idx;
+	var v;
+	var x;
+
+	idx = {
+		'dtype': 'int32',
+		'data': filledarrayBy( len, 'int32', discreteUniform( -len, len-1 ) ),
+		'shape': [ len ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	v = {
+		'dtype': 'float64',
+		'data': filledarrayBy( len, 'float64', uniform( -100.0, 100.0 ) ),
+		'shape': [ len ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	x = {
+		'dtype': 'float64',
+		'data': filledarray( 0.0, len, 'float64' ),
+		'shape': [ len ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			put( [ idx, v, x ], 'normalize' );
+			if ( isnan( x.data[ i%len ] ) ) {
+				b.fail( 'should not return NaN' );
+			}
+		}
+		b.toc();
+		if ( isnan( x.data[ i%len ] ) ) {
+			b.fail( 'should not return NaN' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var f;
+	var i;
+
+	min = 1; // 10^min
+	max = 6; // 10^max
+
+	for ( i = min; i <= max; i++ ) {
+		len = pow( 10, i );
+		f = createBenchmark( len );
+		bench( format( '%s:len=%d,dtype=float64,idtype=int32,mode=normalize', pkg, len ), f );
+	}
+}
+
+main();
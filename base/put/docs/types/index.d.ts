@@ -0,0 +1,81 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+import { ndarray, Mode } from '@stdlib/types/ndarray';
+
+/**
+* Assigns elements from a values ndarray to an output ndarray at the linear view indices contained in an index ndarray.
+*
+* @param arrays - array-like object containing an index ndarray, a values ndarray, and an output ndarray
+* @param mode - specifies how to handle an index outside the interval `[0, N-1]`, where `N` is the number of output ndarray elements (default: the output ndarray index mode, if defined, or `'throw'`)
+* @throws index ndarray and values ndarray must have the same number of elements
+* @throws output ndarray must have at least one element when provided a non-empty index ndarray
+* @throws index exceeds output ndarray bounds
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var Int32Array = require( '@stdlib/array/int32' );
+*
+* // Create data buffers:
+* var ibuf = new Int32Array( [ 4, 0, -1 ] );
+* var vbuf = new Float64Array( [ 10.0, 20.0, 30.0 ] );
+* var xbuf = new Float64Array( 6 );
+*
+* // Create the index, values, and output ndarray-like objects:
+* var idx = {
+*     'dtype': 'int32',
+*     'data': ibuf,
+*     'shape': [ 3 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var v = {
+*     'dtype': 'float64',
+*     'data': vbuf,
+*     'shape': [ 3 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var x = {
+*     'dtype': 'float64',
+*     'data': xbuf,
+*     'shape': [ 2, 3 ],
+*     'strides': [ 3, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+*
+* // Assign elements:
+* put( [ idx, v, x ], 'normalize' );
+*
+* console.log( x.data );
+* // => <Float64Array>[ 20.0, 0.0, 0.0, 0.0, 10.0, 30.0 ]
+*/
+declare function put( arrays: ArrayLike<ndarray>, mode?: Mode ): void;
+
+
+// EXPORTS //
+
+export = put;
@@ -0,0 +1,96 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+import put = require( './index' );
+
+/**
+* Mock function to create an ndarray-like object.
+*
+* @returns ndarray-like object
+*/
+function array(): ndarray {
+	const obj: ndarray = {
+		'byteLength': 80,
+		'BYTES_PER_ELEMENT': 8,
+		'data': new Float64Array( 10 ),
+		'dtype': 'float64',
+		'flags': {
+			'ROW_MAJOR_CONTIGUOUS': true,
+			'COLUMN_MAJOR_CONTIGUOUS': false
+		},
+		'length': 10,
+		'ndims': 1,
+		'offset': 0,
+		'order': 'row-major',
+		'shape': [ 10 ],
+		'strides': [ 1 ],
+		'get': (): number => 0,
+		'set': (): ndarray => obj
+	};
+	return obj;
+}
+
+
+// TESTS //
+
+// The function returns `undefined`...
+{
+	const arrays = [ array(), array(), array() ];
+
+	put( arrays ); // $ExpectType void
+	put( arrays, 'throw' ); // $ExpectType void
+	put( arrays, 'normalize' ); // $ExpectType void
+	put( arrays, 'clamp' ); // $ExpectType void
+	put( arrays, 'wrap' ); // $ExpectType void
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object containing ndarray-like objects...
+{
+	put( 5, 'throw' ); // $ExpectError
+	put( true, 'throw' ); // $ExpectError
+	put( false, 'throw' ); // $ExpectError
+	put( null, 'throw' ); // $ExpectError
+	put( undefined, 'throw' ); // $ExpectError
+	put( {}, 'throw' ); // $ExpectError
+	put( [ 1 ], 'throw' ); // $ExpectError
+	put( ( x: number ): number => x, 'throw' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not a supported index mode...
+{
+	const arrays = [ array(), array(), array() ];
+
+	put( arrays, '10' ); // $ExpectError
+	put( arrays, 5 ); // $ExpectError
+	put( arrays, true ); // $ExpectError
+	put( arrays, false ); // $ExpectError
+	put( arrays, null ); // $ExpectError
+	put( arrays, [] ); // $ExpectError
+	put( arrays, {} ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const arrays = [ array(), array(), array() ];
+
+	put(); // $ExpectError
+	put( arrays, 'throw', 10 ); // $ExpectError
+}
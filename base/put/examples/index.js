@@ -0,0 +1,64 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var discreteUniform = require( '@stdlib/random/array/discrete-uniform' );
+var filledarrayBy = require( '@stdlib/array/filled-by' );
+var zeros = require( '@stdlib/array/zeros' );
+var uniform = require( '@stdlib/random/base/uniform' ).factory;
+var ndarray2array = require( './../../../base/to-array' );
+var put = require( './../lib' );
+
+// Create an ndarray containing random linear indices (including out-of-bounds indices):
+var idx = {
+	'dtype': 'int32',
+	'data': discreteUniform( 6, -20, 20, {
+		'dtype': 'int32'
+	}),
+	'shape': [ 6 ],
+	'strides': [ 1 ],
+	'offset': 0,
+	'order': 'row-major'
+};
+
+// Create an ndarray containing the values to assign:
+var v = {
+	'dtype': 'float64',
+	'data': filledarrayBy( 6, 'float64', uniform( -1.0, 1.0 ) ),
+	'shape': [ 2, 3 ],
+	'strides': [ 3, 1 ],
+	'offset': 0,
+	'order': 'row-major'
+};
+
+// Create an output ndarray:
+var x = {
+	'dtype': 'float64',
+	'data': zeros( 12, 'float64' ),
+	'shape': [ 3, 4 ],
+	'strides': [ 4, 1 ],
+	'offset': 0,
+	'order': 'row-major'
+};
+
+// Assign elements, wrapping out-of-bounds indices:
+put( [ idx, v, x ], 'wrap' );
+
+console.log( ndarray2array( idx.data, idx.shape, idx.strides, idx.offset, idx.order ) );
+console.log( ndarray2array( x.data, x.shape, x.strides, x.offset, x.order ) );
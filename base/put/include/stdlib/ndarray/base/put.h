@@ -0,0 +1,56 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* Header file containing function declarations for ndarray functions which assign ndarray elements according to an index ndarray.
+*/
+#ifndef STDLIB_NDARRAY_BASE_PUT_H
+#define STDLIB_NDARRAY_BASE_PUT_H
+
+#include "put/macros.h"
+
+#include "put/ia_a.h"
+#include "put/ib_b.h"
+#include "put/ic_c.h"
+#include "put/id_d.h"
+#include "put/if_f.h"
+#include "put/ii_i.h"
+#include "put/ik_k.h"
+#include "put/il_l.h"
+#include "put/is_s.h"
+#include "put/it_t.h"
+#include "put/iu_u.h"
+#include "put/iv_v.h"
+#include "put/ix_x.h"
+#include "put/iz_z.h"
+#include "put/la_a.h"
+#include "put/lb_b.h"
+#include "put/lc_c.h"
+#include "put/ld_d.h"
+#include "put/lf_f.h"
+#include "put/li_i.h"
+#include "put/lk_k.h"
+#include "put/ll_l.h"
+#include "put/ls_s.h"
+#include "put/lt_t.h"
+#include "put/lu_u.h"
+#include "put/lv_v.h"
+#include "put/lx_x.h"
+#include "put/lz_z.h"
+
+#endif // !STDLIB_NDARRAY_BASE_PUT_H
@@ -0,0 +1,140 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_PUT_MACROS_H
+#define STDLIB_NDARRAY_BASE_PUT_MACROS_H
+
+#include "stdlib/ndarray/base/ind.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/**
+* Number of loop iterations to look ahead when prefetching randomly accessed ndarray elements.
+*/
+#define STDLIB_NDARRAY_PUT_PREFETCH_DISTANCE 16
+
+/**
+* Macro for hinting that a memory address will soon be written to.
+*
+* ## Notes
+*
+* -   For compilers which do not support prefetch hints, the macro expands to a no-op.
+*
+* @param ptr   memory address
+*/
+#if defined(__GNUC__) || defined(__clang__)
+#define STDLIB_NDARRAY_PUT_PREFETCH( ptr ) __builtin_prefetch( (ptr), 1, 1 )
+#else
+#define STDLIB_NDARRAY_PUT_PREFETCH( ptr ) ((void)0)
+#endif
+
+/**
+* Macro for testing whether the elements of an ndarray can be resolved from a linear view index using a constant number of bytes per index.
+*
+* ## Notes
+*
+* -   Evaluates to `true` for zero-dimensional ndarrays and for ndarrays which are row-major or column-major contiguous and whose strides all have the same sign.
+*
+* @param arr   input ndarray
+*/
+#define STDLIB_NDARRAY_PUT_IS_LINEAR( arr ) ( (arr)->ndims == 0 || ( ( (arr)->flags & (STDLIB_NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG | STDLIB_NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG) ) && (arr)->iterationOrder != 0 ) )
+
+/**
+* Macro for resolving the number of bytes between consecutive linear view indices of an ndarray satisfying `STDLIB_NDARRAY_PUT_IS_LINEAR`.
+*
+* @param arr   input ndarray
+*/
+#define STDLIB_NDARRAY_PUT_LINEAR_INCREMENT( arr ) ( ( (arr)->iterationOrder < 0 ) ? -((arr)->BYTES_PER_ELEMENT) : (arr)->BYTES_PER_ELEMENT )
+
+/**
+* Macro containing a loop which assigns the elements of a values ndarray to the elements of an output ndarray located at the linear view indices contained in an index ndarray.
+*
+* ## Notes
+*
+* -   Expects `arrays` to contain pointers to an index ndarray, a values ndarray having the same number of elements as the index ndarray, and an output ndarray.
+* -   Index ndarray elements are linear view indices into the output ndarray and are resolved according to the output ndarray index mode (see `stdlib_ndarray_ind`). Index and values ndarray elements are visited in linear view order. If an index appears more than once, the last assigned value wins.
+* -   If the values ndarray does not have the same number of elements as the index ndarray, or if an index cannot be resolved (e.g., an index exceeds the output ndarray bounds when the index mode is `STDLIB_NDARRAY_INDEX_ERROR`), the macro returns `-1` from the enclosing function. In the latter case, output ndarray elements corresponding to preceding indices will have already been assigned.
+* -   When element pointers for all three ndarrays can be resolved using a constant number of bytes per linear view index, the loop avoids per-element index resolution and prefetches output ndarray elements `STDLIB_NDARRAY_PUT_PREFETCH_DISTANCE` iterations ahead in order to hide memory latency when indices are random. Otherwise, element pointers are resolved via `stdlib_ndarray_iget_ptr`.
+*
+* @param tidx  index ndarray element type
+* @param tout  values and output ndarray element type
+*
+* @example
+* STDLIB_NDARRAY_PUT_LOOP( int32_t, double )
+*/
+#define STDLIB_NDARRAY_PUT_LOOP( tidx, tout )                                  \
+	const struct ndarray *x1 = arrays[ 0 ];                                    \
+	const struct ndarray *x2 = arrays[ 1 ];                                    \
+	const struct ndarray *x3 = arrays[ 2 ];                                    \
+	const int64_t len = stdlib_ndarray_length( x1 );                           \
+	const int64_t max = stdlib_ndarray_length( x3 ) - 1;                       \
+	const int8_t imode = stdlib_ndarray_index_mode( x3 );                      \
+	const int8_t lx1 = STDLIB_NDARRAY_PUT_IS_LINEAR( x1 );                     \
+	const int8_t lx2 = STDLIB_NDARRAY_PUT_IS_LINEAR( x2 );                     \
+	const int8_t lx3 = STDLIB_NDARRAY_PUT_IS_LINEAR( x3 );                     \
+	const int64_t dx1 = STDLIB_NDARRAY_PUT_LINEAR_INCREMENT( x1 );             \
+	const int64_t dx2 = STDLIB_NDARRAY_PUT_LINEAR_INCREMENT( x2 );             \
+	const int64_t dx3 = STDLIB_NDARRAY_PUT_LINEAR_INCREMENT( x3 );             \
+	const int64_t pd = STDLIB_NDARRAY_PUT_PREFETCH_DISTANCE;                   \
+	uint8_t *pbx1 = stdlib_ndarray_data( x1 ) + stdlib_ndarray_offset( x1 );   \
+	uint8_t *pbx2 = stdlib_ndarray_data( x2 ) + stdlib_ndarray_offset( x2 );   \
+	uint8_t *pbx3 = stdlib_ndarray_data( x3 ) + stdlib_ndarray_offset( x3 );   \
+	uint8_t *px1;                                                              \
+	uint8_t *px2;                                                              \
+	uint8_t *px3;                                                              \
+	int64_t i;                                                                 \
+	int64_t j;                                                                 \
+	if ( stdlib_ndarray_length( x2 ) != len ) {                                \
+		return -1;                                                             \
+	}                                                                          \
+	/* An empty output ndarray cannot be indexed, regardless of index mode... */ \
+	if ( len > 0 && max < 0 ) {                                                \
+		return -1;                                                             \
+	}                                                                          \
+	if ( lx1 && lx2 && lx3 ) {                                                 \
+		px1 = pbx1;                                                            \
+		px2 = pbx2;                                                            \
+		for ( i = 0; i < len; i++ ) {                                          \
+			if ( i+pd < len ) {                                                \
+				j = stdlib_ndarray_ind( (int64_t)( *(tidx *)( px1+(pd*dx1) ) ), max, imode ); \
+				if ( j >= 0 ) {                                                \
+					STDLIB_NDARRAY_PUT_PREFETCH( pbx3+(j*dx3) );               \
+				}                                                              \
+			}                                                                  \
+			j = stdlib_ndarray_ind( (int64_t)( *(tidx *)px1 ), max, imode );   \
+			if ( j < 0 ) {                                                     \
+				return -1;                                                     \
+			}                                                                  \
+			*(tout *)( pbx3+(j*dx3) ) = *(tout *)px2;                          \
+			px1 += dx1;                                                        \
+			px2 += dx2;                                                        \
+		}                                                                      \
+	} else {                                                                   \
+		for ( i = 0; i < len; i++ ) {                                          \
+			px1 = ( lx1 ) ? pbx1+(i*dx1) : stdlib_ndarray_iget_ptr( x1, i );   \
+			px2 = ( lx2 ) ? pbx2+(i*dx2) : stdlib_ndarray_iget_ptr( x2, i );   \
+			j = stdlib_ndarray_ind( (int64_t)( *(tidx *)px1 ), max, imode );   \
+			if ( j < 0 ) {                                                     \
+				return -1;                                                     \
+			}                                                                  \
+			px3 = ( lx3 ) ? pbx3+(j*dx3) : stdlib_ndarray_iget_ptr( x3, j );   \
+			*(tout *)px3 = *(tout *)px2;                                       \
+		}                                                                      \
+	}
+
+#endif // !STDLIB_NDARRAY_BASE_PUT_MACROS_H
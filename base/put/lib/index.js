@@ -0,0 +1,90 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Assign elements from a values ndarray to an output ndarray at the linear view indices contained in an index ndarray.
+*
+* @module @stdlib/ndarray/base/put
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var Int32Array = require( '@stdlib/array/int32' );
+* var put = require( '@stdlib/ndarray/base/put' );
+*
+* // Create data buffers:
+* var ibuf = new Int32Array( [ 4, 0, -1 ] );
+* var vbuf = new Float64Array( [ 10.0, 20.0, 30.0 ] );
+* var xbuf = new Float64Array( 6 );
+*
+* // Create the index, values, and output ndarray-like objects:
+* var idx = {
+*     'dtype': 'int32',
+*     'data': ibuf,
+*     'shape': [ 3 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var v = {
+*     'dtype': 'float64',
+*     'data': vbuf,
+*     'shape': [ 3 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var x = {
+*     'dtype': 'float64',
+*     'data': xbuf,
+*     'shape': [ 2, 3 ],
+*     'strides': [ 3, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+*
+* // Assign elements:
+* put( [ idx, v, x ], 'normalize' );
+*
+* console.log( x.data );
+* // => <Float64Array>[ 20.0, 0.0, 0.0, 0.0, 10.0, 30.0 ]
+*/
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var tryRequire = require( '@stdlib/utils/try-require' );
+var isError = require( '@stdlib/assert/is-error' );
+var main = require( './main.js' );
+
+
+// MAIN //
+
+var put;
+var tmp = tryRequire( join( __dirname, './native.js' ) );
+if ( isError( tmp ) ) {
+	put = main;
+} else {
+	put = tmp;
+}
+
+
+// EXPORTS //
+
+module.exports = put;
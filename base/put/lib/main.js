@@ -0,0 +1,250 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var ndarraylike2object = require( './../../../base/ndarraylike2object' );
+var iterationOrder = require( './../../../base/iteration-order' );
+var strides2order = require( './../../../base/strides2order' );
+var isSingleSegmentCompatible = require( './../../../base/assert/is-single-segment-compatible' );
+var vind2bind = require( './../../../base/vind2bind' );
+var ind = require( './../../../base/ind' ).factory;
+var format = require( '@stdlib/string/format' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns the number of elements in an ndarray.
+*
+* ## Notes
+*
+* -   In contrast to `numel`, this function treats a zero-dimensional ndarray as containing a single element (i.e., as does `ndarray#length`).
+*
+* @private
+* @param {Object} x - object containing ndarray meta data
+* @returns {NonNegativeInteger} number of elements
+*/
+function numel( x ) {
+	if ( x.shape.length === 0 ) {
+		return 1;
+	}
+	return x.length;
+}
+
+/**
+* Returns the data buffer index increment between consecutive linear view indices.
+*
+* ## Notes
+*
+* -   This function mirrors the contiguous fast path of `ndarray#iget`. A constant increment exists when an ndarray is zero-dimensional or when an ndarray is row-major or column-major contiguous.
+* -   If a constant increment does not exist, the function returns `0`.
+*
+* @private
+* @param {Object} x - object containing ndarray meta data
+* @returns {integer} index increment
+*/
+function increment( x ) {
+	var io;
+	if ( x.shape.length === 0 ) {
+		return 1;
+	}
+	io = iterationOrder( x.strides );
+	if ( io === 0 || strides2order( x.strides ) === 0 || !isSingleSegmentCompatible( x.shape, x.strides, x.offset ) ) { // eslint-disable-line max-len
+		return 0;
+	}
+	return io;
+}
+
+/**
+* Resolves the data buffer index corresponding to a linear view index.
+*
+* @private
+* @param {Object} x - object containing ndarray meta data
+* @param {integer} inc - index increment (or `0` if the ndarray does not have a constant index increment)
+* @param {NonNegativeInteger} idx - linear view index
+* @returns {NonNegativeInteger} data buffer index
+*/
+function resolve( x, inc, idx ) {
+	if ( inc ) {
+		return x.offset + ( idx*inc );
+	}
+	return vind2bind( x.shape, x.strides, x.offset, x.order, idx, 'throw' );
+}
+
+
+// MAIN //
+
+/**
+* Assigns elements from a values ndarray to an output ndarray at the linear view indices contained in an index ndarray.
+*
+* ## Notes
+*
+* -   Each provided ndarray should be an object with the following properties:
+*
+*     -   **dtype**: data type.
+*     -   **data**: data buffer.
+*     -   **shape**: dimensions.
+*     -   **strides**: stride lengths.
+*     -   **offset**: index offset.
+*     -   **order**: specifies whether an ndarray is row-major (C-style) or column major (Fortran-style).
+*
+* -   Index ndarray elements are interpreted as linear view indices into the output ndarray (i.e., as if provided to `ndarray#iset`). Index and values ndarray elements are visited in linear view order. If an index appears more than once, the last assigned value wins.
+* -   If not provided a `mode` argument, indices are resolved according to the output ndarray index mode (i.e., the `mode` property, if defined), as is the case for the C kernels.
+*
+* @param {ArrayLikeObject<Object>} arrays - array-like object containing an index ndarray, a values ndarray, and an output ndarray
+* @param {string} [mode] - specifies how to handle an index outside the interval `[0, N-1]`, where `N` is the number of output ndarray elements (default: the output ndarray index mode, if defined, or `'throw'`)
+* @throws {Error} index and values ndarrays must have the same number of elements
+* @throws {RangeError} output ndarray must have at least one element when provided a non-empty index ndarray
+* @throws {RangeError} index exceeds output ndarray bounds
+* @returns {void}
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var Int32Array = require( '@stdlib/array/int32' );
+*
+* // Create data buffers:
+* var ibuf = new Int32Array( [ 4, 0, -1 ] );
+* var vbuf = new Float64Array( [ 10.0, 20.0, 30.0 ] );
+* var xbuf = new Float64Array( 6 );
+*
+* // Create the index, values, and output ndarray-like objects:
+* var idx = {
+*     'dtype': 'int32',
+*     'data': ibuf,
+*     'shape': [ 3 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var v = {
+*     'dtype': 'float64',
+*     'data': vbuf,
+*     'shape': [ 3 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var x = {
+*     'dtype': 'float64',
+*     'data': xbuf,
+*     'shape': [ 2, 3 ],
+*     'strides': [ 3, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+*
+* // Assign elements:
+* put( [ idx, v, x ], 'normalize' );
+*
+* console.log( x.data );
+* // => <Float64Array>[ 20.0, 0.0, 0.0, 0.0, 10.0, 30.0 ]
+*/
+function put( arrays, mode ) {
+	var getIndex;
+	var ibuf;
+	var vbuf;
+	var xbuf;
+	var iget;
+	var vget;
+	var xset;
+	var idx;
+	var max;
+	var di;
+	var dv;
+	var dx;
+	var ii;
+	var iv;
+	var ox;
+	var N;
+	var v;
+	var x;
+	var j;
+	var k;
+
+	// Unpack the ndarrays and standardize ndarray meta data:
+	idx = ndarraylike2object( arrays[ 0 ] );
+	v = ndarraylike2object( arrays[ 1 ] );
+	x = ndarraylike2object( arrays[ 2 ] );
+
+	N = numel( idx );
+	if ( numel( v ) !== N ) {
+		throw new Error( format( 'invalid arguments. Index and values arrays must have the same number of elements. numel(indices) == %d. numel(values) == %d.', N, numel( v ) ) );
+	}
+	// Check whether we were provided empty ndarrays...
+	if ( N === 0 ) {
+		return;
+	}
+	if ( numel( x ) === 0 ) {
+		throw new RangeError( 'invalid operation. Unable to resolve indices for an output array having zero elements.' );
+	}
+	max = numel( x ) - 1;
+	if ( arguments.length < 2 ) {
+		mode = arrays[ 2 ].mode || 'throw';
+	}
+	getIndex = ind( mode );
+
+	ibuf = idx.data;
+	vbuf = v.data;
+	xbuf = x.data;
+
+	di = increment( idx );
+	dv = increment( v );
+	dx = increment( x );
+
+	// Check whether we can resolve every element from its linear view index using a constant index increment...
+	if ( di && dv && dx ) {
+		ii = idx.offset;
+		iv = v.offset;
+		ox = x.offset;
+		if ( idx.accessorProtocol || v.accessorProtocol || x.accessorProtocol ) {
+			iget = idx.accessors[ 0 ];
+			vget = v.accessors[ 0 ];
+			xset = x.accessors[ 1 ];
+			for ( k = 0; k < N; k++ ) {
+				j = getIndex( iget( ibuf, ii ), max );
+				xset( xbuf, ox+(j*dx), vget( vbuf, iv ) );
+				ii += di;
+				iv += dv;
+			}
+			return;
+		}
+		for ( k = 0; k < N; k++ ) {
+			j = getIndex( ibuf[ ii ], max );
+			xbuf[ ox+(j*dx) ] = vbuf[ iv ];
+			ii += di;
+			iv += dv;
+		}
+		return;
+	}
+	// Resolve data buffer indices on a per-element basis:
+	iget = idx.accessors[ 0 ];
+	vget = v.accessors[ 0 ];
+	xset = x.accessors[ 1 ];
+	for ( k = 0; k < N; k++ ) {
+		j = getIndex( iget( ibuf, resolve( idx, di, k ) ), max );
+		xset( xbuf, resolve( x, dx, j ), vget( vbuf, resolve( v, dv, k ) ) );
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = put;
@@ -0,0 +1,126 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/put/ic_c.h"
+#include "stdlib/ndarray/base/put/macros.h"
+#include "stdlib/complex/float32/ctor.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/**
+* Assigns elements from a single-precision complex floating-point values ndarray to an output ndarray at the linear view indices contained in an index ndarray.
+*
+* ## Notes
+*
+* -   Index ndarray elements are resolved according to the output ndarray index mode. If an index appears more than once, the last assigned value wins.
+* -   If successful, the function returns `0`; otherwise, the function returns an error code.
+*
+* @param arrays   array whose first element is a pointer to an index ndarray, whose second element is a pointer to a values ndarray, and whose last element is a pointer to an output ndarray
+* @param data     function data (unused)
+* @return         status code
+*
+* @example
+* #include "stdlib/ndarray/base/put/ic_c.h"
+* #include "stdlib/ndarray/dtypes.h"
+* #include "stdlib/ndarray/index_modes.h"
+* #include "stdlib/ndarray/orders.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include <stdint.h>
+* #include <stdlib.h>
+* #include <stdio.h>
+*
+* // Define the ndarray data types:
+* enum STDLIB_NDARRAY_DTYPE idxdtype = STDLIB_NDARRAY_INT32;
+* enum STDLIB_NDARRAY_DTYPE vdtype = STDLIB_NDARRAY_COMPLEX64;
+* enum STDLIB_NDARRAY_DTYPE xdtype = STDLIB_NDARRAY_COMPLEX64;
+*
+* // Create underlying byte arrays:
+* uint8_t idxbuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+* uint8_t vbuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+* uint8_t xbuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+*
+* // Define the number of dimensions:
+* int64_t ndims = 1;
+*
+* // Define the array shapes:
+* int64_t shidx[] = { 3 };
+* int64_t shv[] = { 3 };
+* int64_t shx[] = { 4 };
+*
+* // Define the strides:
+* int64_t sidx[] = { 4 };
+* int64_t sv[] = { 8 };
+* int64_t sx[] = { 8 };
+*
+* // Define the offsets:
+* int64_t oidx = 0;
+* int64_t ov = 0;
+* int64_t ox = 0;
+*
+* // Define the array order:
+* enum STDLIB_NDARRAY_ORDER order = STDLIB_NDARRAY_ROW_MAJOR;
+*
+* // Specify the index mode:
+* enum STDLIB_NDARRAY_INDEX_MODE imode = STDLIB_NDARRAY_INDEX_ERROR;
+*
+* // Specify the subscript index modes:
+* int8_t submodes[] = { imode };
+* int64_t nsubmodes = 1;
+*
+* // Create an index ndarray:
+* struct ndarray *idx = stdlib_ndarray_allocate( idxdtype, idxbuf, ndims, shidx, sidx, oidx, order, imode, nsubmodes, submodes );
+* if ( idx == NULL ) {
+*     fprintf( stderr, "Error allocating memory.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // Create an values ndarray:
+* struct ndarray *v = stdlib_ndarray_allocate( vdtype, vbuf, ndims, shv, sv, ov, order, imode, nsubmodes, submodes );
+* if ( v == NULL ) {
+*     fprintf( stderr, "Error allocating memory.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // Create an output ndarray:
+* struct ndarray *x = stdlib_ndarray_allocate( xdtype, xbuf, ndims, shx, sx, ox, order, imode, nsubmodes, submodes );
+* if ( x == NULL ) {
+*     fprintf( stderr, "Error allocating memory.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // Create an array containing the ndarrays:
+* struct ndarray *arrays[] = { idx, v, x };
+*
+* // Assign elements:
+* int8_t status = stdlib_ndarray_put_ic_c( arrays, NULL );
+* if ( status != 0 ) {
+*     fprintf( stderr, "Error during computation.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*
+* // ...
+*
+* // Free allocated memory:
+* stdlib_ndarray_free( idx );
+* stdlib_ndarray_free( v );
+* stdlib_ndarray_free( x );
+*/
+int8_t stdlib_ndarray_put_ic_c( struct ndarray *arrays[], void *data ) {
+	STDLIB_NDARRAY_PUT_LOOP( int32_t, stdlib_complex64_t )
+	return 0;
+}
@@ -0,0 +1,322 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var isSameComplex128Array = require( '@stdlib/assert/is-same-complex128array' );
+var ndarray = require( './../../../base/ctor' );
+var put = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof put, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided index and values ndarrays which do not have the same number of elements', function test( t ) {
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		put( [ idx, v, x ], 'throw' );
+	}
+});
+
+tape( 'the function throws an error if provided an empty output ndarray and a non-empty index ndarray', function test( t ) {
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		put( [ idx, v, x ], 'clamp' );
+	}
+});
+
+tape( 'the function throws an error if provided an out-of-bounds index when the index mode is `throw`', function test( t ) {
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 0, -1 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		put( [ idx, v, x ], 'throw' );
+	}
+});
+
+tape( 'the function throws an error if provided an out-of-bounds index when the index mode is `normalize`', function test( t ) {
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 0, 4 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		put( [ idx, v, x ], 'normalize' );
+	}
+});
+
+tape( 'the function assigns elements to an output ndarray (row-major, contiguous)', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 5, 0, 3, 1 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	put( [ idx, v, x ], 'throw' );
+
+	expected = new Float64Array( [ 2.0, 4.0, 0.0, 3.0, 0.0, 1.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements to an output ndarray (column-major, contiguous)', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 1, 4, 2, 0 ] ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+	x = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+
+	put( [ idx, v, x ], 'throw' );
+
+	expected = new Float64Array( [ 4.0, 1.0, 3.0, 0.0, 2.0, 0.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements to an output ndarray (negative strides)', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	// Linear view order: [ 2, 0, 5 ]
+	idx = ndarray( 'int32', new Int32Array( [ 5, 0, 2 ] ), [ 3 ], [ -1 ], 2, 'row-major' );
+
+	// Linear view order: [ 3.0, 2.0, 1.0 ]
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [ 3 ], [ -1 ], 2, 'row-major' );
+
+	// Linear view order: xbuf[ 5 ], xbuf[ 4 ], ..., xbuf[ 0 ]
+	x = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ -3, -1 ], 5, 'row-major' );
+
+	put( [ idx, v, x ], 'throw' );
+
+	expected = new Float64Array( [ 1.0, 0.0, 0.0, 3.0, 0.0, 2.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements to an output ndarray (non-contiguous)', function test( t ) {
+	var expected;
+	var xbuf;
+	var idx;
+	var v;
+	var x;
+
+	// Linear view order: [ 3, 1, 2, 0 ]
+	idx = ndarray( 'int32', new Int32Array( [ 3, 1, 9, 9, 2, 0 ] ), [ 2, 2 ], [ 1, 4 ], 0, 'column-major' );
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	// Linear view order: xbuf[ 0 ], xbuf[ 2 ], xbuf[ 6 ], xbuf[ 8 ]
+	xbuf = new Float64Array( 9 );
+	x = ndarray( 'float64', xbuf, [ 2, 2 ], [ 6, 2 ], 0, 'row-major' );
+
+	put( [ idx, v, x ], 'throw' );
+
+	expected = new Float64Array( [ 4.0, 0.0, 2.0, 0.0, 0.0, 0.0, 3.0, 0.0, 1.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional ndarrays', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ -1 ] ), [], [ 0 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( [ 5.0 ] ), [], [ 0 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 3 ), [], [ 0 ], 1, 'row-major' );
+
+	put( [ idx, v, x ], 'normalize' );
+
+	expected = new Float64Array( [ 0.0, 5.0, 0.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying how to handle out-of-bounds indices', function test( t ) {
+	var expected;
+	var modes;
+	var idx;
+	var v;
+	var x;
+	var i;
+
+	idx = ndarray( 'int32', new Int32Array( [ -6, 5, 9 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	modes = [ 'clamp', 'wrap' ];
+	expected = [
+		new Float64Array( [ 1.0, 0.0, 0.0, 3.0 ] ),
+		new Float64Array( [ 0.0, 3.0, 1.0, 0.0 ] )
+	];
+	for ( i = 0; i < modes.length; i++ ) {
+		x = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+		put( [ idx, v, x ], modes[ i ] );
+		t.deepEqual( x.data, expected[ i ], 'returns expected value for mode '+modes[ i ] );
+	}
+	t.end();
+});
+
+tape( 'if an index appears more than once, the last assigned value wins', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 1, 1, 1 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	put( [ idx, v, x ], 'throw' );
+
+	expected = new Float64Array( [ 0.0, 3.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements to an output ndarray (accessors)', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 2, -3 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'complex128', new Complex128Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	put( [ idx, v, x ], 'normalize' );
+
+	expected = new Complex128Array( [ 3.0, 4.0, 0.0, 0.0, 1.0, 2.0 ] );
+	t.strictEqual( isSameComplex128Array( x.data, expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function assigns elements to an output ndarray (accessors, non-contiguous)', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 1, 0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'complex128', new Complex128Array( 3 ), [ 2 ], [ -2 ], 2, 'row-major' );
+
+	put( [ idx, v, x ], 'throw' );
+
+	expected = new Complex128Array( [ 1.0, 2.0, 0.0, 0.0, 3.0, 4.0 ] );
+	t.strictEqual( isSameComplex128Array( x.data, expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function does not throw when provided empty index and values ndarrays', function test( t ) {
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+	x = ndarray( 'float64', new Float64Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+
+	put( [ idx, v, x ], 'throw' );
+	t.strictEqual( x.data.length, 0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'if not provided an index mode, the function resolves indices according to the output ndarray index mode', function test( t ) {
+	var expected;
+	var idx;
+	var v;
+	var x;
+
+	idx = ndarray( 'int32', new Int32Array( [ 5, -1, 2 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	v = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( 4 ),
+		'shape': [ 4 ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major',
+		'mode': 'wrap'
+	};
+
+	put( [ idx, v, x ] );
+
+	expected = new Float64Array( [ 0.0, 1.0, 3.0, 2.0 ] );
+	t.deepEqual( x.data, expected, 'returns expected value' );
+
+	x.mode = 'throw';
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		put( [ idx, v, x ] );
+	}
+});
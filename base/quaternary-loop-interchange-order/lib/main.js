@@ -45,6 +45,7 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * @param {IntegerArray} sz - third input array stride lengths
 * @param {IntegerArray} sw - fourth input array stride lengths
 * @param {IntegerArray} su - output array stride lengths
+* @param {ArrayLikeObject<(PositiveInteger|null)>} [nbytes] - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns {Object} loop interchange data
 *
 * @example
@@ -77,8 +78,8 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * var ssu = o.su;
 * // returns [ 1, -2, 6 ]
 */
-function quaternaryLoopOrder( sh, sx, sy, sz, sw, su ) {
-	var tmp = loopOrder( sh, [ sx, sy, sz, sw, su ] );
+function quaternaryLoopOrder( sh, sx, sy, sz, sw, su, nbytes ) {
+	var tmp = loopOrder( sh, [ sx, sy, sz, sw, su ], ( arguments.length > 6 ) ? nbytes : [] );
 	return {
 		'sh': tmp[ 0 ],
 		'sx': tmp[ 1 ],
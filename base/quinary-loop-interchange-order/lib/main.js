@@ -47,6 +47,7 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * @param {IntegerArray} sw - fourth input array stride lengths
 * @param {IntegerArray} su - fifth input array stride lengths
 * @param {IntegerArray} sv - output array stride lengths
+* @param {ArrayLikeObject<(PositiveInteger|null)>} [nbytes] - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns {Object} loop interchange data
 *
 * @example
@@ -83,8 +84,8 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * var ssv = o.sv;
 * // returns [ 6, -2, 1 ]
 */
-function quinaryLoopOrder( sh, sx, sy, sz, sw, su, sv ) {
-	var tmp = loopOrder( sh, [ sx, sy, sz, sw, su, sv ] );
+function quinaryLoopOrder( sh, sx, sy, sz, sw, su, sv, nbytes ) {
+	var tmp = loopOrder( sh, [ sx, sy, sz, sw, su, sv ], ( arguments.length > 7 ) ? nbytes : [] );
 	return {
 		'sh': tmp[ 0 ],
 		'sx': tmp[ 1 ],
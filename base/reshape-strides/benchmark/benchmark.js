@@ -0,0 +1,102 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isArray = require( '@stdlib/assert/is-array' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var reshapeStrides = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s::row-major', pkg ), function benchmark( b ) {
+	var shapes;
+	var out;
+	var i;
+
+	shapes = [
+		[ 100, 10 ],
+		[ 10, 100 ],
+		[ 1000 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = reshapeStrides( [ 10, 10, 10 ], [ 100, 10, 1 ], shapes[ i%shapes.length ], 'row-major' );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an array' );
+		}
+	}
+	b.toc();
+	if ( !isArray( out ) ) {
+		b.fail( 'should return an array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::column-major', pkg ), function benchmark( b ) {
+	var shapes;
+	var out;
+	var i;
+
+	shapes = [
+		[ 100, 10 ],
+		[ 10, 100 ],
+		[ 1000 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = reshapeStrides( [ 10, 10, 10 ], [ 1, 10, 100 ], shapes[ i%shapes.length ], 'column-major' );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an array' );
+		}
+	}
+	b.toc();
+	if ( !isArray( out ) ) {
+		b.fail( 'should return an array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::non-contiguous', pkg ), function benchmark( b ) {
+	var out;
+	var i;
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = reshapeStrides( [ 10, 10, 10 ], [ 200, 10, 1 ], [ 100, 10 ], 'row-major' );
+		if ( out !== null ) {
+			b.fail( 'should return null' );
+		}
+	}
+	b.toc();
+	if ( out !== null ) {
+		b.fail( 'should return null' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
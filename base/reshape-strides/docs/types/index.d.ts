@@ -0,0 +1,54 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+import { Order } from '@stdlib/types/ndarray';
+
+/**
+* Returns the strides of an ndarray view having a specified shape and sharing the same underlying memory as an input ndarray, if such a view exists.
+*
+* ## Notes
+*
+* -   Elements are read from the input ndarray and placed in an output ndarray according to a specified order (i.e., either lexicographic (`'row-major'`) or colexicographic (`'column-major'`) index order).
+* -   If a view does not exist, the function returns `null`, and an ndarray must be copied in order to be reshaped.
+*
+* @param shape - input array shape
+* @param strides - input array strides
+* @param newShape - output array shape
+* @param order - index order
+* @returns output array strides
+*
+* @example
+* var st = reshapeStrides( [ 2, 3, 4 ], [ 24, 4, 1 ], [ 2, 12 ], 'row-major' );
+* // returns [ 24, 1 ]
+*
+* @example
+* var st = reshapeStrides( [ 2, 3, 4 ], [ 24, 4, 1 ], [ 6, 4 ], 'row-major' );
+* // returns null
+*/
+declare function reshapeStrides( shape: ArrayLike<number>, strides: ArrayLike<number>, newShape: ArrayLike<number>, order: Order ): Array<number> | null;
+
+
+// EXPORTS //
+
+export = reshapeStrides;
@@ -0,0 +1,75 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+import reshapeStrides = require( './index' );
+
+
+// TESTS //
+
+// The function returns an array of numbers or null...
+{
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectType number[] | null
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object of numbers...
+{
+	reshapeStrides( true, [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( false, [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( '5', [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( 123, [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( {}, [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( ( x: number ): number => x, [ 3, 1 ], [ 6 ], 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an array-like object of numbers...
+{
+	reshapeStrides( [ 2, 3 ], true, [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], false, [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], '5', [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], 123, [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], {}, [ 6 ], 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], ( x: number ): number => x, [ 6 ], 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a third argument which is not an array-like object of numbers...
+{
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], true, 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], false, 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], '5', 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], 123, 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], {}, 'row-major' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], ( x: number ): number => x, 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a fourth argument which is not a recognized order...
+{
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], 'foo' ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], true ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], 123 ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], {} ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	reshapeStrides(); // $ExpectError
+	reshapeStrides( [ 2, 3 ] ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ] ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ] ); // $ExpectError
+	reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], 'row-major', {} ); // $ExpectError
+}
@@ -0,0 +1,46 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var reshapeStrides = require( './../lib' );
+
+// Define the shape and strides of a row-major view containing every other matrix of a 4x3x4 array:
+var shape = [ 2, 3, 4 ];
+var strides = [ 24, 4, 1 ];
+
+// Merge the trailing (contiguous) dimensions:
+var st = reshapeStrides( shape, strides, [ 2, 12 ], 'row-major' );
+console.log( 'strides: %s', JSON.stringify( st ) );
+// => 'strides: [24,1]'
+
+// Split a dimension:
+st = reshapeStrides( shape, strides, [ 2, 3, 2, 2 ], 'row-major' );
+console.log( 'strides: %s', JSON.stringify( st ) );
+// => 'strides: [24,4,2,1]'
+
+// Attempt to merge non-contiguous dimensions:
+st = reshapeStrides( shape, strides, [ 6, 4 ], 'row-major' );
+console.log( 'strides: %s', JSON.stringify( st ) );
+// => 'strides: null'
+
+// Attempt to read elements in an order which does not match the memory layout:
+st = reshapeStrides( shape, strides, [ 24 ], 'column-major' );
+console.log( 'strides: %s', JSON.stringify( st ) );
+// => 'strides: null'
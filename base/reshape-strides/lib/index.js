@@ -0,0 +1,49 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+/**
+* Return the strides of an ndarray view having a specified shape and sharing the same underlying memory as an input ndarray, if such a view exists.
+*
+* @module @stdlib/ndarray/base/reshape-strides
+*
+* @example
+* var reshapeStrides = require( '@stdlib/ndarray/base/reshape-strides' );
+*
+* // Define the strides of a row-major view containing every other matrix of a larger array:
+* var strides = [ 24, 4, 1 ];
+*
+* // Merge the trailing contiguous dimensions:
+* var st = reshapeStrides( [ 2, 3, 4 ], strides, [ 2, 12 ], 'row-major' );
+* // returns [ 24, 1 ]
+*
+* // Attempt to merge non-contiguous dimensions:
+* st = reshapeStrides( [ 2, 3, 4 ], strides, [ 6, 4 ], 'row-major' );
+* // returns null
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -0,0 +1,160 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var isColumnMajorString = require( './../../../base/assert/is-column-major-string' );
+var shape2strides = require( './../../../base/shape2strides' );
+
+
+// MAIN //
+
+/**
+* Returns the strides of an ndarray view having a specified shape and sharing the same underlying memory as an input ndarray, if such a view exists.
+*
+* ## Notes
+*
+* -   Elements are read from the input ndarray and placed in an output ndarray according to a specified order (i.e., either lexicographic (`'row-major'`) or colexicographic (`'column-major'`) index order).
+* -   A view exists when each group of input dimensions which maps to a group of output dimensions is contiguous with respect to the specified order. In which case, the output strides can be expressed in terms of the input strides and the view has the same index offset as the input ndarray.
+* -   If a view does not exist, the function returns `null`, and an ndarray must be copied in order to be reshaped.
+*
+* @param {NonNegativeIntegerArray} shape - input array shape
+* @param {IntegerArray} strides - input array strides
+* @param {NonNegativeIntegerArray} newShape - output array shape
+* @param {string} order - index order
+* @returns {(IntegerArray|null)} output array strides
+*
+* @example
+* var st = reshapeStrides( [ 2, 3, 4 ], [ 12, 4, 1 ], [ 6, 4 ], 'row-major' );
+* // returns [ 4, 1 ]
+*
+* @example
+* var st = reshapeStrides( [ 2, 3, 4 ], [ 24, 8, 1 ], [ 6, 4 ], 'row-major' );
+* // returns [ 8, 1 ]
+*
+* @example
+* var st = reshapeStrides( [ 2, 3, 4 ], [ 24, 8, 1 ], [ 2, 12 ], 'row-major' );
+* // returns null
+*
+* @example
+* var st = reshapeStrides( [ 2, 3 ], [ 1, 2 ], [ 6 ], 'column-major' );
+* // returns [ 1 ]
+*/
+function reshapeStrides( shape, strides, newShape, order ) {
+	var isCol;
+	var out;
+	var osh;
+	var ost;
+	var np;
+	var op;
+	var ni;
+	var nj;
+	var oi;
+	var oj;
+	var N;
+	var s;
+	var k;
+
+	// When an array is empty, any set of strides describes the same (empty) set of elements:
+	for ( k = 0; k < shape.length; k++ ) {
+		if ( shape[ k ] === 0 ) {
+			return shape2strides( newShape, order );
+		}
+	}
+	isCol = isColumnMajorString( order );
+
+	// Remove singleton dimensions, as they do not affect which elements are visited:
+	osh = [];
+	ost = [];
+	for ( k = 0; k < shape.length; k++ ) {
+		if ( shape[ k ] !== 1 ) {
+			osh.push( shape[ k ] );
+			ost.push( strides[ k ] );
+		}
+	}
+	N = newShape.length;
+	out = [];
+	for ( k = 0; k < N; k++ ) {
+		out.push( 0 );
+	}
+	// Find the smallest groups of input and output dimensions having the same number of elements...
+	oi = 0;
+	oj = 1;
+	ni = 0;
+	nj = 1;
+	while ( ni < N && oi < osh.length ) {
+		np = newShape[ ni ];
+		op = osh[ oi ];
+		while ( np !== op ) {
+			if ( np < op ) {
+				np *= newShape[ nj ];
+				nj += 1;
+			} else {
+				op *= osh[ oj ];
+				oj += 1;
+			}
+		}
+		// Check whether the group of input dimensions is contiguous with respect to the index order...
+		for ( k = oi; k < oj-1; k++ ) {
+			if ( isCol ) {
+				if ( ost[ k+1 ] !== osh[ k ]*ost[ k ] ) {
+					return null;
+				}
+			} else if ( ost[ k ] !== osh[ k+1 ]*ost[ k+1 ] ) {
+				return null;
+			}
+		}
+		// Compute the strides for the group of output dimensions...
+		if ( isCol ) {
+			out[ ni ] = ost[ oi ];
+			for ( k = ni+1; k < nj; k++ ) {
+				out[ k ] = out[ k-1 ] * newShape[ k-1 ];
+			}
+		} else {
+			out[ nj-1 ] = ost[ oj-1 ];
+			for ( k = nj-1; k > ni; k-- ) {
+				out[ k-1 ] = out[ k ] * newShape[ k ];
+			}
+		}
+		ni = nj;
+		nj += 1;
+		oi = oj;
+		oj += 1;
+	}
+	// Assign strides to any remaining (trailing) singleton output dimensions:
+	if ( ni > 0 ) {
+		s = out[ ni-1 ];
+		if ( isCol ) {
+			s *= newShape[ ni-1 ];
+		}
+	} else {
+		s = 1;
+	}
+	for ( k = ni; k < N; k++ ) {
+		out[ k ] = s;
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = reshapeStrides;
@@ -0,0 +1,143 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var reshapeStrides = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof reshapeStrides, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns view strides when merging contiguous dimensions (row-major)', function test( t ) {
+	var st;
+
+	st = reshapeStrides( [ 2, 3, 4 ], [ 12, 4, 1 ], [ 24 ], 'row-major' );
+	t.deepEqual( st, [ 1 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 2, 3, 4 ], [ 12, 4, 1 ], [ 6, 4 ], 'row-major' );
+	t.deepEqual( st, [ 4, 1 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 2, 3, 4 ], [ -24, -8, -2 ], [ 2, 12 ], 'row-major' );
+	t.deepEqual( st, [ -24, -2 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns view strides when merging contiguous dimensions (column-major)', function test( t ) {
+	var st;
+
+	st = reshapeStrides( [ 2, 3, 4 ], [ 1, 2, 6 ], [ 24 ], 'column-major' );
+	t.deepEqual( st, [ 1 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 2, 3, 4 ], [ 1, 2, 6 ], [ 6, 4 ], 'column-major' );
+	t.deepEqual( st, [ 1, 6 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 2, 3, 4 ], [ 2, 4, 12 ], [ 2, 12 ], 'column-major' );
+	t.deepEqual( st, [ 2, 4 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns view strides when splitting dimensions', function test( t ) {
+	var st;
+
+	st = reshapeStrides( [ 24 ], [ 2 ], [ 2, 3, 4 ], 'row-major' );
+	t.deepEqual( st, [ 24, 8, 2 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 24 ], [ 2 ], [ 2, 3, 4 ], 'column-major' );
+	t.deepEqual( st, [ 2, 4, 12 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 4, 6 ], [ -6, -1 ], [ 2, 2, 3, 2 ], 'row-major' );
+	t.deepEqual( st, [ -12, -6, -2, -1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns `null` when a view does not exist', function test( t ) {
+	var st;
+
+	// Non-contiguous dimensions:
+	st = reshapeStrides( [ 2, 3, 4 ], [ 24, 4, 1 ], [ 6, 4 ], 'row-major' );
+	t.strictEqual( st, null, 'returns expected value' );
+
+	// Index order does not match the memory layout:
+	st = reshapeStrides( [ 2, 3 ], [ 3, 1 ], [ 6 ], 'column-major' );
+	t.strictEqual( st, null, 'returns expected value' );
+
+	st = reshapeStrides( [ 2, 3 ], [ 1, 2 ], [ 6 ], 'row-major' );
+	t.strictEqual( st, null, 'returns expected value' );
+
+	// Transposed:
+	st = reshapeStrides( [ 3, 2 ], [ 1, 3 ], [ 2, 3 ], 'row-major' );
+	t.strictEqual( st, null, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function ignores singleton dimensions', function test( t ) {
+	var st;
+
+	st = reshapeStrides( [ 2, 1, 3 ], [ 3, 100, 1 ], [ 6 ], 'row-major' );
+	t.deepEqual( st, [ 1 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 6 ], [ 1 ], [ 1, 2, 1, 3, 1 ], 'row-major' );
+	t.deepEqual( st.length, 5, 'returns expected value' );
+	t.strictEqual( st[ 1 ], 3, 'returns expected value' );
+	t.strictEqual( st[ 3 ], 1, 'returns expected value' );
+
+	st = reshapeStrides( [ 6 ], [ 1 ], [ 1, 2, 1, 3, 1 ], 'column-major' );
+	t.deepEqual( st.length, 5, 'returns expected value' );
+	t.strictEqual( st[ 1 ], 1, 'returns expected value' );
+	t.strictEqual( st[ 3 ], 2, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional arrays', function test( t ) {
+	var st;
+
+	st = reshapeStrides( [], [ 0 ], [ 1, 1 ], 'row-major' );
+	t.deepEqual( st, [ 1, 1 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 1, 1 ], [ 5, 5 ], [], 'row-major' );
+	t.deepEqual( st, [], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports empty arrays', function test( t ) {
+	var st;
+
+	st = reshapeStrides( [ 2, 0 ], [ 0, 1 ], [ 0, 5 ], 'row-major' );
+	t.deepEqual( st, [ 5, 1 ], 'returns expected value' );
+
+	st = reshapeStrides( [ 2, 0 ], [ 0, 1 ], [ 0, 5 ], 'column-major' );
+	t.deepEqual( st, [ 1, 0 ], 'returns expected value' );
+
+	t.end();
+});
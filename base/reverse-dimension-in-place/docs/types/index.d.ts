@@ -0,0 +1,55 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+
+/**
+* Reverses the order of elements along a specified dimension of an input ndarray in-place.
+*
+* ## Notes
+*
+* -   The function swaps elements within the input ndarray's underlying data buffer and does not allocate a second buffer.
+* -   The function assumes that distinct ndarray elements do not share memory (e.g., as may be the case for broadcasted ndarrays).
+* -   The function mutates the input ndarray in-place.
+*
+* @param x - input array
+* @param dim - index of dimension to reverse
+* @returns input ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ] );
+* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ]
+*
+* var out = reverseDimensionInPlace( x, 0 );
+* // returns <ndarray>[ [ 5, 6 ], [ 3, 4 ], [ 1, 2 ] ]
+*
+* var bool = ( out === x );
+* // returns true
+*/
+declare function reverseDimensionInPlace<T extends ndarray = ndarray>( x: T, dim: number ): T;
+
+
+// EXPORTS //
+
+export = reverseDimensionInPlace;
@@ -0,0 +1,66 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/* eslint-disable space-in-parens */
+
+import zeros = require( './../../../../zeros' );
+import reverseDimensionInPlace = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reverseDimensionInPlace( x, 0 ); // $ExpectType float64ndarray
+}
+
+// The compiler throws an error if the function is not provided a first argument which is an ndarray...
+{
+	reverseDimensionInPlace( '5', 0 ); // $ExpectError
+	reverseDimensionInPlace( 5, 0 ); // $ExpectError
+	reverseDimensionInPlace( true, 0 ); // $ExpectError
+	reverseDimensionInPlace( false, 0 ); // $ExpectError
+	reverseDimensionInPlace( null, 0 ); // $ExpectError
+	reverseDimensionInPlace( {}, 0 ); // $ExpectError
+	reverseDimensionInPlace( [ '5' ], 0 ); // $ExpectError
+	reverseDimensionInPlace( ( x: number ): number => x, 0 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is not provided a second argument which is a number...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reverseDimensionInPlace( x, '5' ); // $ExpectError
+	reverseDimensionInPlace( x, true ); // $ExpectError
+	reverseDimensionInPlace( x, false ); // $ExpectError
+	reverseDimensionInPlace( x, null ); // $ExpectError
+	reverseDimensionInPlace( x, {} ); // $ExpectError
+	reverseDimensionInPlace( x, [] ); // $ExpectError
+	reverseDimensionInPlace( x, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reverseDimensionInPlace(); // $ExpectError
+	reverseDimensionInPlace( x ); // $ExpectError
+	reverseDimensionInPlace( x, 0, {} ); // $ExpectError
+}
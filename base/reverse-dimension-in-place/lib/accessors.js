@@ -0,0 +1,113 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var zeros = require( '@stdlib/array/base/zeros' );
+
+
+// MAIN //
+
+/**
+* Swaps the elements of two non-overlapping ndarray views which share the same accessor array data buffer.
+*
+* ## Notes
+*
+* -   The function iterates over the last dimension in the innermost loop.
+*
+* @private
+* @param {Collection} buf - data buffer
+* @param {Array<Function>} accessors - array element accessors
+* @param {NonNegativeIntegerArray} shape - view shape
+* @param {IntegerArray} sa - strides of the first view
+* @param {NonNegativeInteger} oa - index offset of the first view
+* @param {IntegerArray} sb - strides of the second view
+* @param {NonNegativeInteger} ob - index offset of the second view
+* @returns {Collection} data buffer
+*
+* @example
+* var Complex64Array = require( '@stdlib/array/complex64' );
+* var accessors = require( '@stdlib/array/base/accessors' );
+*
+* var buf = new Complex64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+*
+* swap( buf, accessors( buf ).accessors, [ 1 ], [ 1 ], 0, [ -1 ], 2 );
+* // buf => <Complex64Array>[ 5.0, 6.0, 3.0, 4.0, 1.0, 2.0 ]
+*/
+function swap( buf, accessors, shape, sa, oa, sb, ob ) {
+	var idx;
+	var tmp;
+	var get;
+	var set;
+	var da;
+	var db;
+	var ia;
+	var ib;
+	var S0;
+	var N;
+	var i;
+	var j;
+
+	get = accessors[ 0 ];
+	set = accessors[ 1 ];
+
+	N = shape.length;
+	S0 = shape[ N-1 ];
+	da = sa[ N-1 ];
+	db = sb[ N-1 ];
+
+	// Initialize a list of indices for iterating over the outer dimensions:
+	idx = zeros( N );
+
+	ia = oa;
+	ib = ob;
+	while ( true ) {
+		for ( i = 0; i < S0; i++ ) {
+			tmp = get( buf, ia );
+			set( buf, ia, get( buf, ib ) );
+			set( buf, ib, tmp );
+			ia += da;
+			ib += db;
+		}
+		ia -= S0 * da;
+		ib -= S0 * db;
+
+		// Move to the next set of outer indices...
+		for ( j = N-2; j >= 0; j-- ) {
+			idx[ j ] += 1;
+			ia += sa[ j ];
+			ib += sb[ j ];
+			if ( idx[ j ] < shape[ j ] ) {
+				break;
+			}
+			ia -= shape[ j ] * sa[ j ];
+			ib -= shape[ j ] * sb[ j ];
+			idx[ j ] = 0;
+		}
+		if ( j < 0 ) {
+			return buf;
+		}
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = swap;
@@ -0,0 +1,47 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Reverse the order of elements along a specified dimension of an input ndarray in-place.
+*
+* @module @stdlib/ndarray/base/reverse-dimension-in-place
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var reverseDimensionInPlace = require( '@stdlib/ndarray/base/reverse-dimension-in-place' );
+*
+* var x = array( [ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ] );
+* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ]
+*
+* var out = reverseDimensionInPlace( x, 0 );
+* // returns <ndarray>[ [ 5, 6 ], [ 3, 4 ], [ 1, 2 ] ]
+*
+* var bool = ( out === x );
+* // returns true
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -0,0 +1,108 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var ndarraylike2object = require( './../../../base/ndarraylike2object' );
+var format = require( '@stdlib/string/format' );
+var accessors = require( './accessors.js' );
+var base = require( './base.js' );
+
+
+// MAIN //
+
+/**
+* Reverses the order of elements along a specified dimension of an input ndarray in-place.
+*
+* ## Notes
+*
+* -   The function swaps elements within the input ndarray's underlying data buffer and does not allocate a second buffer.
+* -   The function assumes that distinct ndarray elements do not share memory (e.g., as may be the case for broadcasted ndarrays).
+* -   The function mutates the input ndarray in-place.
+*
+* @param {ndarray} x - input array
+* @param {integer} dim - index of dimension to reverse
+* @throws {TypeError} first argument must be an ndarray having one or more dimensions
+* @throws {RangeError} dimension index exceeds the number of dimensions
+* @returns {ndarray} input ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ] );
+* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ], [ 5, 6 ] ]
+*
+* var out = reverseDimensionInPlace( x, 0 );
+* // returns <ndarray>[ [ 5, 6 ], [ 3, 4 ], [ 1, 2 ] ]
+*
+* var bool = ( out === x );
+* // returns true
+*/
+function reverseDimensionInPlace( x, dim ) {
+	var obj;
+	var sh;
+	var sa;
+	var sb;
+	var ob;
+	var N;
+	var S;
+	var d;
+
+	obj = ndarraylike2object( x );
+	sh = obj.shape;
+	N = sh.length;
+
+	// Check whether we were provided a zero-dimensional array...
+	if ( N === 0 ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray having one or more dimensions. Number of dimensions: %d.', N ) );
+	}
+	// Normalize the dimension index...
+	d = dim;
+	if ( d < 0 ) {
+		d += N;
+		if ( d < 0 ) {
+			throw new RangeError( format( 'invalid argument. Dimension index exceeds the number of dimensions. Number of dimensions: %d. Value: `%d`.', N, dim ) );
+		}
+	} else if ( d >= N ) {
+		throw new RangeError( format( 'invalid argument. Dimension index exceeds the number of dimensions. Number of dimensions: %d. Value: `%d`.', N, dim ) );
+	}
+	S = sh[ d ];
+	if ( obj.length === 0 || S < 2 ) {
+		return x;
+	}
+	// Define a view spanning the first half of the specified dimension and a reversed view spanning the second half, such that swapping corresponding elements reverses the dimension:
+	sa = obj.strides;
+	sb = sa.slice();
+	sb[ d ] = -sa[ d ];
+	ob = obj.offset + ( ( S-1 ) * sa[ d ] );
+	sh[ d ] = ( S/2 )|0;
+
+	if ( obj.accessorProtocol ) {
+		accessors( obj.data, obj.accessors, sh, sa, obj.offset, sb, ob );
+	} else {
+		base( obj.data, sh, sa, obj.offset, sb, ob );
+	}
+	return x;
+}
+
+
+// EXPORTS //
+
+module.exports = reverseDimensionInPlace;
@@ -0,0 +1,198 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var isSameComplex128Array = require( '@stdlib/assert/is-same-complex128array' );
+var ndarray = require( './../../../base/ctor' );
+var ndarray2array = require( './../../../to-array' );
+var toReversedDimension = require( './../../../base/to-reversed-dimension' );
+var zeros = require( './../../../base/zeros' );
+var getData = require( './../../../data-buffer' );
+var reverseDimensionInPlace = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns an ndarray whose elements are filled with increasing values.
+*
+* @private
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {string} order - memory layout
+* @returns {ndarray} ndarray
+*/
+function linspace( shape, order ) {
+	var buf;
+	var x;
+	var i;
+
+	x = zeros( 'float64', shape, order );
+	buf = getData( x );
+	for ( i = 0; i < buf.length; i++ ) {
+		buf[ i ] = i;
+	}
+	return x;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof reverseDimensionInPlace, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a zero-dimensional array', function test( t ) {
+	var x = new ndarray( 'float64', new Float64Array( [ 5.0 ] ), [], [ 0 ], 0, 'row-major' );
+	t.throws( badValue, TypeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		reverseDimensionInPlace( x, 0 );
+	}
+});
+
+tape( 'the function throws an error if the dimension index exceeds the number of dimensions', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+	values = [
+		10,
+		2,
+		-3,
+		-10
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( dim ) {
+		return function badValue() {
+			reverseDimensionInPlace( x, dim );
+		};
+	}
+});
+
+tape( 'the function reverses a specified dimension in-place (row-major)', function test( t ) {
+	var expected;
+	var buf;
+	var out;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', buf, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	out = reverseDimensionInPlace( x, 0 );
+	expected = [
+		[ 5.0, 6.0 ],
+		[ 3.0, 4.0 ],
+		[ 1.0, 2.0 ]
+	];
+	t.strictEqual( out, x, 'returns expected value' );
+	t.strictEqual( getData( out ), buf, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+
+	out = reverseDimensionInPlace( x, -1 );
+	expected = [
+		[ 6.0, 5.0 ],
+		[ 4.0, 3.0 ],
+		[ 2.0, 1.0 ]
+	];
+	t.strictEqual( out, x, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function reverses a specified dimension in-place (column-major)', function test( t ) {
+	var expected;
+	var out;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+
+	out = reverseDimensionInPlace( x, 1 );
+	expected = [
+		[ 5.0, 3.0, 1.0 ],
+		[ 6.0, 4.0, 2.0 ]
+	];
+	t.strictEqual( out, x, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function reverses a specified dimension of a multi-dimensional ndarray in-place', function test( t ) {
+	var expected;
+	var orders;
+	var x;
+	var i;
+	var d;
+
+	orders = [ 'row-major', 'column-major' ];
+	for ( i = 0; i < orders.length; i++ ) {
+		for ( d = 0; d < 3; d++ ) {
+			x = linspace( [ 3, 4, 5 ], orders[ i ] );
+			expected = ndarray2array( toReversedDimension( x, d ) );
+
+			reverseDimensionInPlace( x, d );
+			t.deepEqual( ndarray2array( x ), expected, 'returns expected value (order='+orders[ i ]+', dim='+d+')' );
+		}
+	}
+	t.end();
+});
+
+tape( 'the function reverses a specified dimension in-place (accessors)', function test( t ) {
+	var expected;
+	var buf;
+	var x;
+
+	buf = new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'complex128', buf, [ 3 ], [ 1 ], 0, 'row-major' );
+
+	reverseDimensionInPlace( x, 0 );
+	expected = new Complex128Array( [ 5.0, 6.0, 3.0, 4.0, 1.0, 2.0 ] );
+
+	t.strictEqual( isSameComplex128Array( getData( x ), expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports empty ndarrays and singleton dimensions', function test( t ) {
+	var expected;
+	var out;
+	var x;
+
+	x = zeros( 'float64', [ 0, 3 ], 'row-major' );
+	out = reverseDimensionInPlace( x, 1 );
+	t.strictEqual( out, x, 'returns expected value' );
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0 ] ), [ 1, 2 ], [ 2, 1 ], 0, 'row-major' );
+	out = reverseDimensionInPlace( x, 0 );
+	expected = [ [ 1.0, 2.0 ] ];
+	t.strictEqual( out, x, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
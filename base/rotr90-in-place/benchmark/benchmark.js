@@ -0,0 +1,122 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var uniform = require( '@stdlib/random/array/uniform' );
+var ndarray = require( './../../../base/ctor' );
+var shape2strides = require( './../../../base/shape2strides' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var rotr90InPlace = require( './../lib' );
+
+
+// VARIABLES //
+
+var types = [ 'float64' ];
+var orders = [ 'row-major', 'column-major' ];
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {PositiveInteger} N - number of rows (and columns)
+* @param {string} dtype - data type
+* @param {string} order - memory layout
+* @returns {Function} benchmark function
+*/
+function createBenchmark( N, dtype, order ) {
+	var len;
+	var sh;
+	var x;
+
+	len = N * N;
+	sh = [ N, N ];
+	x = uniform( len, -100.0, 100.0, {
+		'dtype': dtype
+	});
+	x = new ndarray( dtype, x, sh, shape2strides( sh, order ), 0, order );
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var buf;
+		var i;
+
+		buf = x.data;
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			rotr90InPlace( x, 1 );
+			if ( isnan( buf[ i%len ] ) ) {
+				b.fail( 'should not return NaN' );
+			}
+		}
+		b.toc();
+		if ( isnan( buf[ i%len ] ) ) {
+			b.fail( 'should not return NaN' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var min;
+	var max;
+	var N;
+	var f;
+	var i;
+	var j;
+	var k;
+
+	min = 1; // 2^min
+	max = 10; // 2^max
+
+	for ( k = 0; k < orders.length; k++ ) {
+		for ( j = 0; j < types.length; j++ ) {
+			for ( i = min; i <= max; i++ ) {
+				N = pow( 2, i );
+				f = createBenchmark( N, types[ j ], orders[ k ] );
+				bench( format( '%s:k=1,shape=[%d,%d],order=%s,dtype=%s', pkg, N, N, orders[ k ], types[ j ] ), f );
+			}
+		}
+	}
+}
+
+main();
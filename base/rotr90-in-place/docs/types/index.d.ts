@@ -0,0 +1,59 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+
+/**
+* Rotates a matrix (or a stack of matrices) 90 degrees clockwise in-place.
+*
+* ## Notes
+*
+* -   If `k > 0`, the function rotates the matrix clockwise.
+* -   If `k < 0`, the function rotates the matrix counterclockwise.
+* -   The function rotates the last two dimensions of the input ndarray. If provided an ndarray having fewer than two dimensions, the function returns the input ndarray unchanged.
+* -   A rotation by an odd multiple of 90 degrees requires that the last two dimensions have the same size. A rotation by 180 degrees supports matrices of any shape.
+* -   The function swaps elements within the input ndarray's underlying data buffer and does not allocate a second buffer.
+* -   The function assumes that distinct ndarray elements do not share memory (e.g., as may be the case for broadcasted ndarrays).
+* -   The function mutates the input ndarray in-place.
+*
+* @param x - input array
+* @param k - number of times to rotate by 90 degrees
+* @returns input ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+* // returns <ndarray>[ [ 1, 2 ], [ 3, 4 ] ]
+*
+* var out = rotr90InPlace( x, 1 );
+* // returns <ndarray>[ [ 3, 1 ], [ 4, 2 ] ]
+*
+* var bool = ( out === x );
+* // returns true
+*/
+declare function rotr90InPlace<T extends ndarray = ndarray>( x: T, k: number ): T;
+
+
+// EXPORTS //
+
+export = rotr90InPlace;
@@ -0,0 +1,41 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var zeros = require( './../../../base/zeros' );
+var getData = require( './../../../data-buffer' );
+var ndarray2array = require( './../../../to-array' );
+var rotr90InPlace = require( './../lib' );
+
+// Create a square matrix:
+var x = zeros( 'float64', [ 3, 3 ], 'row-major' );
+
+// Fill the underlying data buffer with increasing values:
+var buf = getData( x );
+var i;
+for ( i = 0; i < buf.length; i++ ) {
+	buf[ i ] = i;
+}
+console.log( ndarray2array( x ) );
+
+// Rotate the matrix in-place by successive multiples of 90 degrees:
+for ( i = 1; i <= 4; i++ ) {
+	rotr90InPlace( x, 1 );
+	console.log( ndarray2array( x ) );
+}
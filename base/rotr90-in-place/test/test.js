@@ -0,0 +1,172 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var ndarray = require( './../../../base/ctor' );
+var ndarray2array = require( './../../../to-array' );
+var toRotr90 = require( './../../../base/to-rotr90' );
+var zeros = require( './../../../base/zeros' );
+var getData = require( './../../../data-buffer' );
+var rotr90InPlace = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns an ndarray whose elements are filled with increasing values.
+*
+* @private
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {string} order - memory layout
+* @returns {ndarray} ndarray
+*/
+function linspace( shape, order ) {
+	var buf;
+	var x;
+	var i;
+
+	x = zeros( 'float64', shape, order );
+	buf = getData( x );
+	for ( i = 0; i < buf.length; i++ ) {
+		buf[ i ] = i;
+	}
+	return x;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof rotr90InPlace, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if rotating by an odd multiple of 90 degrees and the last two dimensions do not have the same size', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( 'float64', [ 2, 3 ], 'row-major' );
+	values = [
+		1,
+		3,
+		-1,
+		5
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( k ) {
+		return function badValue() {
+			rotr90InPlace( x, k );
+		};
+	}
+});
+
+tape( 'the function returns the input ndarray unchanged if provided an ndarray having fewer than two dimensions', function test( t ) {
+	var expected;
+	var out;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	out = rotr90InPlace( x, 1 );
+	expected = [ 1.0, 2.0, 3.0 ];
+
+	t.strictEqual( out, x, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function rotates a square matrix 90 degrees clockwise in-place', function test( t ) {
+	var expected;
+	var buf;
+	var out;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+	x = new ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	out = rotr90InPlace( x, 1 );
+	expected = [
+		[ 3.0, 1.0 ],
+		[ 4.0, 2.0 ]
+	];
+	t.strictEqual( out, x, 'returns expected value' );
+	t.strictEqual( getData( out ), buf, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function rotates a square matrix (or a stack of square matrices) in-place (k = -4...4)', function test( t ) {
+	var expected;
+	var shapes;
+	var orders;
+	var x;
+	var i;
+	var j;
+	var k;
+
+	shapes = [
+		[ 3, 3 ],
+		[ 2, 4, 4 ],
+		[ 70, 70 ]
+	];
+	orders = [ 'row-major', 'column-major' ];
+	for ( i = 0; i < shapes.length; i++ ) {
+		for ( j = 0; j < orders.length; j++ ) {
+			for ( k = -4; k <= 4; k++ ) {
+				x = linspace( shapes[ i ], orders[ j ] );
+				expected = ndarray2array( toRotr90( x, k ) );
+
+				rotr90InPlace( x, k );
+				t.deepEqual( ndarray2array( x ), expected, 'returns expected value (shape=['+shapes[ i ].join( ',' )+'], order='+orders[ j ]+', k='+k+')' );
+			}
+		}
+	}
+	t.end();
+});
+
+tape( 'the function rotates a non-square matrix 180 degrees in-place', function test( t ) {
+	var expected;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	rotr90InPlace( x, 2 );
+	expected = [
+		[ 6.0, 5.0, 4.0 ],
+		[ 3.0, 2.0, 1.0 ]
+	];
+	t.deepEqual( ndarray2array( x ), expected, 'returns expected value' );
+
+	rotr90InPlace( x, -2 );
+	expected = [
+		[ 1.0, 2.0, 3.0 ],
+		[ 4.0, 5.0, 6.0 ]
+	];
+	t.deepEqual( ndarray2array( x ), expected, 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,105 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isInteger = require( '@stdlib/assert/is-integer' ).isPrimitive;
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var sharedStrides2order = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s::row-major', pkg ), function benchmark( b ) {
+	var strides;
+	var out;
+	var i;
+
+	strides = [
+		[ [ 100, 10, 1 ], [ 200, 20, 2 ], [ 0, 10, 1 ] ],
+		[ [ 100, 10, 1 ], [ -100, 10, 1 ], [ 100, 0, 1 ] ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = sharedStrides2order( strides[ i%strides.length ] );
+		if ( out !== 1 ) {
+			b.fail( 'should return 1' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( out ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::column-major', pkg ), function benchmark( b ) {
+	var strides;
+	var out;
+	var i;
+
+	strides = [
+		[ [ 1, 10, 100 ], [ 2, 20, 200 ], [ 1, 10, 0 ] ],
+		[ [ 1, 10, 100 ], [ 1, 10, -100 ], [ 1, 0, 100 ] ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = sharedStrides2order( strides[ i%strides.length ] );
+		if ( out !== 2 ) {
+			b.fail( 'should return 2' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( out ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::mixed', pkg ), function benchmark( b ) {
+	var strides;
+	var out;
+	var i;
+
+	strides = [
+		[ [ 100, 10, 1 ], [ 1, 10, 100 ] ],
+		[ [ 1, 10, 100 ], [ 100, 10, 1 ] ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = sharedStrides2order( strides[ i%strides.length ] );
+		if ( out !== 0 ) {
+			b.fail( 'should return 0' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( out ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
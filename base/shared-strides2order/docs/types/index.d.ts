@@ -0,0 +1,53 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+
+/**
+* Returns the memory layout shared by a list of ndarrays, ignoring broadcasted (i.e., zero-stride) dimensions.
+*
+* ## Notes
+*
+* -   The function returns one of the following values:
+*
+*     -   `1`: every ndarray is in row-major order.
+*     -   `2`: every ndarray is in column-major order.
+*     -   `3`: every ndarray is in both row-major and column-major order.
+*     -   `0`: the ndarrays do not share a memory layout.
+*
+* @param strides - list of stride arrays
+* @returns memory layout
+*
+* @example
+* var ord = sharedStrides2order( [ [ 3, 1 ], [ 1, 0 ] ] );
+* // returns 1
+*
+* @example
+* var ord = sharedStrides2order( [ [ 3, 1 ], [ 1, 2 ] ] );
+* // returns 0
+*/
+declare function sharedStrides2order( strides: ArrayLike<ArrayLike<number>> ): number;
+
+
+// EXPORTS //
+
+export = sharedStrides2order;
@@ -0,0 +1,49 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import sharedStrides2order = require( './index' );
+
+
+// TESTS //
+
+// The function returns a number...
+{
+	sharedStrides2order( [ [ 3, 1 ], [ 1, 0 ] ] ); // $ExpectType number
+}
+
+// The compiler throws an error if the function is provided an argument which is not an array-like object containing arrays of numbers...
+{
+	sharedStrides2order( true ); // $ExpectError
+	sharedStrides2order( false ); // $ExpectError
+	sharedStrides2order( '5' ); // $ExpectError
+	sharedStrides2order( 123 ); // $ExpectError
+	sharedStrides2order( {} ); // $ExpectError
+	sharedStrides2order( ( x: number ): number => x ); // $ExpectError
+
+	sharedStrides2order( [ true, [ 1, 0 ] ] ); // $ExpectError
+	sharedStrides2order( [ false, [ 1, 0 ] ] ); // $ExpectError
+	sharedStrides2order( [ '5', [ 1, 0 ] ] ); // $ExpectError
+	sharedStrides2order( [ 123, [ 1, 0 ] ] ); // $ExpectError
+	sharedStrides2order( [ {}, [ 1, 0 ] ] ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	sharedStrides2order(); // $ExpectError
+	sharedStrides2order( [ [ 3, 1 ] ], {} ); // $ExpectError
+}
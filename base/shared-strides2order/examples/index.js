@@ -0,0 +1,39 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var sharedStrides2order = require( './../lib' );
+
+// Define the strides for a row-major 3x4 matrix:
+var sx = [ 4, 1 ];
+
+// Define the strides for a row vector broadcast to a 3x4 matrix:
+var sy = [ 0, 1 ];
+
+// Define the strides for a column vector broadcast to a 3x4 matrix:
+var sz = [ 1, 0 ];
+
+console.log( 'Order: %d.', sharedStrides2order( [ sx, sy, sz ] ) );
+// => 'Order: 1.'
+
+// Define the strides for a column-major 3x4 matrix:
+var sw = [ 1, 3 ];
+
+console.log( 'Order: %d.', sharedStrides2order( [ sx, sw ] ) );
+// => 'Order: 0.'
@@ -0,0 +1,46 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Determine the memory layout shared by a list of ndarrays, ignoring broadcasted dimensions.
+*
+* @module @stdlib/ndarray/base/shared-strides2order
+*
+* @example
+* var sharedStrides2order = require( '@stdlib/ndarray/base/shared-strides2order' );
+*
+* var ord = sharedStrides2order( [ [ 3, 1 ], [ 1, 0 ] ] );
+* // returns 1
+*
+* ord = sharedStrides2order( [ [ 1, 3 ], [ 0, 1 ] ] );
+* // returns 2
+*
+* ord = sharedStrides2order( [ [ 3, 1 ], [ 1, 2 ] ] );
+* // returns 0
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
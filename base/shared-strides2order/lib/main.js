@@ -0,0 +1,77 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var strides2order = require( './../../../base/strides2order' );
+
+
+// MAIN //
+
+/**
+* Returns the memory layout shared by a list of ndarrays, ignoring broadcasted (i.e., zero-stride) dimensions.
+*
+* ## Notes
+*
+* -   A broadcasted dimension does not move an ndarray's index pointer and is thus compatible with either memory layout. Ignoring such dimensions allows, e.g., a row-major ndarray and a broadcasted column vector (strides `[1,0]`) to be iterated using simple nested loops, rather than resorting to blocked iteration.
+* -   An ndarray whose strides are all zero does not constrain the shared memory layout.
+*
+* @param {ArrayLikeObject<IntegerArray>} strides - list of stride arrays
+* @returns {integer} memory layout (0: none; 1: row-major; 2: column-major; 3: both)
+*
+* @example
+* var ord = sharedStrides2order( [ [ 3, 1 ], [ 1, 0 ] ] );
+* // returns 1
+*
+* @example
+* var ord = sharedStrides2order( [ [ 3, 1 ], [ 0, 1 ] ] );
+* // returns 1
+*
+* @example
+* var ord = sharedStrides2order( [ [ 3, 1 ], [ 1, 2 ] ] );
+* // returns 0
+*/
+function sharedStrides2order( strides ) {
+	var out;
+	var st;
+	var s;
+	var i;
+	var j;
+
+	out = 3;
+	for ( i = 0; i < strides.length; i++ ) {
+		s = strides[ i ];
+		st = [];
+		for ( j = 0; j < s.length; j++ ) {
+			if ( s[ j ] !== 0 ) {
+				st.push( s[ j ] );
+			}
+		}
+		if ( st.length > 0 ) {
+			out &= strides2order( st );
+		}
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = sharedStrides2order;
@@ -0,0 +1,84 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var sharedStrides2order = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof sharedStrides2order, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns the memory layout shared by a list of stride arrays (row-major)', function test( t ) {
+	t.strictEqual( sharedStrides2order( [ [ 3, 1 ], [ 6, 2 ] ] ), 1, 'returns expected value' );
+	t.strictEqual( sharedStrides2order( [ [ 12, 4, 1 ], [ -12, -4, 1 ], [ 24, 8, 2 ] ] ), 1, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns the memory layout shared by a list of stride arrays (column-major)', function test( t ) {
+	t.strictEqual( sharedStrides2order( [ [ 1, 3 ], [ 2, 6 ] ] ), 2, 'returns expected value' );
+	t.strictEqual( sharedStrides2order( [ [ 1, 2, 6 ], [ -1, 2, -6 ] ] ), 2, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns `3` when every stride array is both row-major and column-major', function test( t ) {
+	t.strictEqual( sharedStrides2order( [ [ 1 ], [ -2 ] ] ), 3, 'returns expected value' );
+	t.strictEqual( sharedStrides2order( [ [ 1, 1 ], [ 2, 2 ] ] ), 3, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns `0` when the stride arrays do not share a memory layout', function test( t ) {
+	t.strictEqual( sharedStrides2order( [ [ 3, 1 ], [ 1, 2 ] ] ), 0, 'returns expected value' );
+	t.strictEqual( sharedStrides2order( [ [ 2, 6, 1 ] ] ), 0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function ignores broadcasted (zero-stride) dimensions', function test( t ) {
+	// Row-major matrix and a broadcasted column vector:
+	t.strictEqual( sharedStrides2order( [ [ 3, 1 ], [ 1, 0 ] ] ), 1, 'returns expected value' );
+
+	// Row-major matrix and a broadcasted row vector:
+	t.strictEqual( sharedStrides2order( [ [ 3, 1 ], [ 0, 1 ] ] ), 1, 'returns expected value' );
+
+	// Column-major matrix and a broadcasted row vector:
+	t.strictEqual( sharedStrides2order( [ [ 1, 3 ], [ 0, 1 ] ] ), 2, 'returns expected value' );
+
+	// Column-major matrix and a broadcasted column vector:
+	t.strictEqual( sharedStrides2order( [ [ 1, 3 ], [ 1, 0 ] ] ), 2, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function ignores stride arrays whose strides are all zero', function test( t ) {
+	t.strictEqual( sharedStrides2order( [ [ 3, 1 ], [ 0, 0 ] ] ), 1, 'returns expected value' );
+	t.strictEqual( sharedStrides2order( [ [ 1, 3 ], [ 0, 0 ] ] ), 2, 'returns expected value' );
+	t.strictEqual( sharedStrides2order( [ [ 0, 0 ], [ 0, 0 ] ] ), 3, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns `3` when provided an empty list', function test( t ) {
+	t.strictEqual( sharedStrides2order( [] ), 3, 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,115 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isInteger = require( '@stdlib/assert/is-integer' ).isPrimitive;
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var signatureTable = require( './../lib' );
+
+
+// VARIABLES //
+
+var NARRAYS = 3;
+var NTYPES = 12;
+
+
+// FUNCTIONS //
+
+/**
+* Returns a list of all signatures comprised of a specified number of data type enumeration constants.
+*
+* @private
+* @returns {Array<integer>} list of signatures
+*/
+function signatures() {
+	var out;
+	var i;
+	var j;
+	var k;
+
+	out = [];
+	for ( i = 0; i < NTYPES; i++ ) {
+		for ( j = 0; j < NTYPES; j++ ) {
+			for ( k = 0; k < NTYPES; k++ ) {
+				out.push( i, j, k );
+			}
+		}
+	}
+	return out;
+}
+
+
+// MAIN //
+
+bench( pkg, function benchmark( b ) {
+	var types;
+	var nfcns;
+	var v;
+	var i;
+
+	types = signatures();
+	nfcns = types.length / NARRAYS;
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		types[ 0 ] = i % NTYPES;
+		v = signatureTable( types, nfcns, NARRAYS );
+		if ( typeof v !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( v === null ) {
+		b.fail( 'should return an object' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:indexOf', pkg ), function benchmark( b ) {
+	var dtypes;
+	var table;
+	var types;
+	var v;
+	var i;
+
+	types = signatures();
+	table = signatureTable( types, types.length/NARRAYS, NARRAYS );
+	dtypes = [ 0, 0, 0 ];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		dtypes[ 0 ] = i % NTYPES;
+		dtypes[ 2 ] = ( i+5 ) % NTYPES;
+		v = signatureTable.indexOf( table, dtypes );
+		if ( v < 0 ) {
+			b.fail( 'should return a nonnegative integer' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( v ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
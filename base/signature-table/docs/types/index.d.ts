@@ -0,0 +1,103 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/**
+* Interface describing a signature lookup table.
+*/
+interface SignatureTable {
+	/**
+	* Minimum data type enumeration constant.
+	*/
+	min: number;
+
+	/**
+	* Radix used when packing signatures into integer keys.
+	*/
+	base: number;
+
+	/**
+	* Object mapping packed signature keys to ndarray function indices.
+	*/
+	index: Record<string, number>;
+}
+
+/**
+* Interface describing the main export.
+*/
+interface Routine {
+	/**
+	* Returns a lookup table which maps ndarray argument data type signatures to ndarray function indices.
+	*
+	* ## Notes
+	*
+	* -   If multiple ndarray functions have the same signature, the table maps the signature to the index of the first function.
+	* -   If packed keys could exceed the maximum safe double-precision floating-point integer, the function returns `null`.
+	*
+	* @param types - one-dimensional list of ndarray argument data type enumeration constants
+	* @param nfcns - number of ndarray functions
+	* @param narrays - number of ndarray arguments for each ndarray function
+	* @returns lookup table
+	*
+	* @example
+	* var table = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+	* // returns { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } }
+	*/
+	( types: ArrayLike<number | null>, nfcns: number, narrays: number ): SignatureTable | null;
+
+	/**
+	* Returns the index of the first ndarray function whose signature matches a provided list of ndarray argument data types using a precomputed lookup table.
+	*
+	* @param table - lookup table
+	* @param dtypes - list of ndarray argument data type enumeration constants
+	* @returns function index (if found) and `-1` otherwise
+	*
+	* @example
+	* var table = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+	*
+	* var idx = signatureTable.indexOf( table, [ 2, 1 ] );
+	* // returns 1
+	*
+	* idx = signatureTable.indexOf( table, [ 3, 1 ] );
+	* // returns -1
+	*/
+	indexOf( table: SignatureTable, dtypes: ArrayLike<number | null> ): number;
+}
+
+/**
+* Returns a lookup table which maps ndarray argument data type signatures to ndarray function indices.
+*
+* @param types - one-dimensional list of ndarray argument data type enumeration constants
+* @param nfcns - number of ndarray functions
+* @param narrays - number of ndarray arguments for each ndarray function
+* @returns lookup table
+*
+* @example
+* var table = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+* // returns { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } }
+*
+* var idx = signatureTable.indexOf( table, [ 2, 1 ] );
+* // returns 1
+*/
+declare var signatureTable: Routine;
+
+
+// EXPORTS //
+
+export = signatureTable;
@@ -0,0 +1,108 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import signatureTable = require( './index' );
+
+
+// TESTS //
+
+// The function returns a lookup table or null...
+{
+	signatureTable( [ 1, 1, 2, 1 ], 2, 2 ); // $ExpectType SignatureTable | null
+	signatureTable( [ null, 1, 2, 1 ], 2, 2 ); // $ExpectType SignatureTable | null
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object...
+{
+	signatureTable( '5', 2, 2 ); // $ExpectError
+	signatureTable( 5, 2, 2 ); // $ExpectError
+	signatureTable( true, 2, 2 ); // $ExpectError
+	signatureTable( false, 2, 2 ); // $ExpectError
+	signatureTable( null, 2, 2 ); // $ExpectError
+	signatureTable( {}, 2, 2 ); // $ExpectError
+	signatureTable( ( x: number ): number => x, 2, 2 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not a number...
+{
+	signatureTable( [ 1, 1 ], '5', 2 ); // $ExpectError
+	signatureTable( [ 1, 1 ], true, 2 ); // $ExpectError
+	signatureTable( [ 1, 1 ], false, 2 ); // $ExpectError
+	signatureTable( [ 1, 1 ], null, 2 ); // $ExpectError
+	signatureTable( [ 1, 1 ], [], 2 ); // $ExpectError
+	signatureTable( [ 1, 1 ], {}, 2 ); // $ExpectError
+	signatureTable( [ 1, 1 ], ( x: number ): number => x, 2 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a third argument which is not a number...
+{
+	signatureTable( [ 1, 1 ], 1, '5' ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, true ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, false ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, null ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, [] ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, {} ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	signatureTable(); // $ExpectError
+	signatureTable( [ 1, 1 ] ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1 ); // $ExpectError
+	signatureTable( [ 1, 1 ], 1, 2, 3 ); // $ExpectError
+}
+
+// Attached to the main export is an `indexOf` method which returns a number...
+{
+	const table = { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } };
+
+	signatureTable.indexOf( table, [ 2, 1 ] ); // $ExpectType number
+	signatureTable.indexOf( table, [ null, 1 ] ); // $ExpectType number
+}
+
+// The compiler throws an error if the `indexOf` method is provided a first argument which is not a lookup table...
+{
+	signatureTable.indexOf( '5', [ 2, 1 ] ); // $ExpectError
+	signatureTable.indexOf( 5, [ 2, 1 ] ); // $ExpectError
+	signatureTable.indexOf( true, [ 2, 1 ] ); // $ExpectError
+	signatureTable.indexOf( false, [ 2, 1 ] ); // $ExpectError
+	signatureTable.indexOf( null, [ 2, 1 ] ); // $ExpectError
+	signatureTable.indexOf( [], [ 2, 1 ] ); // $ExpectError
+	signatureTable.indexOf( {}, [ 2, 1 ] ); // $ExpectError
+}
+
+// The compiler throws an error if the `indexOf` method is provided a second argument which is not an array-like object...
+{
+	const table = { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } };
+
+	signatureTable.indexOf( table, 5 ); // $ExpectError
+	signatureTable.indexOf( table, true ); // $ExpectError
+	signatureTable.indexOf( table, false ); // $ExpectError
+	signatureTable.indexOf( table, null ); // $ExpectError
+	signatureTable.indexOf( table, {} ); // $ExpectError
+}
+
+// The compiler throws an error if the `indexOf` method is provided an unsupported number of arguments...
+{
+	const table = { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } };
+
+	signatureTable.indexOf(); // $ExpectError
+	signatureTable.indexOf( table ); // $ExpectError
+	signatureTable.indexOf( table, [ 2, 1 ], {} ); // $ExpectError
+}
@@ -0,0 +1,47 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var dtypes = require( './../../../dtypes' );
+var dtypes2enums = require( './../../../base/dtypes2enums' );
+var signatureTable = require( './../lib' );
+
+// Define a list of signatures for binary ndarray functions:
+var types = dtypes2enums([
+	'float64', 'float64', 'float64',
+	'float32', 'float32', 'float32',
+	'int32', 'int32', 'int32',
+	'float64', 'float32', 'float64',
+	'float32', 'float64', 'float64'
+]);
+
+// Precompute a lookup table:
+var table = signatureTable( types, 5, 3 );
+
+// Resolve the ndarray function for each combination of input and output data types:
+var dt = dtypes( 'real_floating_point' ).concat( dtypes( 'signed_integer' ) );
+var sig;
+var i;
+var j;
+for ( i = 0; i < dt.length; i++ ) {
+	for ( j = 0; j < dt.length; j++ ) {
+		sig = [ dt[ i ], dt[ j ], 'float64' ];
+		console.log( '%s => %d', sig.join( ', ' ), signatureTable.indexOf( table, dtypes2enums( sig ) ) );
+	}
+}
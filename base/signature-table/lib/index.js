@@ -0,0 +1,50 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Return a lookup table which maps ndarray argument data type signatures to ndarray function indices.
+*
+* @module @stdlib/ndarray/base/signature-table
+*
+* @example
+* var signatureTable = require( '@stdlib/ndarray/base/signature-table' );
+*
+* var table = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+* // returns { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } }
+*
+* var idx = signatureTable.indexOf( table, [ 2, 1 ] );
+* // returns 1
+*/
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var indexOf = require( './index_of.js' );
+var main = require( './main.js' );
+
+
+// MAIN //
+
+setReadOnly( main, 'indexOf', indexOf );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -0,0 +1,75 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+
+
+// MAIN //
+
+/**
+* Returns the index of the first ndarray function whose signature matches a provided list of ndarray argument data types using a precomputed lookup table.
+*
+* @param {Object} table - lookup table
+* @param {IntegerArray} dtypes - list of ndarray argument data type enumeration constants
+* @returns {integer} function index (if found) and `-1` otherwise
+*
+* @example
+* var signatureTable = require( './main.js' );
+*
+* var table = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+*
+* var idx = indexOf( table, [ 2, 1 ] );
+* // returns 1
+*
+* idx = indexOf( table, [ 3, 1 ] );
+* // returns -1
+*/
+function indexOf( table, dtypes ) {
+	var base;
+	var key;
+	var min;
+	var d;
+	var i;
+
+	min = table.min;
+	base = table.base;
+	key = 0;
+	for ( i = 0; i < dtypes.length; i++ ) {
+		d = ( ( dtypes[ i ] === null ) ? -1 : dtypes[ i ] ) - min;
+
+		// If a data type is outside the range of data types found in the lookup table, no ndarray function can satisfy the provided signature...
+		if ( d < 0 || d >= base ) {
+			return -1;
+		}
+		key = ( key*base ) + d;
+	}
+	if ( hasOwnProp( table.index, key ) ) {
+		return table.index[ key ];
+	}
+	return -1;
+}
+
+
+// EXPORTS //
+
+module.exports = indexOf;
@@ -0,0 +1,102 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var MAX_SAFE_INTEGER = require( '@stdlib/constants/float64/max-safe-integer' );
+
+
+// MAIN //
+
+/**
+* Returns a lookup table which maps ndarray argument data type signatures to ndarray function indices.
+*
+* ## Notes
+*
+* -   Each signature is packed into a single integer key by treating the signature's data type enumeration constants as the digits of a number whose radix equals the range of enumeration constants found in the list of types. Accordingly, resolving an ndarray function requires a constant number of operations with respect to the number of ndarray functions.
+* -   If multiple ndarray functions have the same signature, the table maps the signature to the index of the first function, thus matching the result of a linear search.
+* -   If packed keys could exceed the maximum safe double-precision floating-point integer, the function returns `null`, and callers should fall back to a linear search.
+*
+* @param {IntegerArray} types - one-dimensional list of ndarray argument data type enumeration constants
+* @param {NonNegativeInteger} nfcns - number of ndarray functions
+* @param {PositiveInteger} narrays - number of ndarray arguments for each ndarray function
+* @returns {(Object|null)} lookup table
+*
+* @example
+* var table = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+* // returns { 'min': 1, 'base': 2, 'index': { '0': 0, '2': 1 } }
+*/
+function signatureTable( types, nfcns, narrays ) {
+	var index;
+	var base;
+	var key;
+	var min;
+	var max;
+	var v;
+	var n;
+	var i;
+	var j;
+
+	// Resolve the range of data type enumeration constants (note: unresolved data types are represented as `null`, which we map to `-1`)...
+	min = 0;
+	max = 0;
+	for ( i = 0; i < types.length; i++ ) {
+		v = ( types[ i ] === null ) ? -1 : types[ i ];
+		if ( i === 0 || v < min ) {
+			min = v;
+		}
+		if ( i === 0 || v > max ) {
+			max = v;
+		}
+	}
+	base = max - min + 1;
+
+	// Ensure that packed keys can be exactly represented...
+	n = 1;
+	for ( i = 0; i < narrays; i++ ) {
+		if ( n > MAX_SAFE_INTEGER/base ) {
+			return null;
+		}
+		n *= base;
+	}
+	index = {};
+	for ( i = 0; i < nfcns; i++ ) {
+		key = 0;
+		for ( j = 0; j < narrays; j++ ) {
+			v = types[ (i*narrays)+j ];
+			key = ( key*base ) + ( ( v === null ) ? -1 : v ) - min;
+		}
+		if ( !hasOwnProp( index, key ) ) {
+			index[ key ] = i;
+		}
+	}
+	return {
+		'min': min,
+		'base': base,
+		'index': index
+	};
+}
+
+
+// EXPORTS //
+
+module.exports = signatureTable;
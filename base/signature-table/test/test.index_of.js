@@ -0,0 +1,82 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var signatureTable = require( './../lib/main.js' );
+var indexOf = require( './../lib/index_of.js' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof indexOf, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns the index of the function corresponding to a provided signature', function test( t ) {
+	var table;
+	var types;
+
+	types = [
+		12, 12,
+		11, 11,
+		12, 11,
+		7, 12
+	];
+	table = signatureTable( types, 4, 2 );
+
+	t.strictEqual( indexOf( table, [ 12, 12 ] ), 0, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 11, 11 ] ), 1, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 12, 11 ] ), 2, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 7, 12 ] ), 3, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns the index of the first matching function', function test( t ) {
+	var table = signatureTable( [ 1, 1, 2, 2, 1, 1 ], 3, 2 );
+	t.strictEqual( indexOf( table, [ 1, 1 ] ), 0, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 2, 2 ] ), 1, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns `-1` if unable to find a matching signature', function test( t ) {
+	var table = signatureTable( [ 5, 5, 6, 6 ], 2, 2 );
+
+	t.strictEqual( indexOf( table, [ 5, 6 ] ), -1, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 4, 5 ] ), -1, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 5, 7 ] ), -1, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ null, 5 ] ), -1, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports unresolved data types', function test( t ) {
+	var table = signatureTable( [ null, 1, 1, 1 ], 2, 2 );
+
+	t.strictEqual( indexOf( table, [ null, 1 ] ), 0, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 1, 1 ] ), 1, 'returns expected value' );
+	t.strictEqual( indexOf( table, [ 1, null ] ), -1, 'returns expected value' );
+
+	t.end();
+});
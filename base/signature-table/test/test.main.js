@@ -0,0 +1,118 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var MAX_SAFE_INTEGER = require( '@stdlib/constants/float64/max-safe-integer' );
+var signatureTable = require( './../lib/main.js' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof signatureTable, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns a lookup table', function test( t ) {
+	var expected;
+	var actual;
+
+	actual = signatureTable( [ 1, 1, 2, 1 ], 2, 2 );
+	expected = {
+		'min': 1,
+		'base': 2,
+		'index': {
+			'0': 0,
+			'2': 1
+		}
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+
+	actual = signatureTable( [ 12, 11, 12, 12, 12, 7 ], 2, 3 );
+	expected = {
+		'min': 7,
+		'base': 6,
+		'index': {
+			'209': 0,
+			'210': 1
+		}
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function maps duplicate signatures to the first function', function test( t ) {
+	var actual;
+
+	actual = signatureTable( [ 1, 1, 2, 2, 1, 1 ], 3, 2 );
+	t.strictEqual( actual.index[ 0 ], 0, 'returns expected value' );
+	t.strictEqual( actual.index[ 3 ], 1, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports unresolved data types', function test( t ) {
+	var expected;
+	var actual;
+
+	actual = signatureTable( [ null, 1, 1, 1 ], 2, 2 );
+	expected = {
+		'min': -1,
+		'base': 3,
+		'index': {
+			'2': 0,
+			'8': 1
+		}
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports an empty list of signatures', function test( t ) {
+	var expected;
+	var actual;
+
+	actual = signatureTable( [], 0, 2 );
+	expected = {
+		'min': 0,
+		'base': 1,
+		'index': {}
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns `null` if packed signature keys cannot be exactly represented', function test( t ) {
+	var actual;
+
+	actual = signatureTable( [ 0, MAX_SAFE_INTEGER ], 1, 2 );
+	t.strictEqual( actual, null, 'returns expected value' );
+
+	actual = signatureTable( [ 0, 1000, 0, 1000, 0, 1000 ], 1, 6 );
+	t.strictEqual( actual, null, 'returns expected value' );
+
+	t.end();
+});
@@ -31,7 +31,7 @@ var getShape = require( './../../../base/shape' );
 var getStrides = require( './../../../base/strides' );
 var getOffset = require( './../../../base/offset' );
 var getOrder = require( './../../../base/order' );
-var getData = require( './../../../base/data-buffer' );
+var view = require( './../../../base/view' );
 var format = require( '@stdlib/string/format' );
 var sliceStart = require( './slice_start.js' );
 var slice2strides = require( './slice_strides.js' );
@@ -91,7 +91,6 @@ function slice( x, s, strict, writable ) {
 	var order;
 	var sdims;
 	var ndims;
-	var ctor;
 	var sh;
 	var ns;
 
@@ -107,14 +106,9 @@ function slice( x, s, strict, writable ) {
 	if ( s.ndims !== ndims ) {
 		throw new RangeError( format( 'invalid argument. Number of slice dimensions does not match the number of array dimensions. Array shape: (%s). Slice dimensions: %u.', shape.join( ',' ), s.ndims ) );
 	}
-	// Resolve the output array constructor:
-	ctor = x.constructor;
-
 	// If provided a zero-dimensional input array, return a zero-dimensional array view...
 	if ( ndims === 0 ) {
-		return new ctor( dtype, getData( x ), shape, strides, offset, order, {
-			'readonly': !writable
-		});
+		return view( x, shape, strides, offset, writable );
 	}
 	// Resolve the indices of the non-reduced dimensions:
 	sdims = nonreducedDimensions( s );
@@ -143,7 +137,7 @@ function slice( x, s, strict, writable ) {
 	}
 	// If the slice does not contain any elements, return an empty array...
 	if ( numel( sh ) === 0 ) {
-		return empty( ctor, dtype, take( sh, sdims ), order, !writable );
+		return empty( x.constructor, dtype, take( sh, sdims ), order, !writable );
 	}
 	// Resolve the index offset of the first element indexed by the slice:
 	offset = sliceStart( ns, strides, offset ); // TODO: @stdlib/ndarray/base/sind2bind
@@ -153,17 +147,13 @@ function slice( x, s, strict, writable ) {
 
 	// If all dimensions were reduced, return a zero-dimensional array...
 	if ( sh.length === 0 ) {
-		return new ctor( dtype, getData( x ), [], [ 0 ], offset, order, {
-			'readonly': !writable
-		});
+		return view( x, [], [ 0 ], offset, writable );
 	}
 	// Update strides according to slice steps:
 	strides = slice2strides( ns, strides, sdims ); // TODO: @stdlib/ndarray/base/slice2strides???
 
 	// Return a slice view:
-	return new ctor( dtype, getData( x ), sh, strides, offset, order, {
-		'readonly': !writable
-	});
+	return view( x, sh, strides, offset, writable );
 }
 
 
@@ -0,0 +1,118 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/sort_lanes.h"
+#include "stdlib/ndarray/dtypes.h"
+#include "stdlib/ndarray/index_modes.h"
+#include "stdlib/ndarray/orders.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+int main( void ) {
+	// Define the ndarray data types:
+	enum STDLIB_NDARRAY_DTYPE xdtype = STDLIB_NDARRAY_FLOAT64;
+	enum STDLIB_NDARRAY_DTYPE idtype = STDLIB_NDARRAY_INT32;
+
+	// Create underlying data buffers:
+	double xbuf[] = { 3.0, 1.0, 2.0, 4.0, 6.0, 5.0, 9.0, 8.0, 7.0 };
+	double ybuf[] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	int32_t ibuf[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	// Define the options: sort along the last dimension (index: 1) in descending order (flag: 1)...
+	int32_t obuf[] = { 1, 1 };
+
+	// Define the number of dimensions:
+	int64_t ndims = 2;
+
+	// Define the array shapes:
+	int64_t shape[] = { 3, 3 };
+	int64_t oshape[] = { 2 };
+
+	// Define the strides:
+	int64_t sx[] = { 24, 8 };
+	int64_t si[] = { 12, 4 };
+	int64_t so[] = { 4 };
+
+	// Define the index offset:
+	int64_t offset = 0;
+
+	// Define the array order:
+	enum STDLIB_NDARRAY_ORDER order = STDLIB_NDARRAY_ROW_MAJOR;
+
+	// Specify the index mode:
+	enum STDLIB_NDARRAY_INDEX_MODE imode = STDLIB_NDARRAY_INDEX_ERROR;
+
+	// Specify the subscript index modes:
+	int8_t submodes[] = { imode };
+	int64_t nsubmodes = 1;
+
+	// Create an input ndarray:
+	struct ndarray *x = stdlib_ndarray_allocate( xdtype, (uint8_t *)xbuf, ndims, shape, sx, offset, order, imode, nsubmodes, submodes );
+	if ( x == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Create output ndarrays:
+	struct ndarray *y = stdlib_ndarray_allocate( xdtype, (uint8_t *)ybuf, ndims, shape, sx, offset, order, imode, nsubmodes, submodes );
+	if ( y == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+	struct ndarray *idx = stdlib_ndarray_allocate( idtype, (uint8_t *)ibuf, ndims, shape, si, offset, order, imode, nsubmodes, submodes );
+	if ( idx == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Create an options ndarray:
+	struct ndarray *opts = stdlib_ndarray_allocate( idtype, (uint8_t *)obuf, 1, oshape, so, offset, order, imode, nsubmodes, submodes );
+	if ( opts == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Sort each row:
+	struct ndarray *arrays1[] = { x, y, opts };
+	int8_t status = stdlib_ndarray_sort_lanes( arrays1, NULL );
+	if ( status != 0 ) {
+		fprintf( stderr, "Error during computation.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Compute the indices which sort each row:
+	struct ndarray *arrays2[] = { x, idx, opts };
+	status = stdlib_ndarray_argsort_lanes( arrays2, NULL );
+	if ( status != 0 ) {
+		fprintf( stderr, "Error during computation.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Print the results:
+	for ( int i = 0; i < 9; i++ ) {
+		printf( "y[ %i ] = %lf, idx[ %i ] = %d\n", i, ybuf[ i ], i, ibuf[ i ] );
+	}
+
+	// Free allocated memory:
+	stdlib_ndarray_free( x );
+	stdlib_ndarray_free( y );
+	stdlib_ndarray_free( idx );
+	stdlib_ndarray_free( opts );
+}
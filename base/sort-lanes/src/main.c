@@ -0,0 +1,649 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/sort_lanes.h"
+#include "stdlib/ndarray/ctor.h"
+#include "stdlib/ndarray/dtypes.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Number of elements below which insertion sort outperforms radix sort:
+#define STDLIB_NDARRAY_SORT_LANES_INSERTION_SORT_THRESHOLD 32
+
+// Minimum total number of elements for which lanes are sorted in parallel:
+#define STDLIB_NDARRAY_SORT_LANES_PARALLEL_THRESHOLD 65536
+
+// Number of radix buckets (i.e., 8-bit digits):
+#define STDLIB_NDARRAY_SORT_LANES_RADIX 256
+
+// Number of radix passes (i.e., number of 8-bit digits in a 64-bit key):
+#define STDLIB_NDARRAY_SORT_LANES_PASSES 8
+
+// Sign bit mask for 64-bit sort keys:
+#define STDLIB_NDARRAY_SORT_LANES_SIGN_MASK 0x8000000000000000ULL
+
+/**
+* Structure containing workspace buffers for sorting a single lane.
+*/
+struct workspace {
+	// Sort keys:
+	uint64_t *keys;
+
+	// Temporary sort keys:
+	uint64_t *ktmp;
+
+	// Element indices (only allocated when computing sort indices):
+	int64_t *idx;
+
+	// Temporary element indices (only allocated when computing sort indices):
+	int64_t *itmp;
+
+	// Digit counts for each radix pass:
+	int64_t counts[ STDLIB_NDARRAY_SORT_LANES_PASSES*STDLIB_NDARRAY_SORT_LANES_RADIX ];
+};
+
+/**
+* Frees a workspace.
+*
+* @param ws  workspace
+*/
+static void workspace_free( struct workspace *ws ) {
+	if ( ws == NULL ) {
+		return;
+	}
+	free( ws->keys );
+	free( ws->ktmp );
+	free( ws->idx );
+	free( ws->itmp );
+	free( ws );
+}
+
+/**
+* Allocates a workspace for sorting lanes having a specified number of elements.
+*
+* @param N        number of elements per lane
+* @param indices  boolean indicating whether to allocate buffers for element indices
+* @return         workspace or a null pointer if unable to allocate memory
+*/
+static struct workspace * workspace_allocate( const int64_t N, const int8_t indices ) {
+	struct workspace *ws = calloc( 1, sizeof( struct workspace ) );
+	if ( ws == NULL ) {
+		return NULL;
+	}
+	ws->keys = malloc( (size_t)N * sizeof( uint64_t ) );
+	ws->ktmp = malloc( (size_t)N * sizeof( uint64_t ) );
+	if ( indices ) {
+		ws->idx = malloc( (size_t)N * sizeof( int64_t ) );
+		ws->itmp = malloc( (size_t)N * sizeof( int64_t ) );
+	}
+	if ( ws->keys == NULL || ws->ktmp == NULL || ( indices && ( ws->idx == NULL || ws->itmp == NULL ) ) ) {
+		workspace_free( ws );
+		return NULL;
+	}
+	return ws;
+}
+
+/**
+* Converts a double-precision floating-point number to an unsigned 64-bit integer sort key whose unsigned ordering matches the numeric ordering of floating-point numbers.
+*
+* ## Notes
+*
+* -   For non-negative values, we set the sign bit. For negative values, we flip every bit, thus reversing the ordering of negative values and placing them before non-negative values.
+* -   `NaN` values are mapped to the largest possible key.
+*
+* @param x  input value
+* @return   sort key
+*/
+static uint64_t float64_to_key( const double x ) {
+	uint64_t w;
+	if ( x != x ) {
+		return UINT64_MAX;
+	}
+	memcpy( &w, &x, sizeof( w ) );
+	if ( w & STDLIB_NDARRAY_SORT_LANES_SIGN_MASK ) {
+		return ~w;
+	}
+	return w | STDLIB_NDARRAY_SORT_LANES_SIGN_MASK;
+}
+
+/**
+* Converts an unsigned 64-bit integer sort key to a double-precision floating-point number.
+*
+* @param key  sort key
+* @return     double-precision floating-point number
+*/
+static double key_to_float64( const uint64_t key ) {
+	uint64_t w;
+	double x;
+	if ( key & STDLIB_NDARRAY_SORT_LANES_SIGN_MASK ) {
+		w = key ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK; // note: the largest key (i.e., `NaN`) maps to a quiet `NaN`
+	} else {
+		w = ~key;
+	}
+	memcpy( &x, &w, sizeof( x ) );
+	return x;
+}
+
+/**
+* Macro for converting the elements of a one-dimensional strided lane to sort keys.
+*
+* @param T     element type
+* @param expr  expression which converts an element `v` to a sort key
+*/
+#define STDLIB_NDARRAY_SORT_LANES_TO_KEYS( T, expr )                           \
+	for ( i = 0; i < N; i++ ) {                                                \
+		const T v = *(const T *)px;                                            \
+		keys[ i ] = ( expr ) ^ mask;                                           \
+		px += sx;                                                              \
+	}
+
+/**
+* Macro for converting sort keys to elements of a one-dimensional strided lane.
+*
+* @param T     element type
+* @param expr  expression which converts a sort key `k` to an element
+*/
+#define STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( T, expr )                         \
+	for ( i = 0; i < N; i++ ) {                                                \
+		const uint64_t k = keys[ i ] ^ mask;                                   \
+		*(T *)py = (T)( expr );                                                \
+		py += sy;                                                              \
+	}
+
+/**
+* Tests whether an input ndarray data type is supported.
+*
+* @param dtype  data type
+* @return       boolean indicating whether a data type is supported
+*/
+static int8_t is_supported( const int16_t dtype ) {
+	switch ( dtype ) {
+	case STDLIB_NDARRAY_FLOAT64:
+	case STDLIB_NDARRAY_FLOAT32:
+	case STDLIB_NDARRAY_INT64:
+	case STDLIB_NDARRAY_INT32:
+	case STDLIB_NDARRAY_INT16:
+	case STDLIB_NDARRAY_INT8:
+	case STDLIB_NDARRAY_UINT64:
+	case STDLIB_NDARRAY_UINT32:
+	case STDLIB_NDARRAY_UINT16:
+	case STDLIB_NDARRAY_UINT8:
+	case STDLIB_NDARRAY_UINT8C:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/**
+* Converts the elements of a one-dimensional strided lane to unsigned 64-bit integer sort keys whose unsigned ordering matches the ordering of the corresponding elements.
+*
+* ## Notes
+*
+* -   Signed integers are offset by flipping the sign bit. Unsigned integers are used as is. Floating-point numbers are converted according to `float64_to_key`.
+* -   When sorting in descending order, every key is inverted (i.e., `mask` has every bit set).
+*
+* @param dtype  element data type
+* @param N      number of elements
+* @param px     pointer to the first element
+* @param sx     stride (in bytes)
+* @param mask   mask with which to XOR each key
+* @param keys   output sort keys
+*/
+static void to_keys( const int16_t dtype, const int64_t N, const uint8_t *px, const int64_t sx, const uint64_t mask, uint64_t *keys ) {
+	int64_t i;
+	switch ( dtype ) {
+	case STDLIB_NDARRAY_FLOAT64:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( double, float64_to_key( v ) )
+		break;
+	case STDLIB_NDARRAY_FLOAT32:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( float, float64_to_key( (double)v ) )
+		break;
+	case STDLIB_NDARRAY_INT64:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( int64_t, (uint64_t)v ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK )
+		break;
+	case STDLIB_NDARRAY_INT32:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( int32_t, (uint64_t)(int64_t)v ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK )
+		break;
+	case STDLIB_NDARRAY_INT16:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( int16_t, (uint64_t)(int64_t)v ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK )
+		break;
+	case STDLIB_NDARRAY_INT8:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( int8_t, (uint64_t)(int64_t)v ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK )
+		break;
+	case STDLIB_NDARRAY_UINT64:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( uint64_t, v )
+		break;
+	case STDLIB_NDARRAY_UINT32:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( uint32_t, (uint64_t)v )
+		break;
+	case STDLIB_NDARRAY_UINT16:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( uint16_t, (uint64_t)v )
+		break;
+	case STDLIB_NDARRAY_UINT8:
+	case STDLIB_NDARRAY_UINT8C:
+		STDLIB_NDARRAY_SORT_LANES_TO_KEYS( uint8_t, (uint64_t)v )
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+* Converts unsigned 64-bit integer sort keys to the elements of a one-dimensional strided lane.
+*
+* @param dtype  element data type
+* @param N      number of elements
+* @param keys   sort keys
+* @param mask   mask with which to XOR each key
+* @param py     pointer to the first element
+* @param sy     stride (in bytes)
+*/
+static void from_keys( const int16_t dtype, const int64_t N, const uint64_t *keys, const uint64_t mask, uint8_t *py, const int64_t sy ) {
+	int64_t i;
+	switch ( dtype ) {
+	case STDLIB_NDARRAY_FLOAT64:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( double, key_to_float64( k ) )
+		break;
+	case STDLIB_NDARRAY_FLOAT32:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( float, key_to_float64( k ) )
+		break;
+	case STDLIB_NDARRAY_INT64:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( int64_t, k ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK )
+		break;
+	case STDLIB_NDARRAY_INT32:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( int32_t, (int64_t)( k ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK ) )
+		break;
+	case STDLIB_NDARRAY_INT16:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( int16_t, (int64_t)( k ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK ) )
+		break;
+	case STDLIB_NDARRAY_INT8:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( int8_t, (int64_t)( k ^ STDLIB_NDARRAY_SORT_LANES_SIGN_MASK ) )
+		break;
+	case STDLIB_NDARRAY_UINT64:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( uint64_t, k )
+		break;
+	case STDLIB_NDARRAY_UINT32:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( uint32_t, k )
+		break;
+	case STDLIB_NDARRAY_UINT16:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( uint16_t, k )
+		break;
+	case STDLIB_NDARRAY_UINT8:
+	case STDLIB_NDARRAY_UINT8C:
+		STDLIB_NDARRAY_SORT_LANES_FROM_KEYS( uint8_t, k )
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+* Stably sorts sort keys, and, if present, corresponding element indices, using insertion sort.
+*
+* @param N    number of elements
+* @param ws   workspace
+*/
+static void insertion_sort( const int64_t N, struct workspace *ws ) {
+	uint64_t *keys = ws->keys;
+	int64_t *idx = ws->idx;
+	uint64_t k;
+	int64_t v;
+	int64_t i;
+	int64_t j;
+
+	for ( i = 1; i < N; i++ ) {
+		k = keys[ i ];
+		v = ( idx ) ? idx[ i ] : 0;
+		j = i - 1;
+		while ( j >= 0 && keys[ j ] > k ) {
+			keys[ j+1 ] = keys[ j ];
+			if ( idx ) {
+				idx[ j+1 ] = idx[ j ];
+			}
+			j -= 1;
+		}
+		keys[ j+1 ] = k;
+		if ( idx ) {
+			idx[ j+1 ] = v;
+		}
+	}
+}
+
+/**
+* Stably sorts sort keys, and, if present, corresponding element indices, using a least significant digit radix sort.
+*
+* ## Notes
+*
+* -   The function computes the digit counts for every pass in a single sweep over the keys and then performs one scatter pass per 8-bit digit, starting from the least significant digit.
+* -   A pass is skipped whenever every key has the same digit (e.g., the high bytes of small integer values), as the pass would not change the ordering.
+* -   After each scatter pass, the function swaps the workspace key (and index) buffers, such that, upon return, `ws->keys` (and `ws->idx`) contain the sorted keys (and indices).
+*
+* @param N    number of elements
+* @param ws   workspace
+*/
+static void radix_sort( const int64_t N, struct workspace *ws ) {
+	int64_t *counts;
+	uint64_t *kt;
+	int64_t *it;
+	int64_t sum;
+	int64_t c;
+	int64_t i;
+	int64_t p;
+	int64_t b;
+	int64_t j;
+	int shift;
+
+	memset( ws->counts, 0, sizeof( ws->counts ) );
+	for ( i = 0; i < N; i++ ) {
+		for ( p = 0; p < STDLIB_NDARRAY_SORT_LANES_PASSES; p++ ) {
+			ws->counts[ ( p*STDLIB_NDARRAY_SORT_LANES_RADIX ) + (int64_t)( ( ws->keys[ i ] >> ( 8*p ) ) & 0xff ) ] += 1;
+		}
+	}
+	for ( p = 0; p < STDLIB_NDARRAY_SORT_LANES_PASSES; p++ ) {
+		shift = (int)( 8*p );
+		counts = ws->counts + ( p*STDLIB_NDARRAY_SORT_LANES_RADIX );
+
+		// Skip the pass if all keys share the same digit:
+		if ( counts[ ( ws->keys[ 0 ] >> shift ) & 0xff ] == N ) {
+			continue;
+		}
+		// Convert the counts to starting positions:
+		sum = 0;
+		for ( b = 0; b < STDLIB_NDARRAY_SORT_LANES_RADIX; b++ ) {
+			c = counts[ b ];
+			counts[ b ] = sum;
+			sum += c;
+		}
+		// Scatter the keys (and indices) according to the current digit:
+		for ( i = 0; i < N; i++ ) {
+			b = (int64_t)( ( ws->keys[ i ] >> shift ) & 0xff );
+			j = counts[ b ];
+			counts[ b ] += 1;
+			ws->ktmp[ j ] = ws->keys[ i ];
+			if ( ws->idx ) {
+				ws->itmp[ j ] = ws->idx[ i ];
+			}
+		}
+		kt = ws->keys;
+		ws->keys = ws->ktmp;
+		ws->ktmp = kt;
+
+		it = ws->idx;
+		ws->idx = ws->itmp;
+		ws->itmp = it;
+	}
+}
+
+/**
+* Resolves the byte offsets of the first elements of a specified lane in the input and output ndarrays.
+*
+* @param ndims  number of dimensions
+* @param shape  array shape
+* @param sx     input ndarray strides (in bytes)
+* @param sy     output ndarray strides (in bytes)
+* @param dim    dimension along which lanes are sorted
+* @param lane   lane index
+* @param ox     input ndarray byte offset (updated in place)
+* @param oy     output ndarray byte offset (updated in place)
+*/
+static void lane_offsets( const int64_t ndims, const int64_t *shape, const int64_t *sx, const int64_t *sy, const int64_t dim, int64_t lane, int64_t *ox, int64_t *oy ) {
+	int64_t s;
+	int64_t k;
+	for ( k = ndims-1; k >= 0; k-- ) {
+		if ( k == dim ) {
+			continue;
+		}
+		s = lane % shape[ k ];
+		lane /= shape[ k ];
+		*ox += s * sx[ k ];
+		*oy += s * sy[ k ];
+	}
+}
+
+/**
+* Sorts, or computes the sort indices of, each one-dimensional lane along a specified dimension of an input ndarray.
+*
+* ## Notes
+*
+* -   When compiled with OpenMP support, lanes are sorted in parallel whenever the input ndarray contains more than one lane and a sufficient number of elements, with each thread allocating its own workspace. Otherwise, lanes are sorted sequentially using a single workspace.
+*
+* @param arrays   array whose first element is a pointer to an input ndarray, whose second element is a pointer to an output ndarray, and whose last element is a pointer to a one-dimensional options ndarray containing the dimension index and a flag indicating whether to sort in descending order
+* @param indices  boolean indicating whether to compute sort indices
+* @return         status code
+*/
+static int8_t sort_lanes( struct ndarray *arrays[], const int8_t indices ) {
+	const struct ndarray *x = arrays[ 0 ];
+	struct ndarray *y = arrays[ 1 ];
+	const struct ndarray *o = arrays[ 2 ];
+	int64_t *shape;
+	int64_t *sx;
+	int64_t *sy;
+	int64_t nlanes;
+	int64_t ndims;
+	int16_t dtype;
+	int16_t ydt;
+	int32_t dim;
+	int32_t desc;
+	uint64_t mask;
+	int8_t status;
+	int64_t N;
+	int64_t i;
+
+	ndims = stdlib_ndarray_ndims( x );
+	if ( ndims < 1 || stdlib_ndarray_ndims( y ) != ndims || stdlib_ndarray_length( o ) < 2 ) {
+		return -1;
+	}
+	shape = stdlib_ndarray_shape( x );
+	for ( i = 0; i < ndims; i++ ) {
+		if ( stdlib_ndarray_shape( y )[ i ] != shape[ i ] ) {
+			return -1;
+		}
+	}
+	if ( stdlib_ndarray_iget_int32( o, 0, &dim ) != 0 || stdlib_ndarray_iget_int32( o, 1, &desc ) != 0 ) {
+		return -1;
+	}
+	if ( dim < 0 || dim >= ndims ) {
+		return -1;
+	}
+	dtype = stdlib_ndarray_dtype( x );
+	ydt = stdlib_ndarray_dtype( y );
+	if ( indices ) {
+		if ( ydt != STDLIB_NDARRAY_INT32 && ydt != STDLIB_NDARRAY_INT64 ) {
+			return -1;
+		}
+	} else if ( ydt != dtype ) {
+		return -1;
+	}
+	N = shape[ dim ];
+	if ( N == 0 ) {
+		return 0;
+	}
+	nlanes = stdlib_ndarray_length( x ) / N;
+	if ( nlanes == 0 ) {
+		return 0;
+	}
+	sx = stdlib_ndarray_strides( x );
+	sy = stdlib_ndarray_strides( y );
+	mask = ( desc ) ? UINT64_MAX : 0;
+
+	if ( !is_supported( dtype ) ) {
+		return -1;
+	}
+	status = 0;
+#if defined( _OPENMP )
+	#pragma omp parallel if ( nlanes > 1 && nlanes*N >= STDLIB_NDARRAY_SORT_LANES_PARALLEL_THRESHOLD ) reduction( min:status )
+#endif
+	{
+		struct workspace *ws = workspace_allocate( N, indices );
+		uint8_t *px;
+		uint8_t *py;
+		int64_t ox;
+		int64_t oy;
+		int64_t j;
+		int64_t k;
+
+		if ( ws == NULL ) {
+			status = -1;
+		}
+#if defined( _OPENMP )
+		#pragma omp for schedule( static )
+#endif
+		for ( j = 0; j < nlanes; j++ ) {
+			if ( ws == NULL ) {
+				continue;
+			}
+			ox = stdlib_ndarray_offset( x );
+			oy = stdlib_ndarray_offset( y );
+			lane_offsets( ndims, shape, sx, sy, dim, j, &ox, &oy );
+			px = stdlib_ndarray_data( x ) + ox;
+			py = stdlib_ndarray_data( y ) + oy;
+
+			to_keys( dtype, N, px, sx[ dim ], mask, ws->keys );
+			if ( indices ) {
+				for ( k = 0; k < N; k++ ) {
+					ws->idx[ k ] = k;
+				}
+			}
+			if ( N < STDLIB_NDARRAY_SORT_LANES_INSERTION_SORT_THRESHOLD ) {
+				insertion_sort( N, ws );
+			} else {
+				radix_sort( N, ws );
+			}
+			if ( !indices ) {
+				from_keys( dtype, N, ws->keys, mask, py, sy[ dim ] );
+			} else if ( ydt == STDLIB_NDARRAY_INT32 ) {
+				for ( k = 0; k < N; k++ ) {
+					*(int32_t *)py = (int32_t)ws->idx[ k ];
+					py += sy[ dim ];
+				}
+			} else {
+				for ( k = 0; k < N; k++ ) {
+					*(int64_t *)py = ws->idx[ k ];
+					py += sy[ dim ];
+				}
+			}
+		}
+		workspace_free( ws );
+	}
+	return status;
+}
+
+/**
+* Sorts each one-dimensional lane along a specified dimension of an input ndarray and assigns the sorted elements to an output ndarray.
+*
+* ## Notes
+*
+* -   The function supports real-valued integer and floating-point input ndarrays. The output ndarray must have the same shape and data type as the input ndarray.
+* -   Each lane is sorted using a least significant digit radix sort over order-preserving 64-bit integer keys (or insertion sort for short lanes), thus avoiding element comparisons. `NaN` values are sorted after all other values in ascending order and before all other values in descending order.
+* -   The last ndarray argument must be a one-dimensional 32-bit signed integer ndarray whose first element is the (nonnegative) index of the dimension along which to sort and whose second element is a flag indicating whether to sort in descending order.
+* -   If successful, the function returns `0`; otherwise, the function returns an error code.
+*
+* @param arrays   array whose first element is a pointer to an input ndarray, whose second element is a pointer to an output ndarray, and whose last element is a pointer to an options ndarray
+* @param data     function data (unused)
+* @return         status code
+*
+* @example
+* #include "stdlib/ndarray/base/sort_lanes.h"
+* #include "stdlib/ndarray/dtypes.h"
+* #include "stdlib/ndarray/index_modes.h"
+* #include "stdlib/ndarray/orders.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include <stdint.h>
+*
+* double xbuf[] = { 3.0, 1.0, 2.0, 6.0, 4.0, 5.0 };
+* double ybuf[] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+* int32_t obuf[] = { 1, 0 };
+*
+* int64_t shape[] = { 2, 3 };
+* int64_t strides[] = { 24, 8 };
+* int64_t oshape[] = { 2 };
+* int64_t ostrides[] = { 4 };
+*
+* int8_t submodes[] = { STDLIB_NDARRAY_INDEX_ERROR };
+*
+* struct ndarray *x = stdlib_ndarray_allocate( STDLIB_NDARRAY_FLOAT64, (uint8_t *)xbuf, 2, shape, strides, 0, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+* struct ndarray *y = stdlib_ndarray_allocate( STDLIB_NDARRAY_FLOAT64, (uint8_t *)ybuf, 2, shape, strides, 0, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+* struct ndarray *o = stdlib_ndarray_allocate( STDLIB_NDARRAY_INT32, (uint8_t *)obuf, 1, oshape, ostrides, 0, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+*
+* struct ndarray *arrays[] = { x, y, o };
+*
+* int8_t status = stdlib_ndarray_sort_lanes( arrays, NULL );
+* // ybuf => { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 }
+*
+* stdlib_ndarray_free( x );
+* stdlib_ndarray_free( y );
+* stdlib_ndarray_free( o );
+*/
+int8_t stdlib_ndarray_sort_lanes( struct ndarray *arrays[], void *data ) {
+	(void)data;
+	return sort_lanes( arrays, 0 );
+}
+
+/**
+* Computes the indices which sort each one-dimensional lane along a specified dimension of an input ndarray and assigns the indices to an output ndarray.
+*
+* ## Notes
+*
+* -   The function supports real-valued integer and floating-point input ndarrays. The output ndarray must have the same shape as the input ndarray and must have either a 32-bit or a 64-bit signed integer data type.
+* -   Sort indices are computed using a stable least significant digit radix sort over order-preserving 64-bit integer keys (or insertion sort for short lanes). Accordingly, equal elements retain their relative order, in both ascending and descending order.
+* -   The last ndarray argument must be a one-dimensional 32-bit signed integer ndarray whose first element is the (nonnegative) index of the dimension along which to sort and whose second element is a flag indicating whether to sort in descending order.
+* -   If successful, the function returns `0`; otherwise, the function returns an error code.
+*
+* @param arrays   array whose first element is a pointer to an input ndarray, whose second element is a pointer to an output ndarray, and whose last element is a pointer to an options ndarray
+* @param data     function data (unused)
+* @return         status code
+*
+* @example
+* #include "stdlib/ndarray/base/sort_lanes.h"
+* #include "stdlib/ndarray/dtypes.h"
+* #include "stdlib/ndarray/index_modes.h"
+* #include "stdlib/ndarray/orders.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include <stdint.h>
+*
+* double xbuf[] = { 3.0, 1.0, 2.0, 6.0, 4.0, 5.0 };
+* int32_t ybuf[] = { 0, 0, 0, 0, 0, 0 };
+* int32_t obuf[] = { 1, 0 };
+*
+* int64_t shape[] = { 2, 3 };
+* int64_t sx[] = { 24, 8 };
+* int64_t sy[] = { 12, 4 };
+* int64_t oshape[] = { 2 };
+* int64_t ostrides[] = { 4 };
+*
+* int8_t submodes[] = { STDLIB_NDARRAY_INDEX_ERROR };
+*
+* struct ndarray *x = stdlib_ndarray_allocate( STDLIB_NDARRAY_FLOAT64, (uint8_t *)xbuf, 2, shape, sx, 0, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+* struct ndarray *y = stdlib_ndarray_allocate( STDLIB_NDARRAY_INT32, (uint8_t *)ybuf, 2, shape, sy, 0, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+* struct ndarray *o = stdlib_ndarray_allocate( STDLIB_NDARRAY_INT32, (uint8_t *)obuf, 1, oshape, ostrides, 0, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+*
+* struct ndarray *arrays[] = { x, y, o };
+*
+* int8_t status = stdlib_ndarray_argsort_lanes( arrays, NULL );
+* // ybuf => { 1, 2, 0, 1, 2, 0 }
+*
+* stdlib_ndarray_free( x );
+* stdlib_ndarray_free( y );
+* stdlib_ndarray_free( o );
+*/
+int8_t stdlib_ndarray_argsort_lanes( struct ndarray *arrays[], void *data ) {
+	(void)data;
+	return sort_lanes( arrays, 1 );
+}
@@ -0,0 +1,85 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var structFactory = require( '@stdlib/dstructs/struct' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var format = require( '@stdlib/string/format' );
+var columnarBuffer = require( './../../../base/columnar-buffer' );
+var ndarray = require( './../../../base/ctor' );
+var pkg = require( './../package.json' ).name;
+var structField = require( './../lib' );
+
+
+// VARIABLES //
+
+var FIELDS = [
+	{
+		'name': 'x',
+		'type': 'float64'
+	},
+	{
+		'name': 'y',
+		'type': 'float64'
+	},
+	{
+		'name': 'id',
+		'type': 'int32'
+	}
+];
+
+
+// MAIN //
+
+bench( format( '%s::base_ndarray,2d', pkg ), function benchmark( b ) {
+	var Struct;
+	var values;
+	var buffer;
+	var out;
+	var i;
+
+	Struct = structFactory( FIELDS );
+	buffer = columnarBuffer( FIELDS, 4 );
+
+	values = [
+		ndarray( Struct, buffer, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ),
+		ndarray( Struct, buffer, [ 2, 2 ], [ 1, 2 ], 0, 'column-major' ),
+		ndarray( Struct, buffer, [ 4, 1 ], [ 1, 1 ], 0, 'row-major' ),
+		ndarray( Struct, buffer, [ 1, 4 ], [ 4, 1 ], 0, 'row-major' ),
+		ndarray( Struct, buffer, [ 2, 2 ], [ -2, -1 ], 3, 'row-major' )
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = structField( values[ i%values.length ], FIELDS[ i%FIELDS.length ].name );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( out ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
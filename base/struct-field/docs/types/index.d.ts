@@ -0,0 +1,70 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+
+/**
+* Returns a view of a single field of a struct ndarray backed by a struct-of-arrays (columnar) data buffer.
+*
+* ## Notes
+*
+* -   The input ndarray must have a data buffer created by `@stdlib/ndarray/base/columnar-buffer`.
+* -   The returned ndarray is a view on the field array of the input ndarray data buffer. As field arrays are contiguous, the returned ndarray has the same shape, strides, index offset, and order as the input ndarray and has a numeric (or boolean) data type. Accordingly, the returned ndarray can be consumed by any kernel supporting the field data type without touching the memory of other fields.
+* -   The returned ndarray is a "base" ndarray, and, thus, the returned ndarray does not perform bounds checking or afford any of the guarantees of the non-base ndarray constructor. The primary intent of this function is to access a field of an ndarray-like object within internal implementations and to do so with minimal overhead.
+*
+* @param x - input ndarray
+* @param name - field name
+* @returns field view
+*
+* @example
+* var structFactory = require( '@stdlib/dstructs/struct' );
+* var columnarBuffer = require( '@stdlib/ndarray/base/columnar-buffer' );
+* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+*
+* var fields = [
+*     {
+*         'name': 'x',
+*         'type': 'float64'
+*     },
+*     {
+*         'name': 'y',
+*         'type': 'int32'
+*     }
+* ];
+* var Point = structFactory( fields );
+*
+* var buf = columnarBuffer( fields, 4 );
+* var x = ndarray( Point, buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var v = x.get( 1, 0 );
+* v.x = 3.0;
+*
+* var out = structField( x, 'x' );
+* // returns <ndarray>[ [ 0.0, 0.0 ], [ 3.0, 0.0 ] ]
+*/
+declare function structField( x: ndarray, name: string ): ndarray;
+
+
+// EXPORTS //
+
+export = structField;
@@ -0,0 +1,65 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+import zeros = require( './../../../../base/zeros' );
+import structField = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	structField( x, 'x' ); // $ExpectType ndarray
+}
+
+// The compiler throws an error if the function is not provided a first argument which is an ndarray...
+{
+	structField( '5', 'x' ); // $ExpectError
+	structField( 5, 'x' ); // $ExpectError
+	structField( true, 'x' ); // $ExpectError
+	structField( false, 'x' ); // $ExpectError
+	structField( null, 'x' ); // $ExpectError
+	structField( {}, 'x' ); // $ExpectError
+	structField( [ '5' ], 'x' ); // $ExpectError
+	structField( ( x: number ): number => x, 'x' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is not provided a second argument which is a string...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	structField( x, 5 ); // $ExpectError
+	structField( x, true ); // $ExpectError
+	structField( x, false ); // $ExpectError
+	structField( x, null ); // $ExpectError
+	structField( x, {} ); // $ExpectError
+	structField( x, [] ); // $ExpectError
+	structField( x, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	structField(); // $ExpectError
+	structField( x ); // $ExpectError
+	structField( x, 'x', {} ); // $ExpectError
+}
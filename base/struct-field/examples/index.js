@@ -0,0 +1,63 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var structFactory = require( '@stdlib/dstructs/struct' );
+var uniform = require( '@stdlib/random/base/uniform' );
+var columnarBuffer = require( './../../../base/columnar-buffer' );
+var ndarray = require( './../../../base/ctor' );
+var ndarray2array = require( './../../../to-array' );
+var structField = require( './../lib' );
+
+// Define the fields of a record:
+var fields = [
+	{
+		'name': 'lat',
+		'type': 'float64'
+	},
+	{
+		'name': 'lon',
+		'type': 'float64'
+	}
+];
+var Location = structFactory( fields );
+
+// Create a struct ndarray backed by a columnar data buffer:
+var buf = columnarBuffer( fields, 6 );
+var x = ndarray( Location, buf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+// Assign records:
+var i;
+var j;
+for ( i = 0; i < 2; i++ ) {
+	for ( j = 0; j < 3; j++ ) {
+		x.set( i, j, new Location({
+			'lat': uniform( -90.0, 90.0 ),
+			'lon': uniform( -180.0, 180.0 )
+		}));
+	}
+}
+
+// Retrieve field views which can be consumed by numeric kernels:
+var lat = structField( x, 'lat' );
+console.log( ndarray2array( lat ) );
+
+var lon = structField( x, 'lon' );
+console.log( ndarray2array( lon ) );
@@ -0,0 +1,62 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+/**
+* Return a view of a single field of a struct ndarray backed by a struct-of-arrays (columnar) data buffer.
+*
+* @module @stdlib/ndarray/base/struct-field
+*
+* @example
+* var structFactory = require( '@stdlib/dstructs/struct' );
+* var columnarBuffer = require( '@stdlib/ndarray/base/columnar-buffer' );
+* var ndarray = require( '@stdlib/ndarray/base/ctor' );
+* var structField = require( '@stdlib/ndarray/base/struct-field' );
+*
+* var fields = [
+*     {
+*         'name': 'x',
+*         'type': 'float64'
+*     },
+*     {
+*         'name': 'y',
+*         'type': 'int32'
+*     }
+* ];
+* var Point = structFactory( fields );
+*
+* var buf = columnarBuffer( fields, 4 );
+* var x = ndarray( Point, buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var v = x.get( 1, 0 );
+* v.x = 3.0;
+*
+* var out = structField( x, 'x' );
+* // returns <ndarray>[ [ 0.0, 0.0 ], [ 3.0, 0.0 ] ]
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
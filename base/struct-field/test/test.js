@@ -0,0 +1,186 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var structFactory = require( '@stdlib/dstructs/struct' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var columnarBuffer = require( './../../../base/columnar-buffer' );
+var ndarray = require( './../../../base/ctor' );
+var ndarray2array = require( './../../../to-array' );
+var getStrides = require( './../../../strides' );
+var getOffset = require( './../../../offset' );
+var getOrder = require( './../../../order' );
+var getShape = require( './../../../shape' );
+var getDType = require( './../../../dtype' );
+var getData = require( './../../../data-buffer' );
+var structField = require( './../lib' );
+
+
+// VARIABLES //
+
+var FIELDS = [
+	{
+		'name': 'x',
+		'type': 'float64'
+	},
+	{
+		'name': 'y',
+		'type': 'int32'
+	}
+];
+var Point = structFactory( FIELDS );
+
+
+// FUNCTIONS //
+
+/**
+* Returns a columnar data buffer containing sequential field values.
+*
+* @private
+* @param {NonNegativeInteger} N - number of elements
+* @returns {Object} data buffer
+*/
+function sequence( N ) {
+	var buf;
+	var i;
+
+	buf = columnarBuffer( FIELDS, N );
+	for ( i = 0; i < N; i++ ) {
+		buf.set({
+			'x': i + 0.5,
+			'y': -i
+		}, i );
+	}
+	return buf;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof structField, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns a "base" ndarray instance', function test( t ) {
+	var x;
+	var y;
+
+	x = ndarray( Point, sequence( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = structField( x, 'x' );
+
+	t.notEqual( y, x, 'returns new instance' );
+	t.strictEqual( y instanceof ndarray, true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a field view (row-major)', function test( t ) {
+	var buf;
+	var x;
+	var y;
+
+	buf = sequence( 4 );
+	x = ndarray( Point, buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	y = structField( x, 'x' );
+	t.strictEqual( getData( y ), buf.columnOf( 'x' ), 'returns expected value' );
+	t.strictEqual( getData( y ) instanceof Float64Array, true, 'returns expected value' );
+	t.strictEqual( String( getDType( y ) ), 'float64', 'returns expected value' );
+	t.strictEqual( getOrder( y ), 'row-major', 'returns expected value' );
+	t.deepEqual( getShape( y ), [ 2, 2 ], 'returns expected value' );
+	t.deepEqual( getStrides( y ), [ 2, 1 ], 'returns expected value' );
+	t.strictEqual( getOffset( y ), 0, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 0.5, 1.5 ], [ 2.5, 3.5 ] ], 'returns expected value' );
+
+	y = structField( x, 'y' );
+	t.strictEqual( getData( y ) instanceof Int32Array, true, 'returns expected value' );
+	t.strictEqual( String( getDType( y ) ), 'int32', 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 0, -1 ], [ -2, -3 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a field view (column-major)', function test( t ) {
+	var x;
+	var y;
+
+	x = ndarray( Point, sequence( 4 ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+	y = structField( x, 'x' );
+
+	t.strictEqual( getOrder( y ), 'column-major', 'returns expected value' );
+	t.deepEqual( getShape( y ), [ 2, 2 ], 'returns expected value' );
+	t.deepEqual( getStrides( y ), [ 1, 2 ], 'returns expected value' );
+	t.strictEqual( getOffset( y ), 0, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 0.5, 2.5 ], [ 1.5, 3.5 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function preserves the input ndarray offset and strides', function test( t ) {
+	var x;
+	var y;
+
+	x = ndarray( Point, sequence( 6 ), [ 2, 2 ], [ -3, -1 ], 5, 'row-major' );
+	y = structField( x, 'y' );
+
+	t.deepEqual( getStrides( y ), [ -3, -1 ], 'returns expected value' );
+	t.strictEqual( getOffset( y ), 5, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ -5, -4 ], [ -2, -1 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional input ndarrays', function test( t ) {
+	var x;
+	var y;
+
+	x = ndarray( Point, sequence( 3 ), [], [ 0 ], 2, 'row-major' );
+	y = structField( x, 'x' );
+
+	t.deepEqual( getShape( y ), [], 'returns expected value' );
+	t.strictEqual( getOffset( y ), 2, 'returns expected value' );
+	t.strictEqual( y.get(), 2.5, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a view which shares memory with the input ndarray', function test( t ) {
+	var v;
+	var x;
+	var y;
+
+	x = ndarray( Point, sequence( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = structField( x, 'x' );
+
+	y.set( 1, 0, 10.0 );
+	v = x.get( 1, 0 );
+	t.strictEqual( v.x, 10.0, 'returns expected value' );
+
+	v.x = 20.0;
+	t.strictEqual( y.get( 1, 0 ), 20.0, 'returns expected value' );
+
+	t.end();
+});
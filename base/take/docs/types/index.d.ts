@@ -0,0 +1,81 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+import { ndarray, Mode } from '@stdlib/types/ndarray';
+
+/**
+* Gathers elements from an input ndarray according to the linear view indices contained in an index ndarray and assigns results to an output ndarray.
+*
+* @param arrays - array-like object containing an input ndarray, an index ndarray, and an output ndarray
+* @param mode - specifies how to handle an index outside the interval `[0, N-1]`, where `N` is the number of input ndarray elements (default: the input ndarray index mode, if defined, or `'throw'`)
+* @throws index ndarray and output ndarray must have the same number of elements
+* @throws input ndarray must have at least one element when provided a non-empty index ndarray
+* @throws index exceeds input ndarray bounds
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var Int32Array = require( '@stdlib/array/int32' );
+*
+* // Create data buffers:
+* var xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+* var ibuf = new Int32Array( [ 4, 0, 2, -1 ] );
+* var ybuf = new Float64Array( 4 );
+*
+* // Create the input, index, and output ndarray-like objects:
+* var x = {
+*     'dtype': 'float64',
+*     'data': xbuf,
+*     'shape': [ 2, 3 ],
+*     'strides': [ 3, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var idx = {
+*     'dtype': 'int32',
+*     'data': ibuf,
+*     'shape': [ 2, 2 ],
+*     'strides': [ 2, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var y = {
+*     'dtype': 'float64',
+*     'data': ybuf,
+*     'shape': [ 2, 2 ],
+*     'strides': [ 2, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+*
+* // Gather elements:
+* take( [ x, idx, y ], 'normalize' );
+*
+* console.log( y.data );
+* // => <Float64Array>[ 5.0, 1.0, 3.0, 6.0 ]
+*/
+declare function take( arrays: ArrayLike<ndarray>, mode?: Mode ): void;
+
+
+// EXPORTS //
+
+export = take;
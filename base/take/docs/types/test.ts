@@ -0,0 +1,96 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+import take = require( './index' );
+
+/**
+* Mock function to create an ndarray-like object.
+*
+* @returns ndarray-like object
+*/
+function array(): ndarray {
+	const obj: ndarray = {
+		'byteLength': 80,
+		'BYTES_PER_ELEMENT': 8,
+		'data': new Float64Array( 10 ),
+		'dtype': 'float64',
+		'flags': {
+			'ROW_MAJOR_CONTIGUOUS': true,
+			'COLUMN_MAJOR_CONTIGUOUS': false
+		},
+		'length': 10,
+		'ndims': 1,
+		'offset': 0,
+		'order': 'row-major',
+		'shape': [ 10 ],
+		'strides': [ 1 ],
+		'get': (): number => 0,
+		'set': (): ndarray => obj
+	};
+	return obj;
+}
+
+
+// TESTS //
+
+// The function returns `undefined`...
+{
+	const arrays = [ array(), array(), array() ];
+
+	take( arrays ); // $ExpectType void
+	take( arrays, 'throw' ); // $ExpectType void
+	take( arrays, 'normalize' ); // $ExpectType void
+	take( arrays, 'clamp' ); // $ExpectType void
+	take( arrays, 'wrap' ); // $ExpectType void
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object containing ndarray-like objects...
+{
+	take( 5, 'throw' ); // $ExpectError
+	take( true, 'throw' ); // $ExpectError
+	take( false, 'throw' ); // $ExpectError
+	take( null, 'throw' ); // $ExpectError
+	take( undefined, 'throw' ); // $ExpectError
+	take( {}, 'throw' ); // $ExpectError
+	take( [ 1 ], 'throw' ); // $ExpectError
+	take( ( x: number ): number => x, 'throw' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not a supported index mode...
+{
+	const arrays = [ array(), array(), array() ];
+
+	take( arrays, '10' ); // $ExpectError
+	take( arrays, 5 ); // $ExpectError
+	take( arrays, true ); // $ExpectError
+	take( arrays, false ); // $ExpectError
+	take( arrays, null ); // $ExpectError
+	take( arrays, [] ); // $ExpectError
+	take( arrays, {} ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const arrays = [ array(), array(), array() ];
+
+	take(); // $ExpectError
+	take( arrays, 'throw', 10 ); // $ExpectError
+}
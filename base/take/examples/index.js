@@ -0,0 +1,64 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var discreteUniform = require( '@stdlib/random/array/discrete-uniform' );
+var filledarrayBy = require( '@stdlib/array/filled-by' );
+var zeros = require( '@stdlib/array/zeros' );
+var uniform = require( '@stdlib/random/base/uniform' ).factory;
+var ndarray2array = require( './../../../base/to-array' );
+var take = require( './../lib' );
+
+// Create an embedding table having 10 rows and 4 columns:
+var x = {
+	'dtype': 'float64',
+	'data': filledarrayBy( 40, 'float64', uniform( -1.0, 1.0 ) ),
+	'shape': [ 10, 4 ],
+	'strides': [ 4, 1 ],
+	'offset': 0,
+	'order': 'row-major'
+};
+
+// Create an ndarray containing random linear indices (including negative indices):
+var idx = {
+	'dtype': 'int32',
+	'data': discreteUniform( 8, -40, 39, {
+		'dtype': 'int32'
+	}),
+	'shape': [ 2, 4 ],
+	'strides': [ 4, 1 ],
+	'offset': 0,
+	'order': 'row-major'
+};
+
+// Create an output ndarray:
+var y = {
+	'dtype': 'float64',
+	'data': zeros( 8, 'float64' ),
+	'shape': [ 2, 4 ],
+	'strides': [ 1, 2 ],
+	'offset': 0,
+	'order': 'column-major'
+};
+
+// Gather elements:
+take( [ x, idx, y ], 'normalize' );
+
+console.log( ndarray2array( idx.data, idx.shape, idx.strides, idx.offset, idx.order ) );
+console.log( ndarray2array( y.data, y.shape, y.strides, y.offset, y.order ) );
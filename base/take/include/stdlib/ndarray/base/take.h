@@ -0,0 +1,56 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* Header file containing function declarations for ndarray functions which gather ndarray elements according to an index ndarray.
+*/
+#ifndef STDLIB_NDARRAY_BASE_TAKE_H
+#define STDLIB_NDARRAY_BASE_TAKE_H
+
+#include "take/macros.h"
+
+#include "take/ai_a.h"
+#include "take/al_a.h"
+#include "take/bi_b.h"
+#include "take/bl_b.h"
+#include "take/ci_c.h"
+#include "take/cl_c.h"
+#include "take/di_d.h"
+#include "take/dl_d.h"
+#include "take/fi_f.h"
+#include "take/fl_f.h"
+#include "take/ii_i.h"
+#include "take/il_i.h"
+#include "take/ki_k.h"
+#include "take/kl_k.h"
+#include "take/li_l.h"
+#include "take/ll_l.h"
+#include "take/si_s.h"
+#include "take/sl_s.h"
+#include "take/ti_t.h"
+#include "take/tl_t.h"
+#include "take/ui_u.h"
+#include "take/ul_u.h"
+#include "take/vi_v.h"
+#include "take/vl_v.h"
+#include "take/xi_x.h"
+#include "take/xl_x.h"
+#include "take/zi_z.h"
+#include "take/zl_z.h"
+
+#endif // !STDLIB_NDARRAY_BASE_TAKE_H
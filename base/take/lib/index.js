@@ -0,0 +1,90 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Gather elements from an input ndarray according to the linear view indices contained in an index ndarray and assign results to an output ndarray.
+*
+* @module @stdlib/ndarray/base/take
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var Int32Array = require( '@stdlib/array/int32' );
+* var take = require( '@stdlib/ndarray/base/take' );
+*
+* // Create data buffers:
+* var xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+* var ibuf = new Int32Array( [ 4, 0, 2, -1 ] );
+* var ybuf = new Float64Array( 4 );
+*
+* // Create the input, index, and output ndarray-like objects:
+* var x = {
+*     'dtype': 'float64',
+*     'data': xbuf,
+*     'shape': [ 2, 3 ],
+*     'strides': [ 3, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var idx = {
+*     'dtype': 'int32',
+*     'data': ibuf,
+*     'shape': [ 2, 2 ],
+*     'strides': [ 2, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var y = {
+*     'dtype': 'float64',
+*     'data': ybuf,
+*     'shape': [ 2, 2 ],
+*     'strides': [ 2, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+*
+* // Gather elements:
+* take( [ x, idx, y ], 'normalize' );
+*
+* console.log( y.data );
+* // => <Float64Array>[ 5.0, 1.0, 3.0, 6.0 ]
+*/
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var tryRequire = require( '@stdlib/utils/try-require' );
+var isError = require( '@stdlib/assert/is-error' );
+var main = require( './main.js' );
+
+
+// MAIN //
+
+var take;
+var tmp = tryRequire( join( __dirname, './native.js' ) );
+if ( isError( tmp ) ) {
+	take = main;
+} else {
+	take = tmp;
+}
+
+
+// EXPORTS //
+
+module.exports = take;
@@ -0,0 +1,206 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2025 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var dispatch = require( './../../../base/binary-addon-dispatch' );
+var resolveStr = require( './../../../base/dtype-resolve-str' );
+var getDType = require( './../../../base/dtype' );
+var getShape = require( './../../../base/shape' );
+var getStrides = require( './../../../base/strides' );
+var getOffset = require( './../../../base/offset' );
+var getOrder = require( './../../../base/order' );
+var getData = require( './../../../base/data-buffer' );
+var numel = require( './../../../base/numel' );
+var format = require( '@stdlib/string/format' );
+var addon = require( './../src/addon.node' );
+var js = require( './main.js' );
+
+
+// VARIABLES //
+
+// Input and output ndarray data types supported by the C kernels:
+var DTYPES = {
+	'bool': true,
+	'int8': true,
+	'uint8': true,
+	'uint8c': true,
+	'int16': true,
+	'uint16': true,
+	'int32': true,
+	'uint32': true,
+	'int64': true,
+	'uint64': true,
+	'float32': true,
+	'float64': true,
+	'complex64': true,
+	'complex128': true
+};
+
+// Index ndarray data types supported by the C kernels:
+var INDEX_DTYPES = {
+	'int32': true,
+	'int64': true
+};
+
+// Dispatch function which invokes the C kernels for ndarrays having typed array data buffers:
+var f = dispatch( addon, fallback );
+
+
+// FUNCTIONS //
+
+/**
+* Gathers elements using the JavaScript implementation.
+*
+* @private
+* @param {Object} x - input ndarray
+* @param {Object} idx - index ndarray
+* @param {Object} y - output ndarray
+* @returns {void}
+*/
+function fallback( x, idx, y ) {
+	js( [ x, idx, y ], x.mode );
+}
+
+/**
+* Tests whether the C kernels support a provided set of ndarrays.
+*
+* ## Notes
+*
+* -   Zero-dimensional ndarrays are delegated to the JavaScript implementation, which treats a zero-dimensional ndarray as containing a single element.
+*
+* @private
+* @param {Object} x - input ndarray
+* @param {Object} idx - index ndarray
+* @param {Object} y - output ndarray
+* @returns {boolean} boolean indicating whether the ndarrays are supported
+*/
+function isSupported( x, idx, y ) {
+	var dt = resolveStr( getDType( x ) );
+	if ( !DTYPES[ dt ] || resolveStr( getDType( y ) ) !== dt || !INDEX_DTYPES[ resolveStr( getDType( idx ) ) ] ) { // eslint-disable-line max-len
+		return false;
+	}
+	return ( getShape( x, false ).length > 0 && getShape( idx, false ).length > 0 && getShape( y, false ).length > 0 ); // eslint-disable-line max-len
+}
+
+/**
+* Returns an ndarray-like object whose index mode is the specified mode.
+*
+* ## Notes
+*
+* -   The C kernels resolve indices according to the index mode of the input ndarray. Accordingly, the returned object shares the input ndarray's data buffer and meta data, but carries the provided mode for meta data serialization.
+*
+* @private
+* @param {Object} x - input ndarray
+* @param {string} mode - index mode
+* @returns {Object} ndarray-like object
+*/
+function withMode( x, mode ) {
+	return {
+		'dtype': getDType( x ),
+		'data': getData( x ),
+		'shape': getShape( x, false ),
+		'strides': getStrides( x, false ),
+		'offset': getOffset( x ),
+		'order': getOrder( x ),
+		'mode': mode,
+		'submode': [ mode ]
+	};
+}
+
+
+// MAIN //
+
+/**
+* Gathers elements from an input ndarray according to the linear view indices contained in an index ndarray and assigns results to an output ndarray.
+*
+* ## Notes
+*
+* -   If the ndarray data types are supported by the C kernels and the ndarray data buffers are typed arrays, the function dispatches to a native add-on; otherwise, the function falls back to the JavaScript implementation.
+*
+* @private
+* @param {ArrayLikeObject<Object>} arrays - array-like object containing an input ndarray, an index ndarray, and an output ndarray
+* @param {string} [mode] - specifies how to handle an index outside the interval `[0, N-1]`, where `N` is the number of input ndarray elements (default: the input ndarray index mode, if defined, or `'throw'`)
+* @throws {Error} index and output ndarrays must have the same number of elements
+* @throws {RangeError} input ndarray must have at least one element when provided a non-empty index ndarray
+* @throws {RangeError} index exceeds input ndarray bounds
+* @returns {void}
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+* var Int32Array = require( '@stdlib/array/int32' );
+*
+* var x = {
+*     'dtype': 'float64',
+*     'data': new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ),
+*     'shape': [ 2, 3 ],
+*     'strides': [ 3, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var idx = {
+*     'dtype': 'int32',
+*     'data': new Int32Array( [ 4, 0, 2, -1 ] ),
+*     'shape': [ 4 ],
+*     'strides': [ 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+* var y = {
+*     'dtype': 'float64',
+*     'data': new Float64Array( 4 ),
+*     'shape': [ 2, 2 ],
+*     'strides': [ 2, 1 ],
+*     'offset': 0,
+*     'order': 'row-major'
+* };
+*
+* take( [ x, idx, y ], 'normalize' );
+*
+* console.log( y.data );
+* // => <Float64Array>[ 5.0, 1.0, 3.0, 6.0 ]
+*/
+function take( arrays, mode ) {
+	var idx;
+	var N;
+	var x;
+	var y;
+
+	x = arrays[ 0 ];
+	idx = arrays[ 1 ];
+	y = arrays[ 2 ];
+	if ( arguments.length < 2 ) {
+		mode = x.mode || 'throw';
+	}
+	if ( !isSupported( x, idx, y ) ) {
+		return js( arrays, mode );
+	}
+	// The native add-on signals any failure as a `RangeError`, so validate element counts up-front in order to preserve JavaScript error semantics...
+	N = numel( getShape( idx, false ) );
+	if ( numel( getShape( y, false ) ) !== N ) {
+		throw new Error( format( 'invalid arguments. Index and output arrays must have the same number of elements. numel(indices) == %d. numel(y) == %d.', N, numel( getShape( y, false ) ) ) );
+	}
+	f( withMode( x, mode ), idx, y );
+}
+
+
+// EXPORTS //
+
+module.exports = take;
@@ -0,0 +1,161 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/napi/binary.h"
+#include "stdlib/ndarray/base/function_object.h"
+#include "stdlib/ndarray/base/take.h"
+#include "stdlib/ndarray/dtypes.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Define an interface name:
+static const char name[] = "stdlib_ndarray_take";
+
+// Define a list of ndarray functions:
+static ndarrayFcn functions[] = {
+	stdlib_ndarray_take_ai_a,
+	stdlib_ndarray_take_al_a,
+	stdlib_ndarray_take_bi_b,
+	stdlib_ndarray_take_bl_b,
+	stdlib_ndarray_take_ci_c,
+	stdlib_ndarray_take_cl_c,
+	stdlib_ndarray_take_di_d,
+	stdlib_ndarray_take_dl_d,
+	stdlib_ndarray_take_fi_f,
+	stdlib_ndarray_take_fl_f,
+	stdlib_ndarray_take_ii_i,
+	stdlib_ndarray_take_il_i,
+	stdlib_ndarray_take_ki_k,
+	stdlib_ndarray_take_kl_k,
+	stdlib_ndarray_take_li_l,
+	stdlib_ndarray_take_ll_l,
+	stdlib_ndarray_take_si_s,
+	stdlib_ndarray_take_sl_s,
+	stdlib_ndarray_take_ti_t,
+	stdlib_ndarray_take_tl_t,
+	stdlib_ndarray_take_ui_u,
+	stdlib_ndarray_take_ul_u,
+	stdlib_ndarray_take_vi_v,
+	stdlib_ndarray_take_vl_v,
+	stdlib_ndarray_take_xi_x,
+	stdlib_ndarray_take_xl_x,
+	stdlib_ndarray_take_zi_z,
+	stdlib_ndarray_take_zl_z
+};
+
+// Define the **ndarray** argument types for each ndarray function:
+static int32_t types[] = {
+	STDLIB_NDARRAY_UINT8C, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_UINT8C,
+	STDLIB_NDARRAY_UINT8C, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_UINT8C,
+	STDLIB_NDARRAY_UINT8, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_UINT8,
+	STDLIB_NDARRAY_UINT8, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_UINT8,
+	STDLIB_NDARRAY_COMPLEX64, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_COMPLEX64,
+	STDLIB_NDARRAY_COMPLEX64, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_COMPLEX64,
+	STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_FLOAT64,
+	STDLIB_NDARRAY_FLOAT64, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_FLOAT64,
+	STDLIB_NDARRAY_FLOAT32, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_FLOAT32,
+	STDLIB_NDARRAY_FLOAT32, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_FLOAT32,
+	STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_INT32,
+	STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_INT32,
+	STDLIB_NDARRAY_INT16, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_INT16,
+	STDLIB_NDARRAY_INT16, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_INT16,
+	STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_INT64,
+	STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_INT64,
+	STDLIB_NDARRAY_INT8, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_INT8,
+	STDLIB_NDARRAY_INT8, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_INT8,
+	STDLIB_NDARRAY_UINT16, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_UINT16,
+	STDLIB_NDARRAY_UINT16, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_UINT16,
+	STDLIB_NDARRAY_UINT32, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_UINT32,
+	STDLIB_NDARRAY_UINT32, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_UINT32,
+	STDLIB_NDARRAY_UINT64, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_UINT64,
+	STDLIB_NDARRAY_UINT64, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_UINT64,
+	STDLIB_NDARRAY_BOOL, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_BOOL,
+	STDLIB_NDARRAY_BOOL, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_BOOL,
+	STDLIB_NDARRAY_COMPLEX128, STDLIB_NDARRAY_INT32, STDLIB_NDARRAY_COMPLEX128,
+	STDLIB_NDARRAY_COMPLEX128, STDLIB_NDARRAY_INT64, STDLIB_NDARRAY_COMPLEX128
+};
+
+// Define a list of ndarray function "data" (in this case, take kernels do not require any additional data):
+static void *data[] = {
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+// Define a zero-initialized workspace for a type signature hash table (note: the table is built on first dispatch):
+static int32_t table[ STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 28 ) ];
+
+// Create an ndarray function object:
+static const struct ndarrayFunctionObject obj = {
+	// ndarray function name:
+	name,
+
+	// Number of input ndarrays:
+	2,
+
+	// Number of output ndarrays:
+	1,
+
+	// Total number of ndarray arguments (nin + nout):
+	3,
+
+	// Array containing ndarray functions:
+	functions,
+
+	// Number of ndarray functions:
+	28,
+
+	// Array of type "numbers" (as enumerated elsewhere), where the total number of types equals `narrays * nfunctions` and where each set of `narrays` consecutive types (non-overlapping) corresponds to the set of ndarray argument types for a corresponding ndarray function:
+	types,
+
+	// Array of void pointers corresponding to the "data" (e.g., callbacks) which should be passed to a respective ndarray function (note: the number of pointers should match the number of ndarray functions):
+	data,
+
+	// Hash table workspace:
+	table,
+
+	// Number of elements in the hash table workspace:
+	STDLIB_NDARRAY_FUNCTION_TABLE_LENGTH( 28 )
+};
+
+STDLIB_NDARRAY_NAPI_MODULE_BINARY( obj )
@@ -0,0 +1,306 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var isSameComplex128Array = require( '@stdlib/assert/is-same-complex128array' );
+var ndarray = require( './../../../base/ctor' );
+var take = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof take, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided index and output ndarrays which do not have the same number of elements', function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ], 'throw' );
+	}
+});
+
+tape( 'the function throws an error if provided an empty input ndarray and a non-empty index ndarray', function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ], 'clamp' );
+	}
+});
+
+tape( 'the function throws an error if provided an out-of-bounds index when the index mode is `throw`', function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 0, 4 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ], 'throw' );
+	}
+});
+
+tape( 'the function throws an error if provided an out-of-bounds index when the index mode is `normalize`', function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ -1, -5 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ], 'normalize' );
+	}
+});
+
+tape( 'the function gathers elements from an input ndarray (row-major, contiguous)', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 5, 0, 3, 3 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'throw' );
+
+	expected = new Float64Array( [ 6.0, 1.0, 4.0, 4.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function gathers elements from an input ndarray (column-major, contiguous)', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	// Linear view order: [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ]
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 1, 4, 2, 0 ] ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+	y = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+
+	take( [ x, idx, y ], 'throw' );
+
+	expected = new Float64Array( [ 2.0, 5.0, 3.0, 1.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function gathers elements from an input ndarray (negative strides)', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	// Linear view order: [ 6.0, 5.0, 4.0, 3.0, 2.0, 1.0 ]
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ -3, -1 ], 5, 'row-major' );
+
+	// Linear view order: [ 2, 0, 5 ]
+	idx = ndarray( 'int32', new Int32Array( [ 5, 0, 2 ] ), [ 3 ], [ -1 ], 2, 'row-major' );
+
+	// Linear view order: ybuf[ 4 ], ybuf[ 2 ], ybuf[ 0 ]
+	y = ndarray( 'float64', new Float64Array( 5 ), [ 3 ], [ -2 ], 4, 'row-major' );
+
+	take( [ x, idx, y ], 'throw' );
+
+	expected = new Float64Array( [ 1.0, 0.0, 6.0, 0.0, 4.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function gathers elements from an input ndarray (non-contiguous)', function test( t ) {
+	var expected;
+	var xbuf;
+	var idx;
+	var x;
+	var y;
+
+	// Linear view order: [ 1.0, 3.0, 7.0, 9.0 ]
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 ] );
+	x = ndarray( 'float64', xbuf, [ 2, 2 ], [ 6, 2 ], 0, 'row-major' );
+
+	// Linear view order: [ 3, 1, 2, 0 ]
+	idx = ndarray( 'int32', new Int32Array( [ 3, 1, 9, 9, 2, 0 ] ), [ 2, 2 ], [ 1, 4 ], 0, 'column-major' );
+	y = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'throw' );
+
+	expected = new Float64Array( [ 9.0, 3.0, 7.0, 1.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional ndarrays', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [], [ 0 ], 1, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 0, -1 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'normalize' );
+
+	expected = new Float64Array( [ 2.0, 2.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying how to handle out-of-bounds indices', function test( t ) {
+	var expected;
+	var modes;
+	var idx;
+	var x;
+	var y;
+	var i;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ -5, -1, 0, 4, 7 ] ), [ 5 ], [ 1 ], 0, 'row-major' );
+
+	modes = [ 'clamp', 'wrap' ];
+	expected = [
+		new Float64Array( [ 1.0, 1.0, 1.0, 4.0, 4.0 ] ),
+		new Float64Array( [ 4.0, 4.0, 1.0, 1.0, 4.0 ] )
+	];
+	for ( i = 0; i < modes.length; i++ ) {
+		y = ndarray( 'float64', new Float64Array( 5 ), [ 5 ], [ 1 ], 0, 'row-major' );
+		take( [ x, idx, y ], modes[ i ] );
+		t.deepEqual( y.data, expected[ i ], 'returns expected value for mode '+modes[ i ] );
+	}
+	t.end();
+});
+
+tape( 'the function gathers elements from an input ndarray (accessors)', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 2, -3, 1, 2 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = ndarray( 'complex128', new Complex128Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'normalize' );
+
+	expected = new Complex128Array( [ 5.0, 6.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	t.strictEqual( isSameComplex128Array( y.data, expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function gathers elements from an input ndarray (accessors, non-contiguous)', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2 ], [ -2 ], 2, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 1, 0, 1 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'complex128', new Complex128Array( 6 ), [ 3 ], [ 2 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'throw' );
+
+	expected = new Complex128Array( [ 1.0, 2.0, 0.0, 0.0, 5.0, 6.0, 0.0, 0.0, 1.0, 2.0, 0.0, 0.0 ] );
+	t.strictEqual( isSameComplex128Array( y.data, expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function does not throw when provided empty index and output ndarrays', function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 0 ), [ 0 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'throw' );
+	t.strictEqual( y.data.length, 0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'if not provided an index mode, the function resolves indices according to the input ndarray index mode', function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ),
+		'shape': [ 4 ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major',
+		'mode': 'wrap'
+	};
+	idx = ndarray( 'int32', new Int32Array( [ 5, -1, 2 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ] );
+
+	expected = new Float64Array( [ 2.0, 4.0, 3.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+
+	x.mode = 'throw';
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ] );
+	}
+});
@@ -0,0 +1,175 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2025 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var resolve = require( 'path' ).resolve;
+var tape = require( 'tape' );
+var tryRequire = require( '@stdlib/utils/try-require' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var Int8Array = require( '@stdlib/array/int8' );
+var ndarray = require( './../../../base/ctor' );
+
+
+// VARIABLES //
+
+var take = tryRequire( resolve( __dirname, './../lib/native.js' ) );
+var opts = {
+	'skip': ( take instanceof Error )
+};
+
+
+// TESTS //
+
+tape( 'main export is a function', opts, function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof take, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided index and output ndarrays which do not have the same number of elements', opts, function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ], 'throw' );
+	}
+});
+
+tape( 'the function throws an error if provided an out-of-bounds index when the index mode is `throw`', opts, function test( t ) {
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 0, 4 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		take( [ x, idx, y ], 'throw' );
+	}
+});
+
+tape( 'the function gathers elements from an input ndarray', opts, function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 4, 0, 2, -1 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'normalize' );
+
+	expected = new Float64Array( [ 5.0, 1.0, 3.0, 6.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function resolves indices according to the provided index mode, regardless of the input ndarray index mode', opts, function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ),
+		'shape': [ 4 ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major',
+		'mode': 'throw'
+	};
+	idx = ndarray( 'int32', new Int32Array( [ 5, -1, 2 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'clamp' );
+
+	expected = new Float64Array( [ 4.0, 1.0, 3.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'if not provided an index mode, the function resolves indices according to the input ndarray index mode', opts, function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ),
+		'shape': [ 4 ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major',
+		'mode': 'wrap'
+	};
+	idx = ndarray( 'int32', new Int32Array( [ 5, -1, 2 ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ] );
+
+	expected = new Float64Array( [ 2.0, 4.0, 3.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function falls back to a JavaScript implementation when provided ndarrays which are not supported by the C kernels', opts, function test( t ) {
+	var expected;
+	var idx;
+	var x;
+	var y;
+
+	// Generic data buffers:
+	x = ndarray( 'generic', [ 1.0, 2.0, 3.0, 4.0 ], [ 4 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int32', new Int32Array( [ 3, 0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'generic', [ 0.0, 0.0 ], [ 2 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'throw' );
+
+	expected = [ 4.0, 1.0 ];
+	t.deepEqual( y.data, expected, 'returns expected value' );
+
+	// Unsupported index data type:
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	idx = ndarray( 'int8', new Int8Array( [ 2, -1 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( 2 ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	take( [ x, idx, y ], 'normalize' );
+
+	expected = new Float64Array( [ 3.0, 4.0 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
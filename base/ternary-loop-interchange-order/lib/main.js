@@ -43,6 +43,7 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * @param {IntegerArray} sy - second input array stride lengths
 * @param {IntegerArray} sz - third input array stride lengths
 * @param {IntegerArray} sw - output array stride lengths
+* @param {ArrayLikeObject<(PositiveInteger|null)>} [nbytes] - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns {Object} loop interchange data
 *
 * @example
@@ -71,8 +72,8 @@ var loopOrder = require( './../../../base/loop-interchange-order' );
 * var ssw = o.sw;
 * // returns [ 1, -2, 6 ]
 */
-function ternaryLoopOrder( sh, sx, sy, sz, sw ) {
-	var tmp = loopOrder( sh, [ sx, sy, sz, sw ] );
+function ternaryLoopOrder( sh, sx, sy, sz, sw, nbytes ) {
+	var tmp = loopOrder( sh, [ sx, sy, sz, sw ], ( arguments.length > 5 ) ? nbytes : [] );
 	return {
 		'sh': tmp[ 0 ],
 		'sx': tmp[ 1 ],
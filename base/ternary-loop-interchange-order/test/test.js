@@ -207,23 +207,23 @@ tape( 'the function returns loop interchange data (all disorganized)', function
 
 	t.notEqual( o.sh, sh, 'returns expected value' );
 	t.strictEqual( isArray( o.sh ), true, 'returns expected value' );
-	t.deepEqual( o.sh, [ 2, 4, 2 ], 'returns expected value' );
+	t.deepEqual( o.sh, [ 2, 2, 4 ], 'returns expected value' );
 
 	t.notEqual( o.sx, sx, 'returns expected value' );
 	t.strictEqual( isArray( o.sx ), true, 'returns expected value' );
-	t.deepEqual( o.sx, [ -1, 2, 4 ], 'returns expected value' );
+	t.deepEqual( o.sx, [ -1, 4, 2 ], 'returns expected value' );
 
 	t.notEqual( o.sy, sy, 'returns expected value' );
 	t.strictEqual( isArray( o.sy ), true, 'returns expected value' );
-	t.deepEqual( o.sy, [ 1, -2, 4 ], 'returns expected value' );
+	t.deepEqual( o.sy, [ 1, 4, -2 ], 'returns expected value' );
 
 	t.notEqual( o.sz, sz, 'returns expected value' );
 	t.strictEqual( isArray( o.sz ), true, 'returns expected value' );
-	t.deepEqual( o.sz, [ 2, 1, -4 ], 'returns expected value' );
+	t.deepEqual( o.sz, [ 2, -4, 1 ], 'returns expected value' );
 
 	t.notEqual( o.sw, sw, 'returns expected value' );
 	t.strictEqual( isArray( o.sw ), true, 'returns expected value' );
-	t.deepEqual( o.sw, [ 4, -8, -2 ], 'returns expected value' );
+	t.deepEqual( o.sw, [ 4, -2, -8 ], 'returns expected value' );
 
 	t.end();
 });
@@ -0,0 +1,121 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/ternary.h"
+#include "stdlib/ndarray/dtypes.h"
+#include "stdlib/ndarray/index_modes.h"
+#include "stdlib/ndarray/orders.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+static void print_ndarray_contents( const struct ndarray *x ) {
+	int64_t i;
+	int8_t s;
+	double v;
+
+	for ( i = 0; i < stdlib_ndarray_length( x ); i++ ) {
+		s = stdlib_ndarray_iget_float64( x, i, &v );
+		if ( s != 0 ) {
+			fprintf( stderr, "Unable to resolve data element.\n" );
+			exit( EXIT_FAILURE );
+		}
+		fprintf( stdout, "data[%"PRId64"] = %lf\n", i, v );
+	}
+}
+
+static double muladd( const double x, const double y, const double z ) {
+	return ( x*y ) + z;
+}
+
+int main( void ) {
+	// Define the ndarray data type:
+	enum STDLIB_NDARRAY_DTYPE dtype = STDLIB_NDARRAY_FLOAT64;
+
+	// Create underlying data buffers:
+	double xbuf[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+	double ybuf[] = { 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0, 2.0 };
+	double zbuf[] = { 10.0, 10.0, 10.0, 10.0, 10.0, 10.0, 10.0, 10.0 };
+	double wbuf[] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+	// Define the number of dimensions:
+	int64_t ndims = 3;
+
+	// Define the array shapes:
+	int64_t shape[] = { 2, 2, 2 };
+
+	// Define the strides:
+	int64_t sx[] = { 32, 16, 8 };
+	int64_t sy[] = { 32, 16, 8 };
+	int64_t sz[] = { 32, 16, 8 };
+	int64_t sw[] = { 32, 16, 8 };
+
+	// Define the offsets:
+	int64_t ox = 0;
+	int64_t oy = 0;
+	int64_t oz = 0;
+	int64_t ow = 0;
+
+	// Define the array order:
+	enum STDLIB_NDARRAY_ORDER order = STDLIB_NDARRAY_ROW_MAJOR;
+
+	// Specify the index mode:
+	enum STDLIB_NDARRAY_INDEX_MODE imode = STDLIB_NDARRAY_INDEX_ERROR;
+
+	// Specify the subscript index modes:
+	int8_t submodes[] = { imode };
+	int64_t nsubmodes = 1;
+
+	// Create the input ndarrays:
+	struct ndarray *x = stdlib_ndarray_allocate( dtype, (uint8_t *)xbuf, ndims, shape, sx, ox, order, imode, nsubmodes, submodes );
+	struct ndarray *y = stdlib_ndarray_allocate( dtype, (uint8_t *)ybuf, ndims, shape, sy, oy, order, imode, nsubmodes, submodes );
+	struct ndarray *z = stdlib_ndarray_allocate( dtype, (uint8_t *)zbuf, ndims, shape, sz, oz, order, imode, nsubmodes, submodes );
+	if ( x == NULL || y == NULL || z == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Create an output ndarray:
+	struct ndarray *w = stdlib_ndarray_allocate( dtype, (uint8_t *)wbuf, ndims, shape, sw, ow, order, imode, nsubmodes, submodes );
+	if ( w == NULL ) {
+		fprintf( stderr, "Error allocating memory.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Define an array containing the ndarrays:
+	struct ndarray *arrays[] = { x, y, z, w };
+
+	// Apply the callback:
+	int8_t status = stdlib_ndarray_ddd_d( arrays, (void *)muladd );
+	if ( status != 0 ) {
+		fprintf( stderr, "Error during computation.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Print the results:
+	print_ndarray_contents( w );
+	fprintf( stdout, "\n" );
+
+	// Free allocated memory:
+	stdlib_ndarray_free( x );
+	stdlib_ndarray_free( y );
+	stdlib_ndarray_free( z );
+	stdlib_ndarray_free( w );
+}
@@ -0,0 +1,38 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* Header file containing function declarations for ndarray functions which apply a ternary callback.
+*/
+#ifndef STDLIB_NDARRAY_BASE_TERNARY_H
+#define STDLIB_NDARRAY_BASE_TERNARY_H
+
+#include "ternary/macros.h"
+#include "ternary/typedefs.h"
+#include "ternary/dispatch_object.h"
+#include "ternary/dispatch.h"
+
+#include "ternary/ddd_d.h"
+#include "ternary/fff_f.h"
+#include "ternary/fff_f_as_ddd_d.h"
+#include "ternary/iii_i.h"
+#include "ternary/xdd_d.h"
+#include "ternary/xff_f.h"
+#include "ternary/xii_i.h"
+
+#endif // !STDLIB_NDARRAY_BASE_TERNARY_H
@@ -0,0 +1,94 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_TERNARY_DISPATCH_OBJECT_H
+#define STDLIB_NDARRAY_BASE_TERNARY_DISPATCH_OBJECT_H
+
+#include "stdlib/ndarray/base/ternary/typedefs.h"
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Structure for grouping ternary function dispatch information.
+*
+* @example
+* #include "stdlib/ndarray/base/ternary/ddd_d.h"
+* #include <stdlib.h>
+* #include <stdio.h>
+*
+* ndarrayTernaryFcn functions[] = {
+*     stdlib_ndarray_ddd_d_0d,
+*     stdlib_ndarray_ddd_d_1d,
+*     stdlib_ndarray_ddd_d_2d,
+*     stdlib_ndarray_ddd_d_3d,
+*     stdlib_ndarray_ddd_d_4d,
+*     stdlib_ndarray_ddd_d_5d,
+*     stdlib_ndarray_ddd_d_6d,
+*     stdlib_ndarray_ddd_d_7d,
+*     stdlib_ndarray_ddd_d_8d,
+*     stdlib_ndarray_ddd_d_9d,
+*     stdlib_ndarray_ddd_d_10d
+*     stdlib_ndarray_ddd_d_nd
+* };
+
+* ndarrayTernaryFcn blocked_functions[] = {
+*     stdlib_ndarray_ddd_d_2d_blocked,
+*     stdlib_ndarray_ddd_d_3d_blocked,
+*     stdlib_ndarray_ddd_d_4d_blocked,
+*     stdlib_ndarray_ddd_d_5d_blocked,
+*     stdlib_ndarray_ddd_d_6d_blocked,
+*     stdlib_ndarray_ddd_d_7d_blocked,
+*     stdlib_ndarray_ddd_d_8d_blocked,
+*     stdlib_ndarray_ddd_d_9d_blocked,
+*     stdlib_ndarray_ddd_d_10d_blocked
+* };
+*
+* ndarrayTernaryDispatchObject obj = {
+*     functions,
+*     12,
+*     blocked_functions
+*     9
+* };
+*
+* // ...
+*/
+struct ndarrayTernaryDispatchObject {
+	// Array containing ternary ndarray functions for performing element-wise computation:
+	ndarrayTernaryFcn *functions;
+
+	// Number of ternary ndarray functions:
+	int32_t nfunctions;
+
+	// Array containing ternary ndarray functions for performing element-wise computation using loop blocking:
+	ndarrayTernaryFcn *blocked_functions;
+
+	// Number of blocked ternary ndarray functions:
+	int32_t nblockedfunctions;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_TERNARY_DISPATCH_OBJECT_H
@@ -0,0 +1,146 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_TERNARY_FFF_F_AS_DDD_D_H
+#define STDLIB_NDARRAY_BASE_TERNARY_FFF_F_AS_DDD_D_H
+
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Applies a ternary callback to input ndarrays and assigns results to elements in an output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to zero-dimensional input ndarrays and assigns results to elements in a zero-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_0d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to one-dimensional input ndarrays and assigns results to elements in an one-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_1d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to two-dimensional input ndarrays and assigns results to elements in a two-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_2d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to two-dimensional input ndarrays and assigns results to elements in a two-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_2d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to three-dimensional input ndarrays and assigns results to elements in a three-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_3d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to three-dimensional input ndarrays and assigns results to elements in a three-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_3d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to four-dimensional input ndarrays and assigns results to elements in a four-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_4d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to four-dimensional input ndarrays and assigns results to elements in a four-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_4d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to five-dimensional input ndarrays and assigns results to elements in a five-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_5d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to five-dimensional input ndarrays and assigns results to elements in a five-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_5d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to six-dimensional input ndarrays and assigns results to elements in a six-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_6d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to six-dimensional input ndarrays and assigns results to elements in a six-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_6d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to seven-dimensional input ndarrays and assigns results to elements in a seven-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_7d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to seven-dimensional input ndarrays and assigns results to elements in a seven-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_7d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to eight-dimensional input ndarrays and assigns results to elements in an eight-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_8d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to eight-dimensional input ndarrays and assigns results to elements in an eight-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_8d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to nine-dimensional input ndarrays and assigns results to elements in a nine-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_9d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to nine-dimensional input ndarrays and assigns results to elements in a nine-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_9d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to ten-dimensional input ndarrays and assigns results to elements in a ten-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_10d( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to ten-dimensional input ndarrays and assigns results to elements in a ten-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_10d_blocked( struct ndarray *arrays[], void *fcn );
+
+/**
+* Applies a ternary callback to n-dimensional input ndarrays and assigns results to elements in an n-dimensional output ndarray.
+*/
+int8_t stdlib_ndarray_fff_f_as_ddd_d_nd( struct ndarray *arrays[], void *fcn );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_TERNARY_FFF_F_AS_DDD_D_H
@@ -1,7 +1,7 @@
 /**
 * @license Apache-2.0
 *
-* Copyright (c) 2021 The Stdlib Authors.
+* Copyright (c) 2026 The Stdlib Authors.
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -16,14 +16,14 @@
 * limitations under the License.
 */
 
-#ifndef STDLIB_NDARRAY_BASE_UNARY_INTERNAL_SORT2INS_H
-#define STDLIB_NDARRAY_BASE_UNARY_INTERNAL_SORT2INS_H
+#ifndef STDLIB_NDARRAY_BASE_TERNARY_INTERNAL_PERMUTE_H
+#define STDLIB_NDARRAY_BASE_TERNARY_INTERNAL_PERMUTE_H
 
 #include <stdint.h>
 
 /**
-* Simultaneously sorts two arrays based on the sort order of the first array using insertion sort.
+* Permutes an input array according to a provided index array.
 */
-void stdlib_ndarray_base_unary_internal_sort2ins( const int64_t n, int64_t *x, int64_t *y );
+void stdlib_ndarray_base_ternary_internal_permute( const int64_t n, const int64_t *arr, const int64_t *idx, int64_t *out );
 
-#endif // !STDLIB_NDARRAY_BASE_UNARY_INTERNAL_SORT2INS_H
+#endif // !STDLIB_NDARRAY_BASE_TERNARY_INTERNAL_PERMUTE_H
@@ -0,0 +1,306 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_BASE_TERNARY_MACROS_2D_BLOCKED_H
+#define STDLIB_NDARRAY_BASE_TERNARY_MACROS_2D_BLOCKED_H
+
+#include "stdlib/ndarray/base/bytes_per_element.h"
+#include "stdlib/ndarray/base/ternary/internal/permute.h"
+#include "stdlib/ndarray/base/ternary/macros/constants.h"
+#include "stdlib/ndarray/base/weighted_loop_interchange_order.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+* Macro containing the preamble for blocked nested loops which operate on elements of a two-dimensional ndarray.
+*
+* ## Notes
+*
+* -   Variable naming conventions:
+*
+*     -   `sx#`, `pbx#`, `px#`, `ox#`, `nbx#`, and `d@x#` where `#` corresponds to the ndarray argument number, starting at `1`.
+*     -   `S@`, `i@`, `j@`, `o@x#`, and `d@x#` where `@` corresponds to the loop number, with `0` being the innermost loop.
+*
+* @example
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE {
+*     // Innermost loop body...
+* }
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE
+*/
+#define STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE                        \
+	const struct ndarray *x1 = arrays[ 0 ];                                    \
+	const struct ndarray *x2 = arrays[ 1 ];                                    \
+	const struct ndarray *x3 = arrays[ 2 ];                                    \
+	const struct ndarray *x4 = arrays[ 3 ];                                    \
+	int64_t shape[2];                                                          \
+	int64_t sx1[2];                                                            \
+	int64_t sx2[2];                                                            \
+	int64_t sx3[2];                                                            \
+	int64_t sx4[2];                                                            \
+	int64_t idx[2];                                                            \
+	int64_t cost[4];                                                           \
+	int64_t tmp[2];                                                            \
+	int64_t bsize;                                                             \
+	int64_t nbmax;                                                             \
+	uint8_t *pbx1;                                                             \
+	uint8_t *pbx2;                                                             \
+	uint8_t *pbx3;                                                             \
+	uint8_t *pbx4;                                                             \
+	uint8_t *px1;                                                              \
+	uint8_t *px2;                                                              \
+	uint8_t *px3;                                                              \
+	uint8_t *px4;                                                              \
+	int64_t d0x1;                                                              \
+	int64_t d1x1;                                                              \
+	int64_t d0x2;                                                              \
+	int64_t d1x2;                                                              \
+	int64_t d0x3;                                                              \
+	int64_t d1x3;                                                              \
+	int64_t d0x4;                                                              \
+	int64_t d1x4;                                                              \
+	int64_t o1x1;                                                              \
+	int64_t o1x2;                                                              \
+	int64_t o1x3;                                                              \
+	int64_t o1x4;                                                              \
+	int64_t nbx1;                                                              \
+	int64_t nbx2;                                                              \
+	int64_t nbx3;                                                              \
+	int64_t nbx4;                                                              \
+	int64_t ox1;                                                               \
+	int64_t ox2;                                                               \
+	int64_t ox3;                                                               \
+	int64_t ox4;                                                               \
+	int64_t s0;                                                                \
+	int64_t s1;                                                                \
+	int64_t i0;                                                                \
+	int64_t i1;                                                                \
+	int64_t j0;                                                                \
+	int64_t j1;                                                                \
+	/* Resolve a loop order which minimizes the estimated cost of accessing the elements of all ndarrays: */ \
+	stdlib_ndarray_weighted_loop_interchange_order( 2, 4, arrays, 1, cost, idx ); \
+	/* Permute the shape and array strides (avoiding mutation) according to loop order: */ \
+	stdlib_ndarray_base_ternary_internal_permute( 2, stdlib_ndarray_shape( x1 ), idx, tmp ); \
+	memcpy( shape, tmp, sizeof shape );                                        \
+	stdlib_ndarray_base_ternary_internal_permute( 2, stdlib_ndarray_strides( x1 ), idx, tmp ); \
+	memcpy( sx1, tmp, sizeof sx1 );                                            \
+	stdlib_ndarray_base_ternary_internal_permute( 2, stdlib_ndarray_strides( x2 ), idx, tmp ); \
+	memcpy( sx2, tmp, sizeof sx2 );                                            \
+	stdlib_ndarray_base_ternary_internal_permute( 2, stdlib_ndarray_strides( x3 ), idx, tmp ); \
+	memcpy( sx3, tmp, sizeof sx3 );                                            \
+	stdlib_ndarray_base_ternary_internal_permute( 2, stdlib_ndarray_strides( x4 ), idx, tmp ); \
+	memcpy( sx4, tmp, sizeof sx4 );                                            \
+	/* Determine the block size... */                                          \
+	nbx1 = stdlib_ndarray_bytes_per_element( stdlib_ndarray_dtype( x1 ) );     \
+	nbx2 = stdlib_ndarray_bytes_per_element( stdlib_ndarray_dtype( x2 ) );     \
+	nbx3 = stdlib_ndarray_bytes_per_element( stdlib_ndarray_dtype( x3 ) );     \
+	nbx4 = stdlib_ndarray_bytes_per_element( stdlib_ndarray_dtype( x4 ) );     \
+	nbmax = nbx1;                                                              \
+	if ( nbx2 > nbmax ) {                                                      \
+		nbmax = nbx2;                                                          \
+	}                                                                          \
+	if ( nbx3 > nbmax ) {                                                      \
+		nbmax = nbx3;                                                          \
+	}                                                                          \
+	if ( nbx4 > nbmax ) {                                                      \
+		nbmax = nbx4;                                                          \
+	}                                                                          \
+	if ( nbmax == 0 ) {                                                        \
+		bsize = STDLIB_NDARRAY_TERNARY_BLOCK_SIZE_IN_ELEMENTS;                 \
+	} else {                                                                   \
+		bsize = STDLIB_NDARRAY_TERNARY_BLOCK_SIZE_IN_BYTES / nbmax;            \
+	}                                                                          \
+	/* Cache pointers to the ndarray buffers... */                             \
+	pbx1 = stdlib_ndarray_data( x1 );                                          \
+	pbx2 = stdlib_ndarray_data( x2 );                                          \
+	pbx3 = stdlib_ndarray_data( x3 );                                          \
+	pbx4 = stdlib_ndarray_data( x4 );                                          \
+	/* Cache byte offsets to the first indexed elements... */                  \
+	ox1 = stdlib_ndarray_offset( x1 );                                         \
+	ox2 = stdlib_ndarray_offset( x2 );                                         \
+	ox3 = stdlib_ndarray_offset( x3 );                                         \
+	ox4 = stdlib_ndarray_offset( x4 );                                         \
+	/* Cache offset increments for the innermost loop... */                    \
+	d0x1 = sx1[0];                                                             \
+	d0x2 = sx2[0];                                                             \
+	d0x3 = sx3[0];                                                             \
+	d0x4 = sx4[0];                                                             \
+	/* Iterate over blocks... */                                               \
+	for ( j1 = shape[1]; j1 > 0; ) {                                           \
+		if ( j1 < bsize ) {                                                    \
+			s1 = j1;                                                           \
+			j1 = 0;                                                            \
+		} else {                                                               \
+			s1 = bsize;                                                        \
+			j1 -= bsize;                                                       \
+		}                                                                      \
+		o1x1 = ox1 + ( j1*sx1[1] );                                            \
+		o1x2 = ox2 + ( j1*sx2[1] );                                            \
+		o1x3 = ox3 + ( j1*sx3[1] );                                            \
+		o1x4 = ox4 + ( j1*sx4[1] );                                            \
+		for ( j0 = shape[0]; j0 > 0; ) {                                       \
+			if ( j0 < bsize ) {                                                \
+				s0 = j0;                                                       \
+				j0 = 0;                                                        \
+			} else {                                                           \
+				s0 = bsize;                                                    \
+				j0 -= bsize;                                                   \
+			}                                                                  \
+			/* Compute pointers to the first ndarray elements in the current block... */ \
+			px1 = pbx1 + o1x1 + ( j0*sx1[0] );                                 \
+			px2 = pbx2 + o1x2 + ( j0*sx2[0] );                                 \
+			px3 = pbx3 + o1x3 + ( j0*sx3[0] );                                 \
+			px4 = pbx4 + o1x4 + ( j0*sx4[0] );                                 \
+			/* Compute loop offset increments... */                            \
+			d1x1 = sx1[1] - ( s0*sx1[0] );                                     \
+			d1x2 = sx2[1] - ( s0*sx2[0] );                                     \
+			d1x3 = sx3[1] - ( s0*sx3[0] );                                     \
+			d1x4 = sx4[1] - ( s0*sx4[0] );                                     \
+			/* Iterate over the ndarray dimensions... */                       \
+			for ( i1 = 0; i1 < s1; i1++, px1 += d1x1, px2 += d1x2, px3 += d1x3, px4 += d1x4 ) { \
+				for ( i0 = 0; i0 < s0; i0++, px1 += d0x1, px2 += d0x2, px3 += d0x3, px4 += d0x4 )
+
+/**
+* Macro containing the epilogue for blocked nested loops which operate on elements of a two-dimensional ndarray.
+*
+* @example
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE {
+*     // Innermost loop body...
+* }
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE
+*/
+#define STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE                        \
+			}                                                                  \
+		}                                                                      \
+	}
+
+/**
+* Macro for a blocked ternary two-dimensional ndarray loop which inlines an expression.
+*
+* ## Notes
+*
+* -   Retrieves each input ndarray element according to types `tin1`, `tin2`, and `tin3` via the pointers `px1`, `px2`, and `px3` as `in1`, `in2`, and `in3`, respectively.
+* -   Creates a pointer `tout *out` to the output ndarray element.
+* -   Expects a provided expression to operate on `tin1 in1`, `tin2 in2`, and `tin3 in3` and to store the result in `tout *out`.
+*
+* @param tin1  first input type
+* @param tin2  second input type
+* @param tin3  third input type
+* @param tout  output type
+* @param expr  expression to inline
+*
+* @example
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_INLINE( double, double, double, double, *out = ( in1 * in2 ) + in3 )
+*/
+#define STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_INLINE( tin1, tin2, tin3, tout, expr ) \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE {                          \
+		const tin1 in1 = *(tin1 *)px1;                                         \
+		const tin2 in2 = *(tin2 *)px2;                                         \
+		const tin3 in3 = *(tin3 *)px3;                                         \
+		tout *out = (tout *)px4;                                               \
+		expr;                                                                  \
+	}                                                                          \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE
+
+/**
+* Macro for a blocked ternary two-dimensional ndarray loop which invokes a callback.
+*
+* ## Notes
+*
+* -   Retrieves each input ndarray element according to types `tin1`, `tin2`, and `tin3` via the pointers `px1`, `px2`, and `px3`, respectively.
+* -   Explicitly casts each function `f` invocation result to `tout`.
+* -   Stores the result in an output ndarray via the pointer `px4`.
+*
+* @param tin1  first input type
+* @param tin2  second input type
+* @param tin3  third input type
+* @param tout  output type
+*
+* @example
+* // e.g., ddd_d
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_CLBK( double, double, double, double )
+*/
+#define STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_CLBK( tin1, tin2, tin3, tout )  \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE {                          \
+		const tin1 x = *(tin1 *)px1;                                           \
+		const tin2 y = *(tin2 *)px2;                                           \
+		const tin3 z = *(tin3 *)px3;                                           \
+		*(tout *)px4 = (tout)f( x, y, z );                                     \
+	}                                                                          \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE
+
+/**
+* Macro for a blocked ternary two-dimensional ndarray loop which invokes a callback and does not cast the callback's return value (e.g., a `struct`).
+*
+* ## Notes
+*
+* -   Retrieves each input ndarray element according to types `tin1`, `tin2`, and `tin3` via the pointers `px1`, `px2`, and `px3`, respectively.
+* -   Stores the result in an output ndarray of type `tout` via the pointer `px4`.
+*
+* @param tin1  first input type
+* @param tin2  second input type
+* @param tin3  third input type
+* @param tout  output type
+*
+* @example
+* #include "stdlib/complex/float64/ctor.h"
+*
+* // e.g., zzz_z
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_CLBK_RET_NOCAST( stdlib_complex128_t, stdlib_complex128_t, stdlib_complex128_t, stdlib_complex128_t )
+*/
+#define STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_CLBK_RET_NOCAST( tin1, tin2, tin3, tout ) \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE {                          \
+		const tin1 x = *(tin1 *)px1;                                           \
+		const tin2 y = *(tin2 *)px2;                                           \
+		const tin3 z = *(tin3 *)px3;                                           \
+		*(tout *)px4 = f( x, y, z );                                           \
+	}                                                                          \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE
+
+/**
+* Macro for a blocked ternary two-dimensional ndarray loop which invokes a callback requiring arguments be explicitly cast to a different type.
+*
+* ## Notes
+*
+* -   Retrieves each input ndarray element according to types `tin1`, `tin2`, and `tin3` via the pointers `px1`, `px2`, and `px3`, respectively.
+* -   Explicitly casts each function argument to `fin1`, `fin2`, and `fin3`, respectively.
+* -   Explicitly casts each function `f` invocation result to `tout`.
+* -   Stores the result in an output ndarray via the pointer `px4`.
+*
+* @param tin1  first input type
+* @param tin2  second input type
+* @param tin3  third input type
+* @param tout  output type
+* @param fin1  first callback argument type
+* @param fin2  second callback argument type
+* @param fin3  third callback argument type
+*
+* @example
+* // e.g., fff_f_as_ddd_d
+* STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_CLBK_ARG_CAST( float, float, float, float, double, double, double )
+*/
+#define STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_CLBK_ARG_CAST( tin1, tin2, tin3, tout, fin1, fin2, fin3 ) \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_PREAMBLE {                          \
+		const tin1 x = *(tin1 *)px1;                                           \
+		const tin2 y = *(tin2 *)px2;                                           \
+		const tin3 z = *(tin3 *)px3;                                           \
+		*(tout *)px4 = (tout)f( (fin1)x, (fin2)y, (fin3)z );                   \
+	}                                                                          \
+	STDLIB_NDARRAY_TERNARY_2D_BLOCKED_LOOP_EPILOGUE
+
+#endif // !STDLIB_NDARRAY_BASE_TERNARY_MACROS_2D_BLOCKED_H
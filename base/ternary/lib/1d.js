@@ -133,6 +133,9 @@ function ternary1d( x, y, z, w, fcn ) {
 	var dz;
 	var dw;
 	var S0;
+	var vx;
+	var vy;
+	var vz;
 	var ix;
 	var iy;
 	var iz;
@@ -160,6 +163,77 @@ function ternary1d( x, y, z, w, fcn ) {
 	zbuf = z.data;
 	wbuf = w.data;
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx === 0 && dy === 0 && dz === 0 ) {
+		vx = xbuf[ ix ];
+		vy = ybuf[ iy ];
+		vz = zbuf[ iz ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( vx, vy, vz );
+			iw += dw;
+		}
+		return;
+	}
+	if ( dx === 0 && dy === 0 ) {
+		vx = xbuf[ ix ];
+		vy = ybuf[ iy ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( vx, vy, zbuf[ iz ] );
+			iz += dz;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dx === 0 && dz === 0 ) {
+		vx = xbuf[ ix ];
+		vz = zbuf[ iz ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( vx, ybuf[ iy ], vz );
+			iy += dy;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dy === 0 && dz === 0 ) {
+		vy = ybuf[ iy ];
+		vz = zbuf[ iz ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( xbuf[ ix ], vy, vz );
+			ix += dx;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dx === 0 ) {
+		vx = xbuf[ ix ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( vx, ybuf[ iy ], zbuf[ iz ] );
+			iy += dy;
+			iz += dz;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dy === 0 ) {
+		vy = ybuf[ iy ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( xbuf[ ix ], vy, zbuf[ iz ] );
+			ix += dx;
+			iz += dz;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dz === 0 ) {
+		vz = zbuf[ iz ];
+		for ( i = 0; i < S0; i++ ) {
+			wbuf[ iw ] = fcn( xbuf[ ix ], ybuf[ iy ], vz );
+			ix += dx;
+			iy += dy;
+			iw += dw;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i = 0; i < S0; i++ ) {
 		wbuf[ iw ] = fcn( xbuf[ ix ], ybuf[ iy ], zbuf[ iz ] );
@@ -147,6 +147,9 @@ function ternary1d( x, y, z, w, fcn ) {
 	var dz;
 	var dw;
 	var S0;
+	var vx;
+	var vy;
+	var vz;
 	var ix;
 	var iy;
 	var iz;
@@ -180,6 +183,77 @@ function ternary1d( x, y, z, w, fcn ) {
 	zget = z.accessors[ 0 ];
 	wset = w.accessors[ 1 ];
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx === 0 && dy === 0 && dz === 0 ) {
+		vx = xget( xbuf, ix );
+		vy = yget( ybuf, iy );
+		vz = zget( zbuf, iz );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( vx, vy, vz ) );
+			iw += dw;
+		}
+		return;
+	}
+	if ( dx === 0 && dy === 0 ) {
+		vx = xget( xbuf, ix );
+		vy = yget( ybuf, iy );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( vx, vy, zget( zbuf, iz ) ) );
+			iz += dz;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dx === 0 && dz === 0 ) {
+		vx = xget( xbuf, ix );
+		vz = zget( zbuf, iz );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( vx, yget( ybuf, iy ), vz ) );
+			iy += dy;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dy === 0 && dz === 0 ) {
+		vy = yget( ybuf, iy );
+		vz = zget( zbuf, iz );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( xget( xbuf, ix ), vy, vz ) );
+			ix += dx;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dx === 0 ) {
+		vx = xget( xbuf, ix );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( vx, yget( ybuf, iy ), zget( zbuf, iz ) ) );
+			iy += dy;
+			iz += dz;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dy === 0 ) {
+		vy = yget( ybuf, iy );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( xget( xbuf, ix ), vy, zget( zbuf, iz ) ) );
+			ix += dx;
+			iz += dz;
+			iw += dw;
+		}
+		return;
+	}
+	if ( dz === 0 ) {
+		vz = zget( zbuf, iz );
+		for ( i = 0; i < S0; i++ ) {
+			wset( wbuf, iw, fcn( xget( xbuf, ix ), yget( ybuf, iy ), vz ) );
+			ix += dx;
+			iy += dy;
+			iw += dw;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i = 0; i < S0; i++ ) {
 		wset( wbuf, iw, fcn( xget( xbuf, ix ), yget( ybuf, iy ), zget( zbuf, iz ) ) ); // eslint-disable-line max-len
@@ -140,6 +140,9 @@ function ternary2d( x, y, z, w, isRowMajor, fcn ) {
 	var sh;
 	var S0;
 	var S1;
+	var vx;
+	var vy;
+	var vz;
 	var sx;
 	var sy;
 	var sz;
@@ -196,6 +199,119 @@ function ternary2d( x, y, z, w, isRowMajor, fcn ) {
 	zbuf = z.data;
 	wbuf = w.data;
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx0 === 0 && dy0 === 0 && dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xbuf[ ix ];
+			vy = ybuf[ iy ];
+			vz = zbuf[ iz ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( vx, vy, vz );
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dx0 === 0 && dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xbuf[ ix ];
+			vy = ybuf[ iy ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( vx, vy, zbuf[ iz ] );
+				iz += dz0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dx0 === 0 && dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xbuf[ ix ];
+			vz = zbuf[ iz ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( vx, ybuf[ iy ], vz );
+				iy += dy0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dy0 === 0 && dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vy = ybuf[ iy ];
+			vz = zbuf[ iz ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( xbuf[ ix ], vy, vz );
+				ix += dx0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dx0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xbuf[ ix ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( vx, ybuf[ iy ], zbuf[ iz ] );
+				iy += dy0;
+				iz += dz0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vy = ybuf[ iy ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( xbuf[ ix ], vy, zbuf[ iz ] );
+				ix += dx0;
+				iz += dz0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vz = zbuf[ iz ];
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wbuf[ iw ] = fcn( xbuf[ ix ], ybuf[ iy ], vz );
+				ix += dx0;
+				iy += dy0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i1 = 0; i1 < S1; i1++ ) {
 		for ( i0 = 0; i0 < S0; i0++ ) {
@@ -154,6 +154,9 @@ function ternary2d( x, y, z, w, isRowMajor, fcn ) {
 	var sh;
 	var S0;
 	var S1;
+	var vx;
+	var vy;
+	var vz;
 	var sx;
 	var sy;
 	var sz;
@@ -216,6 +219,119 @@ function ternary2d( x, y, z, w, isRowMajor, fcn ) {
 	zget = z.accessors[ 0 ];
 	wset = w.accessors[ 1 ];
 
+	// Hoist loads of loop-invariant (i.e., broadcasted) input ndarray elements out of the innermost loop...
+	if ( dx0 === 0 && dy0 === 0 && dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xget( xbuf, ix );
+			vy = yget( ybuf, iy );
+			vz = zget( zbuf, iz );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( vx, vy, vz ) );
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dx0 === 0 && dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xget( xbuf, ix );
+			vy = yget( ybuf, iy );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( vx, vy, zget( zbuf, iz ) ) );
+				iz += dz0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dx0 === 0 && dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xget( xbuf, ix );
+			vz = zget( zbuf, iz );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( vx, yget( ybuf, iy ), vz ) );
+				iy += dy0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dy0 === 0 && dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vy = yget( ybuf, iy );
+			vz = zget( zbuf, iz );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( xget( xbuf, ix ), vy, vz ) );
+				ix += dx0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dx0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vx = xget( xbuf, ix );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( vx, yget( ybuf, iy ), zget( zbuf, iz ) ) );
+				iy += dy0;
+				iz += dz0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dy0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vy = yget( ybuf, iy );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( xget( xbuf, ix ), vy, zget( zbuf, iz ) ) );
+				ix += dx0;
+				iz += dz0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
+	if ( dz0 === 0 ) {
+		for ( i1 = 0; i1 < S1; i1++ ) {
+			vz = zget( zbuf, iz );
+			for ( i0 = 0; i0 < S0; i0++ ) {
+				wset( wbuf, iw, fcn( xget( xbuf, ix ), yget( ybuf, iy ), vz ) );
+				ix += dx0;
+				iy += dy0;
+				iw += dw0;
+			}
+			ix += dx1;
+			iy += dy1;
+			iz += dz1;
+			iw += dw1;
+		}
+		return;
+	}
 	// Iterate over the ndarray dimensions...
 	for ( i1 = 0; i1 < S1; i1++ ) {
 		for ( i0 = 0; i0 < S0; i0++ ) {
@@ -24,6 +24,7 @@
 
 var loopOrder = require( './../../../base/ternary-loop-interchange-order' );
 var blockSize = require( './../../../base/ternary-tiling-block-size' );
+var bytesPerElement = require( './../../../base/bytes-per-element' );
 
 
 // MAIN //
@@ -183,7 +184,7 @@ function blockedternary3d( x, y, z, w, fcn ) {
 	// Note on variable naming convention: s#, dx#, dy#, dz#, dw#, i#, j# where # corresponds to the loop number, with `0` being the innermost loop...
 
 	// Resolve the loop interchange order:
-	o = loopOrder( x.shape, x.strides, y.strides, z.strides, w.strides );
+	o = loopOrder( x.shape, x.strides, y.strides, z.strides, w.strides, [ bytesPerElement( x.dtype ), bytesPerElement( y.dtype ), bytesPerElement( z.dtype ), bytesPerElement( w.dtype ) ] );
 	sh = o.sh;
 	sx = o.sx;
 	sy = o.sy;
@@ -21,9 +21,10 @@
 // MODULES //
 
 var iterationOrder = require( './../../../base/iteration-order' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
 var minmaxViewBufferIndex = require( './../../../base/minmax-view-buffer-index' );
 var ndarray2object = require( './../../../base/ndarraylike2object' );
-var strides2order = require( './../../../base/strides2order' );
+var sharedStrides2order = require( './../../../base/shared-strides2order' );
 var anyIsEntryIn = require( '@stdlib/array/base/any-is-entry-in' );
 var format = require( '@stdlib/string/format' );
 var blockedaccessorternary2d = require( './2d_blocked_accessors.js' );
@@ -228,7 +229,7 @@ function ternary( arrays, fcn ) { // eslint-disable-line max-statements
 	var oy;
 	var ow;
 	var oz;
-	var ns;
+	var o;
 	var x;
 	var y;
 	var w;
@@ -264,7 +265,6 @@ function ternary( arrays, fcn ) { // eslint-disable-line max-statements
 	}
 	// Verify that the input and output arrays have the same dimensions...
 	len = 1; // number of elements
-	ns = 0;  // number of singleton dimensions
 	for ( i = 0; i < ndims; i++ ) {
 		d = shx[ i ];
 		if ( d !== shy[ i ] || d !== shz[ i ] || d !== shw[ i ] ) {
@@ -272,16 +272,28 @@ function ternary( arrays, fcn ) { // eslint-disable-line max-statements
 		}
 		// Note that, if one of the dimensions is `0`, the length will be `0`...
 		len *= d;
-
-		// Check whether the current dimension is a singleton dimension...
-		if ( d === 1 ) {
-			ns += 1;
-		}
 	}
 	// Check whether we were provided empty ndarrays...
 	if ( len === 0 ) {
 		return;
 	}
+	// Merge adjacent dimensions which are jointly contiguous and remove singleton dimensions (e.g., ndims=3, shape=[100,3,1000], where only the last two dimensions are contiguous, becomes ndims=2, shape=[100,3000]) so that we can use lower-dimensional kernels...
+	if ( ndims > 1 ) {
+		o = coalesce( shx, [ x.strides, y.strides, z.strides, w.strides ] );
+		shx = o[ 0 ];
+		shy = shx;
+		shz = shx;
+		shw = shx;
+		ndims = shx.length;
+		x.shape = shx;
+		y.shape = shy;
+		z.shape = shz;
+		w.shape = shw;
+		x.strides = o[ 1 ];
+		y.strides = o[ 2 ];
+		z.strides = o[ 3 ];
+		w.strides = o[ 4 ];
+	}
 	// Determine whether the ndarrays are one-dimensional and thus readily translate to one-dimensional strided arrays...
 	if ( ndims === 1 ) {
 		if ( hasAccessors( x, y, z, w ) ) {
@@ -294,42 +306,19 @@ function ternary( arrays, fcn ) { // eslint-disable-line max-statements
 	sz = z.strides;
 	sw = w.strides;
 
-	// Determine whether the ndarrays have only **one** non-singleton dimension (e.g., ndims=4, shape=[10,1,1,1]) so that we can treat the ndarrays as being equivalent to one-dimensional strided arrays...
-	if ( ns === ndims-1 ) {
-		// Get the index of the non-singleton dimension...
-		for ( i = 0; i < ndims; i++ ) {
-			if ( shx[ i ] !== 1 ) {
-				break;
-			}
-		}
-		x.shape = [ shx[i] ];
-		y.shape = x.shape;
-		z.shape = x.shape;
-		w.shape = x.shape;
-		x.strides = [ sx[i] ];
-		y.strides = [ sy[i] ];
-		z.strides = [ sz[i] ];
-		w.strides = [ sw[i] ];
-		if ( hasAccessors( x, y, w, z ) ) {
-			return ACCESSOR_TERNARY[ 1 ]( x, y, z, w, fcn );
-		}
-		return TERNARY[ 1 ]( x, y, z, w, fcn );
-	}
 	iox = iterationOrder( sx ); // +/-1
 	ioy = iterationOrder( sy ); // +/-1
 	ioz = iterationOrder( sz ); // +/-1
 	iow = iterationOrder( sw ); // +/-1
 
 	// Determine whether we can avoid blocked iteration...
-	ord = strides2order( sx );
+	ord = sharedStrides2order( [ sx, sy, sz, sw ] );
 	if (
 		iox !== 0 &&
 		ioy !== 0 &&
 		ioz !== 0 &&
 		iow !== 0 &&
-		ord === strides2order( sy ) &&
-		ord === strides2order( sz ) &&
-		ord === strides2order( sw )
+		ord !== 0
 	) {
 		// Determine the minimum and maximum linear indices which are accessible by the array views:
 		xmmv = minmaxViewBufferIndex( shx, sx, x.offset );
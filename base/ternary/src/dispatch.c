@@ -0,0 +1,333 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/ternary/dispatch_object.h"
+#include "stdlib/ndarray/base/ternary/typedefs.h"
+#include "stdlib/ndarray/base/iteration_order.h"
+#include "stdlib/ndarray/base/bytes_per_element.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Define the number of ndarray arguments (three inputs and one output):
+#define NARRAYS 4
+
+/**
+* Frees a list of (shallow copy) ndarrays.
+*
+* @param arrays   list of ndarrays
+* @param n        number of ndarrays
+*/
+static void stdlib_ndarray_ternary_free_arrays( struct ndarray *arrays[], const int64_t n ) {
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		stdlib_ndarray_free( arrays[ i ] );
+	}
+}
+
+/**
+* Applies a ternary callback to one-dimensional views of n-dimensional input ndarrays and assigns results to elements in a one-dimensional view of an n-dimensional output ndarray.
+*
+* ## Notes
+*
+* -   If able to successfully apply a ternary callback, the function returns `0`; otherwise, the function returns an error code.
+*
+* @param f        ternary ndarray function
+* @param arrays   array containing pointers to the original input and output ndarrays
+* @param N        number of elements
+* @param strides  list of (one-dimensional) stride lengths for each ndarray
+* @param offsets  list of byte offsets for each ndarray
+* @param fcn      callback
+* @return         status code
+*/
+static int8_t stdlib_ndarray_ternary_1d_view( const ndarrayTernaryFcn f, struct ndarray *arrays[], const int64_t N, int64_t *strides, const int64_t *offsets, void *fcn ) {
+	struct ndarray *views[ NARRAYS ];
+	struct ndarray *x;
+	int64_t sh[] = { N };
+	int8_t status;
+	int64_t i;
+
+	// Shallow copy and reshape the arrays...
+	for ( i = 0; i < NARRAYS; i++ ) {
+		x = arrays[ i ];
+
+		// Note: the ndarray constructor does not copy shape and strides, so we point directly into the list of strides, which outlives the views...
+		views[ i ] = stdlib_ndarray_allocate(
+			stdlib_ndarray_dtype( x ),
+			stdlib_ndarray_data( x ),
+			1,
+			sh,
+			strides+i, // pointer arithmetic
+			offsets[ i ],
+			stdlib_ndarray_order( x ),
+			stdlib_ndarray_index_mode( x ),
+			stdlib_ndarray_nsubmodes( x ),
+			stdlib_ndarray_submodes( x )
+		);
+		if ( views[ i ] == NULL ) {
+			stdlib_ndarray_ternary_free_arrays( views, i );
+			return -1;
+		}
+	}
+	// Apply the callback:
+	status = f( views, fcn );
+
+	// Free allocated memory:
+	stdlib_ndarray_ternary_free_arrays( views, NARRAYS );
+
+	return status;
+}
+
+/**
+* Dispatches to a ternary ndarray function according to the dimensionality of provided ndarray arguments.
+*
+* ## Notes
+*
+* -   If able to successfully dispatch, the function returns `0`; otherwise, the function returns an error code.
+*
+* @param obj      object comprised of dispatch tables containing ternary ndarray functions
+* @param arrays   array whose first three elements are pointers to input ndarrays and whose last element is a pointer to an output ndarray
+* @param fcn      callback
+* @return         status code
+*
+* @example
+* #include "stdlib/ndarray/base/ternary/dispatch.h"
+* #include "stdlib/ndarray/base/ternary/dispatch_object.h"
+* #include "stdlib/ndarray/base/ternary/typedefs.h"
+* #include "stdlib/ndarray/base/ternary/ddd_d.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include <stdint.h>
+* #include <stdlib.h>
+* #include <stdio.h>
+*
+* // Define a list of ternary ndarray functions:
+* ndarrayTernaryFcn functions[] = {
+*     stdlib_ndarray_ddd_d_0d,
+*     stdlib_ndarray_ddd_d_1d,
+*     stdlib_ndarray_ddd_d_2d,
+*     stdlib_ndarray_ddd_d_3d,
+*     stdlib_ndarray_ddd_d_4d,
+*     stdlib_ndarray_ddd_d_5d,
+*     stdlib_ndarray_ddd_d_6d,
+*     stdlib_ndarray_ddd_d_7d,
+*     stdlib_ndarray_ddd_d_8d,
+*     stdlib_ndarray_ddd_d_9d,
+*     stdlib_ndarray_ddd_d_10d,
+*     stdlib_ndarray_ddd_d_nd
+* };
+*
+* // Define a list of ternary ndarray functions using loop blocking:
+* ndarrayTernaryFcn blocked_functions[] = {
+*     stdlib_ndarray_ddd_d_2d_blocked,
+*     stdlib_ndarray_ddd_d_3d_blocked,
+*     stdlib_ndarray_ddd_d_4d_blocked,
+*     stdlib_ndarray_ddd_d_5d_blocked,
+*     stdlib_ndarray_ddd_d_6d_blocked,
+*     stdlib_ndarray_ddd_d_7d_blocked,
+*     stdlib_ndarray_ddd_d_8d_blocked,
+*     stdlib_ndarray_ddd_d_9d_blocked,
+*     stdlib_ndarray_ddd_d_10d_blocked
+* };
+*
+* // Create a ternary function dispatch object:
+* struct ndarrayTernaryDispatchObject obj = {
+*     // Array containing ternary ndarray functions:
+*     functions,
+*
+*     // Number of ternary ndarray functions:
+*     12,
+*
+*     // Array containing ternary ndarray functions using loop blocking:
+*     blocked_functions,
+*
+*     // Number of ternary ndarray functions using loop blocking:
+*     9
+* }
+*
+* // Define a function which performs dispatch:
+* int8_t stdlib_ndarray_ddd_d( struct ndarray *arrays[], void *fcn ) {
+*     return stdlib_ndarray_ternary_dispatch( &obj, arrays, fcn );
+* }
+*
+* // ...
+*
+* // Create ndarrays...
+* struct ndarray *x = stdlib_ndarray_allocate( ... );
+* struct ndarray *y = stdlib_ndarray_allocate( ... );
+* struct ndarray *z = stdlib_ndarray_allocate( ... );
+* struct ndarray *w = stdlib_ndarray_allocate( ... );
+*
+* // ...
+*
+* // Define a callback:
+* double fma( const double x, const double y, const double z ) {
+*     return ( x*y ) + z;
+* }
+*
+* // Apply the callback:
+* struct ndarray *arrays[] = { x, y, z, w };
+* int8_t status = stdlib_ndarray_ddd_d( arrays, (void *)fma );
+* if ( status != 0 ) {
+*     fprintf( stderr, "Error during computation.\n" );
+*     exit( EXIT_FAILURE );
+* }
+*/
+int8_t stdlib_ndarray_ternary_dispatch( const struct ndarrayTernaryDispatchObject *obj, struct ndarray *arrays[], void *fcn ) {
+	int64_t strides[ NARRAYS ];
+	int64_t offsets[ NARRAYS ];
+	int8_t ord;
+	const int64_t *sh;
+	struct ndarray *x;
+	int8_t status;
+	int64_t ndims;
+	int64_t mab;
+	int64_t mib;
+	int64_t *sx;
+	int64_t len;
+	int64_t bp;
+	int8_t io[ NARRAYS ];
+	int64_t ns;
+	int64_t s;
+	int64_t d;
+	int64_t i;
+	int64_t j;
+
+	// Verify that the input and output arrays have the same number of dimensions...
+	ndims = stdlib_ndarray_ndims( arrays[ 0 ] );
+	for ( j = 1; j < NARRAYS; j++ ) {
+		if ( ndims != stdlib_ndarray_ndims( arrays[ j ] ) ) {
+			return -1; // TODO: consider standardized error codes
+		}
+	}
+	// Determine whether we can avoid iteration altogether...
+	if ( ndims == 0 ) {
+		obj->functions[ 0 ]( arrays, fcn );
+		return 0;
+	}
+	sh = stdlib_ndarray_shape( arrays[ 0 ] );
+
+	// Verify that the input and output arrays have the same dimensions...
+	len = 1; // number of elements
+	ns = 0;  // number of singleton dimensions
+	for ( i = 0; i < ndims; i++ ) {
+		d = sh[ i ];
+		for ( j = 1; j < NARRAYS; j++ ) {
+			if ( d != stdlib_ndarray_shape( arrays[ j ] )[ i ] ) {
+				return -1; // TODO: consider standardized error codes
+			}
+		}
+		// Note that, if one of the dimensions is `0`, the length will be `0`...
+		len *= d;
+
+		// Check whether the current dimension is a singleton dimension...
+		if ( d == 1 ) {
+			ns += 1;
+		}
+	}
+	// Check whether we were provided empty ndarrays...
+	if ( len == 0 ) {
+		return 0;
+	}
+	// Determine whether the ndarrays are one-dimensional and thus readily translate to one-dimensional strided arrays...
+	if ( ndims == 1 ) {
+		obj->functions[ 1 ]( arrays, fcn );
+		return 0;
+	}
+	// Determine whether the ndarrays have only **one** non-singleton dimension (e.g., ndims=4, shape=[10,1,1,1]) so that we can treat the ndarrays as being equivalent to one-dimensional strided arrays...
+	if ( ns == ndims-1 ) {
+		// Get the index of the non-singleton dimension...
+		for ( i = 0; i < ndims; i++ ) {
+			if ( sh[ i ] != 1 ) {
+				break;
+			}
+		}
+		for ( j = 0; j < NARRAYS; j++ ) {
+			strides[ j ] = stdlib_ndarray_strides( arrays[ j ] )[ i ];
+			offsets[ j ] = stdlib_ndarray_offset( arrays[ j ] );
+		}
+		// Remove the singleton dimensions and apply the ternary function...
+		status = stdlib_ndarray_ternary_1d_view( obj->functions[ 1 ], arrays, sh[ i ], strides, offsets, fcn );
+		if ( status == 0 ) {
+			return 0;
+		}
+		// If we failed, this is probably due to failed memory allocation, so fall through and try again...
+	}
+	// Determine whether all ndarrays share the same iteration order and memory layout...
+	ord = stdlib_ndarray_order( arrays[ 0 ] );
+	for ( j = 0; j < NARRAYS; j++ ) {
+		io[ j ] = stdlib_ndarray_iteration_order( ndims, stdlib_ndarray_strides( arrays[ j ] ) ); // +/-1
+		if ( io[ j ] == 0 || stdlib_ndarray_order( arrays[ j ] ) != ord ) {
+			break;
+		}
+	}
+	// Determine whether we can avoid blocked iteration...
+	if ( j == NARRAYS ) {
+		// Determine whether we can ignore shape (and strides) and treat the ndarrays as linear one-dimensional strided arrays...
+		for ( j = 0; j < NARRAYS; j++ ) {
+			x = arrays[ j ];
+			sx = stdlib_ndarray_strides( x );
+
+			// Determine the minimum and maximum linear byte indices which are accessible by the array view:
+			mib = stdlib_ndarray_offset( x ); // byte offset
+			mab = mib;
+			for ( i = 0; i < ndims; i++ ) {
+				s = sx[ i ]; // units: bytes
+				if ( s > 0 ) {
+					mab += s * ( sh[i]-1 );
+				} else if ( s < 0 ) {
+					mib += s * ( sh[i]-1 ); // decrements
+				}
+			}
+			bp = stdlib_ndarray_bytes_per_element( stdlib_ndarray_dtype( x ) );
+
+			// Note: the following is equivalent to @stdlib/ndarray/base/assert/is-contiguous, but in-lined so we can retain computed values...
+			if ( ( len*bp ) != ( mab-mib+bp ) ) {
+				break;
+			}
+			strides[ j ] = io[ j ] * bp;
+			offsets[ j ] = ( io[ j ] == 1 ) ? mib : mab;
+		}
+		if ( j == NARRAYS ) {
+			status = stdlib_ndarray_ternary_1d_view( obj->functions[ 1 ], arrays, len, strides, offsets, fcn );
+			if ( status == 0 ) {
+				return 0;
+			}
+			// If we failed, this is probably due to failed memory allocation, so fall through and try again...
+		}
+		// At least one ndarray is non-contiguous, so we cannot directly use one-dimensional array functionality...
+
+		// Determine whether we can use simple nested loops...
+		if ( ndims < (obj->nfunctions) ) {
+			// So long as iteration for each respective array always moves in the same direction (i.e., no mixed sign strides), we can leverage cache-optimal (i.e., normal) nested loops without resorting to blocked iteration...
+			obj->functions[ ndims ]( arrays, fcn );
+			return 0;
+		}
+		// Fall-through to blocked iteration...
+	}
+	// At this point, we're either dealing with non-contiguous n-dimensional arrays, high dimensional n-dimensional arrays, and/or arrays having differing memory layouts, so our only hope is that we can still perform blocked iteration...
+
+	// Determine whether we can perform blocked iteration...
+	if ( ndims <= (obj->nblockedfunctions)+1 ) {
+		obj->blocked_functions[ ndims-2 ]( arrays, fcn );
+		return 0;
+	}
+	// Fall-through to linear view iteration without regard for how data is stored in memory (i.e., take the slow path)...
+	obj->functions[ (obj->nfunctions)-1 ]( arrays, fcn );
+
+	return 0;
+}
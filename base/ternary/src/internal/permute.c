@@ -1,7 +1,7 @@
 /**
 * @license Apache-2.0
 *
-* Copyright (c) 2021 The Stdlib Authors.
+* Copyright (c) 2026 The Stdlib Authors.
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -16,18 +16,20 @@
 * limitations under the License.
 */
 
-#include "stdlib/ndarray/base/unary/internal/range.h"
+#include "stdlib/ndarray/base/ternary/internal/permute.h"
 #include <stdint.h>
 
 /**
-* Writes `n` evenly spaced values from `0` to `n-1` to an output array.
+* Permutes an input array according to a provided index array.
 *
-* @param n    number of values to write
+* @param n    number of elements to permute
+* @param arr  input array
+* @param idx  permutation indices
 * @param out  output array
 */
-void stdlib_ndarray_base_unary_internal_range( const int64_t n, int64_t *out ) {
+void stdlib_ndarray_base_ternary_internal_permute( const int64_t n, const int64_t *arr, const int64_t *idx, int64_t *out ) {
 	int64_t i;
 	for ( i = 0; i < n; i++ ) {
-		out[ i ] = i;
+		out[ i ] = arr[ idx[i] ];
 	}
 }
@@ -116,3 +116,37 @@ tape( 'the function applies a ternary callback to indexed elements of three 1-di
 	t.strictEqual( isSameComplex128Array( getData( w ), expected ), true, 'returns expected value' );
 	t.end();
 });
+
+tape( 'the function applies a ternary callback to indexed elements of three 1-dimensional ndarrays (broadcasted)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+	var w;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( [ 10.0 ] ), [ 4 ], [ 0 ], 0, 'row-major' );
+	z = ndarray( 'float64', new Float64Array( [ 100.0 ] ), [ 4 ], [ 0 ], 0, 'row-major' );
+	w = ndarray( 'float64', zeros( 4, 'float64' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	ternary( [ x, y, z, w ], add3 );
+
+	expected = new Float64Array([
+		111.0,
+		112.0,
+		113.0,
+		114.0
+	]);
+	t.strictEqual( isSameFloat64Array( getData( w ), expected ), true, 'returns expected value' );
+
+	w = ndarray( 'float64', zeros( 4, 'float64' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	ternary( [ y, x, z, w ], add3 );
+	t.strictEqual( isSameFloat64Array( getData( w ), expected ), true, 'returns expected value' );
+
+	w = ndarray( 'float64', zeros( 4, 'float64' ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	ternary( [ y, z, x, w ], add3 );
+	t.strictEqual( isSameFloat64Array( getData( w ), expected ), true, 'returns expected value' );
+	t.end();
+});
@@ -1054,3 +1054,65 @@ tape( 'the function applies a ternary callback to indexed elements of three 2-di
 	t.strictEqual( isSameComplex128Array( getData( y ), expected ), true, 'returns expected value' );
 	t.end();
 });
+
+tape( 'the function applies a ternary callback to indexed elements of three 2-dimensional ndarrays (row-major, broadcasted)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+	var w;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	// Broadcasted column and row vectors:
+	y = ndarray( 'float64', new Float64Array( [ 10.0, 20.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	z = ndarray( 'float64', new Float64Array( [ 100.0, 200.0, 300.0 ] ), [ 2, 3 ], [ 0, 1 ], 0, 'row-major' );
+	w = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	ternary( [ x, y, z, w ], add3 );
+
+	expected = new Float64Array( [ 111.0, 212.0, 313.0, 124.0, 225.0, 326.0 ] );
+	t.strictEqual( isSameFloat64Array( getData( w ), expected ), true, 'returns expected value' );
+
+	// Two broadcasted column vectors:
+	z = ndarray( 'float64', new Float64Array( [ 100.0, 200.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	w = ndarray( 'float64', zeros( 6, 'float64' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	ternary( [ y, x, z, w ], add3 );
+
+	expected = new Float64Array( [ 111.0, 112.0, 113.0, 224.0, 225.0, 226.0 ] );
+	t.strictEqual( isSameFloat64Array( getData( w ), expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function applies a ternary callback to indexed elements of three 2-dimensional ndarrays (row-major, broadcasted, accessors)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+	var z;
+	var w;
+
+	x = ndarray( 'complex128', new Complex128Array( oneTo( 12, 'float64' ) ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = ndarray( 'complex128', new Complex128Array( [ 10.0, 10.0, 20.0, 20.0 ] ), [ 2, 3 ], [ 1, 0 ], 0, 'row-major' );
+	z = ndarray( 'complex128', new Complex128Array( [ 100.0, 100.0 ] ), [ 2, 3 ], [ 0, 0 ], 0, 'row-major' );
+	w = ndarray( 'complex128', zeros( 6, 'complex128' ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	ternary( [ x, y, z, w ], zadd3 );
+
+	expected = new Complex128Array([
+		111.0,
+		112.0,
+		113.0,
+		114.0,
+		115.0,
+		116.0,
+		127.0,
+		128.0,
+		129.0,
+		130.0,
+		131.0,
+		132.0
+	]);
+	t.strictEqual( isSameComplex128Array( getData( w ), expected ), true, 'returns expected value' );
+	t.end();
+});
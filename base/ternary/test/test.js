@@ -23,6 +23,8 @@
 // MODULES //
 
 var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var zeroTo = require( '@stdlib/array/base/zero-to' );
 var ndarray = require( './../../../ctor' );
 var zeros = require( '@stdlib/array/zeros' );
 var ones = require( '@stdlib/array/ones' );
@@ -32,6 +34,46 @@ var numel = require( './../../../base/numel' );
 var ternary = require( './../lib' );
 
 
+// FUNCTIONS //
+
+/**
+* Tests whether each element of the output ndarray in a list of three-dimensional ndarrays equals the result of applying a callback to the corresponding input ndarray elements.
+*
+* @private
+* @param {ArrayLikeObject<ndarray>} arrays - input ndarrays followed by an output ndarray
+* @param {Function} fcn - callback
+* @returns {boolean} boolean indicating whether the output ndarray contains the expected values
+*/
+function isExpected( arrays, fcn ) {
+	var args;
+	var out;
+	var sh;
+	var N;
+	var i;
+	var j;
+	var k;
+	var m;
+
+	N = arrays.length - 1;
+	out = arrays[ N ];
+	sh = out.shape;
+	args = [];
+	for ( i = 0; i < sh[ 0 ]; i++ ) {
+		for ( j = 0; j < sh[ 1 ]; j++ ) {
+			for ( k = 0; k < sh[ 2 ]; k++ ) {
+				for ( m = 0; m < N; m++ ) {
+					args[ m ] = arrays[ m ].get( i, j, k );
+				}
+				if ( out.get( i, j, k ) !== fcn.apply( null, args ) ) {
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+
 // TESTS //
 
 tape( 'main export is a function', function test( t ) {
@@ -161,3 +203,72 @@ tape( 'the function throws an error if provided input and output ndarrays which
 		};
 	}
 });
+
+tape( 'the function applies a ternary callback to each indexed element of 3-dimensional ndarrays (row-major, partially contiguous views)', function test( t ) {
+	var arrays;
+	var x;
+	var y;
+	var z;
+	var w;
+
+	// Define a view containing every other row of a row-major 200x3x1000 ndarray:
+	x = ndarray( 'float64', new Float64Array( zeroTo( 600000 ) ), [ 100, 3, 1000 ], [ 6000, 1000, 1 ], 0, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( zeroTo( 300000 ) ), [ 100, 3, 1000 ], [ 3000, 1000, 1 ], 0, 'row-major' );
+	z = ndarray( 'float64', new Float64Array( zeroTo( 300000 ) ), [ 100, 3, 1000 ], [ 3000, 1000, 1 ], 0, 'row-major' );
+	w = ndarray( 'float64', new Float64Array( 300000 ), [ 100, 3, 1000 ], [ 3000, 1000, 1 ], 0, 'row-major' );
+	arrays = [ x, y, z, w ];
+
+	ternary( arrays, fcn );
+	t.strictEqual( isExpected( arrays, fcn ), true, 'returns expected value' );
+	t.end();
+
+	function fcn( x, y, z ) {
+		return ( x * y ) + z;
+	}
+});
+
+tape( 'the function applies a ternary callback to each indexed element of 3-dimensional ndarrays (column-major, partially contiguous views)', function test( t ) {
+	var arrays;
+	var x;
+	var y;
+	var z;
+	var w;
+
+	// Define a view containing every other matrix of a column-major 4x3x10 ndarray:
+	x = ndarray( 'float64', new Float64Array( zeroTo( 120 ) ), [ 4, 3, 5 ], [ 1, 4, 24 ], 0, 'column-major' );
+	y = ndarray( 'float64', new Float64Array( zeroTo( 60 ) ), [ 4, 3, 5 ], [ 1, 4, 12 ], 0, 'column-major' );
+	z = ndarray( 'float64', new Float64Array( zeroTo( 60 ) ), [ 4, 3, 5 ], [ 1, 4, 12 ], 0, 'column-major' );
+	w = ndarray( 'float64', new Float64Array( 60 ), [ 4, 3, 5 ], [ 1, 4, 12 ], 0, 'column-major' );
+	arrays = [ x, y, z, w ];
+
+	ternary( arrays, fcn );
+	t.strictEqual( isExpected( arrays, fcn ), true, 'returns expected value' );
+	t.end();
+
+	function fcn( x, y, z ) {
+		return ( x * y ) + z;
+	}
+});
+
+tape( 'the function applies a ternary callback to each indexed element of 3-dimensional ndarrays (negative strides)', function test( t ) {
+	var arrays;
+	var x;
+	var y;
+	var z;
+	var w;
+
+	// Define a view which is reversed along every dimension:
+	x = ndarray( 'float64', new Float64Array( zeroTo( 24 ) ), [ 2, 3, 4 ], [ -12, -4, -1 ], 23, 'row-major' );
+	y = ndarray( 'float64', new Float64Array( zeroTo( 24 ) ), [ 2, 3, 4 ], [ 12, 4, 1 ], 0, 'row-major' );
+	z = ndarray( 'float64', new Float64Array( zeroTo( 24 ) ), [ 2, 3, 4 ], [ 12, 4, 1 ], 0, 'row-major' );
+	w = ndarray( 'float64', new Float64Array( 24 ), [ 2, 3, 4 ], [ -12, -4, -1 ], 23, 'row-major' );
+	arrays = [ x, y, z, w ];
+
+	ternary( arrays, fcn );
+	t.strictEqual( isExpected( arrays, fcn ), true, 'returns expected value' );
+	t.end();
+
+	function fcn( x, y, z ) {
+		return ( x * y ) + z;
+	}
+});
@@ -23,6 +23,20 @@
 import { ArrayLike } from '@stdlib/types/array';
 import { ndarray } from '@stdlib/types/ndarray';
 
+/**
+* Interface describing a buffer pool.
+*/
+interface BufferPool {
+	/**
+	* Returns a uninitialized data buffer having a specified data type and length.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*/
+	malloc( dtype: any, size: number ): any;
+}
+
 /**
 * Returns an ndarray created by repeating the elements of an input ndarray a specified number of times along each dimension.
 *
@@ -30,9 +44,11 @@ import { ndarray } from '@stdlib/types/ndarray';
 *
 * -   The number of repetitions must have at least as many elements as the number of input dimensions. When the number of repetitions exceeds the number of input dimensions, the input array is treated as if singleton dimensions were prepended.
 * -   The function always copies data to a new ndarray.
+* -   When provided a buffer pool, the function allocates the output data buffer from the pool. The caller owns the returned ndarray and is responsible for releasing its data buffer back to the pool once the ndarray is no longer needed.
 *
 * @param x - input array
 * @param reps - number of repetitions along each dimension
+* @param pool - buffer pool from which to allocate the output data buffer
 * @returns output array
 *
 * @example
@@ -44,7 +60,7 @@ import { ndarray } from '@stdlib/types/ndarray';
 * var y = tile( x, [ 2, 2 ] );
 * // returns <ndarray>[ [ 1, 2, 1, 2 ], [ 3, 4, 3, 4 ], [ 1, 2, 1, 2 ], [ 3, 4, 3, 4 ] ]
 */
-declare function tile<T extends ndarray = ndarray>( x: T, reps: ArrayLike<number> ): T;
+declare function tile<T extends ndarray = ndarray>( x: T, reps: ArrayLike<number>, pool?: BufferPool ): T;
 
 
 // EXPORTS //
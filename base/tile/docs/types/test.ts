@@ -70,6 +70,20 @@ import tile = require( './index' );
 	tile( x, ( x: number ): number => x ); // $ExpectError
 }
 
+// The compiler throws an error if the function is provided a third argument which is not a buffer pool...
+{
+	const x = zeros( [ 2, 2 ], {
+		'dtype': 'float64'
+	});
+
+	tile( x, [ 2, 2 ], '5' ); // $ExpectError
+	tile( x, [ 2, 2 ], 5 ); // $ExpectError
+	tile( x, [ 2, 2 ], true ); // $ExpectError
+	tile( x, [ 2, 2 ], false ); // $ExpectError
+	tile( x, [ 2, 2 ], {} ); // $ExpectError
+	tile( x, [ 2, 2 ], [ '5' ] ); // $ExpectError
+}
+
 // The compiler throws an error if the function is provided an unsupported number of arguments...
 {
 	const x = zeros( [ 2, 2 ], {
@@ -78,5 +92,5 @@ import tile = require( './index' );
 
 	tile(); // $ExpectError
 	tile( x ); // $ExpectError
-	tile( x, [ 1, 2, 3 ], [ 2, 3 ] ); // $ExpectError
+	tile( x, [ 1, 2, 3 ], {}, {} ); // $ExpectError
 }
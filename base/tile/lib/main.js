@@ -32,8 +32,14 @@ var getOffset = require( './../../../base/offset' );
 var getOrder = require( './../../../base/order' );
 var getDType = require( './../../../base/dtype' );
 var getData = require( './../../../base/data-buffer' );
+var isAccessorArray = require( '@stdlib/array/base/assert/is-accessor-array' );
+var isComplexArray = require( '@stdlib/array/base/assert/is-complex-typed-array' );
+var isBooleanArray = require( '@stdlib/array/base/assert/is-booleanarray' );
+var reinterpretComplex = require( '@stdlib/strided/base/reinterpret-complex' );
+var reinterpretBoolean = require( '@stdlib/strided/base/reinterpret-boolean' );
 var zeros = require( '@stdlib/array/base/zeros' );
 var format = require( '@stdlib/string/format' );
+var replicate = require( './replicate.js' );
 
 
 // MAIN //
@@ -45,9 +51,12 @@ var format = require( '@stdlib/string/format' );
 *
 * -   The number of repetitions must have at least as many elements as the number of input dimensions. When the number of repetitions exceeds the number of input dimensions, the input array is treated as if singleton dimensions were prepended.
 * -   The function always copies data to a new ndarray.
+* -   When provided a buffer pool, the function allocates the output data buffer from the pool. The caller owns the returned ndarray and is responsible for releasing its data buffer back to the pool once the ndarray is no longer needed.
+* -   When the output data buffer is not an accessor array, the function copies the input ndarray into the first output tile and then replicates that tile along each dimension by repeatedly doubling the number of copied elements. Otherwise, the function assigns the input ndarray to a strided view of the output ndarray spanning every repetition.
 *
 * @param {ndarray} x - input array
 * @param {NonNegativeIntegerArray} reps - number of repetitions along each dimension
+* @param {Object} [pool] - buffer pool from which to allocate the output data buffer
 * @throws {RangeError} second argument must have at least as many elements as the number of input dimensions
 * @returns {ndarray} output array
 *
@@ -60,18 +69,22 @@ var format = require( '@stdlib/string/format' );
 * var y = tile( x, [ 2, 2 ] );
 * // returns <ndarray>[ [ 1, 2, 1, 2 ], [ 3, 4, 3, 4 ], [ 1, 2, 1, 2 ], [ 3, 4, 3, 4 ] ]
 */
-function tile( x, reps ) {
+function tile( x, reps, pool ) {
 	var dtype;
 	var order;
+	var scale;
+	var raw;
 	var shx;
 	var sho;
 	var shi;
+	var shp;
 	var sto;
 	var buf;
 	var len;
 	var out;
 	var Ds;
 	var si;
+	var sp;
 	var sx;
 	var v1;
 	var v2;
@@ -109,12 +122,16 @@ function tile( x, reps ) {
 	shi = zeros( 2*N );
 	si = zeros( 2*N );
 	sho = zeros( N );
+	shp = zeros( N );
+	sp = zeros( N );
 	for ( i = 0; i < N; i++ ) {
 		j = i - Ds;
 		k = 2 * i;
 		s = ( j < 0 ) ? 1 : shx[ j ];
 		t = ( j < 0 ) ? 0 : sx[ j ];
 		sho[ i ] = reps[ i ] * s;
+		shp[ i ] = s;
+		sp[ i ] = t;
 		if ( order === 'row-major' ) {
 			shi[ k ] = reps[ i ];
 			shi[ k+1 ] = s;
@@ -133,9 +150,34 @@ function tile( x, reps ) {
 		sto = [ 0 ];
 	}
 	// Allocate an output array:
-	buf = buffer( dtype, len );
+	if ( pool ) {
+		buf = pool.malloc( dtype, len );
+	} else {
+		buf = buffer( dtype, len );
+	}
 	out = new x.constructor( dtype, buf, sho, sto, 0, order );
 
+	// Resolve a view of the output data buffer which supports indexed block copies...
+	raw = null;
+	scale = 1;
+	if ( isComplexArray( buf ) ) {
+		raw = reinterpretComplex( buf, 0 );
+		scale = 2;
+	} else if ( isBooleanArray( buf ) ) {
+		raw = reinterpretBoolean( buf, 0 );
+	} else if ( !isAccessorArray( buf ) ) {
+		raw = buf;
+	}
+	if ( raw && N > 0 && len > 0 ) {
+		// Copy the input array to the first tile of the output array:
+		v1 = ndarray( dtype, getData( x ), shp, sp, getOffset( x ), order );
+		v2 = ndarray( dtype, buf, shp, sto, 0, order );
+		assign( [ v1, v2 ] );
+
+		// Replicate the first tile along each dimension:
+		replicate( raw, shp, reps, sto, order, scale );
+		return out;
+	}
 	// Create a "broadcasted" input 2N-D view over the data buffers:
 	v1 = ndarray( dtype, getData( x ), shi, si, getOffset( x ), order );
 	v2 = ndarray( dtype, buf, shi, shape2strides( shi, order ), 0, order );
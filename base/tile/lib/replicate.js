@@ -0,0 +1,160 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isArray = require( '@stdlib/assert/is-array' );
+var min = require( '@stdlib/math/base/special/min' );
+
+
+// FUNCTIONS //
+
+/**
+* Copies a contiguous sequence of elements within a generic array.
+*
+* ## Notes
+*
+* -   Generic arrays are not guaranteed to support `copyWithin` (ES2015), so the function copies elements one at a time. As the source range always precedes the destination range and the two ranges never overlap, a forward copy is safe.
+*
+* @private
+* @param {Array} buf - data buffer
+* @param {NonNegativeInteger} target - index at which to begin writing elements
+* @param {NonNegativeInteger} start - index of the first element to copy
+* @param {NonNegativeInteger} end - index of the last element to copy (exclusive)
+*/
+function copyWithin( buf, target, start, end ) {
+	var i;
+	for ( i = start; i < end; i++ ) {
+		buf[ target ] = buf[ i ];
+		target += 1;
+	}
+}
+
+/**
+* Replicates a contiguous block of elements a specified number of times by repeatedly doubling the number of copied elements.
+*
+* ## Notes
+*
+* -   The function first copies the block once, then copies the two resulting blocks, then the four resulting blocks, and so on, thus requiring `O(log(n))` block copies.
+*
+* @private
+* @param {(Array|TypedArray)} buf - data buffer
+* @param {NonNegativeInteger} offset - index of the first element in the block
+* @param {PositiveInteger} len - number of elements in the block
+* @param {PositiveInteger} reps - number of repetitions
+*/
+function double( buf, offset, len, reps ) {
+	var generic;
+	var total;
+	var n;
+	var c;
+
+	generic = isArray( buf );
+	total = len * reps;
+	n = len;
+	while ( n < total ) {
+		c = min( n, total-n );
+		if ( generic ) {
+			copyWithin( buf, offset+n, offset, offset+c );
+		} else {
+			buf.copyWithin( offset+n, offset, offset+c );
+		}
+		n += c;
+	}
+}
+
+
+// MAIN //
+
+/**
+* Replicates the first tile of a contiguous output buffer along each dimension.
+*
+* ## Notes
+*
+* -   The function assumes that the output buffer already contains the elements of the tile corresponding to the first repetition along every dimension.
+* -   The function processes dimensions from the fastest varying dimension to the slowest varying dimension. After processing a dimension, the elements spanned by that dimension and all faster varying dimensions are contiguous in memory, and replicating along the next dimension thus amounts to replicating contiguous blocks.
+*
+* @private
+* @param {(Array|TypedArray)} buf - output data buffer
+* @param {NonNegativeIntegerArray} shape - (padded) input array shape
+* @param {NonNegativeIntegerArray} reps - number of repetitions along each dimension
+* @param {IntegerArray} strides - output array strides
+* @param {string} order - output array memory layout
+* @param {PositiveInteger} scale - number of buffer elements per array element
+* @returns {(Array|TypedArray)} output data buffer
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+*
+* var buf = new Float64Array( [ 1.0, 2.0, 0.0, 0.0, 3.0, 4.0, 0.0, 0.0 ] );
+*
+* replicate( buf, [ 1, 2 ], [ 2, 2 ], [ 4, 1 ], 'row-major', 1 );
+* // buf => <Float64Array>[ 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0 ]
+*/
+function replicate( buf, shape, reps, strides, order, scale ) {
+	var offset;
+	var len;
+	var inc;
+	var N;
+	var M;
+	var d;
+	var i;
+	var j;
+	var k;
+	var n;
+
+	N = shape.length;
+	for ( n = 0; n < N; n++ ) {
+		// Resolve the dimension to process, proceeding from the fastest varying dimension:
+		d = ( order === 'row-major' ) ? N-n-1 : n;
+		if ( reps[ d ] === 1 ) {
+			continue;
+		}
+		// Compute the number of (contiguous) buffer elements spanned by the already populated portion of the current dimension:
+		len = shape[ d ] * strides[ d ] * scale;
+
+		// Compute the number of blocks to replicate, which is equal to the number of populated positions along slower varying dimensions:
+		M = 1;
+		for ( j = 0; j < N; j++ ) {
+			if ( ( order === 'row-major' && j < d ) || ( order === 'column-major' && j > d ) ) {
+				M *= shape[ j ];
+			}
+		}
+		for ( i = 0; i < M; i++ ) {
+			// Resolve the index of the first element of the current block:
+			offset = 0;
+			k = i;
+			for ( j = 0; j < N; j++ ) {
+				if ( ( order === 'row-major' && j < d ) || ( order === 'column-major' && j > d ) ) {
+					inc = k % shape[ j ];
+					k = ( k/shape[ j ] )|0;
+					offset += inc * strides[ j ];
+				}
+			}
+			double( buf, offset*scale, len, reps[ d ] );
+		}
+	}
+	return buf;
+}
+
+
+// EXPORTS //
+
+module.exports = replicate;
@@ -21,6 +21,10 @@
 // MODULES //
 
 var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var BooleanArray = require( '@stdlib/array/bool' );
+var isSameComplex128Array = require( '@stdlib/assert/is-same-complex128array' );
 var array = require( './../../../array' );
 var ndarray = require( './../../../ctor' );
 var base = require( './../../../base/ctor' );
@@ -29,9 +33,15 @@ var ndarray2array = require( './../../../to-array' );
 var getShape = require( './../../../shape' );
 var getData = require( './../../../data-buffer' );
 var numel = require( './../../../base/numel' );
+var bufferPool = require( './../../../base/buffer-pool' );
 var tile = require( './../lib' );
 
 
+// VARIABLES //
+
+var copyWithin = Array.prototype.copyWithin;
+
+
 // TESTS //
 
 tape( 'main export is a function', function test( t ) {
@@ -642,3 +652,141 @@ tape( 'the function returns an empty ndarray when a repetition is zero (non-base
 
 	t.end();
 });
+
+tape( 'the function tiles an input array using a number of repetitions which is not a power of two (row-major)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = base( 'float64', new Float64Array( [ 1.0, 2.0 ] ), [ 1, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = tile( x, [ 3, 5 ] );
+
+	expected = [
+		[ 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0 ],
+		[ 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0 ],
+		[ 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0 ]
+	];
+	t.deepEqual( getShape( y ), [ 3, 10 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function tiles an input array using a number of repetitions which is not a power of two (column-major)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = base( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+	y = tile( x, [ 3, 1, 1 ] );
+
+	expected = [
+		[ [ 1.0, 3.0 ], [ 2.0, 4.0 ] ],
+		[ [ 1.0, 3.0 ], [ 2.0, 4.0 ] ],
+		[ [ 1.0, 3.0 ], [ 2.0, 4.0 ] ]
+	];
+	t.deepEqual( getShape( y ), [ 3, 2, 2 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), expected, 'returns expected value' );
+
+	y = tile( x, [ 1, 3 ] );
+
+	expected = [
+		[ 1.0, 3.0, 1.0, 3.0, 1.0, 3.0 ],
+		[ 2.0, 4.0, 2.0, 4.0, 2.0, 4.0 ]
+	];
+	t.deepEqual( getShape( y ), [ 2, 6 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function tiles an input array (complex128)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = base( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	y = tile( x, [ 3 ] );
+
+	expected = new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 1.0, 2.0, 3.0, 4.0, 1.0, 2.0, 3.0, 4.0 ] );
+	t.deepEqual( getShape( y ), [ 6 ], 'returns expected value' );
+	t.strictEqual( isSameComplex128Array( getData( y ), expected ), true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function tiles an input array (bool)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = base( 'bool', new BooleanArray( [ true, false ] ), [ 2, 1 ], [ 1, 1 ], 0, 'row-major' );
+	y = tile( x, [ 2, 3 ] );
+
+	expected = [
+		[ true, true, true ],
+		[ false, false, false ],
+		[ true, true, true ],
+		[ false, false, false ]
+	];
+	t.deepEqual( getShape( y ), [ 4, 3 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports allocating the output data buffer from a buffer pool', function test( t ) {
+	var expected;
+	var pool;
+	var buf;
+	var x;
+	var y;
+
+	pool = bufferPool();
+	buf = pool.malloc( 'float64', 8 );
+	pool.free( buf );
+
+	x = base( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = tile( x, [ 1, 2 ], pool );
+
+	expected = [
+		[ 1.0, 2.0, 1.0, 2.0 ],
+		[ 3.0, 4.0, 3.0, 4.0 ]
+	];
+	t.strictEqual( getData( y ).buffer, buf.buffer, 'returns expected value' );
+	t.strictEqual( pool.stats().hits, 1, 'returns expected value' );
+	t.deepEqual( getShape( y ), [ 2, 4 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function tiles an input array (generic, no `copyWithin` support)', function test( t ) {
+	var expected;
+	var buf;
+	var x;
+	var y;
+
+	buf = [ 1, 2, 3 ];
+	x = base( 'generic', buf, [ 3 ], [ 1 ], 0, 'row-major' );
+
+	// Simulate an environment lacking ES2015 array methods:
+	Array.prototype.copyWithin = throws; // eslint-disable-line no-extend-native
+	try {
+		y = tile( x, [ 2, 3 ] );
+	} finally {
+		Array.prototype.copyWithin = copyWithin; // eslint-disable-line no-extend-native
+	}
+	expected = [
+		[ 1, 2, 3, 1, 2, 3, 1, 2, 3 ],
+		[ 1, 2, 3, 1, 2, 3, 1, 2, 3 ]
+	];
+	t.deepEqual( getShape( y ), [ 2, 9 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), expected, 'returns expected value' );
+
+	t.end();
+
+	function throws() {
+		throw new Error( 'unexpected call' );
+	}
+});
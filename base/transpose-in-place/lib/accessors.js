@@ -0,0 +1,95 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var min = require( '@stdlib/math/base/special/min' );
+
+
+// VARIABLES //
+
+// Block size (in units of elements) for swapping tiles across the main diagonal:
+var BLOCK_SIZE = 64|0;
+
+
+// MAIN //
+
+/**
+* Transposes a square matrix in-place when the underlying data buffer is an accessor array.
+*
+* @private
+* @param {Collection} buf - data buffer
+* @param {Array<Function>} accessors - array element accessors
+* @param {NonNegativeInteger} N - number of rows (and columns)
+* @param {integer} s0 - stride of the first dimension
+* @param {integer} s1 - stride of the second dimension
+* @param {NonNegativeInteger} offset - index of the first matrix element
+* @returns {Collection} data buffer
+*
+* @example
+* var Complex64Array = require( '@stdlib/array/complex64' );
+* var accessors = require( '@stdlib/array/base/accessors' );
+*
+* var buf = new Complex64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 ] );
+*
+* transpose( buf, accessors( buf ).accessors, 2, 2, 1, 0 );
+* // buf => <Complex64Array>[ 1.0, 2.0, 5.0, 6.0, 3.0, 4.0, 7.0, 8.0 ]
+*/
+function transpose( buf, accessors, N, s0, s1, offset ) {
+	var get;
+	var set;
+	var tmp;
+	var bi;
+	var bj;
+	var mi;
+	var mj;
+	var ia;
+	var ib;
+	var j0;
+	var i;
+	var j;
+
+	get = accessors[ 0 ];
+	set = accessors[ 1 ];
+	for ( bi = 0; bi < N; bi += BLOCK_SIZE ) {
+		mi = min( bi+BLOCK_SIZE, N );
+		for ( bj = bi; bj < N; bj += BLOCK_SIZE ) {
+			mj = min( bj+BLOCK_SIZE, N );
+			for ( i = bi; i < mi; i++ ) {
+				j0 = ( bi === bj ) ? i+1 : bj;
+				ia = offset + ( i*s0 ) + ( j0*s1 );
+				ib = offset + ( j0*s0 ) + ( i*s1 );
+				for ( j = j0; j < mj; j++ ) {
+					tmp = get( buf, ia );
+					set( buf, ia, get( buf, ib ) );
+					set( buf, ib, tmp );
+					ia += s1;
+					ib += s0;
+				}
+			}
+		}
+	}
+	return buf;
+}
+
+
+// EXPORTS //
+
+module.exports = transpose;
@@ -0,0 +1,95 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var min = require( '@stdlib/math/base/special/min' );
+
+
+// VARIABLES //
+
+// Block size (in units of elements) for swapping tiles across the main diagonal:
+var BLOCK_SIZE = 64|0; // a 64x64 float64 tile spans 32kB
+
+
+// MAIN //
+
+/**
+* Transposes a square matrix in-place.
+*
+* ## Notes
+*
+* -   The function swaps pairs of tiles located symmetrically about the main diagonal, thus ensuring that both the rows being read and the columns being written remain resident in cache.
+*
+* @private
+* @param {Collection} buf - data buffer
+* @param {NonNegativeInteger} N - number of rows (and columns)
+* @param {integer} s0 - stride of the first dimension
+* @param {integer} s1 - stride of the second dimension
+* @param {NonNegativeInteger} offset - index of the first matrix element
+* @returns {Collection} data buffer
+*
+* @example
+* var Float64Array = require( '@stdlib/array/float64' );
+*
+* var buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+*
+* transpose( buf, 2, 2, 1, 0 );
+* // buf => <Float64Array>[ 1.0, 3.0, 2.0, 4.0 ]
+*/
+function transpose( buf, N, s0, s1, offset ) {
+	var tmp;
+	var bi;
+	var bj;
+	var mi;
+	var mj;
+	var ia;
+	var ib;
+	var j0;
+	var i;
+	var j;
+
+	for ( bi = 0; bi < N; bi += BLOCK_SIZE ) {
+		mi = min( bi+BLOCK_SIZE, N );
+		for ( bj = bi; bj < N; bj += BLOCK_SIZE ) {
+			mj = min( bj+BLOCK_SIZE, N );
+			for ( i = bi; i < mi; i++ ) {
+				// Only visit elements above the main diagonal when swapping within a diagonal tile:
+				j0 = ( bi === bj ) ? i+1 : bj;
+
+				ia = offset + ( i*s0 ) + ( j0*s1 ); // A[i,j]
+				ib = offset + ( j0*s0 ) + ( i*s1 ); // A[j,i]
+				for ( j = j0; j < mj; j++ ) {
+					tmp = buf[ ia ];
+					buf[ ia ] = buf[ ib ];
+					buf[ ib ] = tmp;
+					ia += s1;
+					ib += s0;
+				}
+			}
+		}
+	}
+	return buf;
+}
+
+
+// EXPORTS //
+
+module.exports = transpose;
@@ -0,0 +1,115 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var ndarraylike2object = require( './../../../base/ndarraylike2object' );
+var format = require( '@stdlib/string/format' );
+var accessors = require( './accessors.js' );
+var base = require( './base.js' );
+
+
+// MAIN //
+
+/**
+* Transposes a square matrix (or a stack of square matrices) in-place.
+*
+* ## Notes
+*
+* -   The function transposes the last two dimensions of the input ndarray.
+* -   The function swaps elements within the input ndarray's underlying data buffer and does not allocate a second buffer. Accordingly, the function requires that the last two dimensions have the same size.
+* -   The function assumes that distinct ndarray elements do not share memory (e.g., as may be the case for broadcasted ndarrays).
+* -   The function mutates the input ndarray in-place.
+*
+* @param {ndarray} x - input array
+* @throws {Error} must provide an ndarray having two or more dimensions
+* @throws {RangeError} last two dimensions must have the same size
+* @returns {ndarray} input ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1, 2, 3 ], [ 4, 5, 6 ], [ 7, 8, 9 ] ] );
+* // returns <ndarray>[ [ 1, 2, 3 ], [ 4, 5, 6 ], [ 7, 8, 9 ] ]
+*
+* var out = transposeInPlace( x );
+* // returns <ndarray>[ [ 1, 4, 7 ], [ 2, 5, 8 ], [ 3, 6, 9 ] ]
+*
+* var bool = ( out === x );
+* // returns true
+*/
+function transposeInPlace( x ) {
+	var offset;
+	var obj;
+	var buf;
+	var sh;
+	var st;
+	var s0;
+	var s1;
+	var N;
+	var M;
+	var d;
+	var i;
+	var j;
+	var k;
+
+	obj = ndarraylike2object( x );
+	sh = obj.shape;
+	d = sh.length;
+	if ( d < 2 ) {
+		throw new Error( 'invalid argument. Must provide an ndarray having two or more dimensions.' );
+	}
+	N = sh[ d-1 ];
+	if ( sh[ d-2 ] !== N ) {
+		throw new RangeError( format( 'invalid argument. The last two dimensions of the input ndarray must have the same size. Shape: [%s].', sh.join( ', ' ) ) );
+	}
+	if ( obj.length === 0 ) {
+		return x;
+	}
+	buf = obj.data;
+	st = obj.strides;
+	s0 = st[ d-2 ];
+	s1 = st[ d-1 ];
+
+	// Compute the number of matrices in the stack:
+	M = obj.length / ( N*N );
+
+	// Transpose each matrix in the stack...
+	for ( i = 0; i < M; i++ ) {
+		// Resolve the index of the first element of the current matrix:
+		offset = obj.offset;
+		k = i;
+		for ( j = d-3; j >= 0; j-- ) {
+			offset += ( k%sh[ j ] ) * st[ j ];
+			k = ( k/sh[ j ] )|0;
+		}
+		if ( obj.accessorProtocol ) {
+			accessors( buf, obj.accessors, N, s0, s1, offset );
+		} else {
+			base( buf, N, s0, s1, offset );
+		}
+	}
+	return x;
+}
+
+
+// EXPORTS //
+
+module.exports = transposeInPlace;
@@ -0,0 +1,226 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var isSameComplex128Array = require( '@stdlib/assert/is-same-complex128array' );
+var ndarray = require( './../../../base/ctor' );
+var ndarray2array = require( './../../../to-array' );
+var toTransposed = require( './../../../base/to-transposed' );
+var zeros = require( './../../../base/zeros' );
+var getData = require( './../../../data-buffer' );
+var transposeInPlace = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns an ndarray whose elements are filled with increasing values.
+*
+* @private
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {string} order - memory layout
+* @returns {ndarray} ndarray
+*/
+function linspace( shape, order ) {
+	var buf;
+	var x;
+	var i;
+
+	x = zeros( 'float64', shape, order );
+	buf = getData( x );
+	for ( i = 0; i < buf.length; i++ ) {
+		buf[ i ] = i;
+	}
+	return x;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof transposeInPlace, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided an input ndarray with fewer than two dimensions', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		new ndarray( 'float64', new Float64Array( [ 5.0 ] ), [], [ 0 ], 0, 'row-major' ),
+		new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0 ] ), [ 3 ], [ 1 ], 0, 'row-major' )
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), Error, 'throws an error when provided an input ndarray with '+values[ i ].ndims+' dimensions' );
+	}
+	t.end();
+
+	function badValue( x ) {
+		return function badValue() {
+			transposeInPlace( x );
+		};
+	}
+});
+
+tape( 'the function throws an error if the last two dimensions of the input ndarray do not have the same size', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		zeros( 'float64', [ 2, 3 ], 'row-major' ),
+		zeros( 'float64', [ 3, 2 ], 'column-major' ),
+		zeros( 'float64', [ 2, 2, 3 ], 'row-major' ),
+		zeros( 'float64', [ 3, 3, 1 ], 'row-major' )
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided an input ndarray having shape ['+values[ i ].shape.join( ',' )+']' );
+	}
+	t.end();
+
+	function badValue( x ) {
+		return function badValue() {
+			transposeInPlace( x );
+		};
+	}
+});
+
+tape( 'the function transposes a square matrix in-place (row-major)', function test( t ) {
+	var expected;
+	var buf;
+	var out;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 ] );
+	x = new ndarray( 'float64', buf, [ 3, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	out = transposeInPlace( x );
+	expected = [
+		[ 1.0, 4.0, 7.0 ],
+		[ 2.0, 5.0, 8.0 ],
+		[ 3.0, 6.0, 9.0 ]
+	];
+
+	t.strictEqual( out, x, 'returns expected value' );
+	t.strictEqual( getData( out ), buf, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function transposes a square matrix in-place (column-major)', function test( t ) {
+	var expected;
+	var out;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+
+	out = transposeInPlace( x );
+	expected = [
+		[ 1.0, 2.0 ],
+		[ 3.0, 4.0 ]
+	];
+
+	t.strictEqual( out, x, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function transposes a stack of square matrices in-place', function test( t ) {
+	var expected;
+	var x;
+
+	x = linspace( [ 2, 3, 3 ], 'row-major' );
+	expected = ndarray2array( toTransposed( x ) );
+
+	transposeInPlace( x );
+	t.deepEqual( ndarray2array( x ), expected, 'returns expected value' );
+
+	x = linspace( [ 2, 2, 4, 4 ], 'column-major' );
+	expected = ndarray2array( toTransposed( x ) );
+
+	transposeInPlace( x );
+	t.deepEqual( ndarray2array( x ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function transposes a large square matrix in-place (multiple blocks)', function test( t ) {
+	var expected;
+	var x;
+
+	x = linspace( [ 150, 150 ], 'row-major' );
+	expected = ndarray2array( toTransposed( x ) );
+
+	transposeInPlace( x );
+	t.deepEqual( ndarray2array( x ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function transposes a non-contiguous square matrix in-place', function test( t ) {
+	var expected;
+	var buf;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 0.0, 3.0, 0.0, 4.0, 0.0 ] );
+	x = new ndarray( 'float64', buf, [ 2, 2 ], [ -8, 2 ], 8, 'row-major' );
+
+	transposeInPlace( x );
+	expected = [
+		[ 3.0, 1.0 ],
+		[ 4.0, 2.0 ]
+	];
+	t.deepEqual( ndarray2array( x ), expected, 'returns expected value' );
+
+	expected = new Float64Array( [ 4.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 0.0, 3.0, 0.0, 1.0, 0.0 ] );
+	t.deepEqual( buf, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function transposes a square matrix in-place (accessors)', function test( t ) {
+	var expected;
+	var buf;
+	var x;
+
+	buf = new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 ] );
+	x = new ndarray( 'complex128', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	transposeInPlace( x );
+	expected = new Complex128Array( [ 1.0, 2.0, 5.0, 6.0, 3.0, 4.0, 7.0, 8.0 ] );
+
+	t.strictEqual( isSameComplex128Array( getData( x ), expected ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports empty ndarrays', function test( t ) {
+	var out;
+	var x;
+
+	x = zeros( 'float64', [ 0, 2, 2 ], 'row-major' );
+	out = transposeInPlace( x );
+	t.strictEqual( out, x, 'returns expected value' );
+
+	x = zeros( 'float64', [ 0, 0 ], 'row-major' );
+	out = transposeInPlace( x );
+	t.strictEqual( out, x, 'returns expected value' );
+	t.end();
+});
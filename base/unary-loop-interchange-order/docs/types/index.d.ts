@@ -61,39 +61,40 @@ interface LoopOrderObject {
 *
 * -   When iterating over the elements of a multi-dimensional array, accessing elements which are closer in memory can improve performance. To this end, loop interchange is a technique used in loop nest optimization to improve locality of reference and take advantage of CPU cache.
 *
-*     The purpose of this function is to order ndarray dimensions according to the magnitude of **input array** strides. By using the ordered dimensions and associated strides, one can construct nested loops (one for each dimension) such that the innermost loop iterates over the dimension in which array elements are closest in memory and the outermost loop iterates over the dimension in which array elements are farthest apart in memory. As a consequence, element iteration is optimized to minimize cache misses and ensure locality of reference.
+*     The purpose of this function is to order ndarray dimensions according to the estimated cost of accessing the elements of **both** the input and output arrays. By using the ordered dimensions and associated strides, one can construct nested loops (one for each dimension) such that the innermost loop iterates over the dimension in which array elements are closest in memory and the outermost loop iterates over the dimension in which array elements are farthest apart in memory. As a consequence, element iteration is optimized to minimize cache misses and ensure locality of reference.
 *
-* -   Cache performance may be degraded if the layout order (i.e., row-major or column-major) differs for the input and output ndarrays. This function is intended to optimize cache performance for the input ndarray. If the output ndarray has a different layout order (e.g., if the input ndarray is row-major and the output ndarray is column-major), cache misses are likely for the output ndarray. In general, to ensure best performance, input and output ndarrays should have the same layout order.
+* -   Cache performance may be degraded if the layout order (i.e., row-major or column-major) differs for the input and output ndarrays. As no loop order can be optimal for both ndarrays, the function weights output array writes more heavily than input array reads and, thus, favors contiguous writes (e.g., when copying a row-major ndarray into a column-major ndarray). In general, to ensure best performance, input and output ndarrays should have the same layout order.
 *
 * -   The function assumes that the input and output ndarrays have the same shape. Hence, loop interchange order should only be determined **after** broadcasting.
 *
 * @param shape - array dimensions
 * @param stridesX - input array stride lengths
 * @param stridesY - output array stride lengths
+* @param nbytes - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns loop interchange data
 *
 * @example
-* var sh = [ 2, 3, 4 ];
+* var sh = [ 10, 20, 30 ];
 *
-* var sx = [ 12, 4, 1 ]; // row-major
-* var sy = [ 1, -2, 6 ]; // column-major
+* var sx = [ 600, 30, 1 ]; // row-major
+* var sy = [ 1, 10, 200 ]; // column-major
 *
 * var o = unaryLoopOrder( sh, sx, sy );
 * // returns {...}
 *
 * var ssh = o.sh;
-* // returns [ 4, 3, 2 ]
+* // returns [ 10, 30, 20 ]
 *
 * var ssx = o.sx;
-* // returns [ 1, 4, 12 ]
+* // returns [ 600, 1, 30 ]
 *
 * var ssy = o.sy;
-* // returns [ 6, -2, 1 ]
+* // returns [ 1, 200, 10 ]
 *
 * var idx = o.idx;
-* // returns [ 2, 1, 0 ]
+* // returns [ 0, 2, 1 ]
 */
-declare function unaryLoopOrder( shape: ArrayLike<number>, stridesX: ArrayLike<number>, stridesY: ArrayLike<number> ): LoopOrderObject;
+declare function unaryLoopOrder( shape: ArrayLike<number>, stridesX: ArrayLike<number>, stridesY: ArrayLike<number>, nbytes?: ArrayLike<number | null> ): LoopOrderObject;
 
 
 // EXPORTS //
@@ -26,25 +26,25 @@
 * @example
 * var unaryLoopOrder = require( '@stdlib/ndarray/base/unary-loop-interchange-order' );
 *
-* var sh = [ 2, 3, 4 ];
+* var sh = [ 10, 20, 30 ];
 *
-* var sx = [ 12, 4, 1 ]; // row-major
-* var sy = [ 1, -2, 6 ]; // column-major
+* var sx = [ 600, 30, 1 ]; // row-major
+* var sy = [ 1, 10, 200 ]; // column-major
 *
 * var o = unaryLoopOrder( sh, sx, sy );
 * // returns {...}
 *
 * var ssh = o.sh;
-* // returns [ 4, 3, 2 ]
+* // returns [ 10, 30, 20 ]
 *
 * var ssx = o.sx;
-* // returns [ 1, 4, 12 ]
+* // returns [ 600, 1, 30 ]
 *
 * var ssy = o.sy;
-* // returns [ 6, -2, 1 ]
+* // returns [ 1, 200, 10 ]
 *
 * var idx = o.idx;
-* // returns [ 2, 1, 0 ]
+* // returns [ 0, 2, 1 ]
 */
 
 // MODULES //
@@ -20,10 +20,14 @@
 
 // MODULES //
 
-var zeroTo = require( '@stdlib/array/base/zero-to' );
-var copy = require( '@stdlib/array/base/copy-indexed' );
 var take = require( '@stdlib/array/base/take-indexed' );
-var sort2ins = require( './sort2ins.js' );
+var weightedLoopOrder = require( './../../../base/weighted-loop-interchange-order' );
+
+
+// VARIABLES //
+
+// Default list of element sizes (i.e., defer to the default element size for each ndarray):
+var NBYTES = [];
 
 
 // MAIN //
@@ -40,44 +44,44 @@ var sort2ins = require( './sort2ins.js' );
 *     -   **sy**: output ndarray strides sorted in loop order.
 *     -   **idx**: dimension indices sorted in loop order.
 *
+* -   The loop order is resolved using a cost model which weighs the strides of both the input and output ndarrays, with writes weighted more heavily than reads. Accordingly, when the input and output ndarrays have different memory layouts (e.g., when copying a transposed view), the loop order favors contiguous writes.
+*
 * @param {NonNegativeIntegerArray} sh - array dimensions
 * @param {IntegerArray} sx - input array stride lengths
 * @param {IntegerArray} sy - output array stride lengths
+* @param {ArrayLikeObject<(PositiveInteger|null)>} [nbytes] - number of bytes per element for each ndarray (default: eight bytes per element)
 * @returns {Object} loop interchange data
 *
 * @example
-* var sh = [ 2, 3, 4 ];
+* var sh = [ 10, 20, 30 ];
 *
-* var sx = [ 12, 4, 1 ]; // row-major
-* var sy = [ 1, -2, 6 ]; // column-major
+* var sx = [ 600, 30, 1 ]; // row-major
+* var sy = [ 1, 10, 200 ]; // column-major
 *
 * var o = loopOrder( sh, sx, sy );
 * // returns {...}
 *
 * var ssh = o.sh;
-* // returns [ 4, 3, 2 ]
+* // returns [ 10, 30, 20 ]
 *
 * var ssx = o.sx;
-* // returns [ 1, 4, 12 ]
+* // returns [ 600, 1, 30 ]
 *
 * var ssy = o.sy;
-* // returns [ 6, -2, 1 ]
+* // returns [ 1, 200, 10 ]
 *
 * var idx = o.idx;
-* // returns [ 2, 1, 0 ]
+* // returns [ 0, 2, 1 ]
 */
-function loopOrder( sh, sx, sy ) {
+function loopOrder( sh, sx, sy, nbytes ) {
 	var idx;
 
-	// Initialize a loop interchange index array for generating a loop order permutation:
-	idx = zeroTo( sh.length );
-
-	// Sort the input array strides in increasing order (of magnitude):
-	sx = copy( sx );
-	sort2ins( sx, idx );
+	// Resolve a loop order which minimizes the estimated cost of accessing the elements of both the input and output ndarrays:
+	idx = weightedLoopOrder( [ sx, sy ], ( arguments.length > 3 ) ? nbytes : NBYTES, 1 );
 
-	// Permute the shape and output array strides based on the sorted input array strides:
+	// Permute the shape and array strides based on the resolved loop order:
 	sh = take( sh, idx );
+	sx = take( sx, idx );
 	sy = take( sy, idx );
 
 	return {
@@ -93,7 +93,7 @@ tape( 'the function returns loop interchange data (column-major)', function test
 	t.end();
 });
 
-tape( 'the function returns loop interchange data (mixed order)', function test( t ) {
+tape( 'the function returns loop interchange data (mixed order; favors contiguous writes)', function test( t ) {
 	var sh;
 	var sx;
 	var sy;
@@ -107,18 +107,18 @@ tape( 'the function returns loop interchange data (mixed order)', function test(
 
 	t.notEqual( o.sh, sh, 'returns new array' );
 	t.strictEqual( isArray( o.sh ), true, 'returns expected value' );
-	t.deepEqual( o.sh, [ 2, 2, 4 ], 'returns expected value' );
+	t.deepEqual( o.sh, [ 4, 2, 2 ], 'returns expected value' );
 
 	t.notEqual( o.sx, sx, 'returns new array' );
 	t.strictEqual( isArray( o.sx ), true, 'returns expected value' );
-	t.deepEqual( o.sx, [ 1, -2, 4 ], 'returns expected value' );
+	t.deepEqual( o.sx, [ 4, -2, 1 ], 'returns expected value' );
 
 	t.notEqual( o.sy, sy, 'returns new array' );
 	t.strictEqual( isArray( o.sy ), true, 'returns expected value' );
-	t.deepEqual( o.sy, [ -8, -4, 1 ], 'returns expected value' );
+	t.deepEqual( o.sy, [ 1, -4, -8 ], 'returns expected value' );
 
 	t.strictEqual( isArray( o.idx ), true, 'returns expected value' );
-	t.deepEqual( o.idx, [ 2, 1, 0 ], 'returns expected value' );
+	t.deepEqual( o.idx, [ 0, 1, 2 ], 'returns expected value' );
 
 	t.end();
 });
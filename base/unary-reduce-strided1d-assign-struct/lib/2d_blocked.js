@@ -22,6 +22,7 @@
 
 var loopOrder = require( './../../../base/unary-loop-interchange-order' );
 var blockSize = require( './../../../base/unary-tiling-block-size' );
+var bytesPerElement = require( './../../../base/bytes-per-element' );
 var takeIndexed = require( '@stdlib/array/base/take-indexed' );
 var copyIndexed = require( '@stdlib/array/base/copy-indexed' );
 var zeros = require( '@stdlib/array/base/zeros' );
@@ -222,7 +223,7 @@ function blockedunary2d( fcn, arrays, views, strides, strategy, opts ) {
 	y = arrays[ 1 ];
 
 	// Resolve the loop interchange order:
-	o = loopOrder( y.shape, strides, y.strides );
+	o = loopOrder( y.shape, strides, y.strides, [ bytesPerElement( x.dtype ), bytesPerElement( y.dtype ) ] );
 	sh = o.sh;
 	sv = [ o.sx, o.sy ];
 	for ( k = 2; k < N; k++ ) {
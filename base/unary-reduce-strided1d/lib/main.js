@@ -27,6 +27,7 @@ var indicesComplement = require( '@stdlib/array/base/indices-complement' );
 var takeIndexed2 = require( '@stdlib/array/base/take-indexed2' );
 var iterationOrder = require( './../../../base/iteration-order' );
 var strides2order = require( './../../../base/strides2order' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
 var numel = require( './../../../base/numel' );
 var join = require( '@stdlib/array/base/join' );
 var format = require( '@stdlib/string/format' );
@@ -331,7 +332,7 @@ function unaryReduceStrided1d( fcn, arrays, dims, options ) { // eslint-disable-
 	var sc;
 	var sl;
 	var sy;
-	var ns;
+	var st;
 	var d;
 	var s;
 	var N;
@@ -401,7 +402,6 @@ function unaryReduceStrided1d( fcn, arrays, dims, options ) { // eslint-disable-
 
 	// Verify that the provided arrays have the same loop dimensions...
 	len = 1; // number of elements
-	ns = 0;  // number of singleton dimensions
 	for ( i = 0; i < K; i++ ) {
 		s = shl[ i ];
 		for ( j = 1; j < N; j++ ) {
@@ -411,16 +411,17 @@ function unaryReduceStrided1d( fcn, arrays, dims, options ) { // eslint-disable-
 		}
 		// Note that, if one of the dimensions is `0`, the length will be `0`...
 		len *= s;
-
-		// Check whether the current dimension is a singleton dimension...
-		if ( s === 1 ) {
-			ns += 1;
-		}
 	}
 	// Check whether we were provided empty ndarrays...
 	if ( len === 0 || ( shc.length && numel( shc ) === 0 ) ) {
 		return;
 	}
+	// Coalesce reduced dimensions which can be traversed as a single dimension (e.g., reducing the last two dimensions of a row-major array), thus allowing each sub-array to be reduced as a single strided lane without reshaping or copying...
+	if ( shc.length > 1 ) {
+		tmp = coalesce( shc, [ sc ] );
+		shc = tmp[ 0 ];
+		sc = tmp[ 1 ];
+	}
 	// Initialize ndarray-like objects for representing sub-array views...
 	views = [
 		descriptor( x.dtype, x.data, shc, sc, x.offset, x.order )
@@ -437,6 +438,23 @@ function unaryReduceStrided1d( fcn, arrays, dims, options ) { // eslint-disable-
 		}
 		return UNARY[ K ]( fcn, arr, strategy, opts );
 	}
+	// Coalesce loop dimensions which can be traversed as a single dimension across all provided arrays (note: this also removes singleton dimensions, such that, e.g., shape=[10,1,1,1] reduces to one-dimensional iteration)...
+	if ( K > 1 ) {
+		st = [ sl ];
+		for ( j = 1; j < N; j++ ) {
+			st.push( arr[ j ].strides );
+		}
+		tmp = coalesce( shl, st );
+		shl = tmp[ 0 ];
+		K = shl.length;
+
+		// Update the loop shape and strides (note: sub-array views have already been resolved, so we only need to retain loop strides)...
+		y.shape = shl;
+		sl = tmp[ 1 ];
+		for ( j = 1; j < N; j++ ) {
+			arr[ j ].strides = tmp[ j+1 ];
+		}
+	}
 	// Determine whether we only have one loop dimension and can thus readily perform one-dimensional iteration...
 	if ( K === 1 ) {
 		if ( y.accessorProtocol ) {
@@ -444,24 +462,6 @@ function unaryReduceStrided1d( fcn, arrays, dims, options ) { // eslint-disable-
 		}
 		return UNARY[ K ]( fcn, arr, views, sl, strategy, opts );
 	}
-	// Determine whether the loop dimensions have only **one** non-singleton dimension (e.g., shape=[10,1,1,1]) so that we can treat loop iteration as being equivalent to one-dimensional iteration...
-	if ( ns === K-1 ) {
-		// Get the index of the non-singleton dimension...
-		for ( i = 0; i < K; i++ ) {
-			if ( shl[ i ] !== 1 ) {
-				break;
-			}
-		}
-		y.shape = [ shl[i] ];
-		for ( j = 0; j < N; j++ ) {
-			arr[ j ].strides = [ arr[j].strides[i] ];
-		}
-		sl = [ sl[i] ];
-		if ( y.accessorProtocol ) {
-			return ACCESSOR_UNARY[ 1 ]( fcn, arr, views, sl, strategy, opts );
-		}
-		return UNARY[ 1 ]( fcn, arr, views, sl, strategy, opts );
-	}
 	sy = y.strides;
 	iox = iterationOrder( sl ); // +/-1
 	ioy = iterationOrder( sy ); // +/-1
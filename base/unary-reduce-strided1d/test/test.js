@@ -21,9 +21,102 @@
 // MODULES //
 
 var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+var numelDimension = require( './../../../base/numel-dimension' );
+var getStride = require( './../../../base/stride' );
+var getOffset = require( './../../../base/offset' );
+var getData = require( './../../../base/data-buffer' );
 var unaryReduceStrided1d = require( './../lib' );
 
 
+// FUNCTIONS //
+
+/**
+* Computes the sum of a one-dimensional ndarray.
+*
+* @private
+* @param {ArrayLikeObject<Object>} arrays - array-like object containing ndarrays
+* @returns {number} sum
+*/
+function sum( arrays ) {
+	var x;
+	var N;
+	var s;
+	var v;
+	var b;
+	var i;
+	var j;
+
+	x = arrays[ 0 ];
+	N = numelDimension( x, 0 );
+	s = getStride( x, 0 );
+	b = getData( x );
+	j = getOffset( x );
+	v = 0.0;
+	for ( i = 0; i < N; i++ ) {
+		v += b[ j ];
+		j += s;
+	}
+	return v;
+}
+
+/**
+* Computes reference sums over the last `M` dimensions of an ndarray-like object.
+*
+* @private
+* @param {Object} x - ndarray-like object
+* @param {NonNegativeInteger} M - number of reduced (trailing) dimensions
+* @returns {Array<number>} sums in lexicographic order
+*/
+function reference( x, M ) {
+	var out;
+	var idx;
+	var sub;
+	var sh;
+	var N;
+	var n;
+	var d;
+	var i;
+	var j;
+
+	sh = x.shape;
+	N = 1;
+	for ( i = 0; i < sh.length; i++ ) {
+		N *= sh[ i ];
+	}
+	n = 1;
+	for ( i = sh.length-M; i < sh.length; i++ ) {
+		n *= sh[ i ];
+	}
+	out = [];
+	sub = [];
+	for ( i = 0; i < sh.length; i++ ) {
+		sub.push( 0 );
+	}
+	for ( i = 0; i < N; i++ ) {
+		idx = x.offset;
+		for ( j = 0; j < sh.length; j++ ) {
+			idx += sub[ j ] * x.strides[ j ];
+		}
+		if ( i%n === 0 ) {
+			out.push( 0.0 );
+		}
+		out[ out.length-1 ] += x.data[ idx ];
+
+		// Increment subscripts in lexicographic order:
+		for ( d = sh.length-1; d >= 0; d-- ) {
+			sub[ d ] += 1;
+			if ( sub[ d ] < sh[ d ] ) {
+				break;
+			}
+			sub[ d ] = 0;
+		}
+	}
+	return out;
+}
+
+
 // TESTS //
 
 tape( 'main export is a function', function test( t ) {
@@ -32,4 +125,91 @@ tape( 'main export is a function', function test( t ) {
 	t.end();
 });
 
-// FIXME: add tests
+tape( 'the function performs a reduction over a partially contiguous view (row-major)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	// Define a view containing every other row of a row-major 200x3x1000 array:
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( zeroTo( 600000 ) ),
+		'shape': [ 100, 3, 1000 ],
+		'strides': [ 6000, 1000, 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	y = {
+		'dtype': 'float64',
+		'data': new Float64Array( 100 ),
+		'shape': [ 100 ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	expected = new Float64Array( reference( x, 2 ) );
+
+	unaryReduceStrided1d( sum, [ x, y ], [ 1, 2 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+
+	// The input ndarray meta data should not be mutated:
+	t.deepEqual( x.shape, [ 100, 3, 1000 ], 'returns expected value' );
+	t.deepEqual( x.strides, [ 6000, 1000, 1 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function performs a reduction over dimensions which can be merged (column-major)', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( zeroTo( 60 ) ),
+		'shape': [ 4, 3, 5 ],
+		'strides': [ 1, 4, 12 ],
+		'offset': 0,
+		'order': 'column-major'
+	};
+	y = {
+		'dtype': 'float64',
+		'data': new Float64Array( 4 ),
+		'shape': [ 4 ],
+		'strides': [ 1 ],
+		'offset': 0,
+		'order': 'column-major'
+	};
+	expected = new Float64Array( reference( x, 2 ) );
+
+	unaryReduceStrided1d( sum, [ x, y ], [ 1, 2 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function performs a reduction over ndarrays having negative strides', function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( zeroTo( 24 ) ),
+		'shape': [ 2, 3, 4 ],
+		'strides': [ -12, -4, -1 ],
+		'offset': 23,
+		'order': 'row-major'
+	};
+	y = {
+		'dtype': 'float64',
+		'data': new Float64Array( 2 ),
+		'shape': [ 2 ],
+		'strides': [ -1 ],
+		'offset': 1,
+		'order': 'row-major'
+	};
+	expected = new Float64Array( reference( x, 2 ).reverse() );
+
+	unaryReduceStrided1d( sum, [ x, y ], [ 1, 2 ] );
+	t.deepEqual( y.data, expected, 'returns expected value' );
+	t.end();
+});
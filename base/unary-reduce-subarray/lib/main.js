@@ -27,6 +27,7 @@ var indicesComplement = require( '@stdlib/array/base/indices-complement' );
 var takeIndexed2 = require( '@stdlib/array/base/take-indexed2' );
 var iterationOrder = require( './../../../base/iteration-order' );
 var strides2order = require( './../../../base/strides2order' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
 var numel = require( './../../../base/numel' );
 var join = require( '@stdlib/array/base/join' );
 var format = require( '@stdlib/string/format' );
@@ -305,7 +306,7 @@ function unaryReduceSubarray( fcn, arrays, dims, options ) { // eslint-disable-l
 	var sc;
 	var sl;
 	var sy;
-	var ns;
+	var st;
 	var d;
 	var s;
 	var N;
@@ -382,7 +383,6 @@ function unaryReduceSubarray( fcn, arrays, dims, options ) { // eslint-disable-l
 
 	// Verify that the provided arrays have the same loop dimensions...
 	len = 1; // number of elements
-	ns = 0;  // number of singleton dimensions
 	for ( i = 0; i < K; i++ ) {
 		s = shl[ i ];
 		for ( j = 1; j < N; j++ ) {
@@ -392,11 +392,6 @@ function unaryReduceSubarray( fcn, arrays, dims, options ) { // eslint-disable-l
 		}
 		// Note that, if one of the dimensions is `0`, the length will be `0`...
 		len *= s;
-
-		// Check whether the current dimension is a singleton dimension...
-		if ( s === 1 ) {
-			ns += 1;
-		}
 	}
 	// Check whether we were provided empty ndarrays...
 	if ( len === 0 || ( shc.length && numel( shc ) === 0 ) ) {
@@ -408,6 +403,23 @@ function unaryReduceSubarray( fcn, arrays, dims, options ) { // eslint-disable-l
 	];
 	initializeViews( arr, K, views );
 
+	// Coalesce loop dimensions which can be traversed as a single dimension across all provided arrays (note: this also removes singleton dimensions, such that, e.g., shape=[10,1,1,1] reduces to one-dimensional iteration)...
+	if ( K > 1 ) {
+		st = [ sl ];
+		for ( j = 1; j < N; j++ ) {
+			st.push( arr[ j ].strides );
+		}
+		tmp = coalesce( shl, st );
+		shl = tmp[ 0 ];
+		K = shl.length;
+
+		// Update the loop shape and strides (note: sub-array views have already been resolved, so we only need to retain loop strides)...
+		y.shape = shl;
+		sl = tmp[ 1 ];
+		for ( j = 1; j < N; j++ ) {
+			arr[ j ].strides = tmp[ j+1 ];
+		}
+	}
 	// Determine whether we only have one loop dimension and can thus readily perform one-dimensional iteration...
 	if ( K === 1 ) {
 		if ( y.accessorProtocol ) {
@@ -415,24 +427,6 @@ function unaryReduceSubarray( fcn, arrays, dims, options ) { // eslint-disable-l
 		}
 		return UNARY[ K ]( fcn, arr, views, sl, opts );
 	}
-	// Determine whether the loop dimensions have only **one** non-singleton dimension (e.g., shape=[10,1,1,1]) so that we can treat loop iteration as being equivalent to one-dimensional iteration...
-	if ( ns === K-1 ) {
-		// Get the index of the non-singleton dimension...
-		for ( i = 0; i < K; i++ ) {
-			if ( shl[ i ] !== 1 ) {
-				break;
-			}
-		}
-		y.shape = [ shl[i] ];
-		for ( j = 0; j < N; j++ ) {
-			arr[ j ].strides = [ arr[j].strides[i] ];
-		}
-		sl = [ sl[i] ];
-		if ( y.accessorProtocol ) {
-			return ACCESSOR_UNARY[ 1 ]( fcn, arr, views, sl, opts );
-		}
-		return UNARY[ 1 ]( fcn, arr, views, sl, opts );
-	}
 	sy = y.strides;
 	iox = iterationOrder( sl ); // +/-1
 	ioy = iterationOrder( sy ); // +/-1
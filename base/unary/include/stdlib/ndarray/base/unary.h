@@ -91,6 +91,7 @@
 #include "unary/d_f_as_f_f.h"
 #include "unary/d_i_as_d_i.h"
 #include "unary/d_l_as_d_l.h"
+#include "unary/d_v_as_d_v.h"
 #include "unary/d_z.h"
 #include "unary/d_z_as_d_z.h"
 #include "unary/d_z_as_z_z.h"
@@ -106,18 +107,26 @@
 #include "unary/f_f_as_d_d.h"
 #include "unary/f_i_as_f_i.h"
 #include "unary/f_l_as_f_l.h"
+#include "unary/f_v_as_f_v.h"
 #include "unary/f_z.h"
 #include "unary/f_z_as_f_z.h"
 #include "unary/f_z_as_z_z.h"
 
+#include "unary/h_d_as_d_d.h"
+#include "unary/h_f_as_f_f.h"
+#include "unary/h_h_as_d_d.h"
+#include "unary/h_h_as_f_f.h"
+
 #include "unary/i_d.h"
 #include "unary/i_d_as_d_d.h"
 #include "unary/i_d_as_i_d.h"
 #include "unary/i_i.h"
+#include "unary/i_i_as_l_l.h"
 #include "unary/i_l.h"
 #include "unary/i_l_as_i_l.h"
 #include "unary/i_l_as_l_l.h"
 #include "unary/i_u.h"
+#include "unary/i_u_as_l_l.h"
 #include "unary/i_v.h"
 #include "unary/i_z.h"
 #include "unary/i_z_as_i_z.h"
@@ -154,6 +163,16 @@
 #include "unary/k_z_as_k_z.h"
 #include "unary/k_z_as_z_z.h"
 
+#include "unary/l_d.h"
+#include "unary/l_d_as_d_d.h"
+#include "unary/l_d_as_l_d.h"
+#include "unary/l_f_as_l_f.h"
+#include "unary/l_i_as_l_i.h"
+#include "unary/l_l.h"
+#include "unary/l_u_as_l_u.h"
+#include "unary/l_v.h"
+#include "unary/l_v_as_l_v.h"
+
 #include "unary/s_b.h"
 #include "unary/s_c.h"
 #include "unary/s_c_as_c_c.h"
@@ -230,6 +249,8 @@
 #include "unary/u_l_as_l_l.h"
 #include "unary/u_l_as_u_l.h"
 #include "unary/u_u.h"
+#include "unary/u_u_as_l_l.h"
+#include "unary/u_u_as_v_v.h"
 #include "unary/u_v.h"
 #include "unary/u_v_as_u_v.h"
 #include "unary/u_v_as_v_v.h"
@@ -237,6 +258,14 @@
 #include "unary/u_z_as_u_z.h"
 #include "unary/u_z_as_z_z.h"
 
+#include "unary/v_d.h"
+#include "unary/v_d_as_d_d.h"
+#include "unary/v_d_as_v_d.h"
+#include "unary/v_f_as_v_f.h"
+#include "unary/v_i_as_v_i.h"
+#include "unary/v_u_as_v_u.h"
+#include "unary/v_v.h"
+
 #include "unary/x_x.h"
 
 #include "unary/z_c.h"
@@ -21,9 +21,8 @@
 
 #include "stdlib/ndarray/base/bytes_per_element.h"
 #include "stdlib/ndarray/base/unary/internal/permute.h"
-#include "stdlib/ndarray/base/unary/internal/range.h"
-#include "stdlib/ndarray/base/unary/internal/sort2ins.h"
 #include "stdlib/ndarray/base/unary/macros/constants.h"
+#include "stdlib/ndarray/base/weighted_loop_interchange_order.h"
 #include "stdlib/ndarray/ctor.h"
 #include <stdint.h>
 #include <string.h>
@@ -51,6 +50,7 @@
 	int64_t sx1[3];                                                            \
 	int64_t sx2[3];                                                            \
 	int64_t idx[3];                                                            \
+	int64_t cost[6];                                                           \
 	int64_t tmp[3];                                                            \
 	int64_t bsize;                                                             \
 	uint8_t *pbx1;                                                             \
@@ -80,15 +80,13 @@
 	int64_t j0;                                                                \
 	int64_t j1;                                                                \
 	int64_t j2;                                                                \
-	/* Copy strides to prevent mutation to the original ndarray: */            \
-	memcpy( sx1, stdlib_ndarray_strides( x1 ), sizeof sx1 );                   \
-	/* Create a loop interchange index array for loop order permutation: */    \
-	stdlib_ndarray_base_unary_internal_range( 3, idx );                        \
-	/* Sort the input array strides in increasing order (of magnitude): */     \
-	stdlib_ndarray_base_unary_internal_sort2ins( 3, sx1, idx );                \
+	/* Resolve a loop order which minimizes the estimated cost of accessing the elements of all ndarrays: */ \
+	stdlib_ndarray_weighted_loop_interchange_order( 3, 2, arrays, 1, cost, idx ); \
 	/* Permute the shape and array strides (avoiding mutation) according to loop order: */ \
 	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_shape( x1 ), idx, tmp );   \
 	memcpy( shape, tmp, sizeof shape );                                        \
+	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_strides( x1 ), idx, tmp ); \
+	memcpy( sx1, tmp, sizeof sx1 );                                            \
 	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_strides( x2 ), idx, tmp ); \
 	memcpy( sx2, tmp, sizeof sx2 );                                            \
 	/* Determine the block size... */                                          \
@@ -177,6 +175,7 @@
 	int64_t sx2[3];                                                            \
 	int64_t sx3[3];                                                            \
 	int64_t idx[3];                                                            \
+	int64_t cost[6];                                                           \
 	int64_t tmp[3];                                                            \
 	int64_t bsize;                                                             \
 	uint8_t *pbx1;                                                             \
@@ -215,15 +214,13 @@
 	int64_t j0;                                                                \
 	int64_t j1;                                                                \
 	int64_t j2;                                                                \
-	/* Copy strides to prevent mutation to the original ndarray: */            \
-	memcpy( sx1, stdlib_ndarray_strides( x1 ), sizeof sx1 );                   \
-	/* Create a loop interchange index array for loop order permutation: */    \
-	stdlib_ndarray_base_unary_internal_range( 3, idx );                        \
-	/* Sort the input array strides in increasing order (of magnitude): */     \
-	stdlib_ndarray_base_unary_internal_sort2ins( 3, sx1, idx );                \
+	/* Resolve a loop order which minimizes the estimated cost of accessing the elements of all ndarrays: */ \
+	stdlib_ndarray_weighted_loop_interchange_order( 3, 3, arrays, 2, cost, idx ); \
 	/* Permute the shape and array strides (avoiding mutation) according to loop order: */ \
 	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_shape( x1 ), idx, tmp );   \
 	memcpy( shape, tmp, sizeof shape );                                        \
+	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_strides( x1 ), idx, tmp ); \
+	memcpy( sx1, tmp, sizeof sx1 );                                            \
 	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_strides( x2 ), idx, tmp ); \
 	memcpy( sx2, tmp, sizeof sx2 );                                            \
 	stdlib_ndarray_base_unary_internal_permute( 3, stdlib_ndarray_strides( x3 ), idx, tmp ); \
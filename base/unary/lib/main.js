@@ -21,6 +21,7 @@
 // MODULES //
 
 var iterationOrder = require( './../../../base/iteration-order' );
+var coalesce = require( './../../../base/coalesce-dimensions' );
 var strides2order = require( './../../../base/strides2order' );
 var minmaxViewBufferIndex = require( './../../../base/minmax-view-buffer-index' );
 var ndarray2object = require( './../../../base/ndarraylike2object' );
@@ -204,7 +205,7 @@ function unary( arrays, fcn ) {
 	var sy;
 	var ox;
 	var oy;
-	var ns;
+	var o;
 	var x;
 	var y;
 	var d;
@@ -230,7 +231,6 @@ function unary( arrays, fcn ) {
 	}
 	// Verify that the input and output arrays have the same dimensions...
 	len = 1; // number of elements
-	ns = 0;  // number of singleton dimensions
 	for ( i = 0; i < ndims; i++ ) {
 		d = shx[ i ];
 		if ( d !== shy[ i ] ) {
@@ -238,16 +238,22 @@ function unary( arrays, fcn ) {
 		}
 		// Note that, if one of the dimensions is `0`, the length will be `0`...
 		len *= d;
-
-		// Check whether the current dimension is a singleton dimension...
-		if ( d === 1 ) {
-			ns += 1;
-		}
 	}
 	// Check whether we were provided empty ndarrays...
 	if ( len === 0 ) {
 		return;
 	}
+	// Merge adjacent dimensions which are jointly contiguous and remove singleton dimensions (e.g., ndims=3, shape=[100,3,1000], where only the last two dimensions are contiguous, becomes ndims=2, shape=[100,3000]) so that we can use lower-dimensional kernels...
+	if ( ndims > 1 ) {
+		o = coalesce( shx, [ x.strides, y.strides ] );
+		shx = o[ 0 ];
+		shy = shx;
+		ndims = shx.length;
+		x.shape = shx;
+		y.shape = shy;
+		x.strides = o[ 1 ];
+		y.strides = o[ 2 ];
+	}
 	// Determine whether the ndarrays are one-dimensional and thus readily translate to one-dimensional strided arrays...
 	if ( ndims === 1 ) {
 		if ( x.accessorProtocol || y.accessorProtocol ) {
@@ -258,23 +264,6 @@ function unary( arrays, fcn ) {
 	sx = x.strides;
 	sy = y.strides;
 
-	// Determine whether the ndarray has only **one** non-singleton dimension (e.g., ndims=4, shape=[10,1,1,1]) so that we can treat the ndarrays as being equivalent to one-dimensional strided arrays...
-	if ( ns === ndims-1 ) {
-		// Get the index of the non-singleton dimension...
-		for ( i = 0; i < ndims; i++ ) {
-			if ( shx[ i ] !== 1 ) {
-				break;
-			}
-		}
-		x.shape = [ shx[i] ];
-		y.shape = x.shape;
-		x.strides = [ sx[i] ];
-		y.strides = [ sy[i] ];
-		if ( x.accessorProtocol || y.accessorProtocol ) {
-			return ACCESSOR_UNARY[ 1 ]( x, y, fcn );
-		}
-		return UNARY[ 1 ]( x, y, fcn );
-	}
 	iox = iterationOrder( sx ); // +/-1
 	ioy = iterationOrder( sy ); // +/-1
 
@@ -76,9 +76,58 @@ var RE_SIGNATURE = /^([a-z])_([a-z])/;
 // Regular expression to match callback dtype characters:
 var RE_CALLBACK = /_as_([a-z])_([a-z])$/;
 
+// Regular expression to test for a half-precision floating-point array data type:
+var RE_HALF = /h/;
+
 
 // FUNCTIONS //
 
+/**
+* Returns the expression for converting an input ndarray element to a callback argument.
+*
+* @private
+* @param {string} ch - one-letter character abbreviation for the input ndarray data type
+* @param {string} cb - one-letter character abbreviation for the callback argument data type
+* @returns {string} casting expression
+*
+* @example
+* var out = halfInputCast( 'h', 'f' );
+* // returns 'stdlib_float16_to_float32'
+*
+* @example
+* var out = halfInputCast( 'f', 'd' );
+* // returns '(double)'
+*/
+function halfInputCast( ch, cb ) {
+	if ( ch === 'h' ) {
+		return format( 'stdlib_float16_to_%s', char2dtype( cb ) );
+	}
+	return format( '(%s)', dtype2c( char2dtype( cb ) ) );
+}
+
+/**
+* Returns the expression for converting a callback return value to an output ndarray element.
+*
+* @private
+* @param {string} ch - one-letter character abbreviation for the output ndarray data type
+* @param {string} cb - one-letter character abbreviation for the callback return data type
+* @returns {string} casting expression
+*
+* @example
+* var out = halfOutputCast( 'h', 'f' );
+* // returns 'stdlib_float16_from_float32'
+*
+* @example
+* var out = halfOutputCast( 'd', 'd' );
+* // returns '(double)'
+*/
+function halfOutputCast( ch, cb ) {
+	if ( ch === 'h' ) {
+		return format( 'stdlib_float16_from_%s', char2dtype( cb ) );
+	}
+	return format( '(%s)', dtype2c( char2dtype( ch ) ) );
+}
+
 /**
 * Creates a source file for a provided loop signature.
 *
@@ -113,6 +162,9 @@ function createSourceFile( signature ) {
 
 	// Ensure the appropriate header files are included in source files:
 	inc = [];
+	if ( /h/.test( signature ) ) {
+		inc.push( '#include "stdlib/ndarray/base/half_precision.h"' );
+	}
 	if ( /j/.test( signature ) ) {
 		inc.push( '#include "stdlib/complex/float16/ctor.h"' );
 	}
@@ -253,6 +305,8 @@ function createSourceFile( signature ) {
 			} else {
 				throw new Error( format( 'unexpected error. Unsupported signature: %s.', signature ) );
 			}
+		} else if ( RE_HALF.test( ch1+ch2 ) ) { // e.g., `h_h_as_f_f`, `h_d_as_d_d`
+			tmp = format( '%s( f( %s( v ) ) )', halfOutputCast( ch2, cb2 ), halfInputCast( ch1, cb1 ) ); // e.g., stdlib_float16_from_float32( f( stdlib_float16_to_float32( v ) ) )
 		} else if ( cb1 === cb2 ) { // e.g., `f_f_as_d_d`
 			tmp = format( '(%s)f( (%s)v )', dtype2c( t2 ), ct1 ); // e.g.,  (float)f( (double)v )
 		} else if ( ch1 === cb1 && ch2 === cb2 ) { // e.g., `b_d_as_b_d`, `b_c_as_b_c`
@@ -348,6 +402,10 @@ function createSourceFile( signature ) {
 				args.push( format( 'stdlib_complex64_from_%s', t1 ) );
 				args.push( format( '(%s)', dtype2c( t2 ) ) );
 			}
+		} else if ( RE_HALF.test( ch1+ch2 ) ) { // e.g., `h_h_as_f_f`, `h_d_as_d_d`
+			macro = MACROS.acast;
+			args.push( halfInputCast( ch1, cb1 ) );
+			args.push( halfOutputCast( ch2, cb2 ) );
 		} else if ( cb1 === cb2 ) { // e.g., `f_f_as_d_d`
 			macro = MACROS.cast;
 			args.push( ct1 );
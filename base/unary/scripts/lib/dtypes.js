@@ -30,6 +30,9 @@ var filter = require( './filter.js' );
 // Resolve a list of dtypes for which we want to create loops:
 var DTYPES = filter( dtypes(), EXCLUDE_DTYPES );
 
+// Add 64-bit integer dtypes, which are only supported in C and are not included in the list of JavaScript dtypes:
+DTYPES.push( 'int64', 'uint64' );
+
 
 // EXPORTS //
 
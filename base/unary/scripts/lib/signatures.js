@@ -74,6 +74,40 @@ var SPECIAL_LOOPS = [
 	't_t_as_u_u',
 	't_t_as_v_v',
 
+	// Support callbacks which operate on half-precision floating-point numbers stored in memory by computing in single or double precision:
+	'h_d_as_d_d',
+	'h_f_as_f_f',
+	'h_h_as_d_d',
+	'h_h_as_f_f',
+
+	// Support callbacks which operate on 64-bit integers by computing in double precision (e.g., applying a floating-point math function). These loops are a deliberate exception to the safe casts used for generating standard loops, as integers having a magnitude greater than 2^53 are rounded to the nearest double-precision floating-point number. This mirrors how 64-bit integers are handled in JavaScript, where all numbers are double-precision floating-point numbers. Casts to other floating-point data types (e.g., `l_f`) and narrowing integer casts (e.g., `l_i`) remain excluded, unless the callback itself returns the narrower data type:
+	'l_d',
+	'l_d_as_l_d',
+	'l_d_as_d_d',
+	'v_d',
+	'v_d_as_v_d',
+	'v_d_as_d_d',
+
+	// Support callbacks which operate on 32-bit integers by computing in 64-bit integer precision (e.g., computing the absolute value of a 32-bit signed integer via a callback which only accepts 64-bit signed integers):
+	'i_i_as_l_l',
+	'i_u_as_l_l',
+	'u_u_as_l_l',
+	'u_u_as_v_v',
+
+	// Support callbacks which operate on 64-bit integers and return a 32-bit integer (e.g., counting bits, returning the sign, etc):
+	'l_i_as_l_i',
+	'l_u_as_l_u',
+	'v_i_as_v_i',
+	'v_u_as_v_u',
+
+	// Support callbacks which operate on 64-bit integers and return a single-precision floating-point number:
+	'l_f_as_l_f',
+	'v_f_as_v_f',
+
+	// Support callbacks which operate on floating-point numbers and return a 64-bit unsigned integer (e.g., returning the bit representation, etc):
+	'd_v_as_d_v',
+	'f_v_as_f_v',
+
 	// Support callbacks which operate on signed integers, but whose return values are always positive and can be cast to unsigned integers of the same or greater bit width:
 	'i_u',
 	'i_v',
@@ -83,7 +117,9 @@ var SPECIAL_LOOPS = [
 	's_b',
 	's_t',
 	's_u',
-	's_v'
+	's_v',
+	'l_v',
+	'l_v_as_l_v'
 ];
 
 
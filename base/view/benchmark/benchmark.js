@@ -0,0 +1,86 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var zeros = require( './../../../base/zeros' );
+var ndarray = require( './../../../ctor' );
+var getDType = require( './../../../base/dtype' );
+var getData = require( './../../../base/data-buffer' );
+var getOrder = require( './../../../base/order' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var view = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s::dtype=float64', pkg ), function benchmark( b ) {
+	var sh;
+	var st;
+	var x;
+	var y;
+	var i;
+
+	x = zeros( 'float64', [ 100, 8 ], 'row-major' );
+	sh = [ 8 ];
+	st = [ 1 ];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		y = view( x, sh, st, (i%100)*8, false );
+		if ( y.length !== 8 ) {
+			b.fail( 'should have expected length' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( y ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::dtype=float64,constructor', pkg ), function benchmark( b ) {
+	var x;
+	var y;
+	var i;
+
+	x = zeros( 'float64', [ 100, 8 ], 'row-major' );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		y = new ndarray( getDType( x ), getData( x ), [ 8 ], [ 1 ], (i%100)*8, getOrder( x ), { // eslint-disable-line max-len
+			'readonly': true
+		});
+		if ( y.length !== 8 ) {
+			b.fail( 'should have expected length' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( y ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
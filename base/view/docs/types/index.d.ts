@@ -0,0 +1,91 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, typedndarray, Order } from '@stdlib/types/ndarray';
+
+/**
+* Returns an ndarray view of an input ndarray having specified meta data.
+*
+* ## Notes
+*
+* -   The function does **not** validate that the provided meta data is compatible with the input ndarray's underlying data buffer.
+* -   The returned view adopts the provided `shape` and `strides` arrays without copying them. Accordingly, the caller must not mutate the provided arrays after calling this function.
+*
+* @param x - input array
+* @param shape - view shape
+* @param strides - view strides
+* @param offset - index offset
+* @param writable - boolean indicating whether the returned ndarray should be writable
+* @param order - view memory layout (default: same as the input ndarray)
+* @returns ndarray view
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/ctor' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var buffer = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+* var x = new ndarray( 'float64', buffer, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var y = view( x, [ 2 ], [ 1 ], 2, false );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ 3.0, 4.0 ]
+*/
+declare function view<T extends typedndarray<unknown> = typedndarray<unknown>>( x: T, shape: Array<number>, strides: Array<number>, offset: number, writable: boolean, order?: Order ): T;
+
+/**
+* Returns an ndarray view of an input ndarray having specified meta data.
+*
+* ## Notes
+*
+* -   The function does **not** validate that the provided meta data is compatible with the input ndarray's underlying data buffer.
+* -   The returned view adopts the provided `shape` and `strides` arrays without copying them. Accordingly, the caller must not mutate the provided arrays after calling this function.
+*
+* @param x - input array
+* @param shape - view shape
+* @param strides - view strides
+* @param offset - index offset
+* @param writable - boolean indicating whether the returned ndarray should be writable
+* @param order - view memory layout (default: same as the input ndarray)
+* @returns ndarray view
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/ctor' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var buffer = [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ];
+* var x = new ndarray( 'generic', buffer, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* var y = view( x, [ 2 ], [ 1 ], 2, false );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ 3.0, 4.0 ]
+*/
+declare function view( x: ndarray, shape: Array<number>, strides: Array<number>, offset: number, writable: boolean, order?: Order ): ndarray;
+
+
+// EXPORTS //
+
+export = view;
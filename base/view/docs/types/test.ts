@@ -0,0 +1,134 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+import zeros = require( './../../../../base/zeros' );
+import view = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const sh = [ 2, 2 ];
+	const ord = 'row-major';
+
+	view( zeros( 'float64', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType float64ndarray
+	view( zeros( 'float32', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType float32ndarray
+	view( zeros( 'complex128', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType complex128ndarray
+	view( zeros( 'complex64', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType complex64ndarray
+	view( zeros( 'int32', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType int32ndarray
+	view( zeros( 'int16', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType int16ndarray
+	view( zeros( 'int8', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType int8ndarray
+	view( zeros( 'uint32', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType uint32ndarray
+	view( zeros( 'uint16', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType uint16ndarray
+	view( zeros( 'uint8', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType uint8ndarray
+	view( zeros( 'uint8c', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType uint8cndarray
+	view( zeros( 'generic', sh, ord ), [ 2 ], [ 1 ], 0, false ); // $ExpectType genericndarray<number>
+
+	view( zeros( 'float64', sh, ord ), [ 4 ], [ 1 ], 0, false, 'column-major' ); // $ExpectType float64ndarray
+	view( zeros( 'generic', sh, ord ), [ 4 ], [ 1 ], 0, false, 'column-major' ); // $ExpectType genericndarray<number>
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an ndarray...
+{
+	view( '10', [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( 10, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( false, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( true, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( null, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( void 0, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( [], [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( {}, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+	view( ( x: number ): number => x, [ 2 ], [ 1 ], 0, false ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an array of numbers...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	view( x, '5', [ 1 ], 0, false ); // $ExpectError
+	view( x, 5, [ 1 ], 0, false ); // $ExpectError
+	view( x, true, [ 1 ], 0, false ); // $ExpectError
+	view( x, null, [ 1 ], 0, false ); // $ExpectError
+	view( x, {}, [ 1 ], 0, false ); // $ExpectError
+	view( x, [ '5' ], [ 1 ], 0, false ); // $ExpectError
+	view( x, ( x: number ): number => x, [ 1 ], 0, false ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a third argument which is not an array of numbers...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	view( x, [ 2 ], '5', 0, false ); // $ExpectError
+	view( x, [ 2 ], 5, 0, false ); // $ExpectError
+	view( x, [ 2 ], true, 0, false ); // $ExpectError
+	view( x, [ 2 ], null, 0, false ); // $ExpectError
+	view( x, [ 2 ], {}, 0, false ); // $ExpectError
+	view( x, [ 2 ], [ '5' ], 0, false ); // $ExpectError
+	view( x, [ 2 ], ( x: number ): number => x, 0, false ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a fourth argument which is not a number...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	view( x, [ 2 ], [ 1 ], '5', false ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], true, false ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], null, false ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], {}, false ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], [], false ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], ( x: number ): number => x, false ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a fifth argument which is not a boolean...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	view( x, [ 2 ], [ 1 ], 0, '5' ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, 5 ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, null ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, {} ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, [] ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a sixth argument which is not a recognized order...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	view( x, [ 2 ], [ 1 ], 0, false, '5' ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, 5 ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, true ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, null ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, {} ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, [] ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = zeros( 'float64', [ 2, 2 ], 'row-major' );
+
+	view(); // $ExpectError
+	view( x ); // $ExpectError
+	view( x, [ 2 ] ); // $ExpectError
+	view( x, [ 2 ], [ 1 ] ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0 ); // $ExpectError
+	view( x, [ 2 ], [ 1 ], 0, false, 'row-major', {} ); // $ExpectError
+}
@@ -0,0 +1,38 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+var ndarray = require( './../../../ctor' );
+var ndarray2array = require( './../../../to-array' );
+var view = require( './../lib' );
+
+// Create a 4x3 matrix:
+var x = new ndarray( 'generic', zeroTo( 12 ), [ 4, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+// Define shared meta data for row views:
+var sh = [ 3 ];
+var st = [ 1 ];
+
+// Create a view for each row:
+var i;
+for ( i = 0; i < 4; i++ ) {
+	console.log( ndarray2array( view( x, sh, st, i*3, false ) ) );
+}
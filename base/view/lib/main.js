@@ -0,0 +1,112 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var Ctor = require( './../../../ctor' );
+var parent = require( './../../../base/ctor' );
+var defaults = require( './../../../defaults' );
+var getDType = require( './../../../base/dtype' );
+var getData = require( './../../../base/data-buffer' );
+var getOrder = require( './../../../base/order' );
+
+
+// VARIABLES //
+
+var INDEX_MODE = defaults.get( 'index_mode' );
+
+
+// MAIN //
+
+/**
+* Returns an ndarray view of an input ndarray having specified meta data.
+*
+* ## Notes
+*
+* -   The function is intended for internal use when deriving a view from an already validated ndarray. Accordingly, the function does **not** validate that the provided meta data is compatible with the input ndarray's underlying data buffer, and the caller is responsible for providing a valid shape, strides, and index offset.
+* -   The returned view adopts the provided `shape` and `strides` arrays without copying them. As ndarrays never expose their internal meta data arrays, multiple views may share the same `shape` and `strides` arrays, provided that the caller does not subsequently mutate them.
+* -   When the input ndarray is an instance of `@stdlib/ndarray/ctor`, the function bypasses the constructor's argument validation and defensive copying. When the input ndarray is an instance of a subclass of `@stdlib/ndarray/base/ctor`, the function delegates to the input ndarray's constructor. Otherwise, as an ndarray-like object's constructor is not guaranteed to have an ndarray constructor signature, the function returns an instance of `@stdlib/ndarray/ctor`.
+* -   The returned view has the same data type and data buffer as the input ndarray. Unless a memory layout is provided, the returned view has the same memory layout as the input ndarray.
+*
+* @param {ndarray} x - input ndarray
+* @param {NonNegativeIntegerArray} shape - view shape
+* @param {IntegerArray} strides - view strides
+* @param {NonNegativeInteger} offset - index offset
+* @param {boolean} writable - boolean indicating whether the returned ndarray should be writable
+* @param {string} [order] - view memory layout
+* @returns {ndarray} ndarray view
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/ctor' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var buffer = [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ];
+* var x = new ndarray( 'generic', buffer, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* // Create a view of the second row:
+* var y = view( x, [ 2 ], [ 1 ], 2, false );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ 3.0, 4.0 ]
+*
+* @example
+* var ndarray = require( '@stdlib/ndarray/ctor' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var buffer = [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ];
+* var x = new ndarray( 'generic', buffer, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+*
+* // Create a flattened view having a column-major memory layout:
+* var y = view( x, [ 6 ], [ 1 ], 0, false, 'column-major' );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ]
+*/
+function view( x, shape, strides, offset, writable, order ) {
+	var ctor;
+	var out;
+	var ord;
+
+	if ( arguments.length > 5 ) {
+		ord = order;
+	} else {
+		ord = getOrder( x );
+	}
+	ctor = x.constructor;
+	if ( ctor !== Ctor && x instanceof parent ) {
+		return new ctor( getDType( x ), getData( x ), shape, strides, offset, ord, { // eslint-disable-line max-len
+			'readonly': !writable
+		});
+	}
+	out = Object.create( Ctor.prototype );
+	parent.call( out, getDType( x ), getData( x ), shape, strides, offset, ord ); // eslint-disable-line max-len
+	out._mode = INDEX_MODE;
+	out._submode = [ INDEX_MODE ];
+	out._flags.READONLY = !writable;
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = view;
@@ -0,0 +1,225 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var isReadOnly = require( './../../../base/assert/is-read-only' );
+var ndarray = require( './../../../ctor' );
+var getShape = require( './../../../base/shape' );
+var getStrides = require( './../../../base/strides' );
+var getOffset = require( './../../../base/offset' );
+var getOrder = require( './../../../base/order' );
+var getDType = require( './../../../base/dtype' );
+var getData = require( './../../../base/data-buffer' );
+var ndarray2array = require( './../../../to-array' );
+var view = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Custom ndarray constructor.
+*
+* @private
+* @constructor
+* @param {string} dtype - data type
+* @param {Collection} buffer - data buffer
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {IntegerArray} strides - array strides
+* @param {NonNegativeInteger} offset - index offset
+* @param {string} order - memory layout
+* @param {Object} options - options
+* @returns {CustomArray} ndarray instance
+*/
+function CustomArray( dtype, buffer, shape, strides, offset, order, options ) {
+	if ( !( this instanceof CustomArray ) ) {
+		return new CustomArray( dtype, buffer, shape, strides, offset, order, options ); // eslint-disable-line max-len
+	}
+	ndarray.call( this, dtype, buffer, shape, strides, offset, order, options ); // eslint-disable-line max-len
+	return this;
+}
+
+CustomArray.prototype = Object.create( ndarray.prototype );
+CustomArray.prototype.constructor = CustomArray;
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof view, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns an ndarray view having specified meta data', function test( t ) {
+	var buf;
+	var x;
+	var y;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', buf, [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	y = view( x, [ 2 ], [ 1 ], 2, false );
+	t.strictEqual( y instanceof ndarray, true, 'returns expected value' );
+	t.strictEqual( getData( y ), buf, 'returns expected value' );
+	t.strictEqual( getDType( y ), 'float64', 'returns expected value' );
+	t.strictEqual( getOrder( y ), 'row-major', 'returns expected value' );
+	t.deepEqual( getShape( y, false ), [ 2 ], 'returns expected value' );
+	t.deepEqual( getStrides( y, false ), [ 1 ], 'returns expected value' );
+	t.strictEqual( getOffset( y ), 2, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 3.0, 4.0 ], 'returns expected value' );
+
+	y = view( x, [ 2, 3 ], [ 1, 2 ], 0, false );
+	t.deepEqual( ndarray2array( y ), [ [ 1.0, 3.0, 5.0 ], [ 2.0, 4.0, 6.0 ] ], 'returns expected value' );
+
+	y = view( x, [], [ 0 ], 5, false );
+	t.strictEqual( y.get(), 6.0, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports returning a read-only view', function test( t ) {
+	var x;
+	var y;
+
+	x = new ndarray( 'generic', [ 1, 2, 3, 4 ], [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = view( x, [ 2 ], [ 1 ], 2, false );
+
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		y.set( 0, 10 );
+	}
+});
+
+tape( 'the function supports returning a writable view', function test( t ) {
+	var x;
+	var y;
+
+	x = new ndarray( 'generic', [ 1, 2, 3, 4 ], [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = view( x, [ 2 ], [ 1 ], 2, true );
+
+	t.strictEqual( isReadOnly( y ), false, 'returns expected value' );
+	y.set( 1, 10 );
+	t.strictEqual( x.get( 1, 1 ), 10, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns a view which uses default index modes', function test( t ) {
+	var x;
+	var y;
+
+	x = new ndarray( 'generic', [ 1, 2, 3, 4 ], [ 2, 2 ], [ 2, 1 ], 0, 'row-major', {
+		'mode': 'clamp'
+	});
+	y = view( x, [ 2 ], [ 1 ], 0, false );
+
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		y.get( 10 );
+	}
+});
+
+tape( 'the function supports views sharing the same meta data arrays', function test( t ) {
+	var sh;
+	var st;
+	var x;
+	var y;
+	var z;
+
+	x = new ndarray( 'generic', [ 1, 2, 3, 4, 5, 6 ], [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	sh = [ 2 ];
+	st = [ 1 ];
+	y = view( x, sh, st, 0, false );
+	z = view( x, sh, st, 4, false );
+
+	t.deepEqual( ndarray2array( y ), [ 1, 2 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( z ), [ 5, 6 ], 'returns expected value' );
+
+	// Public accessors should return copies:
+	y.shape[ 0 ] = 10;
+	t.deepEqual( getShape( z, true ), [ 2 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns a view having the same constructor as the input ndarray', function test( t ) {
+	var x;
+	var y;
+
+	x = new CustomArray( 'generic', [ 1, 2, 3, 4 ], [ 2, 2 ], [ 2, 1 ], 0, 'column-major', {} );
+	y = view( x, [ 2 ], [ 2 ], 1, false );
+
+	t.strictEqual( y instanceof CustomArray, true, 'returns expected value' );
+	t.strictEqual( getOrder( y ), 'column-major', 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 2, 4 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying the memory layout of the returned view', function test( t ) {
+	var x;
+	var y;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1, 2, 3, 4, 5, 6 ] ), [ 3, 2 ], [ 2, 1 ], 0, 'row-major' );
+	y = view( x, [ 6 ], [ 1 ], 0, false, 'column-major' );
+
+	t.strictEqual( y instanceof ndarray, true, 'returns expected value' );
+	t.strictEqual( getOrder( y ), 'column-major', 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1, 2, 3, 4, 5, 6 ], 'returns expected value' );
+
+	x = new CustomArray( 'generic', [ 1, 2, 3, 4 ], [ 2, 2 ], [ 1, 2 ], 0, 'column-major', {} );
+	y = view( x, [ 4 ], [ 1 ], 0, true, 'row-major' );
+
+	t.strictEqual( y instanceof CustomArray, true, 'returns expected value' );
+	t.strictEqual( getOrder( y ), 'row-major', 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), false, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1, 2, 3, 4 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an `ndarray` instance when provided an ndarray-like object', function test( t ) {
+	var x;
+	var y;
+
+	x = {
+		'dtype': 'generic',
+		'data': [ 1, 2, 3, 4, 5, 6 ],
+		'shape': [ 3, 2 ],
+		'strides': [ 2, 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+	y = view( x, [ 2 ], [ 1 ], 2, false );
+
+	t.strictEqual( y instanceof ndarray, true, 'returns expected value' );
+	t.strictEqual( getOrder( y ), 'row-major', 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 3, 4 ], 'returns expected value' );
+	t.end();
+});
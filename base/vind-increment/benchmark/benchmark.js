@@ -0,0 +1,124 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isInteger = require( '@stdlib/assert/is-integer' ).isPrimitive;
+var shape2strides = require( './../../../base/shape2strides' );
+var strides2offset = require( './../../../base/strides2offset' );
+var vind2bind = require( './../../../base/vind2bind' );
+var numel = require( './../../../base/numel' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var vindIncrement = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s:order=row-major', pkg ), function benchmark( b ) {
+	var strides;
+	var shape;
+	var order;
+	var out;
+	var len;
+	var i;
+
+	shape = [ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 ];
+	order = 'row-major';
+	strides = shape2strides( shape, order );
+	strides[ 1 ] *= -1;
+	len = numel( shape );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = vindIncrement( shape, strides, order, 1+(i%(len-1)) );
+		if ( out !== out ) {
+			b.fail( 'should not return NaN' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( out ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:order=column-major', pkg ), function benchmark( b ) {
+	var strides;
+	var shape;
+	var order;
+	var out;
+	var len;
+	var i;
+
+	shape = [ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 ];
+	order = 'column-major';
+	strides = shape2strides( shape, order );
+	strides[ 1 ] *= -1;
+	len = numel( shape );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = vindIncrement( shape, strides, order, 1+(i%(len-1)) );
+		if ( out !== out ) {
+			b.fail( 'should not return NaN' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( out ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::vind2bind:order=row-major', pkg ), function benchmark( b ) {
+	var strides;
+	var offset;
+	var shape;
+	var order;
+	var out;
+	var len;
+	var i;
+
+	shape = [ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 ];
+	order = 'row-major';
+	strides = shape2strides( shape, order );
+	strides[ 1 ] *= -1;
+	offset = strides2offset( shape, strides );
+	len = numel( shape );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = vind2bind( shape, strides, offset, order, i%len, 'throw' );
+		if ( out !== out ) {
+			b.fail( 'should not return NaN' );
+		}
+	}
+	b.toc();
+	if ( !isInteger( out ) ) {
+		b.fail( 'should return an integer' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
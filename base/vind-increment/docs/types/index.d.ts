@@ -0,0 +1,55 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+import { Order } from '@stdlib/types/ndarray';
+
+/**
+* Returns the change in the linear index in an underlying data buffer when advancing from a linear index in an array view to the next linear index in the view.
+*
+* ## Notes
+*
+* -   The function assumes that `0 < idx < N`, where `N` is the number of array elements.
+*
+* @param shape - array shape
+* @param strides - stride array
+* @param order - specifies whether an array is row-major (C-style) or column-major (Fortran-style)
+* @param idx - linear index in an array view
+* @returns change in the linear index in an underlying data buffer
+*
+* @example
+* var shape = [ 2, 3 ];
+* var strides = [ -3, 1 ];
+* var order = 'row-major';
+*
+* var inc = vindIncrement( shape, strides, order, 1 );
+* // returns 1
+*
+* inc = vindIncrement( shape, strides, order, 3 );
+* // returns -5
+*/
+declare function vindIncrement( shape: ArrayLike<number>, strides: ArrayLike<number>, order: Order, idx: number ): number;
+
+
+// EXPORTS //
+
+export = vindIncrement;
@@ -0,0 +1,100 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import vindIncrement = require( './index' );
+
+
+// TESTS //
+
+// The function returns a number...
+{
+	const shape = [ 2, 3 ];
+	const strides = [ -3, 1 ];
+	const order = 'row-major';
+	vindIncrement( shape, strides, order, 1 ); // $ExpectType number
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object containing numbers...
+{
+	const strides = [ -3, 1 ];
+	const order = 'row-major';
+	vindIncrement( true, strides, order, 1 ); // $ExpectError
+	vindIncrement( false, strides, order, 1 ); // $ExpectError
+	vindIncrement( null, strides, order, 1 ); // $ExpectError
+	vindIncrement( undefined, strides, order, 1 ); // $ExpectError
+	vindIncrement( '5', strides, order, 1 ); // $ExpectError
+	vindIncrement( [ '1', '2' ], strides, order, 1 ); // $ExpectError
+	vindIncrement( {}, strides, order, 1 ); // $ExpectError
+	vindIncrement( ( x: number ): number => x, strides, order, 1 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an array-like object containing numbers...
+{
+	const shape = [ 2, 3 ];
+	const order = 'row-major';
+	vindIncrement( shape, true, order, 1 ); // $ExpectError
+	vindIncrement( shape, false, order, 1 ); // $ExpectError
+	vindIncrement( shape, null, order, 1 ); // $ExpectError
+	vindIncrement( shape, undefined, order, 1 ); // $ExpectError
+	vindIncrement( shape, '5', order, 1 ); // $ExpectError
+	vindIncrement( shape, [ '1', '2' ], order, 1 ); // $ExpectError
+	vindIncrement( shape, {}, order, 1 ); // $ExpectError
+	vindIncrement( shape, ( x: number ): number => x, order, 1 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a third argument which is not a recognized order...
+{
+	const shape = [ 2, 3 ];
+	const strides = [ -3, 1 ];
+	vindIncrement( shape, strides, 123, 1 ); // $ExpectError
+	vindIncrement( shape, strides, true, 1 ); // $ExpectError
+	vindIncrement( shape, strides, false, 1 ); // $ExpectError
+	vindIncrement( shape, strides, null, 1 ); // $ExpectError
+	vindIncrement( shape, strides, undefined, 1 ); // $ExpectError
+	vindIncrement( shape, strides, 'abc', 1 ); // $ExpectError
+	vindIncrement( shape, strides, [], 1 ); // $ExpectError
+	vindIncrement( shape, strides, {}, 1 ); // $ExpectError
+	vindIncrement( shape, strides, ( x: number ): number => x, 1 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a fourth argument which is not a number...
+{
+	const shape = [ 2, 3 ];
+	const strides = [ -3, 1 ];
+	const order = 'row-major';
+	vindIncrement( shape, strides, order, true ); // $ExpectError
+	vindIncrement( shape, strides, order, false ); // $ExpectError
+	vindIncrement( shape, strides, order, null ); // $ExpectError
+	vindIncrement( shape, strides, order, undefined ); // $ExpectError
+	vindIncrement( shape, strides, order, '5' ); // $ExpectError
+	vindIncrement( shape, strides, order, [ '1', '2' ] ); // $ExpectError
+	vindIncrement( shape, strides, order, {} ); // $ExpectError
+	vindIncrement( shape, strides, order, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const shape = [ 2, 3 ];
+	const strides = [ -3, 1 ];
+	const order = 'row-major';
+	vindIncrement(); // $ExpectError
+	vindIncrement( shape ); // $ExpectError
+	vindIncrement( shape, strides ); // $ExpectError
+	vindIncrement( shape, strides, order ); // $ExpectError
+	vindIncrement( shape, strides, order, 1, 1 ); // $ExpectError
+}
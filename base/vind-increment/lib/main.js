@@ -0,0 +1,85 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var isColumnMajor = require( './../../../base/assert/is-column-major-string' );
+
+
+// MAIN //
+
+/**
+* Returns the change in the linear index in an underlying data buffer when advancing from a linear index in an array view to the next linear index in the view.
+*
+* ## Notes
+*
+* -   The function computes the difference `vind2bind( idx ) - vind2bind( idx-1 )` without resolving either linear index to subscripts. Instead, the function propagates a carry from the innermost dimension outward, stopping at the first dimension which does not wrap around. Accordingly, when iterating over all elements in an array view, the average number of integer operations per call is bounded by a small constant, irrespective of the number of dimensions.
+* -   The function assumes that `0 < idx < N`, where `N` is the number of array elements.
+*
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {IntegerArray} strides - stride array
+* @param {string} order - specifies whether an array is row-major (C-style) or column-major (Fortran-style)
+* @param {PositiveInteger} idx - linear index in an array view
+* @returns {integer} change in the linear index in an underlying data buffer
+*
+* @example
+* var shape = [ 2, 3 ];
+* var strides = [ -3, 1 ];
+* var order = 'row-major';
+*
+* var inc = vindIncrement( shape, strides, order, 1 );
+* // returns 1
+*
+* inc = vindIncrement( shape, strides, order, 3 );
+* // returns -5
+*/
+function vindIncrement( shape, strides, order, idx ) {
+	var ndims;
+	var cm;
+	var inc;
+	var d;
+	var n;
+	var i;
+
+	ndims = shape.length;
+	cm = isColumnMajor( order );
+	inc = 0;
+	n = 1;
+	for ( i = 0; i < ndims; i++ ) {
+		d = ( cm ) ? i : ndims-1-i;
+		n *= shape[ d ];
+		if ( n === 0 ) {
+			return 0;
+		}
+		// Check whether the subscript for the current dimension can be incremented without wrapping around...
+		if ( idx%n !== 0 ) {
+			return inc + strides[ d ];
+		}
+		// Rewind the current dimension to its first element and carry to the next dimension:
+		inc -= ( shape[ d ]-1 ) * strides[ d ];
+	}
+	return inc;
+}
+
+
+// EXPORTS //
+
+module.exports = vindIncrement;
@@ -0,0 +1,72 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/base/vind_increment.h"
+#include "stdlib/ndarray/orders.h"
+#include <stdint.h>
+
+/**
+* Returns the change in the linear index in an underlying data buffer when advancing from a linear index in an array view to the next linear index in the view.
+*
+* ## Notes
+*
+* -   The function computes the difference `vind2bind( idx ) - vind2bind( idx-1 )` without resolving either linear index to subscripts. Instead, the function propagates a carry from the innermost dimension outward, stopping at the first dimension which does not wrap around. Accordingly, when iterating over all elements in an array view, the average number of integer operations per call is bounded by a small constant, irrespective of the number of dimensions.
+* -   The function assumes that `0 < idx < N`, where `N` is the number of array elements.
+* -   The returned value has the same units as the provided strides (e.g., bytes).
+*
+* @param ndims    number of dimensions
+* @param shape    array shape (dimensions)
+* @param strides  array strides
+* @param order    specifies whether an array is row-major (C-style) or column-major (Fortran-style)
+* @param idx      linear index in an array view
+* @return         change in the linear index in an underlying data buffer
+*
+* @example
+* #include "stdlib/ndarray/base/vind_increment.h"
+* #include "stdlib/ndarray/orders.h"
+*
+* int64_t ndims = 2;
+* int64_t shape[] = { 2, 3 };
+* int64_t strides[] = { -3, 1 };
+*
+* int64_t inc = stdlib_ndarray_vind_increment( ndims, shape, strides, STDLIB_NDARRAY_ROW_MAJOR, 3 );
+* // returns -5
+*/
+int64_t stdlib_ndarray_vind_increment( const int64_t ndims, const int64_t *shape, const int64_t *strides, const enum STDLIB_NDARRAY_ORDER order, const int64_t idx ) {
+	int64_t inc;
+	int64_t d;
+	int64_t n;
+	int64_t i;
+
+	inc = 0;
+	n = 1;
+	for ( i = 0; i < ndims; i++ ) {
+		d = ( order == STDLIB_NDARRAY_COLUMN_MAJOR ) ? i : ndims-1-i;
+		n *= shape[ d ];
+		if ( n == 0 ) {
+			return 0;
+		}
+		// Check whether the subscript for the current dimension can be incremented without wrapping around...
+		if ( idx % n != 0 ) {
+			return inc + strides[ d ];
+		}
+		// Rewind the current dimension to its first element and carry to the next dimension:
+		inc -= ( shape[ d ]-1 ) * strides[ d ];
+	}
+	return inc;
+}
@@ -0,0 +1,176 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var shape2strides = require( './../../../base/shape2strides' );
+var strides2offset = require( './../../../base/strides2offset' );
+var vind2bind = require( './../../../base/vind2bind' );
+var numel = require( './../../../base/numel' );
+var vindIncrement = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Tests whether the function returns the difference between consecutive buffer indices for every view index.
+*
+* @private
+* @param {Object} t - test object
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {IntegerArray} strides - stride array
+* @param {string} order - memory layout
+*/
+function check( t, shape, strides, order ) {
+	var offset;
+	var prev;
+	var ind;
+	var len;
+	var i;
+
+	offset = strides2offset( shape, strides );
+	len = numel( shape );
+	prev = vind2bind( shape, strides, offset, order, 0, 'throw' );
+	for ( i = 1; i < len; i++ ) {
+		ind = vind2bind( shape, strides, offset, order, i, 'throw' );
+		t.strictEqual( vindIncrement( shape, strides, order, i ), ind-prev, 'returns expected value (idx='+i+')' );
+		prev = ind;
+	}
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof vindIncrement, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns the change in the linear index in an underlying data buffer (order=row-major)', function test( t ) {
+	var strides;
+	var order;
+	var shape;
+	var inc;
+
+	shape = [ 2, 3 ];
+	order = 'row-major';
+	strides = [ -3, 1 ];
+
+	inc = vindIncrement( shape, strides, order, 1 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 2 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 3 );
+	t.strictEqual( inc, -5, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 4 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 5 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns the change in the linear index in an underlying data buffer (order=column-major)', function test( t ) {
+	var strides;
+	var order;
+	var shape;
+	var inc;
+
+	shape = [ 2, 3 ];
+	order = 'column-major';
+	strides = [ 1, -2 ];
+
+	inc = vindIncrement( shape, strides, order, 1 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 2 );
+	t.strictEqual( inc, -3, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 3 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 4 );
+	t.strictEqual( inc, -3, 'returns expected value' );
+
+	inc = vindIncrement( shape, strides, order, 5 );
+	t.strictEqual( inc, 1, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function is consistent with converting consecutive view indices to buffer indices (row-major)', function test( t ) {
+	var strides;
+	var shape;
+
+	shape = [ 3, 1, 4, 1, 2 ];
+	strides = shape2strides( shape, 'row-major' );
+	strides[ 0 ] *= -1;
+	strides[ 2 ] *= -1;
+	check( t, shape, strides, 'row-major' );
+	t.end();
+});
+
+tape( 'the function is consistent with converting consecutive view indices to buffer indices (column-major)', function test( t ) {
+	var strides;
+	var shape;
+
+	shape = [ 3, 1, 4, 1, 2 ];
+	strides = shape2strides( shape, 'column-major' );
+	strides[ 1 ] *= -1;
+	strides[ 4 ] *= -1;
+	check( t, shape, strides, 'column-major' );
+	t.end();
+});
+
+tape( 'the function is consistent with converting consecutive view indices to buffer indices (mixed order)', function test( t ) {
+	var strides;
+	var shape;
+
+	// Column-major strides iterated in row-major order:
+	shape = [ 2, 3, 2 ];
+	strides = shape2strides( shape, 'column-major' );
+	check( t, shape, strides, 'row-major' );
+
+	// Row-major strides iterated in column-major order:
+	strides = shape2strides( shape, 'row-major' );
+	check( t, shape, strides, 'column-major' );
+
+	t.end();
+});
+
+tape( 'the function is consistent with converting consecutive view indices to buffer indices (high-dimensional)', function test( t ) {
+	var strides;
+	var shape;
+
+	shape = [ 2, 1, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2 ];
+	strides = shape2strides( shape, 'row-major' );
+	strides[ 3 ] *= -1;
+	strides[ 10 ] *= -1;
+	check( t, shape, strides, 'row-major' );
+	check( t, shape, strides, 'column-major' );
+	t.end();
+});
@@ -0,0 +1,83 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isNonNegativeIntegerArray = require( '@stdlib/assert/is-nonnegative-integer-array' ).primitives;
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var loopOrder = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s::row-major', pkg ), function benchmark( b ) {
+	var strides;
+	var out;
+	var i;
+
+	strides = [
+		[ 100, 10, 1 ],
+		[ 200, 10, 1 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		strides[ 0 ][ 2 ] = ( i%2 ) + 1;
+		out = loopOrder( strides, [ 8, 8 ], 1 );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an array' );
+		}
+	}
+	b.toc();
+	if ( !isNonNegativeIntegerArray( out ) ) {
+		b.fail( 'should return an array of nonnegative integers' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s::mixed_layouts', pkg ), function benchmark( b ) {
+	var strides;
+	var out;
+	var i;
+
+	strides = [
+		[ 100, 10, 1 ],
+		[ 1, 10, 100 ]
+	];
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		strides[ 0 ][ 2 ] = ( i%2 ) + 1;
+		out = loopOrder( strides, [ 8, 8 ], 1 );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an array' );
+		}
+	}
+	b.toc();
+	if ( !isNonNegativeIntegerArray( out ) ) {
+		b.fail( 'should return an array of nonnegative integers' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
@@ -0,0 +1,53 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ArrayLike } from '@stdlib/types/array';
+
+/**
+* Returns a loop interchange permutation which minimizes the estimated cost of accessing the elements of multiple ndarrays.
+*
+* ## Notes
+*
+* -   The cost of making a dimension the innermost loop is estimated as the weighted sum, across all ndarrays, of the number of bytes each ndarray advances per iteration, where each contribution is capped at the size of a cache line. Output ndarrays are weighted more heavily than input ndarrays.
+* -   Dimensions having the same capped cost are ordered according to their uncapped weighted cost.
+* -   The last `nout` stride arrays are assumed to correspond to output ndarrays.
+* -   If an element size is not a positive number (e.g., `null` for "generic" ndarrays), the function assumes an element size of `8` bytes.
+* -   The returned permutation lists dimension indices from the innermost loop to the outermost loop.
+*
+* @param strides - list of stride arrays (in units of elements) for each input and output ndarray
+* @param nbytes - list of element sizes (in bytes) for each ndarray
+* @param nout - number of output ndarrays
+* @returns dimension indices sorted in loop order
+*
+* @example
+* var sx = [ 4, 1 ]; // row-major
+* var sy = [ 1, 4 ]; // column-major
+*
+* var idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+* // returns [ 0, 1 ]
+*/
+declare function loopOrder( strides: ArrayLike<ArrayLike<number>>, nbytes: ArrayLike<number | null>, nout: number ): Array<number>;
+
+
+// EXPORTS //
+
+export = loopOrder;
@@ -0,0 +1,75 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import loopOrder = require( './index' );
+
+
+// TESTS //
+
+// The function returns an array of numbers...
+{
+	const sx = [ 2, 1 ];
+	const sy = [ 1, 2 ];
+	loopOrder( [ sx, sy ], [ 8, 8 ], 1 ); // $ExpectType number[]
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an array-like object containing arrays of numbers...
+{
+	loopOrder( true, [ 8, 8 ], 1 ); // $ExpectError
+	loopOrder( false, [ 8, 8 ], 1 ); // $ExpectError
+	loopOrder( '5', [ 8, 8 ], 1 ); // $ExpectError
+	loopOrder( 123, [ 8, 8 ], 1 ); // $ExpectError
+	loopOrder( {}, [ 8, 8 ], 1 ); // $ExpectError
+	loopOrder( ( x: number ): number => x, [ 8, 8 ], 1 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an array-like object...
+{
+	const sx = [ 2, 1 ];
+	const sy = [ 1, 2 ];
+
+	loopOrder( [ sx, sy ], true, 1 ); // $ExpectError
+	loopOrder( [ sx, sy ], false, 1 ); // $ExpectError
+	loopOrder( [ sx, sy ], 123, 1 ); // $ExpectError
+	loopOrder( [ sx, sy ], {}, 1 ); // $ExpectError
+	loopOrder( [ sx, sy ], ( x: number ): number => x, 1 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a third argument which is not a number...
+{
+	const sx = [ 2, 1 ];
+	const sy = [ 1, 2 ];
+
+	loopOrder( [ sx, sy ], [ 8, 8 ], true ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ], false ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ], '5' ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ], [] ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ], {} ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ], ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const sx = [ 2, 1 ];
+	const sy = [ 1, 2 ];
+
+	loopOrder(); // $ExpectError
+	loopOrder( [ sx, sy ] ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ] ); // $ExpectError
+	loopOrder( [ sx, sy ], [ 8, 8 ], 1, {} ); // $ExpectError
+}
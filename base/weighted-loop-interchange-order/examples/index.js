@@ -0,0 +1,41 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var loopOrder = require( './../lib' );
+
+// Define the strides for a row-major input array:
+var sx = [ 1000, 1 ];
+
+// Define the strides for a column-major output array (e.g., when copying a transposed view):
+var sy = [ 1, 1000 ];
+
+// Resolve a loop order which favors contiguous writes:
+var idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+console.log( 'loop order: [ %s ]', idx.join( ', ' ) );
+// => 'loop order: [ 0, 1 ]'
+
+// Define the strides for three row-major input arrays and a column-major output array:
+var strides = [ sx, sx, sx, sy ];
+
+// Resolve a loop order which favors the reads shared by the majority of arrays:
+idx = loopOrder( strides, [ 8, 8, 8, 8 ], 1 );
+console.log( 'loop order: [ %s ]', idx.join( ', ' ) );
+// => 'loop order: [ 1, 0 ]'
@@ -0,0 +1,42 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef STDLIB_NDARRAY_BASE_WEIGHTED_LOOP_INTERCHANGE_ORDER_H
+#define STDLIB_NDARRAY_BASE_WEIGHTED_LOOP_INTERCHANGE_ORDER_H
+
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Computes a loop interchange permutation which minimizes the estimated cost of accessing the elements of multiple ndarrays.
+*/
+void stdlib_ndarray_weighted_loop_interchange_order( const int64_t ndims, const int64_t narrays, struct ndarray *arrays[], const int64_t nout, int64_t *workspace, int64_t *out );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_BASE_WEIGHTED_LOOP_INTERCHANGE_ORDER_H
@@ -0,0 +1,44 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+/**
+* Return a loop interchange permutation which minimizes the estimated cost of accessing the elements of multiple ndarrays.
+*
+* @module @stdlib/ndarray/base/weighted-loop-interchange-order
+*
+* @example
+* var loopOrder = require( '@stdlib/ndarray/base/weighted-loop-interchange-order' );
+*
+* var sx = [ 4, 1 ]; // row-major
+* var sy = [ 1, 4 ]; // column-major
+*
+* var idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+* // returns [ 0, 1 ]
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
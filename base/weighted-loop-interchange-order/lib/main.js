@@ -0,0 +1,152 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+
+
+// VARIABLES //
+
+// Assumed cache line size (in bytes):
+var CACHE_LINE_SIZE = 64;
+
+// Default element size (in bytes) when an element size is unknown (e.g., for "generic" ndarrays):
+var DEFAULT_NBYTES = 8;
+
+// Relative cost of writing an element compared to reading an element:
+var WRITE_WEIGHT = 2;
+
+
+// FUNCTIONS //
+
+/**
+* Resolves an element size.
+*
+* @private
+* @param {*} nbytes - element size
+* @returns {PositiveInteger} element size (in bytes)
+*/
+function elementSize( nbytes ) {
+	if ( typeof nbytes === 'number' && nbytes > 0 ) {
+		return nbytes;
+	}
+	return DEFAULT_NBYTES;
+}
+
+
+// MAIN //
+
+/**
+* Returns a loop interchange permutation which minimizes the estimated cost of accessing the elements of multiple ndarrays.
+*
+* ## Notes
+*
+* -   The cost of making a dimension the innermost loop is estimated as the weighted sum, across all ndarrays, of the number of bytes each ndarray advances per iteration, where each contribution is capped at the size of a cache line (i.e., once a stride exceeds a cache line, every access touches a new cache line irrespective of the stride magnitude). Output ndarrays are weighted more heavily than input ndarrays, as a cache miss on a write requires both reading and eventually writing back a cache line.
+* -   Dimensions having the same capped cost are ordered according to their uncapped weighted cost.
+* -   The last `nout` stride arrays are assumed to correspond to output ndarrays.
+* -   If an element size is not a positive number (e.g., `null` for "generic" ndarrays), the function assumes an element size of `8` bytes.
+* -   The returned permutation lists dimension indices from the innermost loop to the outermost loop.
+*
+* @param {ArrayLikeObject<IntegerArray>} strides - list of stride arrays (in units of elements) for each input and output ndarray
+* @param {ArrayLikeObject} nbytes - list of element sizes (in bytes) for each ndarray
+* @param {NonNegativeInteger} nout - number of output ndarrays
+* @returns {NonNegativeIntegerArray} dimension indices sorted in loop order
+*
+* @example
+* var sx = [ 4, 1 ]; // row-major
+* var sy = [ 1, 4 ]; // column-major
+*
+* var idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+* // returns [ 0, 1 ]
+*
+* @example
+* var sx = [ 12, 4, 1 ]; // row-major
+* var sy = [ 24, 8, 1 ]; // row-major
+* var sz = [ 1, 2, 6 ]; // column-major
+*
+* var idx = loopOrder( [ sx, sy, sz ], [ 8, 8, 8 ], 1 );
+* // returns [ 2, 1, 0 ]
+*/
+function loopOrder( strides, nbytes, nout ) {
+	var cost;
+	var tie;
+	var idx;
+	var ndims;
+	var N;
+	var w;
+	var b;
+	var s;
+	var c;
+	var t;
+	var i;
+	var j;
+	var k;
+
+	N = strides.length;
+	if ( N === 0 ) {
+		return [];
+	}
+	ndims = strides[ 0 ].length;
+
+	// Compute the estimated cost of making each dimension the innermost loop:
+	cost = [];
+	tie = [];
+	for ( i = 0; i < ndims; i++ ) {
+		c = 0;
+		t = 0;
+		for ( k = 0; k < N; k++ ) {
+			w = ( k >= N-nout ) ? WRITE_WEIGHT : 1;
+			b = elementSize( nbytes[ k ] );
+			s = strides[ k ][ i ];
+			if ( s < 0 ) {
+				s = -s;
+			}
+			s *= b;
+			c += w * ( ( s < CACHE_LINE_SIZE ) ? s : CACHE_LINE_SIZE );
+			t += w * s;
+		}
+		cost.push( c );
+		tie.push( t );
+	}
+	// Initialize a loop interchange index array for generating a loop order permutation:
+	idx = zeroTo( ndims );
+
+	// Sort dimension indices in increasing order of cost using a stable insertion sort:
+	for ( i = 1; i < ndims; i++ ) {
+		k = idx[ i ];
+		c = cost[ k ];
+		t = tie[ k ];
+		for ( j = i-1; j >= 0; j-- ) {
+			if ( cost[ idx[ j ] ] < c || ( cost[ idx[ j ] ] === c && tie[ idx[ j ] ] <= t ) ) {
+				break;
+			}
+			idx[ j+1 ] = idx[ j ];
+		}
+		idx[ j+1 ] = k;
+	}
+	return idx;
+}
+
+
+// EXPORTS //
+
+module.exports = loopOrder;
@@ -0,0 +1,121 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "stdlib/ndarray/base/weighted_loop_interchange_order.h"
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+// Assumed cache line size (in bytes):
+#define CACHE_LINE_SIZE 64
+
+// Relative cost of writing an element compared to reading an element:
+#define WRITE_WEIGHT 2
+
+/**
+* Computes the estimated cost of making a specified dimension the innermost loop.
+*
+* @private
+* @param dim      dimension index
+* @param narrays  number of ndarrays
+* @param arrays   array containing pointers to input and output ndarrays
+* @param nout     number of output ndarrays
+* @param capped   output pointer for storing the weighted cost when each stride is capped at the size of a cache line
+* @param total    output pointer for storing the uncapped weighted cost
+*/
+static void dimension_cost( const int64_t dim, const int64_t narrays, struct ndarray *arrays[], const int64_t nout, int64_t *capped, int64_t *total ) {
+	int64_t w;
+	int64_t s;
+	int64_t k;
+
+	*capped = 0;
+	*total = 0;
+	for ( k = 0; k < narrays; k++ ) {
+		w = ( k >= narrays-nout ) ? WRITE_WEIGHT : 1;
+		s = stdlib_ndarray_stride( arrays[ k ], dim );
+		if ( s < 0 ) {
+			s = -s;
+		}
+		*capped += w * ( ( s < CACHE_LINE_SIZE ) ? s : CACHE_LINE_SIZE );
+		*total += w * s;
+	}
+}
+
+/**
+* Computes a loop interchange permutation which minimizes the estimated cost of accessing the elements of multiple ndarrays.
+*
+* ## Notes
+*
+* -   The cost of making a dimension the innermost loop is estimated as the weighted sum, across all ndarrays, of the number of bytes each ndarray advances per iteration, where each contribution is capped at the size of a cache line (i.e., once a stride exceeds a cache line, every access touches a new cache line irrespective of the stride magnitude). Output ndarrays are weighted more heavily than input ndarrays, as a cache miss on a write requires both reading and eventually writing back a cache line.
+* -   Dimensions having the same capped cost are ordered according to their uncapped weighted cost.
+* -   The last `nout` ndarrays are assumed to be output ndarrays.
+* -   The function assumes that all ndarrays have the same number of dimensions.
+* -   The output array is populated with dimension indices sorted from the innermost loop to the outermost loop.
+* -   The workspace array must have `2*ndims` elements and is used for storing the estimated cost of each dimension, such that each cost is computed once prior to sorting.
+*
+* @param ndims      number of dimensions
+* @param narrays    number of ndarrays
+* @param arrays     array containing pointers to input and output ndarrays
+* @param nout       number of output ndarrays
+* @param workspace  workspace array for storing the capped and uncapped weighted cost of each dimension
+* @param out        output array for storing dimension indices sorted in loop order
+*
+* @example
+* #include "stdlib/ndarray/base/weighted_loop_interchange_order.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include <stdint.h>
+*
+* // ...
+*
+* struct ndarray *arrays[] = { x, y };
+* int64_t cost[ 4 ];
+* int64_t idx[ 2 ];
+*
+* stdlib_ndarray_weighted_loop_interchange_order( 2, 2, arrays, 1, cost, idx );
+*/
+void stdlib_ndarray_weighted_loop_interchange_order( const int64_t ndims, const int64_t narrays, struct ndarray *arrays[], const int64_t nout, int64_t *workspace, int64_t *out ) {
+	int64_t *cost;
+	int64_t *tie;
+	int64_t c;
+	int64_t t;
+	int64_t i;
+	int64_t j;
+	int64_t k;
+
+	cost = workspace;
+	tie = workspace + ndims;
+
+	// Compute the estimated cost of making each dimension the innermost loop:
+	for ( i = 0; i < ndims; i++ ) {
+		dimension_cost( i, narrays, arrays, nout, cost+i, tie+i );
+		out[ i ] = i;
+	}
+	// Sort dimension indices in increasing order of cost using a stable insertion sort:
+	for ( i = 1; i < ndims; i++ ) {
+		k = out[ i ];
+		c = cost[ k ];
+		t = tie[ k ];
+		for ( j = i-1; j >= 0; j-- ) {
+			if ( cost[ out[ j ] ] < c || ( cost[ out[ j ] ] == c && tie[ out[ j ] ] <= t ) ) {
+				break;
+			}
+			out[ j+1 ] = out[ j ];
+		}
+		out[ j+1 ] = k;
+	}
+}
@@ -0,0 +1,216 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var isArray = require( '@stdlib/assert/is-array' );
+var loopOrder = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof loopOrder, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function returns a loop interchange permutation (row-major)', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 12, 4, 1 ];
+	sy = [ 24, 8, 2 ];
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+
+	t.strictEqual( isArray( idx ), true, 'returns expected value' );
+	t.deepEqual( idx, [ 2, 1, 0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a loop interchange permutation (column-major)', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 1, -2, 6 ];
+	sy = [ 1, 2, 6 ];
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	t.deepEqual( idx, [ 0, 1, 2 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function does not mutate provided stride arrays', function test( t ) {
+	var sx;
+	var sy;
+
+	sx = [ 12, 4, 1 ];
+	sy = [ 1, 2, 6 ];
+
+	loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	t.deepEqual( sx, [ 12, 4, 1 ], 'returns expected value' );
+	t.deepEqual( sy, [ 1, 2, 6 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function favors contiguous writes when an input and an output ndarray have different layouts (e.g., transpose)', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 100, 1 ]; // row-major
+	sy = [ 1, 100 ]; // column-major
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	t.deepEqual( idx, [ 0, 1 ], 'returns expected value' );
+
+	sx = [ 1, 100 ]; // column-major
+	sy = [ 100, 1 ]; // row-major
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	t.deepEqual( idx, [ 1, 0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function favors the layout shared by the majority of ndarrays when the reads outweigh the writes', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+	var sz;
+	var sw;
+
+	sx = [ 100, 1 ]; // row-major
+	sy = [ 100, 1 ]; // row-major
+	sz = [ 100, 1 ]; // row-major
+	sw = [ 1, 100 ]; // column-major
+
+	idx = loopOrder( [ sx, sy, sz, sw ], [ 8, 8, 8, 8 ], 1 );
+	t.deepEqual( idx, [ 1, 0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function weighs each ndarray according to its element size', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 100, 1 ]; // row-major
+	sy = [ 1, 100 ]; // column-major
+
+	// A stride of 1 is a contiguous read, but a stride of 100 in the output array is a cache miss...
+	idx = loopOrder( [ sx, sy ], [ 1, 1 ], 1 );
+	t.deepEqual( idx, [ 0, 1 ], 'returns expected value' );
+
+	sx = [ 4, 1 ]; // row-major
+	sy = [ 1, 4 ]; // column-major
+
+	// When elements are small enough that every stride fits within a cache line, a wider input element dominates...
+	idx = loopOrder( [ sx, sy ], [ 16, 1 ], 1 );
+	t.deepEqual( idx, [ 1, 0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function assumes a default element size when an element size is unknown', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 100, 1 ];
+	sy = [ 1, 100 ];
+
+	idx = loopOrder( [ sx, sy ], [ null, null ], 1 );
+	t.deepEqual( idx, [ 0, 1 ], 'returns expected value' );
+
+	idx = loopOrder( [ sx, sy ], [ null, 8 ], 1 );
+	t.deepEqual( idx, [ 0, 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function treats all ndarrays as inputs when the number of outputs is zero', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 10, 1 ];
+	sy = [ 1, 10 ];
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 0 );
+	t.deepEqual( idx, [ 0, 1 ], 'returns expected value' );
+
+	idx = loopOrder( [ sy, sx ], [ 8, 8 ], 0 );
+	t.deepEqual( idx, [ 0, 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function orders dimensions whose strides all exceed a cache line according to stride magnitude', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 1000, 10000, 100, 1 ];
+	sy = [ 1000, 10000, 100, 1 ];
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	t.deepEqual( idx, [ 3, 2, 0, 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function preserves the relative order of dimensions having equal cost', function test( t ) {
+	var idx;
+	var sx;
+	var sy;
+
+	sx = [ 0, 1, 0 ];
+	sy = [ 0, 1, 0 ];
+
+	idx = loopOrder( [ sx, sy ], [ 8, 8 ], 1 );
+	t.deepEqual( idx, [ 0, 2, 1 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional ndarrays', function test( t ) {
+	var idx;
+
+	idx = loopOrder( [ [], [] ], [ 8, 8 ], 1 );
+	t.deepEqual( idx, [], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns an empty array if provided an empty list of stride arrays', function test( t ) {
+	var idx = loopOrder( [], [], 0 );
+	t.deepEqual( idx, [], 'returns expected value' );
+	t.end();
+});
@@ -33,6 +33,30 @@ interface Options {
 	dim?: number;
 }
 
+/**
+* Interface describing a buffer pool.
+*/
+interface BufferPool {
+	/**
+	* Returns a uninitialized data buffer having a specified data type and length.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*/
+	malloc( dtype: any, size: number ): any;
+}
+
+/**
+* Interface describing `concat` options.
+*/
+interface ConcatOptions extends Options {
+	/**
+	* Buffer pool from which to allocate the output ndarray data buffer.
+	*/
+	pool?: BufferPool;
+}
+
 /**
 * Interface describing `concat`.
 */
@@ -59,7 +83,7 @@ interface Concat {
 	* });
 	* // returns <ndarray>[ [ -1.0, 2.0, -5.0, 6.0, -7.0 ], [ -3.0, 4.0, 8.0, -9.0, 10.0 ] ]
 	*/
-	<T = unknown>( arrays: ArrayLike<typedndarray<T>>, options?: Options ): typedndarray<T>;
+	<T = unknown>( arrays: ArrayLike<typedndarray<T>>, options?: ConcatOptions ): typedndarray<T>;
 
 	/**
 	* Concatenates a list of ndarrays along a specified ndarray dimension and assigns results to a provided output ndarray.
@@ -44,6 +44,7 @@ var base = require( './base.js' );
 * @param {ArrayLikeObject<ndarrayLike>} arrays - array-like object containing input ndarrays
 * @param {Options} [options] - function options
 * @param {integer} [options.dim=-1] - dimension along which to concatenate the input ndarrays
+* @param {Object} [options.pool] - buffer pool from which to allocate the output ndarray data buffer (e.g., as returned by `@stdlib/ndarray/base/buffer-pool`)
 * @throws {TypeError} first argument must be an array of ndarray-like objects
 * @throws {RangeError} first argument must contain one or more ndarrays
 * @throws {TypeError} options argument must be an object
@@ -65,6 +66,7 @@ var base = require( './base.js' );
 * // returns <ndarray>[ [ -1.0, 2.0, -5.0, 6.0, -7.0 ], [ -3.0, 4.0, 8.0, -9.0, 10.0 ] ]
 */
 function concat( arrays ) {
+	var eopts;
 	var opts;
 	var arrs;
 	var err;
@@ -99,10 +101,14 @@ function concat( arrays ) {
 	d = normalizeIndex( opts.dim, ndims( arrs[ 0 ] )-1 );
 
 	// Create an output ndarray:
-	out = empty( resolveShape( arrs, d ), {
+	eopts = {
 		'dtype': dt,
 		'order': resolveOrder( arrs )
-	});
+	};
+	if ( opts.pool ) {
+		eopts.pool = opts.pool;
+	}
+	out = empty( resolveShape( arrs, d ), eopts );
 
 	// Perform concatenation:
 	return base( arrs, d, out );
@@ -22,6 +22,7 @@
 
 var isObject = require( '@stdlib/assert/is-plain-object' );
 var isNegativeInteger = require( '@stdlib/assert/is-negative-integer' ).isPrimitive;
+var isFunction = require( '@stdlib/assert/is-function' );
 var hasOwnProp = require( '@stdlib/assert/has-own-property' );
 var format = require( '@stdlib/string/format' );
 
@@ -35,6 +36,7 @@ var format = require( '@stdlib/string/format' );
 * @param {Object} opts - destination object
 * @param {Options} options - function options
 * @param {integer} [options.dim] - dimension along which to concatenate the input ndarrays
+* @param {Object} [options.pool] - buffer pool from which to allocate the output ndarray data buffer
 * @returns {(Error|null)} null or an error object
 *
 * @example
@@ -57,6 +59,12 @@ function validate( opts, options ) {
 			return new TypeError( format( 'invalid option. `%s` option must be a negative integer. Option: `%s`.', 'dim', opts.dim ) );
 		}
 	}
+	if ( hasOwnProp( options, 'pool' ) ) {
+		opts.pool = options.pool;
+		if ( !isObject( opts.pool ) || !isFunction( opts.pool.malloc ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be a buffer pool. Option: `%s`.', 'pool', opts.pool ) );
+		}
+	}
 	return null;
 }
 
@@ -32,6 +32,8 @@ var Float64Array = require( '@stdlib/array/float64' );
 var Int32Array = require( '@stdlib/array/int32' );
 var zeros = require( './../../zeros' );
 var empty = require( './../../empty' );
+var bufferPool = require( './../../base/buffer-pool' );
+var getData = require( './../../data-buffer' );
 var concat = require( './../lib/main.js' );
 
 
@@ -508,3 +510,34 @@ tape( 'the function concatenates ndarrays along a specified dimension (ndims=1)'
 
 	t.end();
 });
+
+tape( 'the function supports allocating the output ndarray data buffer from a buffer pool', function test( t ) {
+	var expected;
+	var pool;
+	var xbuf;
+	var ybuf;
+	var buf;
+	var out;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 2 ], [ 1 ], 0, 'row-major' );
+
+	ybuf = new Float64Array( [ 3.0, 4.0, 5.0 ] );
+	y = new ndarray( 'float64', ybuf, [ 3 ], [ 1 ], 0, 'row-major' );
+
+	pool = bufferPool();
+	buf = pool.malloc( 'float64', 5 );
+	pool.free( buf );
+
+	out = concat( [ x, y ], {
+		'pool': pool
+	});
+	expected = [ 1.0, 2.0, 3.0, 4.0, 5.0 ];
+
+	t.strictEqual( getData( out ).buffer, buf.buffer, 'returns expected value' );
+	t.strictEqual( pool.stats().hits, 1, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), expected, 'returns expected value' );
+	t.end();
+});
@@ -85,6 +85,36 @@ tape( 'the function returns an error if provided a `dim` option which is not a n
 	t.end();
 });
 
+tape( 'the function returns an error if provided a `pool` option which is not a buffer pool', function test( t ) {
+	var values;
+	var err;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		{
+			'malloc': 5
+		},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		err = validate( {}, {
+			'pool': values[i]
+		});
+		t.strictEqual( err instanceof TypeError, true, 'returns an error when provided '+values[i] );
+	}
+	t.end();
+});
+
 tape( 'the function returns `null` if all options are valid', function test( t ) {
 	var expected;
 	var options;
@@ -21,6 +21,7 @@
 #include "stdlib/ndarray/index_modes.h"
 #include "stdlib/ndarray/orders.h"
 #include "stdlib/ndarray/base/bytes_per_element.h"
+#include "stdlib/ndarray/base/iteration_order.h"
 #include "stdlib/ndarray/base/dtype_char.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -97,6 +98,9 @@ int main( void ) {
 	// Explicitly set the array flags:
 	x1->flags = stdlib_ndarray_flags( x1 );
 
+	// Explicitly set the iteration order:
+	x1->iterationOrder = stdlib_ndarray_iteration_order( x1->ndims, x1->strides );
+
 	printf( "dtype = %d\n", stdlib_ndarray_dtype( x1 ) );
 	printf( "length = %"PRId64"\n", stdlib_ndarray_length( x1 ) );
 	printf( "byteLength = %"PRId64"\n", stdlib_ndarray_byte_length( x1 ) );
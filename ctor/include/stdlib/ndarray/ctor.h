@@ -29,8 +29,10 @@
 #include "ctor/get.h"
 #include "ctor/get_ptr.h"
 #include "ctor/iget.h"
+#include "ctor/iget_many.h"
 #include "ctor/iget_ptr.h"
 #include "ctor/iset.h"
+#include "ctor/iset_many.h"
 #include "ctor/macros.h"
 #include "ctor/ndarray.h"
 #include "ctor/set.h"
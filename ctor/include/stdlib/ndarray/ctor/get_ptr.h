@@ -22,6 +22,7 @@
 #include "ndarray.h"
 #include "stdlib/complex/float32/ctor.h"
 #include "stdlib/complex/float64/ctor.h"
+#include "stdlib/ndarray/base/half_precision.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -45,6 +46,11 @@ int8_t stdlib_ndarray_get_ptr_float64( const uint8_t *idx, double *out );
 */
 int8_t stdlib_ndarray_get_ptr_float32( const uint8_t *idx, float *out );
 
+/**
+* Returns a half-precision floating-point ndarray data element specified by a byte array pointer.
+*/
+int8_t stdlib_ndarray_get_ptr_float16( const uint8_t *idx, stdlib_float16_t *out );
+
 /**
 * Returns an unsigned 64-bit integer ndarray data element specified by a byte array pointer.
 */
@@ -22,6 +22,7 @@
 #include "ndarray.h"
 #include "stdlib/complex/float32/ctor.h"
 #include "stdlib/complex/float64/ctor.h"
+#include "stdlib/ndarray/base/half_precision.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -40,6 +41,11 @@ int8_t stdlib_ndarray_iget_float64( const struct ndarray *arr, const int64_t idx
 */
 int8_t stdlib_ndarray_iget_float32( const struct ndarray *arr, const int64_t idx, float *out );
 
+/**
+* Returns a half-precision floating-point ndarray data element located at a specified linear index.
+*/
+int8_t stdlib_ndarray_iget_float16( const struct ndarray *arr, const int64_t idx, stdlib_float16_t *out );
+
 /**
 * Returns an unsigned 64-bit integer ndarray data element located at a specified linear index.
 */
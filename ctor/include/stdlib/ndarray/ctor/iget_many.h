@@ -0,0 +1,98 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_CTOR_IGET_MANY_H
+#define STDLIB_NDARRAY_CTOR_IGET_MANY_H
+
+#include "ndarray.h"
+#include "stdlib/complex/float32/ctor.h"
+#include "stdlib/complex/float64/ctor.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+* Returns ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, void *out );
+
+/**
+* Returns double-precision floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_float64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, double *out );
+
+/**
+* Returns single-precision floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_float32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, float *out );
+
+/**
+* Returns unsigned 64-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_uint64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint64_t *out );
+
+/**
+* Returns signed 64-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_int64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int64_t *out );
+
+/**
+* Returns unsigned 32-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_uint32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint32_t *out );
+
+/**
+* Returns signed 32-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_int32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int32_t *out );
+
+/**
+* Returns unsigned 16-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_uint16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint16_t *out );
+
+/**
+* Returns signed 16-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_int16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int16_t *out );
+
+/**
+* Returns unsigned 8-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_uint8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint8_t *out );
+
+/**
+* Returns signed 8-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_int8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int8_t *out );
+
+/**
+* Returns double-precision complex floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_complex128_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, stdlib_complex128_t *out );
+
+/**
+* Returns single-precision complex floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_complex64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, stdlib_complex64_t *out );
+
+/**
+* Returns boolean ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iget_bool_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, bool *out );
+
+#endif // !STDLIB_NDARRAY_CTOR_IGET_MANY_H
@@ -22,6 +22,7 @@
 #include "ndarray.h"
 #include "stdlib/complex/float32/ctor.h"
 #include "stdlib/complex/float64/ctor.h"
+#include "stdlib/ndarray/base/half_precision.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -40,6 +41,11 @@ int8_t stdlib_ndarray_iset_float64( const struct ndarray *arr, const int64_t idx
 */
 int8_t stdlib_ndarray_iset_float32( const struct ndarray *arr, const int64_t idx, const float v );
 
+/**
+* Sets a half-precision floating-point ndarray data element located at a specified linear index.
+*/
+int8_t stdlib_ndarray_iset_float16( const struct ndarray *arr, const int64_t idx, const stdlib_float16_t v );
+
 /**
 * Sets an unsigned 64-bit integer ndarray data element located at a specified linear index.
 */
@@ -0,0 +1,98 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_CTOR_ISET_MANY_H
+#define STDLIB_NDARRAY_CTOR_ISET_MANY_H
+
+#include "ndarray.h"
+#include "stdlib/complex/float32/ctor.h"
+#include "stdlib/complex/float64/ctor.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+* Sets ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const void *v );
+
+/**
+* Sets double-precision floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_float64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const double *v );
+
+/**
+* Sets single-precision floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_float32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const float *v );
+
+/**
+* Sets unsigned 64-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_uint64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint64_t *v );
+
+/**
+* Sets signed 64-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_int64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int64_t *v );
+
+/**
+* Sets unsigned 32-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_uint32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint32_t *v );
+
+/**
+* Sets signed 32-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_int32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int32_t *v );
+
+/**
+* Sets unsigned 16-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_uint16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint16_t *v );
+
+/**
+* Sets signed 16-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_int16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int16_t *v );
+
+/**
+* Sets unsigned 8-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_uint8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint8_t *v );
+
+/**
+* Sets signed 8-bit integer ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_int8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int8_t *v );
+
+/**
+* Sets double-precision complex floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_complex128_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const stdlib_complex128_t *v );
+
+/**
+* Sets single-precision complex floating-point ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_complex64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const stdlib_complex64_t *v );
+
+/**
+* Sets boolean ndarray data elements located at specified linear indices.
+*/
+int8_t stdlib_ndarray_iset_bool_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const bool *v );
+
+#endif // !STDLIB_NDARRAY_CTOR_ISET_MANY_H
@@ -34,6 +34,7 @@
 * #include "stdlib/ndarray/index_modes.h"
 * #include "stdlib/ndarray/orders.h"
 * #include "stdlib/ndarray/base/bytes_per_element.h"
+* #include "stdlib/ndarray/base/iteration_order.h"
 * #include <stdlib.h>
 * #include <stdio.h>
 * #include <stdint.h>
@@ -87,6 +88,9 @@
 * // Explicitly set the array flags:
 * x->flags = stdlib_ndarray_flags( x );
 *
+* // Explicitly set the iteration order:
+* x->iterationOrder = stdlib_ndarray_iteration_order( x->ndims, x->strides );
+*
 * // Free allocated memory:
 * stdlib_ndarray_free( x );
 */
@@ -132,6 +136,9 @@ struct ndarray {
 
 	// Bit mask providing information regarding the memory layout of the array (e.g., see macros):
 	int64_t flags;
+
+	// Iteration order based on array strides (`1`: all nonnegative strides; `-1`: all negative strides; `0`: mixed signs):
+	int8_t iterationOrder;
 };
 
 #endif // !STDLIB_NDARRAY_CTOR_NDARRAY_H
@@ -22,6 +22,7 @@
 #include "ndarray.h"
 #include "stdlib/complex/float32/ctor.h"
 #include "stdlib/complex/float64/ctor.h"
+#include "stdlib/ndarray/base/half_precision.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -40,6 +41,11 @@ int8_t stdlib_ndarray_set_ptr_float64( uint8_t *idx, const double v );
 */
 int8_t stdlib_ndarray_set_ptr_float32( uint8_t *idx, const float v );
 
+/**
+* Sets a half-precision floating-point ndarray data element specified by a byte array pointer.
+*/
+int8_t stdlib_ndarray_set_ptr_float16( uint8_t *idx, const stdlib_float16_t v );
+
 /**
 * Sets an unsigned 64-bit integer ndarray data element specified by a byte array pointer.
 */
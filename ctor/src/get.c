@@ -88,6 +88,27 @@ int8_t stdlib_ndarray_get_float32( const struct ndarray *arr, const int64_t *sub
 	return stdlib_ndarray_get_ptr_float32( idx, out );
 }
 
+/**
+* Returns a half-precision floating-point ndarray data element.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output address type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise.
+*
+* @param arr  input ndarray
+* @param sub  ndarray subscripts
+* @param out  output address
+* @return     status code
+*/
+int8_t stdlib_ndarray_get_float16( const struct ndarray *arr, const int64_t *sub, stdlib_float16_t *out ) {
+	const uint8_t *idx = stdlib_ndarray_get_ptr( arr, sub );
+	if ( idx == NULL ) {
+		return -1;
+	}
+	return stdlib_ndarray_get_ptr_float16( idx, out );
+}
+
 /**
 * Returns an unsigned 64-bit integer ndarray data element.
 *
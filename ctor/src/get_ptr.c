@@ -83,6 +83,9 @@ int8_t stdlib_ndarray_get_ptr_value( const struct ndarray *arr, const uint8_t *i
 	case STDLIB_NDARRAY_FLOAT32:
 		*(float *)out = *(float *)idx;
 		return 0;
+	case STDLIB_NDARRAY_FLOAT16:
+		*(stdlib_float16_t *)out = *(stdlib_float16_t *)idx;
+		return 0;
 	case STDLIB_NDARRAY_UINT64:
 		*(uint64_t *)out = *(uint64_t *)idx;
 		return 0;
@@ -158,6 +161,23 @@ int8_t stdlib_ndarray_get_ptr_float32( const uint8_t *idx, float *out ) {
 	return 0;
 }
 
+/**
+* Returns a half-precision floating-point ndarray data element specified by a byte array pointer.
+*
+* ## Notes
+*
+* -   The function has no way of determining whether `idx` actually points to a compatible memory address. Accordingly, accessing **unowned** memory is possible, and this function **assumes** you know what you are doing.
+* -   The function always returns `0`.
+*
+* @param idx  byte array pointer to an ndarray data element
+* @param out  output address
+* @return     status code
+*/
+int8_t stdlib_ndarray_get_ptr_float16( const uint8_t *idx, stdlib_float16_t *out ) {
+	*out = *(stdlib_float16_t *)idx;
+	return 0;
+}
+
 /**
 * Returns an unsigned 64-bit integer ndarray data element specified by a byte array pointer.
 *
@@ -93,6 +93,28 @@ int8_t stdlib_ndarray_iget_float32( const struct ndarray *arr, const int64_t idx
 	return stdlib_ndarray_get_ptr_float32( ptr, out );
 }
 
+/**
+* Returns a half-precision floating-point ndarray data element located at a specified linear index.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output address type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element, regardless of the value of `idx`.
+*
+* @param arr  input ndarray
+* @param idx  linear view index
+* @param out  output address
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_float16( const struct ndarray *arr, const int64_t idx, stdlib_float16_t *out ) {
+	const uint8_t *ptr = stdlib_ndarray_iget_ptr( arr, idx );
+	if ( ptr == NULL ) {
+		return -1;
+	}
+	return stdlib_ndarray_get_ptr_float16( ptr, out );
+}
+
 /**
 * Returns an unsigned 64-bit integer ndarray data element located at a specified linear index.
 *
@@ -0,0 +1,423 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/ctor/iget_many.h"
+#include "stdlib/ndarray/ctor/iget_ptr.h"
+#include "stdlib/ndarray/ctor/get_ptr.h"
+#include "stdlib/ndarray/ctor/ndarray.h"
+#include "stdlib/complex/float32/ctor.h"
+#include "stdlib/complex/float64/ctor.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+* Returns ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   The function requires a `void` pointer for the output address `out` in order to provide a generic API supporting ndarrays having different data types.
+* -   The function places the burden on the user to ensure that the output array is compatible with the data type of input ndarray data elements and has at least `n` elements.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, void *out ) {
+	const uint8_t *ptr;
+	uint8_t *optr;
+	int64_t i;
+
+	optr = (uint8_t *)out;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL || stdlib_ndarray_get_ptr_value( arr, ptr, (void *)optr ) != 0 ) {
+			return -1;
+		}
+		optr += arr->BYTES_PER_ELEMENT; // pointer arithmetic
+	}
+	return 0;
+}
+
+/**
+* Returns double-precision floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_float64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, double *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_float64( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns single-precision floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_float32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, float *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_float32( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns unsigned 64-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_uint64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint64_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_uint64( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns signed 64-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_int64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int64_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_int64( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns unsigned 32-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_uint32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint32_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_uint32( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns signed 32-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_int32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int32_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_int32( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns unsigned 16-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_uint16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint16_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_uint16( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns signed 16-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_int16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int16_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_int16( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns unsigned 8-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_uint8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, uint8_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_uint8( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns signed 8-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_int8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, int8_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_int8( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns double-precision complex floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_complex128_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, stdlib_complex128_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_complex128( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns single-precision complex floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_complex64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, stdlib_complex64_t *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_complex64( ptr, out+i );
+	}
+	return 0;
+}
+
+/**
+* Returns boolean ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the output array type matches the underlying input ndarray data type and **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to get an element and `0` otherwise. If unable to get an element, output values for preceding indices will have been written to the output array.
+* -   For zero-dimensional arrays, the function returns the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param out  output array
+* @return     status code
+*/
+int8_t stdlib_ndarray_iget_bool_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, bool *out ) {
+	const uint8_t *ptr;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ptr = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ptr == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_get_ptr_bool( ptr, out+i );
+	}
+	return 0;
+}
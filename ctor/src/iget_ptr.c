@@ -22,7 +22,6 @@
 #include "stdlib/ndarray/orders.h"
 #include "stdlib/ndarray/base/bytes_per_element.h"
 #include "stdlib/ndarray/base/ind.h"
-#include "stdlib/ndarray/base/iteration_order.h"
 #include <stdlib.h>
 #include <stdint.h>
 
@@ -65,9 +64,8 @@ uint8_t * stdlib_ndarray_iget_ptr( const struct ndarray *arr, const int64_t idx
 	// Determine the pointer to the first indexed element:
 	ind = (arr->data) + (arr->offset); // pointer arithmetic
 
-	// Determine the iteration order based on the ndarray strides:
-	strides = arr->strides;
-	io = stdlib_ndarray_iteration_order( ndims, strides );
+	// Retrieve the iteration order (computed once during ndarray allocation):
+	io = arr->iterationOrder;
 
 	// Check for trivial case...
 	if ( (arr->flags) & (STDLIB_NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG | STDLIB_NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG) ) {
@@ -81,6 +79,7 @@ uint8_t * stdlib_ndarray_iget_ptr( const struct ndarray *arr, const int64_t idx
 		}
 	}
 	// The approach which follows is to resolve a view index to its subscripts and then plug the subscripts into the standard formula for computing the linear index in the underlying byte array...
+	strides = arr->strides;
 	shape = arr->shape;
 	if ( (arr->order) == STDLIB_NDARRAY_COLUMN_MAJOR ) {
 		for ( i = 0; i < ndims; i++ ) {
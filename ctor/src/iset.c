@@ -93,6 +93,28 @@ int8_t stdlib_ndarray_iset_float32( const struct ndarray *arr, const int64_t idx
 	return stdlib_ndarray_set_ptr_float32( ind, v );
 }
 
+/**
+* Sets a half-precision floating-point ndarray data element located at a specified linear index.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element, regardless of the value of `idx`.
+*
+* @param arr  input ndarray
+* @param idx  linear view index
+* @param v    value to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_float16( const struct ndarray *arr, const int64_t idx, const stdlib_float16_t v ) {
+	uint8_t *ind = stdlib_ndarray_iget_ptr( arr, idx );
+	if ( ind == NULL ) {
+		return -1;
+	}
+	return stdlib_ndarray_set_ptr_float16( ind, v );
+}
+
 /**
 * Sets an unsigned 64-bit integer ndarray data element located at a specified linear index.
 *
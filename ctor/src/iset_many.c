@@ -0,0 +1,423 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/ctor/iset_many.h"
+#include "stdlib/ndarray/ctor/iget_ptr.h"
+#include "stdlib/ndarray/ctor/set_ptr.h"
+#include "stdlib/ndarray/ctor/ndarray.h"
+#include "stdlib/complex/float32/ctor.h"
+#include "stdlib/complex/float64/ctor.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+* Sets ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   The function requires a pointer to an array of data values `v` in order to provide a generic API supporting ndarrays having different data types.
+* -   The function has no way of determining whether `v` actually points to a memory address compatible with the underlying input ndarray data type. Accordingly, accessing **unowned** memory is possible, and this function **assumes** you know what you are doing.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const void *v ) {
+	const uint8_t *vptr;
+	uint8_t *ind;
+	int64_t i;
+
+	vptr = (const uint8_t *)v;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL || stdlib_ndarray_set_ptr_value( arr, ind, (const void *)vptr ) != 0 ) {
+			return -1;
+		}
+		vptr += arr->BYTES_PER_ELEMENT; // pointer arithmetic
+	}
+	return 0;
+}
+
+/**
+* Sets double-precision floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_float64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const double *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_float64( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets single-precision floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_float32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const float *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_float32( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets unsigned 64-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_uint64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint64_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_uint64( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets signed 64-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_int64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int64_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_int64( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets unsigned 32-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_uint32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint32_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_uint32( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets signed 32-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_int32_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int32_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_int32( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets unsigned 16-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_uint16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint16_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_uint16( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets signed 16-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_int16_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int16_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_int16( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets unsigned 8-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_uint8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const uint8_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_uint8( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets signed 8-bit integer ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_int8_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const int8_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_int8( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets double-precision complex floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_complex128_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const stdlib_complex128_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_complex128( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets single-precision complex floating-point ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_complex64_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const stdlib_complex64_t *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_complex64( ind, v[ i ] );
+	}
+	return 0;
+}
+
+/**
+* Sets boolean ndarray data elements located at specified linear indices.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise. If unable to set an element, elements located at preceding indices will have been set.
+* -   For zero-dimensional arrays, the function sets the first (and only) indexed element for each index in `idx`.
+*
+* @param arr  input ndarray
+* @param n    number of indices
+* @param idx  array of linear view indices
+* @param v    array of values to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_iset_bool_many( const struct ndarray *arr, const int64_t n, const int64_t *idx, const bool *v ) {
+	uint8_t *ind;
+	int64_t i;
+	for ( i = 0; i < n; i++ ) {
+		ind = stdlib_ndarray_iget_ptr( arr, idx[ i ] );
+		if ( ind == NULL ) {
+			return -1;
+		}
+		stdlib_ndarray_set_ptr_bool( ind, v[ i ] );
+	}
+	return 0;
+}
@@ -149,6 +149,9 @@ struct ndarray * stdlib_ndarray_allocate( int16_t dtype, uint8_t *data, int64_t
 	arr->byteLength = len * (arr->BYTES_PER_ELEMENT);
 	arr->flags = stdlib_ndarray_flags( arr );
 
+	// Cache the iteration order in order to avoid scanning the strides each time an element is accessed by linear index:
+	arr->iterationOrder = stdlib_ndarray_iteration_order( ndims, strides );
+
 	return arr;
 }
 
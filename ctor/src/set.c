@@ -90,6 +90,27 @@ int8_t stdlib_ndarray_set_float32( const struct ndarray *arr, const int64_t *sub
 	return stdlib_ndarray_set_ptr_float32( idx, v );
 }
 
+/**
+* Sets a half-precision floating-point ndarray data element.
+*
+* ## Notes
+*
+* -   The function does **not** verify that the type of `v` matches the underlying input ndarray data type, and, thus, overwriting **unowned** memory is possible. The function **assumes** that you know what you are doing.
+* -   The function returns `-1` if unable to set an element and `0` otherwise.
+*
+* @param arr  input ndarray
+* @param sub  ndarray subscripts
+* @param v    value to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_set_float16( const struct ndarray *arr, const int64_t *sub, const stdlib_float16_t v ) {
+	uint8_t *idx = stdlib_ndarray_get_ptr( arr, sub );
+	if ( idx == NULL ) {
+		return -1;
+	}
+	return stdlib_ndarray_set_ptr_float16( idx, v );
+}
+
 /**
 * Sets an unsigned 64-bit integer ndarray data element.
 *
@@ -46,6 +46,9 @@ int8_t stdlib_ndarray_set_ptr_value( const struct ndarray *arr, uint8_t *idx, co
 	case STDLIB_NDARRAY_FLOAT32:
 		*(float *)idx = *(float *)v;
 		return 0;
+	case STDLIB_NDARRAY_FLOAT16:
+		*(stdlib_float16_t *)idx = *(stdlib_float16_t *)v;
+		return 0;
 	case STDLIB_NDARRAY_UINT64:
 		*(uint64_t *)idx = *(uint64_t *)v;
 		return 0;
@@ -121,6 +124,23 @@ int8_t stdlib_ndarray_set_ptr_float32( uint8_t *idx, const float v ) {
 	return 0;
 }
 
+/**
+* Sets a half-precision floating-point ndarray data element specified by a byte array pointer.
+*
+* ## Notes
+*
+* -   The function has no way of determining whether `idx` actually points to a compatible memory address. Accordingly, overwriting **unowned** memory is possible, and this function **assumes** you know what you are doing.
+* -   The function always returns `0`.
+*
+* @param idx  byte array pointer to an ndarray data element
+* @param v    value to set
+* @return     status code
+*/
+int8_t stdlib_ndarray_set_ptr_float16( uint8_t *idx, const stdlib_float16_t v ) {
+	*(stdlib_float16_t *)idx = v;
+	return 0;
+}
+
 /**
 * Sets an unsigned 64-bit integer ndarray data element specified by a byte array pointer.
 *
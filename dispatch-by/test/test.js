@@ -24,6 +24,11 @@ var tape = require( 'tape' );
 var unaryBy = require( './../../base/unary-by' );
 var abs = require( '@stdlib/math/base/special/abs' );
 var isFunction = require( '@stdlib/assert/is-function' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Float32Array = require( '@stdlib/array/float32' );
+var Int32Array = require( '@stdlib/array/int32' );
+var Int8Array = require( '@stdlib/array/int8' );
+var ndarray = require( './../../ctor' );
 var dispatchBy = require( './../lib' );
 
 
@@ -361,3 +366,107 @@ tape( 'the function returns an ndarray function interface', function test( t ) {
 
 	t.end();
 });
+
+tape( 'the function returns a function which dispatches to the first ndarray function whose signature matches the provided array argument data types', function test( t ) {
+	var expected;
+	var types;
+	var fcns;
+	var xbuf;
+	var ybuf;
+	var fcn;
+	var x;
+	var y;
+
+	types = [
+		'float32', 'float32',
+		'float64', 'float64',
+		'float64', 'float32',
+		'float64', 'float64'
+	];
+
+	fcns = [
+		fill( 1.0 ),
+		fill( 2.0 ),
+		fill( 3.0 ),
+		fill( 4.0 )
+	];
+	fcn = dispatchBy( fcns, types, null, 3, 1, 1 );
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+	x = ndarray( 'float64', xbuf, [ 4 ], [ 1 ], 0, 'row-major' );
+	ybuf = new Float64Array( xbuf.length );
+	y = ndarray( 'float64', ybuf, [ 4 ], [ 1 ], 0, 'row-major' );
+
+	fcn( x, y, clbk );
+
+	expected = new Float64Array( [ 2.0, 2.0, 2.0, 2.0 ] );
+	t.deepEqual( xbuf, expected, 'returns expected value' );
+	t.deepEqual( ybuf, expected, 'returns expected value' );
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+	x = ndarray( 'float64', xbuf, [ 4 ], [ 1 ], 0, 'row-major' );
+	ybuf = new Float32Array( xbuf.length );
+	y = ndarray( 'float32', ybuf, [ 4 ], [ 1 ], 0, 'row-major' );
+
+	fcn( x, y, clbk );
+
+	expected = new Float64Array( [ 3.0, 3.0, 3.0, 3.0 ] );
+	t.deepEqual( xbuf, expected, 'returns expected value' );
+	expected = new Float32Array( [ 3.0, 3.0, 3.0, 3.0 ] );
+	t.deepEqual( ybuf, expected, 'returns expected value' );
+
+	t.throws( badValue, TypeError, 'throws an error' );
+
+	t.end();
+
+	function clbk( v ) {
+		return v;
+	}
+
+	function badValue() {
+		var x = ndarray( 'int32', new Int32Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+		var y = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+		fcn( x, y, clbk );
+	}
+});
+
+tape( 'the function returns a function which throws an error if unable to resolve an ndarray function for the provided array argument data types', function test( t ) {
+	var types;
+	var fcn;
+
+	types = [
+		'float64', 'float64',
+		'float32', 'float32'
+	];
+	fcn = dispatchBy( [ fill( 1.0 ), fill( 2.0 ) ], types, null, 3, 1, 1 );
+
+	t.throws( badValue( 'int8', 'float64' ), TypeError, 'throws an error' );
+	t.throws( badValue( 'float64', 'generic' ), TypeError, 'throws an error' );
+	t.throws( badValue( 'float32', 'float64' ), TypeError, 'throws an error' );
+	t.end();
+
+	function clbk( v ) {
+		return v;
+	}
+
+	function badValue( xdtype, ydtype ) {
+		return function badValue() {
+			var x = ndarray( xdtype, array( xdtype ), [ 4 ], [ 1 ], 0, 'row-major' );
+			var y = ndarray( ydtype, array( ydtype ), [ 4 ], [ 1 ], 0, 'row-major' );
+			fcn( x, y, clbk );
+		};
+	}
+
+	function array( dtype ) {
+		if ( dtype === 'generic' ) {
+			return [ 0, 0, 0, 0 ];
+		}
+		if ( dtype === 'float32' ) {
+			return new Float32Array( 4 );
+		}
+		if ( dtype === 'int8' ) {
+			return new Int8Array( 4 );
+		}
+		return new Float64Array( 4 );
+	}
+});
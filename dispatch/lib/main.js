@@ -32,6 +32,7 @@ var getDType = require( './../../dtype' );
 var resolveEnum = require( './../../base/dtype-resolve-enum' );
 var dtypes2enums = require( './../../base/dtypes2enums' );
 var gindexOfRow = require( '@stdlib/blas/ext/base/gindex-of-row' ).ndarray;
+var signatureTable = require( './../../base/signature-table' );
 
 
 // MAIN //
@@ -87,6 +88,7 @@ var gindexOfRow = require( '@stdlib/blas/ext/base/gindex-of-row' ).ndarray;
 function dispatch( fcns, types, data, nargs, nin, nout ) {
 	var narrays;
 	var nfcns;
+	var table;
 	var fcn;
 
 	if ( isFunction( fcns ) ) {
@@ -131,6 +133,9 @@ function dispatch( fcns, types, data, nargs, nin, nout ) {
 		throw new Error( 'invalid argument. The third argument must have the same number of elements as the first argument.' );
 	}
 	types = dtypes2enums( types );
+
+	// Precompute a lookup table mapping type signatures to ndarray functions:
+	table = signatureTable( types, nfcns, narrays );
 	return dispatcher;
 
 	/**
@@ -177,7 +182,11 @@ function dispatch( fcns, types, data, nargs, nin, nout ) {
 			dtypes.push( resolveEnum( getDType( v ) ) );
 		}
 		// Resolve the ndarray function satisfying the input array types:
-		idx = gindexOfRow( nfcns, narrays, types, narrays, 1, 0, dtypes, 1, 0 );
+		if ( table ) {
+			idx = signatureTable.indexOf( table, dtypes );
+		} else {
+			idx = gindexOfRow( nfcns, narrays, types, narrays, 1, 0, dtypes, 1, 0 );
+		}
 
 		// Check whether we were able to successfully resolve an ndarray function:
 		if ( idx < 0 ) {
@@ -742,6 +742,65 @@ tape( 'the function returns a function which invokes a callback for indexed ndar
 	t.end();
 });
 
+tape( 'the function returns a function which dispatches to the first ndarray function whose signature matches the provided array argument data types', function test( t ) {
+	var expected;
+	var types;
+	var fcns;
+	var xbuf;
+	var ybuf;
+	var fcn;
+	var x;
+	var y;
+
+	types = [
+		'float32', 'float32',
+		'float64', 'float64',
+		'float64', 'float32',
+		'float64', 'float64'
+	];
+
+	fcns = [
+		fill( 1.0 ),
+		fill( 2.0 ),
+		fill( 3.0 ),
+		fill( 4.0 )
+	];
+	fcn = dispatch( fcns, types, null, 2, 0, 2 );
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+	x = ndarray( 'float64', xbuf, [ 4 ], [ 1 ], 0, 'row-major' );
+	ybuf = new Float64Array( xbuf.length );
+	y = ndarray( 'float64', ybuf, [ 4 ], [ 1 ], 0, 'row-major' );
+
+	fcn( x, y );
+
+	expected = new Float64Array( [ 2.0, 2.0, 2.0, 2.0 ] );
+	t.deepEqual( xbuf, expected, 'returns expected value' );
+	t.deepEqual( ybuf, expected, 'returns expected value' );
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+	x = ndarray( 'float64', xbuf, [ 4 ], [ 1 ], 0, 'row-major' );
+	ybuf = new Float32Array( xbuf.length );
+	y = ndarray( 'float32', ybuf, [ 4 ], [ 1 ], 0, 'row-major' );
+
+	fcn( x, y );
+
+	expected = new Float64Array( [ 3.0, 3.0, 3.0, 3.0 ] );
+	t.deepEqual( xbuf, expected, 'returns expected value' );
+	expected = new Float32Array( [ 3.0, 3.0, 3.0, 3.0 ] );
+	t.deepEqual( ybuf, expected, 'returns expected value' );
+
+	t.throws( badValue, TypeError, 'throws an error' );
+
+	t.end();
+
+	function badValue() {
+		var x = ndarray( 'int32', new Int32Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+		var y = ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+		fcn( x, y );
+	}
+});
+
 tape( 'the function returns a function which returns one or more output arrays, if one or more output arrays is specified, and otherwise returns `undefined`', function test( t ) {
 	var types;
 	var data;
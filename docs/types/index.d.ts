@@ -22,6 +22,7 @@
 
 import any = require( './../../any' );
 import anyBy = require( './../../any-by' );
+import argsort = require( './../../argsort' );
 import array = require( './../../array' );
 import at = require( './../../at' );
 import base = require( './../../base' );
@@ -69,6 +70,9 @@ import flattenFromBy = require( './../../flatten-from-by' );
 import fliplr = require( './../../fliplr' );
 import flipud = require( './../../flipud' );
 import forEach = require( './../../for-each' );
+import arraybuffer2ndarray = require( './../../from-arraybuffer' );
+import fromFile = require( './../../from-file' );
+import npy2ndarray = require( './../../from-npy' );
 import scalar2ndarray = require( './../../from-scalar' );
 import scalar2ndarrayLike = require( './../../from-scalar-like' );
 import hconcat = require( './../../hconcat' );
@@ -79,6 +83,7 @@ import indexModes = require( './../../index-modes' );
 import inputCastingPolicies = require( './../../input-casting-policies' );
 import iter = require( './../../iter' );
 import last = require( './../../last' );
+import lazy = require( './../../lazy' );
 import map = require( './../../map' );
 import maybeBroadcastArray = require( './../../maybe-broadcast-array' );
 import maybeBroadcastArrays = require( './../../maybe-broadcast-arrays' );
@@ -104,6 +109,7 @@ import promotionRules = require( './../../promotion-rules' );
 import push = require( './../../push' );
 import reject = require( './../../reject' );
 import removeSingletonDimensions = require( './../../remove-singleton-dimensions' );
+import reshape = require( './../../reshape' );
 import reverse = require( './../../reverse' );
 import reverseDimension = require( './../../reverse-dimension' );
 import reverseDimensions = require( './../../reverse-dimensions' );
@@ -125,6 +131,7 @@ import sliceFrom = require( './../../slice-from' );
 import sliceTo = require( './../../slice-to' );
 import some = require( './../../some' );
 import someBy = require( './../../some-by' );
+import sort = require( './../../sort' );
 import spreadDimensions = require( './../../spread-dimensions' );
 import stride = require( './../../stride' );
 import strides = require( './../../strides' );
@@ -133,6 +140,7 @@ import ndarray2array = require( './../../to-array' );
 import toFlippedlr = require( './../../to-flippedlr' );
 import toFlippedud = require( './../../to-flippedud' );
 import ndarray2json = require( './../../to-json' );
+import ndarray2npy = require( './../../to-npy' );
 import ndarray2localeString = require( './../../to-locale-string' );
 import toReversed = require( './../../to-reversed' );
 import toReversedDimension = require( './../../to-reversed-dimension' );
@@ -144,6 +152,7 @@ import toRotr90 = require( './../../to-rotr90' );
 import ndarray2string = require( './../../to-string' );
 import toTransposed = require( './../../to-transposed' );
 import toUnflattened = require( './../../to-unflattened' );
+import topk = require( './../../top-k' );
 import transpose = require( './../../transpose' );
 import trues = require( './../../trues' );
 import truesLike = require( './../../trues-like' );
@@ -295,6 +304,26 @@ interface Namespace {
 	*/
 	anyBy: typeof anyBy;
 
+	/**
+	* Returns a new ndarray containing the indices which sort an input ndarray along a specified dimension.
+	*
+	* @param x - input array
+	* @param options - function options
+	* @param options.dim - index of dimension along which to sort elements
+	* @param options.sortOrder - sort order
+	* @returns ndarray containing sort indices
+	*
+	* @example
+	* var array = require( './../../array' );
+	*
+	* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+	* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+	*
+	* var y = ns.argsort( x );
+	* // returns <ndarray>[ [ 1, 2, 0 ], [ 2, 1, 0 ] ]
+	*/
+	argsort: typeof argsort;
+
 	/**
 	* Returns a multidimensional array.
 	*
@@ -1984,6 +2013,73 @@ interface Namespace {
 	*/
 	forEach: typeof forEach;
 
+	/**
+	* Creates an ndarray view of an ArrayBuffer.
+	*
+	* ## Notes
+	*
+	* -   The function computes the index offset from the provided strides, such that the view's minimum accessible element is the element located at `byteOffset`.
+	* -   The returned ndarray shares memory with the provided ArrayBuffer.
+	*
+	* @param dtype - data type
+	* @param buffer - ArrayBuffer
+	* @param shape - array shape
+	* @param strides - array strides
+	* @param byteOffset - byte offset
+	* @param order - memory layout (either row-major or column-major)
+	* @param options - function options
+	* @returns ndarray
+	*
+	* @example
+	* var ArrayBuffer = require( '@stdlib/array/buffer' );
+	*
+	* var buf = new ArrayBuffer( 32 );
+	* var x = ns.arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	* // returns <ndarray>
+	*/
+	arraybuffer2ndarray: typeof arraybuffer2ndarray;
+
+	/**
+	* Creates an ndarray backed by a region of a file.
+	*
+	* ## Notes
+	*
+	* -   When the native add-on is available, the file region is memory-mapped, such that file contents are paged in on demand and never need to fit in memory all at once. Otherwise, the file region is read into memory.
+	*
+	* @param path - file path
+	* @param shape - array shape
+	* @param options - function options
+	* @returns ndarray
+	*
+	* @example
+	* var x = ns.fromFile( './weights.bin', [ 1000, 1000 ], {
+	*     'dtype': 'float32'
+	* });
+	* // returns <ndarray>
+	*/
+	fromFile: typeof fromFile;
+
+	/**
+	* Creates an ndarray from a buffer containing data serialized in the NumPy `.npy` format.
+	*
+	* ## Notes
+	*
+	* -   By default, when array data is stored in host byte order and suitably aligned within the underlying ArrayBuffer, the returned ndarray is a view of the provided buffer and array data is **not** copied.
+	*
+	* @param buffer - input buffer
+	* @param options - function options
+	* @returns ndarray
+	*
+	* @example
+	* var array = require( './../../array' );
+	*
+	* var buf = ns.ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+	*
+	* var x = ns.npy2ndarray( buf );
+	* // returns <ndarray>
+	*/
+	npy2ndarray: typeof npy2ndarray;
+
 	/**
 	* Returns a zero-dimensional ndarray containing a provided scalar value.
 	*
@@ -2315,6 +2411,42 @@ interface Namespace {
 	*/
 	last: typeof last;
 
+	/**
+	* Returns a lazily evaluated expression which applies a callback to elements in ndarrays, lazily evaluated expressions, and/or scalar values.
+	*
+	* ## Notes
+	*
+	* -   When evaluated, all recorded operations are fused into a single loop over ndarray elements, thus avoiding the allocation of intermediate arrays.
+	* -   Operands which are neither ndarrays nor lazily evaluated expressions are treated as scalar constants.
+	*
+	* @param fcn - callback
+	* @param args - callback operands
+	* @returns lazily evaluated expression
+	*
+	* @example
+	* var array = require( './../../array' );
+	* var ndarray2array = require( './../../to-array' );
+	*
+	* function add( a, b ) {
+	*     return a + b;
+	* }
+	*
+	* function mul( a, b ) {
+	*     return a * b;
+	* }
+	*
+	* var a = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	* var b = array( [ [ 5.0, 6.0 ], [ 7.0, 8.0 ] ] );
+	* var c = array( [ 10.0, 20.0 ] );
+	*
+	* var out = ns.lazy( add, ns.lazy( mul, a, b ), c ).evaluate();
+	* // returns <ndarray>
+	*
+	* var arr = ndarray2array( out );
+	* // returns [ [ 15.0, 32.0 ], [ 31.0, 52.0 ] ]
+	*/
+	lazy: typeof lazy;
+
 	/**
 	* Applies a callback function to elements in an input ndarray and assigns results to elements in a new output ndarray.
 	*
@@ -2985,6 +3117,35 @@ interface Namespace {
 	*/
 	removeSingletonDimensions: typeof removeSingletonDimensions;
 
+	/**
+	* Reshapes an input ndarray, returning a view whenever possible.
+	*
+	* ## Notes
+	*
+	* -   When the input ndarray's strides are compatible with the desired shape, the function returns a **read-only** view sharing the same underlying data buffer as the input ndarray and does not access any ndarray elements. Otherwise, the function copies elements to a newly allocated ndarray having contiguous memory.
+	*
+	* @param x - input ndarray
+	* @param shape - output ndarray shape
+	* @param options - function options
+	* @param options.order - index order in which input ndarray elements should be read and placed in the output ndarray
+	* @param options.copy - specifies whether to copy input ndarray elements
+	* @returns output ndarray
+	*
+	* @example
+	* var array = require( './../../array' );
+	* var ndarray2array = require( './../../to-array' );
+	*
+	* var x = array( [ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ] );
+	* // returns <ndarray>
+	*
+	* var y = ns.reshape( x, [ 3, 2 ] );
+	* // returns <ndarray>
+	*
+	* var arr = ndarray2array( y );
+	* // returns [ [ 1.0, 2.0 ], [ 3.0, 4.0 ], [ 5.0, 6.0 ] ]
+	*/
+	reshape: typeof reshape;
+
 	/**
 	* Returns a read-only view of an input ndarray in which the order of elements along each dimension is reversed.
 	*
@@ -3699,6 +3860,26 @@ interface Namespace {
 	*/
 	someBy: typeof someBy;
 
+	/**
+	* Returns a new ndarray containing the elements of an input ndarray sorted along a specified dimension.
+	*
+	* @param x - input array
+	* @param options - function options
+	* @param options.dim - index of dimension along which to sort elements
+	* @param options.sortOrder - sort order
+	* @returns output ndarray
+	*
+	* @example
+	* var array = require( './../../array' );
+	*
+	* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+	* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+	*
+	* var y = ns.sort( x );
+	* // returns <ndarray>[ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ]
+	*/
+	sort: typeof sort;
+
 	/**
 	* Returns a read-only view of an input ndarray where the dimensions of the input ndarray are expanded to a specified dimensionality by spreading dimensions to specified dimension indices and inserting dimensions of size one for the remaining dimensions.
 	*
@@ -3867,6 +4048,22 @@ interface Namespace {
 	*/
 	ndarray2json: typeof ndarray2json;
 
+	/**
+	* Serializes an ndarray in the NumPy `.npy` format.
+	*
+	* @param x - input ndarray
+	* @returns serialized ndarray
+	*
+	* @example
+	* var array = require( './../../array' );
+	*
+	* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	*
+	* var out = ns.ndarray2npy( x );
+	* // returns <Uint8Array>
+	*/
+	ndarray2npy: typeof ndarray2npy;
+
 	/**
 	* Serializes an ndarray as a locale-aware string.
 	*
@@ -4096,6 +4293,27 @@ interface Namespace {
 	*/
 	toUnflattened: typeof toUnflattened;
 
+	/**
+	* Returns a new ndarray containing the `k` largest elements, or their indices, along a specified dimension of an input ndarray.
+	*
+	* @param x - input array
+	* @param k - number of elements to select
+	* @param options - function options
+	* @param options.dim - index of dimension along which to select elements
+	* @param options.indices - boolean indicating whether to return element indices
+	* @returns output ndarray
+	*
+	* @example
+	* var array = require( './../../array' );
+	*
+	* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+	* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+	*
+	* var y = ns.topk( x, 2 );
+	* // returns <ndarray>[ [ 3.0, 2.0 ], [ 6.0, 5.0 ] ]
+	*/
+	topk: typeof topk;
+
 	/**
 	* Returns a read-only view of an input ndarray in which the last two dimensions are transposed.
 	*
@@ -26,6 +26,8 @@ var isPlainObject = require( '@stdlib/assert/is-plain-object' );
 var isNonNegativeIntegerArray = require( '@stdlib/assert/is-nonnegative-integer-array' ).primitives;
 var isEmptyCollection = require( '@stdlib/assert/is-empty-collection' );
 var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var isObject = require( '@stdlib/assert/is-object' );
+var isFunction = require( '@stdlib/assert/is-function' );
 var resolveStr = require( './../../base/dtype-resolve-str' );
 var shape2strides = require( './../../base/shape2strides' );
 var numel = require( './../../base/numel' );
@@ -50,11 +52,13 @@ var format = require( '@stdlib/string/format' );
 * @param {(NonNegativeIntegerArray|NonNegativeInteger)} [options.shape] - output array shape (overrides the input array's inferred shape)
 * @param {string} [options.mode="throw"] - specifies how to handle indices which exceed array dimensions
 * @param {StringArray} [options.submode=[options.mode]] - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
+* @param {Object} [options.pool] - buffer pool from which to allocate the underlying data buffer (e.g., as returned by `@stdlib/ndarray/base/buffer-pool`)
 * @throws {TypeError} first argument must have a recognized data type
 * @throws {TypeError} options argument must be an object
 * @throws {TypeError} `dtype` option must be a supported ndarray data type
 * @throws {TypeError} `order` option must be a supported order
 * @throws {TypeError} `shape` option must be either a nonnegative integer or an array of nonnegative integers
+* @throws {TypeError} `pool` option must be a buffer pool
 * @throws {TypeError} must provide valid options
 * @returns {ndarray} ndarray
 *
@@ -81,6 +85,7 @@ function emptyLike( x ) {
 	var order;
 	var ndims;
 	var opts;
+	var pool;
 	var buf;
 	var len;
 	var dt;
@@ -123,6 +128,12 @@ function emptyLike( x ) {
 		if ( hasOwnProp( options, 'submode' ) ) {
 			opts.submode = options.submode;
 		}
+		if ( hasOwnProp( options, 'pool' ) ) {
+			pool = options.pool;
+			if ( !isObject( pool ) || !isFunction( pool.malloc ) ) {
+				throw new TypeError( format( 'invalid option. `%s` option must be a buffer pool. Option: `%s`.', 'pool', pool ) );
+			}
+		}
 	} else {
 		dtype = getDType( x );
 		sh = getShape( x );
@@ -138,7 +149,9 @@ function emptyLike( x ) {
 		st = [ 0 ];
 	}
 	dt = resolveStr( dtype );
-	if ( dt === 'binary' ) {
+	if ( pool ) {
+		buf = pool.malloc( dtype, len );
+	} else if ( dt === 'binary' ) {
 		buf = allocUnsafe( len );
 	} else {
 		buf = emptyArray( len, dt );
@@ -22,6 +22,20 @@
 
 import { Shape, Order, Mode, typedndarray, float64ndarray, float32ndarray, int32ndarray, int16ndarray, int8ndarray, uint32ndarray, uint16ndarray, uint8ndarray, uint8cndarray, boolndarray, complex128ndarray, complex64ndarray, genericndarray, DataType, Float64DataType, Float32DataType, Complex128DataType, Complex64DataType, Int32DataType, Int16DataType, Int8DataType, Uint32DataType, Uint16DataType, Uint8DataType, Uint8cDataType, BooleanDataType, GenericDataType } from '@stdlib/types/ndarray';
 
+/**
+* Interface describing a buffer pool.
+*/
+interface BufferPool {
+	/**
+	* Returns a uninitialized data buffer having a specified data type and length.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*/
+	malloc( dtype: any, size: number ): any;
+}
+
 /**
 * Interface describing function options.
 */
@@ -44,6 +58,11 @@ interface Options {
 	* Specifies how to handle subscripts which exceed array dimensions on a per dimension basis (default: ['throw']).
 	*/
 	submode?: Array<Mode>;
+
+	/**
+	* Buffer pool from which to allocate the underlying data buffer.
+	*/
+	pool?: BufferPool;
 }
 
 /**
@@ -24,6 +24,8 @@ var isDataType = require( './../../base/assert/is-data-type' );
 var isNonNegativeInteger = require( '@stdlib/assert/is-nonnegative-integer' ).isPrimitive;
 var isPlainObject = require( '@stdlib/assert/is-plain-object' );
 var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var isObject = require( '@stdlib/assert/is-object' );
+var isFunction = require( '@stdlib/assert/is-function' );
 var isNonNegativeIntegerArray = require( '@stdlib/assert/is-nonnegative-integer-array' ).primitives;
 var isEmptyCollection = require( '@stdlib/assert/is-empty-collection' );
 var shape2strides = require( './../../base/shape2strides' );
@@ -55,10 +57,12 @@ var DEFAULT_ORDER = defaults.get( 'order' );
 * @param {string} [options.order='row-major'] - array order
 * @param {string} [options.mode="throw"] - specifies how to handle indices which exceed array dimensions
 * @param {StringArray} [options.submode=[options.mode]] - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
+* @param {Object} [options.pool] - buffer pool from which to allocate the underlying data buffer (e.g., as returned by `@stdlib/ndarray/base/buffer-pool`)
 * @throws {TypeError} first argument must be either a nonnegative integer or an array of nonnegative integers
 * @throws {TypeError} options argument must be an object
 * @throws {TypeError} `dtype` option must be a recognized data type
 * @throws {TypeError} `order` option must be a recognized array order
+* @throws {TypeError} `pool` option must be a buffer pool
 * @throws {TypeError} must provide valid options
 * @returns {ndarray} ndarray
 *
@@ -83,6 +87,7 @@ function empty( shape ) {
 	var order;
 	var ndims;
 	var opts;
+	var pool;
 	var buf;
 	var len;
 	var dt;
@@ -114,6 +119,12 @@ function empty( shape ) {
 		if ( hasOwnProp( options, 'submode' ) ) {
 			opts.submode = options.submode;
 		}
+		if ( hasOwnProp( options, 'pool' ) ) {
+			pool = options.pool;
+			if ( !isObject( pool ) || !isFunction( pool.malloc ) ) {
+				throw new TypeError( format( 'invalid option. `%s` option must be a buffer pool. Option: `%s`.', 'pool', pool ) );
+			}
+		}
 	} else {
 		dtype = DEFAULT_DTYPE;
 		order = DEFAULT_ORDER;
@@ -135,7 +146,9 @@ function empty( shape ) {
 		st = [ 0 ];
 	}
 	dt = resolveStr( dtype );
-	if ( dt === 'binary' ) {
+	if ( pool ) {
+		buf = pool.malloc( dtype, len );
+	} else if ( dt === 'binary' ) {
 		buf = allocUnsafe( len );
 	} else {
 		buf = emptyArray( len, dt );
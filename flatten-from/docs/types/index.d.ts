@@ -22,6 +22,20 @@
 
 import { ndarray, typedndarray, Order, DataTypeMap } from '@stdlib/types/ndarray';
 
+/**
+* Interface describing a buffer pool.
+*/
+interface BufferPool {
+	/**
+	* Returns a uninitialized data buffer having a specified data type and length.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*/
+	malloc( dtype: any, size: number ): any;
+}
+
 /**
 * Interface defining "base" function options.
 */
@@ -41,6 +55,26 @@ interface BaseOptions {
 	* -   Default: 'row-major'.
 	*/
 	order?: Order | 'same' | 'any';
+
+	/**
+	* Specifies whether to copy input ndarray elements.
+	*
+	* ## Notes
+	*
+	* -   The following modes are supported:
+	*
+	*     -   **always**: always return a copy.
+	*     -   **if-needed**: return a read-only view when input ndarray strides permit and the output ndarray data type equals the input ndarray data type; otherwise, return a copy.
+	*     -   **never**: return a read-only view when possible; otherwise, throw an error.
+	*
+	* -   Default: 'always'.
+	*/
+	copy?: 'always' | 'if-needed' | 'never';
+
+	/**
+	* Buffer pool from which to allocate the output ndarray data buffer when copying input ndarray elements.
+	*/
+	pool?: BufferPool;
 }
 
 /**
@@ -58,7 +92,7 @@ type Options<U> = BaseOptions & {
 *
 * ## Notes
 *
-* -   The function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions.
+* -   By default, the function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions. To return a read-only view when input ndarray strides permit, set the `copy` option.
 * -   By default, the function returns an ndarray having the same data type as a provided input ndarray.
 *
 * @param x - input ndarray
@@ -66,6 +100,7 @@ type Options<U> = BaseOptions & {
 * @param options - function options
 * @param options.order - order in which input ndarray elements should be flattened
 * @param options.dtype - output ndarray data type
+* @param options.copy - specifies whether to copy input ndarray elements
 * @returns output ndarray
 *
 * @example
@@ -91,13 +126,14 @@ declare function flattenFrom<T extends ndarray = ndarray>( x: T, dim: number, op
 *
 * ## Notes
 *
-* -   The function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions.
+* -   By default, the function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions. To return a read-only view when input ndarray strides permit, set the `copy` option.
 *
 * @param x - input ndarray
 * @param dim - dimension to start flattening from
 * @param options - function options
 * @param options.order - order in which input ndarray elements should be flattened
 * @param options.dtype - output ndarray data type
+* @param options.copy - specifies whether to copy input ndarray elements
 * @returns output ndarray
 *
 * @example
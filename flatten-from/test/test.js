@@ -29,16 +29,19 @@ var isSameFloat32Array = require( '@stdlib/assert/is-same-float32array' );
 var empty = require( './../../empty' );
 var zeros = require( './../../zeros' );
 var ndarray = require( './../../ctor' );
+var DataType = require( './../../dtype-ctor' );
 var Float64Array = require( '@stdlib/array/float64' );
 var Float32Array = require( '@stdlib/array/float32' );
 var getDType = require( './../../dtype' );
 var getShape = require( './../../shape' );
 var getOrder = require( './../../order' );
 var getData = require( './../../data-buffer' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
 var shape2strides = require( './../../base/shape2strides' );
 var strides2offset = require( './../../base/strides2offset' );
 var scalar2ndarray = require( './../../from-scalar' );
 var ndarray2array = require( './../../to-array' );
+var bufferPool = require( './../../base/buffer-pool' );
 var flattenFrom = require( './../lib' );
 
 
@@ -238,6 +241,154 @@ tape( 'the function throws an error if provided an invalid `order` option', func
 	}
 });
 
+tape( 'the function throws an error if provided an invalid `copy` option', function test( t ) {
+	var values;
+	var opts;
+	var i;
+
+	values = [
+		'5',
+		'beep',
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			opts = {
+				'copy': value
+			};
+			flattenFrom( zeros( [ 2 ] ), 0, opts );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `pool` option', function test( t ) {
+	var values;
+	var opts;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		{
+			'malloc': 5
+		},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			opts = {
+				'pool': value
+			};
+			flattenFrom( zeros( [ 2 ] ), 0, opts );
+		};
+	}
+});
+
+tape( 'the function supports returning a read-only view when an input ndarray can be flattened without copying data (copy=if-needed)', function test( t ) {
+	var xbuf;
+	var opts;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	opts = {
+		'copy': 'if-needed'
+	};
+
+	// Contiguous (row-major):
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = flattenFrom( x, 0, opts );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.deepEqual( getShape( y ), [ 6 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	// Non-contiguous (row-major):
+	x = new ndarray( 'float64', xbuf, [ 3 ], [ 2 ], 1, 'row-major' );
+	y = flattenFrom( x, 0, opts );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 2.0, 4.0, 6.0 ], 'returns expected value' );
+
+	// Transposed (copy required):
+	x = new ndarray( 'float64', xbuf, [ 3, 2 ], [ 1, 3 ], 0, 'row-major' );
+	y = flattenFrom( x, 0, opts );
+	t.notEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), false, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 4.0, 2.0, 5.0, 3.0, 6.0 ], 'returns expected value' );
+
+	// Different data type (copy required):
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	opts.dtype = 'generic';
+	y = flattenFrom( x, 0, opts );
+	t.notEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	// Equivalent data type specified as a data type instance (no copy required):
+	opts.dtype = new DataType( 'float64' );
+	y = flattenFrom( x, 0, opts );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.strictEqual( y instanceof ndarray, true, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function throws an error when an input ndarray cannot be flattened without copying data (copy=never)', function test( t ) {
+	var xbuf;
+	var opts;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	opts = {
+		'copy': 'never'
+	};
+
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = flattenFrom( x, 0, opts );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+	opts.order = 'column-major';
+	y = flattenFrom( x, 0, opts );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	opts.order = 'row-major';
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		flattenFrom( x, 0, opts );
+	}
+});
+
 tape( 'the function throws an error if provided an invalid `dtype` option', function test( t ) {
 	var values;
 	var i;
@@ -1631,3 +1782,26 @@ tape( 'the function supports specifying the output ndarray data type', function
 
 	t.end();
 });
+
+tape( 'the function supports allocating the output ndarray data buffer from a buffer pool', function test( t ) {
+	var pool;
+	var xbuf;
+	var buf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 3, 2 ], [ 1, 3 ], 0, 'row-major' );
+
+	pool = bufferPool();
+	buf = pool.malloc( 'float64', 6 );
+	pool.free( buf );
+
+	y = flattenFrom( x, 0, {
+		'pool': pool
+	});
+	t.strictEqual( getData( y ).buffer, buf.buffer, 'returns expected value' );
+	t.strictEqual( pool.stats().hits, 1, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 4.0, 2.0, 5.0, 3.0, 6.0 ], 'returns expected value' );
+	t.end();
+});
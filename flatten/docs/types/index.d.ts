@@ -22,6 +22,20 @@
 
 import { ndarray, typedndarray, Order, DataTypeMap } from '@stdlib/types/ndarray';
 
+/**
+* Interface describing a buffer pool.
+*/
+interface BufferPool {
+	/**
+	* Returns a uninitialized data buffer having a specified data type and length.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*/
+	malloc( dtype: any, size: number ): any;
+}
+
 /**
 * Interface defining "base" function options.
 */
@@ -50,6 +64,26 @@ interface BaseOptions {
 	* -   Default: 'row-major'.
 	*/
 	order?: Order | 'same' | 'any';
+
+	/**
+	* Specifies whether to copy input ndarray elements.
+	*
+	* ## Notes
+	*
+	* -   The following modes are supported:
+	*
+	*     -   **always**: always return a copy.
+	*     -   **if-needed**: return a read-only view when input ndarray strides permit and the output ndarray data type equals the input ndarray data type; otherwise, return a copy.
+	*     -   **never**: return a read-only view when possible; otherwise, throw an error.
+	*
+	* -   Default: 'always'.
+	*/
+	copy?: 'always' | 'if-needed' | 'never';
+
+	/**
+	* Buffer pool from which to allocate the output ndarray data buffer when copying input ndarray elements.
+	*/
+	pool?: BufferPool;
 }
 
 /**
@@ -67,7 +101,7 @@ type Options<U> = BaseOptions & {
 *
 * ## Notes
 *
-* -   The function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions.
+* -   By default, the function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions. To return a read-only view when input ndarray strides permit, set the `copy` option.
 * -   By default, the function returns an ndarray having the same data type as a provided input ndarray.
 *
 * @param x - input ndarray
@@ -75,6 +109,7 @@ type Options<U> = BaseOptions & {
 * @param options.depth - maximum number of dimensions to flatten
 * @param options.order - order in which input ndarray elements should be flattened
 * @param options.dtype - output ndarray data type
+* @param options.copy - specifies whether to copy input ndarray elements
 * @returns output ndarray
 *
 * @example
@@ -93,13 +128,14 @@ declare function flatten<T extends ndarray = ndarray>( x: T, options?: BaseOptio
 *
 * ## Notes
 *
-* -   The function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions.
+* -   By default, the function **always** returns a copy of input ndarray data, even when an input ndarray already has the desired number of dimensions. To return a read-only view when input ndarray strides permit, set the `copy` option.
 *
 * @param x - input ndarray
 * @param options - function options
 * @param options.depth - maximum number of dimensions to flatten
 * @param options.order - order in which input ndarray elements should be flattened
 * @param options.dtype - output ndarray data type
+* @param options.copy - specifies whether to copy input ndarray elements
 * @returns output ndarray
 *
 * @example
@@ -26,16 +26,23 @@ var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
 var isNonNegativeInteger = require( '@stdlib/assert/is-nonnegative-integer' );
 var isMostlySafeCast = require( './../../base/assert/is-mostly-safe-data-type-cast' );
 var isOrder = require( './../../base/assert/is-order' );
+var isFunction = require( '@stdlib/assert/is-function' );
+var contains = require( '@stdlib/array/base/assert/contains' ).factory;
+var join = require( '@stdlib/array/base/join' );
 var getShape = require( './../../shape' );
 var getOrder = require( './../../order' );
 var getStrides = require( './../../strides' );
+var getOffset = require( './../../offset' );
 var getData = require( './../../base/data-buffer' );
 var getDType = require( './../../base/dtype' );
+var resolveStr = require( './../../base/dtype-resolve-str' );
 var shape2strides = require( './../../base/shape2strides' );
+var reshapeStrides = require( './../../base/reshape-strides' );
 var strides2order = require( './../../base/strides2order' );
 var flattenShape = require( './../../base/flatten-shape' );
 var assign = require( './../../base/assign' );
 var ndarray = require( './../../base/ctor' );
+var view = require( './../../base/view' );
 var emptyLike = require( './../../empty-like' );
 var format = require( '@stdlib/string/format' );
 
@@ -44,6 +51,8 @@ var format = require( '@stdlib/string/format' );
 
 var ROW_MAJOR = 'row-major';
 var COL_MAJOR = 'column-major';
+var COPY_MODES = [ 'if-needed', 'never', 'always' ];
+var isCopyMode = contains( COPY_MODES );
 
 
 // MAIN //
@@ -56,9 +65,12 @@ var COL_MAJOR = 'column-major';
 * @param {NonNegativeInteger} [options.depth] - maximum number of dimensions to flatten
 * @param {string} [options.order='row-major'] - order in which input ndarray elements should be flattened
 * @param {*} [options.dtype] - output ndarray data type
+* @param {string} [options.copy='always'] - specifies whether to copy input ndarray elements
+* @param {Object} [options.pool] - buffer pool from which to allocate the output ndarray data buffer (e.g., as returned by `@stdlib/ndarray/base/buffer-pool`)
 * @throws {TypeError} first argument must be an ndarray-like object
 * @throws {TypeError} options argument must be an object
 * @throws {TypeError} must provide valid options
+* @throws {Error} unable to flatten without copying when the `copy` option is `'never'`
 * @returns {ndarray} output ndarray
 *
 * @example
@@ -230,10 +242,13 @@ var COL_MAJOR = 'column-major';
 * // returns <ndarray>[ 6.0, 5.0, 4.0, 3.0, 2.0, 1.0 ]
 */
 function flatten( x, options ) {
-	var view;
+	var eopts;
 	var opts;
 	var xsh;
+	var tmp;
+	var sh;
 	var st;
+	var dt;
 	var o;
 	var y;
 
@@ -246,7 +261,8 @@ function flatten( x, options ) {
 	opts = {
 		'depth': xsh.length,    // by default, flatten to a one-dimensional ndarray
 		'order': ROW_MAJOR,     // by default, flatten in lexicographic order (i.e., trailing dimensions first; e.g., if `x` is a matrix, flatten row-by-row)
-		'dtype': getDType( x )
+		'dtype': getDType( x ),
+		'copy': 'always'        // by default, always return a copy
 	};
 
 	// Resolve function options...
@@ -290,20 +306,54 @@ function flatten( x, options ) {
 			}
 			opts.dtype = options.dtype;
 		}
+		if ( hasOwnProp( options, 'copy' ) ) {
+			if ( !isCopyMode( options.copy ) ) {
+				throw new TypeError( format( 'invalid option. `%s` option must be one of the following: "%s". Option: `%s`.', 'copy', join( COPY_MODES, '", "' ), options.copy ) );
+			}
+			opts.copy = options.copy;
+		}
+		if ( hasOwnProp( options, 'pool' ) ) {
+			if ( !isPlainObject( options.pool ) || !isFunction( options.pool.malloc ) ) {
+				throw new TypeError( format( 'invalid option. `%s` option must be a buffer pool. Option: `%s`.', 'pool', options.pool ) );
+			}
+			opts.pool = options.pool;
+		}
+	}
+	// Attempt to flatten without copying data...
+	if ( opts.copy !== 'always' ) {
+		sh = flattenShape( xsh, opts.depth );
+		st = null;
+		dt = resolveStr( getDType( x ) );
+		if ( dt !== null && resolveStr( opts.dtype ) === dt ) {
+			st = reshapeStrides( xsh, getStrides( x ), sh, opts.order );
+		}
+		if ( st !== null ) {
+			if ( sh.length === 0 ) {
+				st = [ 0 ];
+			}
+			return view( x, sh, st, getOffset( x ), false, opts.order );
+		}
+		if ( opts.copy === 'never' ) {
+			throw new Error( format( 'invalid argument. Unable to flatten the input ndarray without copying data. Shape: `[%s]`. Strides: `[%s]`.', join( xsh, ',' ), join( getStrides( x ), ',' ) ) );
+		}
 	}
 	// Create an output ndarray having contiguous memory:
-	y = emptyLike( x, {
+	eopts = {
 		'shape': flattenShape( xsh, opts.depth ),
 		'order': opts.order,
 		'dtype': opts.dtype
-	});
+	};
+	if ( opts.pool ) {
+		eopts.pool = opts.pool;
+	}
+	y = emptyLike( x, eopts );
 
 	// Create a view on top of the output ndarray having the same shape as the input ndarray:
 	st = ( xsh.length > 0 ) ? shape2strides( xsh, opts.order ) : [ 0 ];
-	view = new ndarray( opts.dtype, getData( y ), xsh, st, 0, opts.order );
+	tmp = new ndarray( opts.dtype, getData( y ), xsh, st, 0, opts.order );
 
 	// Copy elements to the output ndarray:
-	assign( [ x, view ] );
+	assign( [ x, tmp ] );
 
 	return y;
 }
@@ -0,0 +1,79 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, DataType, Order, Mode } from '@stdlib/types/ndarray';
+
+/**
+* Interface defining function options.
+*/
+interface Options {
+	/**
+	* Boolean indicating whether an array should be read-only. Default: false.
+	*/
+	readonly?: boolean;
+
+	/**
+	* Specifies how to handle a linear index which exceeds array dimensions (default: 'throw').
+	*/
+	mode?: Mode;
+
+	/**
+	* Specifies how to handle subscripts which exceed array dimensions on a per dimension basis (default: ['throw']).
+	*/
+	submode?: Array<Mode>;
+}
+
+/**
+* Creates an ndarray view of an ArrayBuffer.
+*
+* ## Notes
+*
+* -   The function computes the index offset from the provided strides, such that the view's minimum accessible element is the element located at `byteOffset`.
+* -   The returned ndarray shares memory with the provided ArrayBuffer.
+*
+* @param dtype - data type
+* @param buffer - ArrayBuffer
+* @param shape - array shape
+* @param strides - array strides
+* @param byteOffset - byte offset
+* @param order - memory layout (either row-major or column-major)
+* @param options - function options
+* @param options.readonly - boolean indicating whether to return a read-only ndarray
+* @param options.mode - specifies how to handle indices which exceed ndarray dimensions
+* @param options.submode - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
+* @throws data type must be compatible with the provided ArrayBuffer
+* @throws ArrayBuffer must contain every element of the ndarray view
+* @returns ndarray
+*
+* @example
+* var ArrayBuffer = require( '@stdlib/array/buffer' );
+*
+* var buf = new ArrayBuffer( 32 );
+* var x = arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+* // returns <ndarray>
+*/
+declare function arraybuffer2ndarray( dtype: DataType, buffer: ArrayBuffer, shape: ArrayLike<number>, strides: ArrayLike<number>, byteOffset: number, order: Order, options?: Options ): ndarray;
+
+
+// EXPORTS //
+
+export = arraybuffer2ndarray;
@@ -0,0 +1,99 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import arraybuffer2ndarray = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ); // $ExpectType ndarray
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major', {} ); // $ExpectType ndarray
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an ArrayBuffer...
+{
+	arraybuffer2ndarray( 'float64', '5', [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', 5, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', true, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', null, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', {}, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a third argument which is not an array-like object containing numbers...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray( 'float64', buf, '5', [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, 5, [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, true, [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, null, [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, {}, [ 2, 1 ], 0, 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a fourth argument which is not an array-like object containing numbers...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], '5', 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], 5, 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], true, 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], null, 0, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], {}, 0, 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a fifth argument which is not a number...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], '5', 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], true, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], null, 'row-major' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], {}, 'row-major' ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a sixth argument which is not a recognized order...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, '5' ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 5 ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, true ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, null ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `readonly` option which is not a boolean...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major', { 'readonly': '5' } ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major', { 'readonly': 5 } ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major', { 'readonly': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const buf = new ArrayBuffer( 32 );
+
+	arraybuffer2ndarray(); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0 ); // $ExpectError
+	arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major', {}, {} ); // $ExpectError
+}
@@ -0,0 +1,47 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var ArrayBuffer = require( '@stdlib/array/buffer' );
+var Float64Array = require( '@stdlib/array/float64' );
+var ndarray2array = require( './../../to-array' );
+var arraybuffer2ndarray = require( './../lib' );
+
+// Create an ArrayBuffer containing eight double-precision floating-point numbers:
+var buf = new ArrayBuffer( 64 );
+var x = new Float64Array( buf );
+var i;
+for ( i = 0; i < x.length; i++ ) {
+	x[ i ] = i;
+}
+
+// Create a 2x2 row-major view of the last four elements:
+var y = arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 32, 'row-major' );
+console.log( ndarray2array( y ) );
+// => [ [ 4, 5 ], [ 6, 7 ] ]
+
+// Create a column-major view of the same elements having reversed columns:
+y = arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 1, -2 ], 32, 'column-major' );
+console.log( ndarray2array( y ) );
+// => [ [ 6, 4 ], [ 7, 5 ] ]
+
+// Mutations to the ArrayBuffer are reflected in the view:
+x[ 4 ] = 100.0;
+console.log( ndarray2array( y ) );
+// => [ [ 6, 100 ], [ 7, 5 ] ]
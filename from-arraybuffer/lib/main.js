@@ -20,11 +20,13 @@
 
 // MODULES //
 
-var isGenericDataType = require( './../../../base/assert/is-generic-data-type' );
-var isBinaryDataType = require( './../../../base/assert/is-binary-data-type' );
-var minmaxViewBufferIndex = require( './../../../base/minmax-view-buffer-index' );
-var strides2offset = require( './../../../base/strides2offset' );
-var ndarray = require( './../../../ctor' );
+var isGenericDataType = require( './../../base/assert/is-generic-data-type' );
+var isBinaryDataType = require( './../../base/assert/is-binary-data-type' );
+var minmaxViewBufferIndex = require( './../../base/minmax-view-buffer-index' );
+var strides2offset = require( './../../base/strides2offset' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+var numel = require( './../../base/numel' );
+var ndarray = require( './../../ctor' );
 var arraybuffer2buffer = require( '@stdlib/buffer/from-arraybuffer' );
 var typedarray = require( '@stdlib/array/typed' );
 var format = require( '@stdlib/string/format' );
@@ -33,9 +35,13 @@ var format = require( '@stdlib/string/format' );
 // MAIN //
 
 /**
-* Creates an ndarray from an ArrayBuffer.
+* Creates an ndarray view of an ArrayBuffer.
+*
+* ## Notes
+*
+* -   The function computes the index offset from the provided strides, such that the view's minimum accessible element is the element located at `byteOffset`.
+* -   The returned ndarray shares memory with the provided ArrayBuffer.
 *
-* @private
 * @param {*} dtype - data type
 * @param {ArrayBuffer} buffer - ArrayBuffer
 * @param {NonNegativeIntegerArray} shape - array shape
@@ -47,6 +53,7 @@ var format = require( '@stdlib/string/format' );
 * @param {string} [options.mode='throw'] - specifies how to handle indices which exceed ndarray dimensions
 * @param {StringArray} [options.submode=[options.mode]] - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
 * @throws {TypeError} data type must be compatible with the provided ArrayBuffer
+* @throws {RangeError} ArrayBuffer must contain every element of the ndarray view
 * @returns {ndarray} ndarray
 *
 * @example
@@ -115,7 +122,7 @@ var format = require( '@stdlib/string/format' );
 * var N = numel( v );
 * // returns 2
 */
-function arraybuffer2ndarray( dtype, buffer, shape, strides, byteOffset, order, options ) { // TODO: move to `@stdlib/ndarray/from-arraybuffer`
+function arraybuffer2ndarray( dtype, buffer, shape, strides, byteOffset, order, options ) {
 	var offset;
 	var buf;
 	var idx;
@@ -126,8 +133,15 @@ function arraybuffer2ndarray( dtype, buffer, shape, strides, byteOffset, order,
 	}
 	// Compute the number of underlying elements across which the ndarray view will span:
 	offset = strides2offset( shape, strides );
-	idx = minmaxViewBufferIndex( shape, strides, offset );
-	N = idx[ 1 ] - idx[ 0 ] + 1;
+	if ( shape.length > 0 && numel( shape ) === 0 ) {
+		N = 0;
+	} else {
+		idx = minmaxViewBufferIndex( shape, strides, offset );
+		N = idx[ 1 ] - idx[ 0 ] + 1;
+	}
+	if ( byteOffset + ( N*bytesPerElement( dtype ) ) > buffer.byteLength ) {
+		throw new RangeError( format( 'invalid argument. ArrayBuffer has insufficient capacity. Either specify a different data type, shape, strides, or byte offset or provide a larger ArrayBuffer. Minimum capacity: `%u`. Actual capacity: `%u`.', byteOffset + ( N*bytesPerElement( dtype ) ), buffer.byteLength ) );
+	}
 
 	// Create the underlying ndarray buffer:
 	if ( isBinaryDataType( dtype ) ) {
@@ -0,0 +1,143 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var ArrayBuffer = require( '@stdlib/array/buffer' );
+var Float64Array = require( '@stdlib/array/float64' );
+var isBuffer = require( '@stdlib/assert/is-buffer' );
+var isFloat32Array = require( '@stdlib/assert/is-float32array' );
+var getShape = require( './../../shape' );
+var getStrides = require( './../../strides' );
+var getOffset = require( './../../offset' );
+var getData = require( './../../data-buffer' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
+var ndarray2array = require( './../../to-array' );
+var arraybuffer2ndarray = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof arraybuffer2ndarray, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a "generic" data type', function test( t ) {
+	t.throws( badValue, TypeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		arraybuffer2ndarray( 'generic', new ArrayBuffer( 32 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	}
+});
+
+tape( 'the function throws an error if an ArrayBuffer has insufficient capacity', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		[ [ 2, 3 ], [ 3, 1 ], 0 ],
+		[ [ 2, 2 ], [ 2, 1 ], 8 ],
+		[ [ 2, 2 ], [ -4, 1 ], 0 ]
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			arraybuffer2ndarray( 'float64', new ArrayBuffer( 32 ), value[ 0 ], value[ 1 ], value[ 2 ], 'row-major' );
+		};
+	}
+});
+
+tape( 'the function returns an ndarray view of an ArrayBuffer', function test( t ) {
+	var buf;
+	var x;
+
+	buf = new ArrayBuffer( 32 );
+	x = arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	t.deepEqual( getShape( x ), [ 2, 2 ], 'returns expected value' );
+	t.deepEqual( getStrides( x ), [ 2, 1 ], 'returns expected value' );
+	t.strictEqual( getOffset( x ), 0, 'returns expected value' );
+	t.strictEqual( getData( x ).buffer, buf, 'returns expected value' );
+
+	// The view shares memory with the ArrayBuffer:
+	( new Float64Array( buf ) )[ 3 ] = 4.0;
+	t.strictEqual( x.get( 1, 1 ), 4.0, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports negative strides', function test( t ) {
+	var buf;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ).buffer;
+	x = arraybuffer2ndarray( 'float64', buf, [ 2, 2 ], [ -2, -1 ], 0, 'row-major' );
+
+	t.strictEqual( getOffset( x ), 3, 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 4.0, 3.0 ], [ 2.0, 1.0 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports a byte offset', function test( t ) {
+	var buf;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ).buffer;
+	x = arraybuffer2ndarray( 'float64', buf, [ 1, 2 ], [ 2, 1 ], 16, 'row-major' );
+
+	t.strictEqual( getData( x ).length, 2, 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 3.0, 4.0 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports non-double data types', function test( t ) {
+	var x;
+
+	x = arraybuffer2ndarray( 'float32', new ArrayBuffer( 32 ), [ 4, 2 ], [ 2, 1 ], 0, 'row-major' );
+	t.strictEqual( isFloat32Array( getData( x ) ), true, 'returns expected value' );
+
+	x = arraybuffer2ndarray( 'binary', new ArrayBuffer( 32 ), [ 4, 2 ], [ 2, 1 ], 0, 'row-major' );
+	t.strictEqual( isBuffer( getData( x ) ), true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports empty arrays', function test( t ) {
+	var x = arraybuffer2ndarray( 'float64', new ArrayBuffer( 0 ), [ 2, 0 ], [ 0, 1 ], 0, 'row-major' );
+	t.deepEqual( getShape( x ), [ 2, 0 ], 'returns expected value' );
+	t.strictEqual( getData( x ).length, 0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports providing ndarray options', function test( t ) {
+	var x = arraybuffer2ndarray( 'float64', new ArrayBuffer( 32 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major', {
+		'readonly': true
+	});
+	t.strictEqual( isReadOnly( x ), true, 'returns expected value' );
+	t.end();
+});
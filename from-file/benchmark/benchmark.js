@@ -0,0 +1,85 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var bench = require( '@stdlib/bench' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var fromFile = require( './../lib' );
+
+
+// VARIABLES //
+
+var FIXTURE = join( __dirname, '..', 'test', 'fixtures', 'float64.bin' );
+
+
+// MAIN //
+
+bench( format( '%s:access=readonly', pkg ), function benchmark( b ) {
+	var opts;
+	var out;
+	var i;
+
+	opts = {
+		'byteOffset': 16
+	};
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = fromFile( FIXTURE, [ 4, 4 ], opts );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( out ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:access=copy-on-write', pkg ), function benchmark( b ) {
+	var opts;
+	var out;
+	var i;
+
+	opts = {
+		'byteOffset': 16,
+		'access': 'copy-on-write'
+	};
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = fromFile( FIXTURE, [ 4, 4 ], opts );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( out ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
@@ -0,0 +1,108 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, DataType, Order, Mode } from '@stdlib/types/ndarray';
+
+/**
+* Access mode.
+*/
+type Access = 'readonly' | 'copy-on-write' | 'readwrite';
+
+/**
+* Interface defining function options.
+*/
+interface Options {
+	/**
+	* Underlying data type (default: 'float64').
+	*/
+	dtype?: DataType;
+
+	/**
+	* Specifies whether an array is row-major (C-style) or column-major (Fortran-style) (default: 'row-major').
+	*/
+	order?: Order;
+
+	/**
+	* Array strides.
+	*/
+	strides?: ArrayLike<number>;
+
+	/**
+	* Byte offset at which the ndarray data begins within the file (default: 0).
+	*/
+	byteOffset?: number;
+
+	/**
+	* Access mode (default: 'readonly').
+	*/
+	access?: Access;
+
+	/**
+	* Specifies how to handle a linear index which exceeds array dimensions (default: 'throw').
+	*/
+	mode?: Mode;
+
+	/**
+	* Specifies how to handle subscripts which exceed array dimensions on a per dimension basis (default: ['throw']).
+	*/
+	submode?: Array<Mode>;
+}
+
+/**
+* Creates an ndarray backed by a region of a file.
+*
+* ## Notes
+*
+* -   When the native add-on is available, the file region is memory-mapped, such that file contents are paged in on demand and never need to fit in memory all at once. Otherwise, the file region is read into memory.
+* -   The file region begins at `byteOffset` and spans the number of bytes needed to access every element of an ndarray having the specified shape and strides.
+*
+* @param path - file path
+* @param shape - array shape
+* @param options - function options
+* @param options.dtype - data type (default: 'float64')
+* @param options.order - array order (default: 'row-major')
+* @param options.strides - array strides
+* @param options.byteOffset - byte offset at which the ndarray data begins within the file (default: 0)
+* @param options.access - access mode (default: 'readonly')
+* @param options.mode - specifies how to handle indices which exceed array dimensions (default: 'throw')
+* @param options.submode - specifies how to handle subscripts which exceed array dimensions on a per dimension basis (default: ['throw'])
+* @throws number of strides must equal the number of dimensions
+* @throws file must contain the specified region
+* @returns ndarray
+*
+* @example
+* var getShape = require( '@stdlib/ndarray/shape' );
+*
+* var x = fromFile( './weights.bin', [ 1000, 1000 ], {
+*     'dtype': 'float32'
+* });
+* // returns <ndarray>
+*
+* var sh = getShape( x );
+* // returns [ 1000, 1000 ]
+*/
+declare function fromFile( path: string, shape: ArrayLike<number> | number, options?: Options ): ndarray;
+
+
+// EXPORTS //
+
+export = fromFile;
@@ -0,0 +1,76 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import fromFile = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	fromFile( './weights.bin', [ 2, 2 ] ); // $ExpectType ndarray
+	fromFile( './weights.bin', 4 ); // $ExpectType ndarray
+	fromFile( './weights.bin', [ 2, 2 ], {} ); // $ExpectType ndarray
+	fromFile( './weights.bin', [ 2, 2 ], { 'dtype': 'float32', 'byteOffset': 16, 'access': 'copy-on-write' } ); // $ExpectType ndarray
+}
+
+// The compiler throws an error if the function is provided a first argument which is not a string...
+{
+	fromFile( 5, [ 2, 2 ] ); // $ExpectError
+	fromFile( true, [ 2, 2 ] ); // $ExpectError
+	fromFile( null, [ 2, 2 ] ); // $ExpectError
+	fromFile( {}, [ 2, 2 ] ); // $ExpectError
+	fromFile( [], [ 2, 2 ] ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not a valid shape...
+{
+	fromFile( './weights.bin', '5' ); // $ExpectError
+	fromFile( './weights.bin', true ); // $ExpectError
+	fromFile( './weights.bin', null ); // $ExpectError
+	fromFile( './weights.bin', {} ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	fromFile( './weights.bin', [ 2, 2 ], '5' ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], 5 ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], true ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], null ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an `access` option which is not a recognized access mode...
+{
+	fromFile( './weights.bin', [ 2, 2 ], { 'access': 'beep' } ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], { 'access': 5 } ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], { 'access': true } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `byteOffset` option which is not a number...
+{
+	fromFile( './weights.bin', [ 2, 2 ], { 'byteOffset': '5' } ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], { 'byteOffset': true } ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], { 'byteOffset': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	fromFile(); // $ExpectError
+	fromFile( './weights.bin' ); // $ExpectError
+	fromFile( './weights.bin', [ 2, 2 ], {}, {} ); // $ExpectError
+}
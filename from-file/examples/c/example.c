@@ -0,0 +1,64 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/from_file.h"
+#include "stdlib/ndarray/ctor.h"
+#include "stdlib/ndarray/dtypes.h"
+#include "stdlib/ndarray/index_modes.h"
+#include "stdlib/ndarray/orders.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+int main( void ) {
+	const char *path = "./example.bin";
+
+	// Write a file containing six double-precision floating-point numbers:
+	double values[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+	FILE *fp = fopen( path, "wb" );
+	if ( fp == NULL ) {
+		fprintf( stderr, "Error opening file.\n" );
+		exit( EXIT_FAILURE );
+	}
+	fwrite( values, sizeof( double ), 6, fp );
+	fclose( fp );
+
+	// Specify the array shape and strides:
+	int64_t shape[] = { 2, 3 };
+	int64_t strides[] = { 24, 8 };
+	int8_t submodes[] = { STDLIB_NDARRAY_INDEX_ERROR };
+
+	// Create an ndarray backed by the file:
+	struct ndarray *x = stdlib_ndarray_from_file( path, 0, STDLIB_NDARRAY_FROM_FILE_READONLY, STDLIB_NDARRAY_FLOAT64, 2, shape, strides, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+	if ( x == NULL ) {
+		fprintf( stderr, "Error mapping file.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	// Print the array elements:
+	double v;
+	int64_t i;
+	for ( i = 0; i < stdlib_ndarray_length( x ); i++ ) {
+		stdlib_ndarray_iget_float64( x, i, &v );
+		printf( "x[%" PRId64 "] = %lf\n", i, v );
+	}
+
+	// Free allocated memory and unmap the file:
+	stdlib_ndarray_from_file_free( x );
+	remove( path );
+}
@@ -0,0 +1,65 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var join = require( 'path' ).join;
+var fs = require( 'fs' );
+var tmpdir = require( '@stdlib/os/tmpdir' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var ndarray2array = require( './../../to-array' );
+var fromFile = require( './../lib' );
+
+// Write a file containing a 16 byte header followed by twelve double-precision floating-point numbers:
+var path = join( tmpdir(), 'stdlib-ndarray-from-file-example.bin' );
+var data = new Float64Array( 14 );
+var i;
+for ( i = 2; i < data.length; i++ ) {
+	data[ i ] = i - 2;
+}
+fs.writeFileSync( path, new Uint8Array( data.buffer ) );
+
+// Create a read-only 3x4 ndarray backed by the file contents following the header:
+var x = fromFile( path, [ 3, 4 ], {
+	'byteOffset': 16
+});
+console.log( ndarray2array( x ) );
+// => [ [ 0, 1, 2, 3 ], [ 4, 5, 6, 7 ], [ 8, 9, 10, 11 ] ]
+
+// Create a view of the same region having reversed rows:
+x = fromFile( path, [ 3, 4 ], {
+	'byteOffset': 16,
+	'strides': [ -4, 1 ]
+});
+console.log( ndarray2array( x ) );
+// => [ [ 8, 9, 10, 11 ], [ 4, 5, 6, 7 ], [ 0, 1, 2, 3 ] ]
+
+// Create a copy-on-write ndarray whose mutations are not written to the file:
+x = fromFile( path, [ 12 ], {
+	'byteOffset': 16,
+	'access': 'copy-on-write'
+});
+x.set( 0, 100.0 );
+console.log( x.get( 0 ) );
+// => 100
+
+console.log( fs.readFileSync( path ).readDoubleLE( 16 ) );
+// => 0
+
+fs.unlinkSync( path );
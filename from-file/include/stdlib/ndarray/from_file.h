@@ -0,0 +1,70 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef STDLIB_NDARRAY_FROM_FILE_H
+#define STDLIB_NDARRAY_FROM_FILE_H
+
+#include "stdlib/ndarray/ctor.h"
+#include <stdint.h>
+
+/**
+* Enumeration of file mapping access modes.
+*/
+enum STDLIB_NDARRAY_FROM_FILE_ACCESS {
+	// Read-only mapping (writing to mapped memory is not permitted):
+	STDLIB_NDARRAY_FROM_FILE_READONLY = 0,
+
+	// Private copy-on-write mapping (writes are not propagated to the underlying file):
+	STDLIB_NDARRAY_FROM_FILE_COPY_ON_WRITE = 1,
+
+	// Shared read-write mapping (writes are propagated to the underlying file):
+	STDLIB_NDARRAY_FROM_FILE_READWRITE = 2
+};
+
+/*
+* If C++, prevent name mangling so that the compiler emits a binary file having undecorated names, thus mirroring the behavior of a C compiler.
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+* Maps a region of a file into memory.
+*/
+uint8_t * stdlib_ndarray_from_file_map( const char *path, const int64_t byteOffset, const int64_t byteLength, const int8_t access );
+
+/**
+* Unmaps a region of a file previously mapped into memory.
+*/
+int8_t stdlib_ndarray_from_file_unmap( uint8_t *data, const int64_t byteLength );
+
+/**
+* Returns a pointer to a dynamically allocated ndarray whose underlying data buffer is a memory-mapped region of a file.
+*/
+struct ndarray * stdlib_ndarray_from_file( const char *path, const int64_t byteOffset, const int8_t access, int16_t dtype, int64_t ndims, int64_t *shape, int64_t *strides, int8_t order, int8_t imode, int64_t nsubmodes, int8_t *submodes );
+
+/**
+* Frees a memory-mapped ndarray, unmapping the underlying file region.
+*/
+void stdlib_ndarray_from_file_free( struct ndarray *arr );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !STDLIB_NDARRAY_FROM_FILE_H
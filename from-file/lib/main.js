@@ -0,0 +1,170 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var statSync = require( 'fs' ).statSync;
+var isString = require( '@stdlib/assert/is-string' ).isPrimitive;
+var isNonNegativeInteger = require( '@stdlib/assert/is-nonnegative-integer' ).isPrimitive;
+var isNonNegativeIntegerArray = require( '@stdlib/assert/is-nonnegative-integer-array' ).primitives;
+var isEmptyCollection = require( '@stdlib/assert/is-empty-collection' );
+var isError = require( '@stdlib/assert/is-error' );
+var tryRequire = require( '@stdlib/utils/try-require' );
+var ArrayBuffer = require( '@stdlib/array/buffer' );
+var shape2strides = require( './../../base/shape2strides' );
+var strides2offset = require( './../../base/strides2offset' );
+var minmaxViewBufferIndex = require( './../../base/minmax-view-buffer-index' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+var numel = require( './../../base/numel' );
+var arraybuffer2ndarray = require( './../../from-arraybuffer' );
+var defaults = require( './../../defaults' );
+var format = require( '@stdlib/string/format' );
+var validate = require( './validate.js' );
+var read = require( './read.js' );
+
+
+// VARIABLES //
+
+var DEFAULT_DTYPE = defaults.get( 'dtypes.default' );
+var DEFAULT_ORDER = defaults.get( 'order' );
+
+// Attempt to load the native add-on for memory mapping files, falling back to reading file regions into memory:
+var mmap = tryRequire( join( __dirname, './native.js' ) );
+var region = ( isError( mmap ) ) ? read : mmap;
+
+
+// MAIN //
+
+/**
+* Creates an ndarray backed by a region of a file.
+*
+* ## Notes
+*
+* -   When the native add-on is available, the file region is memory-mapped, such that file contents are paged in on demand and never need to fit in memory all at once. Otherwise, the file region is read into memory.
+* -   The file region begins at `byteOffset` and spans the number of bytes needed to access every element of an ndarray having the specified shape and strides. The ndarray index offset is computed from the provided strides such that the first byte of the region is the minimum accessible byte.
+*
+* @param {string} path - file path
+* @param {(NonNegativeIntegerArray|NonNegativeInteger)} shape - array shape
+* @param {Options} [options] - function options
+* @param {*} [options.dtype='float64'] - data type
+* @param {string} [options.order='row-major'] - array order
+* @param {IntegerArray} [options.strides] - array strides (in units of elements)
+* @param {NonNegativeInteger} [options.byteOffset=0] - byte offset at which the ndarray data begins within the file
+* @param {string} [options.access='readonly'] - access mode
+* @param {string} [options.mode="throw"] - specifies how to handle indices which exceed array dimensions
+* @param {StringArray} [options.submode=[options.mode]] - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
+* @throws {TypeError} first argument must be a string
+* @throws {TypeError} second argument must be either a nonnegative integer or an array of nonnegative integers
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @throws {RangeError} number of strides must equal the number of dimensions
+* @throws {RangeError} file must contain the specified region
+* @returns {ndarray} ndarray
+*
+* @example
+* var getShape = require( '@stdlib/ndarray/shape' );
+*
+* var x = fromFile( './weights.bin', [ 1000, 1000 ], {
+*     'dtype': 'float32'
+* });
+* // returns <ndarray>
+*
+* var sh = getShape( x );
+* // returns [ 1000, 1000 ]
+*/
+function fromFile( path, shape ) {
+	var nopts;
+	var opts;
+	var stat;
+	var bpe;
+	var buf;
+	var err;
+	var idx;
+	var sh;
+	var st;
+	var N;
+
+	if ( !isString( path ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be a string. Value: `%s`.', path ) );
+	}
+	if ( isNonNegativeInteger( shape ) ) {
+		sh = [ shape ];
+	} else if ( isNonNegativeIntegerArray( shape ) || isEmptyCollection( shape ) ) { // eslint-disable-line max-len
+		sh = shape;
+	} else {
+		throw new TypeError( format( 'invalid argument. Second argument must be either a nonnegative integer or an array of nonnegative integers. Value: `%s`.', shape ) );
+	}
+	opts = {
+		'dtype': DEFAULT_DTYPE,
+		'order': DEFAULT_ORDER,
+		'byteOffset': 0,
+		'access': 'readonly'
+	};
+	if ( arguments.length > 2 ) {
+		err = validate( opts, arguments[ 2 ] );
+		if ( err ) {
+			throw err;
+		}
+	}
+	if ( opts.strides ) {
+		st = opts.strides;
+		if ( sh.length > 0 && st.length !== sh.length ) {
+			throw new RangeError( format( 'invalid option. `%s` option must have the same number of elements as the number of array dimensions. Option: `%s`.', 'strides', st.join( ',' ) ) );
+		}
+	} else if ( sh.length > 0 ) {
+		st = shape2strides( sh, opts.order );
+	} else {
+		st = [ 0 ];
+	}
+	bpe = bytesPerElement( opts.dtype );
+
+	// Compute the number of bytes spanned by the ndarray view:
+	if ( sh.length > 0 && numel( sh ) === 0 ) {
+		N = 0;
+	} else {
+		idx = minmaxViewBufferIndex( sh, st, strides2offset( sh, st ) );
+		N = ( idx[ 1 ]-idx[ 0 ]+1 ) * bpe;
+	}
+	if ( N === 0 ) {
+		buf = new ArrayBuffer( 0 );
+	} else {
+		stat = statSync( path );
+		if ( opts.byteOffset+N > stat.size ) {
+			throw new RangeError( format( 'invalid argument. File does not contain the specified region. File size: `%u`. Byte offset: `%u`. Byte length: `%u`.', stat.size, opts.byteOffset, N ) );
+		}
+		buf = region( path, opts.byteOffset, N, opts.access );
+	}
+	nopts = {
+		'readonly': ( opts.access === 'readonly' )
+	};
+	if ( opts.mode ) {
+		nopts.mode = opts.mode;
+	}
+	if ( opts.submode ) {
+		nopts.submode = opts.submode;
+	}
+	return arraybuffer2ndarray( opts.dtype, buf, sh, st, 0, opts.order, nopts );
+}
+
+
+// EXPORTS //
+
+module.exports = fromFile;
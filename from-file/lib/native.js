@@ -0,0 +1,64 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var addon = require( './../src/addon.node' );
+
+
+// VARIABLES //
+
+// Mapping from access modes to enumeration constants (see `stdlib/ndarray/from_file.h`):
+var ACCESS = {
+	'readonly': 0,
+	'copy-on-write': 1,
+	'readwrite': 2
+};
+
+
+// MAIN //
+
+/**
+* Returns an ArrayBuffer backed by a memory-mapped file region.
+*
+* ## Notes
+*
+* -   The region is unmapped once the returned ArrayBuffer is garbage collected.
+*
+* @private
+* @param {string} path - file path
+* @param {NonNegativeInteger} byteOffset - byte offset at which the region begins
+* @param {PositiveInteger} byteLength - region length (in bytes)
+* @param {string} access - access mode
+* @throws {Error} unable to memory-map the specified file region
+* @returns {ArrayBuffer} ArrayBuffer
+*
+* @example
+* var buf = mmap( './weights.bin', 0, 1024, 'readonly' );
+* // returns <ArrayBuffer>
+*/
+function mmap( path, byteOffset, byteLength, access ) {
+	return addon( path, byteOffset, byteLength, ACCESS[ access ] );
+}
+
+
+// EXPORTS //
+
+module.exports = mmap;
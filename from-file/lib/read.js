@@ -0,0 +1,84 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var fs = require( 'fs' );
+var ArrayBuffer = require( '@stdlib/array/buffer' );
+var arraybuffer2buffer = require( '@stdlib/buffer/from-arraybuffer' );
+var format = require( '@stdlib/string/format' );
+
+
+// MAIN //
+
+/**
+* Returns an ArrayBuffer containing a copy of a file region.
+*
+* ## Notes
+*
+* -   This function is used when memory mapping is not supported by the current environment. As the returned ArrayBuffer is a private copy, the function supports the "readonly" and "copy-on-write" access modes, but not the "readwrite" access mode.
+*
+* @private
+* @param {string} path - file path
+* @param {NonNegativeInteger} byteOffset - byte offset at which the region begins
+* @param {PositiveInteger} byteLength - region length (in bytes)
+* @param {string} access - access mode
+* @throws {Error} "readwrite" access mode requires memory mapping
+* @throws {RangeError} file must contain the requested region
+* @returns {ArrayBuffer} ArrayBuffer
+*
+* @example
+* var buf = read( './weights.bin', 0, 1024, 'readonly' );
+* // returns <ArrayBuffer>
+*/
+function read( path, byteOffset, byteLength, access ) {
+	var out;
+	var buf;
+	var fd;
+	var n;
+	var k;
+	if ( access === 'readwrite' ) {
+		throw new Error( format( 'invalid option. `%s` option cannot be "%s", as memory-mapped files are not supported in the current environment.', 'access', access ) );
+	}
+	out = new ArrayBuffer( byteLength );
+	buf = arraybuffer2buffer( out );
+	fd = fs.openSync( path, 'r' );
+	try {
+		n = 0;
+		while ( n < byteLength ) {
+			k = fs.readSync( fd, buf, n, byteLength-n, byteOffset+n );
+			if ( k === 0 ) {
+				break;
+			}
+			n += k;
+		}
+	} finally {
+		fs.closeSync( fd );
+	}
+	if ( n < byteLength ) {
+		throw new RangeError( format( 'invalid argument. File does not contain the requested region. Byte offset: `%u`. Byte length: `%u`.', byteOffset, byteLength ) );
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = read;
@@ -0,0 +1,118 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isObject = require( '@stdlib/assert/is-plain-object' );
+var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var isNonNegativeInteger = require( '@stdlib/assert/is-nonnegative-integer' ).isPrimitive;
+var isIntegerArray = require( '@stdlib/assert/is-integer-array' ).primitives;
+var isEmptyCollection = require( '@stdlib/assert/is-empty-collection' );
+var contains = require( '@stdlib/array/base/assert/contains' ).factory;
+var isOrder = require( './../../base/assert/is-order' );
+var isDataType = require( './../../base/assert/is-data-type' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+var join = require( '@stdlib/array/base/join' );
+var format = require( '@stdlib/string/format' );
+
+
+// VARIABLES //
+
+var ACCESS_MODES = [ 'readonly', 'copy-on-write', 'readwrite' ];
+var isAccessMode = contains( ACCESS_MODES );
+
+
+// MAIN //
+
+/**
+* Validates function options.
+*
+* @private
+* @param {Object} opts - destination object
+* @param {Options} options - function options
+* @param {*} [options.dtype] - data type
+* @param {string} [options.order] - array order
+* @param {IntegerArray} [options.strides] - array strides
+* @param {NonNegativeInteger} [options.byteOffset] - byte offset at which the ndarray data begins within the file
+* @param {string} [options.access] - access mode
+* @param {string} [options.mode] - specifies how to handle indices which exceed array dimensions
+* @param {StringArray} [options.submode] - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
+* @returns {(Error|null)} null or an error object
+*
+* @example
+* var opts = {};
+* var options = {
+*     'dtype': 'float32',
+*     'access': 'copy-on-write'
+* };
+* var err = validate( opts, options );
+* if ( err ) {
+*     throw err;
+* }
+*/
+function validate( opts, options ) {
+	if ( !isObject( options ) ) {
+		return new TypeError( format( 'invalid argument. Options argument must be an object. Value: `%s`.', options ) );
+	}
+	if ( hasOwnProp( options, 'dtype' ) ) {
+		opts.dtype = options.dtype;
+
+		// Only data types having a fixed number of bytes per element can be backed by raw file contents...
+		if ( !isDataType( opts.dtype ) || !bytesPerElement( opts.dtype ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be a data type having a fixed number of bytes per element. Option: `%s`.', 'dtype', opts.dtype ) );
+		}
+	}
+	if ( hasOwnProp( options, 'order' ) ) {
+		opts.order = options.order;
+		if ( !isOrder( opts.order ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be a recognized order. Option: `%s`.', 'order', opts.order ) );
+		}
+	}
+	if ( hasOwnProp( options, 'strides' ) ) {
+		opts.strides = options.strides;
+		if ( !isIntegerArray( opts.strides ) && !isEmptyCollection( opts.strides ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be an array of integers. Option: `%s`.', 'strides', opts.strides ) );
+		}
+	}
+	if ( hasOwnProp( options, 'byteOffset' ) ) {
+		opts.byteOffset = options.byteOffset;
+		if ( !isNonNegativeInteger( opts.byteOffset ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be a nonnegative integer. Option: `%s`.', 'byteOffset', opts.byteOffset ) );
+		}
+	}
+	if ( hasOwnProp( options, 'access' ) ) {
+		opts.access = options.access;
+		if ( !isAccessMode( opts.access ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be one of the following: "%s". Option: `%s`.', 'access', join( ACCESS_MODES, '", "' ), opts.access ) );
+		}
+	}
+	if ( hasOwnProp( options, 'mode' ) ) {
+		opts.mode = options.mode;
+	}
+	if ( hasOwnProp( options, 'submode' ) ) {
+		opts.submode = options.submode;
+	}
+	return null;
+}
+
+
+// EXPORTS //
+
+module.exports = validate;
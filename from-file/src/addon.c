@@ -0,0 +1,140 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "stdlib/ndarray/from_file.h"
+#include <node_api.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+// Maximum file path length (in bytes), including the terminating null byte:
+#define STDLIB_NDARRAY_FROM_FILE_MAX_PATH_LENGTH 4096
+
+/**
+* Unmaps a memory-mapped file region once the `ArrayBuffer` wrapping the region has been garbage collected.
+*
+* @param env   environment under which the function is invoked
+* @param data  pointer to the first byte of the mapped region
+* @param hint  pointer to the region length (in bytes)
+*/
+static void finalize( napi_env env, void *data, void *hint ) {
+	int64_t *len = (int64_t *)hint;
+	(void)env;
+	stdlib_ndarray_from_file_unmap( (uint8_t *)data, *len );
+	free( len );
+}
+
+/**
+* Receives JavaScript callback invocation data and returns an `ArrayBuffer` backed by a memory-mapped file region.
+*
+* ## Notes
+*
+* -   This function expects that the callback `info` argument provides access to the following JavaScript arguments:
+*
+*     -   `path`: file path
+*     -   `byteOffset`: byte offset at which the region begins
+*     -   `byteLength`: region length (in bytes)
+*     -   `access`: access mode enumeration constant
+*
+* @param env    environment under which the function is invoked
+* @param info   callback data
+* @return       Node-API value
+*/
+static napi_value addon( napi_env env, napi_callback_info info ) {
+	char path[ STDLIB_NDARRAY_FROM_FILE_MAX_PATH_LENGTH ];
+	napi_status status;
+	napi_value argv[ 4 ];
+	napi_value out;
+	int64_t byteOffset;
+	int64_t byteLength;
+	int32_t access;
+	uint8_t *data;
+	int64_t *hint;
+	size_t argc;
+	size_t n;
+
+	argc = 4;
+	status = napi_get_cb_info( env, info, &argc, argv, NULL, NULL );
+	assert( status == napi_ok );
+	if ( argc != 4 ) {
+		status = napi_throw_error( env, NULL, "invalid invocation. Must provide four arguments." );
+		assert( status == napi_ok );
+		return NULL;
+	}
+	status = napi_get_value_string_utf8( env, argv[ 0 ], path, STDLIB_NDARRAY_FROM_FILE_MAX_PATH_LENGTH, &n );
+	if ( status != napi_ok ) {
+		status = napi_throw_type_error( env, NULL, "invalid argument. First argument must be a string." );
+		assert( status == napi_ok );
+		return NULL;
+	}
+	if ( n >= STDLIB_NDARRAY_FROM_FILE_MAX_PATH_LENGTH-1 ) {
+		status = napi_throw_range_error( env, NULL, "invalid argument. First argument exceeds the maximum supported file path length." );
+		assert( status == napi_ok );
+		return NULL;
+	}
+	status = napi_get_value_int64( env, argv[ 1 ], &byteOffset );
+	assert( status == napi_ok );
+
+	status = napi_get_value_int64( env, argv[ 2 ], &byteLength );
+	assert( status == napi_ok );
+
+	status = napi_get_value_int32( env, argv[ 3 ], &access );
+	assert( status == napi_ok );
+
+	data = stdlib_ndarray_from_file_map( path, byteOffset, byteLength, (int8_t)access );
+	if ( data == NULL ) {
+		status = napi_throw_error( env, NULL, "invalid operation. Unable to memory-map the specified file region." );
+		assert( status == napi_ok );
+		return NULL;
+	}
+	hint = (int64_t *)malloc( sizeof( int64_t ) );
+	if ( hint == NULL ) {
+		stdlib_ndarray_from_file_unmap( data, byteLength );
+		status = napi_throw_error( env, NULL, "invalid operation. Unable to allocate memory." );
+		assert( status == napi_ok );
+		return NULL;
+	}
+	*hint = byteLength;
+
+	// Wrap the mapped region without copying, deferring unmapping until the `ArrayBuffer` is garbage collected:
+	status = napi_create_external_arraybuffer( env, (void *)data, (size_t)byteLength, finalize, (void *)hint, &out );
+	if ( status != napi_ok ) {
+		stdlib_ndarray_from_file_unmap( data, byteLength );
+		free( hint );
+		status = napi_throw_error( env, NULL, "invalid operation. Unable to create an external ArrayBuffer. The runtime may not support external buffers." );
+		assert( status == napi_ok );
+		return NULL;
+	}
+	return out;
+}
+
+/**
+* Initializes a Node-API module.
+*
+* @param env      environment under which the function is invoked
+* @param exports  exports object
+* @return         main export
+*/
+static napi_value init( napi_env env, napi_value exports ) {
+	napi_value fcn;
+	napi_status status = napi_create_function( env, "exports", NAPI_AUTO_LENGTH, addon, NULL, &fcn );
+	assert( status == napi_ok );
+	return fcn;
+}
+
+NAPI_MODULE( NODE_GYP_MODULE_NAME, init )
@@ -0,0 +1,296 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// Request POSIX APIs (e.g., `mmap`) and 64-bit file offsets:
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+
+#include "stdlib/ndarray/from_file.h"
+#include "stdlib/ndarray/ctor.h"
+#include "stdlib/ndarray/base/bytes_per_element.h"
+#include "stdlib/ndarray/base/minmax_view_buffer_index.h"
+#include "stdlib/ndarray/base/numel.h"
+#include "stdlib/ndarray/base/strides2offset.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#if !defined( _WIN32 )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#if !defined( _WIN32 )
+/**
+* Returns the virtual memory page size (in bytes).
+*
+* @return  page size
+*/
+static int64_t page_size( void ) {
+	long n = sysconf( _SC_PAGESIZE );
+	if ( n <= 0 ) {
+		return 4096;
+	}
+	return (int64_t)n;
+}
+#endif
+
+/**
+* Returns the number of bytes spanned by an ndarray view, as measured from the first byte of the view's underlying data buffer.
+*
+* ## Notes
+*
+* -   The function assumes that the index offset was computed such that the minimum accessible byte index is zero.
+*
+* @param ndims    number of dimensions
+* @param shape    array shape
+* @param strides  array strides (in bytes)
+* @param offset   byte offset specifying the location of the first indexed element
+* @param bpe      number of bytes per element
+* @return         number of bytes
+*/
+static int64_t view_byte_length( const int64_t ndims, const int64_t *shape, const int64_t *strides, const int64_t offset, const int64_t bpe ) {
+	int64_t idx[ 2 ];
+	stdlib_ndarray_minmax_view_buffer_index( ndims, shape, strides, offset, idx );
+	return idx[ 1 ] + bpe;
+}
+
+/**
+* Maps a region of a file into memory.
+*
+* ## Notes
+*
+* -   Memory mappings must begin at a page boundary. Accordingly, the function maps the region starting from the page containing `byteOffset` and returns a pointer to the byte located at `byteOffset`.
+* -   The file descriptor is closed before returning, as a memory mapping retains its own reference to the underlying file.
+* -   Read-only regions are mapped as shared `PROT_READ` pages, which are backed by the underlying file and are not charged against the system commit limit, thus allowing files larger than available memory to be mapped under strict overcommit accounting. Accordingly, callers must enforce read-only access (e.g., by marking the ndarray exposing the region as read-only), as writing to a read-only region raises a segmentation fault.
+* -   The function returns a null pointer if unable to open or map the file, if the file is too small to contain the requested region, or if memory mapping is not supported on the target platform.
+*
+* @param path        file path
+* @param byteOffset  byte offset at which the region begins
+* @param byteLength  region length (in bytes)
+* @param access      access mode
+* @return            pointer to the first byte of the mapped region or a null pointer
+*
+* @example
+* #include "stdlib/ndarray/from_file.h"
+* #include <stdint.h>
+*
+* uint8_t *data = stdlib_ndarray_from_file_map( "./weights.bin", 0, 1024, STDLIB_NDARRAY_FROM_FILE_READONLY );
+* if ( data == NULL ) {
+*     // Handle error...
+* }
+*
+* // ...
+*
+* stdlib_ndarray_from_file_unmap( data, 1024 );
+*/
+uint8_t * stdlib_ndarray_from_file_map( const char *path, const int64_t byteOffset, const int64_t byteLength, const int8_t access ) {
+#if defined( _WIN32 )
+	return NULL;
+#else
+	struct stat st;
+	int64_t delta;
+	int64_t len;
+	void *addr;
+	int prot;
+	int flg;
+	int fd;
+
+	if ( path == NULL || byteOffset < 0 || byteLength <= 0 ) {
+		return NULL;
+	}
+	if ( access == STDLIB_NDARRAY_FROM_FILE_READONLY ) {
+		prot = PROT_READ;
+		flg = MAP_SHARED;
+		fd = open( path, O_RDONLY );
+	} else if ( access == STDLIB_NDARRAY_FROM_FILE_COPY_ON_WRITE ) {
+		prot = PROT_READ | PROT_WRITE;
+		flg = MAP_PRIVATE;
+		fd = open( path, O_RDONLY );
+	} else if ( access == STDLIB_NDARRAY_FROM_FILE_READWRITE ) {
+		prot = PROT_READ | PROT_WRITE;
+		flg = MAP_SHARED;
+		fd = open( path, O_RDWR );
+	} else {
+		return NULL;
+	}
+	if ( fd < 0 ) {
+		return NULL;
+	}
+	// Ensure that the file contains the requested region, as accessing mapped pages beyond the end of a file raises `SIGBUS`:
+	if ( fstat( fd, &st ) != 0 || (int64_t)st.st_size < byteOffset+byteLength ) {
+		close( fd );
+		return NULL;
+	}
+	// Align the mapping to a page boundary:
+	delta = byteOffset % page_size();
+	len = byteLength + delta;
+
+	addr = mmap( NULL, (size_t)len, prot, flg, fd, (off_t)( byteOffset-delta ) );
+	close( fd );
+	if ( addr == MAP_FAILED ) {
+		return NULL;
+	}
+	return (uint8_t *)addr + delta;
+#endif
+}
+
+/**
+* Unmaps a region of a file previously mapped into memory.
+*
+* @param data        pointer returned by `stdlib_ndarray_from_file_map`
+* @param byteLength  region length (in bytes)
+* @return            status code
+*
+* @example
+* #include "stdlib/ndarray/from_file.h"
+* #include <stdint.h>
+*
+* uint8_t *data = stdlib_ndarray_from_file_map( "./weights.bin", 0, 1024, STDLIB_NDARRAY_FROM_FILE_READONLY );
+* if ( data == NULL ) {
+*     // Handle error...
+* }
+*
+* // ...
+*
+* int8_t status = stdlib_ndarray_from_file_unmap( data, 1024 );
+* if ( status != 0 ) {
+*     // Handle error...
+* }
+*/
+int8_t stdlib_ndarray_from_file_unmap( uint8_t *data, const int64_t byteLength ) {
+#if defined( _WIN32 )
+	return -1;
+#else
+	int64_t delta;
+	if ( data == NULL || byteLength <= 0 ) {
+		return -1;
+	}
+	// As mappings begin at a page boundary, recover the mapping's base address from the pointer's offset within its page:
+	delta = (int64_t)( (uintptr_t)data % (uintptr_t)page_size() );
+	if ( munmap( (void *)( data-delta ), (size_t)( byteLength+delta ) ) != 0 ) {
+		return -1;
+	}
+	return 0;
+#endif
+}
+
+/**
+* Returns a pointer to a dynamically allocated ndarray whose underlying data buffer is a memory-mapped region of a file.
+*
+* ## Notes
+*
+* -   The region begins at `byteOffset` and spans the number of bytes needed to access every element of an ndarray having the specified shape and strides. The ndarray index offset is computed from the provided strides such that the first byte of the region is the minimum accessible byte.
+* -   As is the case for `stdlib_ndarray_allocate`, the returned ndarray does **not** copy the provided shape, strides, and submodes, which must remain valid for the lifetime of the ndarray.
+* -   When the access mode is `STDLIB_NDARRAY_FROM_FILE_READONLY`, writing to the ndarray raises a segmentation fault.
+* -   The returned ndarray must be freed using `stdlib_ndarray_from_file_free`.
+*
+* @param path        file path
+* @param byteOffset  byte offset at which the ndarray data begins within the file
+* @param access      access mode
+* @param dtype       data type
+* @param ndims       number of dimensions
+* @param shape       array shape (dimensions)
+* @param strides     array strides (in bytes)
+* @param order       specifies whether an array is row-major (C-style) or column-major (Fortran-style)
+* @param imode       specifies how to handle indices which exceed array dimensions
+* @param nsubmodes   number of subscript modes
+* @param submodes    specifies how to handle subscripts which exceed array dimensions on a per dimension basis
+* @return            pointer to a dynamically allocated ndarray or, if unable to map the file or allocate memory, a null pointer
+*
+* @example
+* #include "stdlib/ndarray/from_file.h"
+* #include "stdlib/ndarray/ctor.h"
+* #include "stdlib/ndarray/dtypes.h"
+* #include "stdlib/ndarray/index_modes.h"
+* #include "stdlib/ndarray/orders.h"
+* #include <stdint.h>
+*
+* int64_t shape[] = { 1000, 1000 };
+* int64_t strides[] = { 8000, 8 };
+* int8_t submodes[] = { STDLIB_NDARRAY_INDEX_ERROR };
+*
+* struct ndarray *x = stdlib_ndarray_from_file( "./weights.bin", 0, STDLIB_NDARRAY_FROM_FILE_READONLY, STDLIB_NDARRAY_FLOAT64, 2, shape, strides, STDLIB_NDARRAY_ROW_MAJOR, STDLIB_NDARRAY_INDEX_ERROR, 1, submodes );
+* if ( x == NULL ) {
+*     // Handle error...
+* }
+*
+* // ...
+*
+* stdlib_ndarray_from_file_free( x );
+*/
+struct ndarray * stdlib_ndarray_from_file( const char *path, const int64_t byteOffset, const int8_t access, int16_t dtype, int64_t ndims, int64_t *shape, int64_t *strides, int8_t order, int8_t imode, int64_t nsubmodes, int8_t *submodes ) {
+	struct ndarray *arr;
+	int64_t offset;
+	int64_t nbytes;
+	uint8_t *data;
+	int64_t bpe;
+
+	bpe = stdlib_ndarray_bytes_per_element( dtype );
+	if ( bpe == 0 ) {
+		return NULL;
+	}
+	data = NULL;
+	nbytes = 0;
+	offset = 0;
+
+	// Only map a file region when the ndarray has elements, as zero-length mappings are not permitted...
+	if ( stdlib_ndarray_numel( ndims, shape ) > 0 ) {
+		offset = stdlib_ndarray_strides2offset( ndims, shape, strides );
+		nbytes = view_byte_length( ndims, shape, strides, offset, bpe );
+		data = stdlib_ndarray_from_file_map( path, byteOffset, nbytes, access );
+		if ( data == NULL ) {
+			return NULL;
+		}
+	}
+	arr = stdlib_ndarray_allocate( dtype, data, ndims, shape, strides, offset, order, imode, nsubmodes, submodes );
+	if ( arr == NULL ) {
+		if ( data != NULL ) {
+			stdlib_ndarray_from_file_unmap( data, nbytes );
+		}
+		return NULL;
+	}
+	return arr;
+}
+
+/**
+* Frees a memory-mapped ndarray, unmapping the underlying file region.
+*
+* ## Notes
+*
+* -   For ndarrays created using `STDLIB_NDARRAY_FROM_FILE_READWRITE`, modifications are written back to the underlying file by the operating system. Unmapping does not guarantee that modifications have been flushed to disk.
+*
+* @param arr  input ndarray
+*/
+void stdlib_ndarray_from_file_free( struct ndarray *arr ) {
+	int64_t nbytes;
+	if ( arr == NULL ) {
+		return;
+	}
+	if ( arr->data != NULL && arr->length > 0 ) {
+		nbytes = view_byte_length( arr->ndims, arr->shape, arr->strides, arr->offset, arr->BYTES_PER_ELEMENT );
+		stdlib_ndarray_from_file_unmap( arr->data, nbytes );
+	}
+	stdlib_ndarray_free( arr );
+}
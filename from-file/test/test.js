@@ -0,0 +1,296 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var readFileSync = require( 'fs' ).readFileSync;
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var isFloat32Array = require( '@stdlib/assert/is-float32array' );
+var instanceOf = require( '@stdlib/assert/instance-of' );
+var ndarray = require( './../../ctor' );
+var getShape = require( './../../shape' );
+var getStrides = require( './../../strides' );
+var getDType = require( './../../dtype' );
+var getOrder = require( './../../order' );
+var getData = require( './../../data-buffer' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
+var ndarray2array = require( './../../to-array' );
+var fromFile = require( './../lib' );
+
+
+// VARIABLES //
+
+// Fixture containing a 16 byte header followed by sixteen little-endian double-precision floating-point numbers, 0 through 15:
+var FIXTURE = join( __dirname, 'fixtures', 'float64.bin' );
+var HEADER = 16;
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof fromFile, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a first argument which is not a string', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			fromFile( value, [ 2, 2 ] );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a second argument which is neither a nonnegative integer nor an array of nonnegative integers', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		-1,
+		3.14,
+		NaN,
+		true,
+		null,
+		void 0,
+		[ -1, 2 ],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			fromFile( FIXTURE, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		null,
+		void 0,
+		[],
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			fromFile( FIXTURE, [ 2, 2 ], value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided invalid options', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		{
+			'dtype': 'generic'
+		},
+		{
+			'dtype': 'beep'
+		},
+		{
+			'order': 'beep'
+		},
+		{
+			'strides': [ 1.5, 1 ]
+		},
+		{
+			'byteOffset': -1
+		},
+		{
+			'byteOffset': 3.14
+		},
+		{
+			'access': 'beep'
+		}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+JSON.stringify( values[ i ] ) );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			fromFile( FIXTURE, [ 2, 2 ], value );
+		};
+	}
+});
+
+tape( 'the function throws an error if the number of strides does not equal the number of dimensions', function test( t ) {
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		fromFile( FIXTURE, [ 2, 2 ], {
+			'strides': [ 1 ]
+		});
+	}
+});
+
+tape( 'the function throws an error if the file does not contain the specified region', function test( t ) {
+	t.throws( badValue( [ 20 ], 0 ), RangeError, 'throws an error' );
+	t.throws( badValue( [ 16 ], HEADER+8 ), RangeError, 'throws an error' );
+	t.end();
+
+	function badValue( shape, byteOffset ) {
+		return function badValue() {
+			fromFile( FIXTURE, shape, {
+				'byteOffset': byteOffset
+			});
+		};
+	}
+});
+
+tape( 'the function returns a read-only ndarray backed by a file region (default)', function test( t ) {
+	var x = fromFile( FIXTURE, [ 4, 4 ], {
+		'byteOffset': HEADER
+	});
+
+	t.strictEqual( instanceOf( x, ndarray ), true, 'returns expected value' );
+	t.strictEqual( String( getDType( x ) ), 'float64', 'returns expected value' );
+	t.deepEqual( getShape( x ), [ 4, 4 ], 'returns expected value' );
+	t.deepEqual( getStrides( x ), [ 4, 1 ], 'returns expected value' );
+	t.strictEqual( getOrder( x ), 'row-major', 'returns expected value' );
+	t.strictEqual( isReadOnly( x ), true, 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 0, 1, 2, 3 ], [ 4, 5, 6, 7 ], [ 8, 9, 10, 11 ], [ 12, 13, 14, 15 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying an integer shape', function test( t ) {
+	var x = fromFile( FIXTURE, 3, {
+		'byteOffset': HEADER+8
+	});
+	t.deepEqual( getShape( x ), [ 3 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ 1, 2, 3 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying an array order', function test( t ) {
+	var x = fromFile( FIXTURE, [ 2, 3 ], {
+		'byteOffset': HEADER,
+		'order': 'column-major'
+	});
+	t.deepEqual( getStrides( x ), [ 1, 2 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 0, 2, 4 ], [ 1, 3, 5 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying strides', function test( t ) {
+	var x;
+
+	x = fromFile( FIXTURE, [ 2, 2 ], {
+		'byteOffset': HEADER,
+		'strides': [ 8, 2 ]
+	});
+	t.deepEqual( ndarray2array( x ), [ [ 0, 2 ], [ 8, 10 ] ], 'returns expected value' );
+
+	x = fromFile( FIXTURE, [ 2, 2 ], {
+		'byteOffset': HEADER,
+		'strides': [ -2, -1 ]
+	});
+	t.deepEqual( ndarray2array( x ), [ [ 3, 2 ], [ 1, 0 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports specifying a data type', function test( t ) {
+	var x = fromFile( FIXTURE, [ 4 ], {
+		'byteOffset': HEADER,
+		'dtype': 'float32'
+	});
+	t.strictEqual( String( getDType( x ) ), 'float32', 'returns expected value' );
+	t.strictEqual( isFloat32Array( getData( x ) ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports copy-on-write access', function test( t ) {
+	var expected;
+	var x;
+
+	expected = readFileSync( FIXTURE );
+	x = fromFile( FIXTURE, [ 4 ], {
+		'byteOffset': HEADER,
+		'access': 'copy-on-write'
+	});
+	t.strictEqual( isReadOnly( x ), false, 'returns expected value' );
+
+	x.set( 0, 100.0 );
+	t.strictEqual( x.get( 0 ), 100.0, 'returns expected value' );
+
+	// Writes must not be propagated to the underlying file:
+	t.deepEqual( readFileSync( FIXTURE ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports empty arrays', function test( t ) {
+	var x = fromFile( FIXTURE, [ 0, 4 ], {
+		'byteOffset': 1000
+	});
+	t.deepEqual( getShape( x ), [ 0, 4 ], 'returns expected value' );
+	t.strictEqual( getData( x ).length, 0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional arrays', function test( t ) {
+	var x = fromFile( FIXTURE, [], {
+		'byteOffset': HEADER+( 5*Float64Array.BYTES_PER_ELEMENT )
+	});
+	t.deepEqual( getShape( x ), [], 'returns expected value' );
+	t.strictEqual( x.get(), 5, 'returns expected value' );
+	t.end();
+});
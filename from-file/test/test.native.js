@@ -0,0 +1,122 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var resolve = require( 'path' ).resolve;
+var join = require( 'path' ).join;
+var fs = require( 'fs' );
+var tape = require( 'tape' );
+var tryRequire = require( '@stdlib/utils/try-require' );
+var tmpdir = require( '@stdlib/os/tmpdir' );
+var Float64Array = require( '@stdlib/array/float64' );
+
+
+// VARIABLES //
+
+var addon = tryRequire( resolve( __dirname, './../lib/native.js' ) );
+var opts = {
+	'skip': ( addon instanceof Error )
+};
+var FIXTURE = join( __dirname, 'fixtures', 'float64.bin' );
+var HEADER = 16;
+
+
+// FUNCTIONS //
+
+/**
+* Copies the test fixture to a temporary file.
+*
+* @private
+* @returns {string} file path
+*/
+function copyFixture() {
+	var path = join( tmpdir(), 'stdlib-ndarray-from-file-'+process.pid+'-'+Date.now()+'.bin' );
+	fs.writeFileSync( path, fs.readFileSync( FIXTURE ) );
+	return path;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', opts, function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof addon, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if unable to map a file region', opts, function test( t ) {
+	t.throws( missing, Error, 'throws an error' );
+	t.throws( oversize, Error, 'throws an error' );
+	t.end();
+
+	function missing() {
+		addon( join( __dirname, 'fixtures', 'beep.bin' ), 0, 8, 'readonly' );
+	}
+
+	function oversize() {
+		addon( FIXTURE, 0, 1024, 'readonly' );
+	}
+});
+
+tape( 'the function returns an ArrayBuffer backed by a file region (unaligned byte offset)', opts, function test( t ) {
+	var buf;
+	var x;
+
+	buf = addon( FIXTURE, HEADER+8, 24, 'readonly' );
+	t.strictEqual( buf.byteLength, 24, 'returns expected value' );
+
+	x = new Float64Array( buf );
+	t.deepEqual( x, new Float64Array( [ 1.0, 2.0, 3.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports copy-on-write mappings', opts, function test( t ) {
+	var path;
+	var buf;
+	var x;
+
+	path = copyFixture();
+	buf = addon( path, HEADER, 32, 'copy-on-write' );
+	x = new Float64Array( buf );
+	x[ 0 ] = 100.0;
+	t.strictEqual( x[ 0 ], 100.0, 'returns expected value' );
+
+	t.strictEqual( fs.readFileSync( path ).readDoubleLE( HEADER ), 0.0, 'does not modify the underlying file' );
+
+	fs.unlinkSync( path );
+	t.end();
+});
+
+tape( 'the function supports read-write mappings', opts, function test( t ) {
+	var path;
+	var buf;
+	var x;
+
+	path = copyFixture();
+	buf = addon( path, HEADER, 32, 'readwrite' );
+	x = new Float64Array( buf );
+	x[ 1 ] = 100.0;
+
+	t.strictEqual( fs.readFileSync( path ).readDoubleLE( HEADER+8 ), 100.0, 'writes through to the underlying file' );
+
+	fs.unlinkSync( path );
+	t.end();
+});
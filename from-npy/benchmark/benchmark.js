@@ -0,0 +1,103 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var Float64Array = require( '@stdlib/array/float64' );
+var ndarray = require( './../../ctor' );
+var ndarray2npy = require( './../../to-npy' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var npy2ndarray = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s:copy=false', pkg ), function benchmark( b ) {
+	var buf;
+	var out;
+	var i;
+
+	buf = ndarray2npy( new ndarray( 'float64', new Float64Array( 10000 ), [ 100, 100 ], [ 100, 1 ], 0, 'row-major' ) );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = npy2ndarray( buf );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( out ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:copy=true', pkg ), function benchmark( b ) {
+	var opts;
+	var buf;
+	var out;
+	var i;
+
+	buf = ndarray2npy( new ndarray( 'float64', new Float64Array( 10000 ), [ 100, 100 ], [ 100, 1 ], 0, 'row-major' ) );
+	opts = {
+		'copy': true
+	};
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = npy2ndarray( buf, opts );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !isndarrayLike( out ) ) {
+		b.fail( 'should return an ndarray' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:header', pkg ), function benchmark( b ) {
+	var buf;
+	var out;
+	var i;
+
+	buf = ndarray2npy( new ndarray( 'float64', new Float64Array( 10000 ), [ 100, 100 ], [ 100, 1 ], 0, 'row-major' ) );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = npy2ndarray.header( buf );
+		if ( typeof out !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( out.byteOffset !== 128 ) {
+		b.fail( 'unexpected result' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
@@ -0,0 +1,149 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, DataType, Order } from '@stdlib/types/ndarray';
+
+/**
+* Interface defining function options.
+*/
+interface Options {
+	/**
+	* Boolean indicating whether to always copy array data (default: false).
+	*/
+	copy?: boolean;
+
+	/**
+	* Boolean indicating whether to return a read-only ndarray (default: false).
+	*/
+	readonly?: boolean;
+}
+
+/**
+* Interface describing a parsed `.npy` header.
+*/
+interface Header {
+	/**
+	* Data type.
+	*/
+	dtype: DataType;
+
+	/**
+	* Array order.
+	*/
+	order: Order;
+
+	/**
+	* Array shape.
+	*/
+	shape: Array<number>;
+
+	/**
+	* Boolean indicating whether array data is stored in little-endian byte order.
+	*/
+	littleEndian: boolean;
+
+	/**
+	* Byte offset at which array data begins.
+	*/
+	byteOffset: number;
+}
+
+/**
+* Interface describing `npy2ndarray`.
+*/
+interface Npy2ndarray {
+	/**
+	* Creates an ndarray from a buffer containing data serialized in the NumPy `.npy` format.
+	*
+	* ## Notes
+	*
+	* -   By default, when array data is stored in host byte order and suitably aligned within the underlying ArrayBuffer, the returned ndarray is a view of the provided buffer and array data is **not** copied. Otherwise, array data is copied to a newly allocated buffer.
+	*
+	* @param buffer - input buffer
+	* @param options - function options
+	* @param options.copy - boolean indicating whether to always copy array data
+	* @param options.readonly - boolean indicating whether to return a read-only ndarray
+	* @throws first argument must contain a valid `.npy` header
+	* @throws first argument must contain all array data
+	* @returns ndarray
+	*
+	* @example
+	* var array = require( './../../../array' );
+	* var ndarray2npy = require( './../../../to-npy' );
+	*
+	* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+	*
+	* var x = npy2ndarray( buf );
+	* // returns <ndarray>
+	*/
+	( buffer: Uint8Array | ArrayBuffer, options?: Options ): ndarray;
+
+	/**
+	* Parses a NumPy `.npy` header.
+	*
+	* @param buffer - buffer containing at least the `.npy` header
+	* @throws first argument must contain a valid `.npy` header
+	* @returns header information
+	*
+	* @example
+	* var array = require( './../../../array' );
+	* var ndarray2npy = require( './../../../to-npy' );
+	*
+	* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+	*
+	* var h = npy2ndarray.header( buf );
+	* // returns {...}
+	*/
+	header( buffer: Uint8Array | ArrayBuffer ): Header;
+}
+
+/**
+* Creates an ndarray from a buffer containing data serialized in the NumPy `.npy` format.
+*
+* @param buffer - input buffer
+* @param options - function options
+* @returns ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+*
+* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+*
+* var x = npy2ndarray( buf );
+* // returns <ndarray>
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+*
+* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+*
+* var h = npy2ndarray.header( buf );
+* // returns {...}
+*/
+declare var npy2ndarray: Npy2ndarray;
+
+
+// EXPORTS //
+
+export = npy2ndarray;
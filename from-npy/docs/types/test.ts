@@ -0,0 +1,103 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import npy2ndarray = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray( buf ); // $ExpectType ndarray
+	npy2ndarray( buf.buffer ); // $ExpectType ndarray
+	npy2ndarray( buf, {} ); // $ExpectType ndarray
+	npy2ndarray( buf, { 'copy': true, 'readonly': true } ); // $ExpectType ndarray
+}
+
+// The compiler throws an error if the function is provided a first argument which is not a Uint8Array or an ArrayBuffer...
+{
+	npy2ndarray( '5' ); // $ExpectError
+	npy2ndarray( 5 ); // $ExpectError
+	npy2ndarray( true ); // $ExpectError
+	npy2ndarray( null ); // $ExpectError
+	npy2ndarray( {} ); // $ExpectError
+	npy2ndarray( [] ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray( buf, '5' ); // $ExpectError
+	npy2ndarray( buf, 5 ); // $ExpectError
+	npy2ndarray( buf, true ); // $ExpectError
+	npy2ndarray( buf, null ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `copy` option which is not a boolean...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray( buf, { 'copy': '5' } ); // $ExpectError
+	npy2ndarray( buf, { 'copy': 5 } ); // $ExpectError
+	npy2ndarray( buf, { 'copy': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `readonly` option which is not a boolean...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray( buf, { 'readonly': '5' } ); // $ExpectError
+	npy2ndarray( buf, { 'readonly': 5 } ); // $ExpectError
+	npy2ndarray( buf, { 'readonly': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray(); // $ExpectError
+	npy2ndarray( buf, {}, {} ); // $ExpectError
+}
+
+// Attached to the main export is a `header` method which returns an object...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray.header( buf ); // $ExpectType Header
+	npy2ndarray.header( buf.buffer ); // $ExpectType Header
+}
+
+// The compiler throws an error if the `header` method is provided a first argument which is not a Uint8Array or an ArrayBuffer...
+{
+	npy2ndarray.header( '5' ); // $ExpectError
+	npy2ndarray.header( 5 ); // $ExpectError
+	npy2ndarray.header( true ); // $ExpectError
+	npy2ndarray.header( null ); // $ExpectError
+	npy2ndarray.header( {} ); // $ExpectError
+}
+
+// The compiler throws an error if the `header` method is provided an unsupported number of arguments...
+{
+	const buf = new Uint8Array( 128 );
+
+	npy2ndarray.header(); // $ExpectError
+	npy2ndarray.header( buf, {} ); // $ExpectError
+}
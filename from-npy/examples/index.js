@@ -0,0 +1,56 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var join = require( 'path' ).join;
+var fs = require( 'fs' );
+var tmpdir = require( '@stdlib/os/tmpdir' );
+var discreteUniform = require( '@stdlib/random/discrete-uniform' );
+var ndarray2array = require( './../../to-array' );
+var ndarray2npy = require( './../../to-npy' );
+var fromFile = require( './../../from-file' );
+var npy2ndarray = require( './../lib' );
+
+// Create a random ndarray:
+var x = discreteUniform( [ 3, 4 ], -10, 10, {
+	'dtype': 'int32'
+});
+console.log( ndarray2array( x ) );
+
+// Serialize the ndarray in the `.npy` format and write to a file:
+var path = join( tmpdir(), 'stdlib-ndarray-from-npy-example.npy' );
+fs.writeFileSync( path, ndarray2npy( x ) );
+
+// Read the file and create an ndarray view of the file contents:
+var buf = fs.readFileSync( path );
+var y = npy2ndarray( buf );
+console.log( ndarray2array( y ) );
+
+// Parse the header and create an ndarray which is backed by the file (memory-mapped when supported):
+var h = npy2ndarray.header( buf );
+console.log( h );
+
+var z = fromFile( path, h.shape, {
+	'dtype': h.dtype,
+	'order': h.order,
+	'byteOffset': h.byteOffset
+});
+console.log( ndarray2array( z ) );
+
+fs.unlinkSync( path );
@@ -0,0 +1,180 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var IS_LITTLE_ENDIAN = require( '@stdlib/assert/is-little-endian' );
+var isUint8Array = require( '@stdlib/assert/is-uint8array' );
+var isArrayBuffer = require( '@stdlib/assert/is-arraybuffer' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var format = require( '@stdlib/string/format' );
+
+
+// VARIABLES //
+
+// Mapping from NumPy type codes (excluding byte order) to data types:
+var DTYPES = {
+	'b1': 'bool',
+	'c8': 'complex64',
+	'c16': 'complex128',
+	'f4': 'float32',
+	'f8': 'float64',
+	'i1': 'int8',
+	'i2': 'int16',
+	'i4': 'int32',
+	'u1': 'uint8',
+	'u2': 'uint16',
+	'u4': 'uint32'
+};
+
+// Magic string identifying a `.npy` file (i.e., `\x93NUMPY`):
+var MAGIC = [ 0x93, 0x4e, 0x55, 0x4d, 0x50, 0x59 ];
+
+// Regular expressions for extracting header fields:
+var RE_DESCR = /['"]descr['"]\s*:\s*['"]([<>|=]?)([a-zA-Z]\d+)['"]/;
+var RE_FORTRAN = /['"]fortran_order['"]\s*:\s*(True|False)/;
+var RE_SHAPE = /['"]shape['"]\s*:\s*\(([\d\s,L]*)\)/;
+
+
+// MAIN //
+
+/**
+* Parses a NumPy `.npy` header.
+*
+* ## Notes
+*
+* -   The function supports versions 1.0, 2.0, and 3.0 of the format.
+* -   The returned object has the following properties:
+*
+*     -   **dtype**: data type.
+*     -   **order**: array order.
+*     -   **shape**: array shape.
+*     -   **littleEndian**: boolean indicating whether array data is stored in little-endian byte order. For single-byte data types, the value matches the host byte order.
+*     -   **byteOffset**: byte offset at which array data begins.
+*
+* -   As the `byteOffset` property indicates where array data begins, the returned object may be used to create an ndarray which is backed by a memory-mapped `.npy` file (see `@stdlib/ndarray/from-file`).
+*
+* @param {(Uint8Array|ArrayBuffer)} buffer - buffer containing at least the `.npy` header
+* @throws {TypeError} must provide either a Uint8Array or an ArrayBuffer
+* @throws {Error} must provide a valid `.npy` header
+* @throws {TypeError} must provide a `.npy` header describing a supported data type
+* @returns {Object} header information
+*
+* @example
+* var Uint8Array = require( '@stdlib/array/uint8' );
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+*
+* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+*
+* var h = header( buf );
+* // returns { 'dtype': 'float64', 'order': 'row-major', 'shape': [ 2, 2 ], 'littleEndian': <boolean>, 'byteOffset': 64 }
+*/
+function header( buffer ) {
+	var prefix;
+	var major;
+	var bytes;
+	var order;
+	var shape;
+	var dtype;
+	var dims;
+	var len;
+	var str;
+	var bo;
+	var m;
+	var v;
+	var i;
+
+	if ( isUint8Array( buffer ) ) {
+		bytes = buffer;
+	} else if ( isArrayBuffer( buffer ) ) {
+		bytes = new Uint8Array( buffer );
+	} else {
+		throw new TypeError( format( 'invalid argument. Must provide either a Uint8Array or an ArrayBuffer. Value: `%s`.', buffer ) );
+	}
+	if ( bytes.length < 10 ) {
+		throw new Error( 'invalid argument. Buffer is too small to contain a `.npy` header.' );
+	}
+	for ( i = 0; i < MAGIC.length; i++ ) {
+		if ( bytes[ i ] !== MAGIC[ i ] ) {
+			throw new Error( 'invalid argument. Buffer does not begin with the `.npy` magic string.' );
+		}
+	}
+	major = bytes[ 6 ];
+	if ( major === 1 ) {
+		prefix = 10;
+		len = bytes[ 8 ] + ( bytes[ 9 ]*256 );
+	} else if ( major === 2 || major === 3 ) {
+		prefix = 12;
+		if ( bytes.length < prefix ) {
+			throw new Error( 'invalid argument. Buffer is too small to contain a `.npy` header.' );
+		}
+		len = bytes[ 8 ] + ( bytes[ 9 ]*256 ) + ( bytes[ 10 ]*65536 ) + ( bytes[ 11 ]*16777216 ); // eslint-disable-line max-len
+	} else {
+		throw new Error( format( 'invalid argument. Unsupported `.npy` format version. Version: `%u.%u`.', major, bytes[ 7 ] ) );
+	}
+	if ( bytes.length < prefix+len ) {
+		throw new Error( 'invalid argument. Buffer is too small to contain a `.npy` header.' );
+	}
+	// Header fields are restricted to ASCII characters, so we can decode the header without needing to handle multi-byte (UTF-8) sequences:
+	str = '';
+	for ( i = prefix; i < prefix+len; i++ ) {
+		str += String.fromCharCode( bytes[ i ] );
+	}
+	m = RE_DESCR.exec( str );
+	if ( m === null ) {
+		throw new TypeError( format( 'invalid argument. `.npy` header must describe a supported data type. Header: `%s`.', str.trim() ) );
+	}
+	dtype = DTYPES[ m[ 2 ] ];
+	if ( dtype === void 0 ) {
+		throw new TypeError( format( 'invalid argument. `.npy` header must describe a supported data type. Value: `%s`.', m[ 1 ]+m[ 2 ] ) );
+	}
+	bo = m[ 1 ];
+	m = RE_FORTRAN.exec( str );
+	if ( m === null ) {
+		throw new Error( format( 'invalid argument. Unable to parse `.npy` header. Header: `%s`.', str.trim() ) );
+	}
+	order = ( m[ 1 ] === 'True' ) ? 'column-major' : 'row-major';
+
+	m = RE_SHAPE.exec( str );
+	if ( m === null ) {
+		throw new Error( format( 'invalid argument. Unable to parse `.npy` header. Header: `%s`.', str.trim() ) );
+	}
+	shape = [];
+	dims = m[ 1 ].split( ',' );
+	for ( i = 0; i < dims.length; i++ ) {
+		v = dims[ i ].replace( /[\sL]/g, '' ); // note: Python 2 may serialize dimensions as long integers (e.g., `3L`)
+		if ( v.length ) {
+			shape.push( parseInt( v, 10 ) );
+		}
+	}
+	return {
+		'dtype': dtype,
+		'order': order,
+		'shape': shape,
+		'littleEndian': ( bo === '<' || ( bo !== '>' && IS_LITTLE_ENDIAN ) ),
+		'byteOffset': prefix + len
+	};
+}
+
+
+// EXPORTS //
+
+module.exports = header;
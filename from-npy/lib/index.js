@@ -0,0 +1,67 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Create an ndarray from a buffer containing data serialized in the NumPy `.npy` format.
+*
+* @module @stdlib/ndarray/from-npy
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+* var npy2ndarray = require( '@stdlib/ndarray/from-npy' );
+*
+* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+*
+* var x = npy2ndarray( buf );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( x );
+* // returns [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ]
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+* var npy2ndarray = require( '@stdlib/ndarray/from-npy' );
+*
+* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+*
+* var h = npy2ndarray.header( buf );
+* // returns {...}
+*/
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var main = require( './main.js' );
+var header = require( './header.js' );
+
+
+// MAIN //
+
+setReadOnly( main, 'header', header );
+
+
+// EXPORTS //
+
+module.exports = main;
+
+// exports: { "header": "main.header" }
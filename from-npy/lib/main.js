@@ -0,0 +1,158 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var IS_LITTLE_ENDIAN = require( '@stdlib/assert/is-little-endian' );
+var isUint8Array = require( '@stdlib/assert/is-uint8array' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var isComplexDataType = require( './../../base/assert/is-complex-floating-point-data-type' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+var shape2strides = require( './../../base/shape2strides' );
+var numel = require( './../../base/numel' );
+var arraybuffer2ndarray = require( './../../from-arraybuffer' );
+var format = require( '@stdlib/string/format' );
+var validate = require( './validate.js' );
+var parseHeader = require( './header.js' );
+
+
+// FUNCTIONS //
+
+/**
+* Reverses the byte order of each word in a byte array.
+*
+* @private
+* @param {Uint8Array} bytes - byte array
+* @param {PositiveInteger} w - word size (in bytes)
+* @returns {Uint8Array} input array
+*/
+function byteswap( bytes, w ) {
+	var tmp;
+	var i;
+	var j;
+	var k;
+	for ( i = 0; i < bytes.length; i += w ) {
+		j = i;
+		k = i + w - 1;
+		while ( j < k ) {
+			tmp = bytes[ j ];
+			bytes[ j ] = bytes[ k ];
+			bytes[ k ] = tmp;
+			j += 1;
+			k -= 1;
+		}
+	}
+	return bytes;
+}
+
+
+// MAIN //
+
+/**
+* Creates an ndarray from a buffer containing data serialized in the NumPy `.npy` format.
+*
+* ## Notes
+*
+* -   By default, when array data is stored in host byte order and suitably aligned within the underlying ArrayBuffer, the returned ndarray is a view of the provided buffer and array data is **not** copied. Otherwise, array data is copied to a newly allocated buffer.
+* -   Array data stored in non-host byte order is byte swapped during copying.
+*
+* @param {(Uint8Array|ArrayBuffer)} buffer - input buffer
+* @param {Options} [options] - function options
+* @param {boolean} [options.copy=false] - boolean indicating whether to always copy array data
+* @param {boolean} [options.readonly=false] - boolean indicating whether to return a read-only ndarray
+* @throws {TypeError} first argument must be either a Uint8Array or an ArrayBuffer
+* @throws {Error} first argument must contain a valid `.npy` header
+* @throws {TypeError} first argument must describe a supported data type
+* @throws {RangeError} first argument must contain all array data
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @returns {ndarray} ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var buf = ndarray2npy( array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] ) );
+*
+* var x = npy2ndarray( buf );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( x );
+* // returns [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ]
+*/
+function npy2ndarray( buffer ) {
+	var nbytes;
+	var bytes;
+	var opts;
+	var swap;
+	var bpe;
+	var err;
+	var buf;
+	var st;
+	var h;
+	var w;
+	var N;
+	var o;
+
+	opts = {
+		'copy': false,
+		'readonly': false
+	};
+	if ( arguments.length > 1 ) {
+		err = validate( opts, arguments[ 1 ] );
+		if ( err ) {
+			throw err;
+		}
+	}
+	h = parseHeader( buffer );
+	bytes = ( isUint8Array( buffer ) ) ? buffer : new Uint8Array( buffer );
+
+	bpe = bytesPerElement( h.dtype );
+	N = ( h.shape.length === 0 ) ? 1 : numel( h.shape ); // note: zero-dimensional ndarrays contain a single element
+	nbytes = N * bpe;
+	if ( h.byteOffset+nbytes > bytes.length ) {
+		throw new RangeError( format( 'invalid argument. Buffer does not contain all array data. Expected length: `%u`. Actual length: `%u`.', h.byteOffset+nbytes, bytes.length ) );
+	}
+	st = ( h.shape.length === 0 ) ? [ 0 ] : shape2strides( h.shape, h.order );
+
+	// Resolve the word size used for alignment and byte swapping (complex numbers are stored as pairs of real numbers):
+	w = ( isComplexDataType( h.dtype ) ) ? bpe/2 : bpe;
+
+	swap = ( w > 1 && h.littleEndian !== IS_LITTLE_ENDIAN );
+	o = bytes.byteOffset + h.byteOffset;
+	if ( opts.copy || swap || o%w !== 0 ) {
+		buf = bytes.buffer.slice( o, o+nbytes );
+		if ( swap ) {
+			byteswap( new Uint8Array( buf ), w );
+		}
+		o = 0;
+	} else {
+		buf = bytes.buffer;
+	}
+	return arraybuffer2ndarray( h.dtype, buf, h.shape, st, o, h.order, {
+		'readonly': opts.readonly
+	});
+}
+
+
+// EXPORTS //
+
+module.exports = npy2ndarray;
@@ -0,0 +1,200 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var readFileSync = require( 'fs' ).readFileSync;
+var tape = require( 'tape' );
+var IS_LITTLE_ENDIAN = require( '@stdlib/assert/is-little-endian' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var header = require( './../lib/header.js' );
+
+
+// VARIABLES //
+
+var FIXTURES = join( __dirname, 'fixtures' );
+
+
+// FUNCTIONS //
+
+/**
+* Reads a test fixture.
+*
+* @private
+* @param {string} name - fixture name
+* @returns {Uint8Array} file contents
+*/
+function fixture( name ) {
+	return new Uint8Array( readFileSync( join( FIXTURES, name ) ) );
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof header, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if not provided either a Uint8Array or an ArrayBuffer', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			header( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a buffer which does not contain a valid `.npy` header', function test( t ) {
+	var values;
+	var buf;
+	var i;
+
+	buf = fixture( 'float64_c.npy' );
+	values = [
+		new Uint8Array( 0 ),
+		buf.slice( 0, 8 ),
+		buf.slice( 0, 64 ),
+		new Uint8Array( [ 0x93, 0x4e, 0x55, 0x4d, 0x50, 0x58, 1, 0, 0, 0 ] ),
+		new Uint8Array( [ 0x93, 0x4e, 0x55, 0x4d, 0x50, 0x59, 9, 0, 0, 0 ] )
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), Error, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			header( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a header describing an unsupported data type', function test( t ) {
+	var buf;
+	var i;
+
+	buf = fixture( 'float64_c.npy' );
+
+	// Replace `<f8` with `<U8`:
+	for ( i = 0; i < buf.length; i++ ) {
+		if ( buf[ i ] === 0x66 && buf[ i+1 ] === 0x38 ) { // 'f8'
+			buf[ i ] = 0x55; // 'U'
+			break;
+		}
+	}
+	t.throws( badValue, TypeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		header( buf );
+	}
+});
+
+tape( 'the function parses a `.npy` header (version 1.0, row-major)', function test( t ) {
+	var expected;
+	var actual;
+
+	actual = header( fixture( 'float64_c.npy' ) );
+	expected = {
+		'dtype': 'float64',
+		'order': 'row-major',
+		'shape': [ 2, 3 ],
+		'littleEndian': true,
+		'byteOffset': 128
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function parses a `.npy` header (version 1.0, column-major)', function test( t ) {
+	var expected;
+	var actual;
+
+	actual = header( fixture( 'int16_f.npy' ).buffer );
+	expected = {
+		'dtype': 'int16',
+		'order': 'column-major',
+		'shape': [ 2, 3 ],
+		'littleEndian': true,
+		'byteOffset': 128
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function parses a `.npy` header (big-endian)', function test( t ) {
+	var actual = header( fixture( 'int32_be.npy' ) );
+	t.strictEqual( actual.dtype, 'int32', 'returns expected value' );
+	t.strictEqual( actual.littleEndian, false, 'returns expected value' );
+	t.deepEqual( actual.shape, [ 3 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function parses a `.npy` header (single-byte data type, zero-dimensional)', function test( t ) {
+	var actual = header( fixture( 'bool_0d.npy' ) );
+	t.strictEqual( actual.dtype, 'bool', 'returns expected value' );
+	t.strictEqual( actual.littleEndian, IS_LITTLE_ENDIAN, 'returns expected value' );
+	t.deepEqual( actual.shape, [], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function parses a `.npy` header (version 2.0)', function test( t ) {
+	var expected;
+	var actual;
+
+	actual = header( fixture( 'float32_v2.npy' ) );
+	expected = {
+		'dtype': 'float32',
+		'order': 'row-major',
+		'shape': [ 2 ],
+		'littleEndian': true,
+		'byteOffset': 128
+	};
+	t.deepEqual( actual, expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function only requires a buffer containing the header', function test( t ) {
+	var actual = header( fixture( 'float64_c.npy' ).slice( 0, 128 ) );
+	t.strictEqual( actual.byteOffset, 128, 'returns expected value' );
+	t.end();
+});
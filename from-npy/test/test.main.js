@@ -0,0 +1,287 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var readFileSync = require( 'fs' ).readFileSync;
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
+var ndarray = require( './../../ctor' );
+var getDType = require( './../../dtype' );
+var getShape = require( './../../shape' );
+var getOrder = require( './../../order' );
+var getData = require( './../../data-buffer' );
+var ndarray2array = require( './../../to-array' );
+var ndarray2npy = require( './../../to-npy' );
+var npy2ndarray = require( './../lib/main.js' );
+
+
+// VARIABLES //
+
+var FIXTURES = join( __dirname, 'fixtures' );
+
+
+// FUNCTIONS //
+
+/**
+* Reads a test fixture.
+*
+* @private
+* @param {string} name - fixture name
+* @returns {Uint8Array} file contents
+*/
+function fixture( name ) {
+	return new Uint8Array( readFileSync( join( FIXTURES, name ) ) );
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof npy2ndarray, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if not provided either a Uint8Array or an ArrayBuffer', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		null,
+		void 0,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			npy2ndarray( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var buf;
+	var i;
+
+	buf = fixture( 'float64_c.npy' );
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		null,
+		[],
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			npy2ndarray( buf, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided invalid options', function test( t ) {
+	var values;
+	var buf;
+	var i;
+
+	buf = fixture( 'float64_c.npy' );
+	values = [
+		{
+			'copy': 'beep'
+		},
+		{
+			'copy': 1
+		},
+		{
+			'readonly': 'beep'
+		},
+		{
+			'readonly': null
+		}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+JSON.stringify( values[ i ] ) );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			npy2ndarray( buf, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a buffer which does not contain all array data', function test( t ) {
+	var buf = fixture( 'float64_c.npy' );
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		npy2ndarray( buf.slice( 0, buf.length-1 ) );
+	}
+});
+
+tape( 'the function creates an ndarray from a `.npy` buffer (row-major)', function test( t ) {
+	var x = npy2ndarray( fixture( 'float64_c.npy' ) );
+	t.strictEqual( String( getDType( x ) ), 'float64', 'returns expected value' );
+	t.strictEqual( getOrder( x ), 'row-major', 'returns expected value' );
+	t.deepEqual( getShape( x ), [ 2, 3 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 0, 1, 2 ], [ 3, 4, 5 ] ], 'returns expected value' );
+	t.strictEqual( isReadOnly( x ), false, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function creates an ndarray from a `.npy` buffer (column-major)', function test( t ) {
+	var x = npy2ndarray( fixture( 'int16_f.npy' ) );
+	t.strictEqual( String( getDType( x ) ), 'int16', 'returns expected value' );
+	t.strictEqual( getOrder( x ), 'column-major', 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 1, 2, 3 ], [ 4, 5, 6 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function creates an ndarray from a `.npy` buffer (big-endian)', function test( t ) {
+	var x;
+
+	x = npy2ndarray( fixture( 'int32_be.npy' ) );
+	t.deepEqual( ndarray2array( x ), [ 1, 256, -2 ], 'returns expected value' );
+
+	x = npy2ndarray( fixture( 'complex64_be.npy' ) );
+	t.strictEqual( String( getDType( x ) ), 'complex64', 'returns expected value' );
+	t.strictEqual( x.get( 1 ).re, 3.0, 'returns expected value' );
+	t.strictEqual( x.get( 1 ).im, -4.0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function creates an ndarray from a `.npy` buffer (version 2.0)', function test( t ) {
+	var x = npy2ndarray( fixture( 'float32_v2.npy' ) );
+	t.strictEqual( String( getDType( x ) ), 'float32', 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ 1.5, -2.5 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function creates an ndarray from a `.npy` buffer (zero-dimensional)', function test( t ) {
+	var x = npy2ndarray( fixture( 'bool_0d.npy' ) );
+	t.strictEqual( String( getDType( x ) ), 'bool', 'returns expected value' );
+	t.deepEqual( getShape( x ), [], 'returns expected value' );
+	t.strictEqual( x.get(), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function creates an ndarray from a `.npy` buffer (empty)', function test( t ) {
+	var x = npy2ndarray( fixture( 'uint8_empty.npy' ) );
+	t.strictEqual( String( getDType( x ) ), 'uint8', 'returns expected value' );
+	t.deepEqual( getShape( x ), [ 0, 3 ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'by default, the function returns an ndarray view of the provided buffer (zero-copy)', function test( t ) {
+	var buf;
+	var x;
+
+	buf = fixture( 'float64_c.npy' );
+	x = npy2ndarray( buf );
+	t.strictEqual( getData( x ).buffer, buf.buffer, 'returns expected value' );
+
+	// Mutations to the buffer are reflected in the returned ndarray:
+	new Float64Array( buf.buffer, 128, 6 )[ 0 ] = 100.0;
+	t.strictEqual( x.get( 0, 0 ), 100.0, 'returns expected value' );
+
+	// Supports ArrayBuffers:
+	x = npy2ndarray( buf.buffer );
+	t.strictEqual( getData( x ).buffer, buf.buffer, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function copies array data which is not suitably aligned', function test( t ) {
+	var buf;
+	var x;
+
+	buf = fixture( 'float64_c.npy' );
+
+	// Create a byte view which is offset from an 8-byte boundary:
+	buf = new Uint8Array( buf.length+1 );
+	buf.set( fixture( 'float64_c.npy' ), 1 );
+	buf = buf.subarray( 1 );
+
+	x = npy2ndarray( buf );
+	t.notEqual( getData( x ).buffer, buf.buffer, 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 0, 1, 2 ], [ 3, 4, 5 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports always copying array data', function test( t ) {
+	var buf;
+	var x;
+
+	buf = fixture( 'float64_c.npy' );
+	x = npy2ndarray( buf, {
+		'copy': true
+	});
+	t.notEqual( getData( x ).buffer, buf.buffer, 'returns expected value' );
+	t.deepEqual( ndarray2array( x ), [ [ 0, 1, 2 ], [ 3, 4, 5 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports returning a read-only ndarray', function test( t ) {
+	var x = npy2ndarray( fixture( 'float64_c.npy' ), {
+		'readonly': true
+	});
+	t.strictEqual( isReadOnly( x ), true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports round-tripping ndarrays serialized using `@stdlib/ndarray/to-npy`', function test( t ) {
+	var x;
+	var y;
+
+	// Non-contiguous view having negative strides:
+	x = new ndarray( 'float64', new Float64Array( [ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 ] ), [ 3, 2 ], [ 1, -3 ], 3, 'row-major' );
+	y = npy2ndarray( ndarray2npy( x ) );
+	t.deepEqual( ndarray2array( y ), ndarray2array( x ), 'returns expected value' );
+
+	// Complex-valued, column-major:
+	x = new ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 ] ), [ 2, 2 ], [ 1, 2 ], 0, 'column-major' );
+	y = npy2ndarray( ndarray2npy( x ) );
+	t.strictEqual( getOrder( y ), 'column-major', 'returns expected value' );
+	t.strictEqual( y.get( 1, 0 ).re, 3.0, 'returns expected value' );
+	t.strictEqual( y.get( 0, 1 ).im, 6.0, 'returns expected value' );
+	t.end();
+});
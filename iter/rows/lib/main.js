@@ -29,10 +29,11 @@ var hasOwnProp = require( '@stdlib/assert/has-own-property' );
 var iteratorSymbol = require( '@stdlib/symbol/iterator' );
 var zeros = require( '@stdlib/array/base/zeros' );
 var getShape = require( './../../../shape' );
+var getStrides = require( './../../../base/strides' );
+var getOffset = require( './../../../base/offset' );
 var numel = require( './../../../base/numel' );
-var slice = require( './../../../base/slice' );
+var view = require( './../../../base/view' );
 var nextCartesianIndex = require( './../../../base/next-cartesian-index' ).assign;
-var args2multislice = require( '@stdlib/slice/base/args2multislice' );
 var format = require( '@stdlib/string/format' );
 
 
@@ -82,6 +83,8 @@ var format = require( '@stdlib/string/format' );
 */
 function nditerRows( x ) {
 	var options;
+	var strides;
+	var offset;
 	var shape;
 	var ndims;
 	var opts;
@@ -90,6 +93,8 @@ function nditerRows( x ) {
 	var idx;
 	var dim;
 	var S1;
+	var sh;
+	var st;
 	var N;
 	var i;
 
@@ -116,6 +121,8 @@ function nditerRows( x ) {
 	}
 	// Retrieve input array meta data:
 	shape = getShape( x );
+	strides = getStrides( x, false );
+	offset = getOffset( x );
 	ndims = shape.length;
 
 	// Ensure that the input array has sufficient dimensions...
@@ -135,11 +142,12 @@ function nditerRows( x ) {
 	// Initialize a counter:
 	i = -1;
 
-	// Initialize an index array for generating slices:
+	// Initialize an index array for resolving the index offset of each row:
 	idx = zeros( ndims );
 
-	// Set the last element to `null` to indicate that we want a full "slice" for the last dimension:
-	idx[ ndims-1 ] = null;
+	// As every row has the same shape and strides, create meta data arrays which can be shared across all row views:
+	sh = [ shape[ ndims-1 ] ];
+	st = [ strides[ ndims-1 ] ];
 
 	// Create an iterator protocol-compliant object:
 	iter = {};
@@ -159,7 +167,7 @@ function nditerRows( x ) {
 	* @returns {Object} iterator protocol-compliant object
 	*/
 	function next() {
-		var s;
+		var o;
 		var j;
 		i += 1;
 		if ( FLG || i >= N ) {
@@ -167,9 +175,11 @@ function nditerRows( x ) {
 				'done': true
 			};
 		}
-		// Create a multi-slice for the current view:
-		s = args2multislice( idx );
-
+		// Resolve the index offset of the first element in the current row:
+		o = offset;
+		for ( j = 0; j < ndims-1; j++ ) {
+			o += idx[ j ] * strides[ j ];
+		}
 		// Update the index array:
 		j = ( idx[ dim ] + 1 ) % S1;
 		idx[ dim ] = j;
@@ -177,9 +187,9 @@ function nditerRows( x ) {
 			// If we've iterated over all the rows in the current matrix, move on to the next matrix in the stack:
 			idx = nextCartesianIndex( shape, 'row-major', idx, dim-1, idx );
 		}
-		// Return the next row slice:
+		// Return the next row view:
 		return {
-			'value': slice( x, s, true, opts.writable ),
+			'value': view( x, sh, st, o, opts.writable ),
 			'done': false
 		};
 	}
@@ -0,0 +1,127 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var discreteUniform = require( '@stdlib/random/array/discrete-uniform' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var sqrt = require( '@stdlib/math/base/special/sqrt' );
+var floor = require( '@stdlib/math/base/special/floor' );
+var add = require( '@stdlib/number/float64/base/add' );
+var mul = require( '@stdlib/number/float64/base/mul' );
+var ndarray = require( './../../ctor' );
+var zeros = require( './../../zeros' );
+var shape2strides = require( './../../base/shape2strides' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var lazy = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function which evaluates `a*b + c`, where `c` is broadcast along the rows of the other operands.
+*
+* @private
+* @param {PositiveInteger} len - ndarray length
+* @param {NonNegativeIntegerArray} shape - ndarray shape
+* @returns {Function} benchmark function
+*/
+function createBenchmark( len, shape ) {
+	var expr;
+	var out;
+	var st;
+	var a;
+	var b;
+	var c;
+
+	st = shape2strides( shape, 'row-major' );
+	a = ndarray( 'float64', discreteUniform( len, -100, 100, {
+		'dtype': 'float64'
+	}), shape, st, 0, 'row-major' );
+	b = ndarray( 'float64', discreteUniform( len, -100, 100, {
+		'dtype': 'float64'
+	}), shape, st, 0, 'row-major' );
+	c = ndarray( 'float64', discreteUniform( shape[ 1 ], -100, 100, {
+		'dtype': 'float64'
+	}), [ shape[ 1 ] ], [ 1 ], 0, 'row-major' );
+	out = zeros( shape );
+
+	expr = lazy( add, lazy( mul, a, b ), c );
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var o;
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			o = expr.assign( out );
+			if ( isnan( o.iget( i%len ) ) ) {
+				b.fail( 'should not return NaN' );
+			}
+		}
+		b.toc();
+		if ( isnan( o.iget( i%len ) ) ) {
+			b.fail( 'should not return NaN' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var sh;
+	var f;
+	var i;
+
+	min = 1; // 10^min
+	max = 6; // 10^max
+
+	for ( i = min; i <= max; i++ ) {
+		len = floor( sqrt( pow( 10, i ) ) );
+		sh = [ len, len ];
+		len *= len;
+		f = createBenchmark( len, sh );
+		bench( format( '%s:ndims=%d,len=%d,shape=[%s],dtype=float64', pkg, sh.length, len, sh.join( ',' ) ), f );
+	}
+}
+
+main();
@@ -0,0 +1,150 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, DataType, Order } from '@stdlib/types/ndarray';
+
+/**
+* Interface defining `evaluate` options.
+*/
+interface Options {
+	/**
+	* Output ndarray data type.
+	*/
+	dtype?: DataType;
+
+	/**
+	* Output ndarray memory layout.
+	*/
+	order?: Order;
+}
+
+/**
+* Interface describing a lazily evaluated expression.
+*/
+interface Expression {
+	/**
+	* Broadcast shape.
+	*/
+	readonly shape: Array<number>;
+
+	/**
+	* Default output data type.
+	*/
+	readonly dtype: DataType;
+
+	/**
+	* Default output memory layout.
+	*/
+	readonly order: Order;
+
+	/**
+	* Evaluates an expression and returns a newly allocated output ndarray.
+	*
+	* @param options - function options
+	* @param options.dtype - output ndarray data type
+	* @param options.order - output ndarray memory layout
+	* @returns output ndarray
+	*
+	* @example
+	* var zeros = require( '@stdlib/ndarray/zeros' );
+	*
+	* function add( a, b ) {
+	*     return a + b;
+	* }
+	*
+	* var x = zeros( [ 2, 2 ] );
+	*
+	* var out = lazy( add, x, 1.0 ).evaluate();
+	* // returns <ndarray>
+	*/
+	evaluate( options?: Options ): ndarray;
+
+	/**
+	* Evaluates an expression and assigns results to a provided output ndarray.
+	*
+	* @param out - output ndarray
+	* @returns output ndarray
+	*
+	* @example
+	* var zeros = require( '@stdlib/ndarray/zeros' );
+	*
+	* function add( a, b ) {
+	*     return a + b;
+	* }
+	*
+	* var x = zeros( [ 2, 2 ] );
+	*
+	* var out = lazy( add, x, 1.0 ).assign( x );
+	* // returns <ndarray>
+	*
+	* var bool = ( out === x );
+	* // returns true
+	*/
+	assign<T extends ndarray = ndarray>( out: T ): T;
+}
+
+/**
+* Callback operand.
+*/
+type Operand = ndarray | Expression | any;
+
+/**
+* Returns a lazily evaluated expression which applies a callback to elements in ndarrays, lazily evaluated expressions, and/or scalar values.
+*
+* ## Notes
+*
+* -   When evaluated, all recorded operations are fused into a single loop over ndarray elements, thus avoiding the allocation of intermediate arrays.
+* -   Operands which are neither ndarrays nor lazily evaluated expressions are treated as scalar constants.
+*
+* @param fcn - callback
+* @param args - callback operands
+* @returns lazily evaluated expression
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* function add( a, b ) {
+*     return a + b;
+* }
+*
+* function mul( a, b ) {
+*     return a * b;
+* }
+*
+* var a = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+* var b = array( [ [ 5.0, 6.0 ], [ 7.0, 8.0 ] ] );
+* var c = array( [ 10.0, 20.0 ] );
+*
+* var out = lazy( add, lazy( mul, a, b ), c ).evaluate();
+* // returns <ndarray>
+*
+* var arr = ndarray2array( out );
+* // returns [ [ 15.0, 32.0 ], [ 31.0, 52.0 ] ]
+*/
+declare function lazy( fcn: ( ...args: Array<any> ) => any, ...args: Array<Operand> ): Expression;
+
+
+// EXPORTS //
+
+export = lazy;
@@ -0,0 +1,99 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+import zeros = require( './../../../zeros' );
+import lazy = require( './index' );
+
+/**
+* Adds two values.
+*
+* @param a - first value
+* @param b - second value
+* @returns sum
+*/
+function add( a: number, b: number ): number {
+	return a + b;
+}
+
+
+// TESTS //
+
+// The function returns a lazily evaluated expression...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	lazy( add, x, x ); // $ExpectType Expression
+	lazy( add, x, 1.0 ); // $ExpectType Expression
+	lazy( add, lazy( add, x, x ), x ); // $ExpectType Expression
+}
+
+// The compiler throws an error if the function is provided a first argument which is not a function...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	lazy( '5', x ); // $ExpectError
+	lazy( 5, x ); // $ExpectError
+	lazy( true, x ); // $ExpectError
+	lazy( false, x ); // $ExpectError
+	lazy( null, x ); // $ExpectError
+	lazy( undefined, x ); // $ExpectError
+	lazy( [], x ); // $ExpectError
+	lazy( {}, x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	lazy(); // $ExpectError
+}
+
+// The `evaluate` method returns an ndarray...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	lazy( add, x, x ).evaluate(); // $ExpectType ndarray
+	lazy( add, x, x ).evaluate( { 'dtype': 'float32' } ); // $ExpectType ndarray
+	lazy( add, x, x ).evaluate( { 'order': 'column-major' } ); // $ExpectType ndarray
+}
+
+// The compiler throws an error if the `evaluate` method is provided invalid options...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	lazy( add, x, x ).evaluate( '5' ); // $ExpectError
+	lazy( add, x, x ).evaluate( 5 ); // $ExpectError
+	lazy( add, x, x ).evaluate( { 'dtype': 5 } ); // $ExpectError
+	lazy( add, x, x ).evaluate( { 'order': 5 } ); // $ExpectError
+}
+
+// The `assign` method returns the output ndarray...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	lazy( add, x, x ).assign( x ); // $ExpectType float64ndarray
+}
+
+// The compiler throws an error if the `assign` method is not provided an ndarray...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	lazy( add, x, x ).assign( '5' ); // $ExpectError
+	lazy( add, x, x ).assign( 5 ); // $ExpectError
+	lazy( add, x, x ).assign( {} ); // $ExpectError
+	lazy( add, x, x ).assign(); // $ExpectError
+}
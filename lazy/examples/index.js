@@ -0,0 +1,55 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var discreteUniform = require( '@stdlib/random/array/discrete-uniform' );
+var ndarray = require( './../../ctor' );
+var ndarray2array = require( './../../to-array' );
+var lazy = require( './../lib' );
+
+function add( a, b ) {
+	return a + b;
+}
+
+function mul( a, b ) {
+	return a * b;
+}
+
+function abs( v ) {
+	return ( v < 0 ) ? -v : v;
+}
+
+// Create input ndarrays:
+var a = ndarray( 'float64', discreteUniform( 12, -10, 10 ), [ 3, 4 ], [ 4, 1 ], 0, 'row-major' );
+var b = ndarray( 'float64', discreteUniform( 12, -10, 10 ), [ 3, 4 ], [ 1, 3 ], 0, 'column-major' );
+var c = ndarray( 'float64', discreteUniform( 4, -10, 10 ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+// Record `|a*b + c| * 0.5` without evaluating intermediate results:
+var expr = lazy( mul, lazy( abs, lazy( add, lazy( mul, a, b ), c ) ), 0.5 );
+console.log( 'shape: [%s]', expr.shape.join( ', ' ) );
+console.log( 'dtype: %s', expr.dtype );
+
+// Evaluate the expression in a single pass over the input ndarrays:
+var out = expr.evaluate();
+console.log( ndarray2array( out ) );
+
+// Evaluate the expression and write the results to an existing ndarray:
+expr.assign( a );
+console.log( ndarray2array( a ) );
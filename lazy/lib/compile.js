@@ -0,0 +1,406 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+
+
+// VARIABLES //
+
+// Operand types:
+var LEAF = 0;      // input ndarray element
+var CONSTANT = 1;  // scalar value
+var OPERATION = 2; // (nested) operation
+
+
+// FUNCTIONS //
+
+/**
+* Returns a function which returns an input element value.
+*
+* @private
+* @param {NonNegativeInteger} idx - input ndarray index
+* @returns {Function} function
+*/
+function leaf( idx ) {
+	return get;
+
+	/**
+	* Returns an input element value.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} element value
+	*/
+	function get( v ) {
+		return v[ idx ];
+	}
+}
+
+/**
+* Returns a function which always returns the same (scalar) value.
+*
+* @private
+* @param {*} value - scalar value
+* @returns {Function} function
+*/
+function constant( value ) {
+	return get;
+
+	/**
+	* Returns a scalar value.
+	*
+	* @private
+	* @returns {*} scalar value
+	*/
+	function get() {
+		return value;
+	}
+}
+
+/**
+* Returns a function which applies a unary callback.
+*
+* @private
+* @param {Function} fcn - callback
+* @param {Object} a - operand
+* @returns {Function} function
+*/
+function unary( fcn, a ) {
+	var ia = a.index;
+	var fa = a.fcn;
+	if ( a.type === LEAF ) {
+		return leafOp;
+	}
+	return op;
+
+	/**
+	* Applies a callback to an input element value.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function leafOp( v ) {
+		return fcn( v[ ia ] );
+	}
+
+	/**
+	* Applies a callback to the result of evaluating an operand.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function op( v ) {
+		return fcn( fa( v ) );
+	}
+}
+
+/**
+* Returns a function which applies a binary callback.
+*
+* ## Notes
+*
+* -   In order to reduce function call overhead, the function specializes input element and scalar operands.
+*
+* @private
+* @param {Function} fcn - callback
+* @param {Object} a - first operand
+* @param {Object} b - second operand
+* @returns {Function} function
+*/
+function binary( fcn, a, b ) {
+	var ia = a.index;
+	var ib = b.index;
+	var fa = a.fcn;
+	var fb = b.fcn;
+	var ca = a.value;
+	var cb = b.value;
+	if ( a.type === LEAF ) {
+		if ( b.type === LEAF ) {
+			return leafLeaf;
+		}
+		if ( b.type === CONSTANT ) {
+			return leafConstant;
+		}
+		return leafOp;
+	}
+	if ( a.type === CONSTANT ) {
+		if ( b.type === LEAF ) {
+			return constantLeaf;
+		}
+		return constantOp;
+	}
+	if ( b.type === LEAF ) {
+		return opLeaf;
+	}
+	if ( b.type === CONSTANT ) {
+		return opConstant;
+	}
+	return opOp;
+
+	/**
+	* Applies a callback to two input element values.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function leafLeaf( v ) {
+		return fcn( v[ ia ], v[ ib ] );
+	}
+
+	/**
+	* Applies a callback to an input element value and a scalar value.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function leafConstant( v ) {
+		return fcn( v[ ia ], cb );
+	}
+
+	/**
+	* Applies a callback to an input element value and the result of evaluating an operand.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function leafOp( v ) {
+		return fcn( v[ ia ], fb( v ) );
+	}
+
+	/**
+	* Applies a callback to a scalar value and an input element value.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function constantLeaf( v ) {
+		return fcn( ca, v[ ib ] );
+	}
+
+	/**
+	* Applies a callback to a scalar value and the result of evaluating an operand.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function constantOp( v ) {
+		return fcn( ca, fb( v ) );
+	}
+
+	/**
+	* Applies a callback to the result of evaluating an operand and an input element value.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function opLeaf( v ) {
+		return fcn( fa( v ), v[ ib ] );
+	}
+
+	/**
+	* Applies a callback to the result of evaluating an operand and a scalar value.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function opConstant( v ) {
+		return fcn( fa( v ), cb );
+	}
+
+	/**
+	* Applies a callback to the results of evaluating two operands.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function opOp( v ) {
+		return fcn( fa( v ), fb( v ) );
+	}
+}
+
+/**
+* Returns a function which applies a callback to the results of evaluating a list of operands.
+*
+* @private
+* @param {Function} fcn - callback
+* @param {Array<Object>} args - operands
+* @returns {Function} function
+*/
+function nary( fcn, args ) {
+	var fcns;
+	var N;
+	var i;
+
+	N = args.length;
+	fcns = [];
+	for ( i = 0; i < N; i++ ) {
+		fcns.push( args[ i ].fcn );
+	}
+	if ( N === 0 ) {
+		return nullary;
+	}
+	if ( N === 3 ) {
+		return ternary;
+	}
+	return apply;
+
+	/**
+	* Invokes a callback without arguments.
+	*
+	* @private
+	* @returns {*} result
+	*/
+	function nullary() {
+		return fcn();
+	}
+
+	/**
+	* Applies a ternary callback.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function ternary( v ) {
+		return fcn( fcns[ 0 ]( v ), fcns[ 1 ]( v ), fcns[ 2 ]( v ) );
+	}
+
+	/**
+	* Applies an n-ary callback.
+	*
+	* @private
+	* @param {Array} v - input element values
+	* @returns {*} result
+	*/
+	function apply( v ) {
+		var vals;
+		var i;
+
+		vals = [];
+		for ( i = 0; i < N; i++ ) {
+			vals.push( fcns[ i ]( v ) );
+		}
+		return fcn.apply( null, vals );
+	}
+}
+
+/**
+* Recursively compiles an expression node.
+*
+* ## Notes
+*
+* -   The function returns an operand object having the following properties:
+*
+*     -   **type**: operand type (input element, scalar, or operation).
+*     -   **index**: input ndarray index (input elements only).
+*     -   **value**: scalar value (scalars only).
+*     -   **fcn**: function which accepts an array of input element values and returns the operand value.
+*
+* @private
+* @param {*} v - operand
+* @param {Function} Expression - expression constructor
+* @param {Array<ndarray>} arrays - list of unique input ndarrays (mutated)
+* @returns {Object} operand object
+*/
+function recurse( v, Expression, arrays ) {
+	var args;
+	var fcn;
+	var idx;
+	var i;
+
+	if ( v instanceof Expression ) {
+		args = [];
+		for ( i = 0; i < v._args.length; i++ ) {
+			args.push( recurse( v._args[ i ], Expression, arrays ) );
+		}
+		if ( args.length === 1 ) {
+			fcn = unary( v._fcn, args[ 0 ] );
+		} else if ( args.length === 2 ) {
+			fcn = binary( v._fcn, args[ 0 ], args[ 1 ] );
+		} else {
+			fcn = nary( v._fcn, args );
+		}
+		return {
+			'type': OPERATION,
+			'fcn': fcn
+		};
+	}
+	if ( isndarrayLike( v ) ) {
+		// Ensure that each ndarray is only loaded once per element, regardless of how many times it appears in an expression:
+		idx = arrays.indexOf( v );
+		if ( idx < 0 ) {
+			idx = arrays.length;
+			arrays.push( v );
+		}
+		return {
+			'type': LEAF,
+			'index': idx,
+			'fcn': leaf( idx )
+		};
+	}
+	return {
+		'type': CONSTANT,
+		'value': v,
+		'fcn': constant( v )
+	};
+}
+
+
+// MAIN //
+
+/**
+* Compiles an expression graph into a single function operating on input element values.
+*
+* ## Notes
+*
+* -   The returned object has the following properties:
+*
+*     -   **arrays**: list of unique input ndarrays.
+*     -   **fcn**: compiled function which accepts an array containing an element value for each input ndarray (in the same order as `arrays`) and returns the result of evaluating the expression.
+*
+* @private
+* @param {Object} expr - expression
+* @returns {Object} compiled expression
+*/
+function compile( expr ) {
+	var arrays = [];
+	var fcn = recurse( expr, expr.constructor, arrays ).fcn;
+	return {
+		'arrays': arrays,
+		'fcn': fcn
+	};
+}
+
+
+// EXPORTS //
+
+module.exports = compile;
@@ -0,0 +1,173 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var setReadOnlyAccessor = require( '@stdlib/utils/define-nonenumerable-read-only-accessor' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var copy = require( '@stdlib/array/base/copy' );
+var join = require( '@stdlib/array/base/join' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
+var getShape = require( './../../shape' );
+var empty = require( './../../empty' );
+var format = require( '@stdlib/string/format' );
+var compile = require( './compile.js' );
+var fused = require( './fused.js' );
+var validate = require( './validate.js' );
+
+
+// MAIN //
+
+/**
+* Lazy element-wise expression constructor.
+*
+* @private
+* @constructor
+* @param {Function} fcn - callback
+* @param {Array} args - callback operands
+* @param {NonNegativeIntegerArray} shape - broadcast shape
+* @param {*} dtype - default output data type
+* @param {string} order - default output memory layout
+* @returns {Expression} expression instance
+*/
+function Expression( fcn, args, shape, dtype, order ) {
+	if ( !( this instanceof Expression ) ) {
+		return new Expression( fcn, args, shape, dtype, order );
+	}
+	this._fcn = fcn;
+	this._args = args;
+	this._shape = shape;
+	this._dtype = dtype;
+	this._order = order;
+	return this;
+}
+
+/**
+* Expression shape (i.e., the shape of an output ndarray).
+*
+* @name shape
+* @memberof Expression.prototype
+* @readonly
+* @type {NonNegativeIntegerArray}
+*/
+setReadOnlyAccessor( Expression.prototype, 'shape', function get() {
+	return copy( this._shape );
+});
+
+/**
+* Default output ndarray data type.
+*
+* @name dtype
+* @memberof Expression.prototype
+* @readonly
+* @type {*}
+*/
+setReadOnlyAccessor( Expression.prototype, 'dtype', function get() {
+	return this._dtype;
+});
+
+/**
+* Default output ndarray memory layout.
+*
+* @name order
+* @memberof Expression.prototype
+* @readonly
+* @type {string}
+*/
+setReadOnlyAccessor( Expression.prototype, 'order', function get() {
+	return this._order;
+});
+
+/**
+* Evaluates an expression and assigns results to a provided output ndarray.
+*
+* ## Notes
+*
+* -   All recorded operations are fused into a single loop over the output ndarray. Intermediate results are never materialized.
+* -   The output ndarray may be the same ndarray as an input ndarray (i.e., in-place evaluation). The output ndarray should not otherwise overlap input ndarray memory, as such overlap may result in undefined behavior.
+*
+* @name assign
+* @memberof Expression.prototype
+* @type {Function}
+* @param {ndarrayLike} out - output ndarray
+* @throws {TypeError} must provide an ndarray
+* @throws {Error} cannot write to a read-only ndarray
+* @throws {Error} output ndarray must have the same shape as the expression
+* @returns {ndarrayLike} output ndarray
+*/
+setReadOnly( Expression.prototype, 'assign', function assign( out ) {
+	var sh;
+	var c;
+	var i;
+	if ( !isndarrayLike( out ) ) {
+		throw new TypeError( format( 'invalid argument. Must provide an ndarray. Value: `%s`.', out ) );
+	}
+	if ( isReadOnly( out ) ) {
+		throw new Error( 'invalid argument. Cannot write to a read-only array.' );
+	}
+	sh = getShape( out );
+	if ( sh.length !== this._shape.length ) {
+		throw new Error( format( 'invalid argument. Output ndarray must have the same shape as the expression. Expression shape: [%s]. Output shape: [%s].', join( this._shape, ',' ), join( sh, ',' ) ) );
+	}
+	for ( i = 0; i < sh.length; i++ ) {
+		if ( sh[ i ] !== this._shape[ i ] ) {
+			throw new Error( format( 'invalid argument. Output ndarray must have the same shape as the expression. Expression shape: [%s]. Output shape: [%s].', join( this._shape, ',' ), join( sh, ',' ) ) );
+		}
+	}
+	c = compile( this );
+	fused( c.arrays, out, c.fcn );
+	return out;
+});
+
+/**
+* Evaluates an expression and returns results as a new ndarray.
+*
+* @name evaluate
+* @memberof Expression.prototype
+* @type {Function}
+* @param {Options} [options] - function options
+* @param {*} [options.dtype] - output ndarray data type
+* @param {string} [options.order] - output ndarray memory layout
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @returns {ndarray} output ndarray
+*/
+setReadOnly( Expression.prototype, 'evaluate', function evaluate( options ) {
+	var opts;
+	var err;
+
+	opts = {
+		'dtype': this._dtype,
+		'order': this._order
+	};
+	if ( arguments.length > 0 ) {
+		err = validate( opts, options );
+		if ( err ) {
+			throw err;
+		}
+	}
+	return this.assign( empty( this._shape, opts ) );
+});
+
+
+// EXPORTS //
+
+module.exports = Expression;
@@ -0,0 +1,495 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var zeros = require( '@stdlib/array/base/zeros' );
+var maybeBroadcastArray = require( './../../base/maybe-broadcast-array' );
+var ndarraylike2object = require( './../../base/ndarraylike2object' );
+var coalesce = require( './../../base/coalesce-dimensions' );
+var loopOrder = require( './../../base/loop-interchange-order' );
+var blockSize = require( './../../base/tiling-block-size' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+var iterationOrder = require( './../../base/iteration-order' );
+var sharedStrides2order = require( './../../base/shared-strides2order' );
+var numel = require( './../../base/numel' );
+var getShape = require( './../../shape' );
+
+
+// VARIABLES //
+
+// Innermost loop functions for indexed data buffers, where the function at index `i` supports `i+1` input ndarrays:
+var LOOPS = [
+	loop1,
+	loop2,
+	loop3
+];
+
+
+// FUNCTIONS //
+
+/**
+* Returns a boolean indicating whether a list of ndarrays can be iterated using simple nested loops (i.e., without resorting to blocked iteration).
+*
+* ## Notes
+*
+* -   Nested loops are cache-friendly when every ndarray is iterated in a single direction and all ndarrays share a memory layout. Broadcasted (i.e., zero-stride) dimensions do not move an ndarray's index pointer and are thus ignored when resolving memory layout.
+*
+* @private
+* @param {Array<IntegerArray>} strides - list of stride arrays
+* @returns {boolean} boolean result
+*/
+function isNestable( strides ) {
+	var i;
+	for ( i = 0; i < strides.length; i++ ) {
+		if ( iterationOrder( strides[ i ] ) === 0 ) {
+			return false;
+		}
+	}
+	return ( sharedStrides2order( strides ) !== 0 );
+}
+
+/**
+* Evaluates a fused expression for a contiguous run of elements along the innermost loop dimension (one input ndarray; indexed data buffers).
+*
+* ## Notes
+*
+* -   Index pointers are advanced in-place.
+*
+* @private
+* @param {Array<Collection>} bufs - data buffers
+* @param {IntegerArray} ix - index pointers
+* @param {IntegerArray} d0 - index increments
+* @param {NonNegativeInteger} N - number of elements
+* @param {Array} vals - workspace for input element values
+* @param {Function} fcn - fused expression
+* @returns {void}
+*/
+function loop1( bufs, ix, d0, N, vals, fcn ) {
+	var xbuf;
+	var ybuf;
+	var dx;
+	var dy;
+	var ix0;
+	var iy;
+	var i;
+
+	xbuf = bufs[ 0 ];
+	ybuf = bufs[ 1 ];
+	dx = d0[ 0 ];
+	dy = d0[ 1 ];
+	ix0 = ix[ 0 ];
+	iy = ix[ 1 ];
+	for ( i = 0; i < N; i++ ) {
+		vals[ 0 ] = xbuf[ ix0 ];
+		ybuf[ iy ] = fcn( vals );
+		ix0 += dx;
+		iy += dy;
+	}
+	ix[ 0 ] = ix0;
+	ix[ 1 ] = iy;
+}
+
+/**
+* Evaluates a fused expression for a contiguous run of elements along the innermost loop dimension (two input ndarrays; indexed data buffers).
+*
+* ## Notes
+*
+* -   Index pointers are advanced in-place.
+*
+* @private
+* @param {Array<Collection>} bufs - data buffers
+* @param {IntegerArray} ix - index pointers
+* @param {IntegerArray} d0 - index increments
+* @param {NonNegativeInteger} N - number of elements
+* @param {Array} vals - workspace for input element values
+* @param {Function} fcn - fused expression
+* @returns {void}
+*/
+function loop2( bufs, ix, d0, N, vals, fcn ) {
+	var xbuf;
+	var ybuf;
+	var zbuf;
+	var dx;
+	var dy;
+	var dz;
+	var ix0;
+	var iy;
+	var iz;
+	var i;
+
+	xbuf = bufs[ 0 ];
+	ybuf = bufs[ 1 ];
+	zbuf = bufs[ 2 ];
+	dx = d0[ 0 ];
+	dy = d0[ 1 ];
+	dz = d0[ 2 ];
+	ix0 = ix[ 0 ];
+	iy = ix[ 1 ];
+	iz = ix[ 2 ];
+	for ( i = 0; i < N; i++ ) {
+		vals[ 0 ] = xbuf[ ix0 ];
+		vals[ 1 ] = ybuf[ iy ];
+		zbuf[ iz ] = fcn( vals );
+		ix0 += dx;
+		iy += dy;
+		iz += dz;
+	}
+	ix[ 0 ] = ix0;
+	ix[ 1 ] = iy;
+	ix[ 2 ] = iz;
+}
+
+/**
+* Evaluates a fused expression for a contiguous run of elements along the innermost loop dimension (three input ndarrays; indexed data buffers).
+*
+* ## Notes
+*
+* -   Index pointers are advanced in-place.
+*
+* @private
+* @param {Array<Collection>} bufs - data buffers
+* @param {IntegerArray} ix - index pointers
+* @param {IntegerArray} d0 - index increments
+* @param {NonNegativeInteger} N - number of elements
+* @param {Array} vals - workspace for input element values
+* @param {Function} fcn - fused expression
+* @returns {void}
+*/
+function loop3( bufs, ix, d0, N, vals, fcn ) {
+	var xbuf;
+	var ybuf;
+	var zbuf;
+	var wbuf;
+	var dx;
+	var dy;
+	var dz;
+	var dw;
+	var ix0;
+	var iy;
+	var iz;
+	var iw;
+	var i;
+
+	xbuf = bufs[ 0 ];
+	ybuf = bufs[ 1 ];
+	zbuf = bufs[ 2 ];
+	wbuf = bufs[ 3 ];
+	dx = d0[ 0 ];
+	dy = d0[ 1 ];
+	dz = d0[ 2 ];
+	dw = d0[ 3 ];
+	ix0 = ix[ 0 ];
+	iy = ix[ 1 ];
+	iz = ix[ 2 ];
+	iw = ix[ 3 ];
+	for ( i = 0; i < N; i++ ) {
+		vals[ 0 ] = xbuf[ ix0 ];
+		vals[ 1 ] = ybuf[ iy ];
+		vals[ 2 ] = zbuf[ iz ];
+		wbuf[ iw ] = fcn( vals );
+		ix0 += dx;
+		iy += dy;
+		iz += dz;
+		iw += dw;
+	}
+	ix[ 0 ] = ix0;
+	ix[ 1 ] = iy;
+	ix[ 2 ] = iz;
+	ix[ 3 ] = iw;
+}
+
+/**
+* Evaluates a fused expression for a contiguous run of elements along the innermost loop dimension (any number of input ndarrays; indexed data buffers).
+*
+* ## Notes
+*
+* -   Index pointers are advanced in-place.
+*
+* @private
+* @param {Array<Collection>} bufs - data buffers
+* @param {IntegerArray} ix - index pointers
+* @param {IntegerArray} d0 - index increments
+* @param {NonNegativeInteger} N - number of elements
+* @param {Array} vals - workspace for input element values
+* @param {Function} fcn - fused expression
+* @returns {void}
+*/
+function loopN( bufs, ix, d0, N, vals, fcn ) {
+	var obuf;
+	var K;
+	var i;
+	var k;
+
+	K = bufs.length - 1;
+	obuf = bufs[ K ];
+	for ( i = 0; i < N; i++ ) {
+		for ( k = 0; k < K; k++ ) {
+			vals[ k ] = bufs[ k ][ ix[ k ] ];
+			ix[ k ] += d0[ k ];
+		}
+		obuf[ ix[ K ] ] = fcn( vals );
+		ix[ K ] += d0[ K ];
+	}
+}
+
+/**
+* Returns a function for evaluating a fused expression for a contiguous run of elements along the innermost loop dimension using data buffer accessors.
+*
+* @private
+* @param {Array<Function>} get - input data buffer accessors
+* @param {Function} set - output data buffer accessor
+* @returns {Function} function
+*/
+function accessorLoop( get, set ) {
+	return loop;
+
+	/**
+	* Evaluates a fused expression for a contiguous run of elements along the innermost loop dimension.
+	*
+	* @private
+	* @param {Array<Collection>} bufs - data buffers
+	* @param {IntegerArray} ix - index pointers
+	* @param {IntegerArray} d0 - index increments
+	* @param {NonNegativeInteger} N - number of elements
+	* @param {Array} vals - workspace for input element values
+	* @param {Function} fcn - fused expression
+	* @returns {void}
+	*/
+	function loop( bufs, ix, d0, N, vals, fcn ) {
+		var obuf;
+		var K;
+		var i;
+		var k;
+
+		K = bufs.length - 1;
+		obuf = bufs[ K ];
+		for ( i = 0; i < N; i++ ) {
+			for ( k = 0; k < K; k++ ) {
+				vals[ k ] = get[ k ]( bufs[ k ], ix[ k ] );
+				ix[ k ] += d0[ k ];
+			}
+			set( obuf, ix[ K ], fcn( vals ) );
+			ix[ K ] += d0[ K ];
+		}
+	}
+}
+
+/**
+* Iterates over (possibly tiled) ndarray elements, evaluating a fused expression for each element.
+*
+* ## Notes
+*
+* -   Dimensions are assumed to be ordered from innermost (fastest varying) to outermost (slowest varying).
+* -   The last buffer is the output buffer.
+* -   Within a tile, index pointers are updated incrementally (i.e., without resolving each element from a linear index).
+*
+* @private
+* @param {NonNegativeIntegerArray} sh - loop dimensions
+* @param {Array<IntegerArray>} st - stride arrays
+* @param {NonNegativeIntegerArray} offsets - index offsets
+* @param {Array<Collection>} bufs - data buffers
+* @param {Function} loop - function for evaluating a fused expression along the innermost loop dimension
+* @param {NonNegativeInteger} bsize - block size (zero disables tiling)
+* @param {Function} fcn - fused expression
+* @returns {void}
+*/
+function iterate( sh, st, offsets, bufs, loop, bsize, fcn ) { // eslint-disable-line max-params
+	var ndims;
+	var vals;
+	var jb;
+	var ts;
+	var t0;
+	var d0;
+	var io;
+	var ix;
+	var M;
+	var K;
+	var d;
+	var k;
+
+	ndims = sh.length;
+	M = bufs.length;
+	K = M - 1; // number of input ndarrays
+
+	vals = zeros( K );
+	jb = zeros( ndims ); // starting indices of the current block
+	ts = zeros( ndims ); // current tile dimensions
+	io = zeros( ndims ); // loop indices within the current tile
+	ix = zeros( M );     // index pointers
+
+	// Cache offset increments for the innermost loop...
+	d0 = [];
+	for ( k = 0; k < M; k++ ) {
+		d0.push( st[ k ][ 0 ] );
+	}
+	// Iterate over blocks...
+	while ( true ) {
+		// Resolve the tile dimensions and the index of the first element in the current tile for each ndarray:
+		for ( d = 0; d < ndims; d++ ) {
+			ts[ d ] = sh[ d ] - jb[ d ];
+			if ( bsize > 0 && ts[ d ] > bsize ) {
+				ts[ d ] = bsize;
+			}
+		}
+		for ( k = 0; k < M; k++ ) {
+			ix[ k ] = offsets[ k ];
+			for ( d = 0; d < ndims; d++ ) {
+				ix[ k ] += jb[ d ] * st[ k ][ d ];
+			}
+		}
+		t0 = ts[ 0 ];
+
+		// Iterate over the elements in the current tile...
+		while ( true ) {
+			loop( bufs, ix, d0, t0, vals, fcn );
+
+			// Rewind the innermost loop and advance the outer loop indices...
+			for ( k = 0; k < M; k++ ) {
+				ix[ k ] -= t0 * d0[ k ];
+			}
+			for ( d = 1; d < ndims; d++ ) {
+				io[ d ] += 1;
+				for ( k = 0; k < M; k++ ) {
+					ix[ k ] += st[ k ][ d ];
+				}
+				if ( io[ d ] < ts[ d ] ) {
+					break;
+				}
+				for ( k = 0; k < M; k++ ) {
+					ix[ k ] -= ts[ d ] * st[ k ][ d ];
+				}
+				io[ d ] = 0;
+			}
+			if ( d >= ndims ) {
+				break;
+			}
+		}
+		// Advance to the next block...
+		for ( d = 0; d < ndims; d++ ) {
+			jb[ d ] += ts[ d ];
+			if ( jb[ d ] < sh[ d ] ) {
+				break;
+			}
+			jb[ d ] = 0;
+		}
+		if ( d >= ndims ) {
+			break;
+		}
+	}
+}
+
+
+// MAIN //
+
+/**
+* Evaluates a fused element-wise expression over a list of input ndarrays and assigns results to an output ndarray.
+*
+* ## Notes
+*
+* -   Input ndarrays are broadcast to the shape of the output ndarray.
+* -   Adjacent dimensions which are jointly contiguous for all ndarrays are coalesced, and the loop order is resolved using the same cost model as the element-wise engines (see `@stdlib/ndarray/base/loop-interchange-order`).
+* -   When ndarrays do not share a memory layout, the function performs blocked (tiled) iteration using the same block size as the element-wise engines (see `@stdlib/ndarray/base/tiling-block-size`).
+* -   The expression is evaluated in a single pass over memory without allocating intermediate arrays.
+*
+* @private
+* @param {ArrayLikeObject<ndarray>} arrays - input ndarrays
+* @param {ndarray} out - output ndarray
+* @param {Function} fcn - fused expression which accepts an array of input element values and returns an output element value
+* @returns {void}
+*/
+function fused( arrays, out, fcn ) {
+	var offsets;
+	var strides;
+	var nbytes;
+	var dtypes;
+	var bsize;
+	var ndims;
+	var loop;
+	var bufs;
+	var acc;
+	var get;
+	var obj;
+	var sh;
+	var o;
+	var i;
+
+	sh = getShape( out, true );
+	ndims = sh.length;
+	if ( ndims > 0 && numel( sh ) === 0 ) {
+		return;
+	}
+	offsets = [];
+	strides = [];
+	dtypes = [];
+	nbytes = [];
+	bufs = [];
+	get = [];
+	acc = false;
+	for ( i = 0; i <= arrays.length; i++ ) {
+		if ( i < arrays.length ) {
+			obj = ndarraylike2object( maybeBroadcastArray( arrays[ i ], sh ) );
+			get.push( obj.accessors[ 0 ] );
+		} else {
+			obj = ndarraylike2object( out );
+		}
+		offsets.push( obj.offset );
+		strides.push( obj.strides );
+		dtypes.push( obj.dtype );
+		nbytes.push( bytesPerElement( obj.dtype ) );
+		bufs.push( obj.data );
+		acc = acc || obj.accessorProtocol;
+	}
+	// Resolve the function for iterating over the innermost loop dimension:
+	if ( acc ) {
+		loop = accessorLoop( get, obj.accessors[ 1 ] );
+	} else {
+		loop = LOOPS[ arrays.length-1 ] || loopN;
+	}
+	// Handle zero-dimensional ndarrays as one-dimensional ndarrays containing a single element:
+	if ( ndims === 0 ) {
+		sh = [ 1 ];
+		for ( i = 0; i < strides.length; i++ ) {
+			strides[ i ] = [ 0 ];
+		}
+	} else if ( ndims > 1 ) {
+		// Merge adjacent dimensions which are jointly contiguous and remove singleton dimensions:
+		o = coalesce( sh, strides );
+		sh = o[ 0 ];
+		strides = o.slice( 1 );
+	}
+	bsize = 0;
+	if ( sh.length > 1 ) {
+		// Determine whether we need to perform blocked iteration:
+		if ( !isNestable( strides ) ) {
+			bsize = blockSize( dtypes );
+		}
+		// Resolve a loop order which minimizes the estimated cost of accessing the elements of all ndarrays:
+		o = loopOrder( sh, strides, nbytes );
+		sh = o[ 0 ];
+		strides = o.slice( 1 );
+	}
+	iterate( sh, strides, offsets, bufs, loop, bsize, fcn );
+}
+
+
+// EXPORTS //
+
+module.exports = fused;
@@ -0,0 +1,59 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Create a lazily evaluated element-wise expression which fuses operations on ndarrays into a single loop.
+*
+* @module @stdlib/ndarray/lazy
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+* var lazy = require( '@stdlib/ndarray/lazy' );
+*
+* function add( a, b ) {
+*     return a + b;
+* }
+*
+* function mul( a, b ) {
+*     return a * b;
+* }
+*
+* var a = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+* var b = array( [ [ 5.0, 6.0 ], [ 7.0, 8.0 ] ] );
+* var c = array( [ 10.0, 20.0 ] );
+*
+* var expr = lazy( add, lazy( mul, a, b ), c );
+*
+* var out = expr.evaluate();
+* // returns <ndarray>
+*
+* var arr = ndarray2array( out );
+* // returns [ [ 15.0, 32.0 ], [ 31.0, 52.0 ] ]
+*/
+
+// MODULES //
+
+var main = require( './main.js' );
+
+
+// EXPORTS //
+
+module.exports = main;
@@ -0,0 +1,140 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isFunction = require( '@stdlib/assert/is-function' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var broadcastShapes = require( './../../base/broadcast-shapes' );
+var promotionRules = require( './../../promotion-rules' );
+var getShape = require( './../../shape' );
+var getDType = require( './../../dtype' );
+var getOrder = require( './../../order' );
+var format = require( '@stdlib/string/format' );
+var Expression = require( './expression.js' );
+
+
+// FUNCTIONS //
+
+/**
+* Resolves the data type to which two data types should be promoted.
+*
+* @private
+* @param {*} dt1 - first data type
+* @param {*} dt2 - second data type
+* @returns {*} promoted data type
+*/
+function promote( dt1, dt2 ) {
+	var dt = promotionRules( dt1, dt2 );
+	if ( dt === null || dt === -1 ) {
+		return 'generic';
+	}
+	return dt;
+}
+
+
+// MAIN //
+
+/**
+* Returns a lazy expression which applies a callback to elements in ndarrays, lazily evaluated expressions, and/or scalar values.
+*
+* ## Notes
+*
+* -   The function does **not** evaluate the callback. Instead, the function records an operation, which may be composed with other operations. When evaluated, all recorded operations are fused into a single loop over ndarray elements, thus avoiding the allocation of intermediate arrays and reducing memory traffic.
+* -   Operands which are neither ndarrays nor lazy expressions are treated as scalar constants.
+* -   Operands are broadcast to a common shape.
+* -   An output ndarray's default data type is resolved by applying type promotion rules to the data types of all ndarray operands.
+*
+* @param {Function} fcn - callback
+* @param {...*} args - callback operands
+* @throws {TypeError} first argument must be a function
+* @throws {TypeError} must provide at least one ndarray or expression operand
+* @throws {Error} input arrays must be broadcast compatible
+* @returns {Expression} lazy expression
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* function add( a, b ) {
+*     return a + b;
+* }
+*
+* function mul( a, b ) {
+*     return a * b;
+* }
+*
+* var a = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+* var b = array( [ [ 5.0, 6.0 ], [ 7.0, 8.0 ] ] );
+* var c = array( [ 10.0, 20.0 ] );
+*
+* // Record `a*b + c` without evaluating it:
+* var expr = lazy( add, lazy( mul, a, b ), c );
+*
+* // Evaluate the expression in a single pass:
+* var out = expr.evaluate();
+* // returns <ndarray>
+*
+* var arr = ndarray2array( out );
+* // returns [ [ 15.0, 32.0 ], [ 31.0, 52.0 ] ]
+*/
+function lazy( fcn ) {
+	var shapes;
+	var order;
+	var dtype;
+	var args;
+	var sh;
+	var v;
+	var i;
+
+	if ( !isFunction( fcn ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be a function. Value: `%s`.', fcn ) );
+	}
+	args = [];
+	shapes = [];
+	dtype = null;
+	order = null;
+	for ( i = 1; i < arguments.length; i++ ) {
+		v = arguments[ i ];
+		args.push( v );
+		if ( v instanceof Expression ) {
+			shapes.push( v.shape );
+			dtype = ( dtype === null ) ? v.dtype : promote( dtype, v.dtype );
+			order = order || v.order;
+		} else if ( isndarrayLike( v ) ) {
+			shapes.push( getShape( v ) );
+			dtype = ( dtype === null ) ? getDType( v ) : promote( dtype, getDType( v ) );
+			order = order || getOrder( v );
+		}
+	}
+	if ( shapes.length === 0 ) {
+		throw new TypeError( 'invalid arguments. Must provide at least one ndarray or expression operand.' );
+	}
+	sh = broadcastShapes( shapes );
+	if ( sh === null ) {
+		throw new Error( 'invalid arguments. Input arrays must be broadcast compatible.' );
+	}
+	return new Expression( fcn, args, sh, dtype, order );
+}
+
+
+// EXPORTS //
+
+module.exports = lazy;
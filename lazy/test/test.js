@@ -0,0 +1,334 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var Complex128 = require( '@stdlib/complex/float64/ctor' );
+var zadd = require( '@stdlib/complex/float64/base/add' );
+var real = require( '@stdlib/complex/float64/real' );
+var imag = require( '@stdlib/complex/float64/imag' );
+var ndarray = require( './../../ctor' );
+var zeros = require( './../../zeros' );
+var ndarray2array = require( './../../to-array' );
+var lazy = require( './../lib' );
+
+
+// FUNCTIONS //
+
+function add( a, b ) {
+	return a + b;
+}
+
+function mul( a, b ) {
+	return a * b;
+}
+
+function neg( a ) {
+	return -a;
+}
+
+function fma( a, b, c ) {
+	return ( a*b ) + c;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof lazy, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a first argument which is not a function', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( [ 2, 2 ] );
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			lazy( value, x, x );
+		};
+	}
+});
+
+tape( 'the function throws an error if not provided at least one ndarray or expression operand', function test( t ) {
+	t.throws( badValue, TypeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		lazy( add, 1.0, 2.0 );
+	}
+});
+
+tape( 'the function throws an error if provided operands which are not broadcast compatible', function test( t ) {
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		lazy( add, zeros( [ 2, 3 ] ), zeros( [ 2, 2 ] ) );
+	}
+});
+
+tape( 'the function returns a lazy expression having a broadcast shape, a promoted data type, and an order', function test( t ) {
+	var expr;
+	var x;
+	var y;
+
+	x = zeros( [ 2, 1 ], {
+		'dtype': 'float32'
+	});
+	y = zeros( [ 3 ], {
+		'dtype': 'float64',
+		'order': 'column-major'
+	});
+	expr = lazy( add, x, y );
+
+	t.deepEqual( expr.shape, [ 2, 3 ], 'returns expected value' );
+	t.strictEqual( expr.dtype, 'float64', 'returns expected value' );
+	t.strictEqual( expr.order, 'row-major', 'returns expected value' );
+	t.strictEqual( typeof expr.evaluate, 'function', 'has method' );
+	t.strictEqual( typeof expr.assign, 'function', 'has method' );
+	t.end();
+});
+
+tape( 'the function does not evaluate a callback until an expression is evaluated', function test( t ) {
+	var count;
+	var expr;
+	var x;
+
+	count = 0;
+	x = zeros( [ 2, 2 ] );
+	expr = lazy( cb, x );
+	t.strictEqual( count, 0, 'returns expected value' );
+
+	expr.evaluate();
+	t.strictEqual( count, 4, 'returns expected value' );
+	t.end();
+
+	function cb( v ) {
+		count += 1;
+		return v;
+	}
+});
+
+tape( 'the function supports composing expressions which are evaluated in a single pass', function test( t ) {
+	var expected;
+	var actual;
+	var expr;
+	var a;
+	var b;
+	var c;
+
+	a = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	b = new ndarray( 'float64', new Float64Array( [ 5.0, 6.0, 7.0, 8.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	c = new ndarray( 'float64', new Float64Array( [ 10.0, 20.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	expr = lazy( add, lazy( mul, a, b ), c );
+	actual = expr.evaluate();
+
+	expected = [ [ 15.0, 32.0 ], [ 31.0, 52.0 ] ];
+	t.strictEqual( actual.dtype, 'float64', 'returns expected value' );
+	t.deepEqual( actual.shape, [ 2, 2 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	// Repeated evaluation should return the same results:
+	actual = expr.evaluate();
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports scalar operands', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	actual = lazy( add, lazy( mul, 2.0, x ), 1.0 ).evaluate();
+	expected = [ [ 3.0, 5.0 ], [ 7.0, 9.0 ] ];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = lazy( fma, x, 3.0, lazy( neg, x ) ).evaluate();
+	expected = [ [ 2.0, 4.0 ], [ 6.0, 8.0 ] ];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports operands having different memory layouts', function test( t ) {
+	var expected;
+	var actual;
+	var buf;
+	var x;
+	var y;
+	var z;
+	var i;
+	var j;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', buf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = new ndarray( 'float64', buf, [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+	z = new ndarray( 'float64', buf, [ 2, 3 ], [ -3, -1 ], 5, 'row-major' );
+
+	actual = lazy( fma, x, y, z ).evaluate({
+		'order': 'column-major'
+	});
+	t.strictEqual( actual.order, 'column-major', 'returns expected value' );
+
+	x = ndarray2array( x );
+	y = ndarray2array( y );
+	z = ndarray2array( z );
+	expected = [];
+	for ( i = 0; i < 2; i++ ) {
+		expected.push( [] );
+		for ( j = 0; j < 3; j++ ) {
+			expected[ i ].push( ( x[i][j]*y[i][j] ) + z[i][j] );
+		}
+	}
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports zero-dimensional ndarrays', function test( t ) {
+	var actual;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 3.0 ] ), [], [ 0 ], 0, 'row-major' );
+	actual = lazy( mul, x, x ).evaluate();
+
+	t.deepEqual( actual.shape, [], 'returns expected value' );
+	t.strictEqual( actual.get(), 9.0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports ndarrays having accessor data buffers', function test( t ) {
+	var actual;
+	var v;
+	var x;
+
+	x = new ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	actual = lazy( zadd, x, new Complex128( 1.0, 1.0 ) ).evaluate();
+
+	t.strictEqual( actual.dtype, 'complex128', 'returns expected value' );
+
+	v = actual.get( 0 );
+	t.strictEqual( real( v ), 2.0, 'returns expected value' );
+	t.strictEqual( imag( v ), 3.0, 'returns expected value' );
+
+	v = actual.get( 1 );
+	t.strictEqual( real( v ), 4.0, 'returns expected value' );
+	t.strictEqual( imag( v ), 5.0, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `evaluate` method throws an error if provided an invalid option', function test( t ) {
+	var expr;
+
+	expr = lazy( neg, zeros( [ 2 ] ) );
+
+	t.throws( badValue( 'beep' ), TypeError, 'throws an error' );
+	t.throws( badValue( { 'dtype': 'beep' } ), TypeError, 'throws an error' );
+	t.throws( badValue( { 'order': 'beep' } ), TypeError, 'throws an error' );
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			expr.evaluate( value );
+		};
+	}
+});
+
+tape( 'the `assign` method evaluates an expression and assigns results to a provided output ndarray', function test( t ) {
+	var actual;
+	var out;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	out = zeros( [ 2, 2 ], {
+		'dtype': 'float32'
+	});
+	actual = lazy( mul, x, x ).assign( out );
+
+	t.strictEqual( actual, out, 'returns expected value' );
+	t.deepEqual( ndarray2array( out ), [ [ 1.0, 4.0 ], [ 9.0, 16.0 ] ], 'returns expected value' );
+
+	// Evaluate in-place:
+	lazy( add, x, x ).assign( x );
+	t.deepEqual( ndarray2array( x ), [ [ 2.0, 4.0 ], [ 6.0, 8.0 ] ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the `assign` method throws an error if provided an output ndarray having a different shape', function test( t ) {
+	var expr = lazy( neg, zeros( [ 2, 2 ] ) );
+
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		expr.assign( zeros( [ 2, 3 ] ) );
+	}
+});
+
+tape( 'the `assign` method throws an error if not provided an ndarray-like object', function test( t ) {
+	var values;
+	var expr;
+	var i;
+
+	expr = lazy( neg, zeros( [ 2, 2 ] ) );
+	values = [
+		'5',
+		5,
+		null,
+		void 0,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			expr.assign( value );
+		};
+	}
+});
@@ -54,6 +54,15 @@ setReadOnly( ns, 'any', require( './../any' ) );
 */
 setReadOnly( ns, 'anyBy', require( './../any-by' ) );
 
+/**
+* @name argsort
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/argsort}
+*/
+setReadOnly( ns, 'argsort', require( './../argsort' ) );
+
 /**
 * @name array
 * @memberof ns
@@ -477,6 +486,33 @@ setReadOnly( ns, 'flipud', require( './../flipud' ) );
 */
 setReadOnly( ns, 'forEach', require( './../for-each' ) );
 
+/**
+* @name arraybuffer2ndarray
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/from-arraybuffer}
+*/
+setReadOnly( ns, 'arraybuffer2ndarray', require( './../from-arraybuffer' ) );
+
+/**
+* @name fromFile
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/from-file}
+*/
+setReadOnly( ns, 'fromFile', require( './../from-file' ) );
+
+/**
+* @name npy2ndarray
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/from-npy}
+*/
+setReadOnly( ns, 'npy2ndarray', require( './../from-npy' ) );
+
 /**
 * @name scalar2ndarray
 * @memberof ns
@@ -567,6 +603,15 @@ setReadOnly( ns, 'iter', require( './../iter' ) );
 */
 setReadOnly( ns, 'last', require( './../last' ) );
 
+/**
+* @name lazy
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/lazy}
+*/
+setReadOnly( ns, 'lazy', require( './../lazy' ) );
+
 /**
 * @name map
 * @memberof ns
@@ -792,6 +837,15 @@ setReadOnly( ns, 'reject', require( './../reject' ) );
 */
 setReadOnly( ns, 'removeSingletonDimensions', require( './../remove-singleton-dimensions' ) );
 
+/**
+* @name reshape
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/reshape}
+*/
+setReadOnly( ns, 'reshape', require( './../reshape' ) );
+
 /**
 * @name reverse
 * @memberof ns
@@ -981,6 +1035,15 @@ setReadOnly( ns, 'some', require( './../some' ) );
 */
 setReadOnly( ns, 'someBy', require( './../some-by' ) );
 
+/**
+* @name sort
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/sort}
+*/
+setReadOnly( ns, 'sort', require( './../sort' ) );
+
 /**
 * @name spreadDimensions
 * @memberof ns
@@ -1062,6 +1125,15 @@ setReadOnly( ns, 'toFlippedud', require( './../to-flippedud' ) );
 */
 setReadOnly( ns, 'ndarray2json', require( './../to-json' ) );
 
+/**
+* @name ndarray2npy
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/to-npy}
+*/
+setReadOnly( ns, 'ndarray2npy', require( './../to-npy' ) );
+
 /**
 * @name ndarray2localeString
 * @memberof ns
@@ -1161,6 +1233,15 @@ setReadOnly( ns, 'toTransposed', require( './../to-transposed' ) );
 */
 setReadOnly( ns, 'toUnflattened', require( './../to-unflattened' ) );
 
+/**
+* @name topk
+* @memberof ns
+* @readonly
+* @type {Function}
+* @see {@link module:@stdlib/ndarray/top-k}
+*/
+setReadOnly( ns, 'topk', require( './../top-k' ) );
+
 /**
 * @name transpose
 * @memberof ns
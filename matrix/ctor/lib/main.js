@@ -48,7 +48,7 @@ var defaults = require( './../../../defaults' );
 var array2buffer = require( '@stdlib/buffer/from-array' );
 var ITERATOR_SYMBOL = require( '@stdlib/symbol/iterator' );
 var format = require( '@stdlib/string/format' );
-var arraybuffer2matrix = require( './from_arraybuffer.js' );
+var arraybuffer2matrix = require( './../../../from-arraybuffer' );
 
 
 // VARIABLES //
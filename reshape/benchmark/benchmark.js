@@ -0,0 +1,114 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var pow = require( '@stdlib/math/base/special/pow' );
+var zeros = require( './../../base/zeros' );
+var transpose = require( './../../base/transpose' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var reshape = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {ndarray} x - input ndarray
+* @param {NonNegativeIntegerArray} shape - output ndarray shape
+* @param {Options} opts - function options
+* @returns {Function} benchmark function
+*/
+function createBenchmark( x, shape, opts ) {
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var y;
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			y = reshape( x, shape, opts );
+			if ( typeof y !== 'object' ) {
+				b.fail( 'should return an ndarray' );
+			}
+		}
+		b.toc();
+		if ( !isndarrayLike( y ) ) {
+			b.fail( 'should return an ndarray' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+/**
+* Main execution sequence.
+*
+* @private
+*/
+function main() {
+	var len;
+	var min;
+	var max;
+	var x;
+	var f;
+	var i;
+
+	min = 1; // 10^min
+	max = 3; // 10^max
+
+	for ( i = min; i <= max; i++ ) {
+		len = pow( 10, i );
+		x = zeros( 'float64', [ len, len ], 'row-major' );
+
+		f = createBenchmark( x, [ len*len ], {
+			'copy': 'if-needed'
+		});
+		bench( format( '%s::contiguous:len=%d,copy=if-needed', pkg, len*len ), f );
+
+		f = createBenchmark( x, [ len*len ], {
+			'copy': 'always'
+		});
+		bench( format( '%s::contiguous:len=%d,copy=always', pkg, len*len ), f );
+
+		f = createBenchmark( transpose( x, false ), [ len*len ], {
+			'copy': 'if-needed'
+		});
+		bench( format( '%s::transposed:len=%d,copy=if-needed', pkg, len*len ), f );
+	}
+}
+
+main();
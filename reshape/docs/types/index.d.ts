@@ -0,0 +1,99 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, Order } from '@stdlib/types/ndarray';
+
+/**
+* Copy mode.
+*/
+type CopyMode = 'if-needed' | 'never' | 'always';
+
+/**
+* Function options.
+*/
+interface Options {
+	/**
+	* Index order in which input ndarray elements should be read and placed in the output ndarray.
+	*
+	* ## Notes
+	*
+	* -   The following orders are supported:
+	*
+	*     -   **row-major**: lexicographic order.
+	*     -   **column-major**: colexicographic order.
+	*     -   **same**: the stated order of the input ndarray.
+	*     -   **any**: the physical layout of the input ndarray data in memory, regardless of the stated order of the input ndarray.
+	*
+	* -   Default: 'row-major'.
+	*/
+	order?: Order | 'same' | 'any';
+
+	/**
+	* Specifies whether to copy input ndarray elements.
+	*
+	* ## Notes
+	*
+	* -   The following modes are supported:
+	*
+	*     -   **if-needed**: return a view when possible; otherwise, return a copy.
+	*     -   **never**: return a view when possible; otherwise, throw an error.
+	*     -   **always**: always return a copy.
+	*
+	* -   Default: 'if-needed'.
+	*/
+	copy?: CopyMode;
+}
+
+/**
+* Reshapes an input ndarray, returning a view whenever possible.
+*
+* ## Notes
+*
+* -   When the input ndarray's strides are compatible with the desired shape, the function returns a **read-only** view sharing the same underlying data buffer as the input ndarray and does not access any ndarray elements. Otherwise, the function copies elements to a newly allocated ndarray having contiguous memory.
+*
+* @param x - input ndarray
+* @param shape - output ndarray shape
+* @param options - function options
+* @param options.order - index order in which input ndarray elements should be read and placed in the output ndarray
+* @param options.copy - specifies whether to copy input ndarray elements
+* @returns output ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var x = array( [ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ] );
+* // returns <ndarray>
+*
+* var y = reshape( x, [ 3, 2 ] );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ [ 1.0, 2.0 ], [ 3.0, 4.0 ], [ 5.0, 6.0 ] ]
+*/
+declare function reshape<T extends ndarray = ndarray>( x: T, shape: Array<number>, options?: Options ): T;
+
+
+// EXPORTS //
+
+export = reshape;
@@ -0,0 +1,99 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+import zeros = require( './../../../zeros' );
+import reshape = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const x = zeros( [ 2, 3 ] );
+
+	reshape( x, [ 3, 2 ] ); // $ExpectType float64ndarray
+	reshape( x, [ 6 ], { 'order': 'column-major' } ); // $ExpectType float64ndarray
+	reshape( x, [ 6 ], { 'copy': 'never' } ); // $ExpectType float64ndarray
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an ndarray...
+{
+	reshape( '5', [ 2, 2 ] ); // $ExpectError
+	reshape( 5, [ 2, 2 ] ); // $ExpectError
+	reshape( true, [ 2, 2 ] ); // $ExpectError
+	reshape( false, [ 2, 2 ] ); // $ExpectError
+	reshape( null, [ 2, 2 ] ); // $ExpectError
+	reshape( undefined, [ 2, 2 ] ); // $ExpectError
+	reshape( {}, [ 2, 2 ] ); // $ExpectError
+	reshape( ( x: number ): number => x, [ 2, 2 ] ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not an array of numbers...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reshape( x, '5' ); // $ExpectError
+	reshape( x, 5 ); // $ExpectError
+	reshape( x, true ); // $ExpectError
+	reshape( x, false ); // $ExpectError
+	reshape( x, null ); // $ExpectError
+	reshape( x, {} ); // $ExpectError
+	reshape( x, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reshape( x, [ 4 ], '5' ); // $ExpectError
+	reshape( x, [ 4 ], 5 ); // $ExpectError
+	reshape( x, [ 4 ], true ); // $ExpectError
+	reshape( x, [ 4 ], false ); // $ExpectError
+	reshape( x, [ 4 ], null ); // $ExpectError
+	reshape( x, [ 4 ], ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an invalid `order` option...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reshape( x, [ 4 ], { 'order': '5' } ); // $ExpectError
+	reshape( x, [ 4 ], { 'order': 5 } ); // $ExpectError
+	reshape( x, [ 4 ], { 'order': true } ); // $ExpectError
+	reshape( x, [ 4 ], { 'order': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an invalid `copy` option...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reshape( x, [ 4 ], { 'copy': '5' } ); // $ExpectError
+	reshape( x, [ 4 ], { 'copy': 5 } ); // $ExpectError
+	reshape( x, [ 4 ], { 'copy': true } ); // $ExpectError
+	reshape( x, [ 4 ], { 'copy': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = zeros( [ 2, 2 ] );
+
+	reshape(); // $ExpectError
+	reshape( x ); // $ExpectError
+	reshape( x, [ 4 ], {}, {} ); // $ExpectError
+}
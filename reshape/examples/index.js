@@ -0,0 +1,51 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+var array = require( './../../array' );
+var transpose = require( './../../transpose' );
+var getData = require( './../../data-buffer' );
+var ndarray2array = require( './../../to-array' );
+var reshape = require( './../lib' );
+
+// Create a contiguous row-major ndarray:
+var x = array( zeroTo( 12 ), {
+	'shape': [ 3, 4 ]
+});
+console.log( ndarray2array( x ) );
+
+// Reshape without copying data:
+var y = reshape( x, [ 2, 3, 2 ] );
+console.log( ndarray2array( y ) );
+console.log( 'shares memory: %s', getData( y ) === getData( x ) );
+
+// Reshaping a transposed view in lexicographic order requires a copy:
+var t = transpose( x );
+y = reshape( t, [ 12 ] );
+console.log( ndarray2array( y ) );
+console.log( 'shares memory: %s', getData( y ) === getData( x ) );
+
+// Read elements according to the physical memory layout, thus avoiding a copy:
+y = reshape( t, [ 12 ], {
+	'order': 'any'
+});
+console.log( ndarray2array( y ) );
+console.log( 'shares memory: %s', getData( y ) === getData( x ) );
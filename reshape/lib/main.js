@@ -0,0 +1,224 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var isPlainObject = require( '@stdlib/assert/is-plain-object' );
+var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var isNonNegativeIntegerArray = require( '@stdlib/assert/is-nonnegative-integer-array' ).primitives;
+var isEmptyCollection = require( '@stdlib/assert/is-empty-collection' );
+var isOrder = require( './../../base/assert/is-order' );
+var contains = require( '@stdlib/array/base/assert/contains' ).factory;
+var join = require( '@stdlib/array/base/join' );
+var getShape = require( './../../shape' );
+var getOrder = require( './../../order' );
+var getStrides = require( './../../strides' );
+var getOffset = require( './../../offset' );
+var getData = require( './../../base/data-buffer' );
+var getDType = require( './../../base/dtype' );
+var shape2strides = require( './../../base/shape2strides' );
+var strides2order = require( './../../base/strides2order' );
+var reshapeStrides = require( './../../base/reshape-strides' );
+var assign = require( './../../base/assign' );
+var ndarray = require( './../../base/ctor' );
+var view = require( './../../base/view' );
+var emptyLike = require( './../../empty-like' );
+var format = require( '@stdlib/string/format' );
+
+
+// VARIABLES //
+
+var ROW_MAJOR = 'row-major';
+var COL_MAJOR = 'column-major';
+var COPY_MODES = [ 'if-needed', 'never', 'always' ];
+var isCopyMode = contains( COPY_MODES );
+
+
+// FUNCTIONS //
+
+/**
+* Returns the number of elements in an ndarray having a specified shape.
+*
+* ## Notes
+*
+* -   In contrast to `@stdlib/ndarray/base/numel`, the function returns `1` for zero-dimensional ndarrays.
+*
+* @private
+* @param {NonNegativeIntegerArray} shape - array shape
+* @returns {NonNegativeInteger} number of elements
+*/
+function size( shape ) {
+	var n;
+	var i;
+
+	n = 1;
+	for ( i = 0; i < shape.length; i++ ) {
+		n *= shape[ i ];
+	}
+	return n;
+}
+
+
+// MAIN //
+
+/**
+* Reshapes an input ndarray, returning a view whenever possible.
+*
+* ## Notes
+*
+* -   When the input ndarray's strides are compatible with the desired shape, the function returns a **read-only** view sharing the same underlying data buffer as the input ndarray and does not access any ndarray elements. Otherwise, the function copies elements to a newly allocated ndarray having contiguous memory.
+*
+* @param {ndarray} x - input ndarray
+* @param {NonNegativeIntegerArray} shape - output ndarray shape
+* @param {Options} [options] - function options
+* @param {string} [options.order='row-major'] - index order in which input ndarray elements should be read and placed in the output ndarray
+* @param {string} [options.copy='if-needed'] - specifies whether to copy input ndarray elements
+* @throws {TypeError} first argument must be an ndarray-like object
+* @throws {TypeError} second argument must be an array of nonnegative integers
+* @throws {RangeError} second argument must be compatible with the number of elements in the input ndarray
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @throws {Error} unable to reshape without copying when the `copy` option is `'never'`
+* @returns {ndarray} output ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var x = array( [ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ] );
+* // returns <ndarray>
+*
+* var y = reshape( x, [ 3, 2 ] );
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ [ 1.0, 2.0 ], [ 3.0, 4.0 ], [ 5.0, 6.0 ] ]
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2array = require( '@stdlib/ndarray/to-array' );
+*
+* var x = array( [ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ] );
+* // returns <ndarray>
+*
+* var y = reshape( x, [ 3, 2 ], {
+*     'order': 'column-major'
+* });
+* // returns <ndarray>
+*
+* var arr = ndarray2array( y );
+* // returns [ [ 1.0, 5.0 ], [ 4.0, 3.0 ], [ 2.0, 6.0 ] ]
+*/
+function reshape( x, shape, options ) {
+	var opts;
+	var xsh;
+	var ord;
+	var tmp;
+	var dt;
+	var st;
+	var o;
+	var y;
+
+	if ( !isndarrayLike( x ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray. Value: `%s`.', x ) );
+	}
+	if ( !isNonNegativeIntegerArray( shape ) && !isEmptyCollection( shape ) ) {
+		throw new TypeError( format( 'invalid argument. Second argument must be an array of nonnegative integers. Value: `%s`.', shape ) );
+	}
+	xsh = getShape( x );
+	if ( size( xsh ) !== size( shape ) ) {
+		throw new RangeError( format( 'invalid argument. Second argument must be compatible with the number of elements in the input ndarray. Number of elements: %d. Value: `[%s]`.', size( xsh ), join( shape, ',' ) ) );
+	}
+	// Define default options:
+	opts = {
+		'order': ROW_MAJOR, // by default, read and place elements in lexicographic order (i.e., trailing dimensions first)
+		'copy': 'if-needed'
+	};
+
+	// Resolve function options...
+	if ( arguments.length > 2 ) {
+		if ( !isPlainObject( options ) ) {
+			throw new TypeError( format( 'invalid argument. Options argument must be an object. Value: `%s`.', options ) );
+		}
+		if ( hasOwnProp( options, 'order' ) ) {
+			if ( options.order === 'any' ) {
+				// When 'any', we want to read elements according to the physical layout of the data in memory...
+				o = strides2order( getStrides( x ) );
+				if ( o === 1 ) {
+					opts.order = ROW_MAJOR;
+				} else if ( o === 2 ) {
+					opts.order = COL_MAJOR;
+				} else {
+					// Fallback to the stated order of the input ndarray when the physical layout is ambiguous:
+					opts.order = getOrder( x );
+				}
+			} else if ( options.order === 'same' ) {
+				opts.order = getOrder( x );
+			} else if ( isOrder( options.order ) ) {
+				opts.order = options.order;
+			} else {
+				throw new TypeError( format( 'invalid option. `%s` option must be a recognized order. Option: `%s`.', 'order', options.order ) );
+			}
+		}
+		if ( hasOwnProp( options, 'copy' ) ) {
+			if ( !isCopyMode( options.copy ) ) {
+				throw new TypeError( format( 'invalid option. `%s` option must be one of the following: "%s". Option: `%s`.', 'copy', join( COPY_MODES, '", "' ), options.copy ) );
+			}
+			opts.copy = options.copy;
+		}
+	}
+	ord = opts.order;
+	dt = getDType( x );
+
+	// Attempt to reshape without copying data...
+	if ( opts.copy !== 'always' ) {
+		st = reshapeStrides( xsh, getStrides( x ), shape, ord );
+		if ( st !== null ) {
+			if ( shape.length === 0 ) {
+				st = [ 0 ];
+			}
+			return view( x, shape.slice(), st, getOffset( x ), false, ord );
+		}
+		if ( opts.copy === 'never' ) {
+			throw new Error( format( 'invalid argument. Unable to reshape the input ndarray to the specified shape without copying data. Shape: `[%s]`. Strides: `[%s]`. Value: `[%s]`.', join( xsh, ',' ), join( getStrides( x ), ',' ), join( shape, ',' ) ) );
+		}
+	}
+	// Create an output ndarray having contiguous memory:
+	y = emptyLike( x, {
+		'shape': shape.slice(),
+		'order': ord
+	});
+
+	// Create a view on top of the output ndarray having the same shape as the input ndarray:
+	st = ( xsh.length > 0 ) ? shape2strides( xsh, ord ) : [ 0 ];
+	tmp = new ndarray( dt, getData( y ), xsh, st, 0, ord );
+
+	// Copy elements to the output ndarray:
+	assign( [ x, tmp ] );
+
+	return y;
+}
+
+
+// EXPORTS //
+
+module.exports = reshape;
@@ -0,0 +1,407 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
+var getData = require( './../../data-buffer' );
+var ndarray = require( './../../ctor' );
+var zeros = require( './../../zeros' );
+var ndarray2array = require( './../../to-array' );
+var reshape = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof reshape, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a first argument which is not an ndarray', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			reshape( value, [ 2, 2 ] );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a second argument which is not an array of nonnegative integers', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( [ 2, 2 ] );
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[ -1, -4 ],
+		[ 1.5, 2 ],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			reshape( x, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a shape which is incompatible with the number of input ndarray elements', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( [ 2, 3 ] );
+	values = [
+		[],
+		[ 5 ],
+		[ 2, 2 ],
+		[ 3, 3 ],
+		[ 1, 2, 4 ]
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			reshape( x, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( [ 2, 2 ] );
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		[],
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			reshape( x, [ 4 ], value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `order` option', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( [ 2, 2 ] );
+	values = [
+		'5',
+		'beep',
+		5,
+		true,
+		null,
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			reshape( x, [ 4 ], {
+				'order': value
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `copy` option', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = zeros( [ 2, 2 ] );
+	values = [
+		'5',
+		'beep',
+		5,
+		true,
+		false,
+		null,
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			reshape( x, [ 4 ], {
+				'copy': value
+			});
+		};
+	}
+});
+
+tape( 'the function returns a read-only view when the input ndarray strides are compatible with the output shape (row-major)', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	y = reshape( x, [ 3, 2 ] );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.deepEqual( y.shape, [ 3, 2 ], 'returns expected value' );
+	t.deepEqual( y.strides, [ 2, 1 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 1.0, 2.0 ], [ 3.0, 4.0 ], [ 5.0, 6.0 ] ], 'returns expected value' );
+
+	y = reshape( x, [ 6 ] );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	y = reshape( x, [ 1, 2, 1, 3 ] );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ [ [ 1.0, 2.0, 3.0 ] ], [ [ 4.0, 5.0, 6.0 ] ] ] ], 'returns expected value' );
+
+	// Negative strides:
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ -3, -1 ], 5, 'row-major' );
+	y = reshape( x, [ 3, 2 ] );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 6.0, 5.0 ], [ 4.0, 3.0 ], [ 2.0, 1.0 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a read-only view when the input ndarray strides are compatible with the output shape (column-major)', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+
+	y = reshape( x, [ 3, 2 ], {
+		'order': 'column-major'
+	});
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.strictEqual( y.order, 'column-major', 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 1.0, 4.0 ], [ 2.0, 5.0 ], [ 3.0, 6.0 ] ], 'returns expected value' );
+
+	y = reshape( x, [ 6 ], {
+		'order': 'same'
+	});
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function copies elements when the input ndarray strides are not compatible with the output shape', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	// Transposed:
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 3, 2 ], [ 1, 3 ], 0, 'row-major' );
+
+	y = reshape( x, [ 6 ] );
+	t.notEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), false, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 4.0, 2.0, 5.0, 3.0, 6.0 ], 'returns expected value' );
+
+	// Index order which does not match the memory layout:
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = reshape( x, [ 3, 2 ], {
+		'order': 'column-major'
+	});
+	t.notEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 1.0, 5.0 ], [ 4.0, 3.0 ], [ 2.0, 6.0 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports reading elements according to the physical memory layout (order=any)', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 3, 2 ], [ 1, 3 ], 0, 'row-major' );
+
+	y = reshape( x, [ 6 ], {
+		'order': 'any'
+	});
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports always copying elements (copy=always)', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	y = reshape( x, [ 3, 2 ], {
+		'copy': 'always'
+	});
+	t.notEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), false, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 1.0, 2.0 ], [ 3.0, 4.0 ], [ 5.0, 6.0 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function throws an error when unable to reshape without copying and the `copy` option is `never`', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', xbuf, [ 3, 2 ], [ 1, 3 ], 0, 'row-major' );
+
+	t.throws( badValue, Error, 'throws an error' );
+
+	x = new ndarray( 'float64', xbuf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	y = reshape( x, [ 3, 2 ], {
+		'copy': 'never'
+	});
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+
+	t.end();
+
+	function badValue() {
+		reshape( x, [ 6 ], {
+			'copy': 'never'
+		});
+	}
+});
+
+tape( 'the function supports zero-dimensional ndarrays', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0 ] );
+	x = new ndarray( 'float64', xbuf, [], [ 0 ], 2, 'row-major' );
+
+	y = reshape( x, [ 1, 1 ] );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ [ 3.0 ] ], 'returns expected value' );
+
+	y = reshape( y, [] );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.deepEqual( y.shape, [], 'returns expected value' );
+	t.strictEqual( y.get(), 3.0, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports empty ndarrays', function test( t ) {
+	var x;
+	var y;
+
+	x = zeros( [ 2, 0 ] );
+
+	y = reshape( x, [ 0, 5 ] );
+	t.strictEqual( getData( y ), getData( x ), 'returns expected value' );
+	t.deepEqual( y.shape, [ 0, 5 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a read-only `ndarray` view when provided an ndarray-like object having compatible strides', function test( t ) {
+	var xbuf;
+	var x;
+	var y;
+
+	xbuf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = {
+		'dtype': 'float64',
+		'data': xbuf,
+		'shape': [ 2, 3 ],
+		'strides': [ 3, 1 ],
+		'offset': 0,
+		'order': 'row-major'
+	};
+
+	y = reshape( x, [ 6 ] );
+	t.strictEqual( y instanceof ndarray, true, 'returns expected value' );
+	t.strictEqual( getData( y ), xbuf, 'returns expected value' );
+	t.strictEqual( isReadOnly( y ), true, 'returns expected value' );
+	t.deepEqual( ndarray2array( y ), [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ], 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,72 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+
+/**
+* Sort order.
+*/
+type SortOrder = 'ascending' | 'descending';
+
+/**
+* Interface describing function options.
+*/
+interface Options {
+	/**
+	* Index of dimension along which to sort elements. Default: `-1`.
+	*/
+	dim?: number;
+
+	/**
+	* Sort order. Default: `'ascending'`.
+	*/
+	sortOrder?: SortOrder;
+}
+
+/**
+* Returns a new ndarray containing the elements of an input ndarray sorted along a specified dimension.
+*
+* ## Notes
+*
+* -   `NaN` values are considered greater than all other values.
+*
+* @param x - input array
+* @param options - function options
+* @param options.dim - index of dimension along which to sort elements
+* @param options.sortOrder - sort order
+* @returns output ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+*
+* var y = sort( x );
+* // returns <ndarray>[ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ]
+*/
+declare function sort<T extends ndarray = ndarray>( x: T, options?: Options ): T;
+
+
+// EXPORTS //
+
+export = sort;
@@ -0,0 +1,89 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import empty = require( './../../../empty' );
+import sort = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const x = empty( [ 2, 2 ] );
+
+	sort( x ); // $ExpectType float64ndarray
+	sort( x, {} ); // $ExpectType float64ndarray
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an ndarray...
+{
+	sort( '10' ); // $ExpectError
+	sort( 10 ); // $ExpectError
+	sort( false ); // $ExpectError
+	sort( true ); // $ExpectError
+	sort( null ); // $ExpectError
+	sort( [] ); // $ExpectError
+	sort( {} ); // $ExpectError
+	sort( ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	const x = empty( [ 2, 2 ] );
+
+	sort( x, '5' ); // $ExpectError
+	sort( x, true ); // $ExpectError
+	sort( x, false ); // $ExpectError
+	sort( x, null ); // $ExpectError
+	sort( x, [ '5' ] ); // $ExpectError
+	sort( x, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `dim` option which is not a number...
+{
+	const x = empty( [ 2, 2 ] );
+
+	sort( x, { 'dim': '5' } ); // $ExpectError
+	sort( x, { 'dim': true } ); // $ExpectError
+	sort( x, { 'dim': false } ); // $ExpectError
+	sort( x, { 'dim': null } ); // $ExpectError
+	sort( x, { 'dim': [ '5' ] } ); // $ExpectError
+	sort( x, { 'dim': {} } ); // $ExpectError
+	sort( x, { 'dim': ( x: number ): number => x } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `sortOrder` option which is not a supported sort order...
+{
+	const x = empty( [ 2, 2 ] );
+
+	sort( x, { 'sortOrder': '5' } ); // $ExpectError
+	sort( x, { 'sortOrder': 5 } ); // $ExpectError
+	sort( x, { 'sortOrder': true } ); // $ExpectError
+	sort( x, { 'sortOrder': false } ); // $ExpectError
+	sort( x, { 'sortOrder': null } ); // $ExpectError
+	sort( x, { 'sortOrder': [ '5' ] } ); // $ExpectError
+	sort( x, { 'sortOrder': {} } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = empty( [ 2, 2 ] );
+
+	sort(); // $ExpectError
+	sort( x, {}, {} ); // $ExpectError
+}
@@ -0,0 +1,66 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+'use strict';
+
+// MODULES //
+
+var isAccessorArray = require( '@stdlib/array/base/assert/is-accessor-array' );
+var unaryStrided1d = require( './../../base/unary-strided1d' );
+var getShape = require( './../../base/shape' );
+var getDType = require( './../../base/dtype' );
+var getData = require( './../../base/data-buffer' );
+var resolveGetter = require( '@stdlib/array/base/resolve-getter' );
+var resolveSetter = require( '@stdlib/array/base/resolve-setter' );
+var Float64Array = require( '@stdlib/array/float64' );
+var zeros = require( '@stdlib/array/base/zeros' );
+var sort1d = require( './sort1d.js' );
+
+
+// MAIN //
+
+/**
+* Sorts each lane of an input ndarray along a specified dimension and assigns results to an output ndarray.
+*
+* @private
+* @param {ndarray} x - input ndarray
+* @param {ndarray} y - output ndarray
+* @param {NonNegativeInteger} dim - dimension along which to sort
+* @param {boolean} descending - boolean indicating whether to sort in descending order
+* @returns {void}
+*/
+function lanes( x, y, dim, descending ) {
+	var generic;
+	var xbuf;
+	var ybuf;
+
+	generic = ( String( getDType( x ) ) === 'generic' );
+	xbuf = getData( x );
+	ybuf = getData( y );
+	unaryStrided1d( sort1d, [ x, y ], [ dim ], {
+		'workspace': ( generic ) ? zeros( getShape( x, false )[ dim ] ) : new Float64Array( getShape( x, false )[ dim ] ), // eslint-disable-line max-len
+		'generic': generic,
+		'accessorProtocol': ( isAccessorArray( xbuf ) || isAccessorArray( ybuf ) ),
+		'accessors': [ resolveGetter( xbuf ), resolveSetter( ybuf ) ],
+		'descending': descending
+	});
+}
+
+
+// EXPORTS //
+
+module.exports = lanes;
@@ -0,0 +1,127 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var join = require( 'path' ).join;
+var tryRequire = require( '@stdlib/utils/try-require' );
+var isError = require( '@stdlib/assert/is-error' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var isRealDataType = require( './../../base/assert/is-real-data-type' );
+var normalizeIndex = require( './../../base/normalize-index' );
+var getShape = require( './../../shape' ); // note: non-base accessor is intentional due to the input array originating in userland
+var getDType = require( './../../base/dtype' );
+var getOrder = require( './../../base/order' );
+var empty = require( './../../empty' );
+var objectAssign = require( '@stdlib/object/assign' );
+var format = require( '@stdlib/string/format' );
+var defaults = require( './defaults.json' );
+var validate = require( './validate.js' );
+var js = require( './lanes.js' );
+
+
+// VARIABLES //
+
+// Prefer the C kernels when the native add-on is available:
+var native = tryRequire( join( __dirname, './native.js' ) );
+var lanes = ( isError( native ) ) ? js : native;
+
+
+// MAIN //
+
+/**
+* Returns a new ndarray containing the elements of an input ndarray sorted along a specified dimension.
+*
+* ## Notes
+*
+* -   `NaN` values are considered greater than all other values. Accordingly, when sorting in ascending order, `NaN` values are placed at the end of each sorted lane, and, when sorting in descending order, `NaN` values are placed at the beginning of each sorted lane.
+* -   For real-valued data types, the function sorts each lane via a contiguous double-precision floating-point workspace using the built-in numeric typed array sort.
+* -   When the native add-on is available and an input ndarray has a real-valued data type and a typed array data buffer, the function sorts lanes using C kernels which map each element to an order-preserving unsigned integer key and perform a stable radix sort. As in the JavaScript implementation, `-0` is considered less than `+0`.
+*
+* @param {ndarray} x - input ndarray
+* @param {Options} [options] - function options
+* @param {integer} [options.dim=-1] - dimension along which to sort
+* @param {string} [options.sortOrder='ascending'] - sort order
+* @throws {TypeError} first argument must be an ndarray-like object
+* @throws {TypeError} first argument must have a real-valued or "generic" data type
+* @throws {TypeError} options argument must be an object
+* @throws {RangeError} dimension index exceeds the number of dimensions
+* @throws {Error} must provide valid options
+* @returns {ndarray} output ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+*
+* var y = sort( x );
+* // returns <ndarray>[ [ 1.0, 2.0, 3.0 ], [ 4.0, 5.0, 6.0 ] ]
+*
+* y = sort( x, {
+*     'dim': 0,
+*     'sortOrder': 'descending'
+* });
+* // returns <ndarray>[ [ 6.0, 5.0, 4.0 ], [ 3.0, 1.0, 2.0 ] ]
+*/
+function sort( x, options ) {
+	var opts;
+	var err;
+	var shx;
+	var dt;
+	var N;
+	var d;
+	var y;
+
+	if ( !isndarrayLike( x ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray-like object. Value: `%s`.', x ) );
+	}
+	dt = getDType( x );
+	if ( !isRealDataType( dt ) && String( dt ) !== 'generic' ) {
+		throw new TypeError( format( 'invalid argument. First argument must have a real-valued or "generic" data type. Value: `%s`.', dt ) );
+	}
+	opts = objectAssign( {}, defaults );
+	if ( arguments.length > 1 ) {
+		err = validate( opts, options );
+		if ( err ) {
+			throw err;
+		}
+	}
+	shx = getShape( x );
+	N = shx.length;
+	d = normalizeIndex( opts.dim, N-1 );
+	if ( d === -1 ) {
+		throw new RangeError( format( 'invalid option. Dimension index exceeds the number of dimensions. Number of dimensions: %d. Value: `%d`.', N, opts.dim ) );
+	}
+	// Initialize an output array having the same shape, data type, and memory layout as the input array:
+	y = empty( shx, {
+		'dtype': dt,
+		'order': getOrder( x )
+	});
+
+	// Sort each lane along the specified dimension:
+	lanes( x, y, d, ( opts.sortOrder === 'descending' ) );
+	return y;
+}
+
+
+// EXPORTS //
+
+module.exports = sort;
@@ -0,0 +1,120 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+'use strict';
+
+// MODULES //
+
+var dispatch = require( './../../base/binary-addon-dispatch' );
+var resolveStr = require( './../../base/dtype-resolve-str' );
+var getDType = require( './../../base/dtype' );
+var getShape = require( './../../base/shape' );
+var getData = require( './../../base/data-buffer' );
+var ndarray = require( './../../base/ctor' );
+var Int32Array = require( '@stdlib/array/int32' );
+var addon = require( './../src/addon.node' );
+var js = require( './lanes.js' );
+
+
+// VARIABLES //
+
+// Input and output ndarray data types supported by the C kernels:
+var DTYPES = {
+	'int8': true,
+	'uint8': true,
+	'uint8c': true,
+	'int16': true,
+	'uint16': true,
+	'int32': true,
+	'uint32': true,
+	'int64': true,
+	'uint64': true,
+	'float32': true,
+	'float64': true
+};
+
+// Dispatch function which invokes the C kernels for ndarrays having typed array data buffers:
+var f = dispatch( addon, fallback );
+
+
+// FUNCTIONS //
+
+/**
+* Sorts lanes using the JavaScript implementation.
+*
+* @private
+* @param {Object} x - input ndarray
+* @param {Object} y - output ndarray
+* @param {Object} options - options ndarray containing the dimension index and the sort order
+* @returns {void}
+*/
+function fallback( x, y, options ) {
+	var buf = getData( options );
+	js( x, y, buf[ 0 ], ( buf[ 1 ] === 1 ) );
+}
+
+/**
+* Tests whether the C kernels support a provided set of ndarrays.
+*
+* ## Notes
+*
+* -   Zero-dimensional ndarrays are delegated to the JavaScript implementation, as a zero-dimensional ndarray does not have a dimension along which to sort.
+*
+* @private
+* @param {Object} x - input ndarray
+* @param {Object} y - output ndarray
+* @returns {boolean} boolean indicating whether the ndarrays are supported
+*/
+function isSupported( x, y ) {
+	var dt = resolveStr( getDType( x ) );
+	if ( !DTYPES[ dt ] || resolveStr( getDType( y ) ) !== dt ) {
+		return false;
+	}
+	return ( getShape( x, false ).length > 0 );
+}
+
+
+// MAIN //
+
+/**
+* Sorts each lane of an input ndarray along a specified dimension and assigns results to an output ndarray.
+*
+* ## Notes
+*
+* -   If the ndarray data types are supported by the C kernels and the ndarray data buffers are typed arrays, the function dispatches to a native add-on; otherwise, the function falls back to the JavaScript implementation.
+* -   The C kernels accept the dimension index and the sort order as a one-dimensional `int32` options ndarray.
+*
+* @private
+* @param {ndarray} x - input ndarray
+* @param {ndarray} y - output ndarray
+* @param {NonNegativeInteger} dim - dimension along which to sort
+* @param {boolean} descending - boolean indicating whether to sort in descending order
+* @returns {void}
+*/
+function lanes( x, y, dim, descending ) {
+	var opts;
+	if ( !isSupported( x, y ) ) {
+		return js( x, y, dim, descending );
+	}
+	opts = new Int32Array( [ dim, ( descending ) ? 1 : 0 ] );
+	f( x, y, new ndarray( 'int32', opts, [ 2 ], [ 1 ], 0, 'row-major' ) );
+}
+
+
+// EXPORTS //
+
+module.exports = lanes;
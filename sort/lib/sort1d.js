@@ -0,0 +1,116 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var ascending = require( './ascending.js' );
+
+
+// MAIN //
+
+/**
+* Sorts a one-dimensional input ndarray and assigns the sorted elements to a one-dimensional output ndarray.
+*
+* ## Notes
+*
+* -   The function gathers the elements of the input ndarray into a contiguous workspace, sorts the workspace, and then scatters the sorted elements to the output ndarray.
+* -   When the workspace is a typed array, the function relies on the built-in numeric typed array sort, which does not require invoking a comparison function and which sorts `NaN` values to the end.
+*
+* @private
+* @param {ArrayLikeObject<Object>} arrays - array-like object containing a one-dimensional input ndarray and a one-dimensional output ndarray
+* @param {Object} opts - function options
+* @param {Collection} opts.workspace - workspace array having at least as many elements as the input ndarray
+* @param {Array<Function>} opts.accessors - input and output array element accessors
+* @param {boolean} opts.accessorProtocol - boolean indicating whether the input and output ndarrays must be accessed via accessors
+* @param {boolean} opts.generic - boolean indicating whether the workspace is a generic array
+* @param {boolean} opts.descending - boolean indicating whether to sort in descending order
+* @returns {Object} output ndarray
+*/
+function sort1d( arrays, opts ) {
+	var xbuf;
+	var ybuf;
+	var get;
+	var set;
+	var ws;
+	var sx;
+	var sy;
+	var ix;
+	var iy;
+	var N;
+	var x;
+	var y;
+	var i;
+
+	x = arrays[ 0 ];
+	y = arrays[ 1 ];
+
+	N = x.shape[ 0 ];
+	xbuf = x.data;
+	ybuf = y.data;
+	sx = x.strides[ 0 ];
+	sy = y.strides[ 0 ];
+	ws = opts.workspace;
+
+	// Copy the input elements to the workspace...
+	ix = x.offset;
+	if ( opts.accessorProtocol ) {
+		get = opts.accessors[ 0 ];
+		for ( i = 0; i < N; i++ ) {
+			ws[ i ] = get( xbuf, ix );
+			ix += sx;
+		}
+	} else {
+		for ( i = 0; i < N; i++ ) {
+			ws[ i ] = xbuf[ ix ];
+			ix += sx;
+		}
+	}
+	// Sort the workspace in ascending order (note: typed arrays are sorted numerically without requiring a comparison function)...
+	if ( opts.generic ) {
+		ws.sort( ascending );
+	} else {
+		ws.sort();
+	}
+	// When sorting in descending order, write the output elements in reverse order:
+	if ( opts.descending ) {
+		iy = y.offset + ( ( N-1 ) * sy );
+		sy *= -1;
+	} else {
+		iy = y.offset;
+	}
+	if ( opts.accessorProtocol ) {
+		set = opts.accessors[ 1 ];
+		for ( i = 0; i < N; i++ ) {
+			set( ybuf, iy, ws[ i ] );
+			iy += sy;
+		}
+	} else {
+		for ( i = 0; i < N; i++ ) {
+			ybuf[ iy ] = ws[ i ];
+			iy += sy;
+		}
+	}
+	return y;
+}
+
+
+// EXPORTS //
+
+module.exports = sort1d;
@@ -0,0 +1,80 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isObject = require( '@stdlib/assert/is-plain-object' );
+var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var isInteger = require( '@stdlib/assert/is-integer' ).isPrimitive;
+var contains = require( '@stdlib/array/base/assert/contains' ).factory;
+var format = require( '@stdlib/string/format' );
+
+
+// VARIABLES //
+
+var SORT_ORDERS = [ 'ascending', 'descending' ];
+var isSortOrder = contains( SORT_ORDERS );
+
+
+// MAIN //
+
+/**
+* Validates function options.
+*
+* @private
+* @param {Object} opts - destination object
+* @param {Options} options - function options
+* @param {integer} [options.dim] - dimension along which to sort
+* @param {string} [options.sortOrder] - sort order
+* @returns {(Error|null)} null or an error object
+*
+* @example
+* var opts = {};
+* var options = {
+*     'dim': 0
+* };
+* var err = validate( opts, options );
+* if ( err ) {
+*     throw err;
+* }
+*/
+function validate( opts, options ) {
+	if ( !isObject( options ) ) {
+		return new TypeError( format( 'invalid argument. Options argument must be an object. Value: `%s`.', options ) );
+	}
+	if ( hasOwnProp( options, 'dim' ) ) {
+		opts.dim = options.dim;
+		if ( !isInteger( opts.dim ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be an integer. Option: `%s`.', 'dim', opts.dim ) );
+		}
+	}
+	if ( hasOwnProp( options, 'sortOrder' ) ) {
+		opts.sortOrder = options.sortOrder;
+		if ( !isSortOrder( opts.sortOrder ) ) {
+			return new TypeError( format( 'invalid option. `%s` option must be one of the following: "%s". Option: `%s`.', 'sortOrder', SORT_ORDERS.join( '", "' ), opts.sortOrder ) );
+		}
+	}
+	return null;
+}
+
+
+// EXPORTS //
+
+module.exports = validate;
@@ -0,0 +1,127 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+'use strict';
+
+// MODULES //
+
+var resolve = require( 'path' ).resolve;
+var tape = require( 'tape' );
+var tryRequire = require( '@stdlib/utils/try-require' );
+var isSameFloat64Array = require( '@stdlib/assert/is-same-float64array' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var ndarray = require( './../../base/ctor' );
+var js = require( './../lib/lanes.js' );
+
+
+// VARIABLES //
+
+var lanes = tryRequire( resolve( __dirname, './../lib/native.js' ) );
+var opts = {
+	'skip': ( lanes instanceof Error )
+};
+
+
+// TESTS //
+
+tape( 'main export is a function', opts, function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof lanes, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function sorts each lane along a specified dimension (float64)', opts, function test( t ) {
+	var expected;
+	var x;
+	var y;
+
+	x = ndarray( 'float64', new Float64Array( [ 3.0, NaN, -0.0, 6.0, 0.0, -4.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	y = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	lanes( x, y, 1, false );
+	expected = new Float64Array( [ -0.0, 3.0, NaN, -4.0, 0.0, 6.0 ] );
+	t.strictEqual( isSameFloat64Array( y.data, expected ), true, 'returns expected value' );
+
+	y = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	lanes( x, y, 1, true );
+	expected = new Float64Array( [ NaN, 3.0, -0.0, 6.0, 0.0, -4.0 ] );
+	t.strictEqual( isSameFloat64Array( y.data, expected ), true, 'returns expected value' );
+
+	y = ndarray( 'float64', new Float64Array( 6 ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	lanes( x, y, 0, false );
+	expected = new Float64Array( [ 3.0, 0.0, -4.0, 6.0, NaN, -0.0 ] );
+	t.strictEqual( isSameFloat64Array( y.data, expected ), true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function sorts each lane along a specified dimension (int32)', opts, function test( t ) {
+	var x;
+	var y;
+
+	x = ndarray( 'int32', new Int32Array( [ 3, -1, 2, 6, 5, -4 ] ), [ 3, 2 ], [ 1, 3 ], 0, 'column-major' );
+	y = ndarray( 'int32', new Int32Array( 6 ), [ 3, 2 ], [ 1, 3 ], 0, 'column-major' );
+
+	lanes( x, y, 0, false );
+	t.deepEqual( Array.prototype.slice.call( y.data ), [ -1, 2, 3, -4, 5, 6 ], 'returns expected value' );
+
+	lanes( x, y, 0, true );
+	t.deepEqual( Array.prototype.slice.call( y.data ), [ 3, 2, -1, 6, 5, -4 ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns results which match the JavaScript implementation', opts, function test( t ) {
+	var xbuf;
+	var y1;
+	var y2;
+	var x;
+	var i;
+
+	xbuf = new Uint8Array( 300 );
+	for ( i = 0; i < xbuf.length; i++ ) {
+		xbuf[ i ] = ( i*37 ) % 251;
+	}
+	x = ndarray( 'uint8', xbuf, [ 3, 100 ], [ 100, 1 ], 0, 'row-major' );
+	y1 = ndarray( 'uint8', new Uint8Array( 300 ), [ 3, 100 ], [ 100, 1 ], 0, 'row-major' );
+	y2 = ndarray( 'uint8', new Uint8Array( 300 ), [ 3, 100 ], [ 100, 1 ], 0, 'row-major' );
+
+	lanes( x, y1, 1, false );
+	js( x, y2, 1, false );
+	t.deepEqual( y1.data, y2.data, 'returns expected value' );
+
+	lanes( x, y1, 0, true );
+	js( x, y2, 0, true );
+	t.deepEqual( y1.data, y2.data, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function falls back to the JavaScript implementation for ndarrays having a "generic" data type', opts, function test( t ) {
+	var x;
+	var y;
+
+	x = ndarray( 'generic', [ 3.0, 1.0, 2.0 ], [ 3 ], [ 1 ], 0, 'row-major' );
+	y = ndarray( 'generic', [ 0.0, 0.0, 0.0 ], [ 3 ], [ 1 ], 0, 'row-major' );
+
+	lanes( x, y, 0, false );
+	t.deepEqual( y.data, [ 1.0, 2.0, 3.0 ], 'returns expected value' );
+
+	t.end();
+});
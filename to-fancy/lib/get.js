@@ -27,6 +27,7 @@ var isArrayIndexString = require( './is_ndindex_string.js' );
 var isCartesianIndexString = require( './is_cartesian_index_string.js' );
 var getElement = require( './get_element.js' );
 var getCartesian = require( './get_cartesian.js' );
+var getElements = require( './get_elements.js' );
 var getValue = require( './get_value.js' );
 var getSlice = require( './get_slice.js' );
 
@@ -70,8 +71,7 @@ function factory( ctx ) {
 			return getCartesian( target, property, ctx );
 		}
 		if ( isArrayIndexString( property ) ) {
-			// FIXME
-			return;
+			return getElements( target, property, ctx );
 		}
 		return getSlice( target, property, ctx );
 	}
@@ -20,12 +20,11 @@
 
 // MODULES //
 
-// var take = require( './../../take' );
-
-// var mskfilter = require( './../../mskfilter' );
-
-// var mskreject = require( './../../mskreject' );
-
+var take = require( './../../base/take' );
+var empty = require( './../../base/empty' );
+var getDType = require( './../../base/dtype' );
+var getShape = require( './../../base/shape' );
+var getOrder = require( './../../base/order' );
 var format = require( '@stdlib/string/format' );
 var prop2array = require( './prop2array.js' );
 
@@ -42,24 +41,26 @@ var prop2array = require( './prop2array.js' );
 * @param {Object} ctx.cache - cache for resolving ndarray index objects
 * @param {Function} ctx.postGetArray - function to process a retrieved ndarray
 * @throws {Error} invalid ndarray index
+* @throws {Error} unsupported ndarray index
 * @throws {RangeError} index exceeds ndarray bounds
 * @returns {ndarrayLike} result
 */
 function getElements( target, property, ctx ) {
-	var idx = prop2array( property, ctx.cache );
-	if ( idx.type === 'int' ) {
-		// FIXME: handle the various "kinds" of index arrays (e.g., "linear" and "cartesian")
+	var idx;
+	var out;
 
-		// return ctx.postGetArray( take( target, idx.data ) );
-		return NaN; // FIXME
-	}
-	if ( idx.type === 'bool' ) {
-		// return ctx.postGetArray( mskfilter( target, idx.data ) );
-		return NaN; // FIXME
+	idx = prop2array( property, ctx.cache );
+	if ( idx.type === 'int' ) {
+		if ( idx.kind === 'cartesian' ) {
+			throw new Error( 'invalid operation. Retrieving elements via an integer index array having the kind "cartesian" is not currently supported. Use a "linear" integer index array instead.' );
+		}
+		// Gather elements according to linear view indices, where the output ndarray has the same shape as the index ndarray:
+		out = empty( getDType( target ), getShape( idx.data, true ), getOrder( target ) );
+		take( [ target, idx.data, out ], 'normalize' );
+		return ctx.postGetArray( out );
 	}
-	if ( idx.type === 'mask' ) {
-		// return ctx.postGetArray( mskreject( target, idx.data ) );
-		return NaN; // FIXME
+	if ( idx.type === 'bool' || idx.type === 'mask' ) {
+		throw new Error( format( 'invalid operation. Retrieving elements via an ndarray index of type "%s" is not currently supported.', idx.type ) );
 	}
 	throw new Error( format( 'invalid operation. Unrecognized ndarray index type. Value: `%s`.', idx.type ) );
 }
@@ -27,6 +27,7 @@ var isArrayIndexString = require( './is_ndindex_string.js' );
 var isIntegerString = require( './is_integer_string.js' );
 var setCartesian = require( './set_cartesian.js' );
 var setElement = require( './set_element.js' );
+var setElements = require( './set_elements.js' );
 var setValue = require( './set_value.js' );
 var setSlice = require( './set_slice.js' );
 
@@ -43,6 +44,7 @@ var setSlice = require( './set_slice.js' );
 * @param {Function} ctx.validator - function for validating new values
 * @param {(Function|null)} ctx.preSetElement - function for normalizing new values (if necessary)
 * @param {Function} ctx.prop2slice - function for converting an indexing expression to a slice
+* @param {Object} ctx.cache - cache for resolving ndarray index objects
 * @returns {Function} handler
 */
 function factory( ctx ) {
@@ -74,8 +76,7 @@ function factory( ctx ) {
 			return setCartesian( target, property, value, ctx );
 		}
 		if ( isArrayIndexString( property ) ) {
-			// FIXME
-			return false;
+			return setElements( target, property, value, ctx );
 		}
 		out = setSlice( target, property, value, receiver, ctx );
 		if ( out ) {
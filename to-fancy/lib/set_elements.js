@@ -0,0 +1,104 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var put = require( './../../base/put' );
+var broadcastScalar = require( './../../base/broadcast-scalar' );
+var maybeBroadcastArray = require( './../../base/maybe-broadcast-array' );
+var isSafeCast = require( './../../base/assert/is-safe-data-type-cast' );
+var getDType = require( './../../base/dtype' );
+var getShape = require( './../../base/shape' );
+var getOrder = require( './../../base/order' );
+var format = require( '@stdlib/string/format' );
+var prop2array = require( './prop2array.js' );
+var errMessage = require( './error_message.js' );
+
+
+// MAIN //
+
+/**
+* Sets the elements specified by an ndarray index.
+*
+* @private
+* @param {ndarrayLike} target - target object
+* @param {string} property - index string
+* @param {*} value - new value
+* @param {Object} ctx - context object
+* @param {Object} ctx.cache - cache for resolving ndarray index objects
+* @param {string} ctx.dtype - target ndarray data type
+* @param {Function} ctx.validator - function for validating new values
+* @param {(Function|null)} ctx.preSetElement - function for normalizing new values (if necessary)
+* @throws {Error} invalid ndarray index
+* @throws {Error} unsupported ndarray index
+* @throws {TypeError} assigned value cannot be safely cast to the target ndarray data type
+* @throws {Error} assigned value must be broadcast compatible with the ndarray index
+* @throws {RangeError} index exceeds ndarray bounds
+* @returns {boolean} boolean indicating whether assignment succeeded
+*/
+function setElements( target, property, value, ctx ) {
+	var idx;
+	var err;
+	var vdt;
+	var sh;
+	var v;
+
+	idx = prop2array( property, ctx.cache );
+	if ( idx.type === 'int' ) {
+		if ( idx.kind === 'cartesian' ) {
+			throw new Error( 'invalid operation. Assigning elements via an integer index array having the kind "cartesian" is not currently supported. Use a "linear" integer index array instead.' );
+		}
+		sh = getShape( idx.data, true );
+
+		// Resolve an ndarray containing the values to assign, where each index is paired with a corresponding value...
+		if ( isndarrayLike( value ) ) {
+			vdt = getDType( value );
+			if ( ctx.dtype !== 'generic' && vdt !== ctx.dtype && !isSafeCast( vdt, ctx.dtype ) ) {
+				throw new TypeError( format( 'invalid operation. Assigned value cannot be safely cast to the target array data type. Data types: [%s, %s].', vdt, ctx.dtype ) );
+			}
+			try {
+				v = maybeBroadcastArray( value, sh );
+			} catch ( error ) {
+				throw new error.constructor( errMessage( error.message ) );
+			}
+		} else {
+			err = ctx.validator( value, ctx.dtype );
+			if ( err ) {
+				throw err;
+			}
+			if ( ctx.preSetElement ) {
+				value = ctx.preSetElement( value );
+			}
+			v = broadcastScalar( value, ctx.dtype, sh, getOrder( target ) );
+		}
+		put( [ idx.data, v, target ], 'normalize' );
+		return true;
+	}
+	if ( idx.type === 'bool' || idx.type === 'mask' ) {
+		throw new Error( format( 'invalid operation. Assigning elements via an ndarray index of type "%s" is not currently supported.', idx.type ) );
+	}
+	throw new Error( format( 'invalid operation. Unrecognized ndarray index type. Value: `%s`.', idx.type ) );
+}
+
+
+// EXPORTS //
+
+module.exports = setElements;
@@ -0,0 +1,226 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var BooleanArray = require( '@stdlib/array/bool' );
+var ndarray = require( './../../ctor' );
+var shape2strides = require( './../../base/shape2strides' );
+var ndindex = require( './../../index' );
+var ndarray2fancy = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Returns a fancy ndarray for testing.
+*
+* @private
+* @returns {ndarray} fancy ndarray
+*/
+function matrix() {
+	var buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	return ndarray2fancy( new ndarray( 'float64', buf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' ) );
+}
+
+/**
+* Returns an integer index array.
+*
+* @private
+* @param {Array<integer>} arr - linear indices
+* @param {NonNegativeIntegerArray} shape - index array shape
+* @returns {ndindex} index array
+*/
+function intIndex( arr, shape ) {
+	return ndindex( new ndarray( 'int32', new Int32Array( arr ), shape, shape2strides( shape, 'row-major' ), 0, 'row-major' ) );
+}
+
+/**
+* Returns a "cartesian" integer index array.
+*
+* @private
+* @param {Array<integer>} arr - subscripts
+* @param {NonNegativeIntegerArray} shape - index array shape
+* @returns {ndindex} index array
+*/
+function cartesianIndex( arr, shape ) {
+	return ndindex( new ndarray( 'int32', new Int32Array( arr ), shape, shape2strides( shape, 'row-major' ), 0, 'row-major' ), {
+		'kind': 'cartesian'
+	});
+}
+
+/**
+* Returns a boolean index array.
+*
+* @private
+* @param {Array<boolean>} arr - boolean values
+* @param {NonNegativeIntegerArray} shape - index array shape
+* @returns {ndindex} index array
+*/
+function boolIndex( arr, shape ) {
+	return ndindex( new ndarray( 'bool', new BooleanArray( arr ), shape, shape2strides( shape, 'row-major' ), 0, 'row-major' ) );
+}
+
+
+// TESTS //
+
+tape( 'the function returns an ndarray which supports retrieving elements via an integer index array', function test( t ) {
+	var x;
+	var y;
+
+	x = matrix();
+	y = x[ intIndex( [ 5, 0, -1, 2 ], [ 2, 2 ] ) ];
+
+	t.deepEqual( y.shape, [ 2, 2 ], 'returns expected value' );
+	t.strictEqual( y.dtype, 'float64', 'returns expected value' );
+	t.deepEqual( y.data, new Float64Array( [ 6.0, 1.0, 6.0, 3.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an ndarray which supports retrieving elements via an integer index array (view)', function test( t ) {
+	var buf;
+	var x;
+	var y;
+
+	// Linear view order: [ 6.0, 4.0, 2.0 ]
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = ndarray2fancy( new ndarray( 'float64', buf, [ 3 ], [ -2 ], 5, 'row-major' ) );
+	y = x[ intIndex( [ 2, 0 ], [ 2 ] ) ];
+
+	t.deepEqual( y.data, new Float64Array( [ 2.0, 6.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an ndarray which throws an error when retrieving elements via an integer index array containing an out-of-bounds index', function test( t ) {
+	var x = matrix();
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		return x[ intIndex( [ 0, 6 ], [ 2 ] ) ];
+	}
+});
+
+tape( 'the function returns an ndarray which supports assigning a scalar via an integer index array', function test( t ) {
+	var x = matrix();
+
+	x[ intIndex( [ 1, -1 ], [ 2 ] ) ] = 10.0;
+	t.deepEqual( x.data, new Float64Array( [ 1.0, 10.0, 3.0, 4.0, 5.0, 10.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an ndarray which supports assigning ndarray values via an integer index array', function test( t ) {
+	var v;
+	var x;
+
+	x = matrix();
+	v = new ndarray( 'float64', new Float64Array( [ 20.0, 30.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	x[ intIndex( [ 4, 0 ], [ 2 ] ) ] = v;
+	t.deepEqual( x.data, new Float64Array( [ 30.0, 2.0, 3.0, 4.0, 20.0, 6.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an ndarray which supports assigning ndarray values via an integer index array (broadcasting)', function test( t ) {
+	var v;
+	var x;
+
+	x = matrix();
+	v = new ndarray( 'float64', new Float64Array( [ 20.0, 30.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	x[ intIndex( [ 0, 1, 4, 5 ], [ 2, 2 ] ) ] = v;
+	t.deepEqual( x.data, new Float64Array( [ 20.0, 30.0, 3.0, 4.0, 20.0, 30.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an ndarray which throws an error when assigning ndarray values which cannot be safely cast to the target data type via an integer index array', function test( t ) {
+	var v;
+	var x;
+
+	x = ndarray2fancy( new ndarray( 'int32', new Int32Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' ) );
+	v = new ndarray( 'float64', new Float64Array( [ 1.5, 2.5 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, TypeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		x[ intIndex( [ 0, 1 ], [ 2 ] ) ] = v;
+	}
+});
+
+tape( 'the function returns an ndarray which throws an error when assigning ndarray values which are not broadcast compatible with an integer index array', function test( t ) {
+	var v;
+	var x;
+
+	x = matrix();
+	v = new ndarray( 'float64', new Float64Array( 3 ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		x[ intIndex( [ 0, 1 ], [ 2 ] ) ] = v;
+	}
+});
+
+tape( 'the function returns an ndarray which throws an error when retrieving elements via a "cartesian" integer index array', function test( t ) {
+	var x = matrix();
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		return x[ cartesianIndex( [ 0, 1, 1, 2 ], [ 2, 2 ] ) ];
+	}
+});
+
+tape( 'the function returns an ndarray which throws an error when assigning elements via a "cartesian" integer index array', function test( t ) {
+	var x = matrix();
+	t.throws( badValue, Error, 'throws an error' );
+	t.deepEqual( x.data, new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), 'returns expected value' );
+	t.end();
+
+	function badValue() {
+		x[ cartesianIndex( [ 0, 1, 1, 2 ], [ 2, 2 ] ) ] = 10.0;
+	}
+});
+
+tape( 'the function returns an ndarray which throws an error when retrieving elements via a boolean index array', function test( t ) {
+	var x = matrix();
+	t.throws( badValue, Error, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		return x[ boolIndex( [ true, false, true, false, true, false ], [ 2, 3 ] ) ];
+	}
+});
+
+tape( 'the function returns an ndarray which throws an error when assigning elements via a boolean index array', function test( t ) {
+	var x = matrix();
+	t.throws( badValue, Error, 'throws an error' );
+	t.deepEqual( x.data, new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), 'returns expected value' );
+	t.end();
+
+	function badValue() {
+		x[ boolIndex( [ true, false, true, false, true, false ], [ 2, 3 ] ) ] = 10.0;
+	}
+});
@@ -0,0 +1,99 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var shape2strides = require( './../../base/shape2strides' );
+var strides2offset = require( './../../base/strides2offset' );
+var numel = require( './../../base/numel' );
+var zeroTo = require( '@stdlib/array/base/zero-to' );
+var ndarray = require( './../../ctor' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var ndarray2json = require( './../lib' );
+
+
+// FUNCTIONS //
+
+/**
+* Creates a benchmark function.
+*
+* @private
+* @param {string} order - memory layout
+* @param {string} fmt - output format
+* @returns {Function} benchmark function
+*/
+function createBenchmark( order, fmt ) {
+	var strides;
+	var buffer;
+	var offset;
+	var shape;
+	var arr;
+
+	shape = [ 10, 10, 10 ];
+	buffer = zeroTo( numel( shape ) );
+	strides = shape2strides( shape, order );
+	offset = strides2offset( shape, strides );
+	arr = ndarray( 'generic', buffer, shape, strides, offset, order );
+
+	return benchmark;
+
+	/**
+	* Benchmark function.
+	*
+	* @private
+	* @param {Benchmark} b - benchmark instance
+	*/
+	function benchmark( b ) {
+		var it;
+		var v;
+		var i;
+
+		b.tic();
+		for ( i = 0; i < b.iterations; i++ ) {
+			it = ndarray2json.chunks( arr, {
+				'format': fmt,
+				'chunkSize': 1024
+			});
+			v = it.next();
+			while ( !v.done ) {
+				if ( typeof v.value !== 'string' ) {
+					b.fail( 'should return a string' );
+				}
+				v = it.next();
+			}
+		}
+		b.toc();
+		if ( v.done !== true ) {
+			b.fail( 'should finish iteration' );
+		}
+		b.pass( 'benchmark finished' );
+		b.end();
+	}
+}
+
+
+// MAIN //
+
+bench( format( '%s:chunks:order=row-major,format=json', pkg ), createBenchmark( 'row-major', 'json' ) );
+bench( format( '%s:chunks:order=column-major,format=json', pkg ), createBenchmark( 'column-major', 'json' ) );
+bench( format( '%s:chunks:order=row-major,format=ndjson', pkg ), createBenchmark( 'row-major', 'ndjson' ) );
+bench( format( '%s:chunks:order=column-major,format=ndjson', pkg ), createBenchmark( 'column-major', 'ndjson' ) );
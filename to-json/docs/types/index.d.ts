@@ -20,7 +20,16 @@
 
 /// <reference types="@stdlib/types"/>
 
-import { typedndarray, realcomplexndarray, boolndarray, DataType, Order } from '@stdlib/types/ndarray';
+import { ndarray, typedndarray, realcomplexndarray, boolndarray, DataType, Order } from '@stdlib/types/ndarray';
+import { TypedIterator, TypedIterableIterator } from '@stdlib/types/iter';
+
+// Define a union type representing both iterable and non-iterable iterators:
+type Iterator<T> = TypedIterator<T> | TypedIterableIterator<T>;
+
+/**
+* Output format.
+*/
+type Format = 'json' | 'ndjson';
 
 /**
 * Interface describing serialized ndarray flags.
@@ -73,68 +82,145 @@ interface JSONObject<T> {
 }
 
 /**
-* Serializes an ndarray as a JSON object.
-*
-* ## Notes
-*
-* -   The function does **not** serialize data outside of the buffer region defined by the ndarray view.
-*
-* @param x - input ndarray
-* @returns JSON object
-*
-* @example
-* var array = require( '@stdlib/ndarray/array' );
-*
-* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
-* // returns <ndarray>
-*
-* var o = ndarray2json( x );
-* // returns {...}
+* Interface defining `chunks` options.
+*/
+interface Options {
+	/**
+	* Output format (default: 'json').
+	*/
+	format?: Format;
+
+	/**
+	* Target chunk size (in characters) (default: 65536).
+	*/
+	chunkSize?: number;
+}
+
+/**
+* Interface describing `ndarray2json`.
 */
-declare function ndarray2json( x: realcomplexndarray ): JSONObject<number>;
+interface Ndarray2json {
+	/**
+	* Serializes an ndarray as a JSON object.
+	*
+	* ## Notes
+	*
+	* -   The function does **not** serialize data outside of the buffer region defined by the ndarray view.
+	*
+	* @param x - input ndarray
+	* @returns JSON object
+	*
+	* @example
+	* var array = require( '@stdlib/ndarray/array' );
+	*
+	* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	* // returns <ndarray>
+	*
+	* var o = ndarray2json( x );
+	* // returns {...}
+	*/
+	( x: realcomplexndarray ): JSONObject<number>;
+
+	/**
+	* Serializes an ndarray as a JSON object.
+	*
+	* ## Notes
+	*
+	* -   The function does **not** serialize data outside of the buffer region defined by the ndarray view.
+	*
+	* @param x - input ndarray
+	* @returns JSON object
+	*
+	* @example
+	* var BooleanArray = require( '@stdlib/array/bool' );
+	* var array = require( '@stdlib/ndarray/array' );
+	*
+	* var x = array( new BooleanArray( 4 ) );
+	* // returns <ndarray>
+	*
+	* var o = ndarray2json( x );
+	* // returns {...}
+	*/
+	( x: boolndarray ): JSONObject<boolean>;
+
+	/**
+	* Serializes an ndarray as a JSON object.
+	*
+	* ## Notes
+	*
+	* -   The function does **not** serialize data outside of the buffer region defined by the ndarray view.
+	*
+	* @param x - input ndarray
+	* @returns JSON object
+	*
+	* @example
+	* var array = require( '@stdlib/ndarray/array' );
+	*
+	* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	* // returns <ndarray>
+	*
+	* var o = ndarray2json( x );
+	* // returns {...}
+	*/
+	<T = unknown>( x: typedndarray<T> ): JSONObject<T>;
+
+	/**
+	* Returns an iterator which serializes an ndarray as JSON in bounded-size string chunks.
+	*
+	* ## Notes
+	*
+	* -   When the `format` option is `'json'` and the input ndarray is an instance of `ndarray` or a base ndarray, concatenating the iterated values yields the same string as `JSON.stringify( ndarray2json( x ) )`.
+	* -   The function reads elements directly from an ndarray's underlying data buffer and thus does not defer to custom `toJSON`, `get`, or `iget` methods.
+	* -   When the `format` option is `'ndjson'`, the first line contains ndarray meta data (i.e., the JSON object without the `data` property) and each subsequent line contains a subarray along the first dimension serialized as (nested) JSON arrays.
+	* -   If an environment supports `Symbol.iterator`, the returned iterator is iterable.
+	*
+	* @param x - input ndarray
+	* @param options - function options
+	* @param options.format - output format (default: 'json')
+	* @param options.chunkSize - target chunk size (in characters) (default: 65536)
+	* @returns iterator
+	*
+	* @example
+	* var array = require( '@stdlib/ndarray/array' );
+	*
+	* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	*
+	* var it = ndarray2json.chunks( x, {
+	*     'format': 'ndjson'
+	* });
+	*
+	* var v = it.next().value;
+	* // returns '{"type":"ndarray","dtype":"float64","flags":{"READONLY":false},"order":"row-major","shape":[2,2],"strides":[2,1]}\n[1,2]\n[3,4]\n'
+	*/
+	chunks( x: ndarray, options?: Options ): Iterator<string>;
+}
 
 /**
 * Serializes an ndarray as a JSON object.
 *
-* ## Notes
-*
-* -   The function does **not** serialize data outside of the buffer region defined by the ndarray view.
-*
 * @param x - input ndarray
 * @returns JSON object
 *
 * @example
-* var BooleanArray = require( '@stdlib/array/bool' );
 * var array = require( '@stdlib/ndarray/array' );
 *
-* var x = array( new BooleanArray( 4 ) );
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
 * // returns <ndarray>
 *
 * var o = ndarray2json( x );
 * // returns {...}
-*/
-declare function ndarray2json( x: boolndarray ): JSONObject<boolean>;
-
-/**
-* Serializes an ndarray as a JSON object.
-*
-* ## Notes
-*
-* -   The function does **not** serialize data outside of the buffer region defined by the ndarray view.
-*
-* @param x - input ndarray
-* @returns JSON object
 *
 * @example
 * var array = require( '@stdlib/ndarray/array' );
 *
 * var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
-* // returns <ndarray>
 *
-* var o = ndarray2json( x );
-* // returns {...}
+* var it = ndarray2json.chunks( x );
+*
+* var v = it.next().value;
+* // returns <string>
 */
-declare function ndarray2json<T = unknown>( x: typedndarray<T> ): JSONObject<T>;
+declare var ndarray2json: Ndarray2json;
 
 
 // EXPORTS //
@@ -46,3 +46,55 @@ import ndarray2json = require( './index' );
 	ndarray2json(); // $ExpectError
 	ndarray2json( arr, {} ); // $ExpectError
 }
+
+// Attached to the main export is a `chunks` method which returns an iterator...
+{
+	const arr = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+
+	ndarray2json.chunks( arr ); // $ExpectType Iterator<string>
+	ndarray2json.chunks( arr, { 'format': 'ndjson' } ); // $ExpectType Iterator<string>
+	ndarray2json.chunks( arr, { 'chunkSize': 1024 } ); // $ExpectType Iterator<string>
+}
+
+// The compiler throws an error if the `chunks` method is provided a first argument which is not an ndarray...
+{
+	ndarray2json.chunks( '5' ); // $ExpectError
+	ndarray2json.chunks( 5 ); // $ExpectError
+	ndarray2json.chunks( true ); // $ExpectError
+	ndarray2json.chunks( null ); // $ExpectError
+	ndarray2json.chunks( {} ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided an options argument which is not an object...
+{
+	const arr = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+
+	ndarray2json.chunks( arr, '5' ); // $ExpectError
+	ndarray2json.chunks( arr, 5 ); // $ExpectError
+	ndarray2json.chunks( arr, true ); // $ExpectError
+	ndarray2json.chunks( arr, null ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided an invalid `format` option...
+{
+	const arr = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+
+	ndarray2json.chunks( arr, { 'format': 'csv' } ); // $ExpectError
+	ndarray2json.chunks( arr, { 'format': 5 } ); // $ExpectError
+	ndarray2json.chunks( arr, { 'format': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided a `chunkSize` option which is not a number...
+{
+	const arr = array( [ [ 1, 2 ], [ 3, 4 ] ] );
+
+	ndarray2json.chunks( arr, { 'chunkSize': '5' } ); // $ExpectError
+	ndarray2json.chunks( arr, { 'chunkSize': true } ); // $ExpectError
+	ndarray2json.chunks( arr, { 'chunkSize': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided an unsupported number of arguments...
+{
+	ndarray2json.chunks(); // $ExpectError
+	ndarray2json.chunks( array( [ 1, 2 ] ), {}, {} ); // $ExpectError
+}
@@ -0,0 +1,428 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var iteratorSymbol = require( '@stdlib/symbol/iterator' );
+var isFinite = require( '@stdlib/math/base/assert/is-finite' );
+var resolveGetter = require( '@stdlib/array/base/resolve-getter' );
+var zeros = require( '@stdlib/array/base/zeros' );
+var real = require( '@stdlib/complex/float64/real' );
+var imag = require( '@stdlib/complex/float64/imag' );
+var isComplexDataType = require( './../../base/assert/is-complex-floating-point-data-type' );
+var isGenericDataType = require( './../../base/assert/is-generic-data-type' );
+var isReadOnly = require( './../../base/assert/is-read-only' );
+var numel = require( './../../base/numel' );
+var getDType = require( './../../dtype' );
+var getShape = require( './../../shape' );
+var getStrides = require( './../../strides' );
+var getOffset = require( './../../offset' );
+var getOrder = require( './../../order' );
+var getData = require( './../../data-buffer' );
+var format = require( '@stdlib/string/format' );
+var validate = require( './validate.js' );
+
+
+// VARIABLES //
+
+var DEFAULT_CHUNK_SIZE = 65536; // characters
+
+
+// FUNCTIONS //
+
+/**
+* Serializes a primitive value (e.g., a number or boolean) as JSON.
+*
+* @private
+* @param {*} v - value
+* @returns {string} serialized value
+*
+* @example
+* var str = primitive( 3.14 );
+* // returns '3.14'
+*
+* str = primitive( NaN );
+* // returns 'null'
+*/
+function primitive( v ) {
+	if ( typeof v === 'number' && !isFinite( v ) ) {
+		return 'null';
+	}
+	return String( v );
+}
+
+/**
+* Serializes an arbitrary value as a JSON array element.
+*
+* @private
+* @param {*} v - value
+* @returns {string} serialized value
+*
+* @example
+* var str = generic( 'beep' );
+* // returns '"beep"'
+*
+* str = generic( void 0 );
+* // returns 'null'
+*/
+function generic( v ) {
+	var s = JSON.stringify( v );
+	return ( s === void 0 ) ? 'null' : s;
+}
+
+/**
+* Serializes a complex number as an interleaved pair of JSON numbers.
+*
+* @private
+* @param {ComplexLike} v - complex number
+* @returns {string} serialized value
+*/
+function complexFlat( v ) {
+	return primitive( real( v ) ) + ',' + primitive( imag( v ) );
+}
+
+/**
+* Serializes a complex number as a JSON array containing real and imaginary components.
+*
+* @private
+* @param {ComplexLike} v - complex number
+* @returns {string} serialized value
+*/
+function complexPair( v ) {
+	return '[' + complexFlat( v ) + ']';
+}
+
+/**
+* Returns a string which repeats a provided string a specified number of times.
+*
+* @private
+* @param {string} str - input string
+* @param {NonNegativeInteger} n - number of repetitions
+* @returns {string} output string
+*
+* @example
+* var str = repeat( '[', 3 );
+* // returns '[[['
+*/
+function repeat( str, n ) {
+	var out = '';
+	var i;
+	for ( i = 0; i < n; i++ ) {
+		out += str;
+	}
+	return out;
+}
+
+/**
+* Serializes an empty subarray as nested JSON arrays.
+*
+* @private
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {NonNegativeInteger} dim - starting dimension index
+* @returns {string} serialized subarray
+*
+* @example
+* var str = nested( [ 2, 3, 0 ], 1 );
+* // returns '[[],[],[]]'
+*/
+function nested( shape, dim ) {
+	var out;
+	var s;
+	var i;
+	if ( shape[ dim ] === 0 ) {
+		return '[]';
+	}
+	s = nested( shape, dim+1 );
+	out = [];
+	for ( i = 0; i < shape[ dim ]; i++ ) {
+		out.push( s );
+	}
+	return '[' + out.join( ',' ) + ']';
+}
+
+/**
+* Returns a list of absolute stride values.
+*
+* @private
+* @param {IntegerArray} strides - stride lengths
+* @returns {NonNegativeIntegerArray} absolute stride values
+*/
+function abs( strides ) {
+	var out;
+	var i;
+
+	out = [];
+	for ( i = 0; i < strides.length; i++ ) {
+		out.push( ( strides[ i ] < 0 ) ? -strides[ i ] : strides[ i ] );
+	}
+	return out;
+}
+
+
+// MAIN //
+
+/**
+* Returns an iterator which serializes an ndarray as JSON in bounded-size string chunks.
+*
+* ## Notes
+*
+* -   When the `format` option is `'json'` and the input ndarray is an instance of `ndarray` or a base ndarray (or otherwise does not customize serialization or element retrieval), concatenating the iterated values yields the same string as `JSON.stringify( toJSON( x ) )`, but without materializing a generic array containing all ndarray elements.
+* -   The function reads elements directly from an ndarray's underlying data buffer and serializes meta data from the ndarray's properties. Accordingly, the function does **not** defer to custom `toJSON`, `get`, or `iget` methods.
+* -   When the `format` option is `'ndjson'`, the first line contains ndarray meta data (i.e., the JSON representation without the `data` property) and each subsequent line contains a row (i.e., a subarray along the first dimension) serialized as (nested) JSON arrays. For a zero-dimensional ndarray, the second line contains the ndarray's single element.
+* -   Elements are visited in the ndarray's memory layout order (or row-major order when the `format` option is `'ndjson'`), and the linear buffer index is updated incrementally, thus avoiding the cost of resolving each element from a linear view index.
+* -   Each iterated value contains at least `chunkSize` characters, except for the last iterated value. Chunks may exceed `chunkSize` by the length of a single serialized element.
+*
+* @param {ndarrayLike} x - input ndarray
+* @param {Options} [options] - function options
+* @param {string} [options.format='json'] - output format
+* @param {PositiveInteger} [options.chunkSize=65536] - target chunk size (in characters)
+* @throws {TypeError} first argument must be an ndarray
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @returns {Iterator} iterator
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var it = chunks( x );
+* // returns <Object>
+*
+* var v = it.next().value;
+* // returns '{"type":"ndarray","dtype":"float64","flags":{"READONLY":false},"order":"row-major","shape":[2,2],"strides":[2,1],"data":[1,2,3,4]}'
+*
+* var bool = it.next().done;
+* // returns true
+*/
+function chunks( x ) {
+	var serialize;
+	var ndjson;
+	var ndims;
+	var dtype;
+	var order;
+	var opts;
+	var iter;
+	var head;
+	var tail;
+	var dims;
+	var get;
+	var buf;
+	var err;
+	var FLG;
+	var idx;
+	var sh;
+	var st;
+	var N;
+	var p;
+	var i;
+
+	if ( !isndarrayLike( x ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray. Value: `%s`.', x ) );
+	}
+	opts = {
+		'format': 'json',
+		'chunkSize': DEFAULT_CHUNK_SIZE
+	};
+	if ( arguments.length > 1 ) {
+		err = validate( opts, arguments[ 1 ] );
+		if ( err ) {
+			throw err;
+		}
+	}
+	ndjson = ( opts.format === 'ndjson' );
+
+	dtype = getDType( x );
+	order = getOrder( x );
+	sh = getShape( x );
+	st = getStrides( x );
+	ndims = sh.length;
+	N = ( ndims === 0 ) ? 1 : numel( sh ); // note: zero-dimensional ndarrays contain a single element
+
+	buf = getData( x );
+	get = resolveGetter( buf );
+	if ( isComplexDataType( dtype ) ) {
+		serialize = ( ndjson ) ? complexPair : complexFlat;
+	} else if ( isGenericDataType( dtype ) ) {
+		serialize = generic;
+	} else {
+		serialize = primitive;
+	}
+	// Resolve the order in which to visit dimensions (from fastest to slowest varying):
+	dims = [];
+	if ( ndjson || order === 'row-major' ) {
+		for ( i = ndims-1; i >= 0; i-- ) {
+			dims.push( i );
+		}
+	} else {
+		for ( i = 0; i < ndims; i++ ) {
+			dims.push( i );
+		}
+	}
+	// Serialize ndarray meta data:
+	head = '{"type":"ndarray","dtype":' + JSON.stringify( dtype ) + ',"flags":{"READONLY":' + isReadOnly( x ) + '},"order":' + JSON.stringify( order ) + ',"shape":' + JSON.stringify( sh ) + ',"strides":' + JSON.stringify( abs( st ) );
+	if ( ndjson ) {
+		head += '}\n';
+		tail = '';
+		if ( N === 0 && ndims > 1 ) {
+			// Emit a line for each (empty) row:
+			tail = repeat( nested( sh, 1 )+'\n', sh[ 0 ] );
+		} else if ( ndims > 1 ) {
+			head += repeat( '[', ndims-1 );
+		}
+	} else {
+		head += ',"data":[';
+		tail = ']}';
+	}
+	// Initialize the current element index and linear buffer index:
+	idx = zeros( ndims );
+	p = getOffset( x );
+	i = 0;
+
+	// Create an iterator protocol-compliant object:
+	iter = {};
+	setReadOnly( iter, 'next', next );
+	setReadOnly( iter, 'return', end );
+
+	// If an environment supports `Symbol.iterator`, make the iterator iterable:
+	if ( iteratorSymbol ) {
+		setReadOnly( iter, iteratorSymbol, factory );
+	}
+	return iter;
+
+	/**
+	* Returns an iterator protocol-compliant object containing the next iterated value.
+	*
+	* @private
+	* @returns {Object} iterator protocol-compliant object
+	*/
+	function next() {
+		var parts;
+		var len;
+		var s;
+		var c;
+		if ( FLG ) {
+			return {
+				'done': true
+			};
+		}
+		parts = [];
+		len = 0;
+		if ( head ) {
+			parts.push( head );
+			len += head.length;
+			head = '';
+		}
+		while ( i < N && len < opts.chunkSize ) {
+			s = serialize( get( buf, p ) );
+			i += 1;
+			c = advance();
+			if ( ndjson ) {
+				if ( ndims <= 1 || i === N ) {
+					s += repeat( ']', ndims-1 ) + '\n';
+				} else if ( c >= ndims-1 ) {
+					// Start a new row:
+					s += repeat( ']', c ) + '\n' + repeat( '[', c );
+				} else if ( c > 0 ) {
+					s += repeat( ']', c ) + ',' + repeat( '[', c );
+				} else {
+					s += ',';
+				}
+			} else if ( i < N ) {
+				s += ',';
+			}
+			parts.push( s );
+			len += s.length;
+		}
+		if ( i >= N ) {
+			if ( tail === null ) {
+				FLG = true;
+				return {
+					'done': true
+				};
+			}
+			parts.push( tail );
+			tail = null;
+		}
+		return {
+			'value': parts.join( '' ),
+			'done': false
+		};
+	}
+
+	/**
+	* Advances the current element index and linear buffer index.
+	*
+	* @private
+	* @returns {NonNegativeInteger} number of dimensions whose index wrapped around to zero
+	*/
+	function advance() {
+		var d;
+		var j;
+		for ( j = 0; j < ndims; j++ ) {
+			d = dims[ j ];
+			idx[ d ] += 1;
+			p += st[ d ];
+			if ( idx[ d ] < sh[ d ] ) {
+				return j;
+			}
+			p -= sh[ d ] * st[ d ];
+			idx[ d ] = 0;
+		}
+		return ndims;
+	}
+
+	/**
+	* Finishes an iterator.
+	*
+	* @private
+	* @param {*} [value] - value to return
+	* @returns {Object} iterator protocol-compliant object
+	*/
+	function end( value ) {
+		FLG = true;
+		if ( arguments.length ) {
+			return {
+				'value': value,
+				'done': true
+			};
+		}
+		return {
+			'done': true
+		};
+	}
+
+	/**
+	* Returns a new iterator.
+	*
+	* @private
+	* @returns {Iterator} iterator
+	*/
+	function factory() {
+		return chunks( x, opts );
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = chunks;
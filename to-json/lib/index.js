@@ -38,13 +38,35 @@
 *
 * var out = ndarray2json( arr );
 * // returns {...}
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2json = require( '@stdlib/ndarray/to-json' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var it = ndarray2json.chunks( x, {
+*     'format': 'ndjson'
+* });
+*
+* var v = it.next().value;
+* // returns '{"type":"ndarray","dtype":"float64","flags":{"READONLY":false},"order":"row-major","shape":[2,2],"strides":[2,1]}\n[1,2]\n[3,4]\n'
 */
 
 // MODULES //
 
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
 var main = require( './main.js' );
+var chunks = require( './chunks.js' );
+
+
+// MAIN //
+
+setReadOnly( main, 'chunks', chunks );
 
 
 // EXPORTS //
 
 module.exports = main;
+
+// exports: { "chunks": "main.chunks" }
@@ -0,0 +1,475 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var iteratorSymbol = require( '@stdlib/symbol/iterator' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Complex64Array = require( '@stdlib/array/complex64' );
+var ndarray = require( './../../ctor' );
+var ndarray2json = require( './../lib/main.js' );
+var chunks = require( './../lib/chunks.js' );
+
+
+// FUNCTIONS //
+
+/**
+* Collects iterated values.
+*
+* @private
+* @param {Iterator} it - iterator
+* @returns {Array<string>} iterated values
+*/
+function collect( it ) {
+	var out;
+	var v;
+
+	out = [];
+	v = it.next();
+	while ( !v.done ) {
+		out.push( v.value );
+		v = it.next();
+	}
+	return out;
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof chunks, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if not provided an ndarray-like object', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		[],
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( x, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `format` option', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	values = [
+		'beep',
+		'csv',
+		5,
+		null,
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( x, {
+				'format': value
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `chunkSize` option', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+
+	values = [
+		'5',
+		0,
+		-1,
+		3.14,
+		NaN,
+		null,
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( x, {
+				'chunkSize': value
+			});
+		};
+	}
+});
+
+tape( 'the function returns an iterator protocol-compliant object', function test( t ) {
+	var it;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( 4 ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	it = chunks( x );
+
+	t.strictEqual( typeof it.next, 'function', 'has next method' );
+	t.strictEqual( typeof it.return, 'function', 'has return method' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (row-major)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+	var i;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	for ( i = 1; i < 8; i++ ) {
+		actual = collect( chunks( x, {
+			'chunkSize': i
+		}) );
+		t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	}
+	actual = collect( chunks( x ) );
+	t.strictEqual( actual.length, 1, 'returns expected value' );
+	t.strictEqual( actual[ 0 ], expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (column-major)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	actual = collect( chunks( x, {
+		'chunkSize': 4
+	}) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (negative strides)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, NaN, 8.0 ] ), [ 2, 2, 2 ], [ -4, 2, -1 ], 5, 'row-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	actual = collect( chunks( x, {
+		'chunkSize': 3
+	}) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (complex)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = ndarray( 'complex64', new Complex64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	actual = collect( chunks( x, {
+		'chunkSize': 2
+	}) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (generic)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = ndarray( 'generic', [ 'beep', null, { 'a': 1 }, void 0 ], [ 4 ], [ 1 ], 0, 'row-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	actual = collect( chunks( x ) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (0d)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( [ 3.0 ] ), [], [ 0 ], 0, 'row-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	actual = collect( chunks( x ) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns an iterator whose concatenated values equal the serialized JSON representation of an ndarray (empty)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( 0 ), [ 2, 0, 3 ], [ 0, 3, 1 ], 0, 'row-major' );
+	expected = JSON.stringify( ndarray2json( x ) );
+
+	actual = collect( chunks( x ) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes elements from the underlying data buffer and does not defer to custom element accessors', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = {
+		'dtype': 'float64',
+		'data': new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ),
+		'shape': [ 2, 2 ],
+		'strides': [ 2, 1 ],
+		'offset': 0,
+		'order': 'row-major',
+		'ndims': 2,
+		'length': 4,
+		'flags': {},
+		'get': get,
+		'set': noop,
+		'toJSON': toJSON
+	};
+	expected = '{"type":"ndarray","dtype":"float64","flags":{"READONLY":false},"order":"row-major","shape":[2,2],"strides":[2,1],"data":[1,2,3,4]}';
+
+	actual = collect( chunks( x ) );
+	t.strictEqual( actual.join( '' ), expected, 'returns expected value' );
+	t.end();
+
+	function get() {
+		return 0.0;
+	}
+
+	function noop() {
+		// No-op...
+	}
+
+	function toJSON() {
+		return {};
+	}
+});
+
+tape( 'the function supports serializing an ndarray as newline-delimited JSON', function test( t ) {
+	var expected;
+	var actual;
+	var lines;
+	var meta;
+	var x;
+	var i;
+
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 ] ), [ 2, 2, 2 ], [ 1, 2, 4 ], 0, 'column-major' );
+
+	expected = [ [ [ 1, 5 ], [ 3, 7 ] ], [ [ 2, 6 ], [ 4, 8 ] ] ];
+	for ( i = 1; i < 8; i++ ) {
+		actual = collect( chunks( x, {
+			'format': 'ndjson',
+			'chunkSize': i
+		}) );
+		lines = actual.join( '' ).split( '\n' );
+		t.strictEqual( lines.length, 4, 'returns expected value' );
+		t.strictEqual( lines[ 3 ], '', 'returns expected value' );
+
+		meta = JSON.parse( lines[ 0 ] );
+		t.strictEqual( meta.type, 'ndarray', 'returns expected value' );
+		t.strictEqual( meta.dtype, 'float64', 'returns expected value' );
+		t.strictEqual( meta.order, 'column-major', 'returns expected value' );
+		t.deepEqual( meta.shape, [ 2, 2, 2 ], 'returns expected value' );
+		t.deepEqual( meta.strides, [ 1, 2, 4 ], 'returns expected value' );
+		t.strictEqual( meta.data, void 0, 'returns expected value' );
+
+		t.deepEqual( JSON.parse( lines[ 1 ] ), expected[ 0 ], 'returns expected value' );
+		t.deepEqual( JSON.parse( lines[ 2 ] ), expected[ 1 ], 'returns expected value' );
+	}
+	t.end();
+});
+
+tape( 'the function supports serializing an ndarray as newline-delimited JSON (complex)', function test( t ) {
+	var actual;
+	var x;
+
+	x = ndarray( 'complex64', new Complex64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	actual = collect( chunks( x, {
+		'format': 'ndjson'
+	}) ).join( '' ).split( '\n' );
+	t.deepEqual( actual.slice( 1 ), [ '[1,2]', '[3,4]', '' ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports serializing an ndarray as newline-delimited JSON (0d)', function test( t ) {
+	var actual;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( [ 3.0 ] ), [], [ 0 ], 0, 'row-major' );
+
+	actual = collect( chunks( x, {
+		'format': 'ndjson'
+	}) ).join( '' ).split( '\n' );
+	t.deepEqual( actual.slice( 1 ), [ '3', '' ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports serializing an ndarray as newline-delimited JSON (empty)', function test( t ) {
+	var actual;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( 0 ), [ 2, 3, 0 ], [ 0, 0, 1 ], 0, 'row-major' );
+
+	actual = collect( chunks( x, {
+		'format': 'ndjson'
+	}) ).join( '' ).split( '\n' );
+	t.deepEqual( actual.slice( 1 ), [ '[[],[],[]]', '[[],[],[]]', '' ], 'returns expected value' );
+	t.end();
+});
+
+tape( 'the returned iterator has a `return` method for closing an iterator (no argument)', function test( t ) {
+	var it;
+	var r;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( 8 ), [ 8 ], [ 1 ], 0, 'row-major' );
+	it = chunks( x, {
+		'chunkSize': 1
+	});
+
+	r = it.next();
+	t.strictEqual( typeof r.value, 'string', 'returns expected value' );
+	t.strictEqual( r.done, false, 'returns expected value' );
+
+	r = it.return();
+	t.strictEqual( r.value, void 0, 'returns expected value' );
+	t.strictEqual( r.done, true, 'returns expected value' );
+
+	r = it.next();
+	t.strictEqual( r.value, void 0, 'returns expected value' );
+	t.strictEqual( r.done, true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the returned iterator has a `return` method for closing an iterator (argument)', function test( t ) {
+	var it;
+	var r;
+	var x;
+
+	x = ndarray( 'float64', new Float64Array( 8 ), [ 8 ], [ 1 ], 0, 'row-major' );
+	it = chunks( x, {
+		'chunkSize': 1
+	});
+
+	r = it.next();
+	t.strictEqual( r.done, false, 'returns expected value' );
+
+	r = it.return( 'finished' );
+	t.strictEqual( r.value, 'finished', 'returns expected value' );
+	t.strictEqual( r.done, true, 'returns expected value' );
+
+	r = it.next();
+	t.strictEqual( r.value, void 0, 'returns expected value' );
+	t.strictEqual( r.done, true, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'if an environment supports `Symbol.iterator`, the returned iterator is iterable', function test( t ) {
+	var it1;
+	var it2;
+	var x;
+
+	if ( !iteratorSymbol ) {
+		t.ok( true, 'environment does not support Symbol.iterator' );
+		return t.end();
+	}
+	x = ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	it1 = chunks( x, {
+		'chunkSize': 2
+	});
+	t.strictEqual( typeof it1[ iteratorSymbol ], 'function', 'has method' );
+
+	it2 = it1[ iteratorSymbol ]();
+	t.notEqual( it2, it1, 'returns a new iterator' );
+	t.strictEqual( collect( it2 ).join( '' ), collect( it1 ).join( '' ), 'returns expected value' );
+	t.end();
+});
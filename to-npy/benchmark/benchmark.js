@@ -0,0 +1,129 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var bench = require( '@stdlib/bench' );
+var isUint8Array = require( '@stdlib/assert/is-uint8array' );
+var Float64Array = require( '@stdlib/array/float64' );
+var ndarray = require( './../../ctor' );
+var format = require( '@stdlib/string/format' );
+var pkg = require( './../package.json' ).name;
+var ndarray2npy = require( './../lib' );
+
+
+// MAIN //
+
+bench( format( '%s:contiguous=true', pkg ), function benchmark( b ) {
+	var out;
+	var x;
+	var i;
+
+	x = new ndarray( 'float64', new Float64Array( 10000 ), [ 100, 100 ], [ 100, 1 ], 0, 'row-major' );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = ndarray2npy( x );
+		if ( out.length !== 80128 ) {
+			b.fail( 'unexpected length' );
+		}
+	}
+	b.toc();
+	if ( !isUint8Array( out ) ) {
+		b.fail( 'should return a Uint8Array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:contiguous=false', pkg ), function benchmark( b ) {
+	var out;
+	var x;
+	var i;
+
+	// Every other column of a 100x200 matrix:
+	x = new ndarray( 'float64', new Float64Array( 20000 ), [ 100, 100 ], [ 200, 2 ], 0, 'row-major' );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = ndarray2npy( x );
+		if ( out.length !== 80128 ) {
+			b.fail( 'unexpected length' );
+		}
+	}
+	b.toc();
+	if ( !isUint8Array( out ) ) {
+		b.fail( 'should return a Uint8Array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:contiguous=false,inner_contiguous=true', pkg ), function benchmark( b ) {
+	var out;
+	var x;
+	var i;
+
+	// Left half of a 100x200 matrix:
+	x = new ndarray( 'float64', new Float64Array( 20000 ), [ 100, 100 ], [ 200, 1 ], 0, 'row-major' );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		out = ndarray2npy( x );
+		if ( out.length !== 80128 ) {
+			b.fail( 'unexpected length' );
+		}
+	}
+	b.toc();
+	if ( !isUint8Array( out ) ) {
+		b.fail( 'should return a Uint8Array' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
+
+bench( format( '%s:chunks', pkg ), function benchmark( b ) {
+	var it;
+	var x;
+	var v;
+	var i;
+
+	x = new ndarray( 'float64', new Float64Array( 10000 ), [ 100, 100 ], [ 100, 1 ], 0, 'row-major' );
+
+	b.tic();
+	for ( i = 0; i < b.iterations; i++ ) {
+		it = ndarray2npy.chunks( x, {
+			'chunkSize': 8192
+		});
+		v = it.next();
+		while ( !v.done ) {
+			v = it.next();
+		}
+		if ( typeof v !== 'object' ) {
+			b.fail( 'should return an object' );
+		}
+	}
+	b.toc();
+	if ( !v.done ) {
+		b.fail( 'should be finished' );
+	}
+	b.pass( 'benchmark finished' );
+	b.end();
+});
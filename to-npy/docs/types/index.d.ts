@@ -0,0 +1,120 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray } from '@stdlib/types/ndarray';
+import { TypedIterator, TypedIterableIterator } from '@stdlib/types/iter';
+
+// Define a union type representing both iterable and non-iterable iterators:
+type Iterator<T> = TypedIterator<T> | TypedIterableIterator<T>;
+
+/**
+* Interface defining `chunks` options.
+*/
+interface Options {
+	/**
+	* Maximum data chunk size (in bytes) (default: 65536).
+	*/
+	chunkSize?: number;
+}
+
+/**
+* Interface describing `ndarray2npy`.
+*/
+interface Ndarray2npy {
+	/**
+	* Serializes an ndarray in the NumPy `.npy` format.
+	*
+	* ## Notes
+	*
+	* -   The function returns a newly allocated byte array containing both the `.npy` header and array data. To serialize large ndarrays without materializing the entire output in memory, use the `chunks` method.
+	*
+	* @param x - input ndarray
+	* @returns serialized ndarray
+	*
+	* @example
+	* var array = require( './../../../array' );
+	*
+	* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	*
+	* var out = ndarray2npy( x );
+	* // returns <Uint8Array>
+	*/
+	( x: ndarray ): Uint8Array;
+
+	/**
+	* Returns an iterator which serializes an ndarray in the NumPy `.npy` format as a sequence of byte chunks.
+	*
+	* ## Notes
+	*
+	* -   The first iterated value is the `.npy` header. Each subsequent iterated value contains array data in memory order.
+	* -   When an ndarray view is contiguous in either row-major or column-major order, data chunks are views of the underlying data buffer and are **not** copied. Accordingly, consumers should process each chunk before mutating the input ndarray.
+	*
+	* @param x - input ndarray
+	* @param options - function options
+	* @param options.chunkSize - maximum data chunk size (in bytes)
+	* @returns iterator
+	*
+	* @example
+	* var array = require( './../../../array' );
+	*
+	* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+	*
+	* var it = ndarray2npy.chunks( x );
+	*
+	* var v = it.next().value;
+	* // returns <Uint8Array>
+	*/
+	chunks( x: ndarray, options?: Options ): Iterator<Uint8Array>;
+}
+
+/**
+* Serializes an ndarray in the NumPy `.npy` format.
+*
+* @param x - input ndarray
+* @returns serialized ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var out = ndarray2npy( x );
+* // returns <Uint8Array>
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var it = ndarray2npy.chunks( x, {
+*     'chunkSize': 16
+* });
+*
+* var v = it.next().value;
+* // returns <Uint8Array>
+*/
+declare var ndarray2npy: Ndarray2npy;
+
+
+// EXPORTS //
+
+export = ndarray2npy;
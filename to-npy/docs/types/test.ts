@@ -0,0 +1,80 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import zeros = require( './../../../zeros' );
+import ndarray2npy = require( './index' );
+
+
+// TESTS //
+
+// The function returns a Uint8Array...
+{
+	ndarray2npy( zeros( [ 2, 2 ] ) ); // $ExpectType Uint8Array
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an ndarray...
+{
+	ndarray2npy( '5' ); // $ExpectError
+	ndarray2npy( 5 ); // $ExpectError
+	ndarray2npy( true ); // $ExpectError
+	ndarray2npy( null ); // $ExpectError
+	ndarray2npy( {} ); // $ExpectError
+	ndarray2npy( ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	ndarray2npy(); // $ExpectError
+	ndarray2npy( zeros( [ 2, 2 ] ), {} ); // $ExpectError
+}
+
+// Attached to the main export is a `chunks` method which returns an iterator...
+{
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ) ); // $ExpectType Iterator<Uint8Array>
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), { 'chunkSize': 1024 } ); // $ExpectType Iterator<Uint8Array>
+}
+
+// The compiler throws an error if the `chunks` method is provided a first argument which is not an ndarray...
+{
+	ndarray2npy.chunks( '5' ); // $ExpectError
+	ndarray2npy.chunks( 5 ); // $ExpectError
+	ndarray2npy.chunks( true ); // $ExpectError
+	ndarray2npy.chunks( null ); // $ExpectError
+	ndarray2npy.chunks( {} ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided an options argument which is not an object...
+{
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), '5' ); // $ExpectError
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), 5 ); // $ExpectError
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), true ); // $ExpectError
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), null ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided a `chunkSize` option which is not a number...
+{
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), { 'chunkSize': '5' } ); // $ExpectError
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), { 'chunkSize': true } ); // $ExpectError
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), { 'chunkSize': null } ); // $ExpectError
+}
+
+// The compiler throws an error if the `chunks` method is provided an unsupported number of arguments...
+{
+	ndarray2npy.chunks(); // $ExpectError
+	ndarray2npy.chunks( zeros( [ 2, 2 ] ), {}, {} ); // $ExpectError
+}
@@ -0,0 +1,57 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+var join = require( 'path' ).join;
+var fs = require( 'fs' );
+var tmpdir = require( '@stdlib/os/tmpdir' );
+var discreteUniform = require( '@stdlib/random/discrete-uniform' );
+var ndarray2array = require( './../../to-array' );
+var ndarray = require( './../../ctor' );
+var getData = require( './../../data-buffer' );
+var npy2ndarray = require( './../../from-npy' );
+var ndarray2npy = require( './../lib' );
+
+// Create a random ndarray:
+var x = discreteUniform( [ 3, 4 ], -10, 10, {
+	'dtype': 'int32'
+});
+console.log( ndarray2array( x ) );
+
+// Create a non-contiguous view containing every other column in reverse row order:
+var y = ndarray( 'int32', getData( x ), [ 3, 2 ], [ -4, 2 ], 8, 'row-major' );
+
+// Stream the view to a `.npy` file in small chunks without materializing a full copy:
+var path = join( tmpdir(), 'stdlib-ndarray-to-npy-example.npy' );
+var fd = fs.openSync( path, 'w' );
+var it = ndarray2npy.chunks( y, {
+	'chunkSize': 16
+});
+var v = it.next();
+while ( !v.done ) {
+	fs.writeSync( fd, v.value );
+	v = it.next();
+}
+fs.closeSync( fd );
+
+// Read the file back into an ndarray:
+var z = npy2ndarray( fs.readFileSync( path ) );
+console.log( ndarray2array( z ) );
+
+fs.unlinkSync( path );
@@ -0,0 +1,338 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var iteratorSymbol = require( '@stdlib/symbol/iterator' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var zeros = require( '@stdlib/array/base/zeros' );
+var floor = require( '@stdlib/math/base/special/floor' );
+var isRowMajorContiguous = require( './../../base/assert/is-row-major-contiguous' );
+var isColumnMajorContiguous = require( './../../base/assert/is-column-major-contiguous' );
+var iterationOrder = require( './../../base/iteration-order' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+var numel = require( './../../base/numel' );
+var getDType = require( './../../dtype' );
+var getShape = require( './../../shape' );
+var getStrides = require( './../../strides' );
+var getOffset = require( './../../offset' );
+var getOrder = require( './../../order' );
+var getData = require( './../../data-buffer' );
+var format = require( '@stdlib/string/format' );
+var validate = require( './validate.js' );
+var header = require( './header.js' );
+
+
+// VARIABLES //
+
+var DEFAULT_CHUNK_SIZE = 65536; // bytes
+
+
+// MAIN //
+
+/**
+* Returns an iterator which serializes an ndarray in the NumPy `.npy` format as a sequence of byte chunks.
+*
+* ## Notes
+*
+* -   The first iterated value is the `.npy` header. Each subsequent iterated value contains array data in memory order.
+* -   When an ndarray view is contiguous in either row-major or column-major order, data chunks are views of the underlying data buffer and are **not** copied. Accordingly, consumers should process (e.g., write) each chunk before mutating the input ndarray.
+* -   When an ndarray view is not contiguous, array data is serialized in the ndarray's memory layout order, with elements copied into newly allocated chunks one chunk at a time. Hence, the function never materializes a full copy of the array data.
+*
+* @param {ndarrayLike} x - input ndarray
+* @param {Options} [options] - function options
+* @param {PositiveInteger} [options.chunkSize=65536] - maximum data chunk size (in bytes)
+* @throws {TypeError} first argument must be an ndarray having a supported data type
+* @throws {TypeError} options argument must be an object
+* @throws {TypeError} must provide valid options
+* @returns {Iterator} iterator
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var it = chunks( x );
+* // returns <Object>
+*
+* var v = it.next().value;
+* // returns <Uint8Array>
+*
+* v = it.next().value;
+* // returns <Uint8Array>
+*
+* var bool = it.next().done;
+* // returns true
+*/
+function chunks( x ) {
+	var contiguous;
+	var fortran;
+	var hbytes;
+	var nbytes;
+	var offset;
+	var bytes;
+	var dtype;
+	var opts;
+	var iter;
+	var buf;
+	var bpe;
+	var err;
+	var FLG;
+	var idx;
+	var sh;
+	var st;
+	var d0;
+	var s0;
+	var N;
+	var p;
+	var k;
+
+	if ( !isndarrayLike( x ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray. Value: `%s`.', x ) );
+	}
+	opts = {
+		'chunkSize': DEFAULT_CHUNK_SIZE
+	};
+	if ( arguments.length > 1 ) {
+		err = validate( opts, arguments[ 1 ] );
+		if ( err ) {
+			throw err;
+		}
+	}
+	dtype = String( getDType( x ) );
+	sh = getShape( x );
+	st = getStrides( x );
+	offset = getOffset( x );
+
+	// Determine whether the ndarray view is contiguous (with positive strides) in either row-major or column-major order, preferring the ndarray's stated order when contiguous in both...
+	fortran = ( getOrder( x ) === 'column-major' );
+	contiguous = false;
+	if ( sh.length === 0 ) {
+		fortran = false;
+		contiguous = true;
+	} else if ( iterationOrder( st ) === 1 ) {
+		if ( isColumnMajorContiguous( sh, st, offset ) && ( fortran || !isRowMajorContiguous( sh, st, offset ) ) ) { // eslint-disable-line max-len
+			fortran = true;
+			contiguous = true;
+		} else if ( isRowMajorContiguous( sh, st, offset ) ) {
+			fortran = false;
+			contiguous = true;
+		}
+	}
+	hbytes = header( dtype, sh, fortran );
+	if ( hbytes === null ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray having a supported data type. Value: `%s`.', dtype ) );
+	}
+	bpe = bytesPerElement( dtype );
+	N = ( sh.length === 0 ) ? 1 : numel( sh ); // note: zero-dimensional ndarrays contain a single element
+	nbytes = N * bpe;
+
+	// Resolve the maximum number of elements per chunk:
+	k = floor( opts.chunkSize / bpe );
+	if ( k < 1 ) {
+		k = 1;
+	}
+	opts.chunkSize = k * bpe;
+
+	// Create a byte view of the underlying data buffer:
+	buf = getData( x );
+	bytes = new Uint8Array( buf.buffer, buf.byteOffset, buf.byteLength );
+
+	// Initialize the current byte position within the underlying data buffer:
+	p = offset * bpe;
+
+	if ( !contiguous ) {
+		// Resolve the dimension in which indices iterate fastest and its stride (in bytes):
+		d0 = ( fortran ) ? 0 : sh.length-1;
+		s0 = st[ d0 ] * bpe;
+		idx = zeros( sh.length );
+	}
+	// Initialize a counter for the number of serialized bytes (with `-1` indicating that the header has yet to be returned):
+	k = -1;
+
+	// Create an iterator protocol-compliant object:
+	iter = {};
+	setReadOnly( iter, 'next', next );
+	setReadOnly( iter, 'return', end );
+
+	// If an environment supports `Symbol.iterator`, make the iterator iterable:
+	if ( iteratorSymbol ) {
+		setReadOnly( iter, iteratorSymbol, factory );
+	}
+	return iter;
+
+	/**
+	* Returns an iterator protocol-compliant object containing the next iterated value.
+	*
+	* @private
+	* @returns {Object} iterator protocol-compliant object
+	*/
+	function next() {
+		var out;
+		var n;
+		if ( FLG ) {
+			return {
+				'done': true
+			};
+		}
+		if ( k < 0 ) {
+			k = 0;
+			return {
+				'value': hbytes,
+				'done': false
+			};
+		}
+		if ( k >= nbytes ) {
+			FLG = true;
+			return {
+				'done': true
+			};
+		}
+		n = nbytes - k;
+		if ( n > opts.chunkSize ) {
+			n = opts.chunkSize;
+		}
+		if ( contiguous ) {
+			out = bytes.subarray( p+k, p+k+n );
+		} else {
+			out = gather( n );
+		}
+		k += n;
+		return {
+			'value': out,
+			'done': false
+		};
+	}
+
+	/**
+	* Copies the next set of elements in memory order to a newly allocated chunk.
+	*
+	* @private
+	* @param {PositiveInteger} n - number of bytes
+	* @returns {Uint8Array} chunk
+	*/
+	function gather( n ) {
+		var out;
+		var m;
+		var o;
+		var i;
+		var j;
+
+		out = new Uint8Array( n );
+		o = 0;
+		while ( o < n ) {
+			// When elements along the fastest dimension are adjacent in memory, copy the remainder of the current run all at once...
+			if ( s0 === bpe ) {
+				m = ( sh[ d0 ]-idx[ d0 ] ) * bpe;
+				if ( m > n-o ) {
+					m = n - o;
+				}
+				out.set( bytes.subarray( p, p+m ), o );
+			} else {
+				m = bpe;
+				for ( j = 0; j < bpe; j++ ) {
+					out[ o+j ] = bytes[ p+j ];
+				}
+			}
+			o += m;
+			m /= bpe;
+
+			// Advance the index along the fastest dimension:
+			idx[ d0 ] += m;
+			p += m * s0;
+			if ( idx[ d0 ] < sh[ d0 ] ) {
+				continue;
+			}
+			// Carry into slower dimensions:
+			p -= sh[ d0 ] * s0;
+			idx[ d0 ] = 0;
+			if ( fortran ) {
+				for ( i = 1; i < sh.length; i++ ) {
+					if ( carry( i ) ) {
+						break;
+					}
+				}
+			} else {
+				for ( i = sh.length-2; i >= 0; i-- ) {
+					if ( carry( i ) ) {
+						break;
+					}
+				}
+			}
+		}
+		return out;
+	}
+
+	/**
+	* Increments the index along a specified dimension, resetting the index to zero upon reaching the end of the dimension.
+	*
+	* @private
+	* @param {NonNegativeInteger} i - dimension index
+	* @returns {boolean} boolean indicating whether incrementing completed without overflow
+	*/
+	function carry( i ) {
+		var s = st[ i ] * bpe;
+		idx[ i ] += 1;
+		p += s;
+		if ( idx[ i ] < sh[ i ] ) {
+			return true;
+		}
+		p -= sh[ i ] * s;
+		idx[ i ] = 0;
+		return false;
+	}
+
+	/**
+	* Finishes an iterator.
+	*
+	* @private
+	* @param {*} [value] - value to return
+	* @returns {Object} iterator protocol-compliant object
+	*/
+	function end( value ) {
+		FLG = true;
+		if ( arguments.length ) {
+			return {
+				'value': value,
+				'done': true
+			};
+		}
+		return {
+			'done': true
+		};
+	}
+
+	/**
+	* Returns a new iterator.
+	*
+	* @private
+	* @returns {Iterator} iterator
+	*/
+	function factory() {
+		return chunks( x, opts );
+	}
+}
+
+
+// EXPORTS //
+
+module.exports = chunks;
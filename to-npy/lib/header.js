@@ -0,0 +1,189 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var IS_LITTLE_ENDIAN = require( '@stdlib/assert/is-little-endian' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var ceil = require( '@stdlib/math/base/special/ceil' );
+var bytesPerElement = require( './../../base/bytes-per-element' );
+
+
+// VARIABLES //
+
+// Mapping from data types to NumPy type codes (excluding byte order):
+var TYPECODES = {
+	'binary': 'u1',
+	'bool': 'b1',
+	'complex64': 'c8',
+	'complex128': 'c16',
+	'float32': 'f4',
+	'float64': 'f8',
+	'int8': 'i1',
+	'int16': 'i2',
+	'int32': 'i4',
+	'uint8': 'u1',
+	'uint8c': 'u1',
+	'uint16': 'u2',
+	'uint32': 'u4'
+};
+
+// Magic string identifying a `.npy` file (i.e., `\x93NUMPY`):
+var MAGIC = [ 0x93, 0x4e, 0x55, 0x4d, 0x50, 0x59 ];
+
+// Header alignment (in bytes), which ensures that the data section is aligned for all supported data types:
+var ALIGNMENT = 64;
+
+// Maximum header length supported by version 1.0 of the format:
+var MAX_V1_HEADER_LENGTH = 65535;
+
+
+// FUNCTIONS //
+
+/**
+* Returns the NumPy array-protocol type string for a provided data type.
+*
+* @private
+* @param {string} dtype - data type
+* @returns {(string|null)} type string
+*
+* @example
+* var str = descr( 'float64' );
+* // e.g., returns '<f8'
+*/
+function descr( dtype ) {
+	var code = TYPECODES[ dtype ];
+	if ( code === void 0 ) {
+		return null;
+	}
+	if ( bytesPerElement( dtype ) === 1 ) {
+		return '|' + code;
+	}
+	return ( ( IS_LITTLE_ENDIAN ) ? '<' : '>' ) + code;
+}
+
+/**
+* Serializes an array shape as a Python tuple literal.
+*
+* @private
+* @param {NonNegativeIntegerArray} shape - array shape
+* @returns {string} tuple literal
+*
+* @example
+* var str = tuple( [ 3 ] );
+* // returns '(3,)'
+*
+* str = tuple( [ 3, 4 ] );
+* // returns '(3, 4)'
+*/
+function tuple( shape ) {
+	if ( shape.length === 1 ) {
+		return '(' + shape[ 0 ] + ',)';
+	}
+	return '(' + shape.join( ', ' ) + ')';
+}
+
+/**
+* Returns the length of a header padded such that the total header length, including a prefix, is a multiple of the header alignment.
+*
+* @private
+* @param {PositiveInteger} prefix - prefix length
+* @param {PositiveInteger} len - unpadded header length
+* @returns {PositiveInteger} padded header length
+*
+* @example
+* var len = padded( 10, 60 );
+* // returns 118
+*/
+function padded( prefix, len ) {
+	return ( ceil( ( prefix+len ) / ALIGNMENT ) * ALIGNMENT ) - prefix;
+}
+
+
+// MAIN //
+
+/**
+* Returns a `.npy` header.
+*
+* ## Notes
+*
+* -   The header is padded with spaces and terminated by a newline, such that the total header length, including the magic string, version, and header length fields, is a multiple of 64 bytes. Accordingly, the data section which follows the header is suitably aligned for memory mapping.
+* -   The function uses version 1.0 of the format, unless the header exceeds the maximum length supported by version 1.0, in which case the function uses version 2.0.
+*
+* @private
+* @param {string} dtype - data type
+* @param {NonNegativeIntegerArray} shape - array shape
+* @param {boolean} fortran - boolean indicating whether array data is stored in column-major order
+* @returns {(Uint8Array|null)} header or null if a data type is not supported
+*
+* @example
+* var h = header( 'float64', [ 3, 4 ], false );
+* // returns <Uint8Array>
+*/
+function header( dtype, shape, fortran ) {
+	var prefix;
+	var dict;
+	var len;
+	var out;
+	var d;
+	var i;
+
+	d = descr( dtype );
+	if ( d === null ) {
+		return null;
+	}
+	dict = '{\'descr\': \'' + d + '\', \'fortran_order\': ' + ( ( fortran ) ? 'True' : 'False' ) + ', \'shape\': ' + tuple( shape ) + ', }';
+
+	// Version 1.0 header prefix: magic string (6 bytes), major and minor version (2 bytes), and header length (2 bytes)...
+	prefix = 10;
+	len = padded( prefix, dict.length+1 ); // account for the terminating newline
+	if ( len > MAX_V1_HEADER_LENGTH ) {
+		// Version 2.0 uses a 4 byte header length:
+		prefix = 12;
+		len = padded( prefix, dict.length+1 );
+	}
+	out = new Uint8Array( prefix+len );
+	for ( i = 0; i < MAGIC.length; i++ ) {
+		out[ i ] = MAGIC[ i ];
+	}
+	out[ 6 ] = ( prefix === 10 ) ? 1 : 2; // major version
+	out[ 7 ] = 0; // minor version
+
+	// Write the header length as a little-endian unsigned integer:
+	out[ 8 ] = len & 0xff;
+	out[ 9 ] = ( len >>> 8 ) & 0xff;
+	if ( prefix === 12 ) {
+		out[ 10 ] = ( len >>> 16 ) & 0xff;
+		out[ 11 ] = ( len >>> 24 ) & 0xff;
+	}
+	for ( i = 0; i < dict.length; i++ ) {
+		out[ prefix+i ] = dict.charCodeAt( i );
+	}
+	for ( i = prefix+dict.length; i < out.length-1; i++ ) {
+		out[ i ] = 0x20; // space
+	}
+	out[ out.length-1 ] = 0x0a; // newline
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = header;
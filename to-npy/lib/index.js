@@ -0,0 +1,65 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+/**
+* Serialize an ndarray in the NumPy `.npy` format.
+*
+* @module @stdlib/ndarray/to-npy
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var out = ndarray2npy( x );
+* // returns <Uint8Array>
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+* var ndarray2npy = require( '@stdlib/ndarray/to-npy' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var it = ndarray2npy.chunks( x, {
+*     'chunkSize': 16
+* });
+*
+* var v = it.next().value;
+* // returns <Uint8Array>
+*/
+
+// MODULES //
+
+var setReadOnly = require( '@stdlib/utils/define-nonenumerable-read-only-property' );
+var main = require( './main.js' );
+var chunks = require( './chunks.js' );
+
+
+// MAIN //
+
+setReadOnly( main, 'chunks', chunks );
+
+
+// EXPORTS //
+
+module.exports = main;
+
+// exports: { "chunks": "main.chunks" }
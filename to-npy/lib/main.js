@@ -0,0 +1,79 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var Uint8Array = require( '@stdlib/array/uint8' );
+var chunks = require( './chunks.js' );
+
+
+// MAIN //
+
+/**
+* Serializes an ndarray in the NumPy `.npy` format.
+*
+* ## Notes
+*
+* -   The function returns a newly allocated byte array containing both the `.npy` header and array data. To serialize large ndarrays without materializing the entire output in memory, use the `chunks` method.
+*
+* @param {ndarrayLike} x - input ndarray
+* @throws {TypeError} must provide an ndarray having a supported data type
+* @returns {Uint8Array} serialized ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 1.0, 2.0 ], [ 3.0, 4.0 ] ] );
+*
+* var out = ndarray2npy( x );
+* // returns <Uint8Array>
+*/
+function ndarray2npy( x ) {
+	var list;
+	var it;
+	var out;
+	var len;
+	var v;
+	var i;
+
+	it = chunks( x );
+
+	// Collect chunks, which, for contiguous ndarrays, are views of the underlying data buffer and are thus not copied:
+	list = [];
+	len = 0;
+	v = it.next();
+	while ( !v.done ) {
+		list.push( v.value );
+		len += v.value.length;
+		v = it.next();
+	}
+	out = new Uint8Array( len );
+	len = 0;
+	for ( i = 0; i < list.length; i++ ) {
+		out.set( list[ i ], len );
+		len += list[ i ].length;
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = ndarray2npy;
@@ -0,0 +1,310 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var iteratorSymbol = require( '@stdlib/symbol/iterator' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var ndarray = require( './../../ctor' );
+var chunks = require( './../lib/chunks.js' );
+
+
+// FUNCTIONS //
+
+/**
+* Collects iterated values.
+*
+* @private
+* @param {Iterator} it - iterator
+* @returns {Array<Uint8Array>} iterated values
+*/
+function collect( it ) {
+	var out;
+	var v;
+
+	out = [];
+	v = it.next();
+	while ( !v.done ) {
+		out.push( v.value );
+		v = it.next();
+	}
+	return out;
+}
+
+/**
+* Converts a list of byte chunks to a double-precision floating-point array.
+*
+* @private
+* @param {Array<Uint8Array>} list - list of chunks
+* @returns {Float64Array} output array
+*/
+function toFloat64( list ) {
+	var out;
+	var len;
+	var i;
+
+	len = 0;
+	for ( i = 0; i < list.length; i++ ) {
+		len += list[ i ].length;
+	}
+	out = new Uint8Array( len );
+	len = 0;
+	for ( i = 0; i < list.length; i++ ) {
+		out.set( list[ i ], len );
+		len += list[ i ].length;
+	}
+	return new Float64Array( out.buffer );
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof chunks, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if not provided an ndarray', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = new ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		[],
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( x, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an invalid `chunkSize` option', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = new ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+
+	values = [
+		'5',
+		0,
+		-1,
+		3.14,
+		NaN,
+		true,
+		null,
+		[],
+		{}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			chunks( x, {
+				'chunkSize': value
+			});
+		};
+	}
+});
+
+tape( 'the function returns an iterator which returns a header followed by data chunks', function test( t ) {
+	var list;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2, 2 ], [ 2, 1 ], 0, 'row-major' );
+	list = collect( chunks( x ) );
+
+	t.strictEqual( list.length, 2, 'returns expected value' );
+	t.strictEqual( list[ 0 ].length % 64, 0, 'returns expected value' );
+	t.deepEqual( toFloat64( list.slice( 1 ) ), new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function returns data chunks which are views of the underlying data buffer for contiguous ndarrays', function test( t ) {
+	var list;
+	var buf;
+	var x;
+
+	buf = new Float64Array( [ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', buf, [ 3, 2 ], [ 2, 1 ], 1, 'row-major' );
+	list = collect( chunks( x, {
+		'chunkSize': 16
+	}));
+
+	t.strictEqual( list.length, 4, 'returns expected value' );
+	t.strictEqual( list[ 1 ].buffer, buf.buffer, 'returns expected value' );
+	t.strictEqual( list[ 1 ].byteOffset, 8, 'returns expected value' );
+	t.strictEqual( list[ 3 ].length, 16, 'returns expected value' );
+	t.deepEqual( toFloat64( list.slice( 1 ) ), new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports non-contiguous ndarrays spanning multiple chunks', function test( t ) {
+	var expected;
+	var list;
+	var buf;
+	var x;
+	var i;
+
+	buf = new Float64Array( 24 );
+	for ( i = 0; i < buf.length; i++ ) {
+		buf[ i ] = i;
+	}
+	// Every other column of a 4x6 matrix: [ [ 0, 2, 4 ], [ 6, 8, 10 ], [ 12, 14, 16 ], [ 18, 20, 22 ] ]
+	x = new ndarray( 'float64', buf, [ 4, 3 ], [ 6, 2 ], 0, 'row-major' );
+
+	// Use a chunk size which is not a multiple of the element size:
+	list = collect( chunks( x, {
+		'chunkSize': 20
+	}));
+
+	t.strictEqual( list.length, 7, 'returns expected value' );
+	for ( i = 1; i < list.length; i++ ) {
+		t.strictEqual( list[ i ].length, 16, 'returns expected value' );
+		t.notEqual( list[ i ].buffer, buf.buffer, 'returns expected value' );
+	}
+	expected = new Float64Array( [ 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22 ] );
+	t.deepEqual( toFloat64( list.slice( 1 ) ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function supports ndarrays whose rows are contiguous but which are not contiguous overall', function test( t ) {
+	var expected;
+	var list;
+	var buf;
+	var x;
+	var i;
+
+	buf = new Float64Array( 24 );
+	for ( i = 0; i < buf.length; i++ ) {
+		buf[ i ] = i;
+	}
+	// Top-right 3x4 block of a 4x6 matrix:
+	x = new ndarray( 'float64', buf, [ 3, 4 ], [ 6, 1 ], 2, 'row-major' );
+
+	list = collect( chunks( x, {
+		'chunkSize': 24
+	}));
+
+	expected = new Float64Array( [ 2, 3, 4, 5, 8, 9, 10, 11, 14, 15, 16, 17 ] );
+	t.deepEqual( toFloat64( list.slice( 1 ) ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the returned iterator has a `return` method for closing an iterator (no argument)', function test( t ) {
+	var it;
+	var r;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+	it = chunks( x );
+
+	r = it.next();
+	t.strictEqual( r.done, false, 'returns expected value' );
+
+	r = it.return();
+	t.strictEqual( r.value, void 0, 'returns expected value' );
+	t.strictEqual( r.done, true, 'returns expected value' );
+
+	r = it.next();
+	t.strictEqual( r.done, true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the returned iterator has a `return` method for closing an iterator (argument)', function test( t ) {
+	var it;
+	var r;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( 4 ), [ 4 ], [ 1 ], 0, 'row-major' );
+	it = chunks( x );
+
+	r = it.return( 'finished' );
+	t.strictEqual( r.value, 'finished', 'returns expected value' );
+	t.strictEqual( r.done, true, 'returns expected value' );
+	t.end();
+});
+
+tape( 'if an environment supports `Symbol.iterator`, the returned iterator is iterable', function test( t ) {
+	var it1;
+	var it2;
+	var x;
+
+	if ( !iteratorSymbol ) {
+		t.end();
+		return;
+	}
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+	it1 = chunks( x );
+	t.strictEqual( typeof it1[ iteratorSymbol ], 'function', 'has method' );
+
+	it2 = it1[ iteratorSymbol ]();
+	t.deepEqual( toFloat64( collect( it2 ).slice( 1 ) ), new Float64Array( [ 1.0, 2.0 ] ), 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,246 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var IS_LITTLE_ENDIAN = require( '@stdlib/assert/is-little-endian' );
+var isUint8Array = require( '@stdlib/assert/is-uint8array' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int16Array = require( '@stdlib/array/int16' );
+var Uint8Array = require( '@stdlib/array/uint8' );
+var Complex128Array = require( '@stdlib/array/complex128' );
+var BooleanArray = require( '@stdlib/array/bool' );
+var ndarray = require( './../../ctor' );
+var ndarray2npy = require( './../lib/main.js' );
+
+
+// VARIABLES //
+
+var BO = ( IS_LITTLE_ENDIAN ) ? '<' : '>';
+
+
+// FUNCTIONS //
+
+/**
+* Decodes a `.npy` header.
+*
+* @private
+* @param {Uint8Array} buf - serialized ndarray
+* @returns {Object} header length and header string
+*/
+function decodeHeader( buf ) {
+	var len;
+	var str;
+	var i;
+
+	len = buf[ 8 ] + ( buf[ 9 ]*256 );
+	str = '';
+	for ( i = 10; i < 10+len; i++ ) {
+		str += String.fromCharCode( buf[ i ] );
+	}
+	return {
+		'length': 10 + len,
+		'header': str.trim()
+	};
+}
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof ndarray2npy, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if not provided an ndarray', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided '+values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			ndarray2npy( value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an ndarray having an unsupported data type', function test( t ) {
+	t.throws( badValue, TypeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		ndarray2npy( new ndarray( 'generic', [ 1, 2, 3 ], [ 3 ], [ 1 ], 0, 'row-major' ) );
+	}
+});
+
+tape( 'the function serializes an ndarray in the `.npy` format (row-major, contiguous)', function test( t ) {
+	var out;
+	var buf;
+	var h;
+	var x;
+
+	buf = new Float64Array( [ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ] );
+	x = new ndarray( 'float64', buf, [ 2, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	out = ndarray2npy( x );
+	t.strictEqual( isUint8Array( out ), true, 'returns expected value' );
+
+	// Magic string and version:
+	t.deepEqual( Array.prototype.slice.call( out, 0, 8 ), [ 0x93, 0x4e, 0x55, 0x4d, 0x50, 0x59, 1, 0 ], 'returns expected value' );
+
+	h = decodeHeader( out );
+	t.strictEqual( h.length % 64, 0, 'returns expected value' );
+	t.strictEqual( out[ h.length-1 ], 0x0a, 'returns expected value' );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'f8\', \'fortran_order\': False, \'shape\': (2, 3), }', 'returns expected value' );
+
+	t.strictEqual( out.length, h.length+48, 'returns expected value' );
+	t.deepEqual( new Float64Array( out.slice( h.length ).buffer ), buf, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes an ndarray in the `.npy` format (column-major, contiguous)', function test( t ) {
+	var out;
+	var buf;
+	var h;
+	var x;
+
+	buf = new Int16Array( [ 1, 2, 3, 4, 5, 6 ] );
+	x = new ndarray( 'int16', buf, [ 2, 3 ], [ 1, 2 ], 0, 'column-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'i2\', \'fortran_order\': True, \'shape\': (2, 3), }', 'returns expected value' );
+	t.deepEqual( new Int16Array( out.slice( h.length ).buffer ), buf, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes an ndarray in the `.npy` format (non-contiguous, negative strides)', function test( t ) {
+	var expected;
+	var out;
+	var h;
+	var x;
+
+	// x = [ [ 3, 0 ], [ 4, 1 ], [ 5, 2 ] ]
+	x = new ndarray( 'float64', new Float64Array( [ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 ] ), [ 3, 2 ], [ 1, -3 ], 3, 'row-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'f8\', \'fortran_order\': False, \'shape\': (3, 2), }', 'returns expected value' );
+
+	expected = new Float64Array( [ 3.0, 0.0, 4.0, 1.0, 5.0, 2.0 ] );
+	t.deepEqual( new Float64Array( out.slice( h.length ).buffer ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes an ndarray in the `.npy` format (non-contiguous, column-major)', function test( t ) {
+	var expected;
+	var out;
+	var buf;
+	var h;
+	var x;
+
+	buf = new Float64Array( [ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0 ] );
+	x = new ndarray( 'float64', buf, [ 2, 3 ], [ 1, 4 ], 1, 'column-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'f8\', \'fortran_order\': True, \'shape\': (2, 3), }', 'returns expected value' );
+
+	expected = new Float64Array( [ 1.0, 2.0, 5.0, 6.0, 9.0, 10.0 ] );
+	t.deepEqual( new Float64Array( out.slice( h.length ).buffer ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes complex-valued ndarrays', function test( t ) {
+	var expected;
+	var out;
+	var h;
+	var x;
+
+	x = new ndarray( 'complex128', new Complex128Array( [ 1.0, 2.0, 3.0, 4.0 ] ), [ 2 ], [ 1 ], 0, 'row-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'c16\', \'fortran_order\': False, \'shape\': (2,), }', 'returns expected value' );
+
+	expected = new Float64Array( [ 1.0, 2.0, 3.0, 4.0 ] );
+	t.deepEqual( new Float64Array( out.slice( h.length ).buffer ), expected, 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes boolean ndarrays', function test( t ) {
+	var out;
+	var h;
+	var x;
+
+	x = new ndarray( 'bool', new BooleanArray( [ true, false, true ] ), [ 3 ], [ 1 ], 0, 'row-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \'|b1\', \'fortran_order\': False, \'shape\': (3,), }', 'returns expected value' );
+	t.deepEqual( out.slice( h.length ), new Uint8Array( [ 1, 0, 1 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes zero-dimensional ndarrays', function test( t ) {
+	var out;
+	var h;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( [ 1.0, 2.0 ] ), [], [ 0 ], 1, 'row-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'f8\', \'fortran_order\': False, \'shape\': (), }', 'returns expected value' );
+	t.deepEqual( new Float64Array( out.slice( h.length ).buffer ), new Float64Array( [ 2.0 ] ), 'returns expected value' );
+	t.end();
+});
+
+tape( 'the function serializes empty ndarrays', function test( t ) {
+	var out;
+	var h;
+	var x;
+
+	x = new ndarray( 'float64', new Float64Array( 0 ), [ 0, 3 ], [ 3, 1 ], 0, 'row-major' );
+
+	out = ndarray2npy( x );
+	h = decodeHeader( out );
+	t.strictEqual( h.header, '{\'descr\': \''+BO+'f8\', \'fortran_order\': False, \'shape\': (0, 3), }', 'returns expected value' );
+	t.strictEqual( out.length, h.length, 'returns expected value' );
+	t.end();
+});
@@ -0,0 +1,127 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// TypeScript Version: 4.1
+
+/// <reference types="@stdlib/types"/>
+
+import { ndarray, int32ndarray } from '@stdlib/types/ndarray';
+
+/**
+* Interface describing function options.
+*/
+interface Options {
+	/**
+	* Index of dimension along which to select elements. Default: `-1`.
+	*/
+	dim?: number;
+}
+
+/**
+* Interface describing function options when returning element values.
+*/
+interface ValuesOptions extends Options {
+	/**
+	* Boolean indicating whether to return element indices rather than element values.
+	*/
+	indices?: false;
+}
+
+/**
+* Interface describing function options when returning element indices.
+*/
+interface IndicesOptions extends Options {
+	/**
+	* Boolean indicating whether to return element indices rather than element values.
+	*/
+	indices: true;
+}
+
+/**
+* Interface describing `topk`.
+*/
+interface TopK {
+	/**
+	* Returns a new ndarray containing the `k` largest elements along a specified dimension of an input ndarray.
+	*
+	* @param x - input array
+	* @param k - number of elements to select
+	* @param options - function options
+	* @param options.dim - index of dimension along which to select elements
+	* @returns output ndarray
+	*
+	* @example
+	* var array = require( '@stdlib/ndarray/array' );
+	*
+	* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+	* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+	*
+	* var y = topk( x, 2 );
+	* // returns <ndarray>[ [ 3.0, 2.0 ], [ 6.0, 5.0 ] ]
+	*/
+	<T extends ndarray = ndarray>( x: T, k: number, options?: ValuesOptions ): T;
+
+	/**
+	* Returns a new ndarray containing the indices of the `k` largest elements along a specified dimension of an input ndarray.
+	*
+	* @param x - input array
+	* @param k - number of elements to select
+	* @param options - function options
+	* @param options.dim - index of dimension along which to select elements
+	* @param options.indices - boolean indicating whether to return element indices
+	* @returns output ndarray
+	*
+	* @example
+	* var array = require( '@stdlib/ndarray/array' );
+	*
+	* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+	* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+	*
+	* var y = topk( x, 2, {
+	*     'indices': true
+	* });
+	* // returns <ndarray>[ [ 0, 2 ], [ 0, 1 ] ]
+	*/
+	( x: ndarray, k: number, options: IndicesOptions ): int32ndarray;
+}
+
+/**
+* Returns a new ndarray containing the `k` largest elements, or their indices, along a specified dimension of an input ndarray.
+*
+* @param x - input array
+* @param k - number of elements to select
+* @param options - function options
+* @param options.dim - index of dimension along which to select elements
+* @param options.indices - boolean indicating whether to return element indices
+* @returns output ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+*
+* var y = topk( x, 2 );
+* // returns <ndarray>[ [ 3.0, 2.0 ], [ 6.0, 5.0 ] ]
+*/
+declare var topk: TopK;
+
+
+// EXPORTS //
+
+export = topk;
@@ -0,0 +1,103 @@
+/*
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+import empty = require( './../../../empty' );
+import topk = require( './index' );
+
+
+// TESTS //
+
+// The function returns an ndarray...
+{
+	const x = empty( [ 2, 2 ] );
+
+	topk( x, 2 ); // $ExpectType float64ndarray
+	topk( x, 2, {} ); // $ExpectType float64ndarray
+	topk( x, 2, { 'indices': false } ); // $ExpectType float64ndarray
+	topk( x, 2, { 'indices': true } ); // $ExpectType int32ndarray
+}
+
+// The compiler throws an error if the function is provided a first argument which is not an ndarray...
+{
+	topk( '10', 2 ); // $ExpectError
+	topk( 10, 2 ); // $ExpectError
+	topk( false, 2 ); // $ExpectError
+	topk( true, 2 ); // $ExpectError
+	topk( null, 2 ); // $ExpectError
+	topk( [], 2 ); // $ExpectError
+	topk( {}, 2 ); // $ExpectError
+	topk( ( x: number ): number => x, 2 ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an options argument which is not an object...
+{
+	const x = empty( [ 2, 2 ] );
+
+	topk( x, 2, '5' ); // $ExpectError
+	topk( x, 2, true ); // $ExpectError
+	topk( x, 2, false ); // $ExpectError
+	topk( x, 2, null ); // $ExpectError
+	topk( x, 2, [ '5' ] ); // $ExpectError
+	topk( x, 2, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a `dim` option which is not a number...
+{
+	const x = empty( [ 2, 2 ] );
+
+	topk( x, 2, { 'dim': '5' } ); // $ExpectError
+	topk( x, 2, { 'dim': true } ); // $ExpectError
+	topk( x, 2, { 'dim': false } ); // $ExpectError
+	topk( x, 2, { 'dim': null } ); // $ExpectError
+	topk( x, 2, { 'dim': [ '5' ] } ); // $ExpectError
+	topk( x, 2, { 'dim': {} } ); // $ExpectError
+	topk( x, 2, { 'dim': ( x: number ): number => x } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided a second argument which is not a number...
+{
+	const x = empty( [ 2, 2 ] );
+
+	topk( x, '5' ); // $ExpectError
+	topk( x, true ); // $ExpectError
+	topk( x, false ); // $ExpectError
+	topk( x, null ); // $ExpectError
+	topk( x, [] ); // $ExpectError
+	topk( x, {} ); // $ExpectError
+	topk( x, ( x: number ): number => x ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an `indices` option which is not a boolean...
+{
+	const x = empty( [ 2, 2 ] );
+
+	topk( x, 2, { 'indices': '5' } ); // $ExpectError
+	topk( x, 2, { 'indices': 5 } ); // $ExpectError
+	topk( x, 2, { 'indices': null } ); // $ExpectError
+	topk( x, 2, { 'indices': [] } ); // $ExpectError
+	topk( x, 2, { 'indices': {} } ); // $ExpectError
+}
+
+// The compiler throws an error if the function is provided an unsupported number of arguments...
+{
+	const x = empty( [ 2, 2 ] );
+
+	topk(); // $ExpectError
+	topk( x ); // $ExpectError
+	topk( x, 2, {}, {} ); // $ExpectError
+}
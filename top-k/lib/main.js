@@ -0,0 +1,184 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var isNonNegativeInteger = require( '@stdlib/assert/is-nonnegative-integer' ).isPrimitive;
+var isAccessorArray = require( '@stdlib/array/base/assert/is-accessor-array' );
+var isRealDataType = require( './../../base/assert/is-real-data-type' );
+var unaryStrided1d = require( './../../base/unary-strided1d' );
+var normalizeIndex = require( './../../base/normalize-index' );
+var ndarray = require( './../../base/ctor' );
+var getShape = require( './../../shape' ); // note: non-base accessor is intentional due to the input array originating in userland
+var getDType = require( './../../base/dtype' );
+var getOrder = require( './../../base/order' );
+var getStrides = require( './../../base/strides' );
+var getOffset = require( './../../base/offset' );
+var getData = require( './../../base/data-buffer' );
+var empty = require( './../../empty' );
+var resolveGetter = require( '@stdlib/array/base/resolve-getter' );
+var resolveSetter = require( '@stdlib/array/base/resolve-setter' );
+var Float64Array = require( '@stdlib/array/float64' );
+var Int32Array = require( '@stdlib/array/int32' );
+var zeros = require( '@stdlib/array/base/zeros' );
+var objectAssign = require( '@stdlib/object/assign' );
+var format = require( '@stdlib/string/format' );
+var defaults = require( './defaults.json' );
+var validate = require( './validate.js' );
+var topk1d = require( './topk1d.js' );
+
+
+// MAIN //
+
+/**
+* Returns a new ndarray containing the `k` largest elements, or their indices, along a specified dimension of an input ndarray.
+*
+* ## Notes
+*
+* -   The output ndarray has the same shape as the input ndarray, except for the specified dimension, which has size `k`.
+* -   Selected elements are ordered from largest to smallest. `NaN` values are considered greater than all other values, and ties are resolved in favor of the element having the lower index.
+* -   The function selects elements using a bounded binary heap, and thus avoids sorting each lane when `k` is small relative to the size of the specified dimension.
+*
+* @param {ndarray} x - input ndarray
+* @param {NonNegativeInteger} k - number of elements to select
+* @param {Options} [options] - function options
+* @param {integer} [options.dim=-1] - dimension along which to select elements
+* @param {boolean} [options.indices=false] - boolean indicating whether to return element indices rather than element values
+* @throws {TypeError} first argument must be an ndarray-like object
+* @throws {TypeError} first argument must have a real-valued or "generic" data type
+* @throws {TypeError} second argument must be a nonnegative integer
+* @throws {TypeError} options argument must be an object
+* @throws {RangeError} dimension index exceeds the number of dimensions
+* @throws {RangeError} second argument must not exceed the size of the specified dimension
+* @throws {Error} must provide valid options
+* @returns {ndarray} output ndarray
+*
+* @example
+* var array = require( '@stdlib/ndarray/array' );
+*
+* var x = array( [ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ] );
+* // returns <ndarray>[ [ 3.0, 1.0, 2.0 ], [ 6.0, 5.0, 4.0 ] ]
+*
+* var y = topk( x, 2 );
+* // returns <ndarray>[ [ 3.0, 2.0 ], [ 6.0, 5.0 ] ]
+*
+* y = topk( x, 1, {
+*     'dim': 0,
+*     'indices': true
+* });
+* // returns <ndarray>[ [ 1, 1, 1 ] ]
+*/
+function topk( x, k, options ) {
+	var opts;
+	var xbuf;
+	var ybuf;
+	var err;
+	var shx;
+	var shy;
+	var shv;
+	var sy;
+	var sv;
+	var sw;
+	var dt;
+	var N;
+	var d;
+	var y;
+	var v;
+	var w;
+	var i;
+
+	if ( !isndarrayLike( x ) ) {
+		throw new TypeError( format( 'invalid argument. First argument must be an ndarray-like object. Value: `%s`.', x ) );
+	}
+	dt = getDType( x );
+	if ( !isRealDataType( dt ) && String( dt ) !== 'generic' ) {
+		throw new TypeError( format( 'invalid argument. First argument must have a real-valued or "generic" data type. Value: `%s`.', dt ) );
+	}
+	if ( !isNonNegativeInteger( k ) ) {
+		throw new TypeError( format( 'invalid argument. Second argument must be a nonnegative integer. Value: `%s`.', k ) );
+	}
+	opts = objectAssign( {}, defaults );
+	if ( arguments.length > 2 ) {
+		err = validate( opts, options );
+		if ( err ) {
+			throw err;
+		}
+	}
+	shx = getShape( x );
+	N = shx.length;
+	d = normalizeIndex( opts.dim, N-1 );
+	if ( d === -1 ) {
+		throw new RangeError( format( 'invalid option. Dimension index exceeds the number of dimensions. Number of dimensions: %d. Value: `%d`.', N, opts.dim ) );
+	}
+	if ( k > shx[ d ] ) {
+		throw new RangeError( format( 'invalid argument. Second argument must not exceed the size of the specified dimension. Dimension size: %d. Value: `%d`.', shx[ d ], k ) );
+	}
+	// Initialize an output array having the same shape as the input array, except for the specified dimension:
+	shy = shx.slice();
+	shy[ d ] = k;
+	y = empty( shy, {
+		'dtype': ( opts.indices ) ? 'int32' : dt,
+		'order': getOrder( x )
+	});
+	if ( k === 0 ) {
+		return y;
+	}
+	xbuf = getData( x );
+	ybuf = getData( y );
+
+	// Create a view of the output array in which the specified dimension is the last dimension, as the output array is supplied as an additional array argument whose loop dimensions precede its core dimension:
+	sy = getStrides( y, false );
+	shv = [];
+	sv = [];
+	for ( i = 0; i < N; i++ ) {
+		if ( i !== d ) {
+			shv.push( shy[ i ] );
+			sv.push( sy[ i ] );
+		}
+	}
+	shv.push( k );
+	sv.push( sy[ d ] );
+	v = new ndarray( getDType( y ), ybuf, shv, sv, getOffset( y ), getOrder( y ) );
+
+	// Create a workspace array having the same shape as the input array, where each lane along the specified dimension shares a single contiguous buffer for storing heap values:
+	sw = zeros( N );
+	sw[ d ] = 1;
+	if ( String( dt ) === 'generic' ) {
+		w = new ndarray( 'generic', zeros( shx[ d ] ), shx, sw, 0, getOrder( x ) );
+	} else {
+		w = new ndarray( 'float64', new Float64Array( shx[ d ] ), shx, sw, 0, getOrder( x ) );
+	}
+
+	// Select elements from each lane along the specified dimension:
+	unaryStrided1d( topk1d, [ x, w, v ], [ d ], {
+		'k': k,
+		'workspace': new Int32Array( k ),
+		'indices': opts.indices,
+		'accessorProtocol': ( isAccessorArray( xbuf ) || isAccessorArray( ybuf ) ),
+		'accessors': [ resolveGetter( xbuf ), resolveSetter( ybuf ) ]
+	});
+	return y;
+}
+
+
+// EXPORTS //
+
+module.exports = topk;
@@ -0,0 +1,198 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+
+
+// FUNCTIONS //
+
+/**
+* Tests whether a first element ranks below a second element.
+*
+* ## Notes
+*
+* -   Elements are ranked by value, with `NaN` values ranking above all other values. Ties are broken by element index, with lower indices ranking above higher indices.
+*
+* @private
+* @param {number} v1 - first value
+* @param {NonNegativeInteger} i1 - first index
+* @param {number} v2 - second value
+* @param {NonNegativeInteger} i2 - second index
+* @returns {boolean} boolean indicating whether the first element ranks below the second element
+*/
+function isWorse( v1, i1, v2, i2 ) {
+	if ( isnan( v1 ) ) {
+		return ( isnan( v2 ) && i1 > i2 );
+	}
+	if ( isnan( v2 ) || v1 < v2 ) {
+		return true;
+	}
+	return ( v1 === v2 && i1 > i2 );
+}
+
+/**
+* Restores the heap property of a binary heap whose root element ranks lowest by moving an element down the heap.
+*
+* @private
+* @param {Collection} values - heap values
+* @param {Collection} indices - heap indices
+* @param {NonNegativeInteger} N - number of heap elements
+* @param {NonNegativeInteger} i - index of the element to move
+*/
+function siftDown( values, indices, N, i ) {
+	var v;
+	var j;
+	var c;
+	var r;
+
+	v = values[ i ];
+	j = indices[ i ];
+	while ( true ) {
+		c = ( 2*i ) + 1;
+		if ( c >= N ) {
+			break;
+		}
+		r = c + 1;
+		if ( r < N && isWorse( values[ r ], indices[ r ], values[ c ], indices[ c ] ) ) { // eslint-disable-line max-len
+			c = r;
+		}
+		if ( !isWorse( values[ c ], indices[ c ], v, j ) ) {
+			break;
+		}
+		values[ i ] = values[ c ];
+		indices[ i ] = indices[ c ];
+		i = c;
+	}
+	values[ i ] = v;
+	indices[ i ] = j;
+}
+
+
+// MAIN //
+
+/**
+* Finds the `k` largest elements of a one-dimensional input ndarray and assigns either the elements or their indices to a one-dimensional output ndarray.
+*
+* ## Notes
+*
+* -   The function maintains a binary heap containing the `k` highest ranking elements seen so far, where the root of the heap is the lowest ranking retained element. Accordingly, most elements are rejected after a single comparison against the heap root, and the function requires `O(N log k)` time and `O(k)` additional memory, rather than sorting the entire input ndarray.
+* -   Heap values are stored in the first `k` elements of the data buffer of a contiguous one-dimensional workspace ndarray, and heap indices are stored in a separate workspace array.
+* -   Once every element has been visited, the function sorts the heap in place, such that the output ndarray contains elements ordered from highest to lowest rank.
+*
+* @private
+* @param {ArrayLikeObject<Object>} arrays - array-like object containing a one-dimensional input ndarray, a one-dimensional workspace ndarray, and a one-dimensional output ndarray
+* @param {Object} opts - function options
+* @param {PositiveInteger} opts.k - number of elements to select
+* @param {Int32Array} opts.workspace - workspace array for storing heap indices
+* @param {Array<Function>} opts.accessors - input and output array element accessors
+* @param {boolean} opts.accessorProtocol - boolean indicating whether the input and output ndarrays must be accessed via accessors
+* @param {boolean} opts.indices - boolean indicating whether to return element indices
+* @returns {Object} output ndarray
+*/
+function topk1d( arrays, opts ) {
+	var values;
+	var indices;
+	var xbuf;
+	var obuf;
+	var get;
+	var set;
+	var out;
+	var sx;
+	var so;
+	var ix;
+	var io;
+	var N;
+	var M;
+	var k;
+	var x;
+	var v;
+	var i;
+
+	x = arrays[ 0 ];
+	out = arrays[ 2 ];
+
+	N = x.shape[ 0 ];
+	k = opts.k;
+	xbuf = x.data;
+	obuf = out.data;
+	sx = x.strides[ 0 ];
+	so = out.strides[ 0 ];
+	values = arrays[ 1 ].data;
+	indices = opts.workspace;
+	get = opts.accessors[ 0 ];
+	set = opts.accessors[ 1 ];
+
+	// Fill the heap with the first `k` elements...
+	ix = x.offset;
+	for ( i = 0; i < k; i++ ) {
+		values[ i ] = ( opts.accessorProtocol ) ? get( xbuf, ix ) : xbuf[ ix ];
+		indices[ i ] = i;
+		ix += sx;
+	}
+	for ( i = ( k >> 1 ) - 1; i >= 0; i-- ) {
+		siftDown( values, indices, k, i );
+	}
+	// Replace the lowest ranking retained element whenever we encounter a higher ranking element...
+	for ( i = k; i < N; i++ ) {
+		v = ( opts.accessorProtocol ) ? get( xbuf, ix ) : xbuf[ ix ];
+		if ( isWorse( values[ 0 ], indices[ 0 ], v, i ) ) {
+			values[ 0 ] = v;
+			indices[ 0 ] = i;
+			siftDown( values, indices, k, 0 );
+		}
+		ix += sx;
+	}
+	// Sort the heap by repeatedly moving the lowest ranking element to the end of the heap...
+	for ( M = k-1; M > 0; M-- ) {
+		v = values[ 0 ];
+		values[ 0 ] = values[ M ];
+		values[ M ] = v;
+		i = indices[ 0 ];
+		indices[ 0 ] = indices[ M ];
+		indices[ M ] = i;
+		siftDown( values, indices, M, 0 );
+	}
+	// Write the results to the output ndarray:
+	io = out.offset;
+	if ( opts.indices ) {
+		for ( i = 0; i < k; i++ ) {
+			obuf[ io ] = indices[ i ];
+			io += so;
+		}
+	} else if ( opts.accessorProtocol ) {
+		for ( i = 0; i < k; i++ ) {
+			set( obuf, io, values[ i ] );
+			io += so;
+		}
+	} else {
+		for ( i = 0; i < k; i++ ) {
+			obuf[ io ] = values[ i ];
+			io += so;
+		}
+	}
+	return out;
+}
+
+
+// EXPORTS //
+
+module.exports = topk1d;
@@ -0,0 +1,430 @@
+/**
+* @license Apache-2.0
+*
+* Copyright (c) 2026 The Stdlib Authors.
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+'use strict';
+
+// MODULES //
+
+var tape = require( 'tape' );
+var isndarrayLike = require( '@stdlib/assert/is-ndarray-like' );
+var isnan = require( '@stdlib/math/base/assert/is-nan' );
+var Float64Array = require( '@stdlib/array/float64' );
+var empty = require( './../../empty' );
+var ndarray2array = require( './../../to-array' );
+var array = require( './../../array' );
+var getDType = require( './../../base/dtype' );
+var getData = require( './../../base/data-buffer' );
+var getShape = require( './../../base/shape' );
+var getOrder = require( './../../base/order' );
+var topk = require( './../lib' );
+
+
+// TESTS //
+
+tape( 'main export is a function', function test( t ) {
+	t.ok( true, __filename );
+	t.strictEqual( typeof topk, 'function', 'main export is a function' );
+	t.end();
+});
+
+tape( 'the function throws an error if provided a first argument which is not an ndarray', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( value, 1 );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an ndarray having an unsupported data type', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		empty( [ 2, 2 ], {
+			'dtype': 'complex128'
+		}),
+		empty( [ 2, 2 ], {
+			'dtype': 'complex64'
+		}),
+		empty( [ 2, 2 ], {
+			'dtype': 'bool'
+		})
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + getDType( values[ i ] ) );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( value, 1 );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an options argument which is not an object', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		5,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( x, 1, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a `dim` option which is not an integer', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		-3.14,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( x, 1, {
+				'dim': value
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a `dim` option which is out-of-bounds', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		-4,
+		-3,
+		2,
+		3,
+		4
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), RangeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( x, 1, {
+				'dim': value
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a zero-dimensional ndarray', function test( t ) {
+	var x = empty( [] );
+	t.throws( badValue, RangeError, 'throws an error' );
+	t.end();
+
+	function badValue() {
+		topk( x, 1 );
+	}
+});
+
+tape( 'the function throws an error if provided a second argument which is not a nonnegative integer', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		-1,
+		3.14,
+		NaN,
+		true,
+		false,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( x, value );
+		};
+	}
+});
+
+tape( 'the function throws an error if provided a second argument which exceeds the size of the specified dimension', function test( t ) {
+	var x = empty( [ 2, 3 ] );
+	t.throws( badValue( 4, -1 ), RangeError, 'throws an error' );
+	t.throws( badValue( 3, 0 ), RangeError, 'throws an error' );
+	t.end();
+
+	function badValue( k, dim ) {
+		return function badValue() {
+			topk( x, k, {
+				'dim': dim
+			});
+		};
+	}
+});
+
+tape( 'the function throws an error if provided an `indices` option which is not a boolean', function test( t ) {
+	var values;
+	var x;
+	var i;
+
+	x = empty( [ 2, 2 ] );
+	values = [
+		'5',
+		5,
+		NaN,
+		null,
+		void 0,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[ i ] ), TypeError, 'throws an error when provided ' + values[ i ] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			topk( x, 1, {
+				'indices': value
+			});
+		};
+	}
+});
+
+tape( 'the function returns a new ndarray containing the `k` largest elements along a specified dimension (ndims=1)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( [ 4.0, -1.0, 3.0, 0.0, 6.0, 2.0 ] );
+
+	actual = topk( x, 3 );
+	expected = [ 6.0, 4.0, 3.0 ];
+
+	t.strictEqual( isndarrayLike( actual ), true, 'returns expected value' );
+	t.deepEqual( getShape( actual ), [ 3 ], 'returns expected value' );
+	t.strictEqual( String( getDType( actual ) ), String( getDType( x ) ), 'returns expected value' );
+	t.notEqual( getData( actual ), getData( x ), 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = topk( x, 6 );
+	expected = [ 6.0, 4.0, 3.0, 2.0, 0.0, -1.0 ];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a new ndarray containing the indices of the `k` largest elements along a specified dimension (ndims=1)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( [ 4.0, -1.0, 3.0, 0.0, 6.0, 2.0 ] );
+
+	actual = topk( x, 3, {
+		'indices': true
+	});
+	expected = [ 4, 0, 2 ];
+
+	t.deepEqual( getShape( actual ), [ 3 ], 'returns expected value' );
+	t.strictEqual( String( getDType( actual ) ), 'int32', 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a new ndarray containing the `k` largest elements along a specified dimension (ndims=2)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( [ [ 3.0, 1.0, 2.0 ], [ 4.0, 6.0, 5.0 ] ] );
+
+	actual = topk( x, 2 );
+	expected = [ [ 3.0, 2.0 ], [ 6.0, 5.0 ] ];
+	t.deepEqual( getShape( actual ), [ 2, 2 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = topk( x, 1, {
+		'dim': 0
+	});
+	expected = [ [ 4.0, 6.0, 5.0 ] ];
+	t.deepEqual( getShape( actual ), [ 1, 3 ], 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = topk( x, 2, {
+		'dim': 0,
+		'indices': true
+	});
+	expected = [ [ 1, 1, 1 ], [ 0, 0, 0 ] ];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns a new ndarray containing the `k` largest elements along a specified dimension (ndims=3, column-major)', function test( t ) {
+	var expected;
+	var actual;
+	var x;
+
+	x = array( new Float64Array( [ 5.0, 2.0, 7.0, 0.0, 1.0, 3.0, 8.0, 4.0, 9.0, 6.0, 11.0, 10.0 ] ), {
+		'shape': [ 2, 3, 2 ],
+		'order': 'column-major'
+	});
+
+	actual = topk( x, 2, {
+		'dim': 1
+	});
+	expected = [
+		[ [ 7.0, 11.0 ], [ 5.0, 9.0 ] ],
+		[ [ 3.0, 10.0 ], [ 2.0, 6.0 ] ]
+	];
+	t.deepEqual( getShape( actual ), [ 2, 2, 2 ], 'returns expected value' );
+	t.strictEqual( getOrder( actual ), 'column-major', 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	actual = topk( x, 2, {
+		'dim': 1,
+		'indices': true
+	});
+	expected = [
+		[ [ 1, 2 ], [ 0, 1 ] ],
+		[ [ 2, 2 ], [ 0, 1 ] ]
+	];
+	t.deepEqual( ndarray2array( actual ), expected, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function considers `NaN` values to be greater than all other values and resolves ties in favor of lower indices', function test( t ) {
+	var actual;
+	var x;
+
+	x = array( [ 2.0, NaN, 2.0, 5.0, NaN, 2.0 ] );
+
+	actual = topk( x, 5, {
+		'indices': true
+	});
+	t.deepEqual( ndarray2array( actual ), [ 1, 4, 3, 0, 2 ], 'returns expected value' );
+
+	actual = ndarray2array( topk( x, 3 ) );
+	t.strictEqual( isnan( actual[ 0 ] ) && isnan( actual[ 1 ] ), true, 'returns expected value' );
+	t.strictEqual( actual[ 2 ], 5.0, 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function supports ndarrays having a "generic" data type', function test( t ) {
+	var actual;
+	var x;
+
+	x = array( [ [ 3.0, 1.0, 2.0 ], [ 4.0, 6.0, 5.0 ] ], {
+		'dtype': 'generic'
+	});
+
+	actual = topk( x, 2 );
+	t.strictEqual( String( getDType( actual ) ), 'generic', 'returns expected value' );
+	t.deepEqual( ndarray2array( actual ), [ [ 3.0, 2.0 ], [ 6.0, 5.0 ] ], 'returns expected value' );
+
+	t.end();
+});
+
+tape( 'the function returns an empty ndarray when `k` is zero', function test( t ) {
+	var actual;
+	var x;
+
+	x = array( [ [ 3.0, 1.0, 2.0 ], [ 4.0, 6.0, 5.0 ] ] );
+
+	actual = topk( x, 0 );
+	t.deepEqual( getShape( actual ), [ 2, 0 ], 'returns expected value' );
+	t.strictEqual( String( getDType( actual ) ), String( getDType( x ) ), 'returns expected value' );
+
+	t.end();
+});
@@ -26,6 +26,8 @@ var isPlainObject = require( '@stdlib/assert/is-plain-object' );
 var isNonNegativeIntegerArray = require( '@stdlib/assert/is-nonnegative-integer-array' ).primitives;
 var isEmptyCollection = require( '@stdlib/assert/is-empty-collection' );
 var hasOwnProp = require( '@stdlib/assert/has-own-property' );
+var isObject = require( '@stdlib/assert/is-object' );
+var isFunction = require( '@stdlib/assert/is-function' );
 var contains = require( '@stdlib/array/base/assert/contains' ).factory;
 var shape2strides = require( './../../base/shape2strides' );
 var buffer = require( './../../base/buffer' );
@@ -58,11 +60,13 @@ var isDataType = contains( DTYPES );
 * @param {string} [options.mode="throw"] - specifies how to handle indices which exceed array dimensions
 * @param {ArrayLikeObject<string>} [options.submode=[options.mode]] - specifies how to handle subscripts which exceed array dimensions on a per dimension basis
 * @param {boolean} [options.readonly=false] - boolean indicating whether an array should be read-only
+* @param {Object} [options.pool] - buffer pool from which to allocate the underlying data buffer (e.g., as returned by `@stdlib/ndarray/base/buffer-pool`)
 * @throws {TypeError} first argument must have a recognized data type
 * @throws {TypeError} options argument must be an object
 * @throws {TypeError} `dtype` option must be a supported data type
 * @throws {TypeError} `order` option must be a supported order
 * @throws {TypeError} `shape` option must be either a nonnegative integer or an array of nonnegative integers
+* @throws {TypeError} `pool` option must be a buffer pool
 * @throws {TypeError} must provide valid options
 * @returns {ndarray} ndarray
 *
@@ -89,6 +93,8 @@ function zerosLike( x ) {
 	var order;
 	var ndims;
 	var opts;
+	var pool;
+	var buf;
 	var len;
 	var flg;
 	var st;
@@ -137,6 +143,12 @@ function zerosLike( x ) {
 		if ( hasOwnProp( options, 'readonly' ) ) {
 			opts.readonly = options.readonly;
 		}
+		if ( hasOwnProp( options, 'pool' ) ) {
+			pool = options.pool;
+			if ( !isObject( pool ) || !isFunction( pool.calloc ) ) {
+				throw new TypeError( format( 'invalid option. `%s` option must be a buffer pool. Option: `%s`.', 'pool', pool ) );
+			}
+		}
 	} else {
 		dtype = getDType( x );
 		sh = getShape( x );
@@ -154,7 +166,12 @@ function zerosLike( x ) {
 		len = 1;
 		st = [ 0 ];
 	}
-	return new ndarray( dtype, buffer( dtype, len ), sh, st, 0, order, opts );
+	if ( pool ) {
+		buf = pool.calloc( dtype, len );
+	} else {
+		buf = buffer( dtype, len );
+	}
+	return new ndarray( dtype, buf, sh, st, 0, order, opts );
 }
 
 
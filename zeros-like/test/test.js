@@ -36,6 +36,7 @@ var reinterpret64 = require( '@stdlib/strided/base/reinterpret-complex64' );
 var reinterpret128 = require( '@stdlib/strided/base/reinterpret-complex128' );
 var instanceOf = require( '@stdlib/assert/instance-of' );
 var ndarray = require( './../../ctor' );
+var bufferPool = require( './../../base/buffer-pool' );
 var zeros = require( './../../base/zeros' );
 var getShape = require( './../../shape' );
 var getDType = require( './../../dtype' );
@@ -293,6 +294,35 @@ tape( 'the function throws an error if provided an invalid `submode` option', fu
 	}
 });
 
+tape( 'the function throws an error if provided a `pool` option which is not a buffer pool', function test( t ) {
+	var values;
+	var i;
+
+	values = [
+		'5',
+		5,
+		null,
+		true,
+		false,
+		[],
+		{},
+		function noop() {}
+	];
+
+	for ( i = 0; i < values.length; i++ ) {
+		t.throws( badValue( values[i] ), TypeError, 'throws an error when provided '+values[i] );
+	}
+	t.end();
+
+	function badValue( value ) {
+		return function badValue() {
+			zerosLike( zeros( 'float64', [ 2, 2 ], 'row-major' ), {
+				'pool': value
+			});
+		};
+	}
+});
+
 tape( 'the function throws an error if provided a `readonly` option which is not a boolean', function test( t ) {
 	var values;
 	var i;
@@ -1019,3 +1049,28 @@ tape( 'the function supports specifying array index modes and submodes', functio
 
 	t.end();
 });
+
+tape( 'the function supports allocating the underlying data buffer from a buffer pool', function test( t ) {
+	var pool;
+	var buf;
+	var arr;
+
+	pool = bufferPool();
+	buf = pool.malloc( 'float64', 4 );
+	buf[ 0 ] = 1.0;
+	pool.free( buf );
+
+	arr = zerosLike( zeros( 'float64', [ 2, 2 ], 'row-major' ), {
+		'pool': pool
+	});
+	t.strictEqual( instanceOf( arr, ndarray ), true, 'returns expected value' );
+	t.strictEqual( String( getDType( arr ) ), 'float64', 'returns expected value' );
+	t.deepEqual( getShape( arr ), [ 2, 2 ], 'returns expected value' );
+	t.strictEqual( getData( arr ).buffer, buf.buffer, 'returns expected value' );
+	t.strictEqual( getData( arr ).length, 4, 'returns expected value' );
+	t.deepEqual( getData( arr ), new Float64Array( 4 ), 'returns expected value' );
+	t.strictEqual( pool.stats().hits, 1, 'returns expected value' );
+	t.strictEqual( pool.free( getData( arr ) ), true, 'returns expected value' );
+
+	t.end();
+});
@@ -22,6 +22,20 @@
 
 import { Shape, Order, Mode, typedndarray, float64ndarray, float32ndarray, int32ndarray, int16ndarray, int8ndarray, uint32ndarray, uint16ndarray, uint8ndarray, uint8cndarray, genericndarray, complex128ndarray, complex64ndarray, NumericAndGenericDataType, Float64DataType, Float32DataType, Complex128DataType, Complex64DataType, Int32DataType, Int16DataType, Int8DataType, Uint32DataType, Uint16DataType, Uint8DataType, Uint8cDataType, GenericDataType } from '@stdlib/types/ndarray';
 
+/**
+* Interface describing a buffer pool.
+*/
+interface BufferPool {
+	/**
+	* Returns a zero-filled data buffer having a specified data type and length.
+	*
+	* @param dtype - data type
+	* @param size - buffer size
+	* @returns data buffer
+	*/
+	calloc( dtype: any, size: number ): any;
+}
+
 /**
 * Interface describing function options.
 */
@@ -49,6 +63,11 @@ interface Options {
 	* Boolean indicating whether an array should be read-only (default: false).
 	*/
 	readonly?: boolean;
+
+	/**
+	* Buffer pool from which to allocate the underlying data buffer.
+	*/
+	pool?: BufferPool;
 }
 
 /**